@@ -185,20 +185,32 @@ void Adafruit_BME280::write8(byte reg, byte value) {
   }
 }
 
+/*!
+ *   @brief  Reads consecutive registers in one transaction over I2C or SPI
+ *   @param reg the first register address to read from
+ *   @param buffer where to put the data
+ *   @param len the number of bytes to read
+ *   @returns true if the read worked
+ */
+bool Adafruit_BME280::readBurst(byte reg, uint8_t *buffer, size_t len) {
+  uint8_t addr;
+  if (i2c_dev) {
+    addr = uint8_t(reg);
+    return i2c_dev->write_then_read(&addr, 1, buffer, len);
+  } else {
+    addr = uint8_t(reg | 0x80);
+    return spi_dev->write_then_read(&addr, 1, buffer, len);
+  }
+}
+
 /*!
  *   @brief  Reads an 8 bit value over I2C or SPI
  *   @param reg the register address to read from
  *   @returns the data byte read from the device
  */
 uint8_t Adafruit_BME280::read8(byte reg) {
-  uint8_t buffer[1];
-  if (i2c_dev) {
-    buffer[0] = uint8_t(reg);
-    i2c_dev->write_then_read(buffer, 1, buffer, 1);
-  } else {
-    buffer[0] = uint8_t(reg | 0x80);
-    spi_dev->write_then_read(buffer, 1, buffer, 1);
-  }
+  uint8_t buffer[1] = {uint8_t(reg)};
+  readBurst(reg, buffer, 1);
   return buffer[0];
 }
 
@@ -208,15 +220,8 @@ uint8_t Adafruit_BME280::read8(byte reg) {
  *   @returns the 16 bit data value read from the device
  */
 uint16_t Adafruit_BME280::read16(byte reg) {
-  uint8_t buffer[2];
-
-  if (i2c_dev) {
-    buffer[0] = uint8_t(reg);
-    i2c_dev->write_then_read(buffer, 1, buffer, 2);
-  } else {
-    buffer[0] = uint8_t(reg | 0x80);
-    spi_dev->write_then_read(buffer, 1, buffer, 2);
-  }
+  uint8_t buffer[2] = {uint8_t(reg)};
+  readBurst(reg, buffer, 2);
   return uint16_t(buffer[0]) << 8 | uint16_t(buffer[1]);
 }
 
@@ -252,16 +257,8 @@ int16_t Adafruit_BME280::readS16_LE(byte reg) {
  *   @returns the 24 bit data value read from the device
  */
 uint32_t Adafruit_BME280::read24(byte reg) {
-  uint8_t buffer[3];
-
-  if (i2c_dev) {
-    buffer[0] = uint8_t(reg);
-    i2c_dev->write_then_read(buffer, 1, buffer, 3);
-  } else {
-    buffer[0] = uint8_t(reg | 0x80);
-    spi_dev->write_then_read(buffer, 1, buffer, 3);
-  }
-
+  uint8_t buffer[3] = {uint8_t(reg)};
+  readBurst(reg, buffer, 3);
   return uint32_t(buffer[0]) << 16 | uint32_t(buffer[1]) << 8 |
          uint32_t(buffer[2]);
 }
@@ -271,57 +268,110 @@ uint32_t Adafruit_BME280::read24(byte reg) {
     @returns true in case of success else false
  */
 bool Adafruit_BME280::takeForcedMeasurement(void) {
-  bool return_value = false;
   // If we are in forced mode, the BME sensor goes back to sleep after each
   // measurement and we need to set it to forced mode once at this point, so
   // it will take the next measurement and then return to sleep again.
   // In normal mode simply does new measurements periodically.
-  if (_measReg.mode == MODE_FORCED) {
-    return_value = true;
-    // set to forced mode, i.e. "take next measurement"
-    write8(BME280_REGISTER_CONTROL, _measReg.get());
-    // Store current time to measure the timeout
-    uint32_t timeout_start = millis();
-    // wait until measurement has been completed, otherwise we would read the
-    // the values from the last measurement or the timeout occurred after 2 sec.
-    while (read8(BME280_REGISTER_STATUS) & 0x08) {
-      // In case of a timeout, stop the while loop
-      if ((millis() - timeout_start) > 2000) {
-        return_value = false;
-        break;
-      }
-      delay(1);
+  if (!startForcedMeasurement()) {
+    return false;
+  }
+  // The measurement cannot be done sooner, so don't poll the bus meanwhile
+  delay(measurementTime());
+  // wait until measurement has been completed, otherwise we would read the
+  // the values from the last measurement or the timeout occurred after 2 sec.
+  while (isMeasuring()) {
+    // In case of a timeout, stop the while loop
+    if ((millis() - _measureStart) > 2000) {
+      _measuring = false;
+      return false;
     }
+    delay(1);
   }
-  return return_value;
+  return true;
+}
+
+/*!
+ *  @brief  Start a new measurement and return right away (only possible in
+ *  forced mode). Check isMeasuring() and then get the results with readAll().
+ *  Starting the next measurement as soon as one is read keeps the sensor
+ *  converting while the sketch does other work.
+ *  @returns true if the measurement was started
+ */
+bool Adafruit_BME280::startForcedMeasurement(void) {
+  if (_measReg.mode != MODE_FORCED) {
+    return false;
+  }
+  // set to forced mode, i.e. "take next measurement"
+  write8(BME280_REGISTER_CONTROL, _measReg.get());
+  _measureStart = millis();
+  _measuring = true;
+  return true;
+}
+
+/*!
+ *  @brief  Check on a measurement started with startForcedMeasurement().
+ *  The sensor is not asked before measurementTime() has passed.
+ *  @returns true while the measurement is still running
+ */
+bool Adafruit_BME280::isMeasuring(void) {
+  if (!_measuring) {
+    return false;
+  }
+  if ((millis() - _measureStart) < measurementTime()) {
+    return true;
+  }
+  _measuring = (read8(BME280_REGISTER_STATUS) & 0x08) != 0;
+  return _measuring;
+}
+
+/*!
+ *  @brief  Typical time a forced measurement takes with the current
+ *  oversampling settings, from the datasheet (section 9.1). The longest is
+ *  about 15% more.
+ *  @returns the time in milliseconds, rounded up
+ */
+uint32_t Adafruit_BME280::measurementTime(void) {
+  uint8_t osrs[3] = {(uint8_t)_measReg.osrs_t, (uint8_t)_measReg.osrs_p,
+                     (uint8_t)_humReg.osrs_h};
+  uint32_t us = 1000;
+  for (uint8_t i = 0; i < 3; i++) {
+    if (osrs[i]) {
+      // 2 ms per sample, plus 0.5 ms for pressure and humidity
+      us += (2000UL << (min(osrs[i], (uint8_t)5) - 1)) + (i ? 500 : 0);
+    }
+  }
+  return (us + 999) / 1000;
 }
 
 /*!
  *   @brief  Reads the factory-set coefficients
  */
 void Adafruit_BME280::readCoefficients(void) {
-  _bme280_calib.dig_T1 = read16_LE(BME280_REGISTER_DIG_T1);
-  _bme280_calib.dig_T2 = readS16_LE(BME280_REGISTER_DIG_T2);
-  _bme280_calib.dig_T3 = readS16_LE(BME280_REGISTER_DIG_T3);
-
-  _bme280_calib.dig_P1 = read16_LE(BME280_REGISTER_DIG_P1);
-  _bme280_calib.dig_P2 = readS16_LE(BME280_REGISTER_DIG_P2);
-  _bme280_calib.dig_P3 = readS16_LE(BME280_REGISTER_DIG_P3);
-  _bme280_calib.dig_P4 = readS16_LE(BME280_REGISTER_DIG_P4);
-  _bme280_calib.dig_P5 = readS16_LE(BME280_REGISTER_DIG_P5);
-  _bme280_calib.dig_P6 = readS16_LE(BME280_REGISTER_DIG_P6);
-  _bme280_calib.dig_P7 = readS16_LE(BME280_REGISTER_DIG_P7);
-  _bme280_calib.dig_P8 = readS16_LE(BME280_REGISTER_DIG_P8);
-  _bme280_calib.dig_P9 = readS16_LE(BME280_REGISTER_DIG_P9);
-
-  _bme280_calib.dig_H1 = read8(BME280_REGISTER_DIG_H1);
-  _bme280_calib.dig_H2 = readS16_LE(BME280_REGISTER_DIG_H2);
-  _bme280_calib.dig_H3 = read8(BME280_REGISTER_DIG_H3);
-  _bme280_calib.dig_H4 = ((int8_t)read8(BME280_REGISTER_DIG_H4) << 4) |
-                         (read8(BME280_REGISTER_DIG_H4 + 1) & 0xF);
-  _bme280_calib.dig_H5 = ((int8_t)read8(BME280_REGISTER_DIG_H5 + 1) << 4) |
-                         (read8(BME280_REGISTER_DIG_H5) >> 4);
-  _bme280_calib.dig_H6 = (int8_t)read8(BME280_REGISTER_DIG_H6);
+  uint8_t tp[26]; // 0x88 to 0xA1, dig_T1 to dig_H1
+  uint8_t h[7];   // 0xE1 to 0xE7, dig_H2 to dig_H6
+  readBurst(BME280_REGISTER_DIG_T1, tp, sizeof(tp));
+  readBurst(BME280_REGISTER_DIG_H2, h, sizeof(h));
+
+  _bme280_calib.dig_T1 = tp[0] | (uint16_t)tp[1] << 8;
+  _bme280_calib.dig_T2 = (int16_t)(tp[2] | (uint16_t)tp[3] << 8);
+  _bme280_calib.dig_T3 = (int16_t)(tp[4] | (uint16_t)tp[5] << 8);
+
+  _bme280_calib.dig_P1 = tp[6] | (uint16_t)tp[7] << 8;
+  _bme280_calib.dig_P2 = (int16_t)(tp[8] | (uint16_t)tp[9] << 8);
+  _bme280_calib.dig_P3 = (int16_t)(tp[10] | (uint16_t)tp[11] << 8);
+  _bme280_calib.dig_P4 = (int16_t)(tp[12] | (uint16_t)tp[13] << 8);
+  _bme280_calib.dig_P5 = (int16_t)(tp[14] | (uint16_t)tp[15] << 8);
+  _bme280_calib.dig_P6 = (int16_t)(tp[16] | (uint16_t)tp[17] << 8);
+  _bme280_calib.dig_P7 = (int16_t)(tp[18] | (uint16_t)tp[19] << 8);
+  _bme280_calib.dig_P8 = (int16_t)(tp[20] | (uint16_t)tp[21] << 8);
+  _bme280_calib.dig_P9 = (int16_t)(tp[22] | (uint16_t)tp[23] << 8);
+
+  _bme280_calib.dig_H1 = tp[25];
+  _bme280_calib.dig_H2 = (int16_t)(h[0] | (uint16_t)h[1] << 8);
+  _bme280_calib.dig_H3 = h[2];
+  _bme280_calib.dig_H4 = ((int8_t)h[3] << 4) | (h[4] & 0xF);
+  _bme280_calib.dig_H5 = ((int8_t)h[5] << 4) | (h[4] >> 4);
+  _bme280_calib.dig_H6 = (int8_t)h[6];
 }
 
 /*!
@@ -335,17 +385,14 @@ bool Adafruit_BME280::isReadingCalibration(void) {
 }
 
 /*!
- *   @brief  Returns the temperature from the sensor
- *   @returns the temperature read from the device
+ *   @brief  Temperature compensation from the datasheet (section 4.2.3), also
+ *   updates t_fine for the pressure and humidity compensation
+ *   @param adc_T the 20 bit raw temperature
+ *   @returns the temperature in 0.01 degrees Celsius
  */
-float Adafruit_BME280::readTemperature(void) {
+int32_t Adafruit_BME280::compensateTemperature(int32_t adc_T) {
   int32_t var1, var2;
 
-  int32_t adc_T = read24(BME280_REGISTER_TEMPDATA);
-  if (adc_T == 0x800000) // value in case temp measurement was disabled
-    return NAN;
-  adc_T >>= 4;
-
   var1 = (int32_t)((adc_T / 8) - ((int32_t)_bme280_calib.dig_T1 * 2));
   var1 = (var1 * ((int32_t)_bme280_calib.dig_T2)) / 2048;
   var2 = (int32_t)((adc_T / 16) - ((int32_t)_bme280_calib.dig_T1));
@@ -353,25 +400,18 @@ float Adafruit_BME280::readTemperature(void) {
 
   t_fine = var1 + var2 + t_fine_adjust;
 
-  int32_t T = (t_fine * 5 + 128) / 256;
-
-  return (float)T / 100;
+  return (t_fine * 5 + 128) / 256;
 }
 
 /*!
- *   @brief  Returns the pressure from the sensor
- *   @returns the pressure value (in Pascal) read from the device
+ *   @brief  Pressure compensation from the datasheet (section 4.2.3), needs
+ *   t_fine from compensateTemperature()
+ *   @param adc_P the 20 bit raw pressure
+ *   @returns the pressure in 1/256 Pascal
  */
-float Adafruit_BME280::readPressure(void) {
+int64_t Adafruit_BME280::compensatePressure(int32_t adc_P) {
   int64_t var1, var2, var3, var4;
 
-  readTemperature(); // must be done first to get t_fine
-
-  int32_t adc_P = read24(BME280_REGISTER_PRESSUREDATA);
-  if (adc_P == 0x800000) // value in case pressure measurement was disabled
-    return NAN;
-  adc_P >>= 4;
-
   var1 = ((int64_t)t_fine) - 128000;
   var2 = var1 * var1 * (int64_t)_bme280_calib.dig_P6;
   var2 = var2 + ((var1 * (int64_t)_bme280_calib.dig_P5) * 131072);
@@ -392,24 +432,18 @@ float Adafruit_BME280::readPressure(void) {
   var2 = (((int64_t)_bme280_calib.dig_P8) * var4) / 524288;
   var4 = ((var4 + var1 + var2) / 256) + (((int64_t)_bme280_calib.dig_P7) * 16);
 
-  float P = var4 / 256.0;
-
-  return P;
+  return var4;
 }
 
 /*!
- *  @brief  Returns the humidity from the sensor
- *  @returns the humidity value read from the device
+ *   @brief  Humidity compensation from the datasheet (section 4.2.3), needs
+ *   t_fine from compensateTemperature()
+ *   @param adc_H the 16 bit raw humidity
+ *   @returns the relative humidity in 1/1024 %
  */
-float Adafruit_BME280::readHumidity(void) {
+uint32_t Adafruit_BME280::compensateHumidity(int32_t adc_H) {
   int32_t var1, var2, var3, var4, var5;
 
-  readTemperature(); // must be done first to get t_fine
-
-  int32_t adc_H = read16(BME280_REGISTER_HUMIDDATA);
-  if (adc_H == 0x8000) // value in case humidity measurement was disabled
-    return NAN;
-
   var1 = t_fine - ((int32_t)76800);
   var2 = (int32_t)(adc_H * 16384);
   var3 = (int32_t)(((int32_t)_bme280_calib.dig_H4) * 1048576);
@@ -424,9 +458,88 @@ float Adafruit_BME280::readHumidity(void) {
   var5 = var3 - ((var4 * ((int32_t)_bme280_calib.dig_H1)) / 16);
   var5 = (var5 < 0 ? 0 : var5);
   var5 = (var5 > 419430400 ? 419430400 : var5);
-  uint32_t H = (uint32_t)(var5 / 4096);
+  return (uint32_t)(var5 / 4096);
+}
+
+/*!
+ *   @brief  Returns the temperature from the sensor
+ *   @returns the temperature read from the device
+ */
+float Adafruit_BME280::readTemperature(void) {
+  int32_t adc_T = read24(BME280_REGISTER_TEMPDATA);
+  if (adc_T == 0x800000) // value in case temp measurement was disabled
+    return NAN;
 
-  return (float)H / 1024.0;
+  return (float)compensateTemperature(adc_T >> 4) / 100;
+}
+
+/*!
+ *   @brief  Returns the pressure from the sensor
+ *   @returns the pressure value (in Pascal) read from the device
+ */
+float Adafruit_BME280::readPressure(void) {
+  readTemperature(); // must be done first to get t_fine
+
+  int32_t adc_P = read24(BME280_REGISTER_PRESSUREDATA);
+  if (adc_P == 0x800000) // value in case pressure measurement was disabled
+    return NAN;
+
+  return compensatePressure(adc_P >> 4) / 256.0;
+}
+
+/*!
+ *  @brief  Returns the humidity from the sensor
+ *  @returns the humidity value read from the device
+ */
+float Adafruit_BME280::readHumidity(void) {
+  readTemperature(); // must be done first to get t_fine
+
+  int32_t adc_H = read16(BME280_REGISTER_HUMIDDATA);
+  if (adc_H == 0x8000) // value in case humidity measurement was disabled
+    return NAN;
+
+  return (float)compensateHumidity(adc_H) / 1024.0;
+}
+
+/*!
+ *  @brief  Reads temperature, pressure and humidity in one transaction and
+ *  compensates each once, instead of the five transactions and three
+ *  temperature compensations of the separate read functions
+ *  @param  temperature where to put the temperature in degrees Celsius, or
+ *  NULL
+ *  @param  pressure where to put the pressure in Pascal, or NULL
+ *  @param  humidity where to put the relative humidity in %, or NULL
+ *  @returns true if the data could be read; disabled measurements read NAN
+ */
+bool Adafruit_BME280::readAll(float *temperature, float *pressure,
+                              float *humidity) {
+  uint8_t buffer[8]; // 0xF7 to 0xFE: pressure, temperature, humidity
+  if (!readBurst(BME280_REGISTER_PRESSUREDATA, buffer, sizeof(buffer))) {
+    return false;
+  }
+  int32_t adc_P = uint32_t(buffer[0]) << 16 | uint32_t(buffer[1]) << 8 |
+                  uint32_t(buffer[2]);
+  int32_t adc_T = uint32_t(buffer[3]) << 16 | uint32_t(buffer[4]) << 8 |
+                  uint32_t(buffer[5]);
+  int32_t adc_H = uint16_t(buffer[6]) << 8 | uint16_t(buffer[7]);
+
+  // Pressure and humidity use t_fine, as the separate read functions do
+  float T = NAN;
+  if (adc_T != 0x800000) {
+    T = (float)compensateTemperature(adc_T >> 4) / 100;
+  }
+  if (temperature) {
+    *temperature = T;
+  }
+  if (pressure) {
+    *pressure =
+        (adc_P == 0x800000) ? NAN : compensatePressure(adc_P >> 4) / 256.0;
+  }
+  if (humidity) {
+    *humidity =
+        (adc_H == 0x8000) ? NAN : (float)compensateHumidity(adc_H) / 1024.0;
+  }
+  return true;
 }
 
 /*!
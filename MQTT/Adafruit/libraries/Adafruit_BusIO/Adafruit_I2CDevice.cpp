@@ -11,6 +11,10 @@ Adafruit_I2CDevice::Adafruit_I2CDevice(uint8_t addr, TwoWire *theWire) {
   _addr = addr;
   _wire = theWire;
   _begun = false;
+  _bus = nullptr;
+  _priority = I2CBUS_PRIORITY_DEFAULT;
+  _timeout = I2CBUS_NO_TIMEOUT;
+  _autoIncrement = false;
 #ifdef ARDUINO_ARCH_SAMD
   _maxBufferSize = 250; // as defined in Wire.h's RingBuffer
 #elif defined(ESP32)
@@ -66,12 +70,17 @@ bool Adafruit_I2CDevice::detected(void) {
   }
 
   // A basic scanner, see if it ACK's
+  if (!_lock()) {
+    return false;
+  }
   _wire->beginTransmission(_addr);
 #ifdef DEBUG_SERIAL
   DEBUG_SERIAL.print(F("Address 0x"));
   DEBUG_SERIAL.print(_addr);
 #endif
-  if (_wire->endTransmission() == 0) {
+  uint8_t status = _wire->endTransmission();
+  _unlock();
+  if (status == 0) {
 #ifdef DEBUG_SERIAL
     DEBUG_SERIAL.println(F(" Detected"));
 #endif
@@ -99,6 +108,17 @@ bool Adafruit_I2CDevice::detected(void) {
 bool Adafruit_I2CDevice::write(const uint8_t *buffer, size_t len, bool stop,
                                const uint8_t *prefix_buffer,
                                size_t prefix_len) {
+  if (!_lock()) {
+    return false;
+  }
+  bool ok = _write(buffer, len, stop, prefix_buffer, prefix_len);
+  _unlock();
+  return ok;
+}
+
+bool Adafruit_I2CDevice::_write(const uint8_t *buffer, size_t len, bool stop,
+                                const uint8_t *prefix_buffer,
+                                size_t prefix_len) {
   if ((len + prefix_len) > maxBufferSize()) {
     // currently not guaranteed to work if more than 32 bytes!
     // we will need to find out if some platforms have larger
@@ -155,6 +175,9 @@ bool Adafruit_I2CDevice::write(const uint8_t *buffer, size_t len, bool stop,
   }
 #endif
 
+  if (_bus) {
+    _bus->_transactions++;
+  }
   if (_wire->endTransmission(stop) == 0) {
 #ifdef DEBUG_SERIAL
     DEBUG_SERIAL.println();
@@ -178,6 +201,15 @@ bool Adafruit_I2CDevice::write(const uint8_t *buffer, size_t len, bool stop,
  *    @return True if read was successful, otherwise false.
  */
 bool Adafruit_I2CDevice::read(uint8_t *buffer, size_t len, bool stop) {
+  if (!_lock()) {
+    return false;
+  }
+  bool ok = _readAll(buffer, len, stop);
+  _unlock();
+  return ok;
+}
+
+bool Adafruit_I2CDevice::_readAll(uint8_t *buffer, size_t len, bool stop) {
   size_t pos = 0;
   while (pos < len) {
     size_t read_len =
@@ -191,6 +223,9 @@ bool Adafruit_I2CDevice::read(uint8_t *buffer, size_t len, bool stop) {
 }
 
 bool Adafruit_I2CDevice::_read(uint8_t *buffer, size_t len, bool stop) {
+  if (_bus) {
+    _bus->_transactions++;
+  }
 #if defined(TinyWireM_h)
   size_t recv = _wire->requestFrom((uint8_t)_addr, (uint8_t)len);
 #elif defined(ARDUINO_ARCH_MEGAAVR)
@@ -244,11 +279,14 @@ bool Adafruit_I2CDevice::_read(uint8_t *buffer, size_t len, bool stop) {
 bool Adafruit_I2CDevice::write_then_read(const uint8_t *write_buffer,
                                          size_t write_len, uint8_t *read_buffer,
                                          size_t read_len, bool stop) {
-  if (!write(write_buffer, write_len, stop)) {
+  // One bus ownership for both, so no other task can slip in between
+  if (!_lock()) {
     return false;
   }
-
-  return read(read_buffer, read_len);
+  bool ok = _write(write_buffer, write_len, stop) &&
+            _readAll(read_buffer, read_len, true);
+  _unlock();
+  return ok;
 }
 
 /*!
@@ -307,7 +345,11 @@ bool Adafruit_I2CDevice::setSpeed(uint32_t desiredclk) {
   return true;
 #elif (ARDUINO >= 157) && !defined(ARDUINO_STM32_FEATHER) &&                   \
     !defined(TinyWireM_h)
+  if (!_lock()) {
+    return false;
+  }
   _wire->setClock(desiredclk);
+  _unlock();
   return true;
 
 #else
@@ -315,3 +357,37 @@ bool Adafruit_I2CDevice::setSpeed(uint32_t desiredclk) {
   return false;
 #endif
 }
+
+/*!
+ *    @brief  Set how this device's calls compete for a shared bus
+ *    @param  priority Higher values get the bus first, see
+ *            Adafruit_I2CBus::acquire(). Default I2CBUS_PRIORITY_DEFAULT.
+ *    @param  timeout_ms How long a call may wait for the bus before it
+ *            fails, I2CBUS_NO_TIMEOUT (the default) to wait as long as needed
+ */
+void Adafruit_I2CDevice::setBusPriority(uint8_t priority,
+                                        uint32_t timeout_ms) {
+  _priority = priority;
+  _timeout = timeout_ms;
+}
+
+/*!
+ *    @brief  The manager arbitrating this device's TwoWire
+ *    @return The manager, or nullptr if none could be created
+ */
+Adafruit_I2CBus *Adafruit_I2CDevice::bus(void) {
+  if (!_bus) {
+    _bus = Adafruit_I2CBus::get(_wire);
+  }
+  return _bus;
+}
+
+bool Adafruit_I2CDevice::_lock(void) {
+  return !bus() || _bus->acquire(_priority, _timeout);
+}
+
+void Adafruit_I2CDevice::_unlock(void) {
+  if (_bus) {
+    _bus->release();
+  }
+}
@@ -1,6 +1,7 @@
 #ifndef Adafruit_I2CDevice_h
 #define Adafruit_I2CDevice_h
 
+#include <Adafruit_I2CBus.h>
 #include <Arduino.h>
 #include <Wire.h>
 
@@ -21,15 +22,34 @@ public:
                        bool stop = false);
   bool setSpeed(uint32_t desiredclk);
 
+  void setBusPriority(uint8_t priority,
+                      uint32_t timeout_ms = I2CBUS_NO_TIMEOUT);
+  /*!   @brief  Declare that the device's register address advances after
+   *    each byte read, so Adafruit_I2CBus::run() may merge reads
+   *    @param  enable True if consecutive registers can be burst-read */
+  void setAutoIncrement(bool enable) { _autoIncrement = enable; }
+  Adafruit_I2CBus *bus(void);
+
   /*!   @brief  How many bytes we can read in a transaction
    *    @return The size of the Wire receive/transmit buffer */
   size_t maxBufferSize() { return _maxBufferSize; }
 
 private:
+  friend class Adafruit_I2CBus;
+
   uint8_t _addr;
   TwoWire *_wire;
   bool _begun;
   size_t _maxBufferSize;
+  Adafruit_I2CBus *_bus;
+  uint8_t _priority;
+  uint32_t _timeout;
+  bool _autoIncrement;
+  bool _lock(void);
+  void _unlock(void);
+  bool _write(const uint8_t *buffer, size_t len, bool stop,
+              const uint8_t *prefix_buffer = nullptr, size_t prefix_len = 0);
+  bool _readAll(uint8_t *buffer, size_t len, bool stop);
   bool _read(uint8_t *buffer, size_t len, bool stop);
 };
 
@@ -0,0 +1,111 @@
+#ifndef _HOST_WIRE_H
+#define _HOST_WIRE_H
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <map>
+#include <vector>
+
+#define I2C_BUFFER_LENGTH 128
+
+/// TwoWire with register-file devices that auto-increment, as most sensors
+/// do. Transfers take their 400 kHz bus time, spinning. Counts two threads
+/// using the bus at once, and a transaction slipping in between a write
+/// without STOP and its repeated start.
+class TwoWire {
+public:
+  struct Device {
+    uint8_t regs[256];
+    uint8_t pointer = 0;
+  };
+  std::map<uint8_t, Device> devices;
+  std::atomic<uint64_t> busNanos{0};
+  std::atomic<unsigned long> transactions{0}, collisions{0}, stolenRestarts{0};
+  uint32_t bitNanos = 2500; ///< 400 kHz
+
+  void begin(void) {}
+  void end(void) {}
+  void setClock(uint32_t hz) { bitNanos = 1000000000u / hz; }
+
+  void beginTransmission(uint8_t address) {
+    enter();
+    addr = address;
+    tx.clear();
+  }
+  size_t write(uint8_t b) {
+    tx.push_back(b);
+    return 1;
+  }
+  size_t write(const uint8_t *b, size_t n) {
+    tx.insert(tx.end(), b, b + n);
+    return n;
+  }
+  uint8_t endTransmission(bool stop = true) {
+    transactions++;
+    spend(tx.size());
+    uint8_t rv = 2; // NACK on the address
+    auto it = devices.find(addr);
+    if (it != devices.end()) {
+      rv = 0;
+      Device &d = it->second;
+      if (!tx.empty()) {
+        d.pointer = tx[0];
+        for (size_t i = 1; i < tx.size(); i++)
+          d.regs[d.pointer++] = tx[i];
+      }
+    }
+    heldBy = stop ? nullptr : self();
+    leave();
+    return rv;
+  }
+  uint8_t requestFrom(uint8_t address, uint8_t n, uint8_t stop = 1) {
+    (void)stop;
+    enter();
+    if (heldBy.load() == self())
+      heldBy = nullptr;
+    transactions++;
+    spend(n);
+    rx.clear();
+    rxPos = 0;
+    auto it = devices.find(address);
+    if (it != devices.end())
+      for (uint8_t i = 0; i < n; i++)
+        rx.push_back(it->second.regs[it->second.pointer++]);
+    leave();
+    return rx.size();
+  }
+  int read(void) { return rxPos < rx.size() ? rx[rxPos++] : -1; }
+
+private:
+  std::atomic<int> active{0};
+  std::atomic<const void *> heldBy{nullptr}; ///< Thread that skipped a STOP
+  uint8_t addr = 0;
+  std::vector<uint8_t> tx, rx;
+  size_t rxPos = 0;
+
+  static const void *self(void) {
+    static thread_local int x;
+    return &x;
+  }
+  void enter(void) {
+    if (active.fetch_add(1))
+      collisions++;
+    const void *h = heldBy.load();
+    if (h && h != self())
+      stolenRestarts++;
+  }
+  void leave(void) { active.fetch_sub(1); }
+  /// Start, address, bytes and stop, 9 bits each
+  void spend(size_t bytes) {
+    uint64_t ns = (uint64_t)(bytes + 1) * 9 * bitNanos + 2 * bitNanos;
+    busNanos += ns;
+    auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(ns);
+    while (std::chrono::steady_clock::now() < until)
+      ;
+  }
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef _HOST_FREERTOS_H
+#define _HOST_FREERTOS_H
+
+// Host stand-in for the parts of FreeRTOS that Adafruit_I2CBus uses, one
+// std::thread per task, 1 ms ticks
+
+#include <stdint.h>
+
+#include <atomic>
+#include <thread>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+struct portMUX_TYPE {
+  std::atomic<bool> locked{false};
+};
+#define portMUX_INITIALIZER_UNLOCKED                                           \
+  {}
+inline void portENTER_CRITICAL(portMUX_TYPE *m) {
+  while (m->locked.exchange(true, std::memory_order_acquire))
+    std::this_thread::yield();
+}
+inline void portEXIT_CRITICAL(portMUX_TYPE *m) {
+  m->locked.store(false, std::memory_order_release);
+}
+
+#endif
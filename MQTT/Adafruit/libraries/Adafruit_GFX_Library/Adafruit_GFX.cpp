@@ -99,6 +99,38 @@ inline uint8_t *pgm_read_bitmap_ptr(const GFXfont *gfxFont) {
   }
 #endif
 
+// Reads packed glyph bitmaps (see fontconvert/gfxpack.h) 4 bits at a time
+struct GFXnibbleReader {
+  const uint8_t *p; ///< Next byte to fetch from flash
+  uint8_t byte;     ///< Last byte fetched
+  bool low;         ///< Low half of byte is still unread
+
+  uint8_t peek() { return low ? (byte & 0x0F) : (pgm_read_byte(p) >> 4); }
+  uint8_t next() {
+    if (low) {
+      low = false;
+      return byte & 0x0F;
+    }
+    byte = pgm_read_byte(p++);
+    low = true;
+    return byte >> 4;
+  }
+  // Run length code of the 1 bpp RLE format, 0 to 28
+  uint8_t run() {
+    uint8_t c = next();
+    return (c == 13) ? 13 + next() : c;
+  }
+};
+
+// Mixes two 5-6-5 colors, alpha is the share of fg on a 0-15 scale
+static uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F, // 00GGG..RRR..BBB
+      b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+  uint8_t a = (alpha * 17) >> 3; // 0-15 to 0-31
+  uint32_t m = ((f * a + b * (32 - a)) >> 5) & 0x07E0F81F;
+  return (uint16_t)(m | (m >> 16));
+}
+
 /**************************************************************************/
 /*!
    @brief    Instatiate a GFX context for graphics! Can only be done by a
@@ -117,6 +149,7 @@ Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
   wrap = true;
   _cp437 = false;
   gfxFont = NULL;
+  gfxFontFormat = GFX_FONT_1BPP;
 }
 
 /**************************************************************************/
@@ -1146,30 +1179,18 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     if (!_cp437 && (c >= 176))
       c++; // Handle 'classic' charset behavior
 
-    startWrite();
+    // The font is stored column by column, transpose it into 8 rows of
+    // 6 pixels (5 glyph columns + 1 blank spacing column), MSB first
+    uint8_t rows[8] = {0};
     for (int8_t i = 0; i < 5; i++) { // Char bitmap = 5 columns
       uint8_t line = pgm_read_byte(&font[c * 5 + i]);
-      for (int8_t j = 0; j < 8; j++, line >>= 1) {
-        if (line & 1) {
-          if (size_x == 1 && size_y == 1)
-            writePixel(x + i, y + j, color);
-          else
-            writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y,
-                          color);
-        } else if (bg != color) {
-          if (size_x == 1 && size_y == 1)
-            writePixel(x + i, y + j, bg);
-          else
-            writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, bg);
-        }
+      for (int8_t j = 0; line; j++, line >>= 1) {
+        if (line & 1)
+          rows[j] |= 0x80 >> i;
       }
     }
-    if (bg != color) { // If opaque, draw vertical line for last column
-      if (size_x == 1 && size_y == 1)
-        writeFastVLine(x + 5, y, 8, bg);
-      else
-        writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
-    }
+    startWrite();
+    writeCharRows(x, y, rows, color, bg, size_x, size_y);
     endWrite();
 
   } else { // Custom font
@@ -1186,13 +1207,8 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
     int8_t xo = pgm_read_byte(&glyph->xOffset),
            yo = pgm_read_byte(&glyph->yOffset);
+    uint8_t format = gfxFontFormat;
     uint8_t xx, yy, bits = 0, bit = 0;
-    int16_t xo16 = 0, yo16 = 0;
-
-    if (size_x > 1 || size_y > 1) {
-      xo16 = xo;
-      yo16 = yo;
-    }
 
     // Todo: Add character clipping here
 
@@ -1212,27 +1228,199 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // displays supporting setAddrWindow() and pushColors()), but haven't
     // implemented this yet.
 
+    // Each row of the glyph is drawn as horizontal runs of set pixels
+    int16_t gx = x + xo * size_x, gy = y + yo * size_y;
     startWrite();
-    for (yy = 0; yy < h; yy++) {
-      for (xx = 0; xx < w; xx++) {
-        if (!(bit++ & 7)) {
-          bits = pgm_read_byte(&bitmap[bo++]);
-        }
-        if (bits & 0x80) {
-          if (size_x == 1 && size_y == 1) {
-            writePixel(x + xo + xx, y + yo + yy, color);
-          } else {
-            writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y,
-                          size_x, size_y, color);
+    if (format) { // Run-length encoded or anti-aliased
+      drawPackedGlyph(gx, gy, &bitmap[bo], w, h, format, color, bg, size_x,
+                      size_y);
+    } else {
+      for (yy = 0; yy < h; yy++) {
+        int16_t run = -1; // Start of the current run of set pixels, if any
+        for (xx = 0; xx < w; xx++) {
+          if (!(bit++ & 7)) {
+            bits = pgm_read_byte(&bitmap[bo++]);
+          }
+          if (bits & 0x80) {
+            if (run < 0)
+              run = xx;
+          } else if (run >= 0) {
+            writeTextRun(gx + run * size_x, gy + yy * size_y, xx - run, color,
+                         size_x, size_y);
+            run = -1;
           }
+          bits <<= 1;
         }
-        bits <<= 1;
+        if (run >= 0)
+          writeTextRun(gx + run * size_x, gy + yy * size_y, w - run, color,
+                       size_x, size_y);
       }
     }
     endWrite();
 
   } // End classic vs custom font
 }
+/**************************************************************************/
+/*!
+   @brief   Draw a custom font glyph stored in one of the packed formats,
+            run-length encoded and/or anti-aliased (see
+            fontconvert/gfxpack.h). The glyph is decoded straight from
+            flash as runs, with no buffer; a row repeated in the font is
+            drawn once as a taller run. Partially covered pixels of
+            anti-aliased fonts are mixed with bg when it differs from
+            color, otherwise the ones at least half covered are drawn in
+            color, as there is nothing known to blend with.
+    @param    x   Top left corner x coordinate of the glyph bitmap
+    @param    y   Top left corner y coordinate of the glyph bitmap
+    @param    data  Packed glyph bitmap, in flash
+    @param    w   Glyph width in font pixels
+    @param    h   Glyph height in font pixels
+    @param    format  GFX_FONT_* flags of the font
+    @param    color 16-bit 5-6-5 Color to draw the glyph with
+    @param    bg 16-bit 5-6-5 Color to blend partial coverage with (if same
+   as color, no blending)
+    @param    size_x  Font magnification level in X-axis, 1 is 'original' size
+    @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawPackedGlyph(int16_t x, int16_t y, const uint8_t *data,
+                                   uint8_t w, uint8_t h, uint8_t format,
+                                   uint16_t color, uint16_t bg, uint8_t size_x,
+                                   uint8_t size_y) {
+  GFXnibbleReader in = {data, 0, false};
+  uint8_t depth = format & GFX_FONT_BPP_MASK, rem = 0, xx, yy;
+  bool rle = format & GFX_FONT_RLE;
+
+  if (depth == GFX_FONT_1BPP) { // Runs of clear and set pixels
+    bool set = true;
+    for (yy = 0; yy < h;) {
+      uint8_t rep = 0; // Copies of this row that follow it
+      if (!rem && (in.peek() >= 14))
+        rep = (in.next() == 15) ? 1 : in.run();
+      int16_t rows = (int16_t)(rep + 1) * size_y;
+      for (xx = 0; xx < w;) {
+        while (!rem) {
+          rem = in.run();
+          set = !set;
+        }
+        uint8_t len = min(rem, (uint8_t)(w - xx));
+        if (set) {
+          if (rows == 1)
+            writeTextRun(x + xx * size_x, y + yy * size_y, len, color,
+                         size_x, 1);
+          else
+            writeFillRect(x + xx * size_x, y + yy * size_y, len * size_x,
+                          rows, color);
+        }
+        xx += len;
+        rem -= len;
+      }
+      yy += rep + 1;
+    }
+    return;
+  }
+
+  // Anti-aliased: pixels of equal coverage within a row become one run
+  bool mix = (bg != color);
+  uint8_t alpha = 0, pair = 0xFF; // Coverage, second pixel of a 2 bpp code
+  for (yy = 0; yy < h; yy++) {
+    uint8_t start = 0, runAlpha = 0;
+    for (xx = 0; xx <= w; xx++) {
+      if (xx < w) {
+        if (!rem) {
+          rem = 1;
+          if (pair != 0xFF) {
+            alpha = pair;
+            pair = 0xFF;
+          } else {
+            alpha = in.next();
+            if (rle && ((alpha == 0) || (alpha == 15))) {
+              rem = in.next() + 1;
+            } else if (depth == GFX_FONT_2BPP) {
+              pair = (alpha & 3) * 5;
+              alpha = (alpha >> 2) * 5;
+            }
+          }
+        }
+        rem--;
+        if (alpha == runAlpha)
+          continue;
+      }
+      if (runAlpha && (mix || (runAlpha >= 8))) // Run ended, draw it
+        writeTextRun(x + start * size_x, y + yy * size_y, xx - start,
+                     (runAlpha == 15 || !mix)
+                         ? color
+                         : blend565(color, bg, runAlpha),
+                     size_x, size_y);
+      start = xx;
+      runAlpha = alpha;
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Draw one 'classic' font character from its rows. drawChar() calls
+            this inside a transaction, subclasses may override it to blit
+            whole rows into a framebuffer or to stream the character in a
+            single address window, and call this version for anything they
+            do not handle. The generic version draws horizontal runs of equal
+            color, so a character takes a handful of calls instead of one per
+            pixel.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    rows  8 rows of 6 pixels, MSB is the leftmost pixel
+    @param    color 16-bit 5-6-5 Color to draw chraracter with
+    @param    bg 16-bit 5-6-5 Color to fill background with (if same as color,
+   no background)
+    @param    size_x  Font magnification level in X-axis, 1 is 'original' size
+    @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeCharRows(int16_t x, int16_t y, const uint8_t *rows,
+                                 uint16_t color, uint16_t bg, uint8_t size_x,
+                                 uint8_t size_y) {
+  for (int8_t j = 0; j < 8; j++) {
+    uint8_t line = rows[j];
+    int8_t i = 0;
+    while (i < 6) {
+      int8_t start = i;
+      bool set = line & 0x80;
+      do {
+        line <<= 1;
+        i++;
+      } while ((i < 6) && ((bool)(line & 0x80) == set));
+      if (set || (bg != color))
+        writeTextRun(x + start * size_x, y + j * size_y, i - start,
+                     set ? color : bg, size_x, size_y);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief   Draw a horizontal run of text pixels, magnified as needed
+    @param    x   Left x coordinate
+    @param    y   Top y coordinate
+    @param    len   Length of the run in font pixels
+    @param    color 16-bit 5-6-5 Color to draw the run with
+    @param    size_x  Font magnification level in X-axis, 1 is 'original' size
+    @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeTextRun(int16_t x, int16_t y, int16_t len,
+                                uint16_t color, uint8_t size_x,
+                                uint8_t size_y) {
+  if (size_x == 1 && size_y == 1) {
+    if (len == 1)
+      writePixel(x, y, color);
+    else
+      writeFastHLine(x, y, len, color);
+  } else {
+    writeFillRect(x, y, len * size_x, size_y, color);
+  }
+}
+
 /**************************************************************************/
 /*!
     @brief  Print one byte/character of data, used to support print()
@@ -1348,6 +1536,20 @@ void Adafruit_GFX::setFont(const GFXfont *f) {
     cursor_y -= 6;
   }
   gfxFont = (GFXfont *)f;
+  gfxFontFormat = GFX_FONT_1BPP;
+}
+
+/**************************************************************************/
+/*!
+    @brief Set a run-length encoded or anti-aliased font to display when
+           print()ing
+    @param  f  The GFXpackedFont object, if NULL use built in 6x8 font
+*/
+/**************************************************************************/
+void Adafruit_GFX::setPackedFont(const GFXpackedFont *f) {
+  setFont(f ? &f->font : NULL);
+  if (f)
+    gfxFontFormat = pgm_read_byte(&f->format);
 }
 
 /**************************************************************************/
@@ -1728,6 +1930,140 @@ bool Adafruit_GFX_Button::justReleased() { return (!currstate && laststate); }
 
 // -------------------------------------------------------------------------
 
+// GFXdirtyTiles splits a framebuffer into 8x8 pixel tiles and keeps one bit
+// per tile. On page-based monochrome OLEDs a row of tiles is exactly one
+// display page, so a run of adjacent dirty tiles maps onto a single
+// page/column address command followed by one data transfer.
+
+/**************************************************************************/
+/*!
+   @brief    Instatiate an empty dirty tile bitmap, call begin() before use
+*/
+/**************************************************************************/
+GFXdirtyTiles::GFXdirtyTiles(void) : bits(NULL), _cols(0), _rows(0) {}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the dirty tile bitmap, free memory
+*/
+/**************************************************************************/
+GFXdirtyTiles::~GFXdirtyTiles(void) { end(); }
+
+/**************************************************************************/
+/*!
+   @brief    Allocate the bitmap for a framebuffer, with all tiles dirty
+   @param    w   Framebuffer width in pixels, without rotation
+   @param    h   Framebuffer height in pixels, without rotation
+   @returns  True on success, false if the allocation failed
+*/
+/**************************************************************************/
+bool GFXdirtyTiles::begin(uint16_t w, uint16_t h) {
+  end();
+  _cols = (w + 7) / 8;
+  _rows = (h + 7) / 8;
+  if (!(bits = (uint8_t *)malloc(((uint32_t)_cols * _rows + 7) / 8))) {
+    _cols = _rows = 0;
+    return false;
+  }
+  markAll();
+  return true;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Free the bitmap and stop tracking changes
+*/
+/**************************************************************************/
+void GFXdirtyTiles::end(void) {
+  if (bits) {
+    free(bits);
+    bits = NULL;
+  }
+  _cols = _rows = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Mark all tiles touched by a rectangle as dirty
+   @param    x   Raw top left x coordinate
+   @param    y   Raw top left y coordinate
+   @param    w   Width in pixels
+   @param    h   Height in pixels
+*/
+/**************************************************************************/
+void GFXdirtyTiles::mark(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (!bits || (w <= 0) || (h <= 0))
+    return;
+  int16_t x2 = x + w - 1, y2 = y + h - 1;
+  if ((x2 < 0) || (y2 < 0))
+    return;
+  uint16_t col1 = x < 0 ? 0 : x / 8, row1 = y < 0 ? 0 : y / 8;
+  uint16_t col2 = min((uint16_t)(x2 / 8), (uint16_t)(_cols - 1));
+  uint16_t row2 = min((uint16_t)(y2 / 8), (uint16_t)(_rows - 1));
+  for (uint16_t row = row1; row <= row2; row++) {
+    uint16_t i = row * _cols + col1;
+    for (uint16_t col = col1; col <= col2; col++, i++)
+      bits[i >> 3] |= 1 << (i & 7);
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Mark every tile as dirty, e.g. after a full screen fill
+*/
+/**************************************************************************/
+void GFXdirtyTiles::markAll(void) {
+  if (bits)
+    memset(bits, 0xFF, ((uint32_t)_cols * _rows + 7) / 8);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Mark every tile as clean, typically after a flush
+*/
+/**************************************************************************/
+void GFXdirtyTiles::clear(void) {
+  if (bits)
+    memset(bits, 0, ((uint32_t)_cols * _rows + 7) / 8);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Query whether a tile changed since the bitmap was last cleared
+   @param    col   Tile column (raw x / 8)
+   @param    row   Tile row (raw y / 8)
+   @returns  True if the tile is dirty
+*/
+/**************************************************************************/
+bool GFXdirtyTiles::isDirty(uint16_t col, uint16_t row) const {
+  if (!bits || (col >= _cols) || (row >= _rows))
+    return false;
+  uint16_t i = row * _cols + col;
+  return (bits[i >> 3] >> (i & 7)) & 1;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Find the next run of adjacent dirty tiles in a tile row. Call
+             repeatedly, advancing col past each run, to visit all of them.
+   @param    row   Tile row to search
+   @param    col   In: first tile column to look at. Out: first tile of the
+                   run that was found.
+   @returns  Number of tiles in the run, 0 if the rest of the row is clean
+*/
+/**************************************************************************/
+uint16_t GFXdirtyTiles::nextRun(uint16_t row, uint16_t *col) const {
+  uint16_t c = *col;
+  while ((c < _cols) && !isDirty(c, row))
+    c++;
+  *col = c;
+  while ((c < _cols) && isDirty(c, row))
+    c++;
+  return c - *col;
+}
+
+// -------------------------------------------------------------------------
+
 // GFXcanvas1, GFXcanvas8 and GFXcanvas16 (currently a WIP, don't get too
 // comfy with the implementation) provide 1-, 8- and 16-bit offscreen
 // canvases, the address of which can be passed to drawBitmap() or
@@ -1777,6 +2113,24 @@ GFXcanvas1::~GFXcanvas1(void) {
     free(buffer);
 }
 
+/**************************************************************************/
+/*!
+   @brief    Enable or disable tracking of the 8x8 pixel tiles that change,
+             so that only those need to be copied to a display, see
+             getDirtyTiles(). Costs one bit of RAM per tile.
+   @param    enable  True to allocate the bitmap (all tiles start dirty),
+                     false to free it
+   @returns  True on success, false if the allocation failed
+*/
+/**************************************************************************/
+bool GFXcanvas1::setDirtyTracking(bool enable) {
+  if (!enable) {
+    dirty.end();
+    return true;
+  }
+  return dirty.begin(WIDTH, HEIGHT);
+}
+
 /**************************************************************************/
 /*!
     @brief  Draw a pixel to the canvas framebuffer
@@ -1808,6 +2162,7 @@ void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
       break;
     }
 
+    dirty.markPixel(x, y);
     uint8_t *ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
 #ifdef __AVR__
     if (color)
@@ -1887,6 +2242,7 @@ bool GFXcanvas1::getRawPixel(int16_t x, int16_t y) const {
 /**************************************************************************/
 void GFXcanvas1::fillScreen(uint16_t color) {
   if (buffer) {
+    dirty.markAll();
     uint32_t bytes = ((WIDTH + 7) / 8) * HEIGHT;
     memset(buffer, color ? 0xFF : 0x00, bytes);
   }
@@ -2015,6 +2371,7 @@ void GFXcanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w,
 void GFXcanvas1::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
                                   uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
+  dirty.mark(x, y, 1, h);
   int16_t row_bytes = ((WIDTH + 7) / 8);
   uint8_t *ptr = &buffer[(x / 8) + y * row_bytes];
 
@@ -2053,6 +2410,7 @@ void GFXcanvas1::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
 void GFXcanvas1::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
                                   uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
+  dirty.mark(x, y, w, 1);
   int16_t rowBytes = ((WIDTH + 7) / 8);
   uint8_t *ptr = &buffer[(x / 8) + y * rowBytes];
   size_t remainingWidthBits = w;
@@ -2106,6 +2464,45 @@ void GFXcanvas1::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
   }
 }
 
+/**************************************************************************/
+/*!
+   @brief    Draw one 'classic' font character by masking whole bytes of the
+             buffer, when it is unrotated, unscaled and entirely on the canvas.
+             Anything else goes through Adafruit_GFX::writeCharRows().
+   @param    x   Top left corner x coordinate
+   @param    y   Top left corner y coordinate
+   @param    rows  8 rows of 6 pixels, MSB is the leftmost pixel
+   @param    color   Binary (on or off) color of the character
+   @param    bg   Binary (on or off) background color, same as color for none
+   @param    size_x  Font magnification level in X-axis, 1 is 'original' size
+   @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
+*/
+/**************************************************************************/
+void GFXcanvas1::writeCharRows(int16_t x, int16_t y, const uint8_t *rows,
+                               uint16_t color, uint16_t bg, uint8_t size_x,
+                               uint8_t size_y) {
+  if (!buffer || rotation || (size_x != 1) || (size_y != 1) || (x < 0) ||
+      (y < 0) || (x + 6 > WIDTH) || (y + 8 > HEIGHT)) {
+    Adafruit_GFX::writeCharRows(x, y, rows, color, bg, size_x, size_y);
+    return;
+  }
+
+  dirty.mark(x, y, 6, 8);
+  int16_t rowBytes = ((WIDTH + 7) / 8);
+  uint8_t *ptr = &buffer[(x / 8) + y * rowBytes];
+  uint8_t shift = x & 7;
+  for (int8_t j = 0; j < 8; j++, ptr += rowBytes) {
+    // The 6 pixels straddle at most 2 bytes, build both masks at once
+    uint16_t fg = ((uint16_t)(rows[j] & 0xFC) << 8) >> shift;
+    uint16_t back = (bg != color) ? ((0xFC00 >> shift) & ~fg) : 0;
+    uint16_t set = (color ? fg : 0) | (bg ? back : 0);
+    uint16_t clr = (color ? 0 : fg) | (bg ? 0 : back);
+    ptr[0] = (ptr[0] & ~(clr >> 8)) | (set >> 8);
+    if (shift > 2)
+      ptr[1] = (ptr[1] & ~clr) | set;
+  }
+}
+
 /**************************************************************************/
 /*!
    @brief    Instatiate a GFX 8-bit canvas context for graphics
@@ -2130,6 +2527,24 @@ GFXcanvas8::~GFXcanvas8(void) {
     free(buffer);
 }
 
+/**************************************************************************/
+/*!
+   @brief    Enable or disable tracking of the 8x8 pixel tiles that change,
+             so that only those need to be copied to a display, see
+             getDirtyTiles(). Costs one bit of RAM per tile.
+   @param    enable  True to allocate the bitmap (all tiles start dirty),
+                     false to free it
+   @returns  True on success, false if the allocation failed
+*/
+/**************************************************************************/
+bool GFXcanvas8::setDirtyTracking(bool enable) {
+  if (!enable) {
+    dirty.end();
+    return true;
+  }
+  return dirty.begin(WIDTH, HEIGHT);
+}
+
 /**************************************************************************/
 /*!
     @brief  Draw a pixel to the canvas framebuffer
@@ -2161,6 +2576,7 @@ void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
       break;
     }
 
+    dirty.markPixel(x, y);
     buffer[x + y * WIDTH] = color;
   }
 }
@@ -2221,6 +2637,7 @@ uint8_t GFXcanvas8::getRawPixel(int16_t x, int16_t y) const {
 /**************************************************************************/
 void GFXcanvas8::fillScreen(uint16_t color) {
   if (buffer) {
+    dirty.markAll();
     memset(buffer, color, WIDTH * HEIGHT);
   }
 }
@@ -2351,6 +2768,7 @@ void GFXcanvas8::drawFastHLine(int16_t x, int16_t y, int16_t w,
 void GFXcanvas8::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
                                   uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
+  dirty.mark(x, y, 1, h);
   uint8_t *buffer_ptr = buffer + y * WIDTH + x;
   for (int16_t i = 0; i < h; i++) {
     (*buffer_ptr) = color;
@@ -2371,9 +2789,58 @@ void GFXcanvas8::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
 void GFXcanvas8::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
                                   uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
+  dirty.mark(x, y, w, 1);
   memset(buffer + y * WIDTH + x, color, w);
 }
 
+/**************************************************************************/
+/*!
+   @brief    Draw one 'classic' font character straight into the buffer, when
+             it is unrotated and entirely on the canvas. Anything else goes
+             through Adafruit_GFX::writeCharRows().
+   @param    x   Top left corner x coordinate
+   @param    y   Top left corner y coordinate
+   @param    rows  8 rows of 6 pixels, MSB is the leftmost pixel
+   @param    color   8-bit Color of the character
+   @param    bg   8-bit background color, same as color for none
+   @param    size_x  Font magnification level in X-axis, 1 is 'original' size
+   @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
+*/
+/**************************************************************************/
+void GFXcanvas8::writeCharRows(int16_t x, int16_t y, const uint8_t *rows,
+                               uint16_t color, uint16_t bg, uint8_t size_x,
+                               uint8_t size_y) {
+  int16_t w = 6 * size_x, h = 8 * size_y;
+  if (!buffer || rotation || (x < 0) || (y < 0) || (x + w > WIDTH) ||
+      (y + h > HEIGHT)) {
+    Adafruit_GFX::writeCharRows(x, y, rows, color, bg, size_x, size_y);
+    return;
+  }
+
+  dirty.mark(x, y, w, h);
+  uint8_t *ptr = &buffer[(uint32_t)y * WIDTH + x];
+  for (int8_t j = 0; j < 8; j++) {
+    for (uint8_t r = 0; r < size_y; r++, ptr += WIDTH) {
+      uint8_t *p = ptr;
+      uint8_t line = rows[j];
+      if (bg == color) { // Transparent, stop after the last set pixel
+        for (; line; line <<= 1, p += size_x) {
+          if (line & 0x80) {
+            for (uint8_t s = 0; s < size_x; s++)
+              p[s] = color;
+          }
+        }
+      } else {
+        for (int8_t i = 0; i < 6; i++, line <<= 1) {
+          uint8_t c = (line & 0x80) ? color : bg;
+          for (uint8_t s = 0; s < size_x; s++)
+            *p++ = c;
+        }
+      }
+    }
+  }
+}
+
 /**************************************************************************/
 /*!
    @brief    Instatiate a GFX 16-bit canvas context for graphics
@@ -2398,6 +2865,24 @@ GFXcanvas16::~GFXcanvas16(void) {
     free(buffer);
 }
 
+/**************************************************************************/
+/*!
+   @brief    Enable or disable tracking of the 8x8 pixel tiles that change,
+             so that only those need to be copied to a display, see
+             getDirtyTiles(). Costs one bit of RAM per tile.
+   @param    enable  True to allocate the bitmap (all tiles start dirty),
+                     false to free it
+   @returns  True on success, false if the allocation failed
+*/
+/**************************************************************************/
+bool GFXcanvas16::setDirtyTracking(bool enable) {
+  if (!enable) {
+    dirty.end();
+    return true;
+  }
+  return dirty.begin(WIDTH, HEIGHT);
+}
+
 /**************************************************************************/
 /*!
     @brief  Draw a pixel to the canvas framebuffer
@@ -2429,6 +2914,7 @@ void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
       break;
     }
 
+    dirty.markPixel(x, y);
     buffer[x + y * WIDTH] = color;
   }
 }
@@ -2489,6 +2975,7 @@ uint16_t GFXcanvas16::getRawPixel(int16_t x, int16_t y) const {
 /**************************************************************************/
 void GFXcanvas16::fillScreen(uint16_t color) {
   if (buffer) {
+    dirty.markAll();
     uint8_t hi = color >> 8, lo = color & 0xFF;
     if (hi == lo) {
       memset(buffer, lo, WIDTH * HEIGHT * 2);
@@ -2643,6 +3130,7 @@ void GFXcanvas16::drawFastHLine(int16_t x, int16_t y, int16_t w,
 void GFXcanvas16::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
                                    uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
+  dirty.mark(x, y, 1, h);
   uint16_t *buffer_ptr = buffer + y * WIDTH + x;
   for (int16_t i = 0; i < h; i++) {
     (*buffer_ptr) = color;
@@ -2662,8 +3150,57 @@ void GFXcanvas16::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
 void GFXcanvas16::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
                                    uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
+  dirty.mark(x, y, w, 1);
   uint32_t buffer_index = y * WIDTH + x;
   for (uint32_t i = buffer_index; i < buffer_index + w; i++) {
     buffer[i] = color;
   }
 }
+
+/**************************************************************************/
+/*!
+   @brief    Draw one 'classic' font character straight into the buffer, when
+             it is unrotated and entirely on the canvas. Anything else goes
+             through Adafruit_GFX::writeCharRows().
+   @param    x   Top left corner x coordinate
+   @param    y   Top left corner y coordinate
+   @param    rows  8 rows of 6 pixels, MSB is the leftmost pixel
+   @param    color   16-bit 5-6-5 Color of the character
+   @param    bg   16-bit 5-6-5 background color, same as color for none
+   @param    size_x  Font magnification level in X-axis, 1 is 'original' size
+   @param    size_y  Font magnification level in Y-axis, 1 is 'original' size
+*/
+/**************************************************************************/
+void GFXcanvas16::writeCharRows(int16_t x, int16_t y, const uint8_t *rows,
+                                uint16_t color, uint16_t bg, uint8_t size_x,
+                                uint8_t size_y) {
+  int16_t w = 6 * size_x, h = 8 * size_y;
+  if (!buffer || rotation || (x < 0) || (y < 0) || (x + w > WIDTH) ||
+      (y + h > HEIGHT)) {
+    Adafruit_GFX::writeCharRows(x, y, rows, color, bg, size_x, size_y);
+    return;
+  }
+
+  dirty.mark(x, y, w, h);
+  uint16_t *ptr = &buffer[(uint32_t)y * WIDTH + x];
+  for (int8_t j = 0; j < 8; j++) {
+    for (uint8_t r = 0; r < size_y; r++, ptr += WIDTH) {
+      uint16_t *p = ptr;
+      uint8_t line = rows[j];
+      if (bg == color) { // Transparent, stop after the last set pixel
+        for (; line; line <<= 1, p += size_x) {
+          if (line & 0x80) {
+            for (uint8_t s = 0; s < size_x; s++)
+              p[s] = color;
+          }
+        }
+      } else {
+        for (int8_t i = 0; i < 6; i++, line <<= 1) {
+          uint16_t c = (line & 0x80) ? color : bg;
+          for (uint8_t s = 0; s < size_x; s++)
+            *p++ = c;
+        }
+      }
+    }
+  }
+}
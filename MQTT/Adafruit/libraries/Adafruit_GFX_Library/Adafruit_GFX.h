@@ -120,6 +120,7 @@ public:
   void setTextSize(uint8_t s);
   void setTextSize(uint8_t sx, uint8_t sy);
   void setFont(const GFXfont *f = NULL);
+  void setPackedFont(const GFXpackedFont *f);
 
   /**********************************************************************/
   /*!
@@ -232,6 +233,14 @@ public:
 protected:
   void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx,
                   int16_t *miny, int16_t *maxx, int16_t *maxy);
+  virtual void writeCharRows(int16_t x, int16_t y, const uint8_t *rows,
+                             uint16_t color, uint16_t bg, uint8_t size_x,
+                             uint8_t size_y);
+  void writeTextRun(int16_t x, int16_t y, int16_t len, uint16_t color,
+                    uint8_t size_x, uint8_t size_y);
+  void drawPackedGlyph(int16_t x, int16_t y, const uint8_t *data, uint8_t w,
+                       uint8_t h, uint8_t format, uint16_t color, uint16_t bg,
+                       uint8_t size_x, uint8_t size_y);
   int16_t WIDTH;        ///< This is the 'raw' display width - never changes
   int16_t HEIGHT;       ///< This is the 'raw' display height - never changes
   int16_t _width;       ///< Display width as modified by current rotation
@@ -246,6 +255,7 @@ protected:
   bool wrap;            ///< If set, 'wrap' text at right edge of display
   bool _cp437;          ///< If set, use correct CP437 charset (default is off)
   GFXfont *gfxFont;     ///< Pointer to special font
+  uint8_t gfxFontFormat; ///< GFX_FONT_* flags of gfxFont
 };
 
 /// A simple drawn button UI element
@@ -306,6 +316,68 @@ private:
   bool currstate, laststate;
 };
 
+/// A bitmap of the 8x8 pixel tiles of a framebuffer that changed since the
+/// last flush, in raw (rotation 0) coordinates. Lets a driver send only the
+/// runs of dirty tiles instead of one bounding box around all changes.
+class GFXdirtyTiles {
+public:
+  GFXdirtyTiles(void);
+  ~GFXdirtyTiles(void);
+  GFXdirtyTiles(const GFXdirtyTiles &) = delete; ///< Owns its bitmap
+  GFXdirtyTiles &operator=(const GFXdirtyTiles &) = delete; ///< Owns its bitmap
+  bool begin(uint16_t w, uint16_t h);
+  void end(void);
+  void mark(int16_t x, int16_t y, int16_t w, int16_t h);
+  void markAll(void);
+  void clear(void);
+  bool isDirty(uint16_t col, uint16_t row) const;
+  uint16_t nextRun(uint16_t row, uint16_t *col) const;
+
+  /**********************************************************************/
+  /*!
+    @brief  Mark the tile containing a single pixel as dirty. Does nothing
+            if begin() was not called.
+    @param  x  Raw x coordinate, must be within the framebuffer
+    @param  y  Raw y coordinate, must be within the framebuffer
+  */
+  /**********************************************************************/
+  void markPixel(int16_t x, int16_t y) {
+    if (bits) {
+      uint16_t i = (y >> 3) * _cols + (x >> 3);
+      bits[i >> 3] |= 1 << (i & 7);
+    }
+  }
+
+  /**********************************************************************/
+  /*!
+    @brief    Check whether begin() allocated the bitmap
+    @returns  True if changes are being tracked
+  */
+  /**********************************************************************/
+  bool enabled(void) const { return bits != NULL; }
+
+  /**********************************************************************/
+  /*!
+    @brief    Get the number of tile columns
+    @returns  Framebuffer width divided by 8, rounded up
+  */
+  /**********************************************************************/
+  uint16_t columns(void) const { return _cols; }
+
+  /**********************************************************************/
+  /*!
+    @brief    Get the number of tile rows
+    @returns  Framebuffer height divided by 8, rounded up
+  */
+  /**********************************************************************/
+  uint16_t rows(void) const { return _rows; }
+
+private:
+  uint8_t *bits;  ///< One bit per tile, row-major, NULL until begin()
+  uint16_t _cols; ///< Number of tile columns
+  uint16_t _rows; ///< Number of tile rows
+};
+
 /// A GFX 1-bit canvas context for graphics
 class GFXcanvas1 : public Adafruit_GFX {
 public:
@@ -323,11 +395,25 @@ public:
   */
   /**********************************************************************/
   uint8_t *getBuffer(void) const { return buffer; }
+  bool setDirtyTracking(bool enable);
+  /**********************************************************************/
+  /*!
+    @brief    Get the tiles that changed since they were last cleared,
+              see setDirtyTracking()
+    @returns  A pointer to the dirty tile bitmap, or NULL if disabled
+  */
+  /**********************************************************************/
+  GFXdirtyTiles *getDirtyTiles(void) {
+    return dirty.enabled() ? &dirty : NULL;
+  }
 
 protected:
+  GFXdirtyTiles dirty; ///< Changed tiles, see setDirtyTracking()
   bool getRawPixel(int16_t x, int16_t y) const;
   void drawFastRawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   void drawFastRawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void writeCharRows(int16_t x, int16_t y, const uint8_t *rows, uint16_t color,
+                     uint16_t bg, uint8_t size_x, uint8_t size_y);
   uint8_t *buffer; ///< Raster data: no longer private, allow subclass access
 
 private:
@@ -354,11 +440,25 @@ public:
   */
   /**********************************************************************/
   uint8_t *getBuffer(void) const { return buffer; }
+  bool setDirtyTracking(bool enable);
+  /**********************************************************************/
+  /*!
+    @brief    Get the tiles that changed since they were last cleared,
+              see setDirtyTracking()
+    @returns  A pointer to the dirty tile bitmap, or NULL if disabled
+  */
+  /**********************************************************************/
+  GFXdirtyTiles *getDirtyTiles(void) {
+    return dirty.enabled() ? &dirty : NULL;
+  }
 
 protected:
+  GFXdirtyTiles dirty; ///< Changed tiles, see setDirtyTracking()
   uint8_t getRawPixel(int16_t x, int16_t y) const;
   void drawFastRawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   void drawFastRawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void writeCharRows(int16_t x, int16_t y, const uint8_t *rows, uint16_t color,
+                     uint16_t bg, uint8_t size_x, uint8_t size_y);
   uint8_t *buffer; ///< Raster data: no longer private, allow subclass access
 };
 
@@ -380,11 +480,25 @@ public:
   */
   /**********************************************************************/
   uint16_t *getBuffer(void) const { return buffer; }
+  bool setDirtyTracking(bool enable);
+  /**********************************************************************/
+  /*!
+    @brief    Get the tiles that changed since they were last cleared,
+              see setDirtyTracking()
+    @returns  A pointer to the dirty tile bitmap, or NULL if disabled
+  */
+  /**********************************************************************/
+  GFXdirtyTiles *getDirtyTiles(void) {
+    return dirty.enabled() ? &dirty : NULL;
+  }
 
 protected:
+  GFXdirtyTiles dirty; ///< Changed tiles, see setDirtyTracking()
   uint16_t getRawPixel(int16_t x, int16_t y) const;
   void drawFastRawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   void drawFastRawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void writeCharRows(int16_t x, int16_t y, const uint8_t *rows, uint16_t color,
+                     uint16_t bg, uint8_t size_x, uint8_t size_y);
   uint16_t *buffer; ///< Raster data: no longer private, allow subclass access
 };
 
@@ -228,6 +228,9 @@ bool Adafruit_GrayOLED::_init(uint8_t addr, bool reset) {
       !(buffer = (uint8_t *)malloc(_bpp * WIDTH * ((HEIGHT + 7) / 8)))) {
     return false;
   }
+  if (!dirty.enabled() && !dirty.begin(WIDTH, HEIGHT)) {
+    return false;
+  }
 
   // Reset OLED if requested and reset pin specified in constructor
   if (reset && (rstPin >= 0)) {
@@ -305,6 +308,7 @@ void Adafruit_GrayOLED::drawPixel(int16_t x, int16_t y, uint16_t color) {
     window_y1 = min(window_y1, y);
     window_x2 = max(window_x2, x);
     window_y2 = max(window_y2, y);
+    dirty.markPixel(x, y);
 
     if (_bpp == 1) {
       switch (color) {
@@ -348,6 +352,216 @@ void Adafruit_GrayOLED::clearDisplay(void) {
   window_y1 = 0;
   window_x2 = WIDTH - 1;
   window_y2 = HEIGHT - 1;
+  dirty.markAll();
+}
+
+/*!
+    @brief  Speed optimized horizontal line drawing. Monochrome displays
+            write the buffer bytes directly and mark the dirty tiles once
+            per line instead of once per pixel.
+    @param  x
+            Leftmost column -- 0 at left to (screen width - 1) at right.
+    @param  y
+            Row of display -- 0 at top to (screen height -1) at bottom.
+    @param  w
+            Width of line, in pixels.
+    @param  color
+            Line color, one of: MONOOLED_BLACK, MONOOLED_WHITE or
+            MONOOLED_INVERSE.
+    @note   Changes buffer contents only, no immediate effect on display.
+            Follow up with a call to display(), or with other graphics
+            commands as needed by one's own application.
+*/
+void Adafruit_GrayOLED::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                      uint16_t color) {
+  if (_bpp != 1) {
+    Adafruit_GFX::drawFastHLine(x, y, w, color);
+    return;
+  }
+
+  if (w < 0) { // Convert negative widths to positive equivalent
+    w *= -1;
+    x -= w - 1;
+  }
+
+  // Edge rejection (no-draw if totally off screen)
+  if ((y < 0) || (y >= height()) || (x >= width()) || ((x + w - 1) < 0)) {
+    return;
+  }
+
+  if (x < 0) { // Clip left
+    w += x;
+    x = 0;
+  }
+  if (x + w > width()) { // Clip right
+    w = width() - x;
+  }
+
+  switch (getRotation()) {
+  case 0:
+    drawFastRawHLine(x, y, w, color);
+    break;
+  case 1:
+    grayoled_swap(x, y);
+    x = WIDTH - x - 1;
+    drawFastRawVLine(x, y, w, color);
+    break;
+  case 2:
+    x = WIDTH - x - w;
+    y = HEIGHT - y - 1;
+    drawFastRawHLine(x, y, w, color);
+    break;
+  case 3:
+    grayoled_swap(x, y);
+    y = HEIGHT - y - w;
+    drawFastRawVLine(x, y, w, color);
+    break;
+  }
+}
+
+/*!
+    @brief  Speed optimized vertical line drawing. Monochrome displays
+            write up to 8 pixels per buffer byte and mark the dirty tiles
+            once per line instead of once per pixel.
+    @param  x
+            Column of display -- 0 at left to (screen width - 1) at right.
+    @param  y
+            Topmost row -- 0 at top to (screen height - 1) at bottom.
+    @param  h
+            Height of line, in pixels.
+    @param  color
+            Line color, one of: MONOOLED_BLACK, MONOOLED_WHITE or
+            MONOOLED_INVERSE.
+    @note   Changes buffer contents only, no immediate effect on display.
+            Follow up with a call to display(), or with other graphics
+            commands as needed by one's own application.
+*/
+void Adafruit_GrayOLED::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                      uint16_t color) {
+  if (_bpp != 1) {
+    Adafruit_GFX::drawFastVLine(x, y, h, color);
+    return;
+  }
+
+  if (h < 0) { // Convert negative heights to positive equivalent
+    h *= -1;
+    y -= h - 1;
+  }
+
+  // Edge rejection (no-draw if totally off screen)
+  if ((x < 0) || (x >= width()) || (y >= height()) || ((y + h - 1) < 0)) {
+    return;
+  }
+
+  if (y < 0) { // Clip top
+    h += y;
+    y = 0;
+  }
+  if (y + h > height()) { // Clip bottom
+    h = height() - y;
+  }
+
+  switch (getRotation()) {
+  case 0:
+    drawFastRawVLine(x, y, h, color);
+    break;
+  case 1:
+    grayoled_swap(x, y);
+    x = WIDTH - x - h;
+    drawFastRawHLine(x, y, h, color);
+    break;
+  case 2:
+    x = WIDTH - x - 1;
+    y = HEIGHT - y - h;
+    drawFastRawVLine(x, y, h, color);
+    break;
+  case 3:
+    grayoled_swap(x, y);
+    y = HEIGHT - y - 1;
+    drawFastRawHLine(x, y, h, color);
+    break;
+  }
+}
+
+/*!
+    @brief  Extend the dirty window and mark the dirty tiles for a
+            rectangle in raw (unrotated) coordinates.
+    @param  x  Leftmost raw column
+    @param  y  Topmost raw row
+    @param  w  Width in pixels
+    @param  h  Height in pixels
+*/
+void Adafruit_GrayOLED::markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+  window_x1 = min(window_x1, x);
+  window_y1 = min(window_y1, y);
+  window_x2 = max(window_x2, (int16_t)(x + w - 1));
+  window_y2 = max(window_y2, (int16_t)(y + h - 1));
+  dirty.mark(x, y, w, h);
+}
+
+/*!
+    @brief  Horizontal line in raw (unrotated) coordinates on a monochrome
+            buffer: one bit in each of w consecutive bytes of a page.
+    @param  x  Leftmost raw column, already clipped
+    @param  y  Raw row, already clipped
+    @param  w  Width in pixels, already clipped
+    @param  color  MONOOLED_BLACK, MONOOLED_WHITE or MONOOLED_INVERSE
+*/
+void Adafruit_GrayOLED::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
+                                         uint16_t color) {
+  markDirty(x, y, w, 1);
+
+  uint8_t *ptr = &buffer[x + (y / 8) * WIDTH];
+  uint8_t mask = 1 << (y & 7);
+  switch (color) {
+  case MONOOLED_WHITE:
+    while (w--)
+      *ptr++ |= mask;
+    break;
+  case MONOOLED_BLACK:
+    mask = ~mask;
+    while (w--)
+      *ptr++ &= mask;
+    break;
+  case MONOOLED_INVERSE:
+    while (w--)
+      *ptr++ ^= mask;
+    break;
+  }
+}
+
+/*!
+    @brief  Vertical line in raw (unrotated) coordinates on a monochrome
+            buffer: up to 8 bits at once in each page the line crosses.
+    @param  x  Raw column, already clipped
+    @param  y  Topmost raw row, already clipped
+    @param  h  Height in pixels, already clipped
+    @param  color  MONOOLED_BLACK, MONOOLED_WHITE or MONOOLED_INVERSE
+*/
+void Adafruit_GrayOLED::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
+                                         uint16_t color) {
+  markDirty(x, y, 1, h);
+
+  uint8_t *ptr = &buffer[x + (y / 8) * WIDTH];
+  int16_t end = y + h;
+  while (y < end) {
+    uint8_t shift = y & 7;
+    uint8_t bits = min((int16_t)(8 - shift), (int16_t)(end - y));
+    uint8_t mask = (0xFF >> (8 - bits)) << shift;
+    switch (color) {
+    case MONOOLED_WHITE:
+      *ptr |= mask;
+      break;
+    case MONOOLED_BLACK:
+      *ptr &= ~mask;
+      break;
+    case MONOOLED_INVERSE:
+      *ptr ^= mask;
+      break;
+    }
+    ptr += WIDTH;
+    y += bits;
+  }
 }
 
 /*!
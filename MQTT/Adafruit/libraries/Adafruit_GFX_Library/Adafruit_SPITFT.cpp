@@ -90,6 +90,17 @@ static const struct {
 #define NUM_TIMERS (sizeof tcList / sizeof tcList[0]) ///< # timer/counters
 #endif                                                // end __SAMD51__
 
+#elif defined(USE_ESP32_SPI_DMA)
+#include <esp_heap_caps.h> // heap_caps_malloc() function
+// Largest single DMA transfer, caps the size of the working buffers
+#define ESP32_DMA_MAX_BYTES 32768
+
+// DMA transfer-complete callback, runs in the SPI interrupt and counts
+// finished transactions (t->user points to Adafruit_SPITFT::dmaDone)
+static void IRAM_ATTR dma_callback(spi_transaction_t *t) {
+  volatile uint32_t *done = (volatile uint32_t *)t->user;
+  *done = *done + 1;
+}
 #endif // end USE_SPI_DMA
 
 // Possible values for Adafruit_SPITFT.connection:
@@ -888,6 +899,49 @@ void Adafruit_SPITFT::initSPI(uint32_t freq, uint8_t spiMode) {
     }           // end addDescriptor()
     dma.free(); // Deallocate DMA channel
   }
+#elif defined(USE_ESP32_SPI_DMA)
+  if (connection == TFT_HARD_SPI) {
+    // Alloc 2 buffers of ESP32_DMA_LINES scanlines on display's major
+    // axis, in DMA-capable RAM. One is filled while the other one is
+    // being transferred.
+    int major = (WIDTH > HEIGHT) ? WIDTH : HEIGHT;
+    uint32_t len = (uint32_t)major * ESP32_DMA_LINES * 2;
+    // Each buffer holds maxFillLen / 2 pixels = maxFillLen bytes
+    maxFillLen = (len < ESP32_DMA_MAX_BYTES) ? len : ESP32_DMA_MAX_BYTES;
+    if ((pixelBuf[0] = (uint16_t *)heap_caps_malloc(
+             maxFillLen * sizeof(uint16_t), MALLOC_CAP_DMA))) {
+      pixelBuf[1] = &pixelBuf[0][maxFillLen / 2];
+      // The Arduino SPI object has already routed the pins, the ESP-IDF
+      // driver only shares the SPI peripheral for the DMA transfers. The
+      // device added below with spi_bus_add_device() is on the same host
+      // as SPIClass, and both program it: SPIClass must stay idle while
+      // DMA runs, and its settings are restored after (see dmaWait()).
+      // This has only been tested against a model of the driver
+      // (extras/host), not on hardware, hence ESP32_SPI_DMA_EXPERIMENTAL.
+      spi_bus_config_t bus = {};
+      bus.mosi_io_num = bus.miso_io_num = bus.sclk_io_num = -1;
+      bus.quadwp_io_num = bus.quadhd_io_num = -1;
+      bus.max_transfer_sz = ESP32_DMA_MAX_BYTES;
+      spi_device_interface_config_t dev = {};
+      dev.clock_speed_hz = freq;
+      dev.mode = spiMode;
+      dev.spics_io_num = -1; // CS is handled by startWrite() and endWrite()
+      dev.queue_size = 2;    // One transaction per pixelBuf
+      dev.flags = SPI_DEVICE_NO_DUMMY;
+      dev.post_cb = dma_callback;
+      // ESP_ERR_INVALID_STATE: bus already set up for another display
+      esp_err_t err = spi_bus_initialize(ESP32_DMA_HOST, &bus, SPI_DMA_CH_AUTO);
+      if (((err == ESP_OK) || (err == ESP_ERR_INVALID_STATE)) &&
+          (spi_bus_add_device(ESP32_DMA_HOST, &dev, &dmaDevice) == ESP_OK)) {
+        memset(dmaTrans, 0, sizeof dmaTrans);
+        return; // Success!
+      }
+      // else clean up the buffers, writePixels() will not use DMA
+      dmaDevice = NULL;
+      heap_caps_free(pixelBuf[0]);
+      pixelBuf[0] = pixelBuf[1] = NULL;
+    }
+  }
 #endif // end USE_SPI_DMA
 }
 
@@ -914,6 +968,9 @@ void Adafruit_SPITFT::startWrite(void) {
   SPI_BEGIN_TRANSACTION();
   if (_cs >= 0)
     SPI_CS_LOW();
+#if defined(USE_ESP32_SPI_DMA)
+  dmaWriting = true;
+#endif
 }
 
 /*!
@@ -923,6 +980,12 @@ void Adafruit_SPITFT::startWrite(void) {
             for all display types; not an SPI-specific function.
 */
 void Adafruit_SPITFT::endWrite(void) {
+#if defined(USE_ESP32_SPI_DMA)
+  // Queued transfers must be out before CS goes high. The transaction
+  // ends here, so dmaWait() need not restart it.
+  dmaWriting = false;
+  dmaWait();
+#endif
   if (_cs >= 0)
     SPI_CS_HIGH();
   SPI_END_TRANSACTION();
@@ -991,7 +1054,10 @@ void Adafruit_SPITFT::swapBytes(uint16_t *src, uint32_t len, uint16_t *dest) {
                        can optimize around this -- for example, a bitmap in a
                        uint16_t array having the byte values already ordered
                        big-endian, this can save time here, ESPECIALLY if
-                       using this function's non-blocking DMA mode.
+                       using this function's non-blocking DMA mode. With DMA
+                       on ESP32, pixels of either order are copied to
+                       DMA-capable working buffers, 'colors' can be reused as
+                       soon as this function returns.
 */
 void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len, bool block,
                                   bool bigEndian) {
@@ -1005,6 +1071,43 @@ void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len, bool block,
 
 #if defined(ESP32)
   if (connection == TFT_HARD_SPI) {
+#if defined(USE_ESP32_SPI_DMA)
+    if (dmaDevice) {
+      uint32_t maxSpan = maxFillLen / 2; // One pixelBuf max
+      while (len) {
+        spi_transaction_t *t = &dmaTrans[dmaNext], *done;
+        if (dmaQueued == 2) {
+          // Both transactions are queued, wait for the oldest one, which
+          // is the one (and the pixelBuf) about to be reused
+          spi_device_get_trans_result(dmaDevice, &done, portMAX_DELAY);
+          dmaQueued--;
+        }
+        // Copy (and swap if needed) into a DMA working buffer while the
+        // prior transfer, from the other buffer, is in progress. The
+        // caller's buffer may not be DMA-capable (PSRAM, flash) and is
+        // free to change once this function returns, so it is never sent
+        // directly, even when already in display order.
+        uint32_t count = (len < maxSpan) ? len : maxSpan;
+        if (!bigEndian) {
+          swapBytes(colors, count, pixelBuf[dmaNext]);
+        } else {
+          memcpy(pixelBuf[dmaNext], colors, count * 2);
+        }
+        t->tx_buffer = pixelBuf[dmaNext];
+        t->length = count * 16; // In bits
+        t->user = (void *)&dmaDone;
+        spi_device_queue_trans(dmaDevice, t, portMAX_DELAY);
+        dmaQueued++;
+        dmaSent++;
+        dmaNext = 1 - dmaNext; // Swap DMA pixel buffers
+        colors += count;
+        len -= count;
+      }
+      if (block)
+        dmaWait(); // Wait for last transfer to complete
+      return;
+    }
+#endif // end USE_ESP32_SPI_DMA
     if (!bigEndian) {
       hwspi._spi->writePixels(colors, len * 2); // Inbuilt endian-swap
     } else {
@@ -1169,6 +1272,22 @@ void Adafruit_SPITFT::dmaWait(void) {
     pinPeripheral(tft8._wr, PIO_OUTPUT); // Switch WR back to GPIO
   }
 #endif // end __SAMD51__ || ARDUINO_SAMD_ZERO
+#elif defined(USE_ESP32_SPI_DMA)
+  if (!dmaQueued)
+    return;
+  spi_transaction_t *done;
+  while (dmaQueued) {
+    spi_device_get_trans_result(dmaDevice, &done, portMAX_DELAY);
+    dmaQueued--;
+  }
+  // The ESP-IDF driver reprograms the SPI peripheral for its transfers,
+  // restart the Arduino SPI transaction to restore its settings. Outside
+  // startWrite()/endWrite() there is none, and starting one would hold
+  // the SPI bus lock for good.
+  if (dmaWriting) {
+    SPI_END_TRANSACTION();
+    SPI_BEGIN_TRANSACTION();
+  }
 #endif
 }
 
@@ -1180,6 +1299,8 @@ void Adafruit_SPITFT::dmaWait(void) {
 bool Adafruit_SPITFT::dmaBusy(void) const {
 #if defined(USE_SPI_DMA) && (defined(__SAMD51__) || defined(ARDUINO_SAMD_ZERO))
   return dma_busy;
+#elif defined(USE_ESP32_SPI_DMA)
+  return dmaSent != dmaDone;
 #else
   return false;
 #endif
@@ -1204,7 +1325,7 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
 #define TMPBUF_LONGWORDS (SPI_MAX_PIXELS_AT_ONCE + 1) / 2
 #define TMPBUF_PIXELS (TMPBUF_LONGWORDS * 2)
     static uint32_t temp[TMPBUF_LONGWORDS];
-    uint32_t c32 = color * 0x00010001;
+    uint32_t c32 = color * 0x00010001u;
     uint16_t bufLen = (len < TMPBUF_PIXELS) ? len : TMPBUF_PIXELS, xferLen,
              fillLen;
     // Fill temp buffer 32 bits at a time
@@ -1273,7 +1394,7 @@ void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
       // descriptor list pointing repeatedly to this data. We can do
       // this slightly faster working 2 pixels (32 bits) at a time.
       uint32_t *pixelPtr = (uint32_t *)pixelBuf[0],
-               twoPixels = __builtin_bswap16(color) * 0x00010001;
+               twoPixels = __builtin_bswap16(color) * 0x00010001u;
       // We can avoid some or all of the buffer-filling if the color
       // is the same as last time...
       if (color == lastFillColor) {
@@ -1626,6 +1747,59 @@ inline void Adafruit_SPITFT::writeFillRectPreclipped(int16_t x, int16_t y,
   writeColor(color, (uint32_t)w * h);
 }
 
+/*!
+    @brief  Draw one 'classic' font character, called by drawChar() inside a
+            transaction. An opaque character that is entirely on screen is
+            streamed into a single address window, instead of setting a
+            window for each run of pixels. Transparent or partly offscreen
+            characters go through Adafruit_GFX::writeCharRows().
+    @param  x       Horizontal position of top left corner.
+    @param  y       Vertical position of top left corner.
+    @param  rows    8 rows of 6 pixels, MSB is the leftmost pixel.
+    @param  color   16-bit character color in '565' RGB format.
+    @param  bg      16-bit background color in '565' RGB format, same as
+                    color for a transparent background.
+    @param  size_x  Horizontal magnification, 1 is 'original' size.
+    @param  size_y  Vertical magnification, 1 is 'original' size.
+*/
+void Adafruit_SPITFT::writeCharRows(int16_t x, int16_t y, const uint8_t *rows,
+                                    uint16_t color, uint16_t bg,
+                                    uint8_t size_x, uint8_t size_y) {
+  int16_t w = 6 * size_x, h = 8 * size_y;
+  if ((bg == color) || (x < 0) || (y < 0) || (x + w > _width) ||
+      (y + h > _height)) {
+    Adafruit_GFX::writeCharRows(x, y, rows, color, bg, size_x, size_y);
+    return;
+  }
+
+  setAddrWindow(x, y, w, h);
+  if ((size_x == 1) && (size_y == 1)) {
+    uint16_t pixels[6 * 8];
+    uint8_t k = 0;
+    for (uint8_t j = 0; j < 8; j++) {
+      uint8_t line = rows[j];
+      for (uint8_t i = 0; i < 6; i++, line <<= 1)
+        pixels[k++] = (line & 0x80) ? color : bg;
+    }
+    writePixels(pixels, 6 * 8);
+  } else {
+    for (uint8_t j = 0; j < 8; j++) {
+      for (uint8_t r = 0; r < size_y; r++) { // Repeat each row size_y times
+        uint8_t line = rows[j], i = 0;
+        while (i < 6) { // One writeColor() per run of equal color
+          uint8_t start = i;
+          bool set = line & 0x80;
+          do {
+            line <<= 1;
+            i++;
+          } while ((i < 6) && ((bool)(line & 0x80) == set));
+          writeColor(set ? color : bg, (uint32_t)(i - start) * size_x);
+        }
+      }
+    }
+  }
+}
+
 // -------------------------------------------------------------------------
 // Ever-so-slightly higher-level graphics operations. Similar to the 'write'
 // functions above, but these contain their own chip-select and SPI
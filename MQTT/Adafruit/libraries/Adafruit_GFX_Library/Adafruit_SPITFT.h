@@ -88,8 +88,39 @@ typedef volatile ADAGFX_PORT_t *PORTreg_t; ///< PORT register type
 // 4 bytes/pixel on display major axis + 8 bytes/pixel on minor axis,
 // e.g. 320x240 pixels = 320 * 4 + 240 * 8 = 3,200 bytes.
 
+// DMA on ESP32 is EXPERIMENTAL and needs ESP32_SPI_DMA_EXPERIMENTAL defined
+// in addition to USE_SPI_DMA. It has only been run against a host model of
+// the ESP-IDF driver (extras/host/esp32_dma_bands.cpp), not on an ESP32 yet:
+// the IDF driver is attached to the SPI host that the Arduino SPIClass
+// already drives, and how both share the peripheral is still unvalidated.
+#if defined(USE_SPI_DMA) && defined(ESP32) &&                                  \
+    defined(ESP32_SPI_DMA_EXPERIMENTAL)
+#define USE_ESP32_SPI_DMA ///< ESP-IDF DMA backend for writePixels()
+#endif
+
 #if defined(USE_SPI_DMA) && (defined(__SAMD51__) || defined(ARDUINO_SAMD_ZERO))
 #include <Adafruit_ZeroDMA.h>
+#elif defined(USE_ESP32_SPI_DMA)
+// On ESP32, DMA transfers go through the ESP-IDF SPI master driver, on the
+// same SPI host as the Arduino SPIClass (VSPI, the default SPI object, on
+// the original ESP32 and SPI2/FSPI on later chips). Define ESP32_DMA_HOST
+// before including this file if the display is on another SPI peripheral.
+// Pixels are always swapped/copied into two DMA-capable buffers of
+// ESP32_DMA_LINES scanlines each, one is filled while the other is
+// transmitted, RAM usage is
+// 2 * ESP32_DMA_LINES * 2 bytes/pixel on display major axis,
+// e.g. 320x240 pixels, 4 lines = 5,120 bytes.
+#include <driver/spi_master.h>
+#if !defined(ESP32_DMA_HOST)
+#if defined(CONFIG_IDF_TARGET_ESP32)
+#define ESP32_DMA_HOST VSPI_HOST ///< SPI host used by the default SPI object
+#else
+#define ESP32_DMA_HOST SPI2_HOST ///< SPI host used by the default SPI object
+#endif
+#endif
+#if !defined(ESP32_DMA_LINES)
+#define ESP32_DMA_LINES 4 ///< Scanlines per DMA working buffer
+#endif
 #endif
 
 // This is kind of a kludge. Needed a way to disambiguate the software SPI
@@ -382,6 +413,10 @@ protected:
   inline void TFT_RD_HIGH(void);   // Parallel interface read high
   inline void TFT_RD_LOW(void);    // Parallel interface read low
 
+  // Opaque 'classic' font characters go out in a single address window
+  void writeCharRows(int16_t x, int16_t y, const uint8_t *rows, uint16_t color,
+                     uint16_t bg, uint8_t size_x, uint8_t size_y);
+
   // CLASS INSTANCE VARIABLES --------------------------------------------
 
   // Here be dragons! There's a big union of three structures here --
@@ -500,6 +535,16 @@ protected:
   uint16_t lastFillColor = 0;        ///< Last color used w/fill
   uint32_t lastFillLen = 0;          ///< # of pixels w/last fill
   uint8_t onePixelBuf;               ///< For hi==lo fill
+#elif defined(USE_ESP32_SPI_DMA) // Used by hardware SPI
+  spi_device_handle_t dmaDevice = NULL; ///< ESP-IDF device for DMA writes
+  spi_transaction_t dmaTrans[2];        ///< One transaction per pixelBuf
+  uint16_t *pixelBuf[2] = {NULL, NULL}; ///< Working buffers
+  uint16_t maxFillLen;                  ///< Max pixels in both pixelBufs
+  uint32_t dmaSent = 0;                 ///< # of transactions queued
+  volatile uint32_t dmaDone = 0;        ///< # finished, counted in the ISR
+  uint8_t dmaQueued = 0;                ///< Transactions not reclaimed yet
+  uint8_t dmaNext = 0;                  ///< Next transaction/pixelBuf #
+  bool dmaWriting = false;              ///< Between startWrite(), endWrite()
 #endif
 #if defined(USE_FAST_PINIO)
 #if defined(HAS_PORT_SET_CLR)
@@ -0,0 +1,366 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeMonoBold24pt7bRLEBitmaps[] PROGMEM = {
+    0x23, 0x35, 0x1E, 0x77, 0xE9, 0x15, 0x33, 0x51, 0x3E, 0x20, 0x93, 0x35,
+    0x1F, 0x71, 0x52, 0x42, 0x06, 0x36, 0xE6, 0x15, 0x45, 0xE5, 0x23, 0x63,
+    0x10, 0x73, 0x53, 0x4E, 0x40, 0x65, 0x35, 0x86, 0x35, 0x85, 0x45, 0x3F,
+    0x05, 0x53, 0x56, 0xD6, 0x1E, 0x20, 0x1D, 0x82, 0xD6, 0x1E, 0x30, 0x55,
+    0x35, 0x5D, 0x62, 0xE2, 0xD8, 0x2D, 0x62, 0xE8, 0x04, 0x53, 0x59, 0x44,
+    0x46, 0x83, 0x8E, 0x30, 0x75, 0xBD, 0x05, 0xD2, 0x3D, 0x32, 0xD4, 0x17,
+    0x56, 0x16, 0x75, 0x15, 0x94, 0x15, 0x93, 0x26, 0xD0, 0xB9, 0xD0, 0x7D,
+    0x16, 0xD1, 0x8C, 0xB8, 0xD1, 0x6F, 0x03, 0xB9, 0xAA, 0x8C, 0x66, 0x1D,
+    0x51, 0xD4, 0x2D, 0x33, 0x31, 0xB4, 0xE6, 0x07, 0x5D, 0x23, 0x80, 0x45,
+    0xD2, 0x8B, 0xBA, 0x44, 0x39, 0x45, 0x48, 0xE2, 0x37, 0x38, 0x45, 0x49,
+    0x44, 0x3A, 0xBB, 0x95, 0x54, 0x54, 0x7A, 0xA8, 0xA8, 0xA8, 0xAB, 0x65,
+    0x55, 0x36, 0x8C, 0xAB, 0x43, 0x49, 0x45, 0x41, 0xE2, 0x07, 0x37, 0x38,
+    0x45, 0x49, 0x34, 0x4A, 0xBB, 0x8D, 0x25, 0x50, 0x85, 0xD1, 0xB9, 0xC4,
+    0xF0, 0x4D, 0x07, 0x63, 0x39, 0x55, 0x17, 0xF0, 0x35, 0xD3, 0x6C, 0xF0,
+    0x46, 0xD2, 0x7D, 0x09, 0xBA, 0x35, 0x2C, 0x26, 0x16, 0x1D, 0x62, 0xC1,
+    0x54, 0xA2, 0xF5, 0x58, 0x35, 0x67, 0x36, 0x59, 0x1F, 0x01, 0xD7, 0x2D,
+    0x63, 0xD4, 0x67, 0x90, 0x06, 0xE6, 0x15, 0xE5, 0x23, 0x10, 0x72, 0x74,
+    0x55, 0xF4, 0x6F, 0x36, 0x36, 0x2F, 0x02, 0x53, 0xE3, 0x01, 0x54, 0xE8,
+    0x55, 0xE3, 0x01, 0x54, 0xF0, 0x25, 0x56, 0x55, 0x56, 0x55, 0x56, 0xF5,
+    0x56, 0x40, 0x12, 0x74, 0x65, 0x5F, 0x65, 0x65, 0x55, 0x62, 0xF0, 0x35,
+    0x56, 0x1E, 0x20, 0x45, 0x1E, 0x80, 0x55, 0x54, 0x1E, 0x20, 0x45, 0x1F,
+    0x03, 0x54, 0x64, 0x54, 0x64, 0x54, 0x64, 0xF5, 0x54, 0x60, 0x93, 0x9E,
+    0x30, 0x85, 0xA1, 0x55, 0x51, 0x35, 0x25, 0x25, 0x1F, 0xD8, 0x1D, 0x64,
+    0xD2, 0x3F, 0x06, 0x9B, 0xB5, 0xF0, 0x46, 0x16, 0x76, 0x36, 0x65, 0x55,
+    0x73, 0x73, 0x40, 0xA3, 0xAE, 0x80, 0x95, 0xAD, 0x81, 0xE2, 0xDA, 0x1D,
+    0x81, 0xE9, 0x09, 0x5D, 0x63, 0xA0, 0x36, 0xF3, 0x51, 0xF0, 0x25, 0x44,
+    0x45, 0x3F, 0x01, 0x45, 0x35, 0x45, 0xF3, 0x62, 0x70, 0x1D, 0x91, 0xE2,
+    0xDB, 0x1D, 0x91, 0x15, 0x1E, 0x37, 0x15, 0x10, 0xD4, 0x2D, 0x44, 0xE2,
+    0xD2, 0x5F, 0xD1, 0x51, 0xF0, 0xD0, 0x52, 0xF0, 0xC5, 0x3F, 0x0B, 0x54,
+    0xF0, 0xA5, 0x5F, 0x09, 0x5D, 0x16, 0xD1, 0x5D, 0x16, 0xD1, 0x5D, 0x16,
+    0x8F, 0x06, 0x59, 0xF0, 0x55, 0xAF, 0x04, 0x5B, 0xF0, 0x35, 0xCF, 0x02,
+    0x5D, 0x0F, 0x01, 0x5D, 0x16, 0xD1, 0xF5, 0xD2, 0x4D, 0x30, 0x77, 0xCB,
+    0x9D, 0x07, 0xD2, 0x5D, 0x44, 0x65, 0x63, 0x67, 0x61, 0xF0, 0x15, 0x95,
+    0x1E, 0xC5, 0xB5, 0xF1, 0x59, 0x52, 0x67, 0x63, 0x65, 0x64, 0xD4, 0x5D,
+    0x27, 0xD0, 0x9B, 0xC7, 0x70, 0x76, 0xD0, 0x7B, 0x9A, 0xA8, 0xC7, 0x71,
+    0x57, 0x62, 0x58, 0x34, 0x57, 0xED, 0x20, 0x85, 0x9D, 0x41, 0xE2, 0x01,
+    0xD6, 0x2D, 0x41, 0x77, 0xCB, 0x8D, 0x25, 0xD4, 0x3D, 0x62, 0x66, 0x71,
+    0x69, 0x6F, 0x05, 0xB5, 0x13, 0xC5, 0xD3, 0x5D, 0x26, 0xD1, 0x6D, 0x17,
+    0xD0, 0x7D, 0x07, 0xD0, 0x7D, 0x07, 0xD0, 0x6D, 0x07, 0xD0, 0x7D, 0x07,
+    0xD0, 0x7D, 0x06, 0x93, 0x17, 0x95, 0xE4, 0x0D, 0x80, 0x67, 0xBD, 0x07,
+    0xD2, 0x5D, 0x43, 0xD6, 0x26, 0x76, 0x33, 0xA6, 0x1E, 0x20, 0xD2, 0x5D,
+    0x26, 0xD1, 0x6A, 0xAA, 0xAB, 0x9C, 0xAC, 0xAD, 0x27, 0xD3, 0x6D, 0x36,
+    0xE3, 0xD3, 0x5D, 0x2B, 0x87, 0x1D, 0x71, 0xD6, 0x3D, 0x45, 0xD2, 0x99,
+    0x70, 0xFA, 0x73, 0xF0, 0x98, 0xB9, 0xAA, 0xA4, 0x15, 0x95, 0x15, 0x94,
+    0x25, 0x85, 0x25, 0x75, 0x35, 0x74, 0x45, 0x65, 0x45, 0x64, 0x55, 0x55,
+    0x55, 0x45, 0x65, 0x44, 0x75, 0x3D, 0x61, 0xE2, 0xDF, 0x0B, 0xD0, 0x5C,
+    0xA1, 0xE2, 0x08, 0xC9, 0xA1, 0x2D, 0x33, 0xE2, 0x02, 0xD4, 0x4D, 0x33,
+    0xE4, 0x02, 0x5D, 0x35, 0x16, 0x9D, 0x26, 0xD3, 0x3F, 0x02, 0xD4, 0x54,
+    0x67, 0xD3, 0x5D, 0x36, 0xE4, 0xD3, 0x5D, 0x2A, 0xA6, 0x16, 0x77, 0x1F,
+    0xD6, 0x3D, 0x45, 0xD1, 0xA9, 0x70, 0xB7, 0xAC, 0x7D, 0x05, 0xD2, 0x4D,
+    0x24, 0x9B, 0x7C, 0x6C, 0xF0, 0x16, 0xD1, 0x5D, 0x15, 0x36, 0x65, 0x29,
+    0x4D, 0x43, 0xFD, 0x52, 0x84, 0x71, 0x77, 0x51, 0x68, 0x6E, 0x30, 0x5A,
+    0x51, 0x58, 0x61, 0x67, 0x62, 0x65, 0x63, 0xD4, 0x4D, 0x26, 0xD0, 0x8B,
+    0xB7, 0x60, 0xE4, 0x0D, 0xBB, 0x9A, 0x51, 0xF0, 0xD1, 0x51, 0xE2, 0x0D,
+    0x05, 0x2E, 0x20, 0xC5, 0x3E, 0x20, 0xB5, 0x4E, 0x20, 0xA5, 0x5E, 0x20,
+    0x95, 0x6E, 0x20, 0x85, 0x7F, 0x08, 0x4D, 0x42, 0x90, 0x76, 0xBC, 0x7D,
+    0x15, 0xD3, 0x3D, 0x52, 0x66, 0x61, 0x68, 0x6E, 0x30, 0x5A, 0x51, 0x58,
+    0x52, 0x66, 0x63, 0xD3, 0x2F, 0x04, 0xC7, 0xD1, 0x5D, 0x33, 0x74, 0x72,
+    0x58, 0x51, 0xE3, 0x5A, 0xB8, 0x61, 0x66, 0x62, 0xD5, 0x3D, 0x35, 0xD1,
+    0x7C, 0xA8, 0x60, 0x67, 0xBB, 0x8D, 0x15, 0xD2, 0x4D, 0x43, 0x65, 0x71,
+    0x68, 0x51, 0x59, 0x51, 0xE2, 0x5A, 0xA9, 0xC7, 0x71, 0x65, 0x81, 0xD6,
+    0x2D, 0x53, 0xD4, 0x49, 0x25, 0x66, 0x35, 0xD1, 0x6D, 0x15, 0xD1, 0x6D,
+    0x06, 0xD0, 0x7C, 0x7B, 0x85, 0xD1, 0x5D, 0x16, 0xD0, 0x7C, 0xA7, 0xB0,
+    0x15, 0x1E, 0x37, 0x15, 0x1E, 0x90, 0x85, 0x1E, 0x37, 0x15, 0x10, 0x45,
+    0x1E, 0x30, 0x37, 0x45, 0x1E, 0x80, 0xD1, 0x6F, 0x36, 0x45, 0x46, 0x45,
+    0x3F, 0x02, 0x44, 0xF0, 0x14, 0x5F, 0x01, 0x37, 0x27, 0xD8, 0x1D, 0x84,
+    0xD5, 0x7D, 0x28, 0xD1, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0xAC, 0xAC,
+    0xAD, 0x0B, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x39, 0xD4,
+    0x8D, 0x57, 0xD6, 0x41, 0x1D, 0x91, 0xE2, 0xDB, 0x1D, 0x91, 0xE3, 0x0D,
+    0xCD, 0x91, 0xE2, 0xDB, 0x1D, 0x91, 0xDA, 0x4D, 0x66, 0xD4, 0x8D, 0x39,
+    0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD2, 0xAD, 0x2A, 0xD1, 0xAB, 0x9C,
+    0x9C, 0x9C, 0x9C, 0x9C, 0x9D, 0x08, 0xD2, 0x6D, 0x44, 0xDF, 0x0D, 0x10,
+    0x67, 0xAD, 0x04, 0xD4, 0x3D, 0x52, 0xD6, 0x16, 0x76, 0x15, 0x9B, 0xA5,
+    0x13, 0xB5, 0xD2, 0x5D, 0x16, 0xD0, 0x6B, 0x99, 0xA9, 0x9C, 0x66, 0xF0,
+    0x84, 0xD4, 0x29, 0xE3, 0x0D, 0xE5, 0x8E, 0x30, 0x67, 0xD1, 0x58, 0x75,
+    0xC9, 0x9B, 0x7D, 0x05, 0x55, 0x54, 0x48, 0x33, 0x49, 0x41, 0xF0, 0x13,
+    0xB3, 0x14, 0xB3, 0x13, 0x96, 0x13, 0x78, 0x13, 0x69, 0x13, 0x5A, 0x13,
+    0x46, 0x23, 0x13, 0x44, 0x43, 0x13, 0x34, 0x53, 0x1E, 0x23, 0x33, 0x63,
+    0x13, 0x34, 0x53, 0x13, 0x44, 0x43, 0x13, 0x4B, 0x13, 0x5D, 0x16, 0xD0,
+    0x87, 0x14, 0xD2, 0xF0, 0x13, 0xD3, 0x4D, 0x34, 0x92, 0x45, 0x65, 0x4D,
+    0x24, 0xD1, 0x7B, 0x97, 0x60, 0x5C, 0xCF, 0x04, 0xD1, 0xD2, 0xD2, 0xD2,
+    0xD1, 0xD7, 0x9A, 0xF0, 0x95, 0x15, 0xD5, 0x51, 0x68, 0xF0, 0x85, 0x35,
+    0x8F, 0x07, 0x55, 0x5D, 0x14, 0x66, 0xC5, 0x75, 0xCD, 0x46, 0xF0, 0x5D,
+    0x65, 0xF0, 0x4D, 0x88, 0x5B, 0x57, 0x5D, 0x05, 0x4A, 0x7A, 0x1E, 0x2C,
+    0x5C, 0x1A, 0x7A, 0x10, 0x1D, 0x48, 0xD7, 0x6D, 0x94, 0xDA, 0x4D, 0x96,
+    0x59, 0x72, 0xE2, 0x03, 0x5B, 0x55, 0x5A, 0x65, 0x59, 0x66, 0xD6, 0x7D,
+    0x58, 0xD6, 0x7D, 0x76, 0xD8, 0x55, 0xA7, 0x45, 0xC6, 0xE2, 0x35, 0xD0,
+    0x53, 0x5C, 0x61, 0xDB, 0x1D, 0xC1, 0xDB, 0x2D, 0xA4, 0xD6, 0x60, 0x97,
+    0xD3, 0xB2, 0x37, 0xD6, 0x5D, 0x74, 0xD8, 0x38, 0x68, 0x36, 0x97, 0x26,
+    0xB6, 0x25, 0xD0, 0x51, 0x6D, 0x05, 0x15, 0xD2, 0x32, 0xE7, 0x5D, 0x76,
+    0xD7, 0x5D, 0x76, 0xD1, 0x32, 0x7B, 0x53, 0x87, 0x83, 0xD8, 0x5D, 0x76,
+    0xD4, 0xAD, 0x1D, 0x09, 0x70, 0x1D, 0x29, 0xD6, 0x6D, 0x75, 0xD8, 0x5D,
+    0x85, 0x58, 0x84, 0x5A, 0x64, 0x5B, 0x63, 0x5C, 0x53, 0x5C, 0x6E, 0x72,
+    0x5D, 0x05, 0x25, 0xC6, 0x25, 0xC5, 0x35, 0xB6, 0x35, 0x97, 0x3D, 0x92,
+    0xD9, 0x3D, 0x84, 0xD6, 0x7D, 0x38, 0x1D, 0xA1, 0xE2, 0xDB, 0x2D, 0xA1,
+    0xF0, 0x35, 0xB5, 0x45, 0x53, 0x35, 0x45, 0x45, 0x25, 0x45, 0x45, 0x33,
+    0x55, 0x45, 0x8E, 0x40, 0x3D, 0x1B, 0x54, 0x5B, 0x54, 0x54, 0x34, 0x55,
+    0x34, 0x5E, 0x23, 0x5C, 0x51, 0xDB, 0xE2, 0x0D, 0xC1, 0xDB, 0x1D, 0xBE,
+    0x20, 0xDC, 0x1D, 0xBE, 0x23, 0x5C, 0x53, 0x55, 0x34, 0x53, 0x54, 0x54,
+    0x34, 0x54, 0x58, 0xE4, 0x03, 0xD1, 0x8E, 0x20, 0x35, 0x45, 0xB5, 0x53,
+    0x9F, 0x03, 0x5D, 0x5D, 0x0B, 0xE2, 0xD2, 0xBD, 0x0B, 0x98, 0x33, 0x9C,
+    0x14, 0x6D, 0x65, 0xD7, 0x4D, 0x83, 0x87, 0x73, 0x6A, 0x62, 0x6C, 0x52,
+    0x5D, 0x05, 0x16, 0xD1, 0x32, 0xE4, 0x5D, 0x75, 0x8B, 0x1E, 0x25, 0x7D,
+    0x58, 0xD5, 0xD0, 0x52, 0x6C, 0x52, 0x7B, 0x53, 0x87, 0x73, 0xD9, 0x4D,
+    0x85, 0xD6, 0x8D, 0x2D, 0x09, 0x70, 0x29, 0x49, 0x2E, 0x20, 0x1B, 0x2B,
+    0x39, 0x49, 0x2E, 0x50, 0x35, 0xA5, 0x3E, 0x40, 0x3D, 0x73, 0xE5, 0x03,
+    0x5A, 0x54, 0xA4, 0xA1, 0xE2, 0xC2, 0xC1, 0xA4, 0xA1, 0x1D, 0x41, 0xE2,
+    0xD6, 0x1D, 0x41, 0xED, 0x30, 0x75, 0x8D, 0x41, 0xE2, 0xD6, 0x1D, 0x41,
+    0x8D, 0x31, 0xE2, 0x07, 0xD5, 0x8D, 0x31, 0xE9, 0x0D, 0x25, 0x63, 0xB5,
+    0x5E, 0x45, 0xA5, 0x55, 0x96, 0x57, 0x57, 0x6D, 0x66, 0xD5, 0x8D, 0x3B,
+    0xD0, 0xD2, 0x7C, 0x1A, 0x59, 0x2E, 0x2C, 0x3B, 0x2A, 0x59, 0x55, 0x86,
+    0x85, 0x67, 0x95, 0x57, 0xA5, 0x47, 0xB5, 0x37, 0xC5, 0x17, 0xD1, 0xCD,
+    0x2D, 0x0D, 0x1D, 0x1D, 0x0D, 0x2C, 0x72, 0x7B, 0x64, 0x7A, 0x56, 0x6A,
+    0x57, 0x66, 0xF0, 0x35, 0x86, 0x85, 0x95, 0x6A, 0x69, 0x1E, 0x2C, 0x69,
+    0x1A, 0x87, 0x10, 0x1D, 0x0B, 0xE2, 0xD2, 0xBD, 0x0B, 0xE9, 0x05, 0x5D,
+    0x75, 0xB3, 0x1E, 0x50, 0x55, 0xA5, 0x1D, 0xBE, 0x20, 0xDC, 0x1D, 0xB0,
+    0x27, 0xD0, 0x72, 0xF0, 0x19, 0xB9, 0x2A, 0x9A, 0x39, 0x99, 0x2F, 0x03,
+    0x97, 0x93, 0xE2, 0x03, 0xA5, 0xA3, 0xF0, 0x35, 0x15, 0x35, 0x15, 0x65,
+    0x16, 0x16, 0x15, 0x65, 0x25, 0x15, 0x25, 0x65, 0x2B, 0x25, 0x3F, 0x03,
+    0x53, 0x93, 0x56, 0x54, 0x83, 0x56, 0x54, 0x74, 0x56, 0x55, 0x64, 0x53,
+    0xF0, 0x35, 0xD2, 0x54, 0xA9, 0xA1, 0xE2, 0xC7, 0xC1, 0xA9, 0xA1, 0x17,
+    0x9A, 0x19, 0x7C, 0xF0, 0xA6, 0xC1, 0xA6, 0xA1, 0xF0, 0x39, 0x85, 0x6A,
+    0x75, 0x3F, 0x03, 0xB6, 0x56, 0x51, 0x65, 0x53, 0xF0, 0x35, 0x26, 0x45,
+    0x65, 0x36, 0x35, 0x3F, 0x03, 0x54, 0x62, 0x56, 0x55, 0x61, 0x53, 0xF0,
+    0x35, 0x6B, 0x65, 0x7A, 0x3F, 0x03, 0x58, 0x94, 0xA6, 0x83, 0xFC, 0x67,
+    0x3C, 0x76, 0x4A, 0x95, 0x30, 0xA7, 0xD4, 0xCD, 0x1D, 0x2B, 0xD4, 0x9D,
+    0x67, 0x85, 0x85, 0x79, 0x74, 0x6B, 0x63, 0x6D, 0x06, 0x25, 0xD2, 0x51,
+    0x6D, 0x26, 0xE6, 0x05, 0xD4, 0xBD, 0x26, 0x15, 0xD2, 0x52, 0x6D, 0x06,
+    0x36, 0xB6, 0x47, 0x97, 0x58, 0x58, 0x7D, 0x69, 0xD4, 0xBD, 0x2D, 0x0D,
+    0x0D, 0x47, 0xA0, 0x1D, 0x37, 0xD7, 0x4D, 0x83, 0xD9, 0x3D, 0x94, 0x58,
+    0x74, 0x5A, 0x6E, 0x33, 0x5B, 0x53, 0x5A, 0x63, 0x59, 0x64, 0xD7, 0x4D,
+    0x65, 0xD5, 0x6D, 0x47, 0xD1, 0x7E, 0x30, 0x35, 0xD4, 0xD0, 0xAE, 0x2D,
+    0x2A, 0xD0, 0xA0, 0xA7, 0xD4, 0xCD, 0x1D, 0x2B, 0xD4, 0x9D, 0x67, 0x85,
+    0x85, 0x79, 0x74, 0x6B, 0x63, 0x6D, 0x06, 0x25, 0xD2, 0x51, 0x6D, 0x26,
+    0xE5, 0x05, 0xD4, 0xBD, 0x26, 0x15, 0xD2, 0x52, 0x6D, 0x06, 0x27, 0xB6,
+    0x47, 0x97, 0x58, 0x58, 0x6D, 0x79, 0xD4, 0xBD, 0x2D, 0x0D, 0x0D, 0x29,
+    0xD5, 0x4D, 0x9B, 0x44, 0x7D, 0x85, 0xD9, 0x5D, 0x86, 0xD7, 0x84, 0x76,
+    0x40, 0x1D, 0x3B, 0xD7, 0x8D, 0x87, 0xD9, 0x7D, 0x99, 0x58, 0x69, 0x59,
+    0x64, 0xE2, 0x04, 0x5A, 0x58, 0x59, 0x68, 0x57, 0x79, 0xD6, 0x9D, 0x5A,
+    0xD3, 0xCD, 0x2D, 0x0D, 0x3C, 0x55, 0x7B, 0x56, 0x7A, 0x57, 0x79, 0x58,
+    0x69, 0x59, 0x65, 0xB7, 0x81, 0xD0, 0x6D, 0x97, 0xD8, 0x87, 0x1B, 0x96,
+    0x10, 0x77, 0x33, 0x7B, 0x14, 0x5D, 0x44, 0xD5, 0x3D, 0x63, 0x66, 0x72,
+    0x68, 0x61, 0xF0, 0x15, 0xA5, 0x25, 0xB3, 0x37, 0xD3, 0x9D, 0x0D, 0x19,
+    0xD2, 0x8D, 0x38, 0xD1, 0xD0, 0xAD, 0x36, 0xD4, 0x61, 0x3D, 0x05, 0xF0,
+    0x5C, 0xBA, 0xD1, 0x67, 0x1D, 0x81, 0xD7, 0x2D, 0x64, 0x32, 0xCC, 0x77,
+    0xE4, 0x0D, 0xCE, 0x50, 0x55, 0x55, 0x51, 0x36, 0x56, 0x31, 0xE9, 0x0A,
+    0x5D, 0x3D, 0x06, 0xE2, 0x05, 0xD2, 0xBD, 0x06, 0x1A, 0x6A, 0x1E, 0x2C,
+    0x4C, 0x1A, 0x6A, 0x1E, 0xD1, 0x03, 0x5C, 0x56, 0x6A, 0x67, 0x5A, 0x58,
+    0x76, 0x79, 0xD5, 0xBD, 0x4C, 0xD1, 0xD2, 0xCD, 0x58, 0xA0, 0x1A, 0x8A,
+    0x1E, 0x2C, 0x6C, 0x1A, 0x8A, 0x45, 0xD1, 0x53, 0xF0, 0x45, 0xC5, 0x4F,
+    0x05, 0x5A, 0x5A, 0x69, 0x5B, 0x58, 0x5C, 0x67, 0x56, 0xF0, 0x75, 0x65,
+    0xD1, 0x64, 0x5D, 0x35, 0x45, 0xD3, 0x62, 0x6D, 0x45, 0x25, 0xD5, 0x61,
+    0x59, 0xF0, 0xAA, 0xD7, 0x9B, 0xF0, 0xB8, 0xBF, 0x0C, 0x6C, 0x1A, 0x6A,
+    0x1E, 0x2C, 0x4C, 0x1A, 0x6A, 0x35, 0xD2, 0x44, 0x55, 0x55, 0x44, 0x54,
+    0x65, 0x44, 0x54, 0x64, 0x54, 0x54, 0x73, 0x54, 0x53, 0x83, 0x55, 0x43,
+    0x83, 0x55, 0x52, 0x92, 0x52, 0xF0, 0x35, 0x1A, 0x24, 0x65, 0x14, 0x2A,
+    0x3F, 0x03, 0xA2, 0xA7, 0x92, 0xA3, 0xF0, 0x48, 0x49, 0x78, 0x48, 0x4E,
+    0x20, 0x47, 0x67, 0x86, 0x86, 0x95, 0x86, 0x40, 0x18, 0x78, 0x2E, 0x2A,
+    0x5A, 0x28, 0x78, 0x56, 0x76, 0x86, 0x65, 0xA6, 0x45, 0xC6, 0x25, 0xD0,
+    0xD0, 0xD1, 0xBD, 0x39, 0x9E, 0x20, 0x97, 0xD5, 0x9D, 0x3B, 0xD1, 0x62,
+    0x5C, 0x63, 0x6A, 0x65, 0x68, 0x67, 0x67, 0x68, 0x55, 0x96, 0x91, 0xE2,
+    0xB4, 0xB1, 0x96, 0x91, 0x18, 0x88, 0x1E, 0x2A, 0x6A, 0x18, 0x88, 0x46,
+    0x86, 0x76, 0x75, 0x95, 0x65, 0xB5, 0x46, 0xB6, 0x35, 0xD0, 0x61, 0x5D,
+    0x2B, 0xD3, 0x9D, 0x48, 0xD6, 0x79, 0xE6, 0x0B, 0x5D, 0x4D, 0x06, 0xE2,
+    0x06, 0xD2, 0xCD, 0x06, 0xE4, 0x1D, 0x61, 0xF0, 0x15, 0x76, 0x35, 0x66,
+    0x45, 0x56, 0x55, 0x46, 0x73, 0x46, 0xD1, 0x7D, 0x16, 0xD1, 0x6D, 0x16,
+    0xD1, 0x6D, 0x17, 0x63, 0x56, 0x65, 0x36, 0x75, 0x26, 0x85, 0x16, 0x9C,
+    0x95, 0xE4, 0x0D, 0x80, 0x09, 0x1E, 0x2D, 0x61, 0xED, 0xD5, 0x59, 0x1E,
+    0x2D, 0x61, 0x12, 0xD4, 0x4D, 0x3F, 0x5D, 0x2F, 0x01, 0x5D, 0x26, 0xD2,
+    0x5D, 0x26, 0xCF, 0x03, 0x5C, 0xF0, 0x45, 0xBF, 0x05, 0x5A, 0xF0, 0x65,
+    0x9F, 0x07, 0x58, 0xF0, 0x85, 0x7F, 0x09, 0x5D, 0x26, 0xD2, 0x5D, 0x26,
+    0xD2, 0x5D, 0x26, 0x3F, 0x0C, 0x53, 0xF0, 0xD0, 0x52, 0xF0, 0xD1, 0x51,
+    0xF0, 0xD2, 0x5F, 0xD3, 0x40, 0x19, 0xE2, 0x0A, 0x19, 0xED, 0xD5, 0x51,
+    0x9E, 0x20, 0xA1, 0x90, 0x91, 0xD6, 0x2D, 0x44, 0xD2, 0x6D, 0x08, 0xBA,
+    0x9C, 0x8D, 0x06, 0x62, 0x65, 0x64, 0x63, 0x66, 0x61, 0x68, 0xBA, 0xAB,
+    0x41, 0x3D, 0x02, 0x10, 0xE4, 0x0D, 0xF0, 0x03, 0x64, 0x55, 0x56, 0x46,
+    0x55, 0x54, 0x62, 0x10, 0x79, 0xCD, 0x19, 0xD3, 0x8D, 0x48, 0xD4, 0xD5,
+    0x63, 0xF0, 0xD3, 0x5A, 0xD1, 0x8D, 0x36, 0xD5, 0x5D, 0x64, 0xD7, 0x47,
+    0x85, 0x36, 0xA5, 0x35, 0xB5, 0x35, 0x97, 0x36, 0x6B, 0x1D, 0xB1, 0xDA,
+    0x2D, 0x93, 0xC1, 0x76, 0x7C, 0x17, 0xD6, 0xE2, 0x8D, 0x77, 0xD6, 0xE2,
+    0x03, 0x5D, 0x95, 0x47, 0xB5, 0x1C, 0x9D, 0x77, 0xD8, 0x6D, 0x95, 0x96,
+    0x75, 0x7A, 0x64, 0x6C, 0x54, 0x6C, 0x6E, 0x43, 0x5D, 0x15, 0x36, 0xC6,
+    0x36, 0xC5, 0x47, 0xA6, 0x2B, 0x67, 0x2D, 0xC2, 0xDB, 0x3D, 0xA5, 0x72,
+    0xBD, 0x57, 0x80, 0x88, 0x32, 0x9D, 0x36, 0xD5, 0x5D, 0x64, 0xD7, 0x47,
+    0x67, 0x36, 0xA5, 0x35, 0xB5, 0x26, 0xC4, 0x25, 0xD0, 0x33, 0xE3, 0x5D,
+    0x66, 0xD6, 0x5D, 0x22, 0x26, 0xC5, 0x18, 0x87, 0x2D, 0x93, 0xD7, 0x5D,
+    0x57, 0xD3, 0xBA, 0x60, 0xD3, 0x73, 0xE2, 0x0D, 0x28, 0xD6, 0x73, 0xE2,
+    0x0D, 0x55, 0xB7, 0x35, 0x9B, 0x15, 0x7D, 0x66, 0xD7, 0x5D, 0x84, 0x85,
+    0x94, 0x69, 0x74, 0x5B, 0x63, 0x6B, 0x63, 0xE4, 0x5D, 0x05, 0x36, 0xB6,
+    0x45, 0xB6, 0x46, 0x97, 0x57, 0x6A, 0x3D, 0xB3, 0xDA, 0x4D, 0x96, 0xB1,
+    0x79, 0x6C, 0x87, 0xD2, 0xCA, 0xD2, 0x8D, 0x46, 0xD6, 0x48, 0x67, 0x36,
+    0xA6, 0x16, 0xC5, 0x15, 0xD0, 0x51, 0xE4, 0xDF, 0x01, 0xD6, 0x6D, 0x66,
+    0xD5, 0x88, 0x63, 0xD9, 0x3D, 0x84, 0xD6, 0x6D, 0x3B, 0x97, 0xA9, 0xBD,
+    0x08, 0xD2, 0x6D, 0x35, 0xD3, 0x66, 0xBE, 0x20, 0x55, 0xD0, 0xD4, 0x4E,
+    0x2D, 0x64, 0xD4, 0x4E, 0xA0, 0x55, 0xD0, 0xD4, 0x4E, 0x2D, 0x64, 0xD4,
+    0x40, 0x86, 0xD3, 0xB1, 0x75, 0xD8, 0x3D, 0x92, 0xDA, 0x18, 0x4B, 0x26,
+    0x87, 0x45, 0xA6, 0x36, 0xA6, 0x3E, 0x45, 0xC5, 0x36, 0xA6, 0x45, 0xA6,
+    0x46, 0x87, 0x48, 0x49, 0x5D, 0x76, 0xD6, 0x7D, 0x58, 0xB1, 0x5A, 0x73,
+    0x5D, 0x75, 0xD6, 0x6D, 0x57, 0x9D, 0x29, 0xD3, 0x9D, 0x2A, 0xD0, 0xD0,
+    0xA9, 0x17, 0xD5, 0xE2, 0x8D, 0x67, 0xD5, 0xE2, 0x03, 0x5D, 0x85, 0x46,
+    0xB5, 0x2A, 0x95, 0x1C, 0x5F, 0x03, 0xD6, 0x79, 0x56, 0x67, 0x85, 0x66,
+    0x95, 0x3E, 0x80, 0x35, 0xA5, 0x49, 0x69, 0x1E, 0x2B, 0x4B, 0x19, 0x69,
+    0x10, 0xE4, 0x75, 0x9E, 0x20, 0xDB, 0xA8, 0xE2, 0x02, 0xBB, 0xA8, 0xEA,
+    0x08, 0x59, 0xD6, 0x1E, 0x2D, 0x81, 0xD6, 0x10, 0xE4, 0x95, 0x3E, 0x20,
+    0xD5, 0xD3, 0xE2, 0x0D, 0x41, 0xD3, 0xED, 0x4C, 0x5B, 0x6A, 0x71, 0xD2,
+    0x1F, 0xD2, 0x2D, 0x05, 0xA6, 0x17, 0xD4, 0xE2, 0x8D, 0x57, 0xD4, 0xE3,
+    0x03, 0x5D, 0x75, 0x49, 0x4E, 0x20, 0x35, 0x3B, 0x65, 0x49, 0x75, 0x27,
+    0xB5, 0x17, 0xCC, 0xD0, 0xBD, 0x1A, 0xD2, 0xBD, 0x1C, 0xD0, 0xD0, 0xC5,
+    0x27, 0xB5, 0x37, 0xA5, 0x47, 0x77, 0x6A, 0x1E, 0x28, 0x5C, 0x17, 0x6A,
+    0x10, 0x3A, 0x8E, 0x20, 0x2B, 0xBA, 0x8E, 0xD6, 0x08, 0x59, 0xD6, 0x1E,
+    0x2D, 0x81, 0xD6, 0x10, 0xA4, 0x55, 0x86, 0x17, 0x28, 0x4F, 0x01, 0xDD,
+    0x4D, 0xE4, 0x83, 0x64, 0x55, 0x64, 0x64, 0x52, 0xE9, 0x03, 0x55, 0x55,
+    0x53, 0x84, 0x64, 0x61, 0xE2, 0xA3, 0x73, 0x71, 0x84, 0x64, 0x61, 0xB6,
+    0xA6, 0x2A, 0x67, 0x1C, 0x4F, 0x01, 0xD8, 0x59, 0x57, 0x57, 0x76, 0x56,
+    0x95, 0x2E, 0x80, 0x35, 0xA5, 0x39, 0x68, 0x1E, 0x2B, 0x4A, 0x19, 0x68,
+    0x10, 0x97, 0xD2, 0xD0, 0xBD, 0x28, 0xD6, 0x5D, 0x75, 0x85, 0x83, 0x79,
+    0x72, 0x6B, 0x61, 0x6D, 0x06, 0xE4, 0x05, 0xD2, 0xBD, 0x06, 0x15, 0xC6,
+    0x27, 0x97, 0x37, 0x68, 0x2F, 0x03, 0xD6, 0x8D, 0x2B, 0xD0, 0xD2, 0x79,
+    0xD0, 0x6B, 0x72, 0xB7, 0x81, 0xD0, 0x6D, 0xB4, 0xDC, 0x4B, 0x58, 0x67,
+    0x97, 0x56, 0xB6, 0x56, 0xC6, 0xE3, 0x45, 0xD1, 0x54, 0x5D, 0x06, 0x46,
+    0xC6, 0x47, 0xA6, 0x59, 0x68, 0x5D, 0x96, 0xD8, 0x7D, 0x78, 0x52, 0xBA,
+    0x54, 0x78, 0xE3, 0x04, 0x5D, 0x7C, 0xD2, 0xE2, 0xD1, 0xD2, 0xCD, 0x20,
+    0x96, 0xD6, 0xB2, 0x76, 0xD1, 0x18, 0x4D, 0xB3, 0xDC, 0x37, 0x6B, 0x37,
+    0x97, 0x55, 0xC6, 0x46, 0xC6, 0x4E, 0x35, 0xD1, 0x54, 0x6D, 0x05, 0x46,
+    0xC6, 0x56, 0xA7, 0x58, 0x69, 0x6D, 0x97, 0xD8, 0x8D, 0x7A, 0xB2, 0x5C,
+    0x74, 0x54, 0xE3, 0x0D, 0x65, 0xD6, 0xC1, 0xE2, 0x0D, 0x1D, 0x1D, 0x2C,
+    0x10, 0xD2, 0x56, 0x83, 0x93, 0x92, 0xB2, 0x91, 0xD0, 0x1D, 0xA2, 0xD1,
+    0x43, 0x69, 0xD2, 0x8D, 0x37, 0xD4, 0x6D, 0x0E, 0x60, 0x55, 0xD2, 0xD4,
+    0x6E, 0x2D, 0x66, 0xD4, 0x60, 0x68, 0x32, 0x6D, 0x34, 0xD4, 0x3D, 0x52,
+    0xD6, 0x26, 0x76, 0x25, 0x95, 0x26, 0x93, 0x3B, 0xAD, 0x27, 0xD3, 0x6D,
+    0x38, 0xD1, 0xCA, 0x13, 0xBA, 0xCA, 0xBC, 0x77, 0xF0, 0xD7, 0x1D, 0x63,
+    0xD3, 0xB8, 0x60, 0x53, 0xD2, 0xE4, 0x04, 0x5D, 0x2D, 0x54, 0xE2, 0xD7,
+    0x4D, 0x54, 0xE9, 0x04, 0x5D, 0x55, 0xA3, 0x56, 0x76, 0x4D, 0x65, 0xD5,
+    0x5D, 0x48, 0xD0, 0xC8, 0x60, 0x17, 0x78, 0x2E, 0x28, 0x69, 0x37, 0x78,
+    0x2E, 0x80, 0x35, 0xA5, 0x55, 0x96, 0x56, 0x77, 0x57, 0x59, 0x1F, 0x04,
+    0xD8, 0x5C, 0x17, 0x6A, 0x26, 0xA6, 0xA0, 0x1A, 0x6A, 0x1E, 0x2C, 0x4C,
+    0x1A, 0x6A, 0x55, 0xA5, 0x86, 0x95, 0x95, 0x85, 0xA6, 0x75, 0xB5, 0x65,
+    0xC6, 0x55, 0xD0, 0x54, 0x5D, 0x16, 0x35, 0xD2, 0x52, 0x5D, 0x36, 0x15,
+    0x8F, 0x09, 0xA9, 0xF0, 0xA8, 0xD8, 0x7D, 0x86, 0xB0, 0x18, 0xA8, 0x1E,
+    0x2A, 0x8A, 0x18, 0xA8, 0x45, 0x45, 0x45, 0x55, 0x36, 0x45, 0x55, 0x36,
+    0x36, 0x55, 0x37, 0x25, 0x75, 0x18, 0x25, 0x75, 0x18, 0x16, 0x75, 0x1D,
+    0x18, 0xD7, 0x99, 0x19, 0x98, 0x29, 0x98, 0x28, 0xA7, 0x47, 0xB6, 0x47,
+    0xB6, 0x56, 0xB5, 0x65, 0xC5, 0x74, 0x60, 0x28, 0x68, 0x2E, 0x20, 0x1A,
+    0x4A, 0x38, 0x68, 0x67, 0x47, 0x97, 0x27, 0xBD, 0x1D, 0x0C, 0xD2, 0x9D,
+    0x58, 0xD3, 0xBD, 0x1D, 0x0C, 0xD3, 0x97, 0x47, 0x77, 0x67, 0x49, 0x69,
+    0x1E, 0x2B, 0x4B, 0x19, 0x69, 0x10, 0x18, 0x88, 0x1E, 0x2A, 0x6A, 0x18,
+    0x88, 0x36, 0xB4, 0x65, 0xA5, 0x66, 0x85, 0x85, 0x85, 0x86, 0x65, 0xA5,
+    0x65, 0x5F, 0x06, 0x54, 0x5D, 0x05, 0x25, 0xD1, 0xC7, 0xF0, 0x8A, 0xD4,
+    0x8D, 0x57, 0xD7, 0x6D, 0x75, 0xD7, 0x6D, 0x75, 0xD7, 0x6D, 0x75, 0xD1,
+    0xD1, 0xBE, 0x2D, 0x3B, 0xD1, 0xB0, 0xE4, 0x0D, 0xB6, 0x71, 0x55, 0x64,
+    0x35, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x68, 0x31, 0x68, 0x4E,
+    0x40, 0xD6, 0x94, 0x96, 0x77, 0x68, 0x58, 0x66, 0x3E, 0x90, 0x55, 0x85,
+    0x68, 0x58, 0x67, 0x78, 0x78, 0x96, 0x4E, 0x70, 0x55, 0x96, 0x88, 0x1F,
+    0x06, 0x87, 0x79, 0x41, 0x13, 0x1E, 0xDF, 0x5E, 0x40, 0x51, 0x31, 0x14,
+    0x96, 0x87, 0x78, 0x77, 0x96, 0x5E, 0x90, 0x45, 0xA5, 0x98, 0x78, 0x77,
+    0x68, 0x58, 0x56, 0x4E, 0x70, 0x45, 0x86, 0x68, 0x5F, 0x86, 0x78, 0x49,
+    0x54, 0xD3, 0x8D, 0x0A, 0x63, 0x2C, 0x4D, 0x62, 0xC2, 0xD6, 0x4C, 0x23,
+    0x6A, 0xD1, 0x7D, 0x35, 0x40};
+
+const GFXglyph FreeMonoBold24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 28, 0, 1},          // 0x20 ' '
+    {0, 7, 31, 28, 10, -29},      // 0x21 '!'
+    {16, 15, 14, 28, 6, -28},     // 0x22 '"'
+    {25, 22, 34, 28, 3, -30},     // 0x23 '#'
+    {61, 19, 38, 28, 5, -31},     // 0x24 '$'
+    {107, 21, 30, 28, 4, -28},    // 0x25 '%'
+    {152, 21, 28, 28, 4, -26},    // 0x26 '&'
+    {196, 6, 14, 28, 11, -28},    // 0x27 '''
+    {202, 10, 37, 28, 12, -29},   // 0x28 '('
+    {230, 10, 37, 28, 6, -29},    // 0x29 ')'
+    {262, 21, 19, 28, 4, -28},    // 0x2A '*'
+    {291, 23, 26, 28, 3, -25},    // 0x2B '+'
+    {306, 9, 14, 28, 7, -6},      // 0x2C ','
+    {321, 24, 5, 28, 2, -15},     // 0x2D '-'
+    {327, 7, 6, 28, 11, -4},      // 0x2E '.'
+    {332, 20, 38, 28, 4, -32},    // 0x2F '/'
+    {382, 21, 31, 28, 4, -29},    // 0x30 '0'
+    {413, 20, 29, 28, 4, -28},    // 0x31 '1'
+    {435, 21, 30, 28, 3, -29},    // 0x32 '2'
+    {477, 21, 31, 28, 4, -29},    // 0x33 '3'
+    {517, 20, 28, 28, 4, -27},    // 0x34 '4'
+    {557, 21, 31, 28, 4, -29},    // 0x35 '5'
+    {594, 20, 31, 28, 5, -29},    // 0x36 '6'
+    {638, 20, 30, 28, 4, -29},    // 0x37 '7'
+    {669, 20, 31, 28, 4, -29},    // 0x38 '8'
+    {711, 20, 31, 28, 5, -29},    // 0x39 '9'
+    {756, 7, 22, 28, 11, -20},    // 0x3A ':'
+    {767, 10, 28, 28, 6, -20},    // 0x3B ';'
+    {789, 24, 21, 28, 2, -23},    // 0x3C '<'
+    {820, 24, 14, 28, 2, -19},    // 0x3D '='
+    {834, 23, 22, 28, 3, -23},    // 0x3E '>'
+    {864, 20, 29, 28, 5, -27},    // 0x3F '?'
+    {899, 19, 36, 28, 4, -28},    // 0x40 '@'
+    {965, 29, 27, 28, -1, -26},   // 0x41 'A'
+    {1012, 26, 27, 28, 1, -26},   // 0x42 'B'
+    {1055, 25, 29, 28, 2, -27},   // 0x43 'C'
+    {1097, 25, 27, 28, 1, -26},   // 0x44 'D'
+    {1134, 25, 27, 28, 1, -26},   // 0x45 'E'
+    {1174, 25, 27, 28, 1, -26},   // 0x46 'F'
+    {1209, 25, 29, 28, 2, -27},   // 0x47 'G'
+    {1254, 26, 27, 28, 1, -26},   // 0x48 'H'
+    {1281, 19, 27, 28, 5, -26},   // 0x49 'I'
+    {1296, 25, 28, 28, 3, -26},   // 0x4A 'J'
+    {1323, 27, 27, 28, 1, -26},   // 0x4B 'K'
+    {1371, 25, 27, 28, 2, -26},   // 0x4C 'L'
+    {1392, 31, 27, 28, -1, -26},  // 0x4D 'M'
+    {1451, 28, 27, 28, 0, -26},   // 0x4E 'N'
+    {1505, 27, 29, 28, 1, -27},   // 0x4F 'O'
+    {1551, 24, 27, 28, 1, -26},   // 0x50 'P'
+    {1587, 27, 35, 28, 1, -27},   // 0x51 'Q'
+    {1645, 28, 27, 28, 0, -26},   // 0x52 'R'
+    {1693, 22, 29, 28, 3, -27},   // 0x53 'S'
+    {1740, 25, 27, 28, 2, -26},   // 0x54 'T'
+    {1760, 28, 28, 28, 0, -26},   // 0x55 'U'
+    {1786, 30, 27, 28, -1, -26},  // 0x56 'V'
+    {1834, 28, 27, 28, 0, -26},   // 0x57 'W'
+    {1892, 26, 27, 28, 1, -26},   // 0x58 'X'
+    {1936, 26, 27, 28, 1, -26},   // 0x59 'Y'
+    {1972, 21, 27, 28, 4, -26},   // 0x5A 'Z'
+    {2008, 10, 37, 28, 12, -29},  // 0x5B '['
+    {2018, 20, 38, 28, 4, -32},   // 0x5C '\'
+    {2069, 10, 37, 28, 6, -29},   // 0x5D ']'
+    {2080, 20, 15, 28, 4, -29},   // 0x5E '^'
+    {2104, 28, 5, 28, 0, 5},      // 0x5F '_'
+    {2107, 9, 8, 28, 8, -30},     // 0x60 '`'
+    {2116, 24, 23, 28, 2, -21},   // 0x61 'a'
+    {2153, 27, 31, 28, 0, -29},   // 0x62 'b'
+    {2199, 24, 23, 28, 3, -21},   // 0x63 'c'
+    {2236, 26, 31, 28, 2, -29},   // 0x64 'd'
+    {2282, 24, 23, 28, 2, -21},   // 0x65 'e'
+    {2314, 22, 30, 28, 4, -29},   // 0x66 'f'
+    {2341, 25, 31, 28, 2, -21},   // 0x67 'g'
+    {2389, 26, 30, 28, 1, -29},   // 0x68 'h'
+    {2425, 21, 29, 28, 4, -28},   // 0x69 'i'
+    {2444, 17, 38, 28, 5, -28},   // 0x6A 'j'
+    {2465, 25, 30, 28, 2, -29},   // 0x6B 'k'
+    {2509, 21, 30, 28, 4, -29},   // 0x6C 'l'
+    {2524, 30, 22, 28, -1, -21},  // 0x6D 'm'
+    {2555, 25, 22, 28, 1, -21},   // 0x6E 'n'
+    {2581, 25, 23, 28, 2, -21},   // 0x6F 'o'
+    {2616, 28, 31, 28, 0, -21},   // 0x70 'p'
+    {2664, 28, 31, 28, 1, -21},   // 0x71 'q'
+    {2713, 24, 22, 28, 3, -21},   // 0x72 'r'
+    {2741, 21, 23, 28, 4, -21},   // 0x73 's'
+    {2775, 23, 28, 28, 1, -26},   // 0x74 't'
+    {2801, 25, 22, 28, 1, -20},   // 0x75 'u'
+    {2827, 28, 21, 28, 0, -20},   // 0x76 'v'
+    {2865, 28, 21, 28, 0, -20},   // 0x77 'w'
+    {2911, 26, 21, 28, 1, -20},   // 0x78 'x'
+    {2946, 26, 30, 28, 1, -20},   // 0x79 'y'
+    {2994, 19, 21, 28, 5, -20},   // 0x7A 'z'
+    {3014, 14, 37, 28, 7, -29},   // 0x7B '{'
+    {3040, 5, 36, 28, 12, -28},   // 0x7C '|'
+    {3047, 14, 37, 28, 8, -29},   // 0x7D '}'
+    {3072, 22, 10, 28, 3, -17}};  // 0x7E '~'
+
+const GFXpackedFont FreeMonoBold24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeMonoBold24pt7bRLEBitmaps,
+     (GFXglyph *)FreeMonoBold24pt7bRLEGlyphs, 0x20, 0x7E, 47},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 3762 bytes, glyph bitmaps 3089 bytes (6797 uncompressed)
@@ -0,0 +1,376 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeSansBold24pt7bRLEBitmaps[] PROGMEM = {
+    0xED, 0x00, 0x7E, 0x61, 0x51, 0xE2, 0x02, 0x32, 0xE2, 0x07, 0xE6, 0x70,
+    0xE6, 0x07, 0x47, 0xE2, 0x15, 0x65, 0x1F, 0x02, 0x38, 0x32, 0xE3, 0x85,
+    0x55, 0xB5, 0x45, 0x4F, 0x07, 0x55, 0x54, 0xE4, 0x01, 0xDC, 0xF6, 0x55,
+    0x5B, 0x54, 0x56, 0xE3, 0x05, 0x55, 0x56, 0xE4, 0xDB, 0x65, 0x45, 0x8E,
+    0x30, 0x35, 0x55, 0xB5, 0x45, 0x9E, 0x20, 0x25, 0x55, 0x90, 0xFA, 0x3D,
+    0x6A, 0xD0, 0xD1, 0xAD, 0x47, 0xD6, 0x5D, 0x84, 0x71, 0x32, 0x92, 0x72,
+    0x33, 0x82, 0x63, 0x34, 0x8F, 0x16, 0x33, 0x57, 0x16, 0x33, 0xD0, 0x72,
+    0x3D, 0x08, 0x13, 0xD1, 0xBD, 0x1C, 0xD1, 0xD1, 0xCD, 0x3B, 0xD3, 0xBD,
+    0x2C, 0xD1, 0xB3, 0x29, 0xB3, 0x39, 0xA3, 0x48, 0xE2, 0x07, 0x33, 0x5D,
+    0x13, 0x34, 0x81, 0x72, 0x34, 0x72, 0x81, 0x32, 0x93, 0xD8, 0x4D, 0x76,
+    0xD5, 0x9D, 0x1D, 0x09, 0x9E, 0x30, 0xA3, 0xC0, 0x65, 0xD2, 0x4D, 0x09,
+    0xD0, 0x4C, 0xCA, 0x4C, 0xD0, 0xA4, 0xBD, 0x28, 0x4C, 0x55, 0x58, 0x4B,
+    0x57, 0x56, 0x4C, 0x49, 0x46, 0x4C, 0xF4, 0x94, 0x54, 0xD0, 0x57, 0x54,
+    0x4D, 0x25, 0x55, 0x54, 0xD2, 0xD2, 0x44, 0xD4, 0xD0, 0x54, 0xD5, 0xB5,
+    0x4D, 0x79, 0x55, 0xD9, 0x57, 0x4D, 0xF0, 0x64, 0x75, 0xDA, 0x45, 0x94,
+    0xF0, 0xD3, 0x44, 0xD0, 0xD4, 0x44, 0xD2, 0xD3, 0x43, 0x65, 0x5D, 0x24,
+    0x45, 0x75, 0xD1, 0x44, 0x49, 0x4F, 0xD0, 0x45, 0x49, 0x4C, 0x46, 0x57,
+    0x5C, 0x47, 0x55, 0x5C, 0x48, 0xD2, 0xC4, 0x9D, 0x0C, 0x4A, 0xCC, 0x5C,
+    0x9D, 0x04, 0xD2, 0x56, 0xA6, 0xD9, 0x9D, 0x7B, 0xD5, 0xD0, 0xD3, 0xD2,
+    0xD1, 0x82, 0x6A, 0xE2, 0x04, 0x74, 0x5D, 0x18, 0x35, 0xD2, 0x72, 0x5D,
+    0x3D, 0x1D, 0x4C, 0xD6, 0xAD, 0x88, 0xD8, 0x8D, 0x7B, 0x65, 0x7D, 0x05,
+    0x55, 0xD2, 0x55, 0x49, 0x26, 0x36, 0x47, 0x56, 0x26, 0x38, 0x5D, 0x04,
+    0x77, 0xC4, 0x78, 0xB4, 0x78, 0xA5, 0x79, 0x95, 0x88, 0x86, 0x96, 0xA6,
+    0x94, 0xC5, 0xDC, 0x6D, 0xC6, 0xD3, 0x18, 0x6D, 0x13, 0x86, 0xC5, 0x79,
+    0x7D, 0x20, 0xE6, 0x07, 0xE2, 0x15, 0x1F, 0x02, 0x32, 0x84, 0x85, 0x1F,
+    0x06, 0x57, 0x57, 0x67, 0x54, 0xF0, 0x36, 0x75, 0x5F, 0x02, 0x65, 0xE3,
+    0x01, 0x66, 0xEA, 0x68, 0x57, 0xE2, 0x01, 0x68, 0x56, 0xF0, 0x26, 0x85,
+    0x86, 0x85, 0x86, 0x3F, 0x05, 0x53, 0xF0, 0x65, 0x95, 0x94, 0x10, 0x14,
+    0x95, 0x7F, 0x02, 0x56, 0xF0, 0x35, 0x5F, 0x04, 0x58, 0x68, 0x53, 0xF0,
+    0x56, 0x2E, 0x30, 0x66, 0x1E, 0xA0, 0x76, 0x75, 0x1E, 0x20, 0x66, 0x75,
+    0x2F, 0x05, 0x67, 0x57, 0x67, 0x57, 0x67, 0x57, 0x67, 0x57, 0x67, 0x57,
+    0x58, 0xE3, 0x63, 0x72, 0x33, 0x32, 0x1F, 0xD2, 0x2C, 0x65, 0x5F, 0x04,
+    0x77, 0x41, 0x43, 0xF0, 0x24, 0x34, 0x61, 0x51, 0x40, 0xE7, 0x95, 0x9E,
+    0x5D, 0xAE, 0x79, 0x59, 0xE6, 0x07, 0xE2, 0x43, 0x34, 0x33, 0x16, 0x15,
+    0x23, 0x40, 0xE5, 0x0D, 0x00, 0xE6, 0x07, 0xA3, 0x94, 0xE2, 0x93, 0x1E,
+    0x20, 0x83, 0x94, 0x2E, 0x20, 0x73, 0x3E, 0x20, 0x63, 0x94, 0x4F, 0x05,
+    0x39, 0x45, 0xE2, 0x04, 0x36, 0xE2, 0x03, 0x39, 0x47, 0xE2, 0x02, 0x38,
+    0xE2, 0x01, 0x39, 0x49, 0x3A, 0x88, 0xD1, 0xCA, 0xD3, 0x4F, 0x03, 0xD5,
+    0x5D, 0x74, 0x84, 0x83, 0x86, 0x81, 0xE2, 0x01, 0x78, 0x71, 0xEC, 0x7A,
+    0x7E, 0x21, 0x78, 0x72, 0x86, 0x83, 0x84, 0x84, 0xD7, 0x2F, 0x03, 0xD5,
+    0x7D, 0x3A, 0xCD, 0x18, 0x80, 0xA4, 0xF9, 0x58, 0x67, 0x74, 0xAE, 0x30,
+    0xD1, 0xED, 0x97, 0x70, 0x78, 0xD0, 0xD0, 0x9D, 0x27, 0xD4, 0x5D, 0x63,
+    0xD8, 0x28, 0x58, 0x18, 0x7D, 0x28, 0x8E, 0x20, 0x79, 0x7F, 0xD3, 0x7D,
+    0x28, 0xD2, 0x7D, 0x28, 0xD1, 0x8D, 0x09, 0xD0, 0x9D, 0x08, 0xD0, 0x9D,
+    0x08, 0xD1, 0x8D, 0x18, 0xD1, 0x8D, 0x27, 0xD2, 0x7D, 0x1F, 0x02, 0xD8,
+    0xE3, 0x1D, 0x90, 0x78, 0xD0, 0xD0, 0x8D, 0x36, 0xD5, 0x3F, 0x01, 0xD7,
+    0x38, 0x49, 0x18, 0x68, 0x1E, 0x27, 0x87, 0xD3, 0x7D, 0x36, 0xD3, 0x7D,
+    0x27, 0xD0, 0x9D, 0x18, 0xD2, 0x9D, 0x1B, 0xD2, 0x9D, 0x37, 0xD3, 0x8E,
+    0x2D, 0x3D, 0x19, 0xD1, 0x8D, 0x37, 0x81, 0x85, 0x82, 0xD8, 0x2D, 0x74,
+    0xD5, 0x6D, 0x39, 0xD0, 0xC8, 0x80, 0xFB, 0x83, 0xF0, 0xA9, 0xCA, 0x3F,
+    0x08, 0xB3, 0xF0, 0x74, 0x17, 0x94, 0x27, 0x3F, 0x05, 0x43, 0x77, 0x44,
+    0x77, 0x35, 0x76, 0x45, 0x76, 0x36, 0x75, 0x46, 0x74, 0x47, 0x74, 0x38,
+    0x73, 0x48, 0x73, 0xE5, 0xD9, 0xE6, 0xC7, 0x30, 0xE3, 0x3D, 0x61, 0xF0,
+    0x2D, 0x71, 0xE2, 0x02, 0x5D, 0x54, 0xD5, 0x53, 0x69, 0x51, 0xB6, 0xD5,
+    0x5D, 0x64, 0xD7, 0x2D, 0x82, 0x76, 0x9D, 0x28, 0xD3, 0x8E, 0x5D, 0x3D,
+    0x09, 0xD2, 0x78, 0x18, 0x59, 0x1D, 0x83, 0xD7, 0x4D, 0x56, 0xD2, 0x9D,
+    0x0D, 0x07, 0x90, 0x88, 0xD0, 0xCA, 0xD2, 0x7D, 0x36, 0xD5, 0x4D, 0x73,
+    0x84, 0x82, 0x86, 0x71, 0xE2, 0x01, 0x7D, 0x27, 0xD3, 0x73, 0x67, 0x71,
+    0xA5, 0xD7, 0x3F, 0xD8, 0x2A, 0x48, 0x18, 0x77, 0x18, 0x78, 0xE3, 0x07,
+    0x97, 0xF1, 0x69, 0x71, 0x77, 0x81, 0x77, 0x73, 0x83, 0x93, 0xD6, 0x5D,
+    0x55, 0xD4, 0x7D, 0x2A, 0xCD, 0x07, 0x80, 0xE5, 0x0D, 0xAD, 0x36, 0xD3,
+    0x6D, 0x37, 0xD3, 0x6D, 0x36, 0xD3, 0x7D, 0x36, 0xD3, 0x7D, 0x36, 0xD3,
+    0x67, 0xF0, 0x97, 0xD3, 0x6D, 0x37, 0xD3, 0x69, 0xF0, 0x77, 0x9F, 0x07,
+    0x6A, 0xE2, 0x06, 0x7D, 0x36, 0xBE, 0x30, 0x57, 0xB0, 0x87, 0xD2, 0xCA,
+    0xD2, 0x8D, 0x44, 0xF0, 0x2D, 0x64, 0x85, 0x83, 0x78, 0x63, 0x69, 0x62,
+    0xF0, 0x16, 0xA5, 0x36, 0x96, 0x46, 0x85, 0x57, 0x57, 0x7D, 0x39, 0xD0,
+    0xAD, 0x37, 0xD5, 0x58, 0x48, 0x2F, 0x01, 0x78, 0x71, 0xE4, 0x7A, 0xD2,
+    0x8D, 0x38, 0x72, 0x85, 0x92, 0xD9, 0x3D, 0x75, 0xD5, 0x7D, 0x39, 0xD0,
+    0xD1, 0x88, 0x88, 0xD1, 0xCA, 0xD2, 0x8D, 0x46, 0xD6, 0x5D, 0x73, 0x94,
+    0x83, 0x77, 0x81, 0x88, 0x71, 0xF7, 0xA6, 0x1E, 0x37, 0xAD, 0x28, 0x81,
+    0x77, 0x91, 0x94, 0xA1, 0xDA, 0x2D, 0x93, 0xD8, 0x4C, 0x17, 0x5A, 0x27,
+    0x77, 0x36, 0xD5, 0x61, 0xF0, 0xD3, 0x72, 0x77, 0x73, 0x85, 0x83, 0xD7,
+    0x5D, 0x65, 0xD5, 0x7D, 0x3A, 0xCD, 0x18, 0x90, 0xE6, 0x07, 0xEA, 0x7E,
+    0x67, 0xE6, 0x07, 0xEA, 0x7E, 0x67, 0xE2, 0x43, 0x34, 0x24, 0x16, 0x15,
+    0x23, 0x40, 0xD9, 0x1D, 0x64, 0xD4, 0x6D, 0x19, 0xBC, 0x9D, 0x16, 0xD1,
+    0x6D, 0x17, 0xD0, 0x9B, 0xC8, 0xD2, 0x5D, 0x57, 0xD3, 0xAD, 0x0D, 0x0D,
+    0x0D, 0x0C, 0xD1, 0xCD, 0x1C, 0xCD, 0x0A, 0xD3, 0x7D, 0x64, 0xD9, 0x10,
+    0xE5, 0x0D, 0xAE, 0x5D, 0xAE, 0x5D, 0xA0, 0x01, 0xD9, 0x3D, 0x76, 0xD4,
+    0x9D, 0x1B, 0xCD, 0x1C, 0xD1, 0xCD, 0x0D, 0x0D, 0x0D, 0x0B, 0xD2, 0x8D,
+    0x46, 0xD2, 0x8C, 0xBA, 0xD0, 0x7D, 0x07, 0xD0, 0x7D, 0x18, 0xCB, 0x9D,
+    0x17, 0xD3, 0x4D, 0x61, 0xD9, 0x78, 0xD1, 0xD0, 0x9D, 0x46, 0xD6, 0x5D,
+    0x73, 0xD8, 0x38, 0x59, 0x27, 0x78, 0x18, 0x88, 0xE2, 0x07, 0xA7, 0xD4,
+    0x7D, 0x38, 0xD2, 0x8D, 0x29, 0xD1, 0x9D, 0x19, 0xD0, 0xAD, 0x19, 0xD1,
+    0x8D, 0x37, 0xD3, 0x79, 0xF0, 0x86, 0xAE, 0x20, 0xDB, 0xE6, 0x08, 0x79,
+    0xD6, 0x9D, 0xF0, 0x2D, 0x4D, 0xBD, 0x8D, 0x7D, 0xCD, 0x49, 0x8A, 0xD1,
+    0x8D, 0x18, 0xC8, 0xD4, 0x7A, 0x7D, 0x77, 0x87, 0xDA, 0x58, 0x6D, 0xC5,
+    0x66, 0xDD, 0x55, 0x6B, 0x63, 0x44, 0x54, 0x5A, 0x91, 0x55, 0x43, 0x68,
+    0xD4, 0x54, 0x35, 0x86, 0x47, 0x74, 0x16, 0x76, 0x66, 0x74, 0x15, 0x85,
+    0x85, 0x74, 0x15, 0x75, 0x94, 0x8A, 0x74, 0xA4, 0x89, 0x75, 0xA4, 0x89,
+    0x74, 0xB4, 0x89, 0x74, 0xB3, 0x8A, 0x65, 0xA4, 0x8A, 0x65, 0xA4, 0x84,
+    0x15, 0x65, 0xA3, 0x85, 0x15, 0x65, 0x94, 0x84, 0x26, 0x55, 0x85, 0x75,
+    0x35, 0x56, 0x66, 0x65, 0x45, 0x66, 0x48, 0x37, 0x46, 0x5D, 0xE6, 0x65,
+    0xC1, 0xC7, 0x75, 0xA3, 0x9A, 0x76, 0x67, 0x5D, 0x07, 0xDF, 0x09, 0x7D,
+    0xF0, 0x98, 0xDF, 0x08, 0xAC, 0x2D, 0x7D, 0xBD, 0x8D, 0x9D, 0xAD, 0x6D,
+    0xFB, 0xD3, 0xE2, 0xC9, 0xBE, 0x20, 0xBB, 0xAF, 0x0A, 0xD0, 0xD6, 0x61,
+    0x69, 0xF0, 0x97, 0x17, 0xD4, 0x63, 0x68, 0xF0, 0x87, 0x37, 0xD1, 0x75,
+    0x6D, 0x17, 0x57, 0xD0, 0x66, 0x76, 0xF0, 0x67, 0x77, 0xB6, 0x87, 0xA7,
+    0x97, 0x4F, 0x05, 0xDA, 0x4F, 0x04, 0xDC, 0x6D, 0xD6, 0xDE, 0x57, 0xD0,
+    0x74, 0x7D, 0x17, 0x2F, 0x02, 0x7D, 0x27, 0x27, 0xD3, 0x71, 0xF0, 0x17,
+    0xD4, 0x70, 0x0D, 0x68, 0xD9, 0x5D, 0xA4, 0xDB, 0x3F, 0xDC, 0x27, 0xA9,
+    0x17, 0xB8, 0x1E, 0x27, 0xC7, 0x17, 0xB7, 0x27, 0xA8, 0x2D, 0xB3, 0xDA,
+    0x4D, 0x86, 0xDA, 0x4D, 0xB3, 0xDC, 0x27, 0xB8, 0x17, 0xC7, 0x1E, 0x47,
+    0xD0, 0xD1, 0xCD, 0x2B, 0x81, 0xDD, 0x1F, 0xDC, 0x2D, 0xB3, 0xD9, 0x5D,
+    0x68, 0xB9, 0xD5, 0xD2, 0xD1, 0xD5, 0xAD, 0x88, 0xDA, 0x7D, 0xB5, 0xA6,
+    0x94, 0x9A, 0x83, 0x8B, 0x82, 0x8D, 0x07, 0x28, 0xD1, 0x71, 0x7D, 0x27,
+    0x17, 0xD9, 0xE9, 0x7D, 0xB7, 0xD9, 0xF0, 0x17, 0xD2, 0x71, 0x8D, 0x08,
+    0x28, 0xC7, 0x39, 0xA8, 0x4A, 0x69, 0x6D, 0xB6, 0xDA, 0x8D, 0x8B, 0xD5,
+    0xD0, 0xD2, 0xD5, 0x9A, 0x0D, 0x5A, 0xD8, 0x7D, 0x96, 0xDA, 0x5D, 0xB4,
+    0xDC, 0x37, 0x9A, 0x27, 0xB8, 0x2F, 0x7C, 0x81, 0xF7, 0xD0, 0x71, 0xE9,
+    0x7D, 0x17, 0xF0, 0x7D, 0x07, 0x1F, 0x7C, 0x81, 0x7B, 0x82, 0x79, 0xA2,
+    0xDC, 0x3D, 0xB4, 0xDA, 0x5D, 0x96, 0xD8, 0x7D, 0x5A, 0xE5, 0x0D, 0xB1,
+    0xE6, 0x7D, 0x5E, 0x5D, 0xA2, 0xE8, 0x7D, 0x5E, 0x5D, 0xC0, 0xE5, 0x0D,
+    0xBE, 0x60, 0x7D, 0x4E, 0x5D, 0x92, 0xED, 0x17, 0xD4, 0xC9, 0xD6, 0xD2,
+    0xD1, 0xD6, 0xBD, 0x89, 0xDA, 0x7D, 0xC5, 0xA7, 0xA4, 0x8B, 0x83, 0x8D,
+    0x07, 0x37, 0xD2, 0x71, 0x8D, 0x27, 0xF1, 0x7D, 0xAE, 0x27, 0xDB, 0xE5,
+    0x7B, 0xD8, 0xD4, 0x6F, 0x17, 0xD4, 0x61, 0x8D, 0x27, 0x28, 0xD1, 0x72,
+    0x9C, 0x83, 0x9A, 0x93, 0xB5, 0xC4, 0xDE, 0x5D, 0x71, 0x56, 0xD6, 0x24,
+    0x7D, 0x43, 0x49, 0xD0, 0x54, 0xC8, 0xB0, 0xEC, 0x07, 0xD0, 0x7E, 0x50,
+    0xDE, 0xED, 0x10, 0x7D, 0x07, 0xED, 0xF0, 0x7E, 0x40, 0x70, 0xED, 0x8D,
+    0x27, 0xE4, 0x07, 0x8D, 0x26, 0xD4, 0x49, 0xF1, 0xD7, 0x3D, 0x55, 0xD3,
+    0x7D, 0x1B, 0x87, 0x07, 0xD0, 0x82, 0x7C, 0x83, 0x7B, 0x84, 0x7A, 0x85,
+    0x79, 0x95, 0x78, 0x96, 0x78, 0x87, 0x77, 0x88, 0x76, 0x89, 0x75, 0x8A,
+    0x74, 0x8B, 0x73, 0x8C, 0x72, 0x8D, 0x07, 0x18, 0xD1, 0xD2, 0xD2, 0xFD,
+    0x3D, 0x1D, 0x4D, 0x0D, 0x5C, 0xA1, 0x8B, 0x93, 0x8A, 0x84, 0x8A, 0x76,
+    0x89, 0x77, 0x88, 0x78, 0x87, 0x78, 0x96, 0x79, 0x86, 0x7A, 0x85, 0x7B,
+    0x84, 0x7B, 0x93, 0x7C, 0x83, 0x7D, 0x08, 0x27, 0xD1, 0x81, 0x7D, 0x19,
+    0xED, 0xE0, 0x7D, 0x3E, 0x5D, 0xA0, 0xE3, 0x0B, 0xBD, 0x9A, 0xCE, 0x30,
+    0xC9, 0xDC, 0x7D, 0x0E, 0x20, 0x71, 0x57, 0x51, 0xD1, 0x15, 0x66, 0x1D,
+    0x11, 0x65, 0x52, 0x7E, 0x20, 0x72, 0x55, 0x52, 0xD1, 0x26, 0x35, 0x37,
+    0xE2, 0x07, 0x35, 0x35, 0x3D, 0x13, 0x62, 0x53, 0x7E, 0x30, 0x74, 0x51,
+    0x54, 0xD1, 0x4A, 0x57, 0xE3, 0x07, 0x59, 0x57, 0xF0, 0x76, 0x76, 0x70,
+    0x07, 0xD1, 0xD2, 0xD0, 0x7F, 0x09, 0xC7, 0xF0, 0xAB, 0xD5, 0xA7, 0xF0,
+    0xC9, 0x7F, 0x0D, 0x08, 0xD1, 0x16, 0x7D, 0x11, 0x76, 0xD1, 0x26, 0x6D,
+    0x12, 0x75, 0xD1, 0x36, 0x5D, 0x14, 0x64, 0xD1, 0x47, 0x3D, 0x15, 0x63,
+    0xD1, 0x57, 0x2D, 0x16, 0x62, 0xD1, 0x76, 0x1D, 0x17, 0xD1, 0xF0, 0x78,
+    0xD7, 0x9C, 0xF0, 0x7A, 0xBF, 0x07, 0xBD, 0x4C, 0x9F, 0x07, 0xD0, 0xD2,
+    0xD1, 0x70, 0xC9, 0xD8, 0xD2, 0xD3, 0xD5, 0xD1, 0xD8, 0xBD, 0xA9, 0xDC,
+    0x7A, 0x7A, 0x68, 0xA9, 0x58, 0xD0, 0x84, 0x7D, 0x27, 0x38, 0xD2, 0x81,
+    0xF0, 0x17, 0xD4, 0x71, 0x8D, 0x48, 0xE7, 0x07, 0xD6, 0xD2, 0xD4, 0x8F,
+    0x17, 0xD4, 0x72, 0x8D, 0x28, 0x37, 0xD2, 0x74, 0x8D, 0x08, 0x58, 0xB8,
+    0x6A, 0x7A, 0x7D, 0xC9, 0xDA, 0xBD, 0x8D, 0x0D, 0x6D, 0x3D, 0x2D, 0x89,
+    0xC0, 0x0D, 0x67, 0xD9, 0x4D, 0xA3, 0xDB, 0x2F, 0xDC, 0x17, 0x99, 0x17,
+    0xB8, 0xE5, 0x07, 0xCD, 0x1B, 0xD2, 0x99, 0x1D, 0xC1, 0xFD, 0xB2, 0xDA,
+    0x3D, 0x85, 0xD6, 0x7E, 0xB7, 0xD6, 0xC9, 0xD8, 0xD2, 0xD3, 0xD5, 0xD1,
+    0xD8, 0xBD, 0xA9, 0xDC, 0x7A, 0x7A, 0x68, 0xB8, 0x58, 0xD0, 0x84, 0x7D,
+    0x27, 0x38, 0xD2, 0x81, 0xF0, 0x17, 0xD4, 0x71, 0x8D, 0x48, 0xE7, 0x07,
+    0xD6, 0xD2, 0xC1, 0x48, 0x17, 0xB3, 0x37, 0x27, 0xA5, 0x27, 0x28, 0x8D,
+    0x23, 0x79, 0xD0, 0x48, 0x9C, 0x58, 0x9A, 0x6A, 0x7A, 0x7D, 0xD8, 0xDD,
+    0x8D, 0xD8, 0xDD, 0x9D, 0x22, 0x6D, 0x09, 0x64, 0xDF, 0x02, 0x23, 0x0D,
+    0x87, 0xDA, 0x5F, 0xDC, 0x3F, 0xDD, 0x27, 0xB9, 0x17, 0xC8, 0x1E, 0x47,
+    0xD0, 0x71, 0x7C, 0x72, 0x7B, 0x82, 0xDC, 0x3D, 0xB4, 0xD9, 0x6D, 0xA5,
+    0xDB, 0x4D, 0xC3, 0x7A, 0x83, 0xE9, 0x7C, 0x72, 0x7C, 0x81, 0x7D, 0x08,
+    0x8A, 0xD3, 0xD2, 0xBD, 0x68, 0xD8, 0x6D, 0xA4, 0xDC, 0x39, 0x6A, 0x28,
+    0xA9, 0x17, 0xC8, 0x1F, 0x7D, 0x07, 0x17, 0xD8, 0x8D, 0x7A, 0xD6, 0xD0,
+    0xD2, 0xD5, 0xBD, 0x79, 0xD8, 0x9D, 0x8A, 0xD6, 0xD1, 0xD1, 0xD6, 0xAF,
+    0xD7, 0x8D, 0x87, 0xF0, 0x7D, 0x1D, 0x1D, 0x0D, 0x3C, 0x72, 0x98, 0x92,
+    0xDD, 0x3D, 0xB5, 0xD9, 0x7D, 0x7A, 0xD3, 0xD2, 0xA9, 0xE5, 0x0D, 0xEE,
+    0xDE, 0xA7, 0xA0, 0xED, 0xC0, 0x7D, 0x0D, 0x2B, 0x81, 0x89, 0x82, 0x97,
+    0x91, 0xF0, 0x2D, 0xA5, 0xD8, 0x7D, 0x6A, 0xD2, 0xD2, 0x99, 0xF0, 0x7D,
+    0x27, 0xE2, 0x17, 0xD0, 0x73, 0x7C, 0x62, 0xF0, 0x27, 0xB7, 0x57, 0xA6,
+    0x67, 0x97, 0x76, 0x97, 0x76, 0x96, 0x87, 0x77, 0x96, 0x77, 0x96, 0x76,
+    0xA7, 0x66, 0xB6, 0x57, 0xB6, 0x56, 0xC7, 0x46, 0x6E, 0x20, 0x76, 0x36,
+    0xD2, 0x62, 0x58, 0xF0, 0x86, 0x16, 0x8E, 0x20, 0x9B, 0x9E, 0x20, 0xA9,
+    0xAE, 0x20, 0xB7, 0xB0, 0xF0, 0x8A, 0x7A, 0x81, 0x79, 0x8A, 0x71, 0xF0,
+    0x17, 0x99, 0x97, 0x37, 0x89, 0x88, 0x37, 0x89, 0x87, 0x47, 0x7B, 0x77,
+    0x47, 0x75, 0x15, 0x77, 0x56, 0x75, 0x15, 0x76, 0x3F, 0x03, 0x76, 0x51,
+    0x56, 0x77, 0x65, 0x62, 0x55, 0x73, 0xF0, 0x46, 0x55, 0x35, 0x56, 0x87,
+    0x45, 0x35, 0x47, 0x96, 0x45, 0x45, 0x36, 0xA6, 0x36, 0x45, 0x36, 0xA6,
+    0x35, 0x55, 0x36, 0xB6, 0x25, 0x55, 0x36, 0xB6, 0x25, 0x55, 0x26, 0xC6,
+    0x25, 0x65, 0x16, 0xC6, 0x15, 0x75, 0x16, 0xD0, 0x51, 0x57, 0x51, 0x6D,
+    0x0B, 0x75, 0x15, 0xD1, 0xB7, 0xBD, 0x2A, 0x8A, 0x7E, 0x20, 0x89, 0x99,
+    0xD4, 0x8A, 0x8D, 0x48, 0xA7, 0xD5, 0x7B, 0x7D, 0x66, 0xB7, 0x90, 0x18,
+    0xC8, 0x29, 0xA8, 0x48, 0xA8, 0x58, 0x88, 0x68, 0x87, 0x88, 0x68, 0x88,
+    0x58, 0xA8, 0x48, 0xB7, 0x38, 0xC8, 0x27, 0xD1, 0x71, 0x8D, 0x2D, 0x1D,
+    0x3D, 0x0D, 0x5C, 0xD5, 0xBD, 0x79, 0xD9, 0x8D, 0x89, 0xD8, 0xAD, 0x6B,
+    0xD6, 0xCD, 0x4D, 0x1D, 0x2D, 0x2D, 0x27, 0x18, 0xD0, 0x73, 0x8B, 0x84,
+    0x7B, 0x75, 0x89, 0x86, 0x87, 0x87, 0x87, 0x88, 0x85, 0x89, 0x85, 0x8A,
+    0x83, 0x8B, 0x91, 0x9C, 0x81, 0x08, 0xD0, 0xD3, 0xC8, 0x28, 0xB8, 0x28,
+    0xA8, 0x48, 0x98, 0x57, 0x97, 0x67, 0x88, 0x77, 0x77, 0x87, 0x68, 0x97,
+    0x57, 0xA7, 0x48, 0x5F, 0x06, 0x73, 0x76, 0xF0, 0x77, 0x17, 0x7F, 0x08,
+    0xD0, 0xD4, 0xBD, 0x5A, 0xD7, 0x9A, 0xED, 0x00, 0xB7, 0xB0, 0xE5, 0x0D,
+    0xDD, 0x58, 0xD4, 0x8D, 0x48, 0xD4, 0x8D, 0x49, 0xD4, 0x8D, 0x48, 0xD4,
+    0x8D, 0x48, 0xD4, 0x9D, 0x48, 0xD4, 0x8D, 0x48, 0xD4, 0x8D, 0x49, 0xD4,
+    0x8D, 0x48, 0xD4, 0x8D, 0x48, 0xD4, 0x9D, 0x48, 0xD4, 0x8D, 0x4E, 0x5D,
+    0xD0, 0xE4, 0x0B, 0xED, 0xF0, 0x74, 0xE3, 0x74, 0xE4, 0xB0, 0x03, 0xB4,
+    0xAF, 0x01, 0x3B, 0x49, 0xF0, 0x23, 0xB4, 0x8F, 0x03, 0x3B, 0x47, 0xE2,
+    0x04, 0x37, 0xE2, 0x05, 0x36, 0xE2, 0x06, 0x35, 0xE2, 0x07, 0x3B, 0x43,
+    0xF0, 0x83, 0xB4, 0x2F, 0x09, 0x3B, 0x41, 0xF0, 0xA3, 0xB4, 0xB3, 0xE4,
+    0x0B, 0xED, 0xF4, 0x7E, 0x34, 0x7E, 0x40, 0xB0, 0x86, 0x8F, 0x07, 0x78,
+    0xF0, 0x69, 0xD0, 0xA6, 0xF0, 0x55, 0x15, 0xA6, 0x16, 0x95, 0x35, 0x95,
+    0x36, 0x76, 0x45, 0x75, 0x55, 0x66, 0x56, 0x55, 0x75, 0x55, 0x76, 0x36,
+    0x85, 0x35, 0x95, 0x35, 0x96, 0x15, 0xB5, 0x10, 0xE3, 0x0D, 0xF0, 0x06,
+    0x45, 0x55, 0x54, 0x64, 0x63, 0x64, 0x79, 0xCD, 0x19, 0xD4, 0x6D, 0x64,
+    0xD7, 0x4D, 0x83, 0x76, 0x83, 0x68, 0x7D, 0x47, 0xD3, 0x8D, 0x1A, 0x8D,
+    0x35, 0xD6, 0x4D, 0x73, 0x95, 0x72, 0x87, 0x72, 0x78, 0x72, 0xF7, 0x78,
+    0x28, 0x59, 0x2D, 0x92, 0xF0, 0x1D, 0x84, 0xC1, 0x84, 0x94, 0x85, 0x6D,
+    0x00, 0xE8, 0x07, 0xD5, 0x74, 0x68, 0x72, 0xA6, 0x71, 0xD0, 0x4F, 0xD9,
+    0x3D, 0xA2, 0xA5, 0x91, 0x97, 0x81, 0x89, 0x71, 0x89, 0x8E, 0x50, 0x7B,
+    0xD2, 0x9D, 0x39, 0x71, 0x97, 0x81, 0xA5, 0x91, 0xDA, 0x2F, 0xD9, 0x37,
+    0x1D, 0x04, 0x72, 0xAD, 0x46, 0x80, 0x88, 0xD0, 0xD0, 0x8D, 0x36, 0xD5,
+    0x2F, 0x02, 0xD7, 0x29, 0x58, 0x18, 0x77, 0x17, 0x96, 0xE7, 0x07, 0xD4,
+    0x79, 0x61, 0x87, 0x71, 0x95, 0x8F, 0x2D, 0x74, 0xD5, 0x6D, 0x39, 0xD0,
+    0xC8, 0x70, 0xE8, 0xD5, 0x78, 0x64, 0x76, 0xA2, 0x74, 0xD0, 0x17, 0xF3,
+    0xD9, 0x2D, 0xA1, 0x95, 0xA1, 0x87, 0x91, 0x79, 0xD3, 0x98, 0xE5, 0x07,
+    0xBD, 0x29, 0x81, 0x79, 0x81, 0x87, 0x91, 0x95, 0xAF, 0x2D, 0xA3, 0xD9,
+    0x4D, 0x01, 0x76, 0xA2, 0x78, 0x6B, 0x87, 0xD2, 0xBB, 0xD2, 0x8D, 0x46,
+    0xD6, 0x58, 0x47, 0x48, 0x76, 0x37, 0x86, 0x37, 0x95, 0x2F, 0x7A, 0x61,
+    0xE3, 0xDA, 0x1E, 0x27, 0xD5, 0x79, 0x71, 0x78, 0x73, 0x85, 0x83, 0xD7,
+    0x5D, 0x57, 0xD3, 0xAC, 0xD1, 0x88, 0x77, 0x59, 0xF4, 0xA3, 0xB3, 0x83,
+    0xE3, 0x03, 0x74, 0xE3, 0xD0, 0x1E, 0xD6, 0x03, 0x74, 0x85, 0x47, 0x5A,
+    0x27, 0x4C, 0x17, 0x3D, 0x01, 0x7F, 0x2D, 0x91, 0x94, 0xA1, 0x86, 0x91,
+    0x78, 0xD3, 0x88, 0xE5, 0x07, 0xAD, 0x19, 0xD3, 0x88, 0x18, 0x69, 0x19,
+    0x4A, 0xF2, 0xD9, 0x3D, 0x84, 0xC1, 0x75, 0xA2, 0x77, 0x64, 0x7E, 0x2D,
+    0x47, 0x17, 0x88, 0x17, 0x78, 0x29, 0x49, 0x3D, 0x75, 0xD5, 0x7D, 0x2C,
+    0x98, 0xE8, 0x07, 0xD3, 0x74, 0x75, 0x73, 0xA3, 0x71, 0xD0, 0x27, 0x1D,
+    0x11, 0xD9, 0x1D, 0xF0, 0x54, 0xD4, 0x7D, 0x38, 0x7E, 0xD2, 0x07, 0x97,
+    0xE5, 0x07, 0xE2, 0x7E, 0xDB, 0x70, 0xE5, 0x37, 0xE2, 0xAE, 0xDF, 0x03,
+    0x73, 0x7E, 0x20, 0xAF, 0x09, 0x17, 0x30, 0xE8, 0x07, 0xD3, 0x78, 0x71,
+    0x77, 0x72, 0x76, 0x82, 0x75, 0x83, 0x74, 0x84, 0x74, 0x75, 0x73, 0x76,
+    0x72, 0x77, 0x71, 0x78, 0xD1, 0x9F, 0xD2, 0x8D, 0x37, 0xD4, 0x69, 0x17,
+    0x68, 0x28, 0x57, 0x47, 0x57, 0x57, 0x47, 0x58, 0x37, 0x67, 0x37, 0x68,
+    0x27, 0x77, 0x27, 0x78, 0x17, 0x87, 0x17, 0x88, 0xED, 0xF0, 0x7E, 0x40,
+    0x70, 0x07, 0x46, 0x86, 0x57, 0x2A, 0x4A, 0x37, 0x1C, 0x2C, 0x2F, 0xDF,
+    0x07, 0x1D, 0xF0, 0xD4, 0x5A, 0x4D, 0x37, 0x86, 0x7E, 0xD3, 0x07, 0x87,
+    0x77, 0x07, 0x47, 0x57, 0x2B, 0x37, 0x1D, 0x02, 0xFD, 0x91, 0xDF, 0x05,
+    0x4D, 0x47, 0x8E, 0xD3, 0x07, 0x97, 0x98, 0xD1, 0xD0, 0xBD, 0x38, 0xD5,
+    0x6D, 0x74, 0xD8, 0x39, 0x59, 0x28, 0x78, 0x27, 0x97, 0x18, 0x98, 0xE5,
+    0x07, 0xBD, 0x29, 0x81, 0x79, 0x72, 0x87, 0x82, 0x95, 0x93, 0xD8, 0x5D,
+    0x76, 0xD5, 0x8D, 0x3A, 0xD0, 0xD2, 0x88, 0x07, 0x46, 0x87, 0x2A, 0x67,
+    0x1D, 0x04, 0x71, 0xD1, 0x3D, 0x93, 0xDA, 0x2A, 0x59, 0x19, 0x78, 0x18,
+    0x97, 0x18, 0x98, 0xE5, 0x07, 0xBD, 0x29, 0xD3, 0x97, 0x19, 0x78, 0x1A,
+    0x58, 0x2D, 0xA2, 0xD9, 0x3F, 0x71, 0xD0, 0x47, 0x2A, 0x67, 0x46, 0x8E,
+    0x97, 0xD5, 0x86, 0x47, 0x6A, 0x27, 0xF4, 0xD0, 0x17, 0x3D, 0x92, 0xDA,
+    0x19, 0x5A, 0x18, 0x79, 0x17, 0x9D, 0x39, 0x8E, 0x50, 0x7B, 0xD2, 0x98,
+    0x17, 0x98, 0x18, 0x79, 0x19, 0x5A, 0x2D, 0xA3, 0xD9, 0x3D, 0x11, 0x74,
+    0xD0, 0x17, 0x6A, 0x27, 0x86, 0x47, 0xE9, 0xD5, 0x70, 0x07, 0x4B, 0x35,
+    0xF0, 0x71, 0x7F, 0x0D, 0xC5, 0xF8, 0x7E, 0xD2, 0x78, 0x88, 0xD0, 0xD1,
+    0x9D, 0x46, 0xD6, 0x4D, 0x73, 0x86, 0x81, 0xF0, 0x17, 0x87, 0x29, 0xD2,
+    0xD0, 0xBD, 0x39, 0xD5, 0x7D, 0x67, 0xD5, 0xAD, 0x1D, 0x0C, 0xD2, 0x9D,
+    0x4D, 0x1A, 0x71, 0x79, 0x71, 0x86, 0x82, 0xD9, 0x3D, 0x75, 0xD5, 0x7D,
+    0x3B, 0xA7, 0xE6, 0x27, 0x3E, 0x3C, 0xED, 0x22, 0x73, 0xF0, 0x2A, 0x39,
+    0x48, 0x57, 0xED, 0x30, 0x79, 0xD1, 0x8D, 0x37, 0xD4, 0x4D, 0xF0, 0x51,
+    0xD9, 0x1D, 0x11, 0x72, 0xD0, 0x17, 0x3B, 0x27, 0x57, 0xB0, 0x17, 0xA7,
+    0x17, 0xA6, 0x27, 0x97, 0x36, 0x97, 0x37, 0x86, 0x47, 0x77, 0x56, 0x77,
+    0x2F, 0x03, 0x76, 0x67, 0x65, 0x77, 0x74, 0x64, 0xF0, 0x56, 0x46, 0x96,
+    0x36, 0x5F, 0x06, 0x62, 0x6B, 0x61, 0x66, 0xF0, 0x7C, 0xD0, 0xB7, 0xF0,
+    0x8A, 0xD2, 0x9D, 0x48, 0xD4, 0x79, 0x06, 0x87, 0x7D, 0x17, 0x77, 0xD1,
+    0x77, 0x76, 0x26, 0x69, 0x66, 0x26, 0x69, 0x57, 0x27, 0x59, 0x57, 0x27,
+    0x59, 0x56, 0x46, 0x54, 0x14, 0x56, 0x46, 0x45, 0x15, 0x37, 0x47, 0x35,
+    0x15, 0x36, 0x3F, 0x03, 0x63, 0x51, 0x53, 0x66, 0x62, 0x53, 0x43, 0x66,
+    0x62, 0x53, 0x51, 0x64, 0xF0, 0x46, 0x15, 0x35, 0x16, 0x86, 0x14, 0x45,
+    0x15, 0x5E, 0x20, 0x5A, 0x5A, 0xA9, 0x69, 0xC8, 0x69, 0xC8, 0x78, 0xC8,
+    0x77, 0xD1, 0x77, 0x77, 0x08, 0x88, 0x18, 0x68, 0x37, 0x67, 0x48, 0x48,
+    0x57, 0x47, 0x77, 0x27, 0x87, 0x18, 0x9D, 0x15, 0xF0, 0x6C, 0xD0, 0xA7,
+    0xF0, 0x88, 0xD2, 0x9D, 0x2A, 0xD0, 0xCB, 0xD0, 0xBD, 0x19, 0x72, 0x77,
+    0x82, 0x77, 0x74, 0x75, 0x84, 0x83, 0x86, 0x73, 0x77, 0x81, 0x88, 0x80,
+    0xF1, 0x7A, 0x71, 0x7A, 0x63, 0x79, 0x63, 0x78, 0x73, 0x78, 0x65, 0x77,
+    0x65, 0x76, 0x76, 0x66, 0x63, 0xF0, 0x47, 0x56, 0x3F, 0x05, 0x64, 0x69,
+    0x73, 0x64, 0xF0, 0x66, 0x26, 0xB7, 0x16, 0xC6, 0x15, 0x6F, 0x07, 0xC6,
+    0xE2, 0x08, 0xA7, 0xF0, 0x98, 0xD5, 0x78, 0xE2, 0x0A, 0x6D, 0x56, 0xD5,
+    0x7A, 0xF0, 0x4A, 0xD2, 0x9D, 0x38, 0xD4, 0x6D, 0x20, 0xE5, 0x1D, 0x7C,
+    0x9B, 0x9C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+    0x8C, 0xE5, 0xD8, 0x76, 0x67, 0xF5, 0x84, 0x94, 0x63, 0xEC, 0x04, 0x57,
+    0x64, 0x85, 0xF7, 0x68, 0x86, 0x4E, 0xB0, 0x45, 0x86, 0x79, 0xF5, 0x86,
+    0x77, 0x60, 0xED, 0xF0, 0x4E, 0xD1, 0x04, 0x06, 0x77, 0x6F, 0x85, 0x97,
+    0x64, 0xEC, 0x04, 0x58, 0x68, 0x8F, 0x67, 0x58, 0x46, 0x3E, 0xB0, 0x45,
+    0x76, 0x49, 0x4F, 0x85, 0x76, 0x67, 0x35, 0xD1, 0x9C, 0xA7, 0xD3, 0x48,
+    0x4D, 0x37, 0xAC, 0x8D, 0x25, 0x30};
+
+const GFXglyph FreeSansBold24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 13, 0, 1},          // 0x20 ' '
+    {0, 7, 34, 16, 5, -33},       // 0x21 '!'
+    {12, 18, 12, 22, 2, -33},     // 0x22 '"'
+    {22, 26, 33, 26, 0, -31},     // 0x23 '#'
+    {58, 25, 40, 26, 1, -34},     // 0x24 '$'
+    {128, 39, 34, 42, 1, -32},    // 0x25 '%'
+    {220, 30, 35, 34, 3, -33},    // 0x26 '&'
+    {290, 7, 12, 12, 3, -33},     // 0x27 '''
+    {297, 13, 44, 16, 2, -33},    // 0x28 '('
+    {335, 13, 44, 16, 1, -33},    // 0x29 ')'
+    {373, 15, 15, 18, 1, -33},    // 0x2A '*'
+    {393, 23, 22, 27, 2, -21},    // 0x2B '+'
+    {400, 7, 15, 12, 2, -6},      // 0x2C ','
+    {410, 13, 6, 16, 1, -15},     // 0x2D '-'
+    {413, 7, 7, 12, 2, -6},       // 0x2E '.'
+    {415, 13, 34, 13, 0, -32},    // 0x2F '/'
+    {449, 24, 35, 26, 1, -33},    // 0x30 '0'
+    {485, 14, 33, 26, 4, -32},    // 0x31 '1'
+    {496, 23, 34, 26, 2, -33},    // 0x32 '2'
+    {543, 23, 35, 26, 2, -33},    // 0x33 '3'
+    {594, 22, 33, 26, 2, -32},    // 0x34 '4'
+    {632, 23, 34, 26, 2, -32},    // 0x35 '5'
+    {675, 23, 35, 26, 2, -33},    // 0x36 '6'
+    {727, 23, 33, 26, 1, -32},    // 0x37 '7'
+    {765, 24, 35, 26, 1, -33},    // 0x38 '8'
+    {818, 24, 35, 26, 1, -33},    // 0x39 '9'
+    {872, 7, 25, 12, 2, -24},     // 0x3A ':'
+    {877, 7, 33, 12, 2, -24},     // 0x3B ';'
+    {890, 23, 23, 27, 2, -22},    // 0x3C '<'
+    {924, 23, 18, 27, 2, -19},    // 0x3D '='
+    {931, 23, 23, 27, 2, -22},    // 0x3E '>'
+    {965, 24, 35, 29, 3, -34},    // 0x3F '?'
+    {1008, 43, 41, 46, 1, -34},   // 0x40 '@'
+    {1130, 32, 34, 33, 0, -33},   // 0x41 'A'
+    {1190, 27, 34, 33, 4, -33},   // 0x42 'B'
+    {1237, 30, 36, 34, 2, -34},   // 0x43 'C'
+    {1288, 28, 34, 34, 4, -33},   // 0x44 'D'
+    {1329, 25, 34, 31, 4, -33},   // 0x45 'E'
+    {1342, 24, 34, 30, 4, -33},   // 0x46 'F'
+    {1353, 31, 36, 36, 2, -34},   // 0x47 'G'
+    {1411, 27, 34, 35, 4, -33},   // 0x48 'H'
+    {1421, 7, 34, 15, 4, -33},    // 0x49 'I'
+    {1426, 22, 35, 27, 1, -33},   // 0x4A 'J'
+    {1443, 30, 34, 34, 4, -33},   // 0x4B 'K'
+    {1512, 23, 34, 29, 4, -33},   // 0x4C 'L'
+    {1518, 33, 34, 41, 4, -33},   // 0x4D 'M'
+    {1572, 28, 34, 35, 4, -33},   // 0x4E 'N'
+    {1634, 33, 36, 37, 2, -34},   // 0x4F 'O'
+    {1693, 26, 34, 32, 4, -33},   // 0x50 'P'
+    {1722, 33, 37, 37, 2, -34},   // 0x51 'Q'
+    {1787, 28, 34, 34, 4, -33},   // 0x52 'R'
+    {1824, 28, 36, 32, 2, -34},   // 0x53 'S'
+    {1881, 27, 34, 30, 2, -33},   // 0x54 'T'
+    {1887, 27, 35, 35, 4, -33},   // 0x55 'U'
+    {1906, 29, 34, 31, 1, -33},   // 0x56 'V'
+    {1960, 43, 34, 45, 1, -33},   // 0x57 'W'
+    {2063, 30, 34, 32, 1, -33},   // 0x58 'X'
+    {2129, 29, 34, 30, 1, -33},   // 0x59 'Y'
+    {2170, 26, 34, 29, 1, -33},   // 0x5A 'Z'
+    {2209, 11, 43, 16, 3, -33},   // 0x5B '['
+    {2218, 14, 34, 13, -1, -32},  // 0x5C '\'
+    {2255, 11, 43, 16, 1, -33},   // 0x5D ']'
+    {2264, 22, 20, 27, 3, -32},   // 0x5E '^'
+    {2300, 28, 4, 26, -1, 6},     // 0x5F '_'
+    {2303, 9, 7, 12, 1, -35},     // 0x60 '`'
+    {2310, 24, 26, 27, 2, -24},   // 0x61 'a'
+    {2353, 25, 35, 29, 3, -33},   // 0x62 'b'
+    {2394, 23, 26, 26, 2, -24},   // 0x63 'c'
+    {2426, 25, 35, 29, 2, -33},   // 0x64 'd'
+    {2466, 24, 26, 27, 2, -24},   // 0x65 'e'
+    {2502, 14, 34, 16, 1, -33},   // 0x66 'f'
+    {2517, 24, 36, 29, 2, -24},   // 0x67 'g'
+    {2569, 23, 34, 28, 3, -33},   // 0x68 'h'
+    {2592, 7, 34, 13, 3, -33},    // 0x69 'i'
+    {2598, 10, 45, 13, 0, -33},   // 0x6A 'j'
+    {2611, 23, 34, 27, 3, -33},   // 0x6B 'k'
+    {2660, 7, 34, 13, 3, -33},    // 0x6C 'l'
+    {2665, 36, 25, 42, 3, -24},   // 0x6D 'm'
+    {2689, 23, 25, 29, 3, -24},   // 0x6E 'n'
+    {2706, 25, 26, 29, 2, -24},   // 0x6F 'o'
+    {2743, 25, 36, 29, 3, -24},   // 0x70 'p'
+    {2786, 25, 36, 29, 2, -24},   // 0x71 'q'
+    {2829, 15, 25, 18, 3, -24},   // 0x72 'r'
+    {2841, 24, 26, 26, 1, -24},   // 0x73 's'
+    {2882, 12, 32, 16, 2, -30},   // 0x74 't'
+    {2894, 23, 26, 29, 3, -24},   // 0x75 'u'
+    {2914, 25, 25, 25, 0, -24},   // 0x76 'v'
+    {2958, 35, 25, 37, 1, -24},   // 0x77 'w'
+    {3028, 24, 25, 26, 1, -24},   // 0x78 'x'
+    {3072, 25, 36, 26, 0, -24},   // 0x79 'y'
+    {3129, 21, 25, 24, 1, -24},   // 0x7A 'z'
+    {3147, 13, 43, 18, 2, -33},   // 0x7B '{'
+    {3170, 4, 44, 13, 5, -33},    // 0x7C '|'
+    {3175, 13, 43, 18, 3, -33},   // 0x7D '}'
+    {3198, 21, 8, 23, 1, -14}};   // 0x7E '~'
+
+const GFXpackedFont FreeSansBold24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeSansBold24pt7bRLEBitmaps,
+     (GFXglyph *)FreeSansBold24pt7bRLEGlyphs, 0x20, 0x7E, 56},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 3883 bytes, glyph bitmaps 3210 bytes (8143 uncompressed)
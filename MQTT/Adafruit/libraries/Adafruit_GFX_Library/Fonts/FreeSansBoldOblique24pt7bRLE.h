@@ -0,0 +1,477 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeSansBoldOblique24pt7bRLEBitmaps[] PROGMEM = {
+    0x74, 0x3F, 0x07, 0x76, 0x8E, 0x36, 0x71, 0xE3, 0x05, 0x72, 0xE2, 0x05,
+    0x63, 0xE2, 0x05, 0x54, 0xE2, 0x04, 0x55, 0xE2, 0x04, 0x4A, 0x37, 0xF0,
+    0xD1, 0xE4, 0x01, 0x76, 0xF7, 0x70, 0xE2, 0x16, 0x56, 0xE3, 0x06, 0x56,
+    0x1F, 0x56, 0x52, 0xF4, 0x74, 0x33, 0x83, 0x40, 0xFD, 0x05, 0x55, 0x1F,
+    0x0C, 0x55, 0x52, 0xF0, 0xB5, 0x55, 0xD0, 0x55, 0x59, 0xDB, 0xF4, 0xDC,
+    0xF4, 0xDB, 0x95, 0x55, 0xD1, 0x54, 0x57, 0xF0, 0x75, 0x55, 0x7F, 0x06,
+    0x55, 0x5D, 0x15, 0x45, 0xAD, 0xB4, 0xDC, 0x4E, 0x2D, 0xB5, 0xF0, 0x35,
+    0x55, 0xBF, 0x02, 0x55, 0x5C, 0xF0, 0x15, 0x55, 0xD1, 0x54, 0x5D, 0x15,
+    0x55, 0xD1, 0x55, 0x4D, 0x20, 0xE2, 0xD3, 0x3D, 0x6A, 0xD0, 0xD2, 0xAD,
+    0x48, 0xD5, 0x7D, 0x75, 0x72, 0x32, 0x75, 0x63, 0x33, 0x65, 0x54, 0x33,
+    0x64, 0x64, 0x33, 0x64, 0x63, 0x43, 0x64, 0x63, 0x3D, 0x17, 0x23, 0xD1,
+    0x81, 0x3D, 0x1C, 0xD2, 0xCD, 0x2D, 0x0D, 0x0D, 0x2D, 0x0D, 0x1D, 0x1C,
+    0xD2, 0xCD, 0x13, 0x18, 0x3F, 0x0B, 0x32, 0x73, 0x73, 0x42, 0x73, 0x73,
+    0x33, 0x73, 0x73, 0x33, 0x64, 0x73, 0x32, 0x74, 0x82, 0x32, 0x74, 0x81,
+    0xC5, 0xF0, 0x1D, 0x68, 0xD3, 0xBD, 0x1D, 0x28, 0xCE, 0x20, 0x83, 0xD9,
+    0x4D, 0x93, 0xD3, 0x76, 0xD3, 0x48, 0xAD, 0x04, 0x8C, 0xB4, 0x8D, 0x0B,
+    0x38, 0xD2, 0x94, 0x76, 0x46, 0x84, 0x84, 0x84, 0x74, 0x85, 0x84, 0x73,
+    0x94, 0x94, 0x63, 0xA4, 0x85, 0x54, 0xA4, 0x84, 0x54, 0xB6, 0x46, 0x44,
+    0xCD, 0x25, 0x3D, 0x1D, 0x05, 0x4D, 0x1C, 0x54, 0xD3, 0xA5, 0x4D, 0x66,
+    0x73, 0xDF, 0x04, 0x37, 0x6D, 0x64, 0x5A, 0xD3, 0x45, 0xCD, 0x23, 0x5D,
+    0x0D, 0x13, 0x5D, 0x2C, 0x44, 0x64, 0x6B, 0x45, 0x48, 0x4A, 0x45, 0x58,
+    0x4A, 0x36, 0x49, 0x49, 0x46, 0x48, 0x58, 0x47, 0x48, 0x48, 0x48, 0x64,
+    0x68, 0x39, 0xD2, 0x83, 0xBD, 0x08, 0x4B, 0xC8, 0x4D, 0x0A, 0x84, 0xD3,
+    0x67, 0xD2, 0x6D, 0x8A, 0xD4, 0xD0, 0x5F, 0x0A, 0xD2, 0xD0, 0x72, 0x74,
+    0xF0, 0x87, 0x46, 0xC7, 0x45, 0xD0, 0x73, 0x6D, 0x08, 0x26, 0xD0, 0x81,
+    0x6D, 0x2D, 0x0D, 0x3C, 0xD5, 0xAD, 0x68, 0xD6, 0xAD, 0x4D, 0x05, 0x55,
+    0xD1, 0x55, 0x3D, 0x43, 0x53, 0x93, 0x63, 0x53, 0x75, 0x71, 0x53, 0x77,
+    0xC3, 0x68, 0xB3, 0x79, 0xA3, 0x79, 0x94, 0xF7, 0xA7, 0x58, 0x7A, 0x49,
+    0x5B, 0x5D, 0xC4, 0xDD, 0x4D, 0x32, 0x76, 0xC4, 0x87, 0x8D, 0x20, 0xE2,
+    0x16, 0xE3, 0x06, 0x1F, 0x52, 0xF4, 0x33, 0x40, 0xC5, 0xB5, 0xB5, 0xB6,
+    0xB5, 0xB5, 0xB6, 0xB5, 0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB6,
+    0x9F, 0x02, 0x5B, 0x6A, 0xE2, 0x01, 0x5B, 0x6B, 0xEA, 0x5D, 0x04, 0xCE,
+    0x30, 0x15, 0xBE, 0x20, 0x25, 0xD0, 0x4D, 0x05, 0x90, 0x95, 0xD0, 0x43,
+    0xE2, 0x0A, 0x5D, 0x04, 0x2E, 0x20, 0xB5, 0xD0, 0x41, 0xEA, 0x0C, 0x5E,
+    0x3B, 0x5B, 0x61, 0xF0, 0xA5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB6,
+    0xB5, 0xB5, 0xB6, 0xB5, 0xB5, 0xB6, 0xB5, 0xB5, 0xB5, 0xC0, 0x74, 0x4E,
+    0x20, 0x73, 0x63, 0x24, 0x32, 0x1D, 0xF0, 0x11, 0xD0, 0x1F, 0x04, 0x77,
+    0x86, 0x41, 0x54, 0x43, 0x44, 0x34, 0x45, 0x16, 0x15, 0xC5, 0x7F, 0x0B,
+    0x67, 0xF0, 0xB5, 0x8E, 0x20, 0xA6, 0x8E, 0x20, 0x1D, 0xA1, 0xD9, 0x1F,
+    0xDA, 0x1E, 0x20, 0x86, 0xAF, 0x08, 0x5B, 0xE2, 0x07, 0x6B, 0xF3, 0x73,
+    0x61, 0xE2, 0x02, 0x77, 0x31, 0xF0, 0x53, 0x64, 0x63, 0x54, 0x46, 0x44,
+    0x62, 0x80, 0xF1, 0xD0, 0xF1, 0xC1, 0xFD, 0x01, 0xE2, 0x17, 0x16, 0x1E,
+    0x27, 0x10, 0xD4, 0x3F, 0xD3, 0x31, 0xF0, 0xD2, 0x32, 0xF0, 0xD1, 0x33,
+    0xF0, 0xD0, 0x34, 0xF0, 0xC3, 0x5F, 0x0B, 0x36, 0xF0, 0xA3, 0x7F, 0x09,
+    0x38, 0xF0, 0x83, 0x9F, 0x07, 0x3A, 0xF0, 0x63, 0xBF, 0x05, 0x3C, 0xF0,
+    0x43, 0xD0, 0xF0, 0x33, 0xD1, 0xF0, 0x23, 0xD2, 0xF0, 0x13, 0xD3, 0x3D,
+    0x40, 0xC7, 0xD3, 0xBC, 0xD2, 0x9D, 0x38, 0xD5, 0x77, 0x38, 0x67, 0x58,
+    0x47, 0x77, 0x46, 0x87, 0xF3, 0x78, 0x73, 0x69, 0x7F, 0x27, 0x97, 0x26,
+    0x98, 0xE3, 0x17, 0x97, 0x27, 0x88, 0x1E, 0x27, 0x97, 0x2E, 0x27, 0x87,
+    0x37, 0x77, 0x48, 0x67, 0x49, 0x38, 0x5F, 0x01, 0xD5, 0x8D, 0x3A, 0xD0,
+    0xD0, 0xBD, 0x37, 0xC0, 0xC5, 0xFB, 0x5B, 0x69, 0x86, 0xB1, 0xF0, 0x1D,
+    0x12, 0xFD, 0x2A, 0x72, 0xF0, 0x86, 0x3E, 0x20, 0x77, 0xA6, 0x4E, 0x20,
+    0x67, 0x4F, 0x06, 0x65, 0xE2, 0x05, 0x75, 0xF0, 0x56, 0x6E, 0x20, 0x47,
+    0xA6, 0x7F, 0x03, 0x77, 0xD2, 0x8D, 0x5D, 0x0D, 0x1D, 0x4B, 0xD6, 0x9D,
+    0x78, 0x85, 0x97, 0x77, 0x86, 0x79, 0x7F, 0x66, 0xA7, 0x56, 0xB7, 0x56,
+    0xA7, 0xD9, 0x71, 0xF0, 0xD7, 0x7D, 0x78, 0xD7, 0x8D, 0x78, 0xD6, 0x9D,
+    0x5A, 0xD5, 0x9D, 0x59, 0xD5, 0xAD, 0x59, 0xD6, 0x9D, 0x68, 0xD7, 0x8D,
+    0x78, 0xD8, 0xD9, 0x5F, 0x01, 0xDA, 0x5F, 0xDB, 0x5D, 0xA6, 0xC9, 0xD2,
+    0xD0, 0xBD, 0x39, 0xD5, 0x7D, 0x76, 0x74, 0x95, 0x77, 0x7F, 0x56, 0x87,
+    0x46, 0x97, 0x46, 0x96, 0xD6, 0x7D, 0x57, 0xD4, 0x8D, 0x1B, 0xD2, 0xAD,
+    0x3B, 0x4F, 0x0B, 0xCD, 0x59, 0xD5, 0x82, 0xE3, 0x0D, 0x47, 0x27, 0x98,
+    0x27, 0x97, 0x37, 0x88, 0x39, 0x58, 0x4D, 0x95, 0xD7, 0x6D, 0x68, 0xD4,
+    0xBD, 0x0D, 0x28, 0xC0, 0xD4, 0x8D, 0x39, 0xD2, 0xAF, 0xD1, 0xAD, 0x1B,
+    0xD0, 0x41, 0x7C, 0x42, 0x7B, 0x52, 0x6B, 0x52, 0x7B, 0x43, 0x7A, 0x44,
+    0x79, 0x45, 0x69, 0x55, 0x68, 0x55, 0x77, 0x56, 0x76, 0x57, 0x76, 0x57,
+    0x66, 0x57, 0x75, 0x58, 0x75, 0xDA, 0x1F, 0xDB, 0x1F, 0xDA, 0xD2, 0x7D,
+    0x56, 0x6E, 0x20, 0xC7, 0x6F, 0x0C, 0x67, 0xE2, 0x9D, 0x58, 0xD6, 0x8D,
+    0x58, 0xD6, 0x1F, 0x07, 0x5D, 0x2E, 0x20, 0x65, 0xD8, 0x53, 0x6D, 0x0D,
+    0x3A, 0xD5, 0x5F, 0x04, 0xD6, 0x78, 0x49, 0x66, 0x78, 0x3E, 0x40, 0xD4,
+    0x7D, 0x67, 0x47, 0x97, 0x4F, 0x78, 0x75, 0x85, 0x86, 0xD8, 0x7D, 0x68,
+    0xD5, 0xAD, 0x3D, 0x0C, 0xD4, 0x8D, 0x00, 0xD0, 0x7D, 0x2C, 0xCD, 0x1A,
+    0xD3, 0x8D, 0x56, 0x74, 0x85, 0x67, 0x75, 0x68, 0x6F, 0x46, 0xD2, 0xF0,
+    0x36, 0xD5, 0x73, 0x69, 0x62, 0xA7, 0xD6, 0x4F, 0x01, 0xD8, 0x49, 0x49,
+    0x38, 0x68, 0x37, 0x87, 0x2F, 0x79, 0x72, 0x6A, 0x72, 0x6A, 0x63, 0xF6,
+    0x97, 0x36, 0x87, 0x47, 0x68, 0x48, 0x48, 0x6D, 0x66, 0xD5, 0x8D, 0x3A,
+    0xD1, 0xCB, 0xD3, 0x7C, 0xF2, 0xDB, 0xF2, 0xDA, 0x1F, 0x01, 0xDB, 0xD5,
+    0x7D, 0x57, 0xD5, 0x7D, 0x57, 0xD5, 0x7D, 0x57, 0xD5, 0x7D, 0x66, 0xD6,
+    0x6D, 0x66, 0xD6, 0x7D, 0x66, 0xD6, 0x6D, 0x67, 0xD6, 0x6D, 0x67, 0xD6,
+    0x6D, 0x67, 0xD6, 0x6D, 0x67, 0xD6, 0x6D, 0x67, 0xD6, 0x6D, 0x5F, 0x01,
+    0x7D, 0x66, 0xD6, 0x7D, 0x60, 0xD0, 0x7D, 0x3D, 0x0C, 0xD2, 0xAD, 0x48,
+    0xD6, 0x67, 0x58, 0x65, 0x87, 0x56, 0x96, 0xF5, 0x5A, 0x65, 0x59, 0x66,
+    0x58, 0x68, 0x65, 0x78, 0xD3, 0x4F, 0x07, 0xD1, 0xAD, 0x48, 0xD6, 0x68,
+    0x48, 0x57, 0x78, 0x46, 0x97, 0x37, 0x97, 0x36, 0xA7, 0x2F, 0x7A, 0x72,
+    0xF7, 0x97, 0x38, 0x77, 0x49, 0x49, 0x4D, 0x86, 0xD6, 0x8D, 0x58, 0xD3,
+    0xCD, 0x0D, 0x28, 0xC0, 0xC7, 0xD3, 0xBC, 0xD1, 0xAD, 0x38, 0xD5, 0x68,
+    0x47, 0x58, 0x67, 0x47, 0x86, 0xF3, 0x79, 0x63, 0x6A, 0x6F, 0x27, 0xA6,
+    0xF2, 0x79, 0x72, 0x78, 0x73, 0x86, 0x83, 0x94, 0x91, 0xF0, 0x3D, 0x85,
+    0xD6, 0x7A, 0x26, 0x96, 0x37, 0x2F, 0x0D, 0x36, 0x3F, 0x0D, 0x26, 0x47,
+    0x76, 0x58, 0x48, 0x5D, 0x67, 0xD4, 0x8D, 0x3A, 0xD1, 0xCC, 0xD2, 0x7D,
+    0x00, 0xE2, 0x57, 0x56, 0x1E, 0x20, 0x47, 0x1E, 0xA0, 0xCE, 0x20, 0x17,
+    0x56, 0x5E, 0x27, 0x50, 0xE2, 0x77, 0x76, 0x1E, 0x20, 0x67, 0x1E, 0xA0,
+    0xD1, 0xF0, 0x37, 0x76, 0x5E, 0x20, 0x27, 0xB3, 0x5F, 0x05, 0x3A, 0x4A,
+    0x39, 0x48, 0x68, 0x4A, 0x2C, 0xDC, 0x1D, 0x93, 0xD7, 0x6D, 0x49, 0xD1,
+    0xCB, 0xD2, 0x8D, 0x47, 0xD3, 0x7D, 0x39, 0xD1, 0xBC, 0xD1, 0x9D, 0x4B,
+    0xD2, 0xD0, 0xD0, 0xD3, 0xCD, 0x4C, 0xD3, 0xCD, 0x2D, 0x1C, 0xD3, 0xAD,
+    0x66, 0xD9, 0x4D, 0xC1, 0x50, 0xE3, 0x3D, 0xA3, 0xD9, 0x3D, 0xA1, 0xE5,
+    0x0D, 0xDF, 0x01, 0xDA, 0x3D, 0x93, 0xE2, 0xDA, 0x30, 0x51, 0xDC, 0x4D,
+    0x96, 0xD6, 0xAD, 0x3C, 0xD1, 0xD2, 0xCD, 0x3C, 0xD4, 0xCD, 0x3D, 0x0D,
+    0x0D, 0x2B, 0xD4, 0x9D, 0x1C, 0xBD, 0x19, 0xD3, 0x7D, 0x37, 0xD4, 0x8D,
+    0x2B, 0xCD, 0x19, 0xD4, 0x6D, 0x73, 0xD9, 0x1D, 0xC0, 0xA7, 0xD1, 0xD0,
+    0x9D, 0x37, 0xD5, 0x2F, 0x03, 0xD7, 0x38, 0x59, 0x27, 0x78, 0x17, 0x97,
+    0x16, 0xA7, 0xF0, 0x7A, 0x7F, 0xD3, 0x7D, 0x37, 0xD2, 0x9D, 0x19, 0xD1,
+    0x9D, 0x18, 0xD2, 0x8D, 0x27, 0xD3, 0x6D, 0x55, 0xD5, 0x6D, 0x55, 0xD0,
+    0xE2, 0x0D, 0xBE, 0x30, 0x47, 0xD0, 0xE2, 0x03, 0x7D, 0x10, 0xDB, 0xAD,
+    0xF0, 0x3D, 0x4D, 0xDD, 0x8D, 0x9D, 0xBD, 0x69, 0x8A, 0xD3, 0x8D, 0x18,
+    0xD1, 0x7D, 0x57, 0xC6, 0xD8, 0x79, 0x7D, 0xA6, 0x86, 0xDD, 0x57, 0x6D,
+    0xF5, 0x65, 0xC6, 0x35, 0x35, 0x55, 0xAA, 0x24, 0x54, 0x46, 0x8D, 0x55,
+    0x43, 0x68, 0x64, 0x86, 0x43, 0x58, 0x57, 0x67, 0x42, 0x58, 0x58, 0x67,
+    0x42, 0x57, 0x59, 0x58, 0x41, 0x58, 0x4A, 0x58, 0x32, 0x57, 0x5A, 0x48,
+    0x42, 0x57, 0x4B, 0x48, 0x42, 0x47, 0x5A, 0x48, 0x42, 0x57, 0x4B, 0x48,
+    0x42, 0x56, 0x5A, 0x48, 0x43, 0x56, 0x59, 0x57, 0x53, 0x56, 0x58, 0x57,
+    0x54, 0x56, 0x57, 0x66, 0x55, 0x56, 0x65, 0x83, 0x66, 0x56, 0xDE, 0x76,
+    0x6C, 0x1C, 0x95, 0x7A, 0x39, 0xB6, 0x76, 0x76, 0xD0, 0x7D, 0xF0, 0xB7,
+    0xDF, 0x0B, 0x7D, 0xF0, 0xA9, 0xDF, 0x09, 0xBB, 0x3D, 0x9D, 0xBD, 0x9D,
+    0xAD, 0xBD, 0x6D, 0xF0, 0x2B, 0xD8, 0xD6, 0x94, 0xF0, 0xD5, 0xA4, 0xF0,
+    0xD4, 0xB4, 0xF0, 0xD3, 0xCD, 0x6D, 0x0D, 0x5D, 0x2D, 0x47, 0x17, 0xD3,
+    0x72, 0x7D, 0x36, 0x37, 0xD2, 0x73, 0x7D, 0x26, 0x47, 0xD1, 0x74, 0x7D,
+    0x16, 0x57, 0xD0, 0x76, 0x72, 0xF0, 0x97, 0x77, 0xA7, 0x87, 0xA6, 0x97,
+    0x2F, 0x07, 0xDA, 0x8D, 0xC1, 0xF0, 0x5D, 0xD5, 0xDE, 0x57, 0xD0, 0x71,
+    0xF0, 0x37, 0xD1, 0x73, 0x7D, 0x27, 0x37, 0xD3, 0x71, 0x7D, 0x4D, 0x2D,
+    0x47, 0x7D, 0x6D, 0x0D, 0x9A, 0xDA, 0x2F, 0x06, 0xDC, 0x7D, 0xD6, 0x7B,
+    0x86, 0x7C, 0x7F, 0x57, 0xD0, 0x75, 0x7D, 0x06, 0x67, 0xC7, 0x58, 0xA8,
+    0x6D, 0xC7, 0xDB, 0x8D, 0xA9, 0xDB, 0x4F, 0x03, 0xDD, 0x67, 0xB9, 0x2F,
+    0x03, 0x7D, 0x07, 0x2E, 0x20, 0x27, 0xD1, 0x74, 0x7D, 0x07, 0x47, 0xD0,
+    0x84, 0x7C, 0x85, 0xDE, 0x5D, 0xD6, 0xDC, 0x6D, 0xC7, 0xDA, 0x9D, 0x7C,
+    0xD3, 0x8D, 0x8D, 0x1D, 0x3D, 0x4D, 0x0D, 0x7B, 0xD9, 0x9D, 0xB7, 0xA6,
+    0x96, 0x99, 0x94, 0x8C, 0x84, 0x7D, 0x17, 0x38, 0xD1, 0x73, 0x7D, 0x27,
+    0xF2, 0x7D, 0xB8, 0xDA, 0xE2, 0x01, 0x7D, 0xBE, 0x57, 0xDC, 0x7D, 0x36,
+    0x37, 0xD2, 0x73, 0x8D, 0x08, 0x38, 0xD0, 0x75, 0x8A, 0x95, 0xA6, 0xA7,
+    0xDB, 0x8D, 0xAA, 0xD8, 0xCD, 0x6D, 0x2D, 0x2D, 0x79, 0xD1, 0x7D, 0x5D,
+    0x1D, 0x7B, 0xDA, 0x3F, 0x06, 0xDB, 0x8D, 0xC7, 0x79, 0x96, 0x7B, 0x95,
+    0x7C, 0x8F, 0x57, 0xD0, 0x74, 0x8D, 0x07, 0xE3, 0x47, 0xD1, 0x73, 0x7D,
+    0x27, 0xE2, 0x37, 0xD1, 0x74, 0x7D, 0x08, 0x1F, 0x02, 0x7D, 0x17, 0x47,
+    0xD0, 0x75, 0x7C, 0x84, 0x7C, 0x85, 0x7B, 0x95, 0x79, 0xA6, 0xDC, 0x7D,
+    0xB7, 0xDB, 0x8D, 0xA9, 0xD8, 0xBD, 0x4D, 0x20, 0xF7, 0xDC, 0xE3, 0x6D,
+    0xC7, 0x7D, 0x6E, 0x40, 0x57, 0xDB, 0x7D, 0xCD, 0xB4, 0xF0, 0x4D, 0xA5,
+    0xE2, 0x03, 0xDB, 0x5F, 0x03, 0x7D, 0x9E, 0x40, 0x27, 0xDA, 0xF0, 0x17,
+    0xDB, 0xF0, 0x1D, 0xC6, 0xE2, 0xDD, 0x6D, 0xC7, 0x8D, 0xB7, 0xDC, 0xE3,
+    0x7D, 0xB1, 0xE4, 0x06, 0x7D, 0x6F, 0x05, 0x7D, 0x7F, 0x05, 0xD9, 0x9D,
+    0xA5, 0xE2, 0x04, 0xD9, 0xA7, 0xD8, 0xE4, 0x03, 0x7D, 0x9E, 0x30, 0x27,
+    0xDA, 0xE4, 0x01, 0x7D, 0xB0, 0xD3, 0x9D, 0x8D, 0x2D, 0x3D, 0x5D, 0x0D,
+    0x8B, 0xDA, 0x9D, 0xC7, 0xA7, 0x96, 0x9B, 0x84, 0x8D, 0x17, 0x47, 0xD2,
+    0x73, 0x7D, 0x37, 0x37, 0xDA, 0xF0, 0x27, 0xDB, 0xF0, 0x17, 0xDD, 0x7A,
+    0xD1, 0x26, 0xBD, 0x11, 0xE2, 0x7B, 0xD0, 0x27, 0xAD, 0x12, 0x7D, 0x56,
+    0x27, 0xD4, 0x63, 0x8D, 0x36, 0x38, 0xD2, 0x73, 0x8D, 0x18, 0x48, 0xC9,
+    0x49, 0xA9, 0x6A, 0x6B, 0x6D, 0xE7, 0xDD, 0x8D, 0x61, 0x59, 0xD3, 0x34,
+    0xCD, 0x04, 0x4D, 0x18, 0xD3, 0xE2, 0x77, 0xD1, 0x7F, 0x77, 0xD0, 0x71,
+    0xE2, 0x06, 0x7D, 0x17, 0x77, 0xD0, 0x77, 0x8D, 0x07, 0x2F, 0x05, 0x7D,
+    0x17, 0x77, 0xD0, 0x78, 0xDE, 0x3E, 0x20, 0x4D, 0xF3, 0xF0, 0x4D, 0xE4,
+    0xE2, 0x03, 0x7D, 0x17, 0x77, 0xD0, 0x75, 0xE2, 0x02, 0x7D, 0x17, 0x5F,
+    0x02, 0x7D, 0x07, 0x6E, 0x20, 0x17, 0xD1, 0x76, 0xF0, 0x17, 0xD0, 0x77,
+    0x7D, 0x17, 0x70, 0xF7, 0x7E, 0x46, 0x71, 0xE4, 0x05, 0x72, 0xE4, 0x04,
+    0x73, 0xE4, 0x03, 0x74, 0xE4, 0x02, 0x75, 0xE4, 0x01, 0x76, 0xF7, 0x70,
+    0xE2, 0xD7, 0x7E, 0x3D, 0x67, 0xD6, 0x81, 0xE3, 0x0D, 0x57, 0x2E, 0x40,
+    0xD4, 0x73, 0xE3, 0x0D, 0x37, 0x57, 0x78, 0x4F, 0x01, 0x77, 0x75, 0xF7,
+    0x87, 0x5F, 0x77, 0x76, 0x84, 0x96, 0xD7, 0x7D, 0x69, 0xD5, 0xAD, 0x2D,
+    0x0D, 0x0D, 0x38, 0xD1, 0x87, 0xD0, 0x88, 0x8C, 0x89, 0x7B, 0x9A, 0x7A,
+    0x9B, 0x79, 0x8D, 0x07, 0x88, 0xD0, 0x78, 0x8D, 0x17, 0x78, 0xD2, 0x76,
+    0x8D, 0x37, 0x58, 0xD4, 0x74, 0x8D, 0x47, 0x39, 0xD5, 0x72, 0x8D, 0x77,
+    0x18, 0xD8, 0xD2, 0xD8, 0xD3, 0xD4, 0xF0, 0x4D, 0x4D, 0x3F, 0x04, 0xD5,
+    0xD5, 0xA2, 0x8D, 0x49, 0x38, 0xD4, 0x85, 0x8D, 0x37, 0x69, 0xD2, 0x77,
+    0x8C, 0xF0, 0x27, 0x98, 0xD0, 0x7A, 0x8C, 0x7A, 0x9A, 0x7C, 0x8A, 0x7C,
+    0x99, 0x7D, 0x08, 0x97, 0xD0, 0x98, 0x7D, 0x18, 0x70, 0xE2, 0x77, 0xAE,
+    0x30, 0x67, 0xBE, 0x40, 0x57, 0xCE, 0x40, 0x47, 0xD0, 0xE3, 0x03, 0x7D,
+    0x1E, 0x40, 0x27, 0xD2, 0xF0, 0x17, 0xD3, 0xE2, 0x01, 0xDA, 0xF0, 0xDF,
+    0x0D, 0x61, 0x7A, 0xD0, 0xB7, 0xAD, 0x0A, 0x1F, 0x07, 0xAC, 0xB1, 0xF0,
+    0x6B, 0xBC, 0x7B, 0xA5, 0x16, 0x86, 0x14, 0xA5, 0x16, 0x86, 0x14, 0x9D,
+    0x07, 0x71, 0x49, 0x51, 0x77, 0x71, 0x48, 0x61, 0x68, 0x71, 0x48, 0x52,
+    0x68, 0x62, 0x47, 0x61, 0x77, 0x72, 0x56, 0x52, 0x77, 0x72, 0x55, 0x62,
+    0x77, 0x72, 0x55, 0x53, 0x68, 0x72, 0x54, 0x63, 0x68, 0x63, 0x54, 0x62,
+    0x77, 0x73, 0x54, 0x53, 0x77, 0x73, 0x53, 0x63, 0x77, 0x73, 0x53, 0x54,
+    0x68, 0x64, 0x52, 0x64, 0x68, 0x64, 0x52, 0x54, 0x77, 0x74, 0x51, 0x64,
+    0x77, 0x74, 0x51, 0x55, 0x68, 0x74, 0xB5, 0x68, 0x65, 0xB4, 0x76, 0xF0,
+    0x17, 0x5A, 0x57, 0x6F, 0x01, 0x75, 0x96, 0x68, 0x66, 0x86, 0x77, 0x76,
+    0x86, 0x77, 0x76, 0x77, 0x68, 0x78, 0xD1, 0x67, 0x8D, 0x07, 0xF7, 0x9C,
+    0x77, 0x9C, 0x61, 0xE2, 0x06, 0xBA, 0x77, 0xC9, 0x67, 0xD0, 0x96, 0x7D,
+    0x17, 0x77, 0x71, 0x67, 0x77, 0x62, 0x67, 0x77, 0x63, 0x66, 0x67, 0x73,
+    0x66, 0x67, 0x73, 0x65, 0x77, 0x74, 0x64, 0x77, 0x65, 0x64, 0x77, 0x65,
+    0x73, 0x67, 0x76, 0x63, 0x67, 0x76, 0x62, 0x74, 0xF0, 0x36, 0x86, 0x17,
+    0x67, 0x86, 0x16, 0x5F, 0x02, 0x79, 0xC7, 0x6A, 0xC7, 0x6B, 0xA6, 0xF0,
+    0x17, 0xBA, 0x77, 0xC9, 0x76, 0xD0, 0x97, 0x6D, 0x17, 0x77, 0xD1, 0x77,
+    0xD3, 0x9D, 0x9D, 0x1D, 0x5D, 0x5D, 0x1D, 0x8C, 0xDA, 0xAD, 0xC8, 0xA6,
+    0xB6, 0x9A, 0x96, 0x7D, 0x08, 0x57, 0xD2, 0x83, 0x8D, 0x28, 0x37, 0xD4,
+    0x7F, 0x27, 0xD5, 0x7E, 0x31, 0x7D, 0x67, 0xE3, 0x07, 0xD6, 0x71, 0xF7,
+    0xD5, 0x72, 0x7D, 0x47, 0x38, 0xD2, 0x83, 0x8D, 0x27, 0x58, 0xD0, 0x76,
+    0x9A, 0x96, 0xB6, 0xA8, 0xDC, 0xAD, 0xAC, 0xD8, 0xD1, 0xD5, 0xD5, 0xD1,
+    0xD9, 0x9D, 0x30, 0x7D, 0x5D, 0x0D, 0x89, 0xDA, 0x2F, 0x06, 0xDB, 0x7D,
+    0xC5, 0x89, 0x95, 0x7B, 0x8E, 0x25, 0x7C, 0x74, 0x7D, 0x07, 0xF4, 0x7C,
+    0x75, 0x7B, 0x76, 0x79, 0x92, 0xF0, 0x3D, 0xC6, 0xDB, 0x7D, 0xA7, 0xD9,
+    0x9D, 0x79, 0xE2, 0x02, 0x7D, 0x9E, 0x40, 0x17, 0xDA, 0xE3, 0x7D, 0xB0,
+    0xD3, 0x9D, 0x9D, 0x1D, 0x5D, 0x5D, 0x1D, 0x8C, 0xDA, 0xAD, 0xC8, 0xA6,
+    0xA7, 0x9A, 0x96, 0x8C, 0x85, 0x8D, 0x18, 0x38, 0xD2, 0x83, 0x7D, 0x47,
+    0xF2, 0x7D, 0x57, 0x26, 0xD6, 0x7F, 0x17, 0xD6, 0x71, 0x6D, 0x77, 0xE3,
+    0x07, 0xD6, 0x71, 0x7C, 0x24, 0x72, 0x7B, 0x43, 0x72, 0x7A, 0x52, 0x73,
+    0x88, 0xD2, 0x38, 0x9D, 0x05, 0x88, 0xC6, 0x98, 0xB6, 0xB6, 0xA8, 0xDD,
+    0x9D, 0xCA, 0xDC, 0xAD, 0xCB, 0xD1, 0x26, 0xD1, 0x96, 0x4D, 0xF0, 0x32,
+    0x70, 0x7D, 0x8C, 0xDA, 0xAD, 0xB2, 0xF0, 0x6D, 0xD7, 0xDE, 0x67, 0xB9,
+    0x58, 0xC8, 0xF5, 0x7D, 0x17, 0xF5, 0x7D, 0x16, 0x57, 0xD1, 0x75, 0x7D,
+    0x07, 0x67, 0xB8, 0x7D, 0xC8, 0xDB, 0x5F, 0x03, 0xDA, 0xAD, 0xB9, 0xDC,
+    0x77, 0xB8, 0x5E, 0x30, 0x27, 0xC7, 0x67, 0xD0, 0x75, 0xE3, 0x01, 0x7C,
+    0x76, 0xE2, 0x7D, 0x07, 0x60, 0xD1, 0x9D, 0x5D, 0x2D, 0x0D, 0x5B, 0xD7,
+    0x9D, 0x97, 0xDB, 0x68, 0x79, 0x58, 0x98, 0x57, 0xB7, 0xF4, 0x7C, 0x7F,
+    0x47, 0xDA, 0x8D, 0x9B, 0xD6, 0xD3, 0xD2, 0xD6, 0xCD, 0x6C, 0xD7, 0xD0,
+    0xD4, 0xD4, 0xD1, 0xD7, 0xAD, 0x98, 0x2F, 0x0D, 0x87, 0x27, 0xD1, 0x72,
+    0x7D, 0x16, 0x37, 0xD0, 0x73, 0x8B, 0x83, 0xA7, 0x94, 0xF0, 0x1D, 0xB7,
+    0xD9, 0x9D, 0x6D, 0x0D, 0x3D, 0x4A, 0xC0, 0xF1, 0xDE, 0xF0, 0xDF, 0xF0,
+    0xDE, 0x1E, 0x20, 0xA7, 0xBE, 0x30, 0x97, 0xD7, 0x8C, 0xE3, 0x08, 0x7D,
+    0x0E, 0x40, 0x77, 0xD1, 0xE3, 0x06, 0x7D, 0x2E, 0x40, 0x57, 0xD3, 0xF0,
+    0x47, 0xD4, 0xF5, 0x7D, 0x07, 0x57, 0xC7, 0x1E, 0x30, 0x47, 0xD0, 0x75,
+    0x7C, 0x72, 0xE3, 0x03, 0x7D, 0x07, 0x2E, 0x30, 0x27, 0xD0, 0x75, 0x7C,
+    0x74, 0xE3, 0x01, 0x7D, 0x07, 0x57, 0xC7, 0x5E, 0x27, 0xD0, 0x75, 0xF7,
+    0xC7, 0x68, 0xA7, 0x7A, 0x69, 0x8D, 0xA9, 0xD9, 0xBD, 0x7D, 0x0D, 0x5D,
+    0x2D, 0x2D, 0x79, 0xD3, 0x08, 0xD1, 0x72, 0x7D, 0x17, 0x1F, 0x01, 0x7D,
+    0x07, 0x2F, 0x01, 0x7C, 0x73, 0xF0, 0x17, 0xB7, 0x66, 0xA7, 0x76, 0xA6,
+    0x86, 0x97, 0x86, 0x96, 0x97, 0x77, 0x97, 0x76, 0xA7, 0x67, 0xA7, 0x66,
+    0xC6, 0x57, 0xC6, 0x56, 0xAF, 0x03, 0x64, 0x6B, 0xF0, 0x36, 0x36, 0xCF,
+    0x03, 0x62, 0x6D, 0x0F, 0x04, 0xCD, 0x5B, 0xD2, 0xF0, 0x4A, 0xD3, 0xF0,
+    0x49, 0xD4, 0xF0, 0x57, 0xDA, 0x6D, 0x60, 0x07, 0xA8, 0xA8, 0xF0, 0x7A,
+    0x8A, 0x71, 0xF7, 0x99, 0x97, 0x2F, 0x78, 0xA8, 0x73, 0x77, 0xB7, 0x75,
+    0x67, 0xB7, 0x75, 0x67, 0x51, 0x57, 0x66, 0x66, 0x61, 0x56, 0x76, 0x66,
+    0x52, 0x56, 0x67, 0x65, 0x62, 0x55, 0x76, 0xF0, 0x16, 0x55, 0x35, 0x56,
+    0x86, 0x46, 0x35, 0x46, 0x96, 0x45, 0x45, 0x46, 0x96, 0x36, 0x45, 0x36,
+    0xA6, 0x35, 0x55, 0x36, 0xA6, 0x26, 0x55, 0x26, 0xB6, 0x25, 0x65, 0x26,
+    0xB6, 0x25, 0x65, 0x25, 0xC6, 0x15, 0x75, 0x16, 0xD0, 0x51, 0x57, 0x51,
+    0x5D, 0x1B, 0x7B, 0xCF, 0x02, 0xA8, 0xAD, 0x0F, 0x02, 0x99, 0x9D, 0x1F,
+    0x02, 0x8A, 0x8D, 0x47, 0xB8, 0xD2, 0xF0, 0x27, 0xB7, 0xD3, 0x88, 0xC8,
+    0x99, 0xA8, 0xB8, 0xA8, 0xB8, 0x98, 0xD0, 0x87, 0x8D, 0x18, 0x68, 0xD2,
+    0x85, 0x8D, 0x48, 0x47, 0xD5, 0x83, 0x7D, 0x77, 0x28, 0xD7, 0xD3, 0xD8,
+    0xD2, 0xDA, 0xD0, 0xDB, 0xCD, 0xDA, 0xD0, 0xE2, 0x0D, 0x19, 0xDE, 0xAD,
+    0x1F, 0x0C, 0xCD, 0xBD, 0x1D, 0x9D, 0x2D, 0x87, 0x27, 0xD7, 0x82, 0x8D,
+    0x58, 0x38, 0xD4, 0x85, 0x8D, 0x37, 0x68, 0xD2, 0x77, 0x8D, 0x18, 0x88,
+    0xC8, 0x98, 0xB8, 0xA9, 0x98, 0xC8, 0x89, 0xC9, 0x70, 0x08, 0xD0, 0x71,
+    0x8C, 0x81, 0x8B, 0x83, 0x7B, 0x74, 0x89, 0x84, 0x88, 0x86, 0x78, 0x77,
+    0x77, 0x78, 0x85, 0x89, 0x75, 0x7A, 0x74, 0x7B, 0x73, 0x7D, 0x07, 0x27,
+    0xD0, 0x71, 0x7A, 0xF0, 0x4D, 0x1D, 0x3C, 0xD4, 0xBD, 0x5A, 0xD7, 0x9D,
+    0x78, 0xD2, 0xE3, 0x06, 0x7D, 0x3E, 0x40, 0x57, 0xD4, 0xE3, 0x04, 0x7D,
+    0x50, 0x8D, 0xCE, 0x37, 0xDD, 0x7D, 0xCD, 0xB9, 0xDA, 0x9D, 0xA9, 0xDA,
+    0x9D, 0xA9, 0xDA, 0x9D, 0xA9, 0xDA, 0x9D, 0xA9, 0xDA, 0x9D, 0xA9, 0xDA,
+    0x9D, 0xA9, 0xDA, 0x9D, 0xA9, 0xDA, 0x9D, 0xA8, 0xDB, 0x8D, 0xB8, 0xDB,
+    0x8D, 0xB8, 0xDB, 0x8D, 0xCD, 0xC6, 0xE2, 0x01, 0xDD, 0x6F, 0x01, 0xDC,
+    0x70, 0x9C, 0xE2, 0x9B, 0x9C, 0x1E, 0x20, 0x86, 0xD1, 0x77, 0xE3, 0x07,
+    0x6D, 0x17, 0x8E, 0x30, 0x66, 0xD1, 0x79, 0xE2, 0x05, 0x6D, 0x17, 0xAE,
+    0x30, 0x46, 0xD1, 0x7B, 0xE3, 0x03, 0x6C, 0xE3, 0x02, 0x6D, 0x17, 0xD1,
+    0x6D, 0x1E, 0x20, 0x1B, 0x9F, 0xC9, 0x01, 0x63, 0x4E, 0x24, 0x3E, 0x50,
+    0x13, 0x3E, 0x30, 0x14, 0x2E, 0x50, 0x23, 0x2E, 0x30, 0x24, 0x1E, 0x50,
+    0x33, 0x1E, 0x40, 0x34, 0xF9, 0xCE, 0x29, 0xBD, 0x26, 0xD1, 0x71, 0xE3,
+    0x0D, 0x06, 0x2E, 0x30, 0xC6, 0xD1, 0x73, 0xE3, 0x0B, 0x6D, 0x17, 0x4E,
+    0x20, 0xA6, 0xD1, 0x75, 0xE3, 0x09, 0x6D, 0x17, 0x6E, 0x30, 0x86, 0xD1,
+    0x77, 0xE2, 0x07, 0x69, 0xC8, 0xE2, 0x01, 0xB9, 0xC9, 0xB6, 0xD2, 0x73,
+    0xF0, 0xA8, 0xC9, 0xBA, 0xBB, 0x95, 0x16, 0x95, 0x25, 0x85, 0x35, 0x76,
+    0x35, 0x75, 0x46, 0x56, 0x46, 0x55, 0x65, 0x45, 0x75, 0x36, 0x75, 0x35,
+    0x86, 0x16, 0x86, 0x15, 0xAA, 0xB5, 0x1D, 0xF0, 0xDF, 0x01, 0xF0, 0xDF,
+    0x10, 0x05, 0x34, 0x2F, 0x02, 0x44, 0x34, 0x44, 0x30, 0xB9, 0xD0, 0xD2,
+    0x8D, 0x51, 0xF0, 0x5D, 0x74, 0x76, 0x84, 0x68, 0x74, 0x68, 0x6D, 0x57,
+    0xD3, 0x9A, 0xD2, 0x7D, 0x46, 0xD6, 0x5C, 0x17, 0x49, 0x57, 0x38, 0x76,
+    0x47, 0x86, 0x3F, 0x78, 0x73, 0x77, 0x83, 0x84, 0x94, 0xFD, 0x85, 0xC1,
+    0x85, 0xA2, 0x87, 0x6D, 0x20, 0x77, 0xD0, 0xF0, 0x76, 0xD1, 0xF0, 0x67,
+    0xD1, 0xF0, 0x66, 0xD2, 0xF0, 0x57, 0xD7, 0x73, 0x7A, 0x62, 0xB8, 0x61,
+    0xD0, 0x6D, 0x86, 0xD9, 0x5A, 0x48, 0x58, 0x78, 0x47, 0x88, 0xF3, 0x7A,
+    0x7F, 0x36, 0xB7, 0x27, 0xB7, 0x26, 0xC7, 0xE2, 0x26, 0xB7, 0x27, 0xA7,
+    0x38, 0x88, 0x38, 0x78, 0x49, 0x58, 0x5D, 0x85, 0xD8, 0x6D, 0x77, 0x62,
+    0xBD, 0x56, 0xB0, 0xB8, 0xD2, 0xCB, 0xD3, 0x8D, 0x56, 0xD6, 0x58, 0x58,
+    0x37, 0x87, 0x36, 0x97, 0x27, 0x97, 0x26, 0xD4, 0xF0, 0x17, 0xD5, 0x6D,
+    0x5E, 0x37, 0xD5, 0xF7, 0x97, 0x28, 0x77, 0x48, 0x57, 0x5D, 0x76, 0xD5,
+    0x8D, 0x3A, 0xD0, 0xD1, 0x8B, 0xFD, 0x97, 0xFD, 0x96, 0x1E, 0x20, 0xD8,
+    0x7D, 0x96, 0xD9, 0x7C, 0x73, 0x7A, 0xA2, 0x79, 0xC1, 0x68, 0xD8, 0x7D,
+    0x97, 0x84, 0xA6, 0x86, 0x95, 0x88, 0x76, 0x79, 0x74, 0xF0, 0x17, 0xB6,
+    0x57, 0xA7, 0x4E, 0x37, 0xB6, 0x57, 0xA6, 0x6F, 0x79, 0x76, 0x87, 0x87,
+    0x84, 0xA6, 0xF0, 0x1D, 0x89, 0xD7, 0xAA, 0x27, 0xC6, 0xD5, 0xB7, 0xD2,
+    0xD0, 0xBD, 0x28, 0xD5, 0x6D, 0x75, 0x84, 0x84, 0x77, 0x8F, 0x27, 0x97,
+    0xF1, 0x7A, 0x7F, 0x1D, 0xF0, 0xDF, 0x0D, 0x41, 0xE2, 0x7D, 0x57, 0x97,
+    0x28, 0x77, 0x48, 0x58, 0x4D, 0x76, 0xD5, 0x8D, 0x2B, 0xD0, 0xD2, 0x7B,
+    0xB7, 0x99, 0x89, 0x1F, 0x07, 0xA1, 0xF0, 0x67, 0x5F, 0x06, 0x6B, 0x78,
+    0xD1, 0x2E, 0x20, 0x1D, 0x13, 0xE2, 0x04, 0x77, 0xF0, 0x46, 0x8F, 0x03,
+    0x78, 0xF0, 0x36, 0x9E, 0x20, 0x27, 0x9F, 0x02, 0x6A, 0xE2, 0x01, 0x7A,
+    0xF0, 0x16, 0xB7, 0xB0, 0xD0, 0x54, 0x7A, 0xA2, 0x6A, 0xC1, 0x69, 0xD7,
+    0x8D, 0x87, 0x84, 0xA6, 0x87, 0x77, 0x78, 0x76, 0x79, 0x76, 0x7A, 0x65,
+    0x7B, 0x65, 0x7B, 0x56, 0x6C, 0x53, 0xF0, 0x27, 0xB6, 0x57, 0xB5, 0x4F,
+    0x02, 0x7A, 0x66, 0x79, 0x76, 0x87, 0x86, 0x94, 0x95, 0xF0, 0x3D, 0x89,
+    0xD0, 0x16, 0xAA, 0x27, 0xC6, 0x46, 0xDA, 0x6D, 0x97, 0x67, 0x96, 0x77,
+    0x87, 0x78, 0x58, 0x8D, 0x7A, 0xD5, 0xCD, 0x2D, 0x49, 0xD2, 0xF7, 0x7D,
+    0x0F, 0x07, 0x6D, 0x1E, 0x20, 0x67, 0xD1, 0xF0, 0x66, 0xD7, 0x75, 0x69,
+    0x72, 0xB7, 0x71, 0xD0, 0x1F, 0x05, 0xD9, 0x4A, 0x58, 0x48, 0x87, 0xF4,
+    0x79, 0x7F, 0x37, 0xA6, 0x47, 0x97, 0x1F, 0x03, 0x6A, 0x71, 0xF0, 0x27,
+    0xA6, 0x47, 0x97, 0x2F, 0x02, 0x6A, 0x72, 0xF0, 0x17, 0xA6, 0x47, 0x97,
+    0x46, 0xA7, 0x37, 0xA7, 0x37, 0xA6, 0x40, 0xF7, 0x7F, 0x76, 0x1F, 0x06,
+    0x71, 0xE2, 0x0D, 0x1E, 0x20, 0x57, 0x76, 0x3E, 0x20, 0x47, 0x3F, 0x04,
+    0x64, 0xE2, 0x03, 0x77, 0x65, 0xE2, 0x02, 0x75, 0xF0, 0x26, 0x6E, 0x20,
+    0x17, 0x6F, 0x01, 0x67, 0xF7, 0x70, 0xE2, 0xC7, 0xFC, 0x6C, 0x71, 0xE2,
+    0x0D, 0xF0, 0x26, 0x2E, 0x20, 0xA7, 0xC6, 0x3E, 0x20, 0x97, 0x3F, 0x09,
+    0x64, 0xE2, 0x08, 0x74, 0xF0, 0x86, 0x5E, 0x20, 0x77, 0x5F, 0x07, 0x66,
+    0xF0, 0x67, 0x6F, 0x06, 0x67, 0xE2, 0x05, 0x77, 0xF0, 0x56, 0xC7, 0x9A,
+    0x8F, 0x01, 0x99, 0x9A, 0x6D, 0x00, 0x77, 0xD1, 0xF0, 0x76, 0xD2, 0xF0,
+    0x67, 0xD2, 0xF0, 0x66, 0xD3, 0xF0, 0x57, 0xD8, 0x78, 0x76, 0x67, 0x87,
+    0x66, 0x87, 0x75, 0x88, 0x74, 0x7A, 0x73, 0x7B, 0x63, 0x7C, 0x62, 0x7C,
+    0x71, 0x7A, 0xE2, 0x03, 0xD1, 0xBF, 0x02, 0xD3, 0xC9, 0x17, 0xB8, 0x27,
+    0xB6, 0x47, 0x9F, 0x01, 0x75, 0x79, 0x75, 0x87, 0xF0, 0x16, 0x77, 0x77,
+    0x78, 0x67, 0x87, 0x66, 0x98, 0x50, 0xF7, 0x7F, 0x76, 0x1E, 0x20, 0x67,
+    0x1F, 0x06, 0x62, 0xE2, 0x05, 0x77, 0x63, 0xE2, 0x04, 0x73, 0xF0, 0x46,
+    0x4E, 0x20, 0x37, 0x76, 0x5E, 0x20, 0x27, 0x5F, 0x02, 0x66, 0xE2, 0x01,
+    0x76, 0xF0, 0x16, 0x7F, 0x77, 0x57, 0x46, 0x86, 0x96, 0x3A, 0x4A, 0x76,
+    0x1C, 0x2D, 0x01, 0xF0, 0x4D, 0xF0, 0x84, 0x94, 0xB4, 0x84, 0x77, 0x87,
+    0x74, 0x77, 0x78, 0x73, 0x78, 0x78, 0x64, 0x78, 0x69, 0x64, 0x78, 0x68,
+    0x74, 0x68, 0x78, 0x71, 0xF0, 0x27, 0x87, 0x86, 0x47, 0x86, 0x87, 0x46,
+    0x96, 0x87, 0x46, 0x87, 0x87, 0x2F, 0x01, 0x78, 0x78, 0x64, 0x78, 0x68,
+    0x73, 0xF0, 0x16, 0x87, 0x87, 0x37, 0x87, 0x86, 0x47, 0x86, 0x96, 0x47,
+    0x86, 0x87, 0x40, 0x57, 0x47, 0x97, 0x2B, 0x76, 0x2D, 0x06, 0xD9, 0x4D,
+    0xA4, 0xA5, 0x84, 0x88, 0x7F, 0x47, 0x97, 0xF3, 0x7A, 0x61, 0xF0, 0x36,
+    0xA7, 0x37, 0xA7, 0x1F, 0x02, 0x7A, 0x62, 0xF0, 0x26, 0xA7, 0x37, 0xA7,
+    0x2F, 0x01, 0x7A, 0x64, 0x6A, 0x73, 0xF7, 0xA7, 0x37, 0xA6, 0x40, 0xB8,
+    0xD3, 0xD0, 0xBD, 0x39, 0xD5, 0x7D, 0x75, 0x85, 0x84, 0x87, 0x82, 0x88,
+    0x82, 0x7A, 0x7E, 0x21, 0x7B, 0x7F, 0x07, 0xC7, 0xE2, 0x07, 0xB7, 0x17,
+    0xA7, 0x28, 0x88, 0x28, 0x78, 0x48, 0x58, 0x5D, 0x77, 0xD5, 0x9D, 0x3B,
+    0xD0, 0xD3, 0x7C, 0x77, 0x46, 0xC6, 0x2B, 0xA6, 0x1D, 0x08, 0xD8, 0x8D,
+    0x97, 0xA4, 0x87, 0x87, 0x85, 0x88, 0x8F, 0x57, 0xA7, 0xF5, 0x6B, 0x7F,
+    0x47, 0xB7, 0xF4, 0x6B, 0x74, 0x7B, 0x74, 0x7A, 0x75, 0x88, 0x85, 0x87,
+    0x86, 0xA4, 0x86, 0xDA, 0x6D, 0x97, 0x71, 0xD0, 0x86, 0x3A, 0xA6, 0x47,
+    0xAE, 0x20, 0x17, 0xD9, 0x6D, 0x9E, 0x27, 0xD9, 0xF6, 0xDA, 0xB6, 0x47,
+    0x8B, 0x27, 0x7D, 0x01, 0x67, 0xD1, 0x16, 0x6D, 0x95, 0x85, 0xA4, 0x87,
+    0x93, 0x88, 0x84, 0x7A, 0x72, 0xF0, 0x17, 0xB7, 0x37, 0xB6, 0x37, 0xC6,
+    0x3E, 0x27, 0xB7, 0x3F, 0x7A, 0x74, 0x79, 0x84, 0x87, 0x95, 0x84, 0xB5,
+    0xD9, 0x7D, 0x11, 0x67, 0xD0, 0x17, 0x8B, 0x27, 0xA7, 0x46, 0xD9, 0x66,
+    0xE2, 0x0D, 0x27, 0x6F, 0x0D, 0x26, 0x7E, 0x20, 0xD1, 0x77, 0x57, 0x44,
+    0x57, 0x26, 0x56, 0x26, 0x66, 0x17, 0x1F, 0x04, 0xD2, 0x5A, 0xA8, 0xC7,
+    0x9F, 0x03, 0x7A, 0xF0, 0x36, 0xBE, 0x20, 0x27, 0xBF, 0x02, 0x6C, 0xE2,
+    0x01, 0x7D, 0x06, 0xD0, 0xE2, 0x7D, 0x00, 0xB8, 0xD0, 0xD0, 0x9D, 0x37,
+    0xD5, 0x5D, 0x74, 0x75, 0x8F, 0x37, 0x77, 0x38, 0xD3, 0xBD, 0x0D, 0x2A,
+    0xD3, 0x9D, 0x39, 0xD3, 0xBD, 0x1D, 0x0B, 0xD2, 0x9D, 0x47, 0x16, 0xA7,
+    0x17, 0x97, 0x18, 0x68, 0x2F, 0x01, 0xD7, 0x5D, 0x48, 0xD2, 0xC9, 0x90,
+    0x66, 0x2E, 0x20, 0x57, 0x76, 0x3F, 0x04, 0x73, 0xE2, 0x01, 0xDE, 0xF3,
+    0x74, 0xF0, 0x36, 0x5E, 0x20, 0x27, 0x5F, 0x02, 0x66, 0xF0, 0x17, 0x6F,
+    0x01, 0x67, 0xE2, 0x77, 0xE2, 0xA5, 0x96, 0x75, 0xF4, 0x6A, 0x73, 0x7A,
+    0x61, 0xF0, 0x37, 0x97, 0x46, 0xA7, 0x46, 0xA6, 0x47, 0xA6, 0x2F, 0x02,
+    0x79, 0x74, 0x6A, 0x74, 0x6A, 0x64, 0x7A, 0x64, 0x79, 0x74, 0x6A, 0x74,
+    0x6A, 0x64, 0x7A, 0x64, 0x79, 0x74, 0x78, 0x84, 0x77, 0x94, 0x85, 0x95,
+    0xFD, 0x96, 0xD0, 0x17, 0x7B, 0x27, 0x96, 0xD4, 0xF0, 0x7A, 0x71, 0x79,
+    0x73, 0x69, 0x73, 0x68, 0x74, 0x68, 0x65, 0x76, 0x75, 0x76, 0x66, 0x75,
+    0x76, 0x75, 0x68, 0x64, 0x78, 0x64, 0x69, 0x63, 0x79, 0x63, 0x68, 0xF0,
+    0x26, 0x26, 0xB6, 0x16, 0xD0, 0x51, 0x6A, 0xF0, 0x3B, 0xD1, 0xAC, 0xF0,
+    0x39, 0xD0, 0xF0, 0x38, 0xD1, 0xF0, 0x77, 0x77, 0xD1, 0x68, 0x76, 0x17,
+    0x68, 0x67, 0x17, 0x59, 0x66, 0x27, 0x59, 0x57, 0x27, 0x59, 0x56, 0x46,
+    0x4A, 0x47, 0x46, 0x44, 0x15, 0x46, 0x56, 0x35, 0x15, 0x37, 0x56, 0x35,
+    0x15, 0x36, 0x66, 0x34, 0x25, 0x36, 0x66, 0x25, 0x25, 0x26, 0x76, 0x24,
+    0x35, 0x26, 0x76, 0x15, 0x35, 0x16, 0x86, 0x14, 0x45, 0x16, 0x86, 0x14,
+    0x4B, 0x9B, 0x4B, 0x8F, 0x01, 0xA5, 0xAA, 0x96, 0x9C, 0x86, 0x9C, 0x86,
+    0x8D, 0x07, 0x78, 0xD0, 0x77, 0x7C, 0x68, 0x78, 0x68, 0x68, 0x87, 0x67,
+    0x97, 0x57, 0xA8, 0x37, 0x4F, 0x08, 0x72, 0x7D, 0x1D, 0x1D, 0x2D, 0x0D,
+    0x4B, 0xD5, 0xAD, 0x69, 0xD8, 0x7D, 0x89, 0xD6, 0xAD, 0x5C, 0xD3, 0xD0,
+    0xD2, 0x71, 0x7D, 0x07, 0x27, 0xC8, 0x28, 0xB7, 0x47, 0xA7, 0x57, 0x98,
+    0x58, 0x78, 0x77, 0x68, 0x88, 0x50, 0x47, 0xB6, 0x57, 0xA7, 0x57, 0xA6,
+    0x67, 0x97, 0x67, 0x96, 0x87, 0x77, 0x87, 0x76, 0x4F, 0x05, 0x76, 0x65,
+    0xF0, 0x57, 0x56, 0xB7, 0x46, 0xD0, 0x64, 0x6D, 0x06, 0x36, 0xD1, 0x63,
+    0x5D, 0x27, 0x16, 0xD2, 0x71, 0x5D, 0x3D, 0x0D, 0x3C, 0xD5, 0xBD, 0x5A,
+    0xCF, 0x07, 0x9D, 0x0F, 0x07, 0x8D, 0x1F, 0x07, 0x7D, 0x96, 0xD9, 0x6D,
+    0x97, 0xD5, 0xAD, 0x5B, 0xD5, 0xAD, 0x68, 0xD8, 0x6D, 0xA0, 0xF6, 0xD7,
+    0x6D, 0x61, 0xF0, 0x5D, 0x7D, 0x48, 0xD4, 0x8D, 0x48, 0xD4, 0x8D, 0x48,
+    0xD4, 0x8D, 0x48, 0xD4, 0x8D, 0x48, 0xD4, 0x8D, 0x48, 0xD4, 0x8D, 0x48,
+    0xD4, 0x8D, 0x48, 0xD3, 0xE2, 0x01, 0xD8, 0x4F, 0xD8, 0x50, 0xC6, 0xA8,
+    0x99, 0x98, 0x99, 0x1F, 0x08, 0x5C, 0x65, 0xE3, 0x07, 0x56, 0xE3, 0x06,
+    0x5C, 0x67, 0xF0, 0x55, 0xC6, 0x98, 0x9F, 0x01, 0x6B, 0x8C, 0x6A, 0xE5,
+    0x03, 0x5A, 0xE3, 0x02, 0x5B, 0xE2, 0x01, 0x5C, 0xE2, 0x01, 0x8B, 0x7C,
+    0x69, 0xF9, 0x49, 0x31, 0xE3, 0x08, 0x49, 0x32, 0xE3, 0x07, 0x49, 0x33,
+    0xE3, 0x06, 0x43, 0xE3, 0x05, 0x49, 0x35, 0xE3, 0x04, 0x49, 0x36, 0xE3,
+    0x03, 0x49, 0x37, 0xE2, 0x02, 0x49, 0x38, 0xE3, 0x01, 0x49, 0x39, 0xF4,
+    0x90, 0x96, 0x3F, 0x09, 0x72, 0xF0, 0x98, 0x1E, 0x20, 0xC5, 0x1E, 0x30,
+    0xB5, 0x2E, 0x50, 0xA5, 0xD0, 0x6C, 0x8F, 0xB6, 0xA8, 0x96, 0x4F, 0x08,
+    0x55, 0xE4, 0x07, 0x56, 0xE3, 0x06, 0x5C, 0x67, 0xF0, 0x55, 0x99, 0x98,
+    0x99, 0x98, 0xA6, 0xC0, 0x45, 0xD2, 0x9C, 0xB6, 0x41, 0xC5, 0x85, 0xC1,
+    0x37, 0xBC, 0x9D, 0x16, 0x40};
+
+const GFXglyph FreeSansBoldOblique24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 13, 0, 1},          // 0x20 ' '
+    {0, 14, 34, 16, 5, -33},      // 0x21 '!'
+    {30, 18, 12, 22, 8, -33},     // 0x22 '"'
+    {44, 29, 33, 26, 2, -31},     // 0x23 '#'
+    {101, 26, 42, 26, 3, -35},    // 0x24 '$'
+    {183, 36, 34, 42, 6, -32},    // 0x25 '%'
+    {277, 29, 35, 34, 4, -33},    // 0x26 '&'
+    {347, 7, 12, 11, 8, -33},     // 0x27 '''
+    {356, 17, 44, 16, 4, -33},    // 0x28 '('
+    {393, 17, 44, 16, 0, -34},    // 0x29 ')'
+    {430, 15, 15, 18, 7, -33},    // 0x2A '*'
+    {453, 24, 22, 27, 4, -21},    // 0x2B '+'
+    {478, 10, 15, 13, 1, -6},     // 0x2C ','
+    {494, 14, 6, 16, 3, -15},     // 0x2D '-'
+    {500, 8, 7, 13, 3, -6},       // 0x2E '.'
+    {506, 20, 34, 13, 0, -32},    // 0x2F '/'
+    {553, 25, 35, 26, 4, -33},    // 0x30 '0'
+    {604, 17, 33, 26, 8, -32},    // 0x31 '1'
+    {640, 29, 34, 26, 1, -33},    // 0x32 '2'
+    {694, 26, 35, 26, 3, -33},    // 0x33 '3'
+    {748, 25, 32, 26, 3, -31},    // 0x34 '4'
+    {799, 27, 34, 26, 3, -32},    // 0x35 '5'
+    {847, 25, 35, 26, 4, -33},    // 0x36 '6'
+    {904, 26, 33, 26, 6, -32},    // 0x37 '7'
+    {953, 26, 35, 26, 3, -33},    // 0x38 '8'
+    {1012, 25, 35, 26, 4, -33},   // 0x39 '9'
+    {1069, 12, 25, 16, 5, -24},   // 0x3A ':'
+    {1084, 14, 33, 16, 3, -24},   // 0x3B ';'
+    {1109, 26, 23, 27, 4, -22},   // 0x3C '<'
+    {1145, 26, 18, 27, 3, -19},   // 0x3D '='
+    {1161, 26, 23, 27, 1, -21},   // 0x3E '>'
+    {1197, 24, 35, 29, 8, -34},   // 0x3F '?'
+    {1246, 45, 41, 46, 3, -34},   // 0x40 '@'
+    {1374, 32, 34, 34, 1, -33},   // 0x41 'A'
+    {1441, 32, 34, 34, 4, -33},   // 0x42 'B'
+    {1500, 32, 36, 34, 5, -34},   // 0x43 'C'
+    {1558, 32, 34, 34, 4, -33},   // 0x44 'D'
+    {1616, 32, 34, 31, 4, -33},   // 0x45 'E'
+    {1652, 32, 34, 29, 3, -33},   // 0x46 'F'
+    {1685, 33, 36, 37, 5, -34},   // 0x47 'G'
+    {1757, 35, 34, 34, 3, -33},   // 0x48 'H'
+    {1815, 14, 34, 13, 3, -33},   // 0x49 'I'
+    {1836, 27, 35, 26, 3, -33},   // 0x4A 'J'
+    {1876, 37, 34, 34, 3, -33},   // 0x4B 'K'
+    {1953, 24, 34, 29, 4, -33},   // 0x4C 'L'
+    {1982, 41, 34, 39, 3, -33},   // 0x4D 'M'
+    {2093, 35, 34, 34, 3, -33},   // 0x4E 'N'
+    {2172, 34, 36, 37, 5, -34},   // 0x4F 'O'
+    {2235, 31, 34, 31, 4, -33},   // 0x50 'P'
+    {2280, 34, 37, 37, 5, -34},   // 0x51 'Q'
+    {2353, 33, 34, 34, 4, -33},   // 0x52 'R'
+    {2405, 30, 36, 31, 4, -34},   // 0x53 'S'
+    {2467, 28, 34, 29, 7, -33},   // 0x54 'T'
+    {2498, 32, 35, 34, 6, -33},   // 0x55 'U'
+    {2548, 30, 34, 31, 8, -33},   // 0x56 'V'
+    {2611, 43, 34, 44, 8, -33},   // 0x57 'W'
+    {2710, 37, 34, 31, 1, -33},   // 0x58 'X'
+    {2781, 29, 34, 31, 9, -33},   // 0x59 'Y'
+    {2833, 33, 34, 29, 1, -33},   // 0x5A 'Z'
+    {2881, 21, 43, 16, 1, -33},   // 0x5B '['
+    {2922, 7, 36, 13, 6, -34},    // 0x5C '\'
+    {2944, 21, 43, 16, -1, -33},  // 0x5D ']'
+    {2985, 21, 20, 27, 6, -32},   // 0x5E '^'
+    {3018, 29, 4, 26, -3, 6},     // 0x5F '_'
+    {3025, 7, 7, 16, 8, -35},     // 0x60 '`'
+    {3033, 25, 26, 26, 2, -24},   // 0x61 'a'
+    {3077, 27, 35, 29, 3, -33},   // 0x62 'b'
+    {3135, 25, 26, 26, 4, -24},   // 0x63 'c'
+    {3173, 29, 35, 29, 4, -33},   // 0x64 'd'
+    {3226, 25, 26, 26, 3, -24},   // 0x65 'e'
+    {3264, 18, 34, 16, 4, -33},   // 0x66 'f'
+    {3304, 29, 35, 29, 2, -24},   // 0x67 'g'
+    {3370, 27, 34, 29, 3, -33},   // 0x68 'h'
+    {3427, 14, 34, 13, 3, -33},   // 0x69 'i'
+    {3462, 19, 44, 13, -2, -33},  // 0x6A 'j'
+    {3510, 28, 34, 26, 3, -33},   // 0x6B 'k'
+    {3570, 14, 34, 13, 3, -33},   // 0x6C 'l'
+    {3605, 40, 25, 42, 3, -24},   // 0x6D 'm'
+    {3675, 27, 25, 29, 3, -24},   // 0x6E 'n'
+    {3719, 26, 26, 29, 4, -24},   // 0x6F 'o'
+    {3759, 29, 35, 29, 1, -24},   // 0x70 'p'
+    {3814, 28, 35, 29, 3, -24},   // 0x71 'q'
+    {3874, 20, 25, 18, 3, -24},   // 0x72 'r'
+    {3907, 24, 26, 26, 3, -24},   // 0x73 's'
+    {3948, 14, 32, 16, 5, -30},   // 0x74 't'
+    {3980, 27, 26, 29, 4, -24},   // 0x75 'u'
+    {4028, 25, 25, 26, 6, -24},   // 0x76 'v'
+    {4073, 35, 25, 37, 6, -24},   // 0x77 'w'
+    {4146, 29, 25, 26, 1, -24},   // 0x78 'x'
+    {4194, 29, 35, 26, 2, -24},   // 0x79 'y'
+    {4258, 26, 25, 23, 1, -24},   // 0x7A 'z'
+    {4294, 18, 43, 18, 4, -33},   // 0x7B '{'
+    {4333, 13, 43, 13, 3, -33},   // 0x7C '|'
+    {4369, 18, 43, 18, 2, -33},   // 0x7D '}'
+    {4408, 22, 8, 27, 5, -14}};   // 0x7E '~'
+
+const GFXpackedFont FreeSansBoldOblique24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeSansBoldOblique24pt7bRLEBitmaps,
+     (GFXglyph *)FreeSansBoldOblique24pt7bRLEGlyphs, 0x20, 0x7E, 56},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 5094 bytes, glyph bitmaps 4421 bytes (9447 uncompressed)
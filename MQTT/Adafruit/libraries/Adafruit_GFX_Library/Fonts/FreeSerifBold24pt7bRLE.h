@@ -0,0 +1,410 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeSerifBold24pt7bRLEBitmaps[] PROGMEM = {
+    0x24, 0x36, 0x17, 0x1E, 0x48, 0xF1, 0x61, 0xF0, 0x15, 0x2F, 0x02, 0x42,
+    0xE3, 0x02, 0x36, 0x23, 0xE2, 0x03, 0x14, 0xE3, 0x0A, 0x43, 0x61, 0xE3,
+    0x81, 0x63, 0x42, 0x13, 0x93, 0x1E, 0x45, 0x79, 0x85, 0xE3, 0x13, 0x93,
+    0x31, 0xA3, 0x31, 0xB1, 0x20, 0x84, 0x53, 0x3F, 0x08, 0x36, 0x33, 0xE4,
+    0x07, 0x45, 0x43, 0xF0, 0x73, 0x63, 0x4E, 0x20, 0x2D, 0x8F, 0x64, 0x54,
+    0x4F, 0x06, 0x36, 0x35, 0xE2, 0x05, 0x45, 0x45, 0xE2, 0xD9, 0x63, 0x63,
+    0x6E, 0x40, 0x44, 0x54, 0xA4, 0x53, 0xB3, 0x63, 0xB3, 0x54, 0xA4, 0x54,
+    0x70, 0xE3, 0x92, 0xD2, 0xB8, 0x42, 0x21, 0x65, 0x34, 0x23, 0x53, 0x35,
+    0x24, 0x43, 0x35, 0x25, 0x32, 0xF4, 0x52, 0x62, 0x25, 0x42, 0x71, 0x26,
+    0x32, 0x71, 0x2F, 0xBB, 0xBB, 0xCA, 0xCA, 0xD0, 0x9D, 0x0A, 0xC2, 0xF0,
+    0x9B, 0xA2, 0x28, 0x92, 0x37, 0x11, 0x72, 0x46, 0xF1, 0x17, 0x25, 0x51,
+    0x26, 0x25, 0x51, 0x35, 0x25, 0x42, 0x35, 0x24, 0x52, 0x44, 0x24, 0x43,
+    0x62, 0x22, 0x56, 0xD0, 0xB7, 0x8E, 0x30, 0x92, 0xA0, 0xDD, 0x2D, 0x15,
+    0xD0, 0x2D, 0x18, 0xA3, 0xC6, 0x23, 0x65, 0xC6, 0x4D, 0x0C, 0x56, 0x71,
+    0x3C, 0x66, 0x17, 0x3A, 0xF0, 0x16, 0x71, 0x63, 0xC5, 0x81, 0x53, 0xC6,
+    0x71, 0x62, 0xD0, 0x67, 0x15, 0x3D, 0x05, 0x72, 0x52, 0xD1, 0x57, 0x15,
+    0x3D, 0x15, 0x62, 0x43, 0xD2, 0x55, 0x25, 0x3D, 0x35, 0x32, 0x53, 0x85,
+    0x58, 0x62, 0x79, 0x45, 0x73, 0x57, 0x31, 0xD3, 0x25, 0x66, 0x1D, 0x13,
+    0x56, 0x61, 0xD1, 0x25, 0x67, 0x1D, 0x03, 0x46, 0x81, 0xD0, 0x25, 0x68,
+    0x1C, 0x34, 0x68, 0x1C, 0x35, 0x68, 0x1C, 0x26, 0x68, 0x1B, 0x36, 0x58,
+    0x1C, 0x27, 0x57, 0x2B, 0x37, 0x57, 0x1C, 0x29, 0x46, 0x2B, 0x39, 0x53,
+    0x3C, 0x2B, 0x9C, 0x3C, 0x67, 0xC7, 0xDC, 0xBD, 0x94, 0x37, 0xD6, 0x45,
+    0x6D, 0x64, 0x66, 0xAF, 0x07, 0x57, 0x5D, 0x46, 0x65, 0xD4, 0x66, 0x4D,
+    0x57, 0x54, 0xD5, 0x83, 0x3D, 0x8C, 0xD9, 0x9D, 0xD8, 0x7A, 0x99, 0x95,
+    0x9B, 0x94, 0x84, 0x19, 0x83, 0x83, 0x49, 0x73, 0x74, 0x59, 0x62, 0x74,
+    0x69, 0x52, 0x75, 0x79, 0x42, 0x75, 0x89, 0x22, 0x76, 0x8C, 0x86, 0x9B,
+    0x87, 0x99, 0x97, 0x9A, 0x88, 0x9A, 0x78, 0xA9, 0x61, 0x18, 0x9B, 0x32,
+    0x19, 0x7D, 0x33, 0xA4, 0x31, 0xD0, 0x3D, 0x24, 0xB6, 0xB7, 0x99, 0x7B,
+    0x55, 0x13, 0x1E, 0x55, 0xE4, 0x13, 0x31, 0x20, 0xD9, 0x29, 0x28, 0x38,
+    0x38, 0x39, 0x29, 0x35, 0xF0, 0x33, 0x6F, 0x02, 0x46, 0xE3, 0x01, 0x47,
+    0xE9, 0x57, 0xE2, 0x01, 0x47, 0xF0, 0x24, 0x6F, 0x03, 0x36, 0xF0, 0x43,
+    0xA3, 0xA2, 0xB2, 0xB2, 0xC2, 0xB1, 0xC2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+    0xA3, 0x4F, 0x06, 0x33, 0xF0, 0x64, 0x85, 0x1E, 0x20, 0x74, 0x1E, 0x90,
+    0x75, 0xE2, 0x74, 0x1F, 0x06, 0x42, 0xF0, 0x63, 0x3F, 0x05, 0x38, 0x39,
+    0x29, 0x29, 0x28, 0x2A, 0x1B, 0x73, 0x8E, 0x30, 0x65, 0x74, 0x34, 0x33,
+    0x15, 0x23, 0x34, 0x16, 0x13, 0x2D, 0x01, 0x21, 0x63, 0xD1, 0x77, 0xA8,
+    0x76, 0x11, 0x16, 0x26, 0x13, 0x16, 0x15, 0x23, 0x2A, 0x33, 0x34, 0x22,
+    0x35, 0x33, 0x1E, 0x20, 0x65, 0xD1, 0x38, 0xE9, 0xB4, 0xBE, 0x4D, 0xDE,
+    0x9B, 0x4B, 0x24, 0x36, 0x17, 0x1E, 0x28, 0x17, 0x53, 0xF5, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x26, 0xE4, 0x0B, 0x24, 0x36, 0x1E, 0x38, 0x16, 0x34,
+    0x20, 0xB4, 0xA5, 0xFA, 0x4A, 0x51, 0xF0, 0x94, 0xA5, 0x2F, 0x08, 0x4A,
+    0x53, 0xF0, 0x74, 0xA5, 0x4F, 0x06, 0x4A, 0x55, 0xF0, 0x54, 0xA5, 0x6E,
+    0x20, 0x44, 0x7E, 0x20, 0x34, 0x8E, 0x20, 0x24, 0x9E, 0x20, 0x14, 0xA4,
+    0xB0, 0x86, 0xD1, 0x42, 0x4B, 0x44, 0x49, 0x54, 0x54, 0xF0, 0x35, 0x65,
+    0x3F, 0x02, 0x66, 0x62, 0xE2, 0x01, 0x76, 0x71, 0x86, 0x71, 0xE9, 0x86,
+    0xD3, 0x67, 0x1E, 0x20, 0x17, 0x67, 0x1F, 0x02, 0x66, 0x62, 0xF0, 0x35,
+    0x65, 0x75, 0x45, 0x94, 0x44, 0xB4, 0x24, 0xD1, 0x68, 0xB2, 0xD1, 0x4C,
+    0x6A, 0x88, 0xA6, 0x31, 0x85, 0xED, 0xA0, 0x67, 0xA8, 0x9B, 0x3D, 0x50,
+    0x86, 0xD0, 0xA9, 0xD0, 0x4F, 0x03, 0xD2, 0x53, 0x59, 0x33, 0x78, 0x32,
+    0x97, 0x31, 0xA7, 0x2E, 0x20, 0xD0, 0x62, 0xF0, 0xD0, 0x53, 0xF0, 0xC5,
+    0xD3, 0x4D, 0x34, 0xD4, 0x3D, 0x43, 0xD4, 0x4D, 0x43, 0xD4, 0x3D, 0x43,
+    0xA1, 0x63, 0xA2, 0x53, 0xB1, 0x62, 0xA3, 0x5D, 0x34, 0xD4, 0x3D, 0x52,
+    0xD5, 0x2F, 0xD6, 0x20, 0x87, 0xBC, 0x8D, 0x16, 0x24, 0xA4, 0x18, 0x83,
+    0x28, 0x83, 0x1A, 0x72, 0xF0, 0xC7, 0x2F, 0x0C, 0x6D, 0x16, 0xD2, 0x5D,
+    0x27, 0xCA, 0xAC, 0xBB, 0xC9, 0xD0, 0x9D, 0x08, 0xD1, 0x7F, 0xD2, 0x6F,
+    0xD3, 0x5F, 0xD3, 0x4D, 0x43, 0x34, 0xB3, 0x27, 0x83, 0x38, 0x72, 0x4A,
+    0x33, 0x6D, 0x0A, 0x8A, 0xFD, 0x14, 0xD3, 0x5D, 0x26, 0x3F, 0x0B, 0x7D,
+    0x08, 0xC2, 0x16, 0xB3, 0x16, 0xB2, 0x26, 0xA2, 0x36, 0x93, 0x36, 0x92,
+    0x46, 0x82, 0x56, 0x73, 0x56, 0x63, 0x66, 0x62, 0x76, 0x53, 0x76, 0x43,
+    0x86, 0x42, 0x96, 0x33, 0x96, 0x3E, 0x4D, 0x8E, 0x6C, 0x63, 0xF5, 0xD2,
+    0xE2, 0x4D, 0x24, 0xD2, 0x2E, 0x20, 0x32, 0xD4, 0x2D, 0x57, 0xD0, 0xB8,
+    0xD1, 0x6D, 0x25, 0xD3, 0x3F, 0x01, 0xD4, 0xB9, 0xD0, 0x8D, 0x16, 0xD2,
+    0x5D, 0x34, 0x1F, 0x0D, 0x33, 0x1F, 0x0D, 0x32, 0x34, 0xB1, 0x37, 0x82,
+    0x39, 0x43, 0x4D, 0x26, 0xCA, 0x89, 0xD5, 0x3D, 0x15, 0xD0, 0x6D, 0x15,
+    0xD1, 0x6D, 0x16, 0xD1, 0x6D, 0x16, 0xD1, 0x7D, 0x07, 0xD0, 0x8D, 0x07,
+    0xD0, 0x8D, 0x0D, 0x17, 0xD3, 0x49, 0x37, 0x28, 0x56, 0x2F, 0x85, 0x71,
+    0xE5, 0x86, 0x7F, 0x17, 0x67, 0x17, 0x66, 0x36, 0x66, 0x37, 0x55, 0x56,
+    0x54, 0x75, 0x45, 0x94, 0x33, 0xD0, 0x67, 0xF2, 0xD6, 0x1D, 0x7E, 0x21,
+    0xD6, 0x22, 0xC4, 0x22, 0xD0, 0x42, 0x2C, 0x52, 0x1D, 0x04, 0xD4, 0x43,
+    0xE2, 0x0D, 0x04, 0x4E, 0x20, 0xC4, 0x5F, 0x0B, 0x4D, 0x35, 0x6F, 0x0A,
+    0x4D, 0x35, 0x7F, 0x09, 0x4D, 0x35, 0x8F, 0x08, 0x4D, 0x35, 0xD3, 0x4A,
+    0xF0, 0x65, 0xA0, 0x78, 0xB3, 0x45, 0x74, 0x74, 0x54, 0x85, 0x44, 0x95,
+    0x1F, 0x01, 0x59, 0x51, 0xF0, 0x16, 0x85, 0x27, 0x74, 0x38, 0x55, 0x49,
+    0x34, 0x5D, 0x18, 0xBA, 0xD0, 0x9D, 0x0A, 0xC9, 0xD0, 0x63, 0x1C, 0x35,
+    0x3A, 0x25, 0x59, 0x25, 0x6D, 0x18, 0x8F, 0x05, 0x97, 0xF0, 0x5A, 0xBA,
+    0x52, 0x4A, 0x52, 0x58, 0x54, 0x57, 0x55, 0x54, 0x67, 0xCB, 0x87, 0x77,
+    0xD0, 0x34, 0x4A, 0x45, 0x48, 0x46, 0x65, 0x56, 0x63, 0xF0, 0x16, 0x76,
+    0x2F, 0x77, 0x71, 0xE5, 0x77, 0x8F, 0x17, 0x68, 0x26, 0x68, 0x28, 0x38,
+    0x5D, 0x46, 0x71, 0x8D, 0x17, 0xD1, 0x8D, 0x17, 0xD1, 0x8D, 0x17, 0xD1,
+    0x7D, 0x26, 0xD2, 0x6D, 0x26, 0xD1, 0x6D, 0x25, 0xD1, 0x6D, 0x13, 0xD6,
+    0x24, 0x36, 0x1E, 0x38, 0x16, 0x34, 0x2E, 0x70, 0xA4, 0x36, 0x1E, 0x38,
+    0x16, 0x34, 0x20, 0x24, 0x46, 0x2E, 0x38, 0x26, 0x44, 0x3E, 0x60, 0xB4,
+    0x47, 0x18, 0x1E, 0x29, 0x18, 0x27, 0x63, 0xF6, 0x26, 0x26, 0x26, 0x25,
+    0x36, 0x17, 0xDB, 0x2D, 0x94, 0xD7, 0x6D, 0x58, 0xD3, 0xAD, 0x0A, 0xD1,
+    0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD2, 0xF9, 0xD5, 0xAD,
+    0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xBD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0x8D,
+    0x76, 0xD9, 0x4D, 0xB2, 0xE4, 0x0D, 0xDE, 0x6D, 0xDE, 0x4D, 0xD0, 0x02,
+    0xDB, 0x4D, 0x96, 0xD7, 0x8D, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xBD, 0x5A,
+    0xD5, 0xAD, 0x5A, 0xD5, 0xA1, 0xF0, 0xD4, 0x9D, 0x2A, 0xD1, 0xAD, 0x1A,
+    0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD0, 0xAD, 0x38, 0xD5, 0x6D, 0x74,
+    0xD9, 0x2D, 0xB0, 0x57, 0x9B, 0x63, 0x46, 0x43, 0x66, 0x24, 0x67, 0x15,
+    0x66, 0x1E, 0x26, 0x57, 0x15, 0x57, 0x14, 0x67, 0xFA, 0x7A, 0x7B, 0x6B,
+    0x5D, 0x04, 0xD0, 0x3D, 0x22, 0x9E, 0x20, 0x71, 0xAE, 0x30, 0xDB, 0x4D,
+    0x06, 0x7E, 0x30, 0x48, 0xB6, 0xD0, 0x48, 0xD1, 0x8D, 0x8D, 0x2D, 0x45,
+    0x84, 0xD1, 0x5C, 0x4B, 0x4D, 0x33, 0x94, 0xD5, 0x37, 0x4D, 0x72, 0x65,
+    0xD8, 0x24, 0x5B, 0x44, 0x21, 0x33, 0x59, 0x61, 0x43, 0x22, 0x59, 0x52,
+    0x53, 0x22, 0x58, 0x44, 0x54, 0x21, 0x57, 0x54, 0x45, 0x78, 0x45, 0x45,
+    0x77, 0x46, 0x45, 0x76, 0x55, 0x46, 0x2F, 0x05, 0x64, 0x64, 0x67, 0x54,
+    0x65, 0x67, 0x54, 0x64, 0x62, 0x15, 0x54, 0x55, 0x62, 0x15, 0x54, 0x41,
+    0x14, 0x52, 0x35, 0x45, 0x22, 0x14, 0x52, 0x35, 0x57, 0x24, 0x33, 0x54,
+    0x64, 0x49, 0x65, 0xD2, 0x59, 0x4D, 0xF0, 0x15, 0xDF, 0x01, 0x5D, 0xF0,
+    0x15, 0xDF, 0x02, 0x5D, 0x12, 0xD0, 0x69, 0x5D, 0x2D, 0x3D, 0x7A, 0xA0,
+    0xD2, 0x2D, 0x2F, 0x0D, 0x13, 0xDF, 0x01, 0x4D, 0xE5, 0xDE, 0x6D, 0x0F,
+    0x0C, 0x7D, 0xC8, 0xDA, 0x9D, 0xAA, 0xD8, 0x21, 0x8D, 0x82, 0x27, 0xD8,
+    0x22, 0x8D, 0x62, 0x47, 0xD6, 0x24, 0x8D, 0x42, 0x58, 0x9F, 0x08, 0x26,
+    0x8D, 0x22, 0x87, 0xD2, 0x28, 0x8D, 0x03, 0x88, 0x7F, 0x06, 0xD7, 0xB3,
+    0xA8, 0xB2, 0xC8, 0x93, 0xC8, 0x5F, 0x04, 0x2D, 0x18, 0x4F, 0x03, 0x3D,
+    0x19, 0x46, 0xD0, 0xA2, 0x98, 0xD2, 0x0D, 0x78, 0xDA, 0x8A, 0x47, 0x4F,
+    0x04, 0x86, 0x82, 0xE4, 0x04, 0x87, 0x85, 0x87, 0x76, 0x86, 0x86, 0x86,
+    0x68, 0x84, 0x6A, 0xD2, 0xD0, 0xD5, 0xA8, 0x48, 0x88, 0x68, 0x2F, 0x04,
+    0x87, 0x81, 0xE5, 0x04, 0x88, 0x84, 0x88, 0x75, 0x87, 0x85, 0x87, 0x76,
+    0x94, 0x76, 0xD8, 0x5D, 0x78, 0xC8, 0x81, 0xAD, 0x05, 0x29, 0x65, 0x62,
+    0x27, 0x69, 0x86, 0x6C, 0x65, 0x6D, 0x15, 0x47, 0xD2, 0x44, 0x6D, 0x34,
+    0x37, 0xD4, 0x33, 0x7D, 0x52, 0x28, 0xD5, 0x22, 0x7D, 0x71, 0x27, 0xD9,
+    0xE8, 0x8D, 0xA7, 0xD9, 0xF0, 0x18, 0xDA, 0x7D, 0xA7, 0xD6, 0x14, 0x7D,
+    0x43, 0x47, 0xD2, 0x36, 0x6D, 0x13, 0x86, 0xB4, 0xA7, 0x74, 0xD1, 0xD2,
+    0xD5, 0x99, 0x0D, 0x6D, 0x2D, 0x8D, 0x09, 0x48, 0xB8, 0x77, 0xA8, 0x88,
+    0x88, 0x97, 0x88, 0xA7, 0x78, 0xA8, 0x68, 0xB7, 0x2F, 0x04, 0x8B, 0x81,
+    0xE8, 0x04, 0x8C, 0x8F, 0x48, 0xC7, 0x58, 0xB8, 0x1F, 0x04, 0x8B, 0x76,
+    0x8A, 0x77, 0x8A, 0x68, 0x89, 0x69, 0x88, 0x6A, 0x95, 0x7A, 0xD7, 0x9D,
+    0x7C, 0x0D, 0xD4, 0xDB, 0x58, 0x87, 0x58, 0xB4, 0x58, 0xC3, 0x2F, 0x03,
+    0x8D, 0x02, 0x58, 0xD1, 0x15, 0x87, 0x16, 0x15, 0x87, 0x19, 0xF0, 0x38,
+    0x62, 0xC8, 0x53, 0xC8, 0x44, 0x9F, 0x03, 0xD3, 0xC8, 0x35, 0xC8, 0x53,
+    0x9F, 0x03, 0x86, 0x29, 0xF0, 0x38, 0x71, 0xC8, 0xD3, 0x13, 0x8D, 0x22,
+    0xF3, 0x8D, 0x13, 0x38, 0xD0, 0x34, 0x8C, 0x44, 0x8B, 0x53, 0xA7, 0x81,
+    0xFD, 0xE1, 0x0D, 0xC2, 0xDA, 0x39, 0x76, 0x38, 0xA4, 0x38, 0xB3, 0xF3,
+    0x8C, 0x23, 0x8D, 0x01, 0x38, 0x71, 0x51, 0x38, 0x71, 0x6F, 0x03, 0x86,
+    0x29, 0x85, 0x39, 0x83, 0x56, 0xF0, 0x3D, 0x39, 0x83, 0x59, 0x85, 0x36,
+    0xF0, 0x38, 0x62, 0x6F, 0x03, 0x87, 0x16, 0xE7, 0x03, 0x8D, 0x3A, 0xD0,
+    0xD2, 0xA0, 0xC8, 0x81, 0xD0, 0xD0, 0x52, 0xC6, 0x55, 0x32, 0xA6, 0x98,
+    0x96, 0xC6, 0x86, 0xD1, 0x57, 0x7D, 0x24, 0x76, 0xD4, 0x36, 0x7D, 0x43,
+    0x67, 0xD5, 0x25, 0x8D, 0x52, 0x57, 0xD7, 0x15, 0x7D, 0xCE, 0x68, 0xDC,
+    0x8A, 0xDA, 0xD0, 0xA3, 0x7D, 0x18, 0x3F, 0x01, 0x8D, 0x08, 0x3F, 0x02,
+    0x7D, 0x08, 0x67, 0xC8, 0x76, 0xC8, 0x86, 0xB8, 0x96, 0xA8, 0xA7, 0x69,
+    0xD0, 0xD4, 0xD6, 0xAB, 0x0D, 0x15, 0xD1, 0x2A, 0x9A, 0x2E, 0xC0, 0x38,
+    0xB8, 0x3F, 0x03, 0xDE, 0x3E, 0xC0, 0x38, 0xB8, 0x5A, 0x9A, 0x2D, 0x15,
+    0xD1, 0x0D, 0x22, 0xA3, 0xED, 0xE0, 0x38, 0x6A, 0x3D, 0x20, 0x7D, 0x2A,
+    0xA2, 0xED, 0xC0, 0xB8, 0x44, 0x68, 0x36, 0x58, 0x3E, 0x26, 0x57, 0x54,
+    0x57, 0x65, 0x46, 0x8D, 0x0C, 0x7A, 0x0D, 0x15, 0xD0, 0x4A, 0xA8, 0x78,
+    0xC4, 0xA8, 0xC3, 0xB8, 0xB3, 0xC8, 0xA3, 0xD0, 0x89, 0x3D, 0x18, 0x83,
+    0xD2, 0x87, 0x3D, 0x38, 0x63, 0xD4, 0x85, 0x3D, 0x58, 0x43, 0xD6, 0x83,
+    0x4D, 0x68, 0x26, 0xD5, 0x81, 0x7D, 0x5D, 0x4D, 0x4D, 0x5D, 0x39, 0x19,
+    0xD2, 0x82, 0xAD, 0x18, 0x39, 0xD1, 0x84, 0x9D, 0x08, 0x59, 0xC8, 0x69,
+    0xB8, 0x6A, 0xA8, 0x79, 0xA8, 0x89, 0x98, 0x99, 0x88, 0xA9, 0x78, 0xAA,
+    0x68, 0xB9, 0x5A, 0xAA, 0x2D, 0x14, 0xD3, 0x0D, 0x2D, 0x2A, 0xD3, 0xED,
+    0x50, 0x38, 0xD7, 0x8D, 0x31, 0xF3, 0x8D, 0x22, 0xF3, 0x8D, 0x13, 0x38,
+    0xD0, 0x34, 0x8C, 0x44, 0x8A, 0x63, 0xA7, 0x81, 0xFD, 0xE1, 0x1B, 0xD6,
+    0xC4, 0x9D, 0x5A, 0x2F, 0x05, 0x8D, 0x4A, 0x89, 0xD3, 0x11, 0x88, 0x11,
+    0x7D, 0x22, 0x18, 0x81, 0x18, 0xD1, 0x21, 0x88, 0x12, 0x7D, 0x02, 0x28,
+    0x81, 0x28, 0xC2, 0x28, 0x81, 0x37, 0xB2, 0x38, 0x81, 0x38, 0xA2, 0x38,
+    0x81, 0x38, 0xA1, 0x48, 0x81, 0x47, 0x92, 0x48, 0x81, 0x48, 0x82, 0x48,
+    0x81, 0x57, 0x72, 0x58, 0x81, 0x58, 0x62, 0x58, 0x81, 0x67, 0x52, 0x68,
+    0x81, 0x68, 0x42, 0x68, 0x81, 0x68, 0x32, 0x78, 0x81, 0x77, 0x32, 0x78,
+    0x81, 0x78, 0x22, 0x78, 0x81, 0x87, 0x12, 0x88, 0x81, 0x8A, 0x88, 0x3F,
+    0x05, 0x19, 0x89, 0x83, 0xE2, 0x05, 0x1A, 0x6A, 0x88, 0x1B, 0x4B, 0x88,
+    0x2A, 0x4B, 0x86, 0x5A, 0x2B, 0xA2, 0xB7, 0x29, 0xD1, 0x0A, 0xC9, 0x1A,
+    0xD0, 0x54, 0xAD, 0x03, 0x6A, 0xD0, 0x27, 0x9D, 0x02, 0x7A, 0xC2, 0x7B,
+    0xB2, 0x7C, 0xA2, 0x72, 0x1A, 0x92, 0x72, 0x29, 0x92, 0x72, 0x39, 0x82,
+    0x72, 0x49, 0x72, 0x72, 0x59, 0x62, 0x72, 0x5A, 0x52, 0x72, 0x69, 0x52,
+    0x72, 0x79, 0x42, 0x72, 0x89, 0x32, 0x72, 0x99, 0x22, 0x3F, 0x04, 0x2A,
+    0x91, 0x27, 0x2B, 0xB7, 0x2C, 0xA7, 0x2D, 0x09, 0x72, 0xD1, 0x83, 0xF0,
+    0x42, 0xD2, 0x77, 0x2D, 0x36, 0x72, 0xD4, 0x57, 0x2D, 0x54, 0x73, 0xD5,
+    0x35, 0x6D, 0x43, 0x3A, 0xD3, 0x23, 0xC9, 0xD8, 0xD2, 0xD4, 0x65, 0x7D,
+    0x06, 0x96, 0xB6, 0xB6, 0x96, 0xC7, 0x77, 0xD0, 0x76, 0x6D, 0x17, 0x57,
+    0xD2, 0x73, 0x8D, 0x27, 0x38, 0xD2, 0x82, 0x7D, 0x47, 0x18, 0xD4, 0x71,
+    0xE8, 0x8D, 0x48, 0x17, 0xD4, 0x72, 0x7D, 0x38, 0x28, 0xD2, 0x81, 0xF0,
+    0x27, 0xD2, 0x75, 0x7D, 0x07, 0x76, 0xD0, 0x69, 0x6B, 0x6B, 0x69, 0x6D,
+    0x07, 0x57, 0xD3, 0xD2, 0xD8, 0x9C, 0x0D, 0x68, 0xD8, 0x78, 0x48, 0x68,
+    0x67, 0x58, 0x68, 0x48, 0x77, 0x1E, 0x50, 0x38, 0x78, 0x38, 0x77, 0x48,
+    0x68, 0x48, 0x67, 0x58, 0x48, 0x6D, 0x58, 0xD3, 0x7E, 0xB0, 0x38, 0xD4,
+    0xAD, 0x1D, 0x1C, 0xC9, 0xD8, 0xD2, 0xD4, 0x65, 0x6D, 0x16, 0x96, 0xB6,
+    0xB6, 0x96, 0xC7, 0x77, 0xD0, 0x76, 0x6D, 0x17, 0x3F, 0x02, 0x7D, 0x27,
+    0x38, 0xD2, 0x81, 0xF0, 0x17, 0xD4, 0x71, 0xE8, 0x8D, 0x48, 0x17, 0xD4,
+    0x72, 0x7D, 0x38, 0x28, 0xD2, 0x81, 0xF0, 0x27, 0xD2, 0x75, 0x7D, 0x07,
+    0x76, 0xD0, 0x69, 0x6B, 0x6B, 0x69, 0x6D, 0x06, 0x75, 0xD5, 0xD0, 0xD8,
+    0xAD, 0xBA, 0xDA, 0xBD, 0xAB, 0xDA, 0xBD, 0xAC, 0xDA, 0xD3, 0xD7, 0x94,
+    0x0D, 0x6D, 0x0D, 0x8C, 0x94, 0x8A, 0x87, 0x79, 0x87, 0x88, 0x88, 0x75,
+    0xE5, 0x03, 0x88, 0x87, 0x88, 0x78, 0x87, 0x88, 0x86, 0x89, 0x84, 0x8B,
+    0xD5, 0xD0, 0xD4, 0xBF, 0x03, 0x82, 0x8D, 0x08, 0x38, 0xC8, 0x39, 0xB8,
+    0x49, 0xA8, 0x58, 0xA8, 0x59, 0x98, 0x69, 0x88, 0x78, 0x88, 0x79, 0x78,
+    0x89, 0x68, 0x99, 0x4A, 0x89, 0x2D, 0x17, 0xA0, 0x67, 0x61, 0x5C, 0x22,
+    0x45, 0x57, 0x34, 0x95, 0x24, 0xB4, 0x24, 0xC3, 0x15, 0xC3, 0x1F, 0x5D,
+    0x02, 0x16, 0xD0, 0x11, 0x7D, 0x19, 0xCB, 0xBC, 0x9D, 0x18, 0xD2, 0x7D,
+    0x27, 0xD2, 0x8D, 0x19, 0xCB, 0xBC, 0x9D, 0x08, 0xF0, 0x1D, 0x16, 0xF0,
+    0x2D, 0x15, 0xF0, 0x3D, 0x04, 0x14, 0xB4, 0x25, 0x95, 0x27, 0x65, 0x31,
+    0x3C, 0x51, 0x67, 0x70, 0xF0, 0xDF, 0x06, 0x48, 0x4A, 0x68, 0x67, 0x78,
+    0x73, 0xF0, 0x28, 0x88, 0x2F, 0x01, 0x98, 0x91, 0xED, 0x7A, 0x8D, 0x6A,
+    0xD2, 0xD3, 0x60, 0x0D, 0x26, 0x92, 0xAB, 0x55, 0x8D, 0x03, 0x3E, 0xD8,
+    0x03, 0x8D, 0x12, 0x68, 0xD0, 0x24, 0xF0, 0x48, 0xC2, 0x97, 0xB2, 0xB7,
+    0x93, 0xC8, 0x54, 0xD2, 0xD0, 0xD6, 0x9A, 0x0D, 0x37, 0xA2, 0xBD, 0x05,
+    0x59, 0xD2, 0x37, 0x8D, 0x22, 0x98, 0xD0, 0x34, 0xF0, 0x58, 0xD0, 0x25,
+    0xF0, 0x68, 0xB2, 0xD0, 0x8A, 0x2D, 0x08, 0x92, 0xD2, 0x88, 0x27, 0xF0,
+    0x88, 0x72, 0xD4, 0x86, 0x2D, 0x48, 0x52, 0xD6, 0x84, 0x2D, 0x68, 0x33,
+    0xD6, 0x83, 0x2D, 0x88, 0x22, 0xD8, 0x81, 0x2B, 0xF0, 0xCA, 0xBF, 0x0D,
+    0x08, 0xDC, 0x7D, 0x0F, 0x0D, 0x16, 0xD0, 0xF0, 0xD2, 0x4D, 0x1F, 0x0D,
+    0x32, 0xD2, 0x0D, 0x04, 0xD2, 0x49, 0x1A, 0x8A, 0x95, 0x48, 0xA8, 0xB3,
+    0x67, 0xB7, 0xB3, 0x68, 0xA8, 0xA3, 0x68, 0xA8, 0xA2, 0x87, 0xB7, 0xA2,
+    0x88, 0xA7, 0x93, 0x88, 0x99, 0x82, 0xA7, 0x99, 0x82, 0xA8, 0x89, 0x73,
+    0xA8, 0x72, 0x18, 0x62, 0xC7, 0x72, 0x27, 0x62, 0xC8, 0x62, 0x27, 0x53,
+    0xC8, 0x52, 0x38, 0x42, 0xD1, 0x75, 0x24, 0x74, 0x2D, 0x18, 0x32, 0x57,
+    0x33, 0x7F, 0x08, 0x73, 0x26, 0x72, 0x2D, 0x38, 0x12, 0x77, 0x13, 0xD4,
+    0x71, 0x28, 0x61, 0x29, 0xF0, 0x99, 0x99, 0xD6, 0x8A, 0x7A, 0xF0, 0xA7,
+    0xB7, 0xD8, 0x6C, 0x5B, 0xF0, 0xB5, 0xD0, 0x5B, 0xE2, 0x0C, 0x3D, 0x23,
+    0xDC, 0x1D, 0x41, 0xD0, 0x0D, 0x34, 0xC2, 0xBA, 0x66, 0xAA, 0x49, 0x9A,
+    0x3A, 0x9A, 0x2C, 0x98, 0x3D, 0x09, 0x63, 0xD1, 0x96, 0x2D, 0x39, 0x42,
+    0xD5, 0x92, 0x3D, 0x59, 0x22, 0xD7, 0xBD, 0x9A, 0xD9, 0x9D, 0xB9, 0xDB,
+    0x8D, 0xB9, 0xDB, 0x9D, 0x9A, 0xD9, 0xBD, 0x72, 0x28, 0xD6, 0x23, 0x9D,
+    0x43, 0x49, 0xD3, 0x26, 0x8D, 0x22, 0x79, 0xD0, 0x38, 0x9B, 0x3A, 0x8A,
+    0x3B, 0x99, 0x3C, 0x97, 0x4C, 0x95, 0x7A, 0xB2, 0xC4, 0xD3, 0x0D, 0x36,
+    0xA1, 0xBD, 0x06, 0x1F, 0x03, 0x9D, 0x13, 0x78, 0xD0, 0x38, 0x9C, 0x2A,
+    0x8C, 0x2A, 0x9A, 0x2C, 0x89, 0x3D, 0x08, 0x82, 0xD1, 0x87, 0x2D, 0x38,
+    0x62, 0xD3, 0x94, 0x2D, 0x58, 0x33, 0xD5, 0x92, 0x2D, 0x78, 0x12, 0xD8,
+    0xBB, 0xF0, 0xB9, 0xCE, 0xA0, 0xC8, 0xDA, 0xAD, 0x7D, 0x19, 0x2D, 0xC3,
+    0xDB, 0x47, 0x89, 0x45, 0xA8, 0x53, 0xB9, 0x53, 0xB8, 0x62, 0xB8, 0x63,
+    0xA9, 0x62, 0xB8, 0x72, 0xA9, 0xD5, 0x9D, 0x68, 0xD6, 0x9D, 0x68, 0xD6,
+    0x9D, 0x59, 0xD6, 0x8D, 0x69, 0xD5, 0x9D, 0x68, 0xD6, 0x9D, 0x68, 0xD0,
+    0x15, 0x9C, 0x24, 0x9D, 0x02, 0x48, 0xD1, 0x23, 0x9D, 0x03, 0x38, 0xD0,
+    0x42, 0x9C, 0x42, 0x9C, 0x52, 0x8A, 0x81, 0xFD, 0xE1, 0xF0, 0xD4, 0x5E,
+    0xDF, 0x56, 0xE4, 0x56, 0xFB, 0x04, 0xB5, 0xAF, 0x01, 0x4B, 0x59, 0xF0,
+    0x24, 0xB5, 0x8F, 0x03, 0x4B, 0x57, 0xF0, 0x44, 0xB5, 0x6F, 0x05, 0x4B,
+    0x55, 0xF0, 0x64, 0xB5, 0x4E, 0x20, 0x74, 0x4E, 0x20, 0x84, 0x3E, 0x20,
+    0x94, 0x2E, 0x20, 0xA4, 0xC4, 0xF0, 0xB5, 0x6E, 0xDF, 0x65, 0xE4, 0x65,
+    0xF0, 0xB0, 0x94, 0xD3, 0x5D, 0x36, 0xD1, 0x7D, 0x18, 0xC4, 0x14, 0xC4,
+    0x24, 0xA4, 0x34, 0xA4, 0x44, 0x84, 0x54, 0x84, 0x64, 0x64, 0x74, 0x64,
+    0x84, 0x44, 0x94, 0x44, 0x95, 0x24, 0xB4, 0x24, 0xB5, 0xE2, 0x0D, 0xB0,
+    0x13, 0x75, 0x6F, 0x67, 0x57, 0x58, 0x48, 0x49, 0x30, 0x68, 0xCC, 0x85,
+    0x46, 0x74, 0x66, 0x55, 0x75, 0x4E, 0x20, 0x16, 0x66, 0x54, 0x76, 0xD3,
+    0x6D, 0x18, 0xBB, 0x95, 0x26, 0x75, 0x46, 0x56, 0x56, 0x3F, 0x01, 0x66,
+    0x63, 0xF7, 0x66, 0x37, 0x57, 0x38, 0x38, 0x4B, 0x19, 0x1A, 0x36, 0x56,
+    0x55, 0x30, 0x09, 0xD5, 0x7D, 0x3E, 0x60, 0x36, 0xD6, 0x63, 0x79, 0x61,
+    0xB7, 0x84, 0x76, 0x76, 0x75, 0x68, 0x62, 0xF0, 0x36, 0x87, 0x1E, 0x70,
+    0x36, 0x97, 0xF3, 0x69, 0x64, 0x68, 0x71, 0xF0, 0x36, 0x86, 0x57, 0x66,
+    0x63, 0x23, 0x46, 0x72, 0x4A, 0x91, 0x76, 0x80, 0x86, 0xBA, 0x75, 0x35,
+    0x55, 0x55, 0x1F, 0x02, 0x56, 0x52, 0x57, 0x52, 0x58, 0x33, 0x5D, 0x0E,
+    0x56, 0xD0, 0xF7, 0xCF, 0x01, 0x7D, 0x07, 0x81, 0x48, 0x52, 0x4D, 0x17,
+    0xAB, 0x66, 0xBA, 0xD4, 0x73, 0xE6, 0x0D, 0x26, 0x96, 0x36, 0x89, 0x16,
+    0x67, 0x38, 0x66, 0x57, 0x56, 0x76, 0x47, 0x76, 0x3F, 0x01, 0x68, 0x63,
+    0xE8, 0x78, 0x64, 0x68, 0x64, 0x77, 0x63, 0xF0, 0x26, 0x67, 0x66, 0x49,
+    0x6A, 0x19, 0x66, 0x33, 0x60, 0x66, 0xAA, 0x74, 0x44, 0x55, 0x45, 0x44,
+    0x64, 0x2F, 0x01, 0x56, 0x51, 0x66, 0x51, 0x66, 0x6F, 0x0D, 0x5E, 0x30,
+    0x6C, 0xF7, 0xC6, 0xC7, 0x82, 0x26, 0x72, 0x38, 0x42, 0x5C, 0x7A, 0xA6,
+    0x60, 0x86, 0x9A, 0x65, 0x33, 0x55, 0x44, 0x45, 0x35, 0x36, 0x35, 0x36,
+    0x43, 0x1E, 0x30, 0x36, 0x8F, 0xD0, 0x4E, 0xD4, 0x03, 0x6A, 0x87, 0xD0,
+    0x40, 0x57, 0xAD, 0x32, 0x54, 0x81, 0x56, 0x44, 0x56, 0x52, 0xE4, 0x66,
+    0x62, 0x56, 0x62, 0x56, 0x54, 0x54, 0x65, 0x43, 0x68, 0x99, 0x2D, 0x23,
+    0xD2, 0x4D, 0x25, 0xD0, 0xD2, 0x4D, 0x42, 0xD5, 0x2D, 0x52, 0xD4, 0x4D,
+    0x21, 0x4A, 0x4F, 0x04, 0xC7, 0xB3, 0x25, 0x83, 0x4D, 0x17, 0x96, 0x09,
+    0xD4, 0x7D, 0x2E, 0x60, 0x36, 0xD5, 0x64, 0x68, 0x62, 0x97, 0x61, 0xB6,
+    0x93, 0x66, 0x76, 0x62, 0xED, 0x20, 0x36, 0x76, 0x48, 0x58, 0x1B, 0x3A,
+    0x44, 0x56, 0x3E, 0x20, 0x18, 0x47, 0x64, 0x3E, 0x30, 0xB9, 0x47, 0x2E,
+    0xD4, 0x03, 0x64, 0x81, 0xB0, 0x93, 0x97, 0xE2, 0x68, 0x77, 0x85, 0x1E,
+    0x30, 0xD6, 0x97, 0x7E, 0xD8, 0x86, 0x13, 0x46, 0xF0, 0x53, 0x51, 0x44,
+    0x51, 0x43, 0x53, 0xA6, 0x65, 0x09, 0xD5, 0x7D, 0x3E, 0x70, 0x36, 0xD6,
+    0x64, 0xA5, 0x66, 0x67, 0x67, 0x39, 0x67, 0x2A, 0x66, 0x2B, 0x65, 0x2C,
+    0x64, 0x2D, 0x06, 0x33, 0xD0, 0x62, 0x4D, 0x06, 0x16, 0x9F, 0x03, 0xD1,
+    0xB6, 0x27, 0x7F, 0x03, 0x63, 0x79, 0x64, 0x78, 0x65, 0x77, 0x65, 0x86,
+    0x66, 0x76, 0x66, 0x84, 0x85, 0x91, 0xB3, 0xB0, 0x09, 0x47, 0x2E, 0xDE,
+    0x03, 0x64, 0x81, 0xB0, 0xD0, 0x67, 0x65, 0x92, 0x94, 0x96, 0x71, 0xB2,
+    0xB6, 0x84, 0xA3, 0x66, 0x76, 0x76, 0x62, 0xED, 0x20, 0x36, 0x76, 0x76,
+    0x48, 0x58, 0x58, 0x1B, 0x3A, 0x3A, 0xD0, 0x65, 0x92, 0x96, 0x71, 0xB6,
+    0x93, 0x66, 0x76, 0x62, 0xED, 0x20, 0x36, 0x76, 0x48, 0x58, 0x1B, 0x3A,
+    0x77, 0xCB, 0x95, 0x35, 0x75, 0x55, 0x56, 0x56, 0x45, 0x75, 0x2F, 0x01,
+    0x67, 0x61, 0xE7, 0x77, 0x7F, 0x16, 0x76, 0x35, 0x75, 0x46, 0x56, 0x55,
+    0x55, 0x75, 0x35, 0x9B, 0xC7, 0x70, 0xC6, 0x69, 0x1A, 0x6A, 0x36, 0x3F,
+    0x03, 0x76, 0x65, 0x67, 0x74, 0x68, 0x61, 0xE8, 0x03, 0x68, 0x7F, 0x36,
+    0x86, 0x46, 0x77, 0x46, 0x76, 0x57, 0x56, 0x68, 0x37, 0x66, 0x19, 0x86,
+    0x36, 0x6E, 0x50, 0x36, 0xD4, 0x8D, 0x1D, 0x0B, 0x85, 0x71, 0x8A, 0x42,
+    0x76, 0x33, 0x23, 0x66, 0x57, 0x3F, 0x02, 0x67, 0x64, 0x77, 0x63, 0xF0,
+    0x16, 0x86, 0x3E, 0x77, 0x86, 0x46, 0x86, 0x3F, 0x01, 0x77, 0x65, 0x75,
+    0x76, 0x73, 0x87, 0xA1, 0x69, 0x63, 0x63, 0xE5, 0x0D, 0x26, 0xD4, 0x8D,
+    0x1C, 0xD0, 0x42, 0x92, 0x73, 0x71, 0x93, 0xD3, 0x38, 0x26, 0x37, 0x44,
+    0x1E, 0xD1, 0x03, 0x6C, 0x89, 0xC7, 0x45, 0x41, 0x4B, 0x33, 0x45, 0x23,
+    0x73, 0x1F, 0x48, 0x21, 0x58, 0x11, 0x69, 0x87, 0xA6, 0xB4, 0xC4, 0xC5,
+    0xA7, 0x98, 0x88, 0x88, 0x5F, 0x02, 0x97, 0x83, 0x15, 0x44, 0x22, 0x19,
+    0x31, 0x46, 0x40, 0x71, 0xC2, 0x6F, 0x05, 0x3A, 0x49, 0x58, 0x67, 0x76,
+    0xFC, 0x2E, 0xD1, 0x02, 0x66, 0xF0, 0x26, 0x41, 0x37, 0x22, 0x49, 0x58,
+    0x75, 0x50, 0x09, 0x49, 0x57, 0x67, 0x3E, 0xD2, 0x03, 0x67, 0x66, 0x66,
+    0x76, 0x74, 0x96, 0xB1, 0x95, 0x92, 0x5A, 0x64, 0x18, 0x0C, 0x37, 0x28,
+    0x74, 0x38, 0x82, 0x57, 0x82, 0x57, 0x72, 0x77, 0x62, 0x77, 0x61, 0x96,
+    0x52, 0x97, 0x42, 0x97, 0x32, 0xB7, 0x22, 0xB7, 0x21, 0xD0, 0x61, 0x2D,
+    0x09, 0xD0, 0x87, 0xF0, 0x87, 0x7F, 0x09, 0x5D, 0x44, 0x9F, 0x0A, 0x3D,
+    0x71, 0xA0, 0x0B, 0x2B, 0x27, 0x19, 0x57, 0x63, 0x47, 0x67, 0x63, 0x56,
+    0x76, 0x62, 0x67, 0x66, 0x62, 0x67, 0x67, 0x51, 0x86, 0x67, 0x42, 0x87,
+    0x48, 0x42, 0x96, 0x48, 0x41, 0xA6, 0x41, 0x26, 0x22, 0xA7, 0x22, 0x26,
+    0x22, 0xB6, 0x22, 0x26, 0x12, 0xC9, 0x48, 0xC9, 0x47, 0x7F, 0x07, 0x75,
+    0x7D, 0x26, 0x65, 0x8F, 0x08, 0x57, 0x5D, 0x44, 0x83, 0x9F, 0x09, 0x39,
+    0x3D, 0x61, 0xB1, 0xA0, 0x0C, 0x28, 0x19, 0x64, 0x48, 0x63, 0x67, 0x62,
+    0x78, 0x42, 0x97, 0x32, 0xB7, 0x13, 0xBA, 0x7F, 0x06, 0x8D, 0x28, 0xD2,
+    0x7D, 0x28, 0xD0, 0xAC, 0x21, 0x7B, 0x22, 0x89, 0x24, 0x78, 0x35, 0x77,
+    0x26, 0x85, 0x37, 0x74, 0x47, 0x81, 0x83, 0xB0, 0x0B, 0x37, 0x18, 0x74,
+    0x37, 0x82, 0x47, 0x72, 0x66, 0x72, 0x67, 0x62, 0x67, 0x52, 0x86, 0x52,
+    0x87, 0x42, 0x87, 0x32, 0xA6, 0x32, 0xA7, 0x22, 0xB6, 0x12, 0xC9, 0xC8,
+    0x7F, 0x07, 0x77, 0xE2, 0x08, 0x58, 0xF0, 0x93, 0xD6, 0x1A, 0xF0, 0x92,
+    0xB3, 0x51, 0xB5, 0x32, 0xB5, 0x31, 0xC5, 0x22, 0xD0, 0x7D, 0x24, 0xD2,
+    0xF1, 0xD5, 0x14, 0x67, 0x22, 0x77, 0x32, 0x68, 0x31, 0x77, 0xB8, 0xB7,
+    0x4F, 0x07, 0x7B, 0x7B, 0x8B, 0x7B, 0x8B, 0x7B, 0x77, 0x22, 0x87, 0x22,
+    0x77, 0x22, 0x86, 0x32, 0x75, 0x51, 0xFD, 0x51, 0x95, 0x76, 0x1F, 0x06,
+    0x53, 0xED, 0x00, 0x55, 0x85, 0x94, 0x84, 0x95, 0xC4, 0xA5, 0x5E, 0xD0,
+    0x05, 0x54, 0xF0, 0x65, 0xA6, 0xA5, 0xED, 0xF0, 0x4E, 0x30, 0x40, 0x05,
+    0xA6, 0x7F, 0x03, 0x56, 0xED, 0x00, 0x45, 0xA5, 0xA4, 0xC4, 0xA5, 0x74,
+    0x95, 0x4E, 0xD0, 0x04, 0x55, 0xF0, 0x35, 0x76, 0x75, 0x90, 0x45, 0xD2,
+    0xA7, 0x13, 0xD0, 0x43, 0x2D, 0x81, 0x35, 0xC3, 0x18, 0x9D, 0x35, 0x30};
+
+const GFXglyph FreeSerifBold24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 12, 0, 1},          // 0x20 ' '
+    {0, 8, 34, 16, 4, -32},       // 0x21 '!'
+    {27, 17, 13, 26, 4, -32},     // 0x22 '"'
+    {41, 23, 33, 23, 0, -32},     // 0x23 '#'
+    {85, 21, 39, 24, 1, -34},     // 0x24 '$'
+    {153, 35, 34, 47, 6, -32},    // 0x25 '%'
+    {257, 34, 34, 39, 3, -32},    // 0x26 '&'
+    {337, 5, 13, 13, 4, -32},     // 0x27 '''
+    {344, 12, 41, 16, 2, -32},    // 0x28 '('
+    {378, 12, 41, 16, 1, -32},    // 0x29 ')'
+    {413, 18, 21, 24, 3, -32},    // 0x2A '*'
+    {451, 26, 25, 32, 3, -24},    // 0x2B '+'
+    {458, 8, 15, 12, 2, -6},      // 0x2C ','
+    {472, 11, 5, 16, 2, -12},     // 0x2D '-'
+    {474, 8, 8, 12, 2, -6},       // 0x2E '.'
+    {481, 15, 33, 13, -1, -32},   // 0x2F '/'
+    {517, 22, 34, 23, 1, -32},    // 0x30 '0'
+    {561, 18, 33, 23, 3, -32},    // 0x31 '1'
+    {576, 21, 33, 24, 1, -32},    // 0x32 '2'
+    {628, 21, 34, 24, 1, -32},    // 0x33 '3'
+    {676, 21, 33, 24, 1, -32},    // 0x34 '4'
+    {718, 20, 32, 23, 2, -31},    // 0x35 '5'
+    {762, 21, 34, 24, 1, -32},    // 0x36 '6'
+    {811, 21, 32, 23, 1, -31},    // 0x37 '7'
+    {855, 21, 34, 23, 1, -32},    // 0x38 '8'
+    {911, 22, 34, 23, 1, -32},    // 0x39 '9'
+    {960, 8, 24, 16, 4, -22},     // 0x3A ':'
+    {975, 9, 31, 16, 3, -22},     // 0x3B ';'
+    {998, 26, 26, 32, 3, -24},    // 0x3C '<'
+    {1036, 26, 17, 32, 3, -20},   // 0x3D '='
+    {1043, 26, 26, 32, 3, -24},   // 0x3E '>'
+    {1083, 18, 34, 24, 3, -32},   // 0x3F '?'
+    {1123, 33, 34, 44, 5, -32},   // 0x40 '@'
+    {1224, 32, 33, 34, 1, -32},   // 0x41 'A'
+    {1290, 28, 32, 31, 1, -31},   // 0x42 'B'
+    {1337, 30, 34, 33, 2, -32},   // 0x43 'C'
+    {1394, 32, 32, 34, 1, -31},   // 0x44 'D'
+    {1441, 28, 32, 32, 2, -31},   // 0x45 'E'
+    {1502, 25, 32, 29, 2, -31},   // 0x46 'F'
+    {1550, 33, 34, 36, 2, -32},   // 0x47 'G'
+    {1612, 33, 32, 37, 2, -31},   // 0x48 'H'
+    {1633, 15, 32, 18, 2, -31},   // 0x49 'I'
+    {1642, 22, 37, 24, 0, -31},   // 0x4A 'J'
+    {1662, 34, 32, 36, 2, -31},   // 0x4B 'K'
+    {1735, 28, 32, 31, 2, -31},   // 0x4C 'L'
+    {1762, 43, 32, 45, 0, -31},   // 0x4D 'M'
+    {1869, 31, 32, 34, 1, -31},   // 0x4E 'N'
+    {1950, 33, 34, 37, 2, -32},   // 0x4F 'O'
+    {2010, 26, 32, 30, 2, -31},   // 0x50 'P'
+    {2043, 33, 41, 37, 2, -32},   // 0x51 'Q'
+    {2112, 31, 32, 34, 2, -31},   // 0x52 'R'
+    {2168, 21, 34, 27, 3, -32},   // 0x53 'S'
+    {2224, 28, 32, 30, 1, -31},   // 0x54 'T'
+    {2247, 30, 33, 34, 2, -31},   // 0x55 'U'
+    {2275, 33, 32, 33, 0, -31},   // 0x56 'V'
+    {2342, 45, 33, 46, 1, -31},   // 0x57 'W'
+    {2440, 32, 32, 34, 1, -31},   // 0x58 'X'
+    {2506, 32, 32, 33, 1, -31},   // 0x59 'Y'
+    {2554, 28, 32, 30, 1, -31},   // 0x5A 'Z'
+    {2613, 11, 39, 16, 3, -31},   // 0x5B '['
+    {2621, 15, 33, 13, -1, -32},  // 0x5C '\'
+    {2657, 11, 39, 16, 2, -31},   // 0x5D ']'
+    {2666, 21, 17, 27, 3, -31},   // 0x5E '^'
+    {2697, 24, 3, 23, 0, 5},      // 0x5F '_'
+    {2700, 11, 9, 16, 0, -33},    // 0x60 '`'
+    {2709, 22, 24, 23, 1, -22},   // 0x61 'a'
+    {2750, 25, 33, 26, 0, -31},   // 0x62 'b'
+    {2792, 19, 24, 20, 1, -22},   // 0x63 'c'
+    {2822, 24, 33, 26, 1, -31},   // 0x64 'd'
+    {2861, 18, 24, 21, 1, -22},   // 0x65 'e'
+    {2893, 17, 33, 18, 1, -32},   // 0x66 'f'
+    {2917, 19, 32, 24, 2, -22},   // 0x67 'g'
+    {2963, 24, 32, 26, 0, -31},   // 0x68 'h'
+    {2988, 11, 33, 14, 1, -32},   // 0x69 'i'
+    {3005, 14, 42, 18, 0, -32},   // 0x6A 'j'
+    {3029, 25, 32, 26, 0, -31},   // 0x6B 'k'
+    {3080, 11, 32, 13, 0, -31},   // 0x6C 'l'
+    {3088, 37, 23, 39, 0, -22},   // 0x6D 'm'
+    {3114, 24, 23, 26, 0, -22},   // 0x6E 'n'
+    {3132, 21, 24, 24, 1, -22},   // 0x6F 'o'
+    {3162, 24, 32, 26, 0, -22},   // 0x70 'p'
+    {3200, 24, 32, 26, 1, -22},   // 0x71 'q'
+    {3241, 19, 23, 20, 0, -22},   // 0x72 'r'
+    {3258, 15, 24, 19, 2, -22},   // 0x73 's'
+    {3291, 14, 31, 16, 1, -29},   // 0x74 't'
+    {3314, 25, 23, 27, 0, -21},   // 0x75 'u'
+    {3333, 22, 23, 23, 0, -21},   // 0x76 'v'
+    {3374, 33, 23, 33, 0, -21},   // 0x77 'w'
+    {3436, 22, 22, 24, 1, -21},   // 0x78 'x'
+    {3476, 21, 31, 23, 0, -21},   // 0x79 'y'
+    {3528, 19, 22, 21, 1, -21},   // 0x7A 'z'
+    {3560, 14, 42, 19, 1, -33},   // 0x7B '{'
+    {3582, 4, 33, 10, 3, -32},    // 0x7C '|'
+    {3587, 14, 42, 19, 4, -33},   // 0x7D '}'
+    {3610, 22, 7, 24, 1, -14}};   // 0x7E '~'
+
+const GFXpackedFont FreeSerifBold24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeSerifBold24pt7bRLEBitmaps,
+     (GFXglyph *)FreeSerifBold24pt7bRLEGlyphs, 0x20, 0x7E, 56},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 4297 bytes, glyph bitmaps 3624 bytes (7847 uncompressed)
@@ -0,0 +1,488 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeSerifBoldItalic24pt7bRLEBitmaps[] PROGMEM = {
+    0xA4, 0x1F, 0x09, 0x6E, 0x28, 0x7F, 0x86, 0x1F, 0x08, 0x52, 0xF0, 0x75,
+    0x3F, 0x07, 0x44, 0xE2, 0x07, 0x3C, 0x2C, 0x36, 0xF0, 0x62, 0xD0, 0x18,
+    0xE3, 0x0D, 0x44, 0xA6, 0x8E, 0x28, 0x86, 0xA4, 0x90, 0x33, 0x93, 0x35,
+    0x75, 0xF1, 0x66, 0x6F, 0x15, 0x75, 0x1F, 0x01, 0x48, 0x43, 0x39, 0x33,
+    0x49, 0x33, 0xF3, 0x93, 0x42, 0xA2, 0x50, 0xD1, 0x45, 0x4D, 0x13, 0x63,
+    0x1F, 0x0D, 0x04, 0x54, 0xD1, 0x36, 0x3D, 0x14, 0x54, 0xD1, 0x36, 0x33,
+    0xF0, 0xB4, 0x54, 0xD0, 0x45, 0x44, 0xF0, 0x5D, 0x95, 0xD8, 0xA3, 0x63,
+    0x6F, 0x08, 0x45, 0x4D, 0x13, 0x63, 0x7F, 0x07, 0x45, 0x4D, 0x13, 0x63,
+    0x8F, 0x01, 0xD9, 0x5D, 0x8A, 0x36, 0x3A, 0xF0, 0x44, 0x54, 0xD1, 0x36,
+    0x3D, 0x14, 0x54, 0xD1, 0x36, 0x3C, 0xF0, 0x24, 0x54, 0xD1, 0x36, 0x3D,
+    0x14, 0x54, 0xD0, 0xD3, 0x35, 0xF0, 0xD3, 0x2D, 0x48, 0xD1, 0xCA, 0x53,
+    0x22, 0x48, 0x35, 0x23, 0x46, 0x35, 0x33, 0x46, 0x35, 0x25, 0x26, 0x45,
+    0x25, 0x26, 0x44, 0x35, 0x26, 0x53, 0x35, 0x17, 0x62, 0x26, 0x17, 0xAD,
+    0x29, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD3, 0x8D, 0x39, 0xD1, 0xAD,
+    0x13, 0x17, 0x51, 0x72, 0x36, 0x51, 0x72, 0x45, 0x42, 0x63, 0x45, 0x3F,
+    0x01, 0x26, 0x25, 0x53, 0x44, 0x35, 0x44, 0x44, 0x34, 0x46, 0x43, 0x24,
+    0x57, 0x42, 0x23, 0x5A, 0xCD, 0x18, 0xD4, 0x2D, 0x2F, 0x06, 0x3D, 0x2F,
+    0x06, 0x2D, 0x30, 0x75, 0xD0, 0x3C, 0x9A, 0x3C, 0x62, 0x36, 0x5C, 0x63,
+    0xD1, 0xB6, 0x67, 0x13, 0xC6, 0x61, 0x73, 0xAF, 0x01, 0x67, 0x16, 0x3B,
+    0x68, 0x15, 0x3C, 0x67, 0x16, 0x2D, 0x06, 0x71, 0x53, 0xD0, 0x57, 0x24,
+    0x3D, 0x15, 0x71, 0x53, 0xD1, 0x56, 0x24, 0x3D, 0x34, 0x52, 0x53, 0x75,
+    0x45, 0x32, 0x53, 0x68, 0x48, 0x62, 0x66, 0x31, 0x45, 0x73, 0x55, 0x52,
+    0xD1, 0x35, 0x66, 0x1D, 0x13, 0x46, 0x71, 0xD0, 0x34, 0x68, 0x1D, 0x02,
+    0x56, 0x81, 0xC3, 0x55, 0x91, 0xC2, 0x56, 0x81, 0xC3, 0x56, 0x81, 0x1F,
+    0x0A, 0x36, 0x58, 0x1B, 0x37, 0x57, 0x2B, 0x28, 0x56, 0x2B, 0x39, 0x54,
+    0x2C, 0x2B, 0x9C, 0x3C, 0x67, 0xD3, 0x6D, 0xD9, 0xD9, 0x53, 0x4D, 0x84,
+    0x54, 0x7F, 0x0C, 0x46, 0x4D, 0x55, 0x64, 0xD5, 0x55, 0x5D, 0x55, 0x54,
+    0xD6, 0x54, 0x4D, 0x75, 0x34, 0xD8, 0xAD, 0xA8, 0xDC, 0x6D, 0xD7, 0xDB,
+    0x95, 0xA7, 0x42, 0x66, 0x77, 0x43, 0x67, 0x47, 0x54, 0x67, 0x37, 0x56,
+    0x66, 0x28, 0x47, 0x65, 0x37, 0x57, 0x64, 0x38, 0x57, 0x73, 0x28, 0x68,
+    0x71, 0x29, 0x68, 0xA9, 0x69, 0x8A, 0x78, 0x8A, 0x79, 0x7B, 0x78, 0x87,
+    0x12, 0x95, 0xB4, 0x23, 0xD2, 0x1D, 0x05, 0xD0, 0x3B, 0x88, 0x96, 0x50,
+    0x33, 0x35, 0xF1, 0x6F, 0x15, 0x1F, 0x01, 0x43, 0x33, 0x43, 0xF3, 0x42,
+    0x50, 0xD0, 0x1B, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x49, 0x45, 0xF0, 0x44,
+    0x94, 0x95, 0x7F, 0x02, 0x49, 0x58, 0xF0, 0x14, 0x9E, 0x25, 0x9E, 0x74,
+    0xAE, 0x30, 0x13, 0xC2, 0xC3, 0x9F, 0x03, 0x29, 0xF0, 0x42, 0x8F, 0x05,
+    0x2D, 0x80, 0x71, 0xD0, 0x2D, 0x01, 0xD0, 0x2D, 0x01, 0x4F, 0x09, 0x2C,
+    0x3C, 0x22, 0xE3, 0x0A, 0x31, 0xE6, 0x0A, 0x4E, 0x29, 0x5F, 0x94, 0x1F,
+    0x08, 0x59, 0x49, 0x52, 0xF0, 0x74, 0x94, 0xA3, 0xA4, 0x94, 0xA3, 0xA3,
+    0xA3, 0xA2, 0xB2, 0xC1, 0xD0, 0x83, 0x8E, 0x20, 0x75, 0x83, 0x43, 0x43,
+    0x15, 0x33, 0x35, 0xF0, 0x63, 0x13, 0x61, 0x62, 0x12, 0x61, 0xF0, 0x75,
+    0x86, 0x21, 0x26, 0x1F, 0x63, 0x13, 0xB3, 0x33, 0x51, 0x34, 0x34, 0x31,
+    0xE2, 0x07, 0x5D, 0x23, 0x80, 0xE8, 0x94, 0x9E, 0x3D, 0x9E, 0x99, 0x49,
+    0x44, 0x56, 0x1E, 0x20, 0x37, 0x46, 0x55, 0xF6, 0x37, 0x27, 0x27, 0x27,
+    0x26, 0x37, 0x18, 0xF1, 0xB1, 0xA1, 0xFB, 0x10, 0x24, 0x36, 0x1E, 0x28,
+    0x16, 0x34, 0x20, 0xD2, 0x4F, 0xD1, 0x41, 0xF0, 0xD0, 0x42, 0xF0, 0xC4,
+    0x3F, 0x0B, 0x4D, 0x15, 0x4F, 0x0A, 0x45, 0xF0, 0x94, 0x6F, 0x08, 0x47,
+    0xF0, 0x74, 0x8F, 0x06, 0x4D, 0x15, 0x9F, 0x05, 0x4A, 0xF0, 0x44, 0xBF,
+    0x03, 0x4C, 0xF0, 0x24, 0xD1, 0x5D, 0x14, 0xD1, 0x5D, 0x14, 0xD2, 0xC5,
+    0xD2, 0x33, 0x3B, 0x45, 0x39, 0x55, 0x32, 0xF0, 0x65, 0x64, 0x65, 0x74,
+    0x56, 0x75, 0x46, 0x66, 0xF3, 0x67, 0x62, 0x77, 0x62, 0x68, 0x6E, 0x21,
+    0x77, 0x71, 0x68, 0x61, 0xE2, 0x77, 0x71, 0x68, 0x62, 0xF6, 0x77, 0x2F,
+    0x67, 0x63, 0xF5, 0x76, 0x54, 0x66, 0x64, 0x65, 0x83, 0x64, 0x93, 0x54,
+    0xB3, 0x34, 0xD1, 0x6B, 0xD4, 0x3B, 0x88, 0xCD, 0x07, 0x1E, 0x20, 0xC6,
+    0xD0, 0x72, 0xF0, 0xB6, 0x3F, 0x0A, 0x73, 0xF0, 0xA6, 0xD0, 0x74, 0xE2,
+    0x09, 0x6D, 0x07, 0x5F, 0x08, 0x66, 0xF0, 0x77, 0x6F, 0x07, 0x6D, 0x07,
+    0x7F, 0x06, 0x68, 0xF0, 0x57, 0xBA, 0x7D, 0x34, 0xC5, 0xD1, 0xAB, 0xC9,
+    0xD1, 0x73, 0x57, 0x72, 0x77, 0x52, 0x87, 0x42, 0xA6, 0xE2, 0xD3, 0x6D,
+    0x35, 0xD3, 0x6D, 0x35, 0xD3, 0x6D, 0x35, 0xD3, 0x5D, 0x44, 0xD4, 0x4D,
+    0x44, 0xD4, 0x4D, 0x44, 0xD4, 0x3D, 0x53, 0x92, 0x73, 0xA1, 0x73, 0xA2,
+    0x63, 0xA2, 0x6D, 0x35, 0xD4, 0x4D, 0x44, 0xD5, 0x4D, 0x45, 0xC6, 0xD1,
+    0xAA, 0xD0, 0x82, 0x57, 0x72, 0x77, 0x61, 0x96, 0xE2, 0xD3, 0x6D, 0x35,
+    0xD3, 0x6D, 0x26, 0xD2, 0x5D, 0x35, 0xD1, 0x8C, 0xBD, 0x0A, 0xD2, 0x82,
+    0xF0, 0xD0, 0x72, 0xE3, 0x0D, 0x16, 0x2F, 0x0D, 0x15, 0xD4, 0x45, 0x39,
+    0x54, 0x58, 0x45, 0x66, 0x46, 0x74, 0x48, 0xCC, 0x7C, 0xD8, 0x3D, 0x84,
+    0xD7, 0x5D, 0x66, 0xD5, 0x6D, 0x57, 0xD4, 0x8D, 0x39, 0xD2, 0x21, 0x6D,
+    0x22, 0x26, 0xD1, 0x23, 0x6D, 0x02, 0x36, 0xD0, 0x24, 0x6C, 0x25, 0x6B,
+    0x26, 0x6B, 0x25, 0x6B, 0x26, 0x6A, 0x27, 0x69, 0x27, 0x78, 0x28, 0x68,
+    0x29, 0x66, 0xF0, 0x1D, 0x84, 0xD7, 0x4D, 0x8D, 0x36, 0x7E, 0x20, 0xB6,
+    0xD5, 0x78, 0xF0, 0xA6, 0x90, 0xAD, 0x01, 0xF0, 0x9D, 0x1A, 0xD0, 0xAD,
+    0x1A, 0x2D, 0x1F, 0x07, 0x2D, 0x82, 0xD9, 0x6D, 0x4A, 0xD1, 0xBD, 0x0C,
+    0xBD, 0x1D, 0x1B, 0xD3, 0x8D, 0x48, 0xD4, 0x74, 0xF0, 0xD1, 0x64, 0xE2,
+    0x0D, 0x25, 0x4F, 0x0D, 0x24, 0xD6, 0x47, 0x49, 0x46, 0x67, 0x47, 0x66,
+    0x48, 0x74, 0x4A, 0xCD, 0x17, 0xD1, 0xD7, 0x3D, 0x36, 0xD2, 0x5D, 0x36,
+    0xD2, 0x6D, 0x36, 0xD3, 0x6D, 0x27, 0xD3, 0x6D, 0x37, 0xD2, 0x7D, 0x27,
+    0xD3, 0xD0, 0x9D, 0x28, 0x74, 0x56, 0x76, 0x55, 0x76, 0x64, 0x67, 0x63,
+    0xF7, 0x76, 0x3E, 0x26, 0x77, 0x35, 0x86, 0x4F, 0x57, 0x75, 0x47, 0x66,
+    0x46, 0x67, 0x46, 0x59, 0x44, 0x5B, 0xBD, 0x17, 0xB0, 0xF4, 0xD5, 0x5D,
+    0x45, 0xD5, 0x5D, 0x45, 0x3B, 0x36, 0x1C, 0x45, 0x2B, 0x46, 0x1C, 0x45,
+    0xF0, 0xD0, 0x4D, 0x54, 0x7F, 0x0B, 0x48, 0xF0, 0xA4, 0xD5, 0x4D, 0x55,
+    0xD5, 0x4B, 0xF0, 0x74, 0xD5, 0x4D, 0x55, 0xD5, 0x4D, 0x1F, 0x04, 0x4D,
+    0x54, 0xD5, 0x5D, 0x54, 0xD5, 0x5D, 0x54, 0xD5, 0xB5, 0xD1, 0x9B, 0x43,
+    0x49, 0x45, 0x41, 0xF0, 0x64, 0x74, 0xE2, 0x55, 0x74, 0x56, 0x64, 0x56,
+    0x54, 0x67, 0x44, 0x77, 0x24, 0x8B, 0xB9, 0xC8, 0xD1, 0x8B, 0xB8, 0x42,
+    0x86, 0x44, 0x75, 0x46, 0x63, 0xF0, 0x14, 0x86, 0x2E, 0x34, 0xA5, 0x24,
+    0xA4, 0x43, 0xA4, 0x44, 0x84, 0x64, 0x64, 0x84, 0x44, 0xB7, 0x90, 0xC6,
+    0xD1, 0xBB, 0x63, 0x49, 0x65, 0x38, 0x66, 0x46, 0x76, 0x46, 0x67, 0x54,
+    0x77, 0x54, 0x68, 0x5F, 0x37, 0x76, 0xF3, 0x68, 0x6F, 0x36, 0x77, 0x36,
+    0x76, 0x1F, 0x04, 0x56, 0x76, 0x54, 0x78, 0xD2, 0x9D, 0x0D, 0x37, 0xD2,
+    0x7D, 0x27, 0xD3, 0x6D, 0x36, 0xD3, 0x6D, 0x36, 0xD3, 0x6D, 0x35, 0xD3,
+    0x5D, 0x35, 0xD3, 0x3D, 0x70, 0x74, 0x86, 0x1E, 0x20, 0x58, 0x66, 0x84,
+    0x2E, 0x70, 0xD2, 0x48, 0x66, 0xE2, 0x86, 0x68, 0x47, 0x94, 0xA6, 0x1E,
+    0x20, 0x78, 0x86, 0xA4, 0x2E, 0x70, 0xD6, 0x4A, 0x66, 0xE2, 0x03, 0x79,
+    0x6A, 0x55, 0xF0, 0x63, 0xB3, 0xC2, 0xC2, 0xB3, 0xA3, 0xDE, 0xDA, 0x1D,
+    0x83, 0xD6, 0x5D, 0x47, 0xD1, 0xAC, 0xAC, 0xAB, 0xBB, 0xAC, 0xAC, 0xAD,
+    0x09, 0xD2, 0x6D, 0x58, 0xD3, 0xBD, 0x3A, 0xD3, 0xAD, 0x3B, 0xD3, 0xAD,
+    0x3A, 0xD3, 0xAD, 0x38, 0xD6, 0x5D, 0x83, 0xDA, 0x10, 0xE3, 0x0D, 0xBE,
+    0x5D, 0xBE, 0x3D, 0xB0, 0x01, 0xDA, 0x3D, 0x85, 0xD6, 0x8D, 0x3A, 0xD3,
+    0xAD, 0x3A, 0xD3, 0xBD, 0x3A, 0xD3, 0xAD, 0x3B, 0xD3, 0x8D, 0x56, 0xD3,
+    0x8D, 0x1A, 0xBB, 0xBA, 0xCA, 0xBB, 0xBA, 0xCA, 0xD1, 0x8D, 0x36, 0xD5,
+    0x3D, 0x81, 0xDA, 0x76, 0xAA, 0x74, 0x35, 0x63, 0x55, 0x44, 0x56, 0xE2,
+    0x35, 0x46, 0x43, 0x56, 0xB7, 0xB6, 0x1F, 0x0A, 0x6B, 0x5D, 0x04, 0xD0,
+    0x4D, 0x04, 0xD1, 0x29, 0xF0, 0x62, 0xAF, 0x05, 0x2B, 0xE3, 0x0D, 0x74,
+    0xD0, 0x6B, 0xE2, 0x8B, 0x6D, 0x04, 0xC0, 0xD0, 0x9D, 0x8D, 0x2D, 0x36,
+    0x75, 0xD1, 0x4D, 0x04, 0xA5, 0xD3, 0x38, 0x5D, 0x53, 0x65, 0xD7, 0x35,
+    0x4A, 0x45, 0x12, 0x24, 0x59, 0x61, 0x42, 0x33, 0x49, 0x42, 0x63, 0x22,
+    0x58, 0x43, 0x54, 0x31, 0x57, 0x45, 0x45, 0x2F, 0x05, 0x74, 0x64, 0x52,
+    0xF0, 0x56, 0x46, 0x46, 0x75, 0x56, 0x46, 0x75, 0x46, 0x46, 0x85, 0x46,
+    0x46, 0x21, 0x55, 0x45, 0x47, 0x21, 0x55, 0x44, 0x56, 0x23, 0x54, 0x52,
+    0x65, 0x33, 0x55, 0x62, 0x44, 0x34, 0x56, 0x43, 0xA6, 0x5D, 0x16, 0x94,
+    0xDF, 0x01, 0x5D, 0xF0, 0x15, 0xDF, 0x01, 0x5D, 0xF0, 0x15, 0xD1, 0x3D,
+    0x06, 0x95, 0xD2, 0xD3, 0xD7, 0x9B, 0xD8, 0x28, 0xF0, 0xD7, 0x38, 0xF0,
+    0xD6, 0x4D, 0xD5, 0x8F, 0x0D, 0x47, 0xDA, 0x87, 0xF0, 0xD2, 0x21, 0x6D,
+    0x82, 0x26, 0x7F, 0x0D, 0x02, 0x37, 0x6F, 0x0C, 0x25, 0x6D, 0x42, 0x66,
+    0xD3, 0x27, 0x6D, 0x32, 0x77, 0xD1, 0x28, 0x75, 0xF0, 0x8D, 0x55, 0xF0,
+    0x72, 0xB6, 0xB2, 0xC7, 0x93, 0xC7, 0x92, 0xD0, 0x78, 0x3D, 0x07, 0x73,
+    0xD1, 0x77, 0x3D, 0x18, 0x46, 0xCA, 0x29, 0x8D, 0x10, 0x7D, 0x5D, 0x2D,
+    0x6D, 0x07, 0x48, 0xC7, 0x58, 0xB7, 0x68, 0xE3, 0x97, 0x78, 0x87, 0x87,
+    0x97, 0x78, 0x97, 0x77, 0xA6, 0x77, 0xA7, 0x47, 0xD0, 0xD2, 0xD3, 0x74,
+    0x7C, 0x77, 0x74, 0xF0, 0x67, 0x87, 0x97, 0x88, 0x2E, 0x20, 0x57, 0x98,
+    0x76, 0x99, 0x67, 0x98, 0x77, 0x89, 0x77, 0x88, 0x77, 0x88, 0x88, 0x59,
+    0x8D, 0x88, 0xD7, 0xB0, 0xD2, 0x85, 0x1C, 0xD1, 0x12, 0xA8, 0x56, 0x97,
+    0x85, 0x78, 0xA3, 0x78, 0xB3, 0x68, 0xD0, 0x26, 0x7D, 0x12, 0x58, 0xD1,
+    0x21, 0xF0, 0x38, 0xD2, 0x12, 0xF0, 0x28, 0xD7, 0x9D, 0x6F, 0x01, 0x8D,
+    0x7F, 0x9D, 0x7E, 0x68, 0xD9, 0x7D, 0x98, 0xD1, 0x26, 0x7D, 0x02, 0x78,
+    0xB3, 0x87, 0xA3, 0xB7, 0x63, 0xD1, 0xD1, 0xD5, 0x8C, 0x7D, 0x5D, 0x4D,
+    0x8D, 0x47, 0x67, 0xD2, 0x78, 0x6D, 0x17, 0x87, 0xC7, 0xA7, 0x2E, 0x20,
+    0x97, 0xB7, 0x1E, 0x20, 0x87, 0xC8, 0x86, 0xD0, 0x8F, 0x77, 0xD0, 0x87,
+    0x7C, 0x96, 0x7D, 0x09, 0xF6, 0x7D, 0x08, 0x77, 0xC9, 0x67, 0xD0, 0x87,
+    0x7C, 0x97, 0x7C, 0x88, 0x6C, 0x88, 0x7C, 0x79, 0x7B, 0x7A, 0x7A, 0x7A,
+    0x79, 0x8B, 0x86, 0x8C, 0xD8, 0xCD, 0x6D, 0x30, 0x7D, 0xC9, 0xDA, 0xA8,
+    0x76, 0xB7, 0xA4, 0xB7, 0xB3, 0xA7, 0xD0, 0x21, 0xF0, 0x97, 0xD0, 0x1B,
+    0x7D, 0xB7, 0x82, 0xD2, 0x78, 0x1D, 0x37, 0x72, 0xD3, 0x66, 0x4D, 0x2D,
+    0x4D, 0x2D, 0x3D, 0x37, 0x45, 0xD2, 0x76, 0x49, 0xE2, 0x06, 0x77, 0x2D,
+    0x27, 0x81, 0xD3, 0x7D, 0x31, 0x87, 0xD2, 0x28, 0x6D, 0x22, 0x87, 0xD2,
+    0x28, 0x7D, 0x13, 0x87, 0xC4, 0x87, 0xB6, 0x88, 0x79, 0x7D, 0xC5, 0xDD,
+    0x60, 0x7D, 0xB9, 0xD9, 0xA8, 0x66, 0xB7, 0x94, 0xB7, 0xA3, 0xA7, 0xC2,
+    0x1F, 0x09, 0x7C, 0x1B, 0x7D, 0xA7, 0x82, 0xD1, 0x78, 0x1D, 0x27, 0x72,
+    0xD2, 0x66, 0x4D, 0x1D, 0x4D, 0x1D, 0x3D, 0x27, 0x45, 0xD1, 0x76, 0x48,
+    0xE2, 0x06, 0x77, 0x29, 0xF0, 0x57, 0x81, 0xD2, 0x7D, 0xB6, 0xD7, 0xE2,
+    0x04, 0x7D, 0x7F, 0x03, 0x8D, 0x99, 0xD7, 0xD1, 0xD4, 0xD3, 0x86, 0x1D,
+    0x0D, 0x21, 0x3B, 0x86, 0x6B, 0x79, 0x59, 0x8B, 0x48, 0x8C, 0x38, 0x8D,
+    0x12, 0x87, 0xD2, 0x27, 0x8D, 0x21, 0x78, 0xD3, 0x17, 0x8D, 0x8F, 0x02,
+    0x8D, 0xA9, 0xD9, 0xF0, 0x18, 0xDA, 0x9D, 0xA9, 0xAD, 0x8D, 0x09, 0x2F,
+    0x8D, 0x17, 0x3F, 0x8D, 0x16, 0x48, 0xD0, 0x75, 0x7D, 0x07, 0x57, 0xD0,
+    0x66, 0x8C, 0x67, 0x7B, 0x78, 0x7A, 0x6A, 0x79, 0x6B, 0x76, 0x7D, 0x1D,
+    0x3D, 0x69, 0xD0, 0x7D, 0x23, 0xD1, 0x9A, 0x8A, 0xC7, 0xB8, 0x3F, 0x0A,
+    0x7B, 0x7D, 0x07, 0xC7, 0x4E, 0x20, 0x97, 0xB7, 0x5E, 0x20, 0x87, 0xB7,
+    0xD1, 0x6C, 0x7D, 0x07, 0xB7, 0x7F, 0x07, 0xDC, 0xD0, 0x7C, 0x77, 0xE2,
+    0x06, 0x7B, 0x78, 0xE2, 0x05, 0x7B, 0x7D, 0x16, 0xC7, 0x9E, 0x20, 0x47,
+    0xB7, 0xAF, 0x03, 0x8A, 0x8C, 0x99, 0x9A, 0xD1, 0x3D, 0x27, 0x7D, 0x19,
+    0x93, 0xE2, 0x0A, 0x74, 0xE2, 0x09, 0x7D, 0x16, 0x6E, 0x20, 0x87, 0xD1,
+    0x67, 0xE2, 0x07, 0x77, 0xE2, 0x06, 0x7D, 0x16, 0x9E, 0x20, 0x57, 0xD1,
+    0x6A, 0xE2, 0x04, 0x7D, 0x08, 0xD0, 0x7D, 0x09, 0xAD, 0x17, 0xD0, 0xD1,
+    0xD2, 0xAD, 0x58, 0x3E, 0x20, 0xD3, 0x74, 0xE3, 0x0D, 0x27, 0x5E, 0x30,
+    0xD1, 0x76, 0xE2, 0x0D, 0x07, 0xD7, 0x68, 0xE2, 0x0C, 0x78, 0xE3, 0x0B,
+    0x79, 0xE2, 0x0A, 0x7B, 0x36, 0x6B, 0xF5, 0x47, 0xB5, 0x46, 0xC5, 0x36,
+    0xD1, 0x42, 0x7D, 0x2A, 0xD6, 0x6D, 0x40, 0x7D, 0x13, 0xA9, 0xA7, 0x6C,
+    0x7A, 0x3D, 0x17, 0x93, 0xD2, 0x78, 0x3D, 0x27, 0x83, 0xD3, 0x77, 0x3D,
+    0x47, 0x63, 0xD5, 0x75, 0x3D, 0x57, 0x53, 0xD6, 0x74, 0x3D, 0x77, 0x33,
+    0xD8, 0x63, 0x2D, 0x97, 0x15, 0xD8, 0xD0, 0xD8, 0xD1, 0xD6, 0x71, 0x7D,
+    0x0F, 0x06, 0x72, 0x7D, 0x57, 0x37, 0xD3, 0x74, 0x7B, 0xF0, 0x57, 0x57,
+    0xD2, 0x67, 0x79, 0xF0, 0x47, 0x77, 0xD0, 0x78, 0x7B, 0x79, 0x7B, 0x89,
+    0x79, 0x98, 0x96, 0xD1, 0x3D, 0x04, 0x7D, 0x1D, 0x4A, 0xAE, 0x20, 0xA7,
+    0xCE, 0x20, 0x97, 0xD9, 0x6D, 0x1E, 0x20, 0x87, 0xD9, 0x6D, 0x2E, 0x20,
+    0x77, 0xD2, 0xE2, 0x06, 0x7D, 0x96, 0xD9, 0x7D, 0x97, 0xD3, 0x15, 0x7D,
+    0x22, 0x56, 0xD2, 0x25, 0x7D, 0x22, 0x57, 0xD1, 0x35, 0x7C, 0x54, 0x7B,
+    0x65, 0x87, 0x94, 0xDC, 0x2D, 0xD3, 0x7B, 0xD3, 0xAA, 0x8D, 0x38, 0xC8,
+    0xD2, 0x83, 0xF0, 0xA8, 0xD1, 0x9D, 0x08, 0xD0, 0x9D, 0x02, 0x16, 0xCA,
+    0xD0, 0x21, 0x6C, 0x21, 0x7D, 0x02, 0x17, 0xA2, 0x26, 0xD1, 0x12, 0x79,
+    0x31, 0x7D, 0x02, 0x27, 0x92, 0x27, 0xD0, 0x22, 0x78, 0x23, 0x7D, 0x02,
+    0x27, 0x73, 0x36, 0xD0, 0x24, 0x67, 0x23, 0x7D, 0x02, 0x46, 0x62, 0x47,
+    0xD0, 0x24, 0x65, 0x34, 0x7D, 0x02, 0x46, 0x52, 0x47, 0xD0, 0x25, 0x73,
+    0x25, 0x7D, 0x02, 0x57, 0x23, 0x57, 0xD0, 0x25, 0x72, 0x26, 0x6D, 0x02,
+    0x67, 0x13, 0x57, 0xD0, 0x27, 0x96, 0x7D, 0x02, 0x78, 0x77, 0xC3, 0x78,
+    0x76, 0xD0, 0x28, 0x77, 0x79, 0xF0, 0x42, 0x86, 0x87, 0xC3, 0x85, 0x87,
+    0xD0, 0x38, 0x49, 0x7B, 0x67, 0x48, 0x99, 0xA5, 0x26, 0xD2, 0xD8, 0x1D,
+    0xF0, 0x6A, 0xBA, 0x97, 0xD0, 0x6C, 0x7D, 0x04, 0xD0, 0x7D, 0x03, 0xD1,
+    0x8C, 0x3D, 0x18, 0xC2, 0x5F, 0x09, 0x21, 0x7B, 0x2D, 0x12, 0x27, 0x93,
+    0xD1, 0x13, 0x79, 0x26, 0xF0, 0x82, 0x47, 0x82, 0xD1, 0x25, 0x76, 0x2D,
+    0x12, 0x67, 0x62, 0xD1, 0x26, 0x85, 0x2D, 0x12, 0x77, 0x52, 0xD1, 0x27,
+    0x83, 0x28, 0xF0, 0x62, 0x97, 0x32, 0xD1, 0x2A, 0x71, 0x2D, 0x12, 0xB7,
+    0x12, 0x9F, 0x05, 0x2C, 0x9D, 0x03, 0xD0, 0x7D, 0x12, 0xD1, 0x7D, 0x12,
+    0xD2, 0x6D, 0x12, 0xD2, 0x5B, 0xF0, 0x33, 0xD3, 0x4C, 0x6D, 0x24, 0xBA,
+    0xD0, 0x2D, 0xF0, 0x72, 0xC0, 0xD3, 0x7D, 0x8D, 0x0D, 0x36, 0x46, 0xD1,
+    0x58, 0x5B, 0x69, 0x69, 0x6B, 0x67, 0x7B, 0x66, 0x7C, 0x66, 0x7C, 0x74,
+    0x7D, 0x07, 0x38, 0xD0, 0x73, 0x7D, 0x17, 0x28, 0xD0, 0x82, 0x7D, 0x18,
+    0x18, 0xD1, 0x81, 0x8D, 0x17, 0x28, 0xD0, 0x82, 0x7D, 0x18, 0x18, 0xD1,
+    0x81, 0xF8, 0xD0, 0x82, 0x7D, 0x17, 0x37, 0xD0, 0x83, 0x7D, 0x07, 0x47,
+    0xC7, 0x66, 0xC7, 0x66, 0xB7, 0x76, 0xA7, 0x96, 0x96, 0xB5, 0x85, 0xD1,
+    0x55, 0x6D, 0x3D, 0x0D, 0x78, 0xD3, 0x7D, 0x5D, 0x2D, 0x6D, 0x07, 0x48,
+    0xC7, 0x58, 0xB6, 0x77, 0x1E, 0x20, 0x97, 0x78, 0x96, 0x88, 0x87, 0x88,
+    0x87, 0x79, 0x87, 0x78, 0x96, 0x78, 0x97, 0x68, 0xA7, 0x58, 0xBD, 0x5C,
+    0xD3, 0x9F, 0x06, 0x7D, 0xB6, 0xD6, 0xE2, 0x05, 0x7D, 0xB6, 0xD7, 0xE2,
+    0x04, 0x7D, 0x7F, 0x03, 0x7D, 0xA9, 0xD7, 0xD1, 0xD4, 0xD3, 0x7D, 0x8C,
+    0xD4, 0x64, 0x6D, 0x15, 0x85, 0xB6, 0x96, 0x97, 0xA6, 0x77, 0xB6, 0x67,
+    0xC6, 0x67, 0xC7, 0x47, 0xD0, 0x73, 0x8D, 0x07, 0x37, 0xD1, 0x7F, 0x28,
+    0xD0, 0x8F, 0x18, 0xD1, 0x81, 0x8D, 0x17, 0x27, 0xD1, 0x81, 0x8D, 0x18,
+    0x18, 0xD1, 0x72, 0x8D, 0x08, 0x2F, 0x7D, 0x17, 0x3F, 0x7D, 0x07, 0x47,
+    0xC7, 0x66, 0xC6, 0x76, 0xB6, 0x95, 0xA6, 0xA6, 0x86, 0xD0, 0x56, 0x6D,
+    0x26, 0x26, 0xD6, 0x9D, 0xA2, 0xDF, 0x2D, 0xF3, 0xD5, 0x27, 0xAB, 0x26,
+    0xD2, 0x63, 0x6D, 0xB6, 0xDB, 0x63, 0x7D, 0x1D, 0x78, 0xA0, 0x7D, 0x6D,
+    0x2D, 0x7D, 0x08, 0x48, 0xC7, 0x68, 0xB7, 0x78, 0x98, 0x78, 0xE2, 0x97,
+    0x88, 0x88, 0x78, 0x97, 0x88, 0x97, 0x78, 0xA7, 0x68, 0xA7, 0x59, 0xBD,
+    0x6D, 0x0D, 0x3D, 0x28, 0x18, 0x9E, 0x20, 0x67, 0x38, 0xD0, 0x84, 0x8C,
+    0x75, 0x8C, 0x76, 0x7C, 0x76, 0x8A, 0x77, 0x8A, 0x78, 0x7A, 0x78, 0x88,
+    0x88, 0x88, 0x89, 0x86, 0xA8, 0x93, 0xD1, 0x6B, 0x10, 0xB6, 0x52, 0x9B,
+    0x13, 0x85, 0x46, 0x84, 0x84, 0x1F, 0x06, 0x4A, 0x36, 0x5A, 0x31, 0xF0,
+    0x55, 0xB1, 0x76, 0xA1, 0x77, 0xD4, 0x8D, 0x48, 0xD3, 0xAD, 0x2A, 0xD2,
+    0xAD, 0x2A, 0xD2, 0x9D, 0x39, 0xD3, 0x8D, 0x48, 0xD4, 0x7D, 0x56, 0x3E,
+    0x20, 0x21, 0xD0, 0x54, 0x3C, 0x54, 0x3C, 0x45, 0x4A, 0x55, 0x49, 0x56,
+    0x66, 0x57, 0x13, 0xC7, 0x26, 0x6A, 0xF2, 0xDC, 0x27, 0x37, 0x35, 0x24,
+    0x67, 0x44, 0x23, 0x67, 0x63, 0x22, 0x77, 0x62, 0x22, 0x87, 0x71, 0x22,
+    0x86, 0x81, 0xB7, 0x81, 0x1F, 0x0A, 0x7A, 0xE2, 0x09, 0x7D, 0x76, 0xCE,
+    0x20, 0x87, 0xD7, 0x6D, 0x0E, 0x20, 0x77, 0xD0, 0xE2, 0x06, 0x7D, 0x76,
+    0xD2, 0xF0, 0x57, 0xD6, 0x8D, 0x5A, 0xD1, 0xD3, 0xB0, 0x1D, 0x26, 0xA4,
+    0xAA, 0x62, 0xF0, 0x57, 0xD1, 0x38, 0x7D, 0x12, 0x87, 0xD2, 0x28, 0x7D,
+    0x13, 0x4F, 0x04, 0x7D, 0x12, 0x87, 0xD1, 0x35, 0xF0, 0x37, 0xD1, 0x28,
+    0x7D, 0x22, 0x6E, 0x20, 0x27, 0xD1, 0x28, 0x7D, 0x22, 0x7F, 0x01, 0x7D,
+    0x12, 0x96, 0xD2, 0x28, 0xF7, 0xD1, 0x29, 0x6D, 0x22, 0x96, 0xD1, 0x39,
+    0x6D, 0x12, 0xA6, 0xD0, 0x3A, 0x6D, 0x02, 0xC6, 0xB3, 0xC6, 0xA3, 0xD1,
+    0x76, 0x4D, 0x4D, 0x0D, 0x89, 0xD4, 0x0D, 0x18, 0x92, 0xAC, 0x61, 0xF0,
+    0x38, 0xD1, 0x37, 0x7D, 0x03, 0x87, 0xD0, 0x29, 0x7C, 0x39, 0x7C, 0x2A,
+    0x8A, 0x3A, 0x89, 0x3C, 0x79, 0x2D, 0x07, 0x83, 0xD0, 0x78, 0x2D, 0x17,
+    0x72, 0xD2, 0x76, 0x3D, 0x27, 0x62, 0xD3, 0x84, 0x2D, 0x57, 0x33, 0xD5,
+    0x73, 0x2D, 0x67, 0x22, 0xD7, 0x71, 0x3D, 0x77, 0x12, 0xD8, 0xAD, 0x98,
+    0xD3, 0xF0, 0x77, 0xDB, 0x6D, 0x5F, 0x07, 0x5D, 0xD4, 0xD7, 0xF0, 0x82,
+    0xD8, 0x0D, 0x03, 0xC4, 0x92, 0xA6, 0x89, 0x54, 0x88, 0x6A, 0x36, 0x79,
+    0x6A, 0x33, 0xF0, 0x47, 0x86, 0xA2, 0x87, 0x87, 0x82, 0x97, 0x78, 0x82,
+    0x97, 0x78, 0x72, 0xA7, 0x62, 0x16, 0x72, 0xA7, 0x62, 0x16, 0x62, 0xC6,
+    0x52, 0x26, 0x62, 0xC6, 0x52, 0x27, 0x42, 0xD0, 0x74, 0x13, 0x74, 0x2D,
+    0x07, 0x32, 0x37, 0x32, 0xD1, 0x73, 0x14, 0x73, 0x29, 0xF0, 0x57, 0x22,
+    0x56, 0x22, 0xD2, 0x71, 0x26, 0x61, 0x2D, 0x46, 0x12, 0x66, 0x12, 0xBF,
+    0x06, 0x87, 0x8C, 0xF0, 0x67, 0x87, 0xD6, 0x69, 0x6D, 0x76, 0xA5, 0xD1,
+    0xF0, 0x74, 0xB4, 0xD2, 0xF0, 0x73, 0xC3, 0xD3, 0xF0, 0x72, 0xD0, 0x2D,
+    0x40, 0x6D, 0x14, 0xA8, 0x99, 0x6C, 0x7A, 0x4D, 0x07, 0x93, 0xD2, 0x78,
+    0x3D, 0x46, 0x82, 0xD5, 0x76, 0x2D, 0x67, 0x52, 0xD8, 0x64, 0x2D, 0x97,
+    0x22, 0xDA, 0x71, 0x2C, 0xF0, 0xD0, 0x8D, 0x0F, 0x0D, 0x07, 0xDF, 0x6D,
+    0xF7, 0xDD, 0x8D, 0xC9, 0xDB, 0x31, 0x7D, 0x93, 0x27, 0xD8, 0x34, 0x6D,
+    0x82, 0x57, 0xD6, 0x26, 0x7D, 0x52, 0x86, 0xD4, 0x38, 0x7D, 0x23, 0x97,
+    0xD1, 0x3A, 0x7D, 0x04, 0xA8, 0xA7, 0x99, 0x8A, 0x4D, 0x25, 0x0D, 0x05,
+    0xA2, 0x8A, 0x65, 0x7B, 0x46, 0x7B, 0x38, 0x6A, 0x39, 0x79, 0x2A, 0x78,
+    0x3B, 0x67, 0x3C, 0x76, 0x2D, 0x07, 0x52, 0xD2, 0x64, 0x3D, 0x27, 0x32,
+    0xD3, 0x72, 0x2D, 0x56, 0x12, 0xD6, 0x9D, 0x68, 0xD8, 0x6D, 0x1F, 0x07,
+    0x7D, 0x86, 0xD2, 0xE2, 0x06, 0x7D, 0x86, 0xD3, 0xE2, 0x05, 0x7D, 0x77,
+    0xD8, 0x8D, 0x69, 0xD3, 0xD2, 0xD0, 0xF6, 0xD9, 0x67, 0x78, 0x55, 0x98,
+    0x64, 0x98, 0x73, 0xA7, 0x82, 0xA8, 0x72, 0xA8, 0x81, 0xA8, 0xD7, 0x7D,
+    0x78, 0xD6, 0x8D, 0x68, 0xD7, 0x7D, 0x78, 0xD6, 0x8A, 0xF0, 0x98, 0xD6,
+    0x8D, 0x68, 0xD0, 0xF0, 0x68, 0xD6, 0x8B, 0x26, 0x8C, 0x25, 0x8C, 0x26,
+    0x8B, 0x35, 0x8B, 0x44, 0x8A, 0x54, 0x88, 0x84, 0xFD, 0xB4, 0xF9, 0xA9,
+    0x5D, 0x14, 0x6E, 0x20, 0x85, 0x6F, 0x08, 0x47, 0xF0, 0x75, 0x7F, 0x07,
+    0x48, 0xF0, 0x65, 0x8F, 0x06, 0x49, 0xF0, 0x55, 0x9F, 0x05, 0x4A, 0xF0,
+    0x45, 0xAF, 0x04, 0x4B, 0xF0, 0x35, 0xBF, 0x03, 0x4C, 0xF0, 0x25, 0xCF,
+    0x02, 0x4D, 0x0E, 0x20, 0x15, 0xD1, 0xA8, 0xB8, 0xF0, 0x49, 0xE2, 0x01,
+    0x4A, 0x38, 0xE2, 0x02, 0x47, 0xE3, 0x03, 0x46, 0xE2, 0x04, 0x4A, 0x35,
+    0xE2, 0x05, 0x44, 0xE3, 0x06, 0x43, 0xE2, 0x07, 0x4A, 0x32, 0xE2, 0x08,
+    0x41, 0xF0, 0x94, 0xF9, 0xAD, 0x15, 0xD1, 0x41, 0xE2, 0x0D, 0x05, 0xD1,
+    0x42, 0xE2, 0x0C, 0x5D, 0x14, 0x3E, 0x20, 0xB5, 0xD1, 0x44, 0xE2, 0x0A,
+    0x5D, 0x14, 0x5E, 0x20, 0x95, 0xD1, 0x46, 0xE2, 0x08, 0x5D, 0x14, 0x7E,
+    0x20, 0x75, 0x7F, 0x07, 0x48, 0xF0, 0x65, 0xD1, 0x4A, 0x99, 0xA9, 0xF8,
+    0x58, 0xF0, 0x77, 0xD0, 0x8D, 0x04, 0x14, 0xB4, 0x24, 0xB4, 0x34, 0x94,
+    0x44, 0x94, 0x54, 0x75, 0x54, 0x74, 0x74, 0x55, 0x74, 0x54, 0x94, 0x35,
+    0x94, 0x34, 0xB4, 0x15, 0xB4, 0x10, 0xE2, 0x0D, 0xB0, 0x13, 0x6F, 0x55,
+    0x66, 0x56, 0x47, 0x48, 0x38, 0x30, 0xA4, 0x62, 0x87, 0x25, 0x75, 0x27,
+    0x75, 0x46, 0x65, 0x56, 0x56, 0x55, 0x65, 0x65, 0x56, 0x65, 0x46, 0x75,
+    0x46, 0x65, 0x3F, 0x01, 0x67, 0x54, 0x67, 0x44, 0x76, 0x54, 0x67, 0x54,
+    0x66, 0x64, 0x66, 0x55, 0x65, 0x63, 0x84, 0x11, 0x53, 0x11, 0x72, 0x21,
+    0x52, 0x13, 0x92, 0x75, 0x73, 0x67, 0x46, 0x45, 0x95, 0xCA, 0x8E, 0x30,
+    0x76, 0x9F, 0x07, 0x5D, 0x36, 0xD3, 0x5D, 0x45, 0x35, 0x86, 0x27, 0x76,
+    0x19, 0x65, 0x11, 0x37, 0x56, 0x56, 0x47, 0x56, 0xF4, 0x66, 0x6F, 0x36,
+    0x76, 0xF3, 0x57, 0x63, 0x67, 0x63, 0x66, 0x64, 0x57, 0x63, 0x67, 0x54,
+    0x66, 0x55, 0x56, 0x55, 0x66, 0x46, 0x65, 0x47, 0x63, 0x59, 0xCD, 0x06,
+    0xC0, 0xA6, 0xA9, 0x84, 0x34, 0x64, 0x44, 0x54, 0x45, 0x45, 0x45, 0x35,
+    0x63, 0x36, 0xC5, 0xBE, 0x20, 0x16, 0xBE, 0x36, 0xCF, 0x68, 0x22, 0x76,
+    0x24, 0x73, 0x36, 0xB8, 0x9A, 0x68, 0xDB, 0x1D, 0x66, 0xD2, 0xAD, 0x57,
+    0xE2, 0xD5, 0x6D, 0x65, 0x2E, 0x20, 0xD4, 0x6C, 0x42, 0x6B, 0xD1, 0xA5,
+    0x28, 0x95, 0x47, 0x85, 0x56, 0x86, 0x56, 0x85, 0x66, 0x76, 0x65, 0x5F,
+    0x02, 0x66, 0x66, 0x67, 0x66, 0x67, 0x57, 0x66, 0x66, 0x76, 0x66, 0xF6,
+    0x66, 0x76, 0x57, 0x76, 0x56, 0x32, 0x36, 0x47, 0x22, 0x47, 0x22, 0x15,
+    0x12, 0x69, 0x27, 0x78, 0x36, 0xA5, 0x54, 0x80, 0xA6, 0xA9, 0x84, 0x34,
+    0x64, 0x44, 0x54, 0x54, 0x45, 0x54, 0x35, 0x64, 0x26, 0x54, 0x36, 0x45,
+    0x26, 0x54, 0x36, 0x35, 0x46, 0x15, 0x5B, 0x78, 0xAF, 0x6C, 0x68, 0x22,
+    0x67, 0x23, 0x66, 0x25, 0x64, 0x35, 0xC8, 0x9A, 0x68, 0xD7, 0x6D, 0x74,
+    0x23, 0xD5, 0x43, 0x4D, 0x35, 0x34, 0xD3, 0x44, 0x4D, 0x25, 0x52, 0xD3,
+    0x58, 0xE2, 0x0D, 0x15, 0xD9, 0x69, 0xF0, 0xAC, 0x6F, 0x0C, 0x6A, 0xF0,
+    0xC5, 0xBE, 0x20, 0xB6, 0xD9, 0x5C, 0xE2, 0x0A, 0x6C, 0xF0, 0xA5, 0xD0,
+    0xF0, 0x96, 0xD0, 0xF0, 0x95, 0xD9, 0x6D, 0x1E, 0x20, 0x85, 0xD9, 0x5D,
+    0x42, 0x45, 0xD3, 0x43, 0x4D, 0x44, 0x25, 0xD4, 0x42, 0x4D, 0x68, 0xD8,
+    0x5D, 0x80, 0xB6, 0xD3, 0xBD, 0x06, 0x39, 0x65, 0x68, 0x56, 0x65, 0x3F,
+    0x04, 0x67, 0x53, 0xF0, 0x45, 0x76, 0x75, 0x66, 0x94, 0x56, 0xB4, 0x36,
+    0xD0, 0xBD, 0x18, 0xD2, 0x3D, 0x84, 0xD7, 0x6D, 0x69, 0xD3, 0xCD, 0x1D,
+    0x1C, 0xD1, 0xA3, 0x1C, 0x74, 0x59, 0x64, 0x96, 0x5F, 0x4B, 0x55, 0x4B,
+    0x46, 0x59, 0x57, 0x57, 0x4A, 0xD1, 0xD1, 0x8C, 0xD0, 0x1D, 0x46, 0xD1,
+    0x9D, 0x46, 0x9F, 0x08, 0x5A, 0xF0, 0x76, 0xAF, 0x07, 0x5D, 0x46, 0xD4,
+    0x64, 0x58, 0x54, 0x76, 0x63, 0x86, 0x62, 0x22, 0x56, 0x52, 0x23, 0x56,
+    0x51, 0x24, 0x55, 0x61, 0x15, 0x51, 0xF0, 0x47, 0x56, 0x56, 0x66, 0x47,
+    0x56, 0x2F, 0x03, 0x66, 0x62, 0xE2, 0x02, 0x66, 0x65, 0x56, 0x63, 0x11,
+    0x66, 0x62, 0x21, 0x66, 0x52, 0x22, 0x57, 0x51, 0x23, 0x57, 0x73, 0x67,
+    0x73, 0x3B, 0x45, 0x74, 0x1E, 0x30, 0x66, 0x74, 0x1E, 0x30, 0xD6, 0x33,
+    0x95, 0x72, 0xF0, 0x45, 0x3F, 0x03, 0x63, 0xF0, 0x35, 0x66, 0x4E, 0x20,
+    0x25, 0x66, 0x5F, 0x01, 0x56, 0x64, 0x11, 0x54, 0x12, 0x53, 0x22, 0x52,
+    0x23, 0x84, 0x76, 0x47, 0xD4, 0x41, 0xE3, 0x0D, 0x36, 0xD4, 0x41, 0xE3,
+    0x0D, 0xF0, 0xD0, 0x1D, 0x36, 0xD0, 0x9D, 0x27, 0xD3, 0x53, 0xE2, 0x0D,
+    0x06, 0xD3, 0x54, 0xE2, 0x0C, 0x6D, 0x35, 0x5E, 0x20, 0xB6, 0xD3, 0x56,
+    0xE2, 0x0A, 0x6D, 0x35, 0x7F, 0x09, 0x67, 0xF0, 0x95, 0xD3, 0x69, 0x25,
+    0x59, 0x44, 0x4A, 0x43, 0x5A, 0x42, 0x5C, 0x9D, 0x16, 0xD1, 0xD0, 0x2D,
+    0x46, 0xD2, 0x9D, 0x56, 0xAF, 0x08, 0x5B, 0xF0, 0x76, 0xBF, 0x07, 0x5C,
+    0xF0, 0x66, 0xD5, 0x53, 0xA6, 0x55, 0x67, 0x65, 0x49, 0x65, 0x3A, 0x55,
+    0x3A, 0x64, 0x3B, 0x63, 0x3C, 0x53, 0x3D, 0x05, 0x15, 0x9E, 0x20, 0x3C,
+    0xC5, 0x25, 0xB6, 0x26, 0xA6, 0x35, 0xA5, 0x45, 0x96, 0x45, 0x51, 0x36,
+    0x46, 0x32, 0x36, 0x55, 0x22, 0x45, 0x68, 0x46, 0x76, 0x53, 0xB4, 0x60,
+    0xC1, 0x76, 0x3A, 0x67, 0xE2, 0x66, 0x75, 0x2E, 0x20, 0x56, 0x2F, 0x05,
+    0x57, 0x63, 0xF0, 0x45, 0x4F, 0x03, 0x64, 0xF0, 0x35, 0x5F, 0x02, 0x67,
+    0x56, 0xF0, 0x16, 0x6F, 0x01, 0x58, 0x53, 0x13, 0x53, 0x23, 0x53, 0x14,
+    0x52, 0x15, 0x85, 0x77, 0x48, 0x93, 0x54, 0x75, 0x59, 0x37, 0x48, 0x67,
+    0x28, 0x39, 0x66, 0x31, 0x25, 0x23, 0x25, 0x66, 0x21, 0x35, 0x12, 0x45,
+    0x66, 0x11, 0x45, 0x12, 0x36, 0x65, 0x11, 0x45, 0x12, 0x46, 0x65, 0x11,
+    0x47, 0x55, 0x67, 0x57, 0x46, 0x65, 0x11, 0x56, 0x56, 0x66, 0x56, 0x65,
+    0x76, 0x56, 0x56, 0x66, 0x66, 0x56, 0x3F, 0x03, 0x65, 0x66, 0x57, 0x56,
+    0x56, 0x66, 0x65, 0x66, 0x66, 0x65, 0x66, 0x53, 0x13, 0x56, 0x66, 0x52,
+    0x22, 0x66, 0x57, 0x52, 0x12, 0xF0, 0x16, 0x56, 0x77, 0x42, 0xDA, 0x45,
+    0x93, 0x45, 0x49, 0x47, 0x66, 0x38, 0x66, 0x22, 0x25, 0x65, 0x21, 0x45,
+    0x56, 0x21, 0x45, 0x56, 0x11, 0x55, 0x55, 0x11, 0x65, 0x57, 0x56, 0x47,
+    0x66, 0x47, 0x65, 0x2F, 0x03, 0x66, 0x64, 0x67, 0x55, 0x66, 0x65, 0x66,
+    0x56, 0x57, 0x55, 0x66, 0x62, 0x12, 0x66, 0x52, 0x22, 0x57, 0x52, 0x13,
+    0x57, 0x73, 0x67, 0x73, 0x3B, 0x45, 0xA6, 0xC3, 0x33, 0x94, 0x53, 0x74,
+    0x64, 0x55, 0x65, 0x44, 0x75, 0x35, 0x75, 0x25, 0x85, 0x25, 0x76, 0xF1,
+    0x58, 0x61, 0x58, 0x51, 0x68, 0x51, 0x67, 0x61, 0xF5, 0x85, 0x2F, 0x57,
+    0x53, 0x56, 0x55, 0x46, 0x46, 0x45, 0x48, 0x43, 0x3C, 0x6A, 0xC4, 0x35,
+    0xA9, 0x28, 0xA6, 0x29, 0xB5, 0x11, 0x37, 0xF9, 0x75, 0x6F, 0x96, 0x66,
+    0x86, 0x76, 0x86, 0x67, 0xF8, 0x57, 0x68, 0x66, 0x78, 0x66, 0x69, 0x57,
+    0x69, 0x56, 0x69, 0x66, 0x5A, 0x65, 0x6A, 0x56, 0x5B, 0x55, 0x5B, 0x73,
+    0x5C, 0xD1, 0xD0, 0x52, 0x5D, 0x25, 0xD4, 0xF0, 0x46, 0xD8, 0x5D, 0x5F,
+    0x03, 0x6D, 0x77, 0xD5, 0xCD, 0x20, 0xA5, 0xD2, 0x72, 0x57, 0x53, 0x76,
+    0x54, 0x66, 0x55, 0x65, 0x65, 0x65, 0x56, 0x64, 0x66, 0x54, 0x67, 0x54,
+    0x66, 0x62, 0xF0, 0x16, 0x75, 0x46, 0x66, 0x36, 0x76, 0x36, 0x75, 0x4F,
+    0x66, 0x64, 0x65, 0x65, 0x64, 0x75, 0x72, 0x21, 0x56, 0x91, 0x57, 0x82,
+    0x59, 0x53, 0x5D, 0x36, 0x6F, 0x0A, 0x57, 0xF0, 0x96, 0xD3, 0x5D, 0x37,
+    0xCC, 0x50, 0x93, 0x34, 0x49, 0x25, 0x66, 0x27, 0x56, 0x18, 0x56, 0x11,
+    0x24, 0x65, 0x11, 0x43, 0x65, 0x11, 0x8F, 0x04, 0x79, 0xF0, 0x46, 0xD0,
+    0x7A, 0xF0, 0x36, 0xD1, 0x5C, 0xE2, 0x02, 0x6C, 0xE2, 0x01, 0x6D, 0x15,
+    0xD1, 0x75, 0x31, 0x5B, 0x44, 0x44, 0x43, 0x63, 0xF3, 0x46, 0x21, 0xF0,
+    0x35, 0x61, 0x46, 0xB6, 0xA7, 0x98, 0x98, 0x97, 0xA7, 0xA6, 0x2F, 0x01,
+    0x17, 0x53, 0x27, 0x42, 0x37, 0x33, 0x46, 0x33, 0x53, 0x44, 0x21, 0x76,
+    0xA1, 0xB2, 0xA3, 0x93, 0x94, 0x85, 0x67, 0x3F, 0x02, 0xB4, 0x54, 0xF0,
+    0x36, 0x4F, 0x03, 0x57, 0x65, 0xF0, 0x25, 0x6F, 0x01, 0x66, 0xF0, 0x15,
+    0x76, 0x76, 0x31, 0x35, 0x41, 0x35, 0x31, 0x45, 0x21, 0x58, 0x57, 0x74,
+    0x80, 0x91, 0xD4, 0x56, 0x61, 0x87, 0x54, 0x67, 0x54, 0x66, 0x64, 0x66,
+    0x55, 0x57, 0x55, 0x56, 0x64, 0x66, 0x55, 0x57, 0x53, 0xF0, 0x25, 0x66,
+    0x46, 0x56, 0x55, 0x66, 0x55, 0x57, 0x55, 0x56, 0x55, 0x51, 0x15, 0x55,
+    0x41, 0x24, 0x32, 0x15, 0x32, 0x15, 0x31, 0x25, 0x22, 0x25, 0x21, 0x38,
+    0x38, 0x37, 0x47, 0x55, 0x64, 0x60, 0x52, 0x63, 0x35, 0x54, 0x17, 0x55,
+    0xF2, 0x55, 0x52, 0x65, 0x4E, 0x23, 0x56, 0x21, 0xF0, 0x35, 0x52, 0x55,
+    0x42, 0x65, 0x32, 0x4F, 0x03, 0x52, 0x28, 0x51, 0x29, 0x7A, 0x6B, 0x5C,
+    0x4D, 0x03, 0xD1, 0x2D, 0x21, 0xD0, 0x52, 0x82, 0x63, 0x35, 0x82, 0x5C,
+    0x73, 0x55, 0x25, 0x73, 0x55, 0x25, 0x64, 0x55, 0x25, 0x55, 0x64, 0x26,
+    0x45, 0x72, 0x45, 0x36, 0x72, 0x45, 0x37, 0x61, 0x55, 0x28, 0x52, 0x55,
+    0x28, 0x51, 0x65, 0x12, 0x16, 0x42, 0x65, 0x12, 0x16, 0x32, 0x77, 0x35,
+    0x22, 0x86, 0x45, 0x22, 0x86, 0x45, 0x12, 0x95, 0x57, 0xA5, 0x56, 0xB4,
+    0x66, 0xB4, 0x65, 0xC3, 0x74, 0xD0, 0x28, 0x3D, 0x12, 0x82, 0xC0, 0x84,
+    0x74, 0x58, 0x65, 0x86, 0x47, 0x76, 0x38, 0x85, 0x22, 0x33, 0x95, 0x12,
+    0xD3, 0x8D, 0x37, 0x9E, 0x20, 0x95, 0xAE, 0x30, 0x96, 0xD4, 0x7D, 0x32,
+    0x16, 0xD2, 0x21, 0x64, 0x14, 0x32, 0x23, 0x53, 0x23, 0x83, 0x52, 0x24,
+    0x74, 0x85, 0x66, 0x67, 0x48, 0x47, 0xA2, 0x73, 0x68, 0x55, 0xF7, 0x65,
+    0x58, 0x65, 0x48, 0x66, 0x38, 0x66, 0x2A, 0x56, 0x2A, 0x65, 0x12, 0xF0,
+    0x96, 0x42, 0x2F, 0x0A, 0x53, 0x2D, 0x05, 0x22, 0xD1, 0x61, 0x2D, 0x18,
+    0xD3, 0x75, 0xF0, 0xB6, 0xD4, 0x57, 0xF0, 0xB4, 0xD6, 0x39, 0xF0, 0xB2,
+    0xD7, 0x2C, 0x35, 0x2C, 0x62, 0x2D, 0x09, 0xD1, 0x7D, 0x44, 0xD5, 0x5D,
+    0x1F, 0x4D, 0x15, 0xD0, 0x61, 0x83, 0x62, 0x73, 0x71, 0x73, 0xD3, 0x2D,
+    0x33, 0xD2, 0x3D, 0x23, 0xD3, 0x2D, 0x32, 0xD3, 0x2D, 0x33, 0xD3, 0x2D,
+    0x32, 0xD3, 0x5D, 0x07, 0xC8, 0x52, 0x39, 0x44, 0x13, 0x26, 0x34, 0x21,
+    0x45, 0x34, 0x94, 0x23, 0xC5, 0x40, 0xD2, 0x5C, 0x6D, 0x05, 0xD1, 0x55,
+    0xF0, 0x95, 0xD2, 0x47, 0xE2, 0x08, 0x57, 0xE3, 0x07, 0x58, 0xF0, 0x65,
+    0xD2, 0x4D, 0x24, 0xD1, 0x4D, 0x06, 0xD4, 0x5C, 0xE3, 0x04, 0x5B, 0xE3,
+    0x03, 0x5C, 0xE3, 0x02, 0x5D, 0x0E, 0x40, 0x15, 0xD2, 0x6D, 0x26, 0xD4,
+    0x5A, 0xED, 0xF0, 0x4E, 0x30, 0x40, 0xA5, 0xD4, 0x62, 0xE4, 0x0D, 0x15,
+    0x1E, 0x30, 0xD0, 0x52, 0xE3, 0x0C, 0x53, 0xE3, 0x0B, 0x5D, 0x35, 0xD4,
+    0x5D, 0x14, 0xD1, 0x4D, 0x25, 0x5F, 0x09, 0x56, 0xE3, 0x08, 0x57, 0xE3,
+    0x07, 0x58, 0xF0, 0x65, 0x9F, 0x05, 0x5D, 0x15, 0xD0, 0x6C, 0x5D, 0x20,
+    0x35, 0xD1, 0xA7, 0x12, 0xD0, 0x43, 0x1D, 0xB5, 0xCB, 0x9D, 0x25, 0x30};
+
+const GFXglyph FreeSerifBoldItalic24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 12, 0, 1},          // 0x20 ' '
+    {0, 15, 33, 18, 3, -31},      // 0x21 '!'
+    {33, 19, 13, 26, 6, -31},     // 0x22 '"'
+    {55, 27, 33, 23, -2, -32},    // 0x23 '#'
+    {123, 24, 39, 24, -1, -33},   // 0x24 '$'
+    {207, 35, 32, 39, 2, -30},    // 0x25 '%'
+    {305, 33, 33, 37, 0, -31},    // 0x26 '&'
+    {384, 7, 13, 13, 6, -31},     // 0x27 '''
+    {397, 14, 41, 16, 1, -31},    // 0x28 '('
+    {434, 14, 41, 16, -2, -31},   // 0x29 ')'
+    {473, 19, 20, 23, 3, -31},    // 0x2A '*'
+    {509, 22, 23, 27, 2, -22},    // 0x2B '+'
+    {516, 10, 15, 12, -3, -5},    // 0x2C ','
+    {531, 12, 5, 16, 0, -12},     // 0x2D '-'
+    {536, 8, 7, 12, 0, -5},       // 0x2E '.'
+    {543, 19, 33, 16, 0, -31},    // 0x2F '/'
+    {587, 22, 33, 23, 1, -31},    // 0x30 '0'
+    {640, 20, 32, 23, 0, -31},    // 0x31 '1'
+    {680, 22, 32, 23, 1, -31},    // 0x32 '2'
+    {730, 22, 33, 24, 0, -31},    // 0x33 '3'
+    {777, 25, 32, 23, 0, -31},    // 0x34 '4'
+    {833, 24, 32, 24, 0, -30},    // 0x35 '5'
+    {882, 23, 32, 24, 1, -30},    // 0x36 '6'
+    {933, 23, 31, 23, 3, -30},    // 0x37 '7'
+    {980, 21, 33, 23, 1, -31},    // 0x38 '8'
+    {1031, 23, 33, 23, 0, -31},   // 0x39 '9'
+    {1085, 13, 22, 12, 0, -20},   // 0x3A ':'
+    {1101, 15, 30, 12, -2, -20},  // 0x3B ';'
+    {1126, 24, 25, 27, 1, -23},   // 0x3C '<'
+    {1161, 24, 14, 27, 3, -18},   // 0x3D '='
+    {1168, 24, 25, 27, 3, -23},   // 0x3E '>'
+    {1203, 18, 33, 24, 4, -31},   // 0x3F '?'
+    {1243, 33, 33, 39, 3, -31},   // 0x40 '@'
+    {1338, 31, 32, 33, 0, -31},   // 0x41 'A'
+    {1401, 31, 31, 30, 0, -30},   // 0x42 'B'
+    {1456, 29, 33, 29, 2, -31},   // 0x43 'C'
+    {1509, 35, 31, 34, 0, -30},   // 0x44 'D'
+    {1568, 32, 31, 30, 0, -30},   // 0x45 'E'
+    {1633, 31, 31, 29, 0, -30},   // 0x46 'F'
+    {1689, 32, 33, 33, 2, -31},   // 0x47 'G'
+    {1755, 39, 31, 35, 0, -30},   // 0x48 'H'
+    {1810, 21, 31, 18, 0, -30},   // 0x49 'I'
+    {1846, 27, 36, 23, 0, -30},   // 0x4A 'J'
+    {1891, 34, 31, 31, 0, -30},   // 0x4B 'K'
+    {1962, 29, 31, 29, 0, -30},   // 0x4C 'L'
+    {2010, 44, 32, 41, 0, -30},   // 0x4D 'M'
+    {2125, 37, 32, 33, 0, -30},   // 0x4E 'N'
+    {2213, 31, 33, 32, 2, -31},   // 0x4F 'O'
+    {2286, 31, 31, 28, 0, -30},   // 0x50 'P'
+    {2337, 31, 42, 32, 2, -31},   // 0x51 'Q'
+    {2422, 32, 31, 31, 0, -30},   // 0x52 'R'
+    {2481, 24, 33, 24, 0, -31},   // 0x53 'S'
+    {2538, 27, 31, 28, 4, -30},   // 0x54 'T'
+    {2589, 32, 32, 34, 5, -30},   // 0x55 'U'
+    {2658, 31, 32, 33, 6, -30},   // 0x56 'V'
+    {2725, 41, 32, 44, 6, -30},   // 0x57 'W'
+    {2821, 34, 31, 33, 0, -30},   // 0x58 'X'
+    {2890, 28, 31, 30, 6, -30},   // 0x59 'Y'
+    {2946, 28, 31, 26, 0, -30},   // 0x5A 'Z'
+    {2998, 19, 38, 16, -2, -30},  // 0x5B '['
+    {3044, 13, 33, 19, 6, -31},   // 0x5C '\'
+    {3075, 19, 38, 16, -3, -30},  // 0x5D ']'
+    {3119, 21, 17, 27, 3, -30},   // 0x5E '^'
+    {3150, 24, 3, 23, 0, 5},      // 0x5F '_'
+    {3153, 10, 9, 16, 4, -32},    // 0x60 '`'
+    {3162, 22, 23, 24, 1, -21},   // 0x61 'a'
+    {3212, 22, 33, 23, 1, -31},   // 0x62 'b'
+    {3265, 18, 23, 20, 1, -21},   // 0x63 'c'
+    {3294, 25, 34, 24, 1, -32},   // 0x64 'd'
+    {3356, 18, 23, 20, 1, -21},   // 0x65 'e'
+    {3393, 28, 41, 23, -4, -31},  // 0x66 'f'
+    {3458, 25, 31, 23, -1, -21},  // 0x67 'g'
+    {3512, 23, 34, 26, 1, -32},   // 0x68 'h'
+    {3579, 12, 33, 14, 2, -31},   // 0x69 'i'
+    {3616, 22, 42, 16, -4, -31},  // 0x6A 'j'
+    {3670, 24, 34, 24, 1, -32},   // 0x6B 'k'
+    {3732, 13, 34, 14, 2, -32},   // 0x6C 'l'
+    {3773, 35, 23, 36, 0, -21},   // 0x6D 'm'
+    {3852, 23, 23, 25, 0, -21},   // 0x6E 'n'
+    {3906, 20, 23, 22, 1, -21},   // 0x6F 'o'
+    {3946, 27, 31, 23, -4, -21},  // 0x70 'p'
+    {4002, 22, 31, 23, 1, -21},   // 0x71 'q'
+    {4058, 20, 22, 19, 0, -21},   // 0x72 'r'
+    {4093, 16, 23, 17, 0, -21},   // 0x73 's'
+    {4128, 13, 29, 13, 2, -27},   // 0x74 't'
+    {4165, 22, 23, 25, 2, -21},   // 0x75 'u'
+    {4218, 17, 23, 21, 3, -21},   // 0x76 'v'
+    {4254, 27, 23, 31, 3, -21},   // 0x77 'w'
+    {4319, 24, 23, 22, -1, -21},  // 0x78 'x'
+    {4362, 23, 31, 20, -3, -21},  // 0x79 'y'
+    {4415, 19, 25, 19, 0, -20},   // 0x7A 'z'
+    {4458, 20, 41, 16, 0, -31},   // 0x7B '{'
+    {4501, 4, 33, 13, 5, -31},    // 0x7C '|'
+    {4506, 20, 41, 16, -6, -31},  // 0x7D '}'
+    {4548, 21, 7, 27, 3, -14}};   // 0x7E '~'
+
+const GFXpackedFont FreeSerifBoldItalic24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeSerifBoldItalic24pt7bRLEBitmaps,
+     (GFXglyph *)FreeSerifBoldItalic24pt7bRLEGlyphs, 0x20, 0x7E, 56},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 5233 bytes, glyph bitmaps 4560 bytes (8245 uncompressed)
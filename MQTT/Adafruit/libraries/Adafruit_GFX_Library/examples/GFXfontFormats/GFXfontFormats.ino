@@ -0,0 +1,54 @@
+/***
+This example compares a plain GFXfont with its run-length encoded version
+(the fonts ending in RLE, made with fontconvert -c or fontpack -w): the flash
+taken by the glyph bitmaps and how fast text renders into a GFXcanvas16, in
+glyphs per second. Nothing is shown on a display, so it only needs a board with
+enough RAM for the 128x64 16-bit canvas (16 KB).
+
+Both fonts draw exactly the same pixels. The RLE decoder emits whole runs, and
+rows repeated in the glyph as one taller rectangle, so it usually needs fewer
+draw calls than walking the plain bitmap bit by bit.
+***/
+
+#include <Adafruit_GFX.h>
+#include <Arduino.h>
+#include <Fonts/FreeSansBold24pt7b.h>
+#include <Fonts/FreeSansBold24pt7bRLE.h>
+
+GFXcanvas16 canvas(128, 64);
+
+static const char text[] = "23.5"; // 4 glyphs, fits at 24 pt
+static const uint16_t lines = 500;
+
+// Prints the text on 'lines' lines with the current font and reports the rate
+void benchmark(const char *name, size_t bitmapBytes) {
+  canvas.setTextColor(0xFFFF);
+  canvas.setTextWrap(false);
+
+  unsigned long start = micros();
+  for (uint16_t i = 0; i < lines; i++) {
+    canvas.setCursor(0, 50);
+    canvas.print(text);
+  }
+  unsigned long elapsed = micros() - start;
+
+  unsigned long glyphs = (unsigned long)lines * (sizeof(text) - 1);
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(bitmapBytes);
+  Serial.print(" bytes of glyph bitmaps, ");
+  Serial.print((unsigned long)(glyphs * 1000000.0 / (elapsed ? elapsed : 1)));
+  Serial.println(" glyphs/s");
+}
+
+void setup() {
+  Serial.begin(115200);
+  canvas.fillScreen(0);
+
+  canvas.setFont(&FreeSansBold24pt7b);
+  benchmark("FreeSansBold24pt7b", sizeof(FreeSansBold24pt7bBitmaps));
+  canvas.setPackedFont(&FreeSansBold24pt7bRLE); // RLE fonts are packed
+  benchmark("FreeSansBold24pt7bRLE", sizeof(FreeSansBold24pt7bRLEBitmaps));
+}
+
+void loop() {}
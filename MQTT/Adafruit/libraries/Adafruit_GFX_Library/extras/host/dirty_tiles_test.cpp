@@ -0,0 +1,308 @@
+// Host test of the dirty tile tracking (GFXdirtyTiles) and of the partial
+// flush in Adafruit_SH110X::display().
+//
+// - GFXdirtyTiles: marking, clipping and the runs returned by nextRun().
+// - GFXcanvas1/8/16: after random drawing, in every rotation, each 8x8 tile
+//   whose pixels changed must be marked dirty.
+// - SH1106G and SH1107: a fake I2C device models the controller's page and
+//   column addressing. After every display(), the modelled panel memory must
+//   match the framebuffer, so a tile that was not sent must not have changed.
+//   The bytes sent for a few typical dashboard updates are printed.
+#include <Adafruit_GFX.h>
+#include <Adafruit_SH110X.h>
+
+#include <vector>
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static uint32_t rng = 12345;
+static int16_t rnd(int n) {
+  rng = rng * 1103515245 + 12345;
+  return (int16_t)((rng >> 8) % (uint32_t)n);
+}
+
+// One random drawing call, with coordinates that often fall off the edges
+static void randomDraw(Adafruit_GFX &g, uint16_t maxColor) {
+  int16_t w = g.width(), h = g.height();
+  int16_t x = rnd(w + 40) - 20, y = rnd(h + 40) - 20;
+  int16_t a = rnd(w) - 4, b = rnd(h) - 4;
+  uint16_t c = rnd(maxColor + 1);
+  switch (rnd(12)) {
+  case 0:
+    g.drawPixel(x, y, c);
+    break;
+  case 1:
+    g.drawFastHLine(x, y, a, c);
+    break;
+  case 2:
+    g.drawFastVLine(x, y, b, c);
+    break;
+  case 3:
+    g.drawLine(x, y, a, b, c);
+    break;
+  case 4:
+    g.drawRect(x, y, a, b, c);
+    break;
+  case 5:
+    g.fillRect(x, y, a / 2, b / 2, c);
+    break;
+  case 6:
+    g.drawCircle(x, y, rnd(20), c);
+    break;
+  case 7:
+    g.fillCircle(x, y, rnd(12), c);
+    break;
+  case 8:
+    g.fillTriangle(x, y, a, b, x + rnd(30) - 15, b + rnd(30) - 15, c);
+    break;
+  case 9:
+    g.setCursor(x, y);
+    g.setTextSize(1 + rnd(2));
+    if (rnd(2))
+      g.setTextColor(c);
+    else
+      g.setTextColor(c, maxColor - c);
+    g.print("12:34");
+    break;
+  case 10:
+    g.drawRoundRect(x, y, a, b, rnd(6), c);
+    break;
+  default:
+    if (rnd(20) == 0)
+      g.fillScreen(c);
+    else
+      g.drawChar(x, y, 'A' + rnd(26), c, maxColor - c, 1);
+    break;
+  }
+}
+
+static void testTiles(void) {
+  GFXdirtyTiles t;
+  CHECK(!t.enabled(), "enabled before begin()");
+  t.markPixel(3, 3); // must not crash
+  CHECK(t.begin(20, 17), "begin");
+  CHECK(t.columns() == 3 && t.rows() == 3, "%ux%u tiles", t.columns(),
+        t.rows());
+  CHECK(t.isDirty(2, 2), "begin() leaves every tile dirty");
+  t.clear();
+  CHECK(!t.isDirty(0, 0) && !t.isDirty(2, 2), "clear");
+
+  t.mark(-5, -5, 6, 6); // clipped to tile 0,0
+  t.mark(15, 9, 2, 1);  // spans tiles 1 and 2 of row 1
+  t.mark(19, 16, 50, 50);
+  t.mark(40, 0, 4, 4);   // off the right edge
+  t.mark(2, 2, 0, 5);    // empty
+  t.mark(2, 2, 5, -1);   // empty
+  CHECK(t.isDirty(0, 0), "clipped top left");
+  CHECK(t.isDirty(1, 1) && t.isDirty(2, 1) && !t.isDirty(0, 1), "row 1");
+  CHECK(t.isDirty(2, 2) && !t.isDirty(1, 2), "bottom right");
+  CHECK(!t.isDirty(1, 0) && !t.isDirty(2, 0), "off the edge or empty");
+  CHECK(!t.isDirty(3, 0) && !t.isDirty(0, 3), "outside the bitmap");
+
+  uint16_t col = 0;
+  CHECK(t.nextRun(1, &col) == 2 && col == 1, "run in row 1 at %u", col);
+  col += 2;
+  CHECK(t.nextRun(1, &col) == 0, "row 1 ends");
+  col = 0;
+  CHECK(t.nextRun(0, &col) == 1 && col == 0, "run in row 0");
+  t.markAll();
+  col = 0;
+  CHECK(t.nextRun(2, &col) == 3 && col == 0, "full row");
+  t.end();
+  CHECK(!t.enabled() && !t.isDirty(0, 0), "end");
+}
+
+// Raw (unrotated) pixel of each canvas type
+static uint32_t rawPixel(GFXcanvas1 &c, int16_t x, int16_t y) {
+  return (c.getBuffer()[y * ((c.width() + 7) / 8) + x / 8] >> (7 - x % 8)) & 1;
+}
+static uint32_t rawPixel(GFXcanvas8 &c, int16_t x, int16_t y) {
+  return c.getBuffer()[y * c.width() + x];
+}
+static uint32_t rawPixel(GFXcanvas16 &c, int16_t x, int16_t y) {
+  return c.getBuffer()[y * c.width() + x];
+}
+
+template <typename Canvas>
+static void testCanvas(const char *name, uint16_t maxColor) {
+  // Odd sizes, so the last tile row and column are partial
+  Canvas c(77, 45);
+  CHECK(c.getDirtyTiles() == NULL, "%s tracks without being asked", name);
+  CHECK(c.setDirtyTracking(true), "%s setDirtyTracking", name);
+  GFXdirtyTiles *t = c.getDirtyTiles();
+  int16_t W = c.width(), H = c.height();
+  std::vector<uint32_t> before(W * H);
+  unsigned long changed = 0, marked = 0;
+
+  for (int i = 0; i < 4000; i++) {
+    c.setRotation(i / 1000);
+    // setRotation() swaps width() and height(), the raw size stays
+    c.setRotation(0);
+    for (int16_t y = 0; y < H; y++)
+      for (int16_t x = 0; x < W; x++)
+        before[y * W + x] = rawPixel(c, x, y);
+    t->clear();
+    c.setRotation(i / 1000);
+    randomDraw(c, maxColor);
+    c.setRotation(0);
+
+    for (uint16_t row = 0; row < t->rows(); row++) {
+      for (uint16_t col = 0; col < t->columns(); col++) {
+        bool diff = false;
+        for (int16_t y = row * 8; y < min(H, row * 8 + 8) && !diff; y++)
+          for (int16_t x = col * 8; x < min(W, col * 8 + 8) && !diff; x++)
+            diff = rawPixel(c, x, y) != before[y * W + x];
+        changed += diff;
+        marked += t->isDirty(col, row);
+        if (diff && !t->isDirty(col, row)) {
+          CHECK(false, "%s step %d rotation %d: tile %u,%u changed, not dirty",
+                name, i, i / 1000, col, row);
+          return;
+        }
+      }
+    }
+  }
+  printf("  %-12s %5.1f%% of the dirty tiles actually changed\n", name,
+         100.0 * changed / marked);
+}
+
+// A panel that keeps the bytes written to its memory, addressed the way the
+// SH1106 and SH1107 controllers are
+struct Panel {
+  uint8_t ram[16][256];
+  uint8_t page, column;
+
+  void reset(void) {
+    memset(ram, 0xA5, sizeof(ram)); // garbage until written
+    page = column = 0;
+  }
+
+  void write(const uint8_t *prefix, size_t prefix_len, const uint8_t *buffer,
+             size_t len) {
+    std::vector<uint8_t> bytes(prefix, prefix + prefix_len);
+    bytes.insert(bytes.end(), buffer, buffer + len);
+    if (bytes.empty())
+      return;
+    if (bytes[0] == 0x40) { // data: written at the column, which advances
+      for (size_t i = 1; i < bytes.size(); i++)
+        ram[page & 15][column++] = bytes[i];
+      return;
+    }
+    // Commands. Parameters of multi-byte commands are parsed as commands
+    // too, that's harmless since display() sets the address before data
+    for (size_t i = 1; i < bytes.size(); i++) {
+      uint8_t c = bytes[i];
+      if (c <= 0x0F)
+        column = (column & 0xF0) | c;
+      else if (c <= 0x1F)
+        column = (column & 0x0F) | ((c & 0x0F) << 4);
+      else if ((c & 0xF0) == 0xB0)
+        page = c & 0x0F;
+    }
+  }
+} panel;
+
+static void panelHook(uint8_t, const uint8_t *prefix, size_t prefix_len,
+                      const uint8_t *buffer, size_t len) {
+  panel.write(prefix, prefix_len, buffer, len);
+}
+
+// Gives access to the controller's column offset
+template <typename Driver> struct Probe : public Driver {
+  Probe(uint16_t w, uint16_t h) : Driver(w, h, &Wire) {}
+  uint8_t columnOffset(void) { return this->_page_start_offset; }
+  int16_t rawWidth(void) { return this->WIDTH; }
+  int16_t rawHeight(void) { return this->HEIGHT; }
+};
+
+template <typename Driver>
+static bool panelMatches(Probe<Driver> &d, const char *name, int step) {
+  uint16_t w = d.rawWidth(), h = d.rawHeight();
+  for (uint16_t p = 0; p < (h + 7) / 8; p++) {
+    for (uint16_t x = 0; x < w; x++) {
+      uint8_t want = d.getBuffer()[p * w + x];
+      uint8_t got = panel.ram[p][x + d.columnOffset()];
+      if (want != got) {
+        CHECK(false, "%s step %d: page %u column %u is %02X, should be %02X",
+              name, step, p, x, got, want);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <typename Driver>
+static void flush(Probe<Driver> &d, const char *what) {
+  i2cStats = I2CStats();
+  d.display();
+  printf("    %-36s %5lu bytes %3lu transactions\n", what, i2cStats.bytes,
+         i2cStats.transactions);
+}
+
+template <typename Driver>
+static void testDisplay(const char *name, uint16_t w, uint16_t h) {
+  printf("  %s %ux%u\n", name, w, h);
+  Probe<Driver> d(w, h);
+  panel.reset();
+  i2cWriteHook = panelHook;
+  CHECK(d.begin(0x3C, true), "%s begin", name);
+  d.clearDisplay();
+  d.display();
+  panelMatches(d, name, -1);
+
+  // Typical dashboard updates
+  d.setTextColor(SH110X_WHITE, SH110X_BLACK);
+  int16_t bx = d.width() - 30, by = d.height() - 8;
+  flush(d, "nothing changed");
+  d.setCursor(0, 0);
+  d.print("12:35");
+  flush(d, "clock top-left");
+  d.setCursor(0, 0);
+  d.print("12:36");
+  d.setCursor(bx, by);
+  d.print("23.5");
+  flush(d, "clock + value in the opposite corner");
+  d.drawFastHLine(10, 30, 60, SH110X_WHITE);
+  d.drawFastVLine(70, 26, 9, SH110X_WHITE);
+  flush(d, "progress bar");
+  d.fillScreen(SH110X_BLACK);
+  flush(d, "full redraw");
+  panelMatches(d, name, 0);
+
+  // Random drawing, flushed every few calls, in every rotation
+  for (int i = 1; i < 3000; i++) {
+    d.setRotation(i / 750);
+    randomDraw(d, 1);
+    if (i % 3 == 0) {
+      d.display();
+      if (!panelMatches(d, name, i))
+        break;
+    }
+  }
+  i2cWriteHook = NULL;
+}
+
+int main(void) {
+  printf("GFXdirtyTiles\n");
+  testTiles();
+  printf("Canvases\n");
+  testCanvas<GFXcanvas1>("GFXcanvas1", 1);
+  testCanvas<GFXcanvas8>("GFXcanvas8", 0xFF);
+  testCanvas<GFXcanvas16>("GFXcanvas16", 0xFFFF);
+  printf("SH110X display() over I2C\n");
+  testDisplay<Adafruit_SH1106G>("SH1106G", 128, 64);
+  testDisplay<Adafruit_SH1107>("SH1107", 64, 128);
+  testDisplay<Adafruit_SH1107>("SH1107", 128, 128);
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,154 @@
+// Host test and frame rate model of the ESP32 DMA backend of
+// Adafruit_SPITFT::writePixels(), with the drawing loop of the
+// Adafruit_ILI9341 esp32_dma_bands example. The Makefile builds it twice:
+// esp32_dma_bands with USE_SPI_DMA and ESP32_SPI_DMA_EXPERIMENTAL, against
+// the ESP-IDF driver model in stub/driver/spi_master.h, and
+// esp32_blocking_bands without, for the blocking frame rate.
+//
+// Each frame is drawn in bands into a GFXcanvas16 and pushed with
+// writePixels(), non-blocking. The band is scribbled over as soon as
+// writePixels() returns, so pixels must have been copied by then.
+// - The pixel data on the wire must match the rendered frame, for band
+//   heights that fill, split and straddle the DMA working buffers, in both
+//   byte orders.
+// - No SPIClass write may happen while a DMA transaction is in flight, and
+//   CS may not go high: endWrite() waits for the transfers.
+// - Every SPI transaction ends, also when dmaWait() is called after
+//   endWrite().
+// - At most 2 transactions in flight, none longer than max_transfer_sz.
+// Then prints the frame rate at 40 MHz, 320x240, 8-line bands, for a few
+// rendering costs per band. The rate is in virtual time: the CPU is charged
+// the rendering cost, each blocking write and each queued transaction, and
+// waits for the wire when a transfer has to finish first.
+#include <Adafruit_GFX.h>
+#include <Adafruit_ILI9341.h>
+
+#define TFT_CS 10
+#define TFT_DC 9
+#define W 320
+#define H 240
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static unsigned long csViolations = 0;
+
+static void followPins(uint8_t pin, uint8_t value) {
+  if (pin == TFT_DC)
+    spiWire.dc = value;
+  if (pin == TFT_CS && value && spiWire.dmaActive.load())
+    csViolations++;
+}
+
+// Checks that the last W * H pixels on the wire are the expected frame,
+// sent as data most significant byte first
+static bool frameMatches(const std::vector<uint16_t> &expected) {
+  std::lock_guard<std::mutex> l(spiWire.lock);
+  size_t n = W * H * 2;
+  if (spiWire.bytes.size() < n)
+    return false;
+  size_t first = spiWire.bytes.size() - n;
+  for (size_t i = 0; i < W * H; i++) {
+    size_t b = first + 2 * i;
+    if (!spiWire.isData[b] || !spiWire.isData[b + 1] ||
+        spiWire.bytes[b] != (expected[i] >> 8) ||
+        spiWire.bytes[b + 1] != (expected[i] & 0xFF)) {
+      printf("    pixel %u,%u is %02X%02X, should be %04X\n",
+             (unsigned)(i % W), (unsigned)(i / W), spiWire.bytes[b],
+             spiWire.bytes[b + 1], expected[i]);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Sends frames drawn in bands, returns frames/sec in virtual time
+static double run(Adafruit_ILI9341 &tft, int bandLines, bool bigEndian,
+                  double renderUs, int frames) {
+  GFXcanvas16 band(W, bandLines);
+  std::vector<uint16_t> expected(W * H);
+  double start = spiWire.cpuTime;
+
+  for (int f = 0; f < frames; f++) {
+    tft.startWrite();
+    tft.setAddrWindow(0, 0, W, H);
+    for (int y = 0; y < H; y += bandLines) {
+      int lines = (H - y < bandLines) ? H - y : bandLines;
+      band.fillScreen(f * 2000 + y);
+      band.fillCircle(40 + f * 7, 120 - y, 30, 0xF800);
+      band.setCursor(f % 50, 0);
+      band.setTextColor(0xFFFF - y, 0x1234 + f);
+      band.print("Band pipeline");
+      spiWire.cpuTime += renderUs;
+      memcpy(&expected[y * W], band.getBuffer(), W * lines * 2);
+      if (bigEndian)
+        tft.swapBytes(band.getBuffer(), W * lines);
+      tft.writePixels(band.getBuffer(), W * lines, false, bigEndian);
+      // The next band is drawn while this one is sent
+      memset(band.getBuffer(), 0x5A, W * bandLines * 2);
+    }
+    if (f & 1) {
+      // dmaWait() outside a write must not start a transaction
+      tft.endWrite();
+      tft.dmaWait();
+    } else {
+      tft.dmaWait();
+      tft.endWrite();
+    }
+    CHECK(SPI.transactions == 0, "%d SPI transactions left open",
+          SPI.transactions);
+    if (!frameMatches(expected)) {
+      CHECK(false, "%d-line bands, %s: frame %d differs", bandLines,
+            bigEndian ? "big-endian" : "little-endian", f);
+      break;
+    }
+  }
+  return frames / ((spiWire.cpuTime - start) / 1e6);
+}
+
+int main(void) {
+  digitalWriteHook = followPins;
+  Adafruit_ILI9341 tft(TFT_CS, TFT_DC);
+  tft.begin(40000000);
+  tft.setRotation(1); // Landscape, 320x240
+#if defined(USE_ESP32_SPI_DMA)
+  printf("ESP32 writePixels() with DMA\n");
+  CHECK(spiMasterStats.maxTransferBytes > 0, "DMA device not set up");
+#else
+  printf("ESP32 writePixels() blocking\n");
+#endif
+
+  // The working buffers hold 4 lines: 7 and 60 straddle and split them
+  const int bands[] = {4, 7, 8, 16, 60};
+  for (int b = 0; b < 5; b++) {
+    run(tft, bands[b], false, 0, 3);
+    run(tft, bands[b], true, 0, 3);
+  }
+  CHECK(!spiWire.violations, "%lu SPIClass writes during DMA",
+        spiWire.violations);
+  CHECK(!csViolations, "CS went high %lu times during DMA", csViolations);
+#if defined(USE_ESP32_SPI_DMA)
+  CHECK(spiMasterStats.maxInFlight <= 2, "%lu transactions in flight",
+        spiMasterStats.maxInFlight);
+  printf("  %lu DMA transactions, at most %lu in flight\n",
+         spiMasterStats.transactions, spiMasterStats.maxInFlight);
+#endif
+
+  printf("  40 MHz, 320x240, 8-line bands, wire limit %.1f fps\n",
+         spiWire.bitrate / (W * H * 16.0));
+  const double renderUs[] = {500, 1000, 1500};
+  for (int r = 0; r < 3; r++)
+    printf("    render %4.0f us/band %5.1f fps\n", renderUs[r],
+           run(tft, 8, false, renderUs[r], 10));
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
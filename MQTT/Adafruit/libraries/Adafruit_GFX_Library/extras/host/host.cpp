@@ -0,0 +1,28 @@
+// Definitions behind the stand-ins in stub/
+#include <Adafruit_I2CDevice.h>
+#include <Arduino.h>
+#include <SPI.h>
+#include <Wire.h>
+#include <driver/spi_master.h>
+
+#include <chrono>
+
+TwoWire Wire;
+SPIClass SPI;
+SPIWire spiWire;
+SPIMasterStats spiMasterStats;
+void (*digitalWriteHook)(uint8_t, uint8_t) = NULL;
+I2CStats i2cStats;
+void (*i2cWriteHook)(uint8_t, const uint8_t *, size_t, const uint8_t *,
+                     size_t) = NULL;
+
+static const std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+
+unsigned long micros(void) {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+unsigned long millis(void) { return micros() / 1000; }
@@ -0,0 +1,70 @@
+// Minimal Arduino core for building the library on a desktop compiler.
+// Only what the GFX sources and the host tests in extras/host use.
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Standard headers the tests use, included before the min() and max() macros
+// like on the cores that define them
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define PROGMEM
+#include "pgmspace.h"
+#define F(x) (reinterpret_cast<const __FlashStringHelper *>(x))
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define _BV(b) (1 << (b))
+
+#ifndef min
+#define min(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+typedef bool boolean;
+class __FlashStringHelper;
+
+// Called on every digitalWrite() when set, e.g. to follow a display's DC pin
+extern void (*digitalWriteHook)(uint8_t pin, uint8_t value);
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t pin, uint8_t value) {
+  if (digitalWriteHook)
+    digitalWriteHook(pin, value);
+}
+inline int digitalRead(uint8_t) { return LOW; }
+inline void delay(unsigned long) {}
+inline void yield(void) {}
+unsigned long millis(void);
+unsigned long micros(void);
+
+/// String with the few members GFX uses
+class String {
+public:
+  String(const char *s = "") : s(s) {}
+  const char *c_str() const { return s; }
+  unsigned int length() const { return strlen(s); }
+
+private:
+  const char *s;
+};
+
+#include "Print.h"
+
+#endif
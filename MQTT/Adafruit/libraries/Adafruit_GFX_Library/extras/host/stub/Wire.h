@@ -0,0 +1,14 @@
+#ifndef _HOST_WIRE_H
+#define _HOST_WIRE_H
+
+#include <stdint.h>
+
+class TwoWire {
+public:
+  void begin(void) {}
+  void setClock(uint32_t) {}
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,151 @@
+// Model of the ESP-IDF SPI master driver. A worker thread plays the DMA
+// engine and the SPI interrupt: queued transactions are sent to spiWire in
+// order, then post_cb runs and the transaction is handed back through
+// spi_device_get_trans_result(). Misuse the real driver would not survive
+// aborts: a queue overflow or a transfer longer than max_transfer_sz.
+#ifndef _HOST_SPI_MASTER_H
+#define _HOST_SPI_MASTER_H
+
+#include <SPI.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <condition_variable>
+#include <deque>
+
+#define IRAM_ATTR
+#define portMAX_DELAY 0xFFFFFFFF
+#define ESP_OK 0
+#define ESP_ERR_INVALID_STATE 0x103
+#define SPI_DMA_CH_AUTO 3
+#define SPI_DEVICE_NO_DUMMY (1 << 6)
+
+typedef int esp_err_t;
+typedef enum { SPI1_HOST, SPI2_HOST, SPI3_HOST } spi_host_device_t;
+#define VSPI_HOST SPI3_HOST
+
+struct spi_transaction_t {
+  uint32_t flags;
+  size_t length; ///< In bits
+  size_t rxlength;
+  void *user;
+  const void *tx_buffer;
+  void *rx_buffer;
+  double endTime; ///< Model only, virtual time the transfer ends
+};
+typedef void (*transaction_cb_t)(spi_transaction_t *trans);
+
+struct spi_bus_config_t {
+  int mosi_io_num, miso_io_num, sclk_io_num, quadwp_io_num, quadhd_io_num;
+  int max_transfer_sz;
+};
+
+struct spi_device_interface_config_t {
+  uint8_t mode;
+  int clock_speed_hz;
+  int spics_io_num;
+  uint32_t flags;
+  int queue_size;
+  transaction_cb_t post_cb;
+};
+
+/// Model counters, for the checks in the host tests
+struct SPIMasterStats {
+  unsigned long transactions, maxInFlight;
+  size_t maxTransferBytes; ///< max_transfer_sz of the bus
+  double queueCost = 15;   ///< Virtual CPU time to queue a transaction, us
+};
+extern SPIMasterStats spiMasterStats;
+
+struct spi_device_t {
+  spi_device_interface_config_t cfg;
+  std::mutex lock;
+  std::condition_variable cv;
+  std::deque<spi_transaction_t *> todo, done;
+  bool stop = false;
+  std::thread worker;
+
+  ~spi_device_t() {
+    {
+      std::lock_guard<std::mutex> l(lock);
+      stop = true;
+    }
+    cv.notify_all();
+    worker.join();
+  }
+
+  void run(void) {
+    std::unique_lock<std::mutex> l(lock);
+    for (;;) {
+      cv.wait(l, [this] { return stop || !todo.empty(); });
+      if (stop)
+        return;
+      spi_transaction_t *t = todo.front();
+      l.unlock();
+      spiWire.send((const uint8_t *)t->tx_buffer, t->length / 8, true);
+      spiWire.dmaActive--;
+      if (cfg.post_cb)
+        cfg.post_cb(t);
+      l.lock();
+      todo.pop_front();
+      done.push_back(t);
+      cv.notify_all();
+    }
+  }
+};
+typedef spi_device_t *spi_device_handle_t;
+
+inline esp_err_t spi_bus_initialize(spi_host_device_t,
+                                    const spi_bus_config_t *config, int) {
+  spiMasterStats.maxTransferBytes = config->max_transfer_sz;
+  return ESP_OK;
+}
+
+inline esp_err_t
+spi_bus_add_device(spi_host_device_t,
+                   const spi_device_interface_config_t *config,
+                   spi_device_handle_t *handle) {
+  spi_device_t *d = new spi_device_t;
+  d->cfg = *config;
+  d->worker = std::thread(&spi_device_t::run, d);
+  *handle = d;
+  return ESP_OK;
+}
+
+inline esp_err_t spi_device_queue_trans(spi_device_handle_t d,
+                                        spi_transaction_t *t, uint32_t) {
+  std::lock_guard<std::mutex> l(d->lock);
+  unsigned long inFlight = d->todo.size() + d->done.size() + 1;
+  if ((int)inFlight > d->cfg.queue_size) {
+    fprintf(stderr, "spi_device_queue_trans: queue overflow\n");
+    abort();
+  }
+  if (t->length / 8 > spiMasterStats.maxTransferBytes) {
+    fprintf(stderr, "spi_device_queue_trans: %zu bytes, max %zu\n",
+            t->length / 8, spiMasterStats.maxTransferBytes);
+    abort();
+  }
+  if (inFlight > spiMasterStats.maxInFlight)
+    spiMasterStats.maxInFlight = inFlight;
+  spiMasterStats.transactions++;
+  spiWire.dmaActive++;
+  spiWire.cpuTime += spiMasterStats.queueCost;
+  t->endTime = spiWire.reserve(t->length / 8);
+  d->todo.push_back(t);
+  d->cv.notify_all();
+  return ESP_OK;
+}
+
+inline esp_err_t spi_device_get_trans_result(spi_device_handle_t d,
+                                             spi_transaction_t **t,
+                                             uint32_t) {
+  std::unique_lock<std::mutex> l(d->lock);
+  d->cv.wait(l, [d] { return !d->done.empty(); });
+  *t = d->done.front();
+  d->done.pop_front();
+  if (spiWire.cpuTime < (*t)->endTime) // The CPU waited for the transfer
+    spiWire.cpuTime = (*t)->endTime;
+  return ESP_OK;
+}
+
+#endif
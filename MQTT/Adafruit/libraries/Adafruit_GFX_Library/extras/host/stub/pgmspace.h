@@ -0,0 +1,9 @@
+#ifndef _HOST_PGMSPACE_H
+#define _HOST_PGMSPACE_H
+
+// Program memory is ordinary memory on the host
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+#endif
@@ -0,0 +1,330 @@
+// Host test and benchmark of text rendered as horizontal runs, against the
+// previous renderer, which drew one writePixel() or writeFillRect() per font
+// pixel. That renderer is kept here as drawCharPerPixel().
+//
+// - Strings in the classic font and in FreeSans9pt7b draw exactly the same
+//   pixels both ways on GFXcanvas1/8/16 and on a display that only has
+//   drawPixel(): in every rotation, at sizes 1-3 on each axis, at random
+//   positions that clip on every side, wrapped or not, opaque and
+//   transparent.
+// - The same for every character of the classic font, with and without
+//   cp437().
+// Then prints glyphs/s for "Temp 23.5" on a GFXcanvas16, and draw calls per
+// glyph on a generic display, before -> after. `make bench` builds it with
+// -O2 and no sanitizers.
+#include <Adafruit_GFX.h>
+
+#include <Fonts/FreeSans9pt7b.h>
+
+#include "../../glcdfont.c"
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static uint32_t rng = 1234;
+static int rnd(int n) {
+  rng = rng * 1103515245 + 12345;
+  return (int)((rng >> 8) % (uint32_t)n);
+}
+
+static const char text[] = "Hello World! 0123456789 AaBbQqYy {|}~ @#$%&*";
+
+/// The text settings both renderers draw with
+struct Style {
+  const GFXfont *font;
+  bool cp437, wrap;
+  uint16_t fg, bg;
+  uint8_t sx, sy;
+};
+
+// drawChar() as it was before text was drawn in runs
+static void drawCharPerPixel(Adafruit_GFX &d, const Style &s, int16_t x,
+                             int16_t y, unsigned char c) {
+  uint16_t color = s.fg, bg = s.bg;
+  uint8_t size_x = s.sx, size_y = s.sy;
+  if (!s.font) {
+    if ((x >= d.width()) || (y >= d.height()) ||
+        ((x + 6 * size_x - 1) < 0) || ((y + 8 * size_y - 1) < 0))
+      return;
+    if (!s.cp437 && (c >= 176))
+      c++;
+    d.startWrite();
+    for (int8_t i = 0; i < 5; i++) {
+      uint8_t line = font[c * 5 + i];
+      for (int8_t j = 0; j < 8; j++, line >>= 1) {
+        if (line & 1) {
+          if (size_x == 1 && size_y == 1)
+            d.writePixel(x + i, y + j, color);
+          else
+            d.writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y,
+                            color);
+        } else if (bg != color) {
+          if (size_x == 1 && size_y == 1)
+            d.writePixel(x + i, y + j, bg);
+          else
+            d.writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y,
+                            bg);
+        }
+      }
+    }
+    if (bg != color) {
+      if (size_x == 1 && size_y == 1)
+        d.writeFastVLine(x + 5, y, 8, bg);
+      else
+        d.writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+    }
+    d.endWrite();
+    return;
+  }
+  const GFXglyph *glyph = &s.font->glyph[c - s.font->first];
+  const uint8_t *bitmap = s.font->bitmap;
+  uint16_t bo = glyph->bitmapOffset;
+  uint8_t w = glyph->width, h = glyph->height;
+  int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+  uint8_t xx, yy, bits = 0, bit = 0;
+  int16_t xo16 = 0, yo16 = 0;
+  if (size_x > 1 || size_y > 1) {
+    xo16 = xo;
+    yo16 = yo;
+  }
+  d.startWrite();
+  for (yy = 0; yy < h; yy++) {
+    for (xx = 0; xx < w; xx++) {
+      if (!(bit++ & 7))
+        bits = bitmap[bo++];
+      if (bits & 0x80) {
+        if (size_x == 1 && size_y == 1)
+          d.writePixel(x + xo + xx, y + yo + yy, color);
+        else
+          d.writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y,
+                          size_x, size_y, color);
+      }
+      bits <<= 1;
+    }
+  }
+  d.endWrite();
+}
+
+// print() through drawCharPerPixel(), with the cursor handling of write()
+static void printPerPixel(Adafruit_GFX &d, const Style &s, int16_t x,
+                          int16_t y, const char *str) {
+  for (; *str; str++) {
+    uint8_t c = *str;
+    if (!s.font) {
+      if (s.wrap && x + s.sx * 6 > d.width()) {
+        x = 0;
+        y += s.sy * 8;
+      }
+      drawCharPerPixel(d, s, x, y, c);
+      x += s.sx * 6;
+      continue;
+    }
+    if (c < s.font->first || c > s.font->last)
+      continue;
+    const GFXglyph *g = &s.font->glyph[c - s.font->first];
+    if (g->width && g->height) {
+      if (s.wrap && x + s.sx * (g->xOffset + g->width) > d.width()) {
+        x = 0;
+        y += (int16_t)s.sy * s.font->yAdvance;
+      }
+      drawCharPerPixel(d, s, x, y, c);
+    }
+    x += g->xAdvance * (int16_t)s.sx;
+  }
+}
+
+static void print(Adafruit_GFX &d, const Style &s, int16_t x, int16_t y,
+                  const char *str) {
+  d.setFont(s.font);
+  d.cp437(s.cp437);
+  d.setTextWrap(s.wrap);
+  d.setTextColor(s.fg, s.bg);
+  d.setTextSize(s.sx, s.sy);
+  d.setCursor(x, y);
+  d.print(str);
+}
+
+/// A display with nothing but drawPixel(), so text goes through the
+/// generic writeCharRows()
+class PixelDisplay : public Adafruit_GFX {
+public:
+  PixelDisplay(int16_t w, int16_t h) : Adafruit_GFX(w, h), pixels(w * h) {}
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    int16_t t;
+    switch (rotation) {
+    case 1:
+      t = x;
+      x = WIDTH - 1 - y;
+      y = t;
+      break;
+    case 2:
+      x = WIDTH - 1 - x;
+      y = HEIGHT - 1 - y;
+      break;
+    case 3:
+      t = x;
+      x = y;
+      y = HEIGHT - 1 - t;
+      break;
+    }
+    if (x >= 0 && y >= 0 && x < WIDTH && y < HEIGHT)
+      pixels[y * WIDTH + x] = color;
+  }
+  void fillScreen(uint16_t color) {
+    std::fill(pixels.begin(), pixels.end(), color);
+  }
+  uint16_t *getBuffer(void) { return pixels.data(); }
+  std::vector<uint16_t> pixels;
+};
+
+template <typename Canvas> static size_t bytes(Canvas &c);
+template <> size_t bytes(GFXcanvas1 &c) {
+  return (c.width() + 7) / 8 * c.height();
+}
+template <> size_t bytes(GFXcanvas8 &c) { return c.width() * c.height(); }
+template <> size_t bytes(GFXcanvas16 &c) {
+  return c.width() * c.height() * 2;
+}
+template <> size_t bytes(PixelDisplay &c) { return c.pixels.size() * 2; }
+
+// Draws str at a random place and style both ways, returns whether the
+// results are identical
+template <typename Canvas>
+static bool drawSame(const GFXfont *f, const char *str, uint16_t maxColor,
+                     int it) {
+  Canvas a(150, 70), b(150, 70);
+  size_t n = bytes(a); // Unrotated
+  int r = rnd(4);
+  uint8_t sx = it < 20 ? 1 : 1 + rnd(3), sy = it < 20 ? 1 : 1 + rnd(3);
+  uint16_t fg = rnd(maxColor + 1);
+  Style s = {f, false, (it & 1) != 0, fg,
+             (uint16_t)(rnd(2) ? fg : rnd(maxColor + 1)), sx, sy};
+  a.setRotation(r);
+  b.setRotation(r);
+  int16_t x = rnd(a.width() + 60) - 40, y = rnd(a.height() + 40) - 20;
+  a.fillScreen(maxColor / 3);
+  b.fillScreen(maxColor / 3);
+  printPerPixel(a, s, x, y, str);
+  print(b, s, x, y, str);
+  return !memcmp(a.getBuffer(), b.getBuffer(), n);
+}
+
+template <typename Canvas>
+static void testStrings(const char *name, uint16_t maxColor) {
+  const GFXfont *fonts[2] = {NULL, &FreeSans9pt7b};
+  for (int f = 0; f < 2; f++) {
+    int diff = 0;
+    for (int it = 0; it < 200; it++)
+      diff += !drawSame<Canvas>(fonts[f], text, maxColor, it);
+    CHECK(!diff, "%s, %s: %d of 200 drawings differ", name,
+          f ? "FreeSans9pt7b" : "classic", diff);
+  }
+}
+
+template <typename Canvas>
+static void testCharset(const char *name, uint16_t maxColor) {
+  int diff = 0;
+  for (int cp = 0; cp < 2; cp++) {
+    for (int c = 0; c < 256; c++) {
+      Canvas a(20, 20), b(20, 20);
+      uint8_t size = 1 + c % 2;
+      Style s = {NULL, cp == 1, false, maxColor, (uint16_t)(c % 3 ? 0 : maxColor),
+                 size, size};
+      char str[2] = {(char)c, 0};
+      // On GFXcanvas1, alternate so both colors show against the fill
+      uint16_t fill = maxColor > 1 ? maxColor / 3 : (c >> 1) & 1;
+      a.fillScreen(fill);
+      b.fillScreen(fill);
+      if (!c || c == '\n' || c == '\r') {
+        // Characters print() does not draw
+        drawCharPerPixel(a, s, 2, 2, c);
+        b.drawChar(2, 2, c, s.fg, s.bg, size, size);
+      } else {
+        printPerPixel(a, s, 2, 2, str);
+        print(b, s, 2, 2, str);
+      }
+      diff += !!memcmp(a.getBuffer(), b.getBuffer(), bytes(a));
+    }
+  }
+  CHECK(!diff, "%s: %d of 512 characters differ", name, diff);
+}
+
+/// Counts the drawing calls text rendering makes
+class CallCounter : public Adafruit_GFX {
+public:
+  CallCounter(void) : Adafruit_GFX(320, 80) {}
+  void drawPixel(int16_t, int16_t, uint16_t) { calls++; }
+  void writePixel(int16_t, int16_t, uint16_t) { calls++; }
+  void writeFastHLine(int16_t, int16_t, int16_t, uint16_t) { calls++; }
+  void writeFastVLine(int16_t, int16_t, int16_t, uint16_t) { calls++; }
+  void writeFillRect(int16_t, int16_t, int16_t, int16_t, uint16_t) {
+    calls++;
+  }
+  unsigned long calls = 0;
+};
+
+static void bench(const char *name, const GFXfont *f, uint8_t size,
+                  uint16_t bg) {
+  static const char line[] = "Temp 23.5";
+  const int lines = 2000, glyphs = sizeof(line) - 1;
+  Style s = {f, false, false, 0xFFFF, bg, size, size};
+  int16_t y = f ? 20 : 0;
+  double rate[2];
+  unsigned long calls[2];
+  for (int p = 0; p < 2; p++) {
+    CallCounter counter;
+    if (p)
+      print(counter, s, 0, y, line);
+    else
+      printPerPixel(counter, s, 0, y, line);
+    calls[p] = counter.calls;
+    GFXcanvas16 c(128, 64);
+    // Best of 5 runs
+    rate[p] = 0;
+    for (int rep = 0; rep < 5; rep++) {
+      unsigned long start = micros();
+      for (int i = 0; i < lines; i++) {
+        if (p)
+          print(c, s, 0, y, line);
+        else
+          printPerPixel(c, s, 0, y, line);
+      }
+      unsigned long us = micros() - start;
+      double r = (double)lines * glyphs * 1e6 / (us ? us : 1);
+      rate[p] = r > rate[p] ? r : rate[p];
+    }
+  }
+  printf("  %-22s %5.2f -> %5.2f M glyphs/s %5.1f -> %5.1f draw calls/glyph\n",
+         name, rate[0] / 1e6, rate[1] / 1e6, (double)calls[0] / glyphs,
+         (double)calls[1] / glyphs);
+}
+
+int main(void) {
+  printf("Strings\n");
+  testStrings<GFXcanvas1>("GFXcanvas1", 1);
+  testStrings<GFXcanvas8>("GFXcanvas8", 0xFF);
+  testStrings<GFXcanvas16>("GFXcanvas16", 0xFFFF);
+  testStrings<PixelDisplay>("drawPixel() only", 0xFFFF);
+  printf("Classic charset\n");
+  testCharset<GFXcanvas1>("GFXcanvas1", 1);
+  testCharset<GFXcanvas8>("GFXcanvas8", 0xFF);
+  testCharset<GFXcanvas16>("GFXcanvas16", 0xFFFF);
+  testCharset<PixelDisplay>("drawPixel() only", 0xFFFF);
+
+  printf("\"Temp 23.5\" on GFXcanvas16, per pixel -> runs\n");
+  bench("classic, transparent", NULL, 1, 0xFFFF);
+  bench("classic, opaque", NULL, 1, 0x0000);
+  bench("classic x2, opaque", NULL, 2, 0x0000);
+  bench("FreeSans9pt7b", &FreeSans9pt7b, 1, 0xFFFF);
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -7,6 +7,14 @@
 #ifndef _GFXFONT_H_
 #define _GFXFONT_H_
 
+// Bitmap formats of a GFXpackedFont, a plain GFXfont is GFX_FONT_1BPP.
+// fontconvert/gfxpack.h describes how each format is laid out.
+#define GFX_FONT_1BPP 0x00     ///< 1 bit per pixel
+#define GFX_FONT_2BPP 0x01     ///< 2 bits of coverage per pixel (anti-aliased)
+#define GFX_FONT_4BPP 0x02     ///< 4 bits of coverage per pixel (anti-aliased)
+#define GFX_FONT_BPP_MASK 0x03 ///< Bits of GFXfont->format holding the depth
+#define GFX_FONT_RLE 0x04      ///< Glyphs are run-length encoded
+
 /// Font data stored PER GLYPH
 typedef struct {
   uint16_t bitmapOffset; ///< Pointer into GFXfont->bitmap
@@ -26,4 +34,11 @@ typedef struct {
   uint8_t yAdvance; ///< Newline distance (y axis)
 } GFXfont;
 
+/// Font with run-length encoded or anti-aliased glyphs, pass its address to
+/// setPackedFont(). Made by fontconvert -c, -a2 or -a4, or fontpack -w.
+typedef struct {
+  GFXfont font;   ///< Same fields as a plain font
+  uint8_t format; ///< Bitmap format, GFX_FONT_* flags
+} GFXpackedFont;
+
 #endif // _GFXFONT_H_
@@ -338,3 +338,307 @@ uint8_t Adafruit_ILI9341::readcommand8(uint8_t commandByte, uint8_t index) {
   sendCommand(0xD9, &data, 1); // Set Index Register
   return Adafruit_SPITFT::readcommand8(commandByte);
 }
+
+/**************************************************************************/
+/*!
+    @brief  Draw a character with the classic 5x7 font, whatever font is set
+            with setFont(). The current font and cursor are left unchanged.
+    @param    x  Left of the character
+    @param    y  Top of the character
+    @param    c  The 8-bit font-indexed character
+    @param    color  16-bit 5-6-5 color of the character
+    @param    bg  16-bit 5-6-5 background color
+    @param    size  Magnification, 1 for 6x8 pixels
+ */
+/**************************************************************************/
+void Adafruit_ILI9341::drawClassicChar(int16_t x, int16_t y, unsigned char c,
+                                       uint16_t color, uint16_t bg,
+                                       uint8_t size) {
+  GFXfont *font = gfxFont;
+  gfxFont = NULL;
+  drawChar(x, y, c, color, bg, size);
+  gfxFont = font;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Instantiate a text console on an ILI9341. Nothing is allocated
+             or drawn until begin().
+    @param   tft   The display, already started with its own begin()
+    @param   size  Magnification of the classic 6x8 font
+*/
+/**************************************************************************/
+Adafruit_ILI9341_Console::Adafruit_ILI9341_Console(Adafruit_ILI9341 *tft,
+                                                   uint8_t size)
+    : _tft(tft), _text(NULL), _length(NULL), _maxLines(0), _maxCols(0),
+      _last(0), _count(0), _rows(0), _cols(0), _scroll(0),
+      _size(size ? size : 1), _rotation(0), _top(0), _bottom(0), _tfa(0),
+      _fg(ILI9341_WHITE), _bg(ILI9341_BLACK), _hardware(false) {}
+
+/**************************************************************************/
+/*!
+    @brief   Free the line buffer. The display keeps its scroll settings.
+*/
+/**************************************************************************/
+Adafruit_ILI9341_Console::~Adafruit_ILI9341_Console(void) {
+  free(_text);
+  free(_length);
+}
+
+/**************************************************************************/
+/*!
+    @brief   Allocate the line buffer and draw the empty console. It spans
+             the full width of the screen, between two fixed areas that
+             are left for the sketch to draw in (a title, a status bar).
+             Whatever the sketch draws inside the console area itself moves
+             with the hardware scrolling.
+    @param   top     Height of the fixed area above the console, in pixels
+    @param   bottom  Height of the fixed area below the console, in pixels
+    @return  true on success, false if out of memory or no row fits
+*/
+/**************************************************************************/
+bool Adafruit_ILI9341_Console::begin(uint16_t top, uint16_t bottom) {
+  uint16_t ch = 8 * _size, cw = 6 * _size;
+
+  free(_text);
+  free(_length);
+  _text = NULL;
+  _length = NULL;
+  _rows = _cols = 0;
+  if ((top + bottom + ch > ILI9341_TFTHEIGHT) || (cw > ILI9341_TFTWIDTH))
+    return false;
+
+  // Enough lines for portrait, enough columns for landscape, so a
+  // rotation can show everything that still fits
+  _maxLines = (ILI9341_TFTHEIGHT - top - bottom) / ch;
+  _maxCols = ILI9341_TFTHEIGHT / cw;
+  _text = (char *)malloc(_maxLines * _maxCols);
+  _length = (uint8_t *)malloc(_maxLines);
+  if (!_text || !_length) {
+    free(_text);
+    free(_length);
+    _text = NULL;
+    _length = NULL;
+    return false;
+  }
+  _top = top;
+  _bottom = bottom;
+  _last = 0;
+  _count = 1;
+  _length[0] = 0;
+  layout();
+  redraw();
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Set the text colors. Only new text uses them until the next
+             redraw().
+    @param   fg  Text color
+    @param   bg  Background color, also used to erase; must differ from fg
+*/
+/**************************************************************************/
+void Adafruit_ILI9341_Console::setTextColor(uint16_t fg, uint16_t bg) {
+  _fg = fg;
+  _bg = bg;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Forget all lines and blank the console area
+*/
+/**************************************************************************/
+void Adafruit_ILI9341_Console::clear(void) {
+  if (_text) {
+    _last = 0;
+    _count = 1;
+    _length[0] = 0;
+    redraw();
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief   Draw the whole console again from the line buffer. Call this
+             after setRotation() on the display (otherwise it happens on the
+             next write) or after drawing over the console area.
+*/
+/**************************************************************************/
+void Adafruit_ILI9341_Console::redraw(void) {
+  if (!_text)
+    return;
+  if (_tft->getRotation() != _rotation)
+    layout();
+  if (!_rows)
+    return;
+  uint8_t shown = (_count < _rows) ? _count : _rows;
+  _tft->fillRect(0, _top, _tft->width(), _rows * 8 * _size, _bg);
+  for (uint8_t row = 0; row < shown; row++)
+    drawRow(row, 0);
+}
+
+/**************************************************************************/
+/*!
+    @brief   Print a character to the console. '\n' starts a new line, '\r'
+             is ignored and lines longer than columns() wrap.
+    @param   c  The character
+    @return  1 once the console is started, 0 before
+*/
+/**************************************************************************/
+size_t Adafruit_ILI9341_Console::write(uint8_t c) {
+  if (!_text)
+    return 0;
+  if (_tft->getRotation() != _rotation)
+    redraw();
+  if (c == '\n') {
+    newLine();
+  } else if (c != '\r') {
+    if (_length[_last] >= _cols)
+      newLine();
+    char *line = &_text[_last * _maxCols];
+    uint8_t n = _length[_last]++;
+    line[n] = c;
+    if (_rows) {
+      uint8_t shown = (_count < _rows) ? _count : _rows;
+      drawText(n * 6 * _size, rowY(shown - 1), &line[n], 1);
+    }
+  }
+  return 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Fit the console to the display's current rotation and set up
+             the scrolling area. The ILI9341 only scrolls along its 320
+             pixel side, which is vertical in rotations 0 and 2; in 1 and 3
+             scrolling is turned off and new lines redraw every row.
+*/
+/**************************************************************************/
+void Adafruit_ILI9341_Console::layout(void) {
+  uint16_t ch = 8 * _size, height = _tft->height();
+
+  _rotation = _tft->getRotation();
+  _cols = _tft->width() / (6 * _size);
+  if (_cols > _maxCols)
+    _cols = _maxCols;
+  _rows = (_top + _bottom + ch <= height) ? (height - _top - _bottom) / ch : 0;
+  if (_rows > _maxLines)
+    _rows = _maxLines;
+  _scroll = 0;
+  _hardware = _rows && !(_rotation & 1);
+  if (_hardware) {
+    // The scrolling area is exactly _rows text rows. Rotation 2 has the
+    // panel's first line at the bottom of the screen, so the fixed areas
+    // trade places there; the leftover lines go below the console.
+    _tfa = _rotation ? ILI9341_TFTHEIGHT - _top - _rows * ch : _top;
+    _tft->setScrollMargins(_tfa, ILI9341_TFTHEIGHT - _tfa - _rows * ch);
+    _tft->scrollTo(_tfa);
+  } else {
+    _tft->setScrollMargins(0, 0);
+    _tft->scrollTo(0);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief   End the current line. Once every row is in use, the console
+             scrolls by one row: the row slot that leaves the top is erased
+             where it has text and becomes the new bottom row.
+*/
+/**************************************************************************/
+void Adafruit_ILI9341_Console::newLine(void) {
+  uint8_t shown = (_count < _rows) ? _count : _rows, gone = 0;
+  if (_rows) {
+    gone = _length[rowLine(0)];
+    if (gone > _cols)
+      gone = _cols;
+  }
+
+  _last = (_last + 1) % _maxLines;
+  _length[_last] = 0;
+  if (_count < _maxLines)
+    _count++;
+  if (!_rows || (shown < _rows))
+    return; // The next row down is still blank
+
+  if (_hardware) {
+    if (gone)
+      _tft->fillRect(0, rowY(0), gone * 6 * _size, 8 * _size, _bg);
+    _scroll = (_scroll + 1) % _rows;
+    // In rotation 2 the rows run against the panel's line order
+    uint8_t first = _rotation ? (_rows - _scroll) % _rows : _scroll;
+    _tft->scrollTo(_tfa + first * 8 * _size);
+  } else {
+    // Every row moves up; each one is erased only as far as the line it
+    // showed before reached
+    for (uint8_t row = 0; row < _rows; row++) {
+      uint8_t before = gone;
+      if (row) {
+        before = _length[rowLine(row - 1)];
+        if (before > _cols)
+          before = _cols;
+      }
+      drawRow(row, before);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief   Ring index of the line shown in a row
+    @param   row  Row on screen, 0 at the top
+    @return  Index into the line buffer
+*/
+/**************************************************************************/
+uint8_t Adafruit_ILI9341_Console::rowLine(uint8_t row) const {
+  uint8_t shown = (_count < _rows) ? _count : _rows;
+  return (_last + _maxLines + 1 - shown + row) % _maxLines;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Where a row is drawn. With hardware scrolling, rows live in
+             fixed slots of display memory and the scroll start address
+             decides which slot shows at the top.
+    @param   row  Row on screen, 0 at the top
+    @return  Y coordinate to draw at, in the current rotation
+*/
+/**************************************************************************/
+int16_t Adafruit_ILI9341_Console::rowY(uint8_t row) const {
+  return _top + ((_scroll + row) % _rows) * 8 * _size;
+}
+
+/**************************************************************************/
+/*!
+    @brief   Draw the line shown in a row, erasing old text past its end
+    @param   row      Row on screen, 0 at the top
+    @param   clearTo  Columns of old text in the row to erase up to
+*/
+/**************************************************************************/
+void Adafruit_ILI9341_Console::drawRow(uint8_t row, uint8_t clearTo) {
+  uint8_t line = rowLine(row), n = _length[line];
+  int16_t y = rowY(row);
+  if (n > _cols)
+    n = _cols;
+  drawText(0, y, &_text[line * _maxCols], n);
+  if (clearTo > n)
+    _tft->fillRect(n * 6 * _size, y, (clearTo - n) * 6 * _size, 8 * _size,
+                   _bg);
+}
+
+/**************************************************************************/
+/*!
+    @brief   Draw characters in the classic font with an opaque background,
+             whatever font the sketch has selected on the display
+    @param   x     Left edge of the first character
+    @param   y     Top edge
+    @param   text  Characters to draw
+    @param   n     Number of characters
+*/
+/**************************************************************************/
+void Adafruit_ILI9341_Console::drawText(int16_t x, int16_t y,
+                                        const char *text, uint8_t n) {
+  for (uint8_t i = 0; i < n; i++)
+    _tft->drawClassicChar(x + i * 6 * _size, y, text[i], _fg, _bg, _size);
+}
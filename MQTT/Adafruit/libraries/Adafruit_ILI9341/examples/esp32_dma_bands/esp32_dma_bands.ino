@@ -0,0 +1,76 @@
+// Full-screen animation for ESP32, drawn in horizontal bands into a small
+// GFXcanvas16 and pushed with writePixels(). With DMA, writePixels() can
+// return while a band is still being transferred, so the next band is drawn
+// at the same time. The sketch alternates between blocking and overlapped
+// pushes and prints the frame rate of both.
+//
+// DMA on ESP32 is experimental, it has only been run against a host model
+// of the ESP-IDF driver (Adafruit_GFX_Library/extras/host). It has to be
+// enabled when the library is compiled: build with -DUSE_SPI_DMA
+// -DESP32_SPI_DMA_EXPERIMENTAL (e.g. build_flags in PlatformIO). Without
+// them, both modes use blocking writes and show the same frame rate.
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_ILI9341.h"
+
+// TFT FeatherWing on an ESP32 Feather
+#define TFT_CS 15
+#define TFT_DC 33
+
+Adafruit_ILI9341 tft(TFT_CS, TFT_DC);
+
+// A band fills both DMA working buffers (2 x ESP32_DMA_LINES scanlines),
+// writePixels() then returns as soon as it has queued them.
+#define BAND_LINES 8
+GFXcanvas16 band(ILI9341_TFTHEIGHT, BAND_LINES);
+
+uint32_t frame = 0;
+
+// Draws the part of the current frame that starts at screen row y
+void renderBand(int16_t y) {
+  band.fillScreen(ILI9341_NAVY);
+  for (int16_t x = -(int16_t)(frame % 32); x < band.width(); x += 32) {
+    band.fillRect(x, 0, 16, BAND_LINES, ILI9341_DARKCYAN); // Scrolling bars
+  }
+  int16_t ballx = 40 + (frame * 3) % 240, bally = 120;
+  band.fillCircle(ballx, bally - y, 30, ILI9341_RED);
+  band.setTextSize(3);
+  band.setTextColor(ILI9341_WHITE);
+  band.setCursor(20, 20 - y);
+  band.print("Frame ");
+  band.print(frame);
+}
+
+// Returns the frame rate over the given number of frames
+float run(bool overlap, uint16_t frames) {
+  uint32_t start = millis();
+  for (uint16_t f = 0; f < frames; f++, frame++) {
+    tft.startWrite();
+    tft.setAddrWindow(0, 0, tft.width(), tft.height());
+    for (int16_t y = 0; y < tft.height(); y += BAND_LINES) {
+      renderBand(y);
+      int16_t lines = min(BAND_LINES, tft.height() - y);
+      // Non-blocking when overlapping, band is copied before it returns
+      tft.writePixels(band.getBuffer(), tft.width() * lines, !overlap);
+    }
+    tft.dmaWait(); // Wait for last band to complete
+    tft.endWrite();
+  }
+  return frames * 1000.0 / (millis() - start);
+}
+
+void setup() {
+  Serial.begin(115200);
+  tft.begin(40000000);
+  tft.setRotation(1); // Landscape, 320x240
+}
+
+void loop() {
+  float blocking = run(false, 50);
+  float overlapped = run(true, 50);
+  Serial.print("blocking: ");
+  Serial.print(blocking);
+  Serial.print(" fps, overlapped: ");
+  Serial.print(overlapped);
+  Serial.println(" fps");
+}
@@ -86,6 +86,56 @@ Adafruit_LIS3DH::Adafruit_LIS3DH(int8_t cspin, int8_t mosipin, int8_t misopin,
   _frequency = frequency;
 }
 
+/*!
+ *   @brief  Takes over the bus devices and register map of another LIS3DH,
+ *           which is left without them
+ *   @param  other
+ *           the LIS3DH to take over
+ */
+Adafruit_LIS3DH::Adafruit_LIS3DH(Adafruit_LIS3DH &&other) {
+  *this = static_cast<Adafruit_LIS3DH &&>(other);
+}
+
+/*!
+ *   @brief  Frees the bus devices and register map, then takes over those of
+ *           another LIS3DH, which is left without them
+ *   @param  other
+ *           the LIS3DH to take over
+ *   @return this LIS3DH
+ */
+Adafruit_LIS3DH &Adafruit_LIS3DH::operator=(Adafruit_LIS3DH &&other) {
+  if (this == &other)
+    return *this;
+  delete ctrl_regs;
+  delete i2c_dev;
+  delete spi_dev;
+  ctrl_regs = other.ctrl_regs;
+  i2c_dev = other.i2c_dev;
+  spi_dev = other.spi_dev;
+  other.ctrl_regs = NULL;
+  other.i2c_dev = NULL;
+  other.spi_dev = NULL;
+
+  x = other.x;
+  y = other.y;
+  z = other.z;
+  x_g = other.x_g;
+  y_g = other.y_g;
+  z_g = other.z_g;
+  I2Cinterface = other.I2Cinterface;
+  SPIinterface = other.SPIinterface;
+  _wai = other._wai;
+  _cs = other._cs;
+  _mosi = other._mosi;
+  _miso = other._miso;
+  _sck = other._sck;
+  _i2caddr = other._i2caddr;
+  _sensorID = other._sensorID;
+  _fifoOverrun = other._fifoOverrun;
+  _frequency = other._frequency;
+  return *this;
+}
+
 /*!
  *  @brief  Setups the HW (reads coefficients values, etc.)
  *  @param  i2caddr
@@ -98,6 +148,7 @@ bool Adafruit_LIS3DH::begin(uint8_t i2caddr, uint8_t nWAI) {
   _i2caddr = i2caddr;
   _wai = nWAI;
   if (I2Cinterface) {
+    delete i2c_dev;
     i2c_dev = new Adafruit_I2CDevice(_i2caddr, I2Cinterface);
 
     if (!i2c_dev->begin()) {
@@ -106,6 +157,7 @@ bool Adafruit_LIS3DH::begin(uint8_t i2caddr, uint8_t nWAI) {
   } else if (_cs != -1) {
 
     // SPIinterface->beginTransaction(SPISettings(500000, MSBFIRST, SPI_MODE0));
+    delete spi_dev;
     if (_sck == -1) {
       spi_dev = new Adafruit_SPIDevice(_cs,
                                        _frequency,            // frequency
@@ -130,25 +182,35 @@ bool Adafruit_LIS3DH::begin(uint8_t i2caddr, uint8_t nWAI) {
     // Serial.println(deviceid, HEX);
     return false;
   }
-  Adafruit_BusIO_Register _ctrl1 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL1, 1);
+
+  // TEMP_CFG_REG to CTRL_REG6 only change when we write them, so keep a copy
+  // and send the setup below as one burst
+  delete ctrl_regs;
+  ctrl_regs = new Adafruit_BusIO_RegisterMap(
+      i2c_dev, spi_dev, AD8_HIGH_TOREAD_AD7_HIGH_TOINC, LIS3DH_REG_TEMPCFG, 7,
+      0x80); // set [7] for auto-increment
+  ctrl_regs->beginUpdate();
+
+  Adafruit_BusIO_Register _ctrl1 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL1);
   _ctrl1.write(0x07); // enable all axes, normal mode
 
   // 400Hz rate
   setDataRate(LIS3DH_DATARATE_400_HZ);
 
-  Adafruit_BusIO_Register _ctrl4 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL4, 1);
+  Adafruit_BusIO_Register _ctrl4 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL4);
   _ctrl4.write(0x88); // High res & BDU enabled
 
   enableDRDY(true, 1);
 
   // Turn on orientation config
 
-  Adafruit_BusIO_Register _tmp_cfg = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_TEMPCFG, 1);
+  Adafruit_BusIO_Register _tmp_cfg =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_TEMPCFG);
   _tmp_cfg.write(0x80); // enable adcs
 
+  ctrl_regs->commit();
   return true;
 }
 
@@ -291,8 +353,8 @@ void Adafruit_LIS3DH::setClick(uint8_t c, uint8_t clickthresh,
                                uint8_t timelimit, uint8_t timelatency,
                                uint8_t timewindow) {
 
-  Adafruit_BusIO_Register ctrl3 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL3, 1);
+  Adafruit_BusIO_Register ctrl3 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL3);
   Adafruit_BusIO_RegisterBits i1_click =
       Adafruit_BusIO_RegisterBits(&ctrl3, 1, 7);
 
@@ -309,8 +371,8 @@ void Adafruit_LIS3DH::setClick(uint8_t c, uint8_t clickthresh,
 
   i1_click.write(1); // enable i1 click
 
-  Adafruit_BusIO_Register ctrl5 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL5, 1);
+  Adafruit_BusIO_Register ctrl5 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL5);
 
   Adafruit_BusIO_RegisterBits int1_latch_bit =
       Adafruit_BusIO_RegisterBits(&ctrl5, 1, 3);
@@ -360,6 +422,119 @@ uint8_t Adafruit_LIS3DH::readAndClearInterrupt(void) {
   return int_reg.read();
 }
 
+/*!
+ *   @brief  Sets up the 32 sample FIFO. Switching goes through bypass mode,
+ *   which empties the FIFO.
+ *   @param  mode
+ *           LIS3DH_FIFO_BYPASS turns the FIFO off, LIS3DH_FIFO_STREAM keeps
+ *           the newest samples and is the one for continuous logging
+ *   @param  watermark
+ *           number of stored samples (0-31) that sets the watermark flag
+ *           and interrupt
+ *   @return true: success false: failure
+ */
+bool Adafruit_LIS3DH::setFifoMode(lis3dh_fifo_mode_t mode, uint8_t watermark) {
+  Adafruit_BusIO_Register _ctrl5 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL5);
+  Adafruit_BusIO_RegisterBits fifo_enable =
+      Adafruit_BusIO_RegisterBits(&_ctrl5, 1, 6);
+  Adafruit_BusIO_Register fifo_ctrl = Adafruit_BusIO_Register(
+      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_FIFOCTRL, 1);
+
+  if (!fifo_ctrl.write(LIS3DH_FIFO_BYPASS << 6) ||
+      !fifo_enable.write(mode != LIS3DH_FIFO_BYPASS)) {
+    return false;
+  }
+  _fifoOverrun = false;
+  if (mode == LIS3DH_FIFO_BYPASS) {
+    return true;
+  }
+  return fifo_ctrl.write((mode << 6) | min(watermark, (uint8_t)31));
+}
+
+/*!
+ *   @brief  Route the FIFO watermark flag to INT1, so the sketch can wait
+ *   for a batch of samples instead of polling
+ *   @param  enable true to enable, false to disable
+ *   @return true: success false: failure
+ */
+bool Adafruit_LIS3DH::enableFifoWatermarkInterrupt(bool enable) {
+  Adafruit_BusIO_Register _ctrl3 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL3);
+  Adafruit_BusIO_RegisterBits i1_wtm =
+      Adafruit_BusIO_RegisterBits(&_ctrl3, 1, 2);
+  return i1_wtm.write(enable);
+}
+
+/*!
+ *   @brief  Number of samples waiting in the FIFO
+ *   @return 0 to LIS3DH_FIFO_SIZE
+ */
+uint8_t Adafruit_LIS3DH::fifoAvailable(void) {
+  Adafruit_BusIO_Register fifo_src = Adafruit_BusIO_Register(
+      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_FIFOSRC, 1);
+  uint8_t src;
+  if (!fifo_src.read(&src)) {
+    return 0;
+  }
+  // [WTM, OVRN_FIFO, EMPTY, FSS4:0]; the level field tops out at 31
+  _fifoOverrun = src & 0x40;
+  if (src & 0x20) {
+    return 0;
+  }
+  return _fifoOverrun ? LIS3DH_FIFO_SIZE : (src & 0x1F);
+}
+
+/*!
+ *   @brief  Whether the FIFO was full at the last fifoAvailable() or
+ *   readFifo(). In stream mode this means older samples were dropped.
+ *   @return true if the FIFO overran
+ */
+bool Adafruit_LIS3DH::fifoOverrun(void) { return _fifoOverrun; }
+
+/*!
+ *   @brief  Reads the samples waiting in the FIFO, oldest first, in one
+ *   burst (or as few as the I2C buffer allows). Values are raw and left
+ *   justified like x, y and z.
+ *   @param  samples
+ *           where to put the x, y and z of each sample
+ *   @param  max
+ *           room in samples, up to LIS3DH_FIFO_SIZE is useful
+ *   @return number of samples read
+ */
+uint8_t Adafruit_LIS3DH::readFifo(int16_t samples[][3], uint8_t max) {
+  uint8_t count = min(fifoAvailable(), max);
+
+  uint8_t register_address = LIS3DH_REG_OUT_X_L;
+  uint8_t per_read = LIS3DH_FIFO_SIZE;
+  if (i2c_dev) {
+    register_address |= 0x80; // set [7] for auto-increment
+    per_read = min((size_t)LIS3DH_FIFO_SIZE, i2c_dev->maxBufferSize() / 6);
+  } else {
+    register_address |= 0x40; // set [6] for auto-increment
+    register_address |= 0x80; // set [7] for read
+  }
+  // With the FIFO on, the address wraps from OUT_Z_H back to OUT_X_L, so
+  // one read drains several samples
+  Adafruit_BusIO_Register xl_data = Adafruit_BusIO_Register(
+      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, register_address, 6);
+
+  for (uint8_t done = 0; done < count;) {
+    uint8_t n = min((uint8_t)(count - done), per_read);
+    uint8_t *buffer = (uint8_t *)samples[done];
+    if (!xl_data.read(buffer, n * 6)) {
+      return done;
+    }
+    // Little endian on the wire, converted in place
+    for (uint8_t i = 0; i < n * 3; i++) {
+      samples[done + i / 3][i % 3] =
+          (int16_t)(buffer[2 * i] | ((uint16_t)buffer[2 * i + 1] << 8));
+    }
+    done += n;
+  }
+  return count;
+}
+
 /**
  * @brief Enable or disable the Data Ready interupt
  *
@@ -369,8 +544,8 @@ uint8_t Adafruit_LIS3DH::readAndClearInterrupt(void) {
  * @return true: success false: failure
  */
 bool Adafruit_LIS3DH::enableDRDY(bool enable_drdy, uint8_t int_pin) {
-  Adafruit_BusIO_Register _ctrl3 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL3, 1);
+  Adafruit_BusIO_Register _ctrl3 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL3);
   Adafruit_BusIO_RegisterBits _drdy1_int_enable =
       Adafruit_BusIO_RegisterBits(&_ctrl3, 1, 4);
   Adafruit_BusIO_RegisterBits _drdy2_int_enable =
@@ -396,13 +571,13 @@ bool Adafruit_LIS3DH::enableDRDY(bool enable_drdy, uint8_t int_pin) {
  */
 void Adafruit_LIS3DH::setPerformanceMode(lis3dh_mode_t mode) {
   // low power bit is in CTRL1, 4th bit from right
-  Adafruit_BusIO_Register _ctrl1 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL1, 1);
+  Adafruit_BusIO_Register _ctrl1 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL1);
   Adafruit_BusIO_RegisterBits ctrl1_mode_bits =
       Adafruit_BusIO_RegisterBits(&_ctrl1, 1, 3);
   // high res bit is in CTRL4, 4th bit from right
-  Adafruit_BusIO_Register _ctrl4 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL4, 1);
+  Adafruit_BusIO_Register _ctrl4 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL4);
   Adafruit_BusIO_RegisterBits ctrl4_mode_bits =
       Adafruit_BusIO_RegisterBits(&_ctrl4, 1, 3);
   switch (mode) {
@@ -433,13 +608,13 @@ void Adafruit_LIS3DH::setPerformanceMode(lis3dh_mode_t mode) {
  */
 lis3dh_mode_t Adafruit_LIS3DH::getPerformanceMode(void) {
   // low power bit is in CTRL1, 4th bit from right
-  Adafruit_BusIO_Register _ctrl1 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL1, 1);
+  Adafruit_BusIO_Register _ctrl1 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL1);
   Adafruit_BusIO_RegisterBits ctrl1_mode_bits =
       Adafruit_BusIO_RegisterBits(&_ctrl1, 1, 3);
   // high res bit is in CTRL4, 4th bit from right
-  Adafruit_BusIO_Register _ctrl4 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL4, 1);
+  Adafruit_BusIO_Register _ctrl4 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL4);
   Adafruit_BusIO_RegisterBits ctrl4_mode_bits =
       Adafruit_BusIO_RegisterBits(&_ctrl4, 1, 3);
 
@@ -460,8 +635,8 @@ lis3dh_mode_t Adafruit_LIS3DH::getPerformanceMode(void) {
  */
 void Adafruit_LIS3DH::setRange(lis3dh_range_t range) {
 
-  Adafruit_BusIO_Register _ctrl4 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL4, 1);
+  Adafruit_BusIO_Register _ctrl4 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL4);
 
   Adafruit_BusIO_RegisterBits range_bits =
       Adafruit_BusIO_RegisterBits(&_ctrl4, 2, 4);
@@ -474,8 +649,8 @@ void Adafruit_LIS3DH::setRange(lis3dh_range_t range) {
  *  @return Returns g range value
  */
 lis3dh_range_t Adafruit_LIS3DH::getRange(void) {
-  Adafruit_BusIO_Register _ctrl4 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL4, 1);
+  Adafruit_BusIO_Register _ctrl4 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL4);
 
   Adafruit_BusIO_RegisterBits range_bits =
       Adafruit_BusIO_RegisterBits(&_ctrl4, 2, 4);
@@ -488,8 +663,8 @@ lis3dh_range_t Adafruit_LIS3DH::getRange(void) {
  *          data rate value
  */
 void Adafruit_LIS3DH::setDataRate(lis3dh_dataRate_t dataRate) {
-  Adafruit_BusIO_Register _ctrl1 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL1, 1);
+  Adafruit_BusIO_Register _ctrl1 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL1);
   Adafruit_BusIO_RegisterBits data_rate_bits =
       Adafruit_BusIO_RegisterBits(&_ctrl1, 4, 4);
 
@@ -501,8 +676,8 @@ void Adafruit_LIS3DH::setDataRate(lis3dh_dataRate_t dataRate) {
  *   @return Returns Data Rate value
  */
 lis3dh_dataRate_t Adafruit_LIS3DH::getDataRate(void) {
-  Adafruit_BusIO_Register _ctrl1 = Adafruit_BusIO_Register(
-      i2c_dev, spi_dev, ADDRBIT8_HIGH_TOREAD, LIS3DH_REG_CTRL1, 1);
+  Adafruit_BusIO_Register _ctrl1 =
+      Adafruit_BusIO_Register(ctrl_regs, LIS3DH_REG_CTRL1);
   Adafruit_BusIO_RegisterBits data_rate_bits =
       Adafruit_BusIO_RegisterBits(&_ctrl1, 4, 4);
 
@@ -0,0 +1,208 @@
+// Host test of the LIS3DH FIFO functions against a model of the sensor's
+// output stage on a fake 400 kHz TwoWire (stub/Wire.h): a sample every
+// period, either in the output registers or queued in the 32-level FIFO.
+// With the FIFO on, the address wraps from OUT_Z_H back to OUT_X_L.
+//
+// - setFifoMode() and enableFifoWatermarkInterrupt() set the registers,
+//   readFifo() returns samples in order and intact, fifoAvailable() and
+//   fifoOverrun() follow the FIFO, and bypass empties it.
+// - For 1 s at 400, 1344 and 5405 Hz, haveNewData() + read() against
+//   readFifo() on the watermark interrupt: samples produced and received,
+//   and bus transactions. Neither may lose a sample at 400 Hz, readFifo()
+//   none at 1344 Hz either.
+#include <Adafruit_LIS3DH.h>
+
+#include <stdio.h>
+
+#include <deque>
+#include <set>
+
+TwoWire Wire;
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+#define WATERMARK 16
+
+/// The output stage. Samples count up, and go into OUT_X/Y/Z as n, ~n, 3n.
+struct Model {
+  TwoWire::Device &d;
+  uint32_t periodMicros = 2500, start = 0, made = 0;
+  std::deque<uint16_t> fifo;
+  uint16_t latest = 0;
+  bool ready = false, full = false, stopped = false;
+
+  explicit Model(TwoWire::Device &device) : d(device) {}
+
+  bool fifoOn(void) {
+    return (d.regs[LIS3DH_REG_CTRL5] & 0x40) &&
+           (d.regs[LIS3DH_REG_FIFOCTRL] >> 6);
+  }
+  void update(void) {
+    if (stopped)
+      return;
+    uint32_t due = (micros() - start) / periodMicros;
+    for (; made < due; made++) {
+      if (!fifoOn()) {
+        latest = made;
+        ready = true;
+        continue;
+      }
+      if (fifo.size() == 32) {
+        if ((d.regs[LIS3DH_REG_FIFOCTRL] >> 6) == 1)
+          continue; // FIFO mode stops when full
+        fifo.pop_front();
+      }
+      fifo.push_back(made);
+      full = fifo.size() == 32;
+    }
+  }
+  void restart(void) {
+    stopped = ready = full = false;
+    start = micros();
+    made = 0;
+    fifo.clear();
+  }
+  /// The INT1 pin, read without bus traffic
+  bool int1(void) {
+    update();
+    return (d.regs[LIS3DH_REG_CTRL3] & 0x04) && fifoOn() &&
+           fifo.size() > (d.regs[LIS3DH_REG_FIFOCTRL] & 0x1F);
+  }
+  void put(uint16_t n) {
+    int16_t v[3] = {(int16_t)n, (int16_t)~n, (int16_t)(n * 3)};
+    memcpy(&d.regs[LIS3DH_REG_OUT_X_L], v, 6);
+  }
+  void read(uint8_t r) {
+    update();
+    if (r == LIS3DH_REG_STATUS2)
+      d.regs[r] = ready ? 0x08 : 0;
+    if (r == LIS3DH_REG_FIFOSRC) {
+      size_t n = fifo.size();
+      d.regs[r] = (n > (d.regs[LIS3DH_REG_FIFOCTRL] & 0x1F) ? 0x80 : 0) |
+                  (full ? 0x40 : 0) | (n ? 0 : 0x20) | (n == 32 ? 31 : n);
+    }
+    if (r == LIS3DH_REG_OUT_X_L) {
+      if (!fifoOn()) {
+        put(latest);
+        ready = false;
+      } else if (!fifo.empty()) {
+        put(fifo.front());
+        fifo.pop_front();
+        full = false;
+      }
+    }
+  }
+  void write(uint8_t r) {
+    if (r == LIS3DH_REG_FIFOCTRL && !(d.regs[r] >> 6)) {
+      fifo.clear(); // Bypass
+      full = false;
+    }
+  }
+  uint8_t step(uint8_t r) {
+    return (r == LIS3DH_REG_OUT_Z_H + 1 && fifoOn()) ? LIS3DH_REG_OUT_X_L : r;
+  }
+};
+
+static void testFunctions(Adafruit_LIS3DH &lis, Model &m) {
+  TwoWire::Device &d = m.d;
+  CHECK(lis.setFifoMode(LIS3DH_FIFO_STREAM, 24), "setFifoMode()");
+  CHECK(d.regs[LIS3DH_REG_FIFOCTRL] == 0x98 &&
+            (d.regs[LIS3DH_REG_CTRL5] & 0x40),
+        "stream mode registers");
+  CHECK(lis.enableFifoWatermarkInterrupt() &&
+            (d.regs[LIS3DH_REG_CTRL3] & 0x04),
+        "watermark interrupt");
+
+  m.periodMicros = 1000;
+  m.restart();
+  delay(12);
+  int16_t buf[32][3];
+  uint8_t n = lis.readFifo(buf, 10);
+  CHECK(n == 10, "%u samples", n);
+  for (int i = 0; i < n; i++)
+    CHECK(buf[i][0] == i && buf[i][1] == (int16_t)~i && buf[i][2] == i * 3,
+          "sample %d", i);
+
+  delay(40);
+  CHECK(lis.fifoAvailable() == 32 && lis.fifoOverrun(), "full FIFO");
+  n = lis.readFifo(buf, 32);
+  CHECK(n == 32 && lis.fifoOverrun(), "%u samples from a full FIFO", n);
+  CHECK(buf[31][0] - buf[0][0] == 31, "samples out of order");
+  CHECK(lis.fifoAvailable() <= 8, "samples arrived during the read");
+
+  CHECK(lis.setFifoMode(LIS3DH_FIFO_BYPASS) &&
+            !(d.regs[LIS3DH_REG_CTRL5] & 0x40) &&
+            d.regs[LIS3DH_REG_FIFOCTRL] == 0,
+        "bypass mode");
+  CHECK(lis.readFifo(buf, 32) == 0, "readFifo() in bypass mode");
+}
+
+static void compare(Adafruit_LIS3DH &lis, Model &m) {
+  printf("  %-8s %-8s %9s %9s %12s\n", "ODR", "method", "produced",
+         "received", "transactions");
+  for (uint32_t period : {2500u, 744u, 185u}) {
+    for (int fifo = 0; fifo < 2; fifo++) {
+      lis.setFifoMode(fifo ? LIS3DH_FIFO_STREAM : LIS3DH_FIFO_BYPASS,
+                      WATERMARK);
+      m.periodMicros = period;
+      std::set<uint16_t> got;
+      int16_t buf[32][3];
+      uint8_t n;
+      unsigned long before = Wire.transactions;
+      m.restart();
+      uint32_t start = micros();
+      while (micros() - start < 1000000) {
+        if (fifo) {
+          if (!m.int1())
+            continue;
+          n = lis.readFifo(buf, 32);
+          for (int i = 0; i < n; i++)
+            got.insert(buf[i][0]);
+        } else if (lis.haveNewData()) {
+          lis.read();
+          got.insert(lis.x);
+        }
+      }
+      m.update();
+      m.stopped = true;
+      while (fifo && (n = lis.readFifo(buf, 32))) // What is still queued
+        for (int i = 0; i < n; i++)
+          got.insert(buf[i][0]);
+      printf("  %-8.0f %-8s %9u %9zu %12lu\n", 1e6 / period,
+             fifo ? "readFifo" : "read()", m.made, got.size(),
+             Wire.transactions - before);
+      if (period == 2500 || (fifo && period == 744))
+        CHECK(got.size() == m.made, "samples lost");
+    }
+  }
+}
+
+int main(void) {
+  TwoWire::Device &d = Wire.devices[0x18];
+  memset(d.regs, 0, sizeof(d.regs));
+  d.incBit = 0x80;
+  d.regs[LIS3DH_REG_WHOAMI] = 0x33;
+  Model m(d);
+  d.onRead = [&m](uint8_t r) { m.read(r); };
+  d.onWrite = [&m](uint8_t r) { m.write(r); };
+  d.onStep = [&m](uint8_t r) { return m.step(r); };
+
+  Adafruit_LIS3DH lis;
+  CHECK(lis.begin(0x18), "begin()");
+  printf("FIFO functions\n");
+  testFunctions(lis, m);
+  printf("Read methods, 1 s each, watermark %d\n", WATERMARK);
+  compare(lis, m);
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+#ifndef _HOST_ADAFRUIT_SPIDEVICE_H
+#define _HOST_ADAFRUIT_SPIDEVICE_H
+
+// Only the parts Adafruit_BusIO_Register and Adafruit_LIS3DH use: the tests
+// run the sensor over I2C
+#include <SPI.h>
+
+typedef enum { SPI_BITORDER_MSBFIRST, SPI_BITORDER_LSBFIRST } BusIOBitOrder;
+
+class Adafruit_SPIDevice {
+public:
+  Adafruit_SPIDevice(int8_t, uint32_t = 1000000,
+                     BusIOBitOrder = SPI_BITORDER_MSBFIRST, uint8_t = 0,
+                     SPIClass * = &SPI) {}
+  Adafruit_SPIDevice(int8_t, int8_t, int8_t, int8_t, uint32_t = 1000000,
+                     BusIOBitOrder = SPI_BITORDER_MSBFIRST, uint8_t = 0) {}
+  bool begin(void) { return true; }
+  bool write(const uint8_t *, size_t, const uint8_t * = nullptr, size_t = 0) {
+    return true;
+  }
+  bool write_then_read(const uint8_t *, size_t, uint8_t *, size_t,
+                       uint8_t = 0xFF) {
+    return true;
+  }
+};
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef _HOST_WIRE_H
+#define _HOST_WIRE_H
+
+#include <Arduino.h>
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#define I2C_BUFFER_LENGTH 128
+
+/// TwoWire with register-file devices. A device with an incBit set moves to
+/// the next register only when the sub-address had that bit, as the LIS3DH
+/// does with bit 7. A device can hook register reads and writes, and the
+/// step to the next register, to model its behaviour. Transfers take their
+/// 400 kHz bus time, spinning. Counts transactions, and reads and writes
+/// per register.
+class TwoWire {
+public:
+  struct Device {
+    uint8_t regs[256];
+    uint8_t pointer = 0;
+    uint8_t incBit = 0;
+    bool increment = true;
+    unsigned long reads[256] = {}, writes[256] = {};
+    std::function<void(uint8_t)> onRead;    ///< Before a register is read
+    std::function<void(uint8_t)> onWrite;   ///< After a register is written
+    std::function<uint8_t(uint8_t)> onStep; ///< Maps the next register
+  };
+  std::map<uint8_t, Device> devices;
+  unsigned long transactions = 0;
+  uint32_t bitNanos = 2500; ///< 400 kHz
+
+  void begin(void) {}
+  void end(void) {}
+  void setClock(uint32_t hz) { bitNanos = 1000000000u / hz; }
+
+  void beginTransmission(uint8_t address) {
+    addr = address;
+    tx.clear();
+  }
+  size_t write(uint8_t b) {
+    tx.push_back(b);
+    return 1;
+  }
+  size_t write(const uint8_t *b, size_t n) {
+    tx.insert(tx.end(), b, b + n);
+    return n;
+  }
+  uint8_t endTransmission(bool stop = true) {
+    (void)stop;
+    transactions++;
+    spend(tx.size());
+    auto it = devices.find(addr);
+    if (it == devices.end())
+      return 2; // NACK on the address
+    Device &d = it->second;
+    if (!tx.empty()) {
+      d.pointer = tx[0] & ~d.incBit;
+      d.increment = !d.incBit || (tx[0] & d.incBit);
+      for (size_t i = 1; i < tx.size(); i++) {
+        d.writes[d.pointer]++;
+        d.regs[d.pointer] = tx[i];
+        if (d.onWrite)
+          d.onWrite(d.pointer);
+        step(d);
+      }
+    }
+    return 0;
+  }
+  uint8_t requestFrom(uint8_t address, uint8_t n, uint8_t stop = 1) {
+    (void)stop;
+    transactions++;
+    spend(n);
+    rx.clear();
+    rxPos = 0;
+    auto it = devices.find(address);
+    if (it != devices.end()) {
+      Device &d = it->second;
+      for (uint8_t i = 0; i < n; i++) {
+        d.reads[d.pointer]++;
+        if (d.onRead)
+          d.onRead(d.pointer);
+        rx.push_back(d.regs[d.pointer]);
+        step(d);
+      }
+    }
+    return rx.size();
+  }
+  int read(void) { return rxPos < rx.size() ? rx[rxPos++] : -1; }
+
+private:
+  uint8_t addr = 0;
+  std::vector<uint8_t> tx, rx;
+  size_t rxPos = 0;
+
+  void step(Device &d) {
+    if (!d.increment)
+      return;
+    d.pointer++;
+    if (d.onStep)
+      d.pointer = d.onStep(d.pointer);
+  }
+  /// Start, address, bytes and stop, 9 bits each
+  void spend(size_t bytes) {
+    uint64_t ns = (uint64_t)(bytes + 1) * 9 * bitNanos + 2 * bitNanos;
+    auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(ns);
+    while (std::chrono::steady_clock::now() < until)
+      ;
+  }
+};
+
+extern TwoWire Wire;
+
+#endif
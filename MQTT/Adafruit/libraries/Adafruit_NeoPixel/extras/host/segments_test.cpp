@@ -0,0 +1,248 @@
+// Host test of Adafruit_NeoPixel_Segment and showSegments(), built for
+// ESP32 with show() ending in a fake espShow() that keeps every frame.
+//
+// - Segment pixels match Adafruit_NeoPixel::setPixelColor(), RGB and RGBW,
+//   with brightness; overlapping and out of range segments are refused.
+// - Double buffer: pixels set on a segment reach the strip only after the
+//   segment's show().
+// - Sequence lock, deterministic: a segment published while showSegments()
+//   copies it is held back one frame, while the other segments go out.
+// - Sequence lock, threaded: two std::thread writers publish their 200-pixel
+//   segments flat out, and scribble over their drafts right after each
+//   show(), while a third thread runs showSegments() at 100 fps. No frame
+//   may hold a torn segment, a scribbled pixel or an older segment than the
+//   previous frame, and the last frame must be the last data published.
+//
+// The copies of 'published' race with show() by design, and a torn copy is
+// discarded by the sequence check; ThreadSanitizer would report them, so
+// this runs under AddressSanitizer.
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Adafruit_NeoPixel.h>
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static std::mutex framesLock;
+static std::vector<std::vector<uint8_t>> frames;
+
+extern "C" {
+void (*memcpyHook)(void *dest, const void *src, size_t n) = NULL;
+
+void espShow(uint16_t, uint8_t *pixels, uint32_t numBytes, uint8_t) {
+  std::lock_guard<std::mutex> l(framesLock);
+  frames.push_back(std::vector<uint8_t>(pixels, pixels + numBytes));
+}
+bool espCanShow(uint16_t) { return true; }
+void espRelease(uint16_t) {}
+
+uint32_t micros(void) {
+  static auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+void yield(void) {}
+}
+
+static void testColors(neoPixelType type, uint8_t brightness) {
+  Adafruit_NeoPixel ref(8, 5, type), strip(8, 5, type);
+  ref.begin();
+  strip.begin();
+  ref.setBrightness(brightness);
+  strip.setBrightness(brightness);
+  Adafruit_NeoPixel_Segment a, b, c;
+  CHECK(strip.addSegment(a, 0, 4), "addSegment");
+  CHECK(strip.addSegment(b, 4, 4), "addSegment");
+  CHECK(!strip.addSegment(c, 3, 2), "overlapping segment added");
+  CHECK(!strip.addSegment(c, 8, 1), "segment past the end added");
+  CHECK(!strip.addSegment(a, 6, 1), "segment added twice");
+
+  const uint32_t colors[] = {0x12345678, 0xFF00FF00, 0x0000FF, 0xFFFFFFFF};
+  for (int i = 0; i < 4; i++) {
+    ref.setPixelColor(i, colors[i]);
+    a.setPixelColor(i, colors[i]);
+  }
+  ref.setPixelColor(4, 1, 2, 3);
+  b.setPixelColor(0, 1, 2, 3);
+  ref.setPixelColor(5, 4, 5, 6, 7);
+  b.setPixelColor(1, 4, 5, 6, 7);
+  ref.fill(0x808080, 6, 2);
+  b.fill(0x808080, 2);
+
+  frames.clear();
+  strip.setFrameRate(0);
+  CHECK(!strip.showSegments(), "frame sent before any segment show()");
+  a.show();
+  b.show();
+  CHECK(strip.showSegments() && frames.size() == 1, "no frame sent");
+  size_t bytes = strip.numPixels() * ((type >> 6 & 3) == (type >> 4 & 3) ? 3 : 4);
+  CHECK(!memcmp(strip.getPixels(), ref.getPixels(), bytes),
+        "type %04X brightness %u: segments differ from setPixelColor()", type,
+        brightness);
+  CHECK(!strip.showSegments(), "frame sent with nothing changed");
+}
+
+static void testDraft(void) {
+  Adafruit_NeoPixel strip(10, 5, NEO_GRB + NEO_KHZ800);
+  strip.begin();
+  strip.setFrameRate(0);
+  Adafruit_NeoPixel_Segment s;
+  strip.addSegment(s, 2, 3);
+  s.fill(0x010203);
+  s.show();
+  s.fill(0xFFFFFF); // Not published
+  CHECK(strip.showSegments(), "no frame sent");
+  CHECK(strip.getPixelColor(2) == 0x010203 && strip.getPixelColor(4) == 0x010203,
+        "draft reached the strip before show(): %06X",
+        strip.getPixelColor(2));
+  s.show();
+  CHECK(strip.showSegments() && strip.getPixelColor(3) == 0xFFFFFF,
+        "show() not sent");
+}
+
+// Publishes 'target' from inside the compositor's copy of it
+static Adafruit_NeoPixel_Segment *target;
+static size_t targetBytes;
+static void publishDuringCopy(void *, const void *, size_t n) {
+  if (n == targetBytes) {
+    memcpyHook = NULL;
+    target->fill(0x00FF00);
+    target->show();
+  }
+}
+
+static void testTornCopy(void) {
+  Adafruit_NeoPixel strip(30, 5, NEO_GRB + NEO_KHZ800);
+  strip.begin();
+  strip.setFrameRate(0);
+  Adafruit_NeoPixel_Segment small, big;
+  strip.addSegment(small, 0, 10);
+  strip.addSegment(big, 10, 20);
+  small.fill(0x0000FF);
+  small.show();
+  big.fill(0x0000FF);
+  big.show();
+  strip.showSegments();
+
+  small.fill(0xFF0000);
+  small.show();
+  big.fill(0xFF0000);
+  big.show();
+  target = &small;
+  targetBytes = 10 * 3;
+  memcpyHook = publishDuringCopy;
+  CHECK(strip.showSegments(), "other segment held back");
+  memcpyHook = NULL;
+  CHECK(strip.getPixelColor(0) == 0x0000FF,
+        "segment published during the copy was sent: %06X",
+        strip.getPixelColor(0));
+  CHECK(strip.getPixelColor(10) == 0xFF0000, "other segment not sent");
+  CHECK(strip.showSegments() && strip.getPixelColor(0) == 0x00FF00,
+        "held back segment not sent in the next frame");
+}
+
+// The value a writer fills its segment with, and the one it scribbles its
+// draft with after each show()
+static uint32_t stamp(int writer, uint32_t k) {
+  return ((uint32_t)writer << 22 | (k & 0x3FFFFF)) & 0x7FFFFF;
+}
+#define SCRIBBLE 0x800000
+
+static void testThreads(void) {
+  Adafruit_NeoPixel strip(600, 5, NEO_GRB + NEO_KHZ800);
+  strip.begin();
+  strip.setFrameRate(100);
+  Adafruit_NeoPixel_Segment segments[3];
+  for (int i = 0; i < 3; i++)
+    strip.addSegment(segments[i], i * 200, 200);
+  segments[2].fill(0x123456);
+  segments[2].show();
+
+  frames.clear();
+  std::atomic<bool> stop{false};
+  uint32_t published[2] = {0, 0};
+  auto writer = [&](int w) {
+    uint32_t k = 0;
+    while (!stop) {
+      segments[w].fill(stamp(w, ++k));
+      segments[w].show();
+      published[w] = k;
+      segments[w].fill(SCRIBBLE, 0, 100);
+    }
+  };
+  unsigned long calls = 0;
+  std::thread compositor([&] {
+    while (!stop) {
+      strip.showSegments();
+      calls++;
+      std::this_thread::yield();
+    }
+  });
+  std::thread w0(writer, 0), w1(writer, 1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+  stop = true;
+  w0.join();
+  w1.join();
+  compositor.join();
+  std::this_thread::sleep_for(std::chrono::milliseconds(11));
+  strip.showSegments(); // Sends the last data, unless already sent
+
+  unsigned long torn = 0, scribbled = 0, backwards = 0;
+  uint32_t last[3] = {0, 0, 0};
+  for (const std::vector<uint8_t> &f : frames) {
+    for (int s = 0; s < 3; s++) {
+      const uint8_t *p = &f[s * 600];
+      uint32_t v = (uint32_t)p[1] << 16 | p[0] << 8 | p[2]; // GRB
+      for (int i = 1; i < 200; i++)
+        if (memcmp(p, p + i * 3, 3)) {
+          torn++;
+          break;
+        }
+      scribbled += (v == SCRIBBLE);
+      backwards += (v < last[s]);
+      last[s] = v;
+    }
+  }
+  CHECK(!torn, "%lu torn segments", torn);
+  CHECK(!scribbled, "%lu segments with the draft's scribble", scribbled);
+  CHECK(!backwards, "%lu segments older than in the previous frame", backwards);
+  CHECK(frames.size() >= 10 && frames.size() <= 102,
+        "%zu frames in 1 s at 100 fps", frames.size());
+  CHECK(last[0] == stamp(0, published[0]) && last[1] == stamp(1, published[1]) &&
+            last[2] == 0x123456,
+        "last frame is not the last data published");
+  printf("  1 s: %u and %u segment updates, %lu showSegments() calls, "
+         "%zu frames\n",
+         published[0], published[1], calls, frames.size());
+}
+
+int main(void) {
+  printf("Segment pixels\n");
+  testColors(NEO_GRB + NEO_KHZ800, 0);
+  testColors(NEO_GRB + NEO_KHZ800, 40);
+  testColors(NEO_RGBW + NEO_KHZ800, 0);
+  testColors(NEO_RGBW + NEO_KHZ800, 200);
+  printf("Double buffer\n");
+  testDraft();
+  printf("Publish during the compositor's copy\n");
+  testTornCopy();
+  printf("Two writer threads and a compositor thread\n");
+  testThreads();
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
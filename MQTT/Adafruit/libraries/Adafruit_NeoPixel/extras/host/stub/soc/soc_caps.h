@@ -0,0 +1,7 @@
+#ifndef _HOST_SOC_CAPS_H
+#define _HOST_SOC_CAPS_H
+
+// ESP32-S3
+#define SOC_RMT_TX_CANDIDATES_PER_GROUP 4
+
+#endif
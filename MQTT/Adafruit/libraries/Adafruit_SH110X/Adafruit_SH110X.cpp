@@ -161,87 +161,67 @@ void Adafruit_SH110X::display(void) {
   // 32-byte transfer condition below.
   yield();
 
-  // uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
   uint8_t *ptr = buffer;
   uint8_t dc_byte = 0x40;
   uint8_t pages = ((HEIGHT + 7) / 8);
 
   uint8_t bytes_per_page = WIDTH;
 
-  /*
-  Serial.print("Window: (");
-  Serial.print(window_x1);
-  Serial.print(", ");
-  Serial.print(window_y1);
-  Serial.print(" -> (");
-  Serial.print(window_x2);
-  Serial.print(", ");
-  Serial.print(window_y2);
-  Serial.println(")");
-  */
-
-  uint8_t first_page = window_y1 / 8;
-  //  uint8_t last_page = (window_y2 + 7) / 8;
-  uint8_t page_start = min(bytes_per_page, (uint8_t)window_x1);
-  uint8_t page_end = (uint8_t)max((int)0, (int)window_x2);
-  /*
-  Serial.print("Pages: ");
-  Serial.print(first_page);
-  Serial.print(" -> ");
-  Serial.println(last_page);
-  pages = min(pages, last_page);
-
-  Serial.print("Page addr: ");
-  Serial.print(page_start);
-  Serial.print(" -> ");
-  Serial.println(page_end);
-  */
-
-  for (uint8_t p = first_page; p < pages; p++) {
-    uint8_t bytes_remaining = bytes_per_page;
-    ptr = buffer + (uint16_t)p * (uint16_t)bytes_per_page;
-    // fast forward to dirty rectangle beginning
-    ptr += page_start;
-    bytes_remaining -= page_start;
-    // cut off end of dirty rectangle
-    bytes_remaining -= (WIDTH - 1) - page_end;
-
-    if (i2c_dev) { // I2C
-      uint16_t maxbuff = i2c_dev->maxBufferSize() - 1;
-
-      uint8_t cmd[] = {
-          0x00, (uint8_t)(SH110X_SETPAGEADDR + p),
-          (uint8_t)(0x10 + ((page_start + _page_start_offset) >> 4)),
-          (uint8_t)((page_start + _page_start_offset) & 0xF)};
-
-      // Set high speed clk
-      i2c_dev->setSpeed(i2c_preclk);
-
-      i2c_dev->write(cmd, 4);
-
-      while (bytes_remaining) {
-        uint8_t to_write = min(bytes_remaining, (uint8_t)maxbuff);
-        i2c_dev->write(ptr, to_write, true, &dc_byte, 1);
-        ptr += to_write;
-        bytes_remaining -= to_write;
-        yield();
-      }
-
-      // Set low speed clk
-      i2c_dev->setSpeed(i2c_postclk);
-
-    } else { // SPI
-      uint8_t cmd[] = {
-          (uint8_t)(SH110X_SETPAGEADDR + p),
-          (uint8_t)(0x10 + ((page_start + _page_start_offset) >> 4)),
-          (uint8_t)((page_start + _page_start_offset) & 0xF)};
+  // Each row of dirty tiles is one page. Only the runs of adjacent dirty
+  // tiles are sent, each with its own page/column address, so that changes
+  // in opposite corners don't resend everything in between.
+  if (i2c_dev) {
+    // Set high speed clk
+    i2c_dev->setSpeed(i2c_preclk);
+  }
 
-      digitalWrite(dcPin, LOW);
-      spi_dev->write(cmd, 3);
-      digitalWrite(dcPin, HIGH);
-      spi_dev->write(ptr, bytes_remaining);
+  for (uint8_t p = 0; p < pages; p++) {
+    uint16_t tile = 0, run;
+    while ((run = dirty.nextRun(p, &tile)) > 0) {
+      uint8_t page_start = tile * 8;
+      uint8_t bytes_remaining =
+          min((uint16_t)(run * 8), (uint16_t)(bytes_per_page - page_start));
+      ptr = buffer + (uint16_t)p * (uint16_t)bytes_per_page + page_start;
+      tile += run;
+
+      if (i2c_dev) { // I2C
+        uint16_t maxbuff = i2c_dev->maxBufferSize() - 1;
+
+        uint8_t cmd[] = {
+            0x00, (uint8_t)(SH110X_SETPAGEADDR + p),
+            (uint8_t)(0x10 + ((page_start + _page_start_offset) >> 4)),
+            (uint8_t)((page_start + _page_start_offset) & 0xF)};
+
+        i2c_dev->write(cmd, 4);
+
+        while (bytes_remaining) {
+          uint8_t to_write = min(bytes_remaining, (uint8_t)maxbuff);
+          i2c_dev->write(ptr, to_write, true, &dc_byte, 1);
+          ptr += to_write;
+          bytes_remaining -= to_write;
+          yield();
+        }
+
+      } else { // SPI
+        uint8_t cmd[] = {
+            (uint8_t)(SH110X_SETPAGEADDR + p),
+            (uint8_t)(0x10 + ((page_start + _page_start_offset) >> 4)),
+            (uint8_t)((page_start + _page_start_offset) & 0xF)};
+
+        digitalWrite(dcPin, LOW);
+        spi_dev->write(cmd, 3);
+        digitalWrite(dcPin, HIGH);
+        spi_dev->write(ptr, bytes_remaining);
+      }
     }
   }
+
+  if (i2c_dev) {
+    // Set low speed clk
+    i2c_dev->setSpeed(i2c_postclk);
+  }
+
+  dirty.clear();
   // reset dirty window
   window_x1 = 1024;
   window_y1 = 1024;
@@ -0,0 +1,205 @@
+// Host test of keep-alive and request pipelining in HttpClient, over a
+// loopback socket Client (posix_client.h) to the stand-in server in
+// http_server.py. Takes the server's port; the server on the port after it
+// closes connections idle for 0.3 s.
+//
+// - Responses read for the status only, or with the body left unread, do
+//   not stop the connection from being reused, nor does beginRequest().
+// - A Connection: close reply, or a connection idle for longer than
+//   setKeepAliveTimeout(), makes the next request reconnect.
+// - With setPipelineDepth(3), requests queue and their responses are read
+//   in order; a request past the depth drains the oldest ones first.
+// - A pipelined request after the keep-alive timeout reconnects too, and
+//   does not count the responses lost with the old connection.
+// - A connection the server closed while idle is replaced.
+// - The timeouts survive stop().
+// Then prints requests/sec for connection close, keep-alive, and
+// keep-alive with depth 8 pipelining, on an ideal and a 20 ms network.
+#include <HttpClient.h>
+
+#include <stdio.h>
+
+#include "posix_client.h"
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static int port;
+
+/// The body the server answers a GET on path with
+static std::string reply(const char *path) {
+  return std::string("{\"path\":\"") + path + "\",\"pad\":\"\"}";
+}
+
+static void get(HttpClient &http, const char *url) {
+  CHECK(http.get(url) == 0, "get(%s)", url);
+}
+
+static void response(HttpClient &http, const char *path) {
+  CHECK(http.responseStatusCode() == 200, "status of %s", path);
+  String body = http.responseBody();
+  CHECK(body.s == reply(path), "body of %s: %s", path, body.c_str());
+}
+
+static void testKeepAlive(void) {
+  PosixClient client;
+  HttpClient http(client, "localhost", port);
+  http.setHttpWaitForDataDelay(1);
+  http.connectionKeepAlive();
+
+  get(http, "/a?pad=3000");
+  CHECK(http.responseStatusCode() == 200, "status only");
+  get(http, "/b?chunked=1");
+  CHECK(http.responseStatusCode() == 200, "headers, body unread");
+  http.skipResponseHeaders();
+  http.beginRequest();
+  get(http, "/c");
+  http.sendHeader("X-AIO-Key", "k");
+  http.endRequest();
+  response(http, "/c");
+  CHECK(client.connects == 1, "%lu connections", client.connects);
+
+  get(http, "/d?close=1");
+  CHECK(http.responseStatusCode() == 200, "Connection: close");
+  get(http, "/e");
+  response(http, "/e");
+  CHECK(client.connects == 2, "%lu connections after close",
+        client.connects);
+
+  http.setKeepAliveTimeout(200);
+  delay(300);
+  get(http, "/f");
+  CHECK(http.responseStatusCode() == 200, "after the idle timeout");
+  http.skipResponseBody();
+  CHECK(client.connects == 3, "%lu connections after the idle timeout",
+        client.connects);
+  printf("  keep-alive: %lu connections\n", client.connects);
+}
+
+static void testPipeline(void) {
+  PosixClient client;
+  HttpClient http(client, "localhost", port);
+  http.setHttpWaitForDataDelay(1);
+  http.connectionKeepAlive();
+  http.setPipelineDepth(3);
+
+  get(http, "/p1");
+  get(http, "/p2?chunked=1");
+  get(http, "/p3");
+  CHECK(http.pendingResponses() == 3, "%d pending", http.pendingResponses());
+  response(http, "/p1");
+  CHECK(http.responseStatusCode() == 200, "status of /p2, body skipped");
+  response(http, "/p3");
+  CHECK(http.pendingResponses() == 1, "%d pending", http.pendingResponses());
+  get(http, "/p4");
+  get(http, "/p5");
+  get(http, "/p6");
+  get(http, "/p7");
+  // p4 to p6 were read and dropped to make room
+  CHECK(http.pendingResponses() == 1, "%d pending", http.pendingResponses());
+  response(http, "/p7");
+  CHECK(client.connects == 1, "%lu connections", client.connects);
+
+  // Queued past the keep-alive timeout: the old connection and whatever
+  // was still pending on it are gone
+  http.setKeepAliveTimeout(200);
+  get(http, "/q1");
+  delay(300);
+  get(http, "/q2");
+  CHECK(client.connects == 2, "%lu connections after the idle timeout",
+        client.connects);
+  CHECK(http.pendingResponses() == 1, "%d pending after reconnecting",
+        http.pendingResponses());
+  response(http, "/q2");
+  printf("  pipeline: %lu connections\n", client.connects);
+}
+
+static void testStale(void) {
+  PosixClient client;
+  HttpClient http(client, "localhost", port + 1);
+  http.setHttpWaitForDataDelay(1);
+  http.connectionKeepAlive();
+  get(http, "/x");
+  CHECK(http.responseStatusCode() == 200, "status of /x");
+  delay(600); // The server has closed its end
+  unsigned long start = millis();
+  get(http, "/y");
+  response(http, "/y");
+  CHECK(client.connects == 2, "%lu connections", client.connects);
+  printf("  closed by the server: %lu connections, %lu ms\n", client.connects,
+         millis() - start);
+
+  http.setHttpResponseTimeout(1234);
+  http.stop();
+  CHECK(http.httpResponseTimeout() == 1234, "response timeout after stop()");
+}
+
+/// Posts n telemetry messages, depth 0 for connection close; returns
+/// requests/sec
+static double bench(int depth, unsigned long rtt, int n,
+                    unsigned long *connects) {
+  PosixClient client;
+  client.rttMillis = rtt;
+  client.setupMillis = rtt;
+  HttpClient http(client, "localhost", port);
+  http.setHttpWaitForDataDelay(1);
+  if (depth) {
+    http.connectionKeepAlive();
+    http.setPipelineDepth(depth);
+  }
+  unsigned long start = millis();
+  char body[32];
+  for (int i = 0; i < n;) {
+    int batch = std::min(depth ? depth : 1, n - i);
+    for (int k = 0; k < batch; k++) {
+      snprintf(body, sizeof(body), "{\"temperature\":%d}", i + k);
+      CHECK(http.post("/api/v1/token/telemetry", "application/json", body) ==
+                0,
+            "post %d", i + k);
+    }
+    for (int k = 0; k < batch; k++, i++) {
+      // Status only, as ThingsBoardHttp::postMessage() does
+      CHECK(http.responseStatusCode() == 200, "status of post %d", i);
+    }
+  }
+  *connects = client.connects;
+  return n / ((millis() - start + 1) / 1000.0);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    printf("usage: %s PORT\n", argv[0]);
+    return 2;
+  }
+  port = atoi(argv[1]);
+
+  printf("Connections\n");
+  testKeepAlive();
+  testPipeline();
+  testStale();
+
+  printf("Telemetry posts\n");
+  const unsigned long rtts[2] = {0, 20};
+  const int depths[3] = {0, 1, 8};
+  const char *labels[3] = {"connection close", "keep-alive",
+                           "keep-alive, depth 8"};
+  for (int r = 0; r < 2; r++) {
+    for (int d = 0; d < 3; d++) {
+      unsigned long connects;
+      double rate = bench(depths[d], rtts[r], rtts[r] ? 24 : 200, &connects);
+      printf("  rtt %2lu ms %-20s %7.1f req/s %4lu connections\n", rtts[r],
+             labels[d], rate, connects);
+    }
+  }
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
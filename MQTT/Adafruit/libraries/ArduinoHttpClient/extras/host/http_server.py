@@ -0,0 +1,230 @@
+"""Local stand-in for the HTTP servers the library talks to.
+
+  python3 http_server.py PORT [IDLE]
+
+GET /cl?n=N          N body bytes with a Content-Length
+GET /chunked?n=N&c=C chunked in C-byte chunks, with chunk extensions and
+                     a trailer; s=S trickles the response S bytes at a time
+GET /json?n=N        a chunked JSON document with N values
+GET /close?n=N       no length, the body ends when the server closes
+GET any other path   {"path":..., "pad":...} with pad=N bytes of padding
+POST                 {"ok":true,"echo":<the request body>}
+
+WebSocket upgrades, with mask=1 the server masks its frames too:
+/ws/echo             sends each message back
+/ws/sink             counts messages; answers the text message "done" with
+                     "<messages> <frames> <bytes>" and starts again
+/ws/source?n=N&k=K   pings, sends K binary N-byte messages and the text
+                     message "end", then "pong" once the pong has come
+
+Other paths and POST answer with a Content-Length, or chunked with
+chunked=1, and close the connection with close=1. With IDLE, the server
+closes connections that have been idle for that many seconds.
+"""
+import base64
+import hashlib
+import http.server
+import json
+import os
+import struct
+import socketserver
+import sys
+import time
+from urllib.parse import parse_qs, urlparse
+
+
+def body(n):
+    return bytes((i * 7 + i // 13) % 26 + 97 for i in range(n))
+
+
+def xor(data, key):
+    k = (key * (len(data) // 4 + 1))[:len(data)]
+    return (int.from_bytes(data, "little") ^
+            int.from_bytes(k, "little")).to_bytes(len(data), "little")
+
+
+def frame(op, data, mask):
+    n = len(data)
+    m = 0x80 if mask else 0
+    if n < 126:
+        h = bytes([0x80 | op, m | n])
+    elif n <= 0xFFFF:
+        h = bytes([0x80 | op, m | 126]) + struct.pack(">H", n)
+    else:
+        h = bytes([0x80 | op, m | 127]) + struct.pack(">Q", n)
+    if not mask:
+        return h + data
+    key = os.urandom(4)
+    return h + key + xor(data, key)
+
+
+class Handler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    disable_nagle_algorithm = True
+
+    def log_message(self, *args):
+        pass
+
+    def reply(self, data, q):
+        self.send_response(200)
+        self.send_header("Content-Type", "application/json")
+        if "close" in q:
+            self.send_header("Connection", "close")
+            self.close_connection = True
+        if "chunked" in q:
+            self.send_header("Transfer-Encoding", "chunked")
+            self.end_headers()
+            self.wfile.write(b"%X\r\n%s\r\n0\r\n\r\n" % (len(data), data))
+        else:
+            self.send_header("Content-Length", str(len(data)))
+            self.end_headers()
+            self.wfile.write(data)
+
+    def chunked(self, data, size, step):
+        self.send_response(200)
+        self.send_header("Transfer-Encoding", "chunked")
+        self.end_headers()
+        out = b""
+        for i in range(0, len(data), size):
+            part = data[i:i + size]
+            ext = b";x=ab" if (i // size) % 3 == 1 else b""
+            out += b"%X%s\r\n%s\r\n" % (len(part), ext, part)
+        out += b"0\r\nX-Trailer: done\r\n\r\n"
+        step = step or len(out)
+        for i in range(0, len(out), step):
+            self.wfile.write(out[i:i + step])
+            self.wfile.flush()
+            if step < len(out):
+                time.sleep(0.001)
+
+    def do_GET(self):
+        url = urlparse(self.path)
+        q = parse_qs(url.query)
+        n = int(q.get("n", ["1000"])[0])
+        size = int(q.get("c", ["100"])[0])
+        step = int(q.get("s", ["0"])[0])
+        if url.path == "/cl":
+            data = body(n)
+            self.send_response(200)
+            self.send_header("Content-Length", str(len(data)))
+            self.end_headers()
+            self.wfile.write(data)
+        elif url.path == "/chunked":
+            self.chunked(body(n), size, step)
+        elif url.path == "/json":
+            doc = {"values": list(range(n)), "name": "feed"}
+            self.chunked(json.dumps(doc).encode(), size, step)
+        elif self.headers.get("Upgrade", "").lower() == "websocket":
+            self.websocket(url.path, q)
+        elif url.path == "/close":
+            self.send_response(200)
+            self.send_header("Connection", "close")
+            self.end_headers()
+            self.wfile.write(body(n))
+            self.close_connection = True
+        else:
+            pad = "x" * int(q.get("pad", ["0"])[0])
+            doc = '{"path":"%s","pad":"%s"}' % (url.path, pad)
+            self.reply(doc.encode(), q)
+
+    def recv(self, n):
+        data = self.rfile.read(n)
+        if len(data) < n:
+            raise EOFError
+        return data
+
+    def read_frame(self):
+        h = self.recv(2)
+        n = h[1] & 0x7F
+        if n == 126:
+            n = struct.unpack(">H", self.recv(2))[0]
+        elif n == 127:
+            n = struct.unpack(">Q", self.recv(8))[0]
+        if not h[1] & 0x80:
+            raise ValueError("client frame not masked")
+        key = self.recv(4)
+        return h[0] & 0x80, h[0] & 0x0F, xor(self.recv(n), key)
+
+    def read_message(self, stats):
+        op, parts = None, []
+        while True:
+            fin, code, data = self.read_frame()
+            stats[1] += 1
+            if code == 9:
+                continue
+            if op is None:
+                op = code
+            elif code != 0:
+                raise ValueError("continuation expected, got %d" % code)
+            parts.append(data)
+            if fin:
+                return op, b"".join(parts)
+
+    def websocket(self, path, q):
+        key = self.headers["Sec-WebSocket-Key"].encode()
+        accept = base64.b64encode(hashlib.sha1(
+            key + b"258EAFA5-E914-47DA-95CA-C5AB0DC11B7E").digest())
+        self.send_response(101)
+        self.send_header("Upgrade", "websocket")
+        self.send_header("Connection", "Upgrade")
+        self.send_header("Sec-WebSocket-Accept", accept.decode())
+        self.end_headers()
+        self.close_connection = True
+        mask = "mask" in q
+        stats = [0, 0, 0]  # Messages, frames, bytes
+        try:
+            if path == "/ws/echo":
+                while True:
+                    op, data = self.read_message(stats)
+                    self.wfile.write(frame(op, data, mask))
+            elif path == "/ws/sink":
+                while True:
+                    op, data = self.read_message(stats)
+                    if op == 1 and data == b"done":
+                        self.wfile.write(frame(1, b"%d %d %d" % tuple(stats),
+                                               mask))
+                        stats = [0, 0, 0]
+                    else:
+                        stats[0] += 1
+                        stats[2] += len(data)
+            elif path == "/ws/source":
+                n = int(q.get("n", ["100"])[0])
+                k = int(q.get("k", ["1"])[0])
+                message = frame(2, body(n), mask)
+                self.wfile.write(frame(9, b"ping-data", mask))
+                out = b""
+                for _ in range(k):
+                    out += message
+                    if len(out) > 65536:
+                        self.wfile.write(out)
+                        out = b""
+                self.wfile.write(out + frame(1, b"end", mask))
+                fin, op, data = self.read_frame()
+                pong = op == 10 and data == b"ping-data"
+                self.wfile.write(frame(1, b"pong" if pong else b"no pong",
+                                       mask))
+                while True:
+                    self.read_frame()
+        except (EOFError, ConnectionError):
+            pass
+        except ValueError as e:
+            print("protocol error:", e, file=sys.stderr)
+
+    def do_POST(self):
+        q = parse_qs(urlparse(self.path).query)
+        data = self.rfile.read(int(self.headers.get("Content-Length", "0")))
+        self.reply(b'{"ok":true,"echo":' + data + b"}", q)
+
+
+class Server(socketserver.ThreadingMixIn, http.server.HTTPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+    def handle_error(self, *args):
+        pass  # Clients that go away
+
+
+if __name__ == "__main__":
+    if len(sys.argv) > 2:
+        Handler.timeout = float(sys.argv[2])
+    Server(("127.0.0.1", int(sys.argv[1])), Handler).serve_forever()
@@ -0,0 +1,139 @@
+#ifndef _HOST_POSIX_CLIENT_H
+#define _HOST_POSIX_CLIENT_H
+
+#include <Client.h>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/// Client on a non-blocking loopback socket, with a 4 kB receive buffer
+/// like the network stacks of the boards. Writes block, as they do on the
+/// Arduino clients. Counts the calls the library makes into it.
+///
+/// Network model: each connect costs setupMillis, and a reply shows up
+/// rttMillis after the first request written since the last reply.
+class PosixClient : public Client {
+public:
+  unsigned long calls = 0, writes = 0, connects = 0;
+  unsigned long rttMillis = 0, setupMillis = 0;
+
+  ~PosixClient() { stop(); }
+
+  int connect(IPAddress, uint16_t) override { return 0; }
+  int connect(const char *host, uint16_t port) override {
+    (void)host; // Always the loopback server
+    stop();
+    connects++;
+    if (setupMillis)
+      delay(setupMillis);
+    awaiting = false;
+    fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in a = {};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(port);
+    inet_pton(AF_INET, "127.0.0.1", &a.sin_addr);
+    if (::connect(fd, (sockaddr *)&a, sizeof(a))) {
+      stop();
+      return 0;
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+    peerClosed = false;
+    return 1;
+  }
+  size_t write(uint8_t b) override { return write(&b, 1); }
+  size_t write(const uint8_t *b, size_t n) override {
+    calls++;
+    writes++;
+    if (!awaiting) {
+      awaiting = true;
+      visibleAt = millis() + rttMillis;
+    }
+    if (fd < 0)
+      return 0;
+    size_t k = 0;
+    while (k < n) {
+      ssize_t r = send(fd, b + k, n - k, MSG_NOSIGNAL);
+      if (r > 0) {
+        k += r;
+      } else if (errno == EAGAIN) {
+        pollfd p = {fd, POLLOUT, 0};
+        poll(&p, 1, 1000);
+      } else {
+        break;
+      }
+    }
+    return k;
+  }
+  int available(void) override {
+    calls++;
+    fill();
+    return tail - head;
+  }
+  int read(void) override {
+    calls++;
+    fill();
+    return head < tail ? buf[head++] : -1;
+  }
+  int read(uint8_t *b, size_t n) override {
+    calls++;
+    fill();
+    size_t k = std::min(n, tail - head);
+    if (!k)
+      return -1;
+    memcpy(b, buf + head, k);
+    head += k;
+    return k;
+  }
+  int peek(void) override {
+    calls++;
+    fill();
+    return head < tail ? buf[head] : -1;
+  }
+  void flush(void) override {}
+  void stop(void) override {
+    if (fd >= 0)
+      close(fd);
+    fd = -1;
+    head = tail = 0;
+  }
+  uint8_t connected(void) override {
+    calls++;
+    fill();
+    return fd >= 0 && (!peerClosed || head < tail);
+  }
+  operator bool(void) override { return fd >= 0; }
+
+private:
+  int fd = -1;
+  bool peerClosed = false, awaiting = false;
+  unsigned long visibleAt = 0;
+  uint8_t buf[4096];
+  size_t head = 0, tail = 0;
+
+  void fill(void) {
+    if (fd < 0 || tail - head > sizeof(buf) / 2)
+      return;
+    if (awaiting && millis() < visibleAt)
+      return;
+    memmove(buf, buf + head, tail - head);
+    tail -= head;
+    head = 0;
+    ssize_t n = recv(fd, buf + tail, sizeof(buf) - tail, 0);
+    if (n > 0) {
+      tail += n;
+      awaiting = false;
+    } else if (n == 0) {
+      peerClosed = true;
+    }
+  }
+};
+
+#endif
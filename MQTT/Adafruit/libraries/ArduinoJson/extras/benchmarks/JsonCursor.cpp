@@ -0,0 +1,119 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+//
+// Compares makeJsonCursor() with deserializeJson() on typical RPC requests.
+// Usage: JsonCursorBenchmark [iterations]
+
+#include <ArduinoJson.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+const char* const payloads[] = {
+    "{\"method\":\"setValue\",\"params\":true}",
+    "{\"method\":\"setRelay\",\"params\":{\"relay\":3,\"state\":true}}",
+    "{\"id\":42,\"method\":\"setRelay\",\"params\":{\"relay\":3,\"state\":false,"
+    "\"timeout\":1500,\"label\":\"Pump room\",\"tags\":[\"a\",\"b\",\"c\"]},"
+    "\"meta\":{\"ts\":1718000000000,\"source\":\"dashboard\",\"user\":"
+    "\"tenant@thingsboard.org\"}}",
+};
+
+struct Command {
+  char method[16];
+  int relay;
+  bool state;
+};
+
+void readParams(JsonVariantConst params, Command& cmd) {
+  if (params.is<bool>()) {
+    cmd.state = params.as<bool>();
+  } else {
+    cmd.relay = params["relay"] | 0;
+    cmd.state = params["state"] | false;
+  }
+}
+
+bool withDocument(const char* json, Command& cmd) {
+  JsonDocument doc;
+  if (deserializeJson(doc, json))
+    return false;
+  snprintf(cmd.method, sizeof(cmd.method), "%s", doc["method"] | "");
+  readParams(doc["params"], cmd);
+  return true;
+}
+
+bool withFilter(const char* json, JsonDocument& filter, Command& cmd) {
+  JsonDocument doc;
+  if (deserializeJson(doc, json, DeserializationOption::Filter(filter)))
+    return false;
+  snprintf(cmd.method, sizeof(cmd.method), "%s", doc["method"] | "");
+  readParams(doc["params"], cmd);
+  return true;
+}
+
+bool withCursor(const char* json, Command& cmd) {
+  auto cursor = makeJsonCursor(json);
+  if (!cursor.enterObject())
+    return false;
+  for (JsonString key = cursor.nextKey(); key; key = cursor.nextKey()) {
+    if (key == "method") {
+      const char* method = cursor.value<const char*>();
+      snprintf(cmd.method, sizeof(cmd.method), "%s", method ? method : "");
+    } else if (key == "params") {
+      if (cursor.enterObject()) {
+        for (JsonString k = cursor.nextKey(); k; k = cursor.nextKey()) {
+          if (k == "relay")
+            cmd.relay = cursor.value<int>();
+          else if (k == "state")
+            cmd.state = cursor.value<bool>();
+        }
+      } else {
+        cmd.state = cursor.value<bool>();
+      }
+    }
+  }
+  return !cursor.error();
+}
+
+template <typename TFunc>
+double measure(long iterations, TFunc func) {
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; i++) {
+    if (!func()) {
+      fprintf(stderr, "parsing failed\n");
+      exit(1);
+    }
+  }
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / static_cast<double>(iterations);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  long iterations = argc > 1 ? atol(argv[1]) : 200000;
+
+  JsonDocument filter;
+  filter["method"] = true;
+  filter["params"] = true;
+
+  printf("%-8s %12s %12s %12s %8s\n", "bytes", "document", "filter",
+         "cursor", "speedup");
+  for (const char* json : payloads) {
+    Command cmd;
+    double doc = measure(iterations, [&]() { return withDocument(json, cmd); });
+    double flt =
+        measure(iterations, [&]() { return withFilter(json, filter, cmd); });
+    double cur = measure(iterations, [&]() { return withCursor(json, cmd); });
+    printf("%-8zu %9.0f ns %9.0f ns %9.0f ns %7.2fx\n", strlen(json), doc, flt,
+           cur, flt / cur);
+  }
+
+  return 0;
+}
@@ -0,0 +1,136 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+
+#include "bound_types.hpp"
+
+using namespace rpc;
+
+TEST_CASE("deserializeJson(BoundStruct&)") {
+  Request req = Request();
+
+  SECTION("nested structs and arrays") {
+    auto err = deserializeJson(
+        req,
+        "{\"method\":\"setRelay\",\"id\":42,"
+        "\"params\":{\"relay\":3,\"state\":true,\"mode\":2},"
+        "\"values\":[1.5,2.5,3.5],"
+        "\"targets\":[{\"relay\":1},{\"relay\":2,\"state\":true}],"
+        "\"comment\":\"hello\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(std::string(req.method) == "setRelay");
+    REQUIRE(req.id == 42);
+    REQUIRE(req.params.relay == 3);
+    REQUIRE(req.params.state == true);
+    REQUIRE(req.params.mode == Mode::Auto);
+    REQUIRE(req.values[0] == 1.5f);
+    REQUIRE(req.values[1] == 2.5f);
+    REQUIRE(req.values[2] == 3.5f);
+    REQUIRE(req.targets[0].relay == 1);
+    REQUIRE(req.targets[0].state == false);
+    REQUIRE(req.targets[1].relay == 2);
+    REQUIRE(req.targets[1].state == true);
+    REQUIRE(req.comment == "hello");
+  }
+
+  SECTION("unknown keys are skipped") {
+    auto err = deserializeJson(
+        req, "{\"extra\":{\"a\":[1,2,{}]},\"id\":1,\"more\":[],\"method\":\"x\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(req.id == 1);
+    REQUIRE(std::string(req.method) == "x");
+  }
+
+  SECTION("missing keys leave members untouched") {
+    req.id = 99;
+    auto err = deserializeJson(req, "{\"method\":\"x\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(req.id == 99);
+  }
+
+  SECTION("extra array elements are ignored") {
+    auto err = deserializeJson(req, "{\"values\":[1,2,3,4,5],\"id\":7}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(req.values[2] == 3.0f);
+    REQUIRE(req.id == 7);
+  }
+
+  SECTION("long strings are truncated") {
+    auto err = deserializeJson(req, "{\"method\":\"0123456789ABCDEFGHIJ\"}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(std::string(req.method) == "0123456789ABCDE");
+  }
+
+  SECTION("strings longer than the cursor's buffer") {
+    std::string input = "{\"method\":\"" + std::string(63, 'x') + "\"}";
+    REQUIRE(deserializeJson(req, input) == DeserializationError::Ok);
+    REQUIRE(std::string(req.method) == std::string(15, 'x'));
+
+    input = "{\"comment\":\"" + std::string(64, 'x') + "\"}";
+    REQUIRE(deserializeJson(req, input) == DeserializationError::NoMemory);
+  }
+
+  SECTION("type mismatches are skipped") {
+    auto err = deserializeJson(req, "{\"params\":[1,2],\"values\":{},\"id\":5}");
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(req.id == 5);
+  }
+
+  SECTION("root is not an object") {
+    REQUIRE(deserializeJson(req, "[1,2]") ==
+            DeserializationError::InvalidInput);
+  }
+
+  SECTION("empty input") {
+    REQUIRE(deserializeJson(req, "") == DeserializationError::EmptyInput);
+  }
+
+  SECTION("incomplete input") {
+    REQUIRE(deserializeJson(req, "{\"params\":{\"relay\":1") ==
+            DeserializationError::IncompleteInput);
+  }
+
+  SECTION("char*, size_t") {
+    char input[] = "{\"id\":12}garbage";
+    auto err = deserializeJson(req, input, 9);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(req.id == 12);
+  }
+
+  SECTION("std::istream") {
+    std::istringstream input("{\"id\":13}");
+    auto err = deserializeJson(req, input);
+
+    REQUIRE(err == DeserializationError::Ok);
+    REQUIRE(req.id == 13);
+  }
+
+  SECTION("nesting limit") {
+    auto err = deserializeJson(req, "{\"params\":{\"relay\":1}}",
+                               DeserializationOption::NestingLimit(1));
+
+    REQUIRE(err == DeserializationError::TooDeep);
+  }
+}
+
+TEST_CASE("deserializeJson(HandWrittenBinding&)") {
+  Telemetry t = Telemetry();
+
+  auto err = deserializeJson(t, "{\"rh-%\":45.5,\"temp-c\":21.25}");
+
+  REQUIRE(err == DeserializationError::Ok);
+  REQUIRE(t.temperature == 21.25);
+  REQUIRE(t.humidity == 45.5);
+}
@@ -0,0 +1,112 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+
+#include "bound_types.hpp"
+
+using namespace rpc;
+
+static Request makeRequest() {
+  Request req = Request();
+  strcpy(req.method, "setRelay");
+  req.id = -42;
+  req.params.relay = 3;
+  req.params.state = true;
+  req.params.mode = Mode::On;
+  req.values[0] = 1.5f;
+  req.values[1] = -2;
+  req.values[2] = 0;
+  req.targets[1].relay = 2;
+  req.comment = "say \"hi\"";
+  return req;
+}
+
+static const char* const expectedJson =
+    "{\"method\":\"setRelay\",\"id\":-42,"
+    "\"params\":{\"relay\":3,\"state\":true,\"mode\":1},"
+    "\"values\":[1.5,-2,0],"
+    "\"targets\":[{\"relay\":0,\"state\":false,\"mode\":0},"
+    "{\"relay\":2,\"state\":false,\"mode\":0}],"
+    "\"comment\":\"say \\\"hi\\\"\"}";
+
+TEST_CASE("serializeJson(BoundStruct)") {
+  Request req = makeRequest();
+
+  SECTION("std::string") {
+    std::string json;
+    size_t n = serializeJson(req, json);
+
+    REQUIRE(json == expectedJson);
+    REQUIRE(n == json.size());
+  }
+
+  SECTION("std::ostream") {
+    std::ostringstream os;
+    serializeJson(req, os);
+
+    REQUIRE(os.str() == expectedJson);
+  }
+
+  SECTION("char buffer") {
+    char buffer[256];
+    size_t n = serializeJson(req, buffer);
+
+    REQUIRE(std::string(buffer) == expectedJson);
+    REQUIRE(n == strlen(expectedJson));
+  }
+
+  SECTION("char buffer too small") {
+    char buffer[8];
+    size_t n = serializeJson(req, buffer, sizeof(buffer));
+
+    REQUIRE(n == 8);
+    REQUIRE(std::string(buffer, 8) == "{\"method");
+  }
+
+  SECTION("measureJson()") {
+    REQUIRE(measureJson(req) == strlen(expectedJson));
+  }
+
+  SECTION("unterminated char array") {
+    memset(req.method, 'x', sizeof(req.method));
+    std::string json;
+    serializeJson(req, json);
+
+    REQUIRE(json.find("\"method\":\"xxxxxxxxxxxxxxxx\"") != std::string::npos);
+  }
+
+  SECTION("same output as serializeJson(JsonDocument)") {
+    JsonDocument doc;
+    doc.set(req);
+    std::string expected, actual;
+    serializeJson(doc, expected);
+    serializeJson(req, actual);
+
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("round trip") {
+    std::string json;
+    serializeJson(req, json);
+    Request copy = Request();
+    REQUIRE(deserializeJson(copy, json) == DeserializationError::Ok);
+    std::string json2;
+    serializeJson(copy, json2);
+
+    REQUIRE(json2 == json);
+  }
+}
+
+TEST_CASE("serializeJson(HandWrittenBinding)") {
+  Telemetry t = {21.25, 45.5};
+  std::string json;
+
+  serializeJson(t, json);
+
+  REQUIRE(json == "{\"temp-c\":21.25,\"rh-%\":45.5}");
+}
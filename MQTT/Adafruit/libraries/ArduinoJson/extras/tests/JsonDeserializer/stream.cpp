@@ -0,0 +1,249 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#define ARDUINOJSON_DECODE_UNICODE 1
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <string>
+
+#include "Allocators.hpp"
+
+// Records the tokens in a compact form
+struct TokenRecorder {
+  std::string tokens;
+
+  void beginObject() {
+    tokens += "{";
+  }
+
+  void endObject() {
+    tokens += "}";
+  }
+
+  void beginArray() {
+    tokens += "[";
+  }
+
+  void endArray() {
+    tokens += "]";
+  }
+
+  void key(JsonString s) {
+    tokens += "k:";
+    tokens += s.c_str();
+    tokens += " ";
+  }
+
+  void value(JsonVariantConst v) {
+    std::string s;
+    serializeJson(v, s);
+    tokens += s + " ";
+  }
+};
+
+static DeserializationError feedInChunks(JsonStreamDeserializer& parser,
+                                         const std::string& input,
+                                         size_t chunkSize) {
+  for (size_t i = 0; i < input.size(); i += chunkSize) {
+    DeserializationError err =
+        parser.feed(input.c_str() + i, std::min(chunkSize, input.size() - i));
+    if (err)
+      return err;
+  }
+  return parser.end();
+}
+
+TEST_CASE("JsonStreamDeserializer") {
+  JsonDocument doc;
+
+  SECTION("produces the same document as deserializeJson()") {
+    std::string input =
+        "{\"shared\":{\"fw_version\":\"1.2.3\",\"fw_size\":123456},"
+        "'client':{sp:[1,-2.5e3,true,false,null],\"u\":\"\\u00e9\\ud83d\\ude00"
+        "\\n\"},\"empty\":[{},[]]}";
+
+    JsonDocument expected;
+    REQUIRE(deserializeJson(expected, input) == DeserializationError::Ok);
+
+    for (size_t chunkSize = 1; chunkSize <= input.size(); chunkSize++) {
+      CAPTURE(chunkSize);
+      JsonStreamDeserializer parser(doc);
+
+      REQUIRE(feedInChunks(parser, input, chunkSize) ==
+              DeserializationError::Ok);
+      REQUIRE(doc == expected);
+    }
+  }
+
+  SECTION("clears the document") {
+    doc["hello"] = "world";
+
+    JsonStreamDeserializer parser(doc);
+
+    REQUIRE(doc.isNull());
+  }
+
+  SECTION("number at the root requires end()") {
+    JsonStreamDeserializer parser(doc);
+
+    REQUIRE(parser.feed("4", 1) == DeserializationError::Ok);
+    REQUIRE(parser.feed("2", 1) == DeserializationError::Ok);
+    REQUIRE(doc.isNull());
+
+    REQUIRE(parser.end() == DeserializationError::Ok);
+    REQUIRE(doc.as<int>() == 42);
+  }
+
+  SECTION("ignores the input after the root value") {
+    JsonStreamDeserializer parser(doc);
+
+    REQUIRE(parser.feed("[1] ", 4) == DeserializationError::Ok);
+    REQUIRE(parser.feed("garbage", 7) == DeserializationError::Ok);
+    REQUIRE(parser.end() == DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "[1]");
+  }
+
+  SECTION("stops at the first null character") {
+    JsonStreamDeserializer parser(doc);
+
+    REQUIRE(parser.feed("[1,\0,2]", 7) == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("accepts uint8_t buffers") {
+    const uint8_t input[] = {'[', '4', '2', ']'};
+    JsonStreamDeserializer parser(doc);
+
+    REQUIRE(parser.feed(input, sizeof(input)) == DeserializationError::Ok);
+    REQUIRE(parser.end() == DeserializationError::Ok);
+    REQUIRE(doc[0] == 42);
+  }
+
+  SECTION("duplicate keys") {
+    JsonStreamDeserializer parser(doc);
+
+    REQUIRE(feedInChunks(parser, "{\"a\":[1],\"a\":2}", 3) ==
+            DeserializationError::Ok);
+    REQUIRE(doc.as<std::string>() == "{\"a\":2}");
+  }
+}
+
+TEST_CASE("JsonStreamDeserializer errors") {
+  JsonDocument doc;
+
+  SECTION("EmptyInput") {
+    JsonStreamDeserializer parser(doc);
+
+    REQUIRE(parser.feed(" \r\n", 3) == DeserializationError::Ok);
+    REQUIRE(parser.end() == DeserializationError::EmptyInput);
+  }
+
+  SECTION("IncompleteInput") {
+    const char* testCases[] = {
+        "\"\\", "'\\u00", "fals", "{", "{a", "{a:", "{a:1,", "[", "[1,", "[[]",
+        "[1.5", "{a:-2",
+    };
+
+    for (auto input : testCases) {
+      CAPTURE(input);
+      JsonStreamDeserializer parser(doc);
+
+      REQUIRE(feedInChunks(parser, input, 1) ==
+              DeserializationError::IncompleteInput);
+    }
+  }
+
+  SECTION("InvalidInput") {
+    const char* testCases[] = {
+        "'\\x'", "'\\u0x00'", "tru3", "{,}", "{a 1}", "{a:1 b:2}",
+        "[1,]",  "[1 2]",     "]",    "[}",  "{a:1]", "{]",
+        "[e",    "[6+",       "{a:-", "8c",  "4[",    "8 ",
+    };
+
+    for (auto input : testCases) {
+      CAPTURE(input);
+      JsonStreamDeserializer parser(doc);
+
+      REQUIRE(feedInChunks(parser, input, 1) ==
+              DeserializationError::InvalidInput);
+    }
+  }
+
+  SECTION("same errors as deserializeJson()") {
+    const char* testCases[] = {
+        "8c", "8 ", "97\"2", "1e]", "[e", "[6+", "[6", "{a:1e", "-", "",
+    };
+
+    for (auto input : testCases) {
+      CAPTURE(input);
+      JsonStreamDeserializer parser(doc);
+      JsonDocument expected;
+
+      REQUIRE(feedInChunks(parser, input, 1) ==
+              deserializeJson(expected, input));
+    }
+  }
+
+  SECTION("returns the same error after a failure") {
+    JsonStreamDeserializer parser(doc);
+
+    REQUIRE(parser.feed("[1 2", 4) == DeserializationError::InvalidInput);
+    REQUIRE(parser.feed("]", 1) == DeserializationError::InvalidInput);
+    REQUIRE(parser.end() == DeserializationError::InvalidInput);
+  }
+
+  SECTION("TooDeep") {
+    JsonStreamDeserializer parser(doc, DeserializationOption::NestingLimit(2));
+
+    REQUIRE(parser.feed("[[", 2) == DeserializationError::Ok);
+    REQUIRE(parser.feed("[", 1) == DeserializationError::TooDeep);
+  }
+
+  SECTION("NoMemory") {
+    TimebombAllocator timebomb(2);
+    JsonDocument doc2(&timebomb);
+    JsonStreamDeserializer parser(doc2);
+
+    REQUIRE(feedInChunks(parser, "{\"a\":\"b\",\"c\":1}", 1) ==
+            DeserializationError::NoMemory);
+  }
+}
+
+TEST_CASE("JsonStreamParser") {
+  TokenRecorder recorder;
+  JsonStreamParser<TokenRecorder> parser(recorder);
+
+  SECTION("forwards the tokens to the handler") {
+    const char input[] =
+        "{\"method\":\"setRelay\",\"params\":{\"relay\":3,\"on\":true},"
+        "\"list\":[null,1.5,\"x\"]}";
+
+    for (size_t i = 0; i < sizeof(input) - 1; i++)
+      REQUIRE(parser.feed(input + i, 1) == DeserializationError::Ok);
+    REQUIRE(parser.end() == DeserializationError::Ok);
+
+    REQUIRE(recorder.tokens ==
+            "{k:method \"setRelay\" k:params {k:relay 3 k:on true }"
+            "k:list [null 1.5 \"x\" ]}");
+  }
+
+  SECTION("handles tokens that span chunks") {
+    REQUIRE(parser.feed("[\"he", 4) == DeserializationError::Ok);
+    REQUIRE(parser.feed("llo\\u00", 7) == DeserializationError::Ok);
+    REQUIRE(parser.feed("e9\",12", 6) == DeserializationError::Ok);
+    REQUIRE(parser.feed("34,fa", 5) == DeserializationError::Ok);
+    REQUIRE(parser.feed("lse]", 4) == DeserializationError::Ok);
+    REQUIRE(parser.end() == DeserializationError::Ok);
+
+    REQUIRE(recorder.tokens == "[\"hello\xC3\xA9\" 1234 false ]");
+  }
+
+  SECTION("string too long for the buffer") {
+    std::string input =
+        "[\"" + std::string(ARDUINOJSON_CURSOR_BUFFER_SIZE, 'x') + "\"]";
+
+    REQUIRE(parser.feed(input.c_str(), input.size()) ==
+            DeserializationError::NoMemory);
+  }
+}
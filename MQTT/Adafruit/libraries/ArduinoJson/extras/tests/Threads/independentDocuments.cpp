@@ -0,0 +1,141 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Allocators.hpp"
+
+// Catch's assertions are not thread-safe, so the threads count the failures
+// and the main thread checks the total.
+template <typename TFunc>
+static int runConcurrently(TFunc func, int threadCount = 8,
+                           int iterations = 500) {
+  std::atomic<int> failures(0);
+  std::atomic<bool> go(false);
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < threadCount; t++) {
+    threads.emplace_back([&, t]() noexcept {
+      while (!go.load())
+        std::this_thread::yield();
+      for (int i = 0; i < iterations; i++) {
+        if (!func(t, i))
+          failures++;
+      }
+    });
+  }
+  go = true;
+  for (auto& thread : threads)
+    thread.join();
+
+  return failures.load();
+}
+
+static const char* const inputs[] = {
+    "{\"temperature\":27.5,\"humidity\":61,\"pressure\":1013.25}",
+    "{\"method\":\"setRelay\",\"params\":{\"relay\":3,\"state\":true}}",
+    "[1e-300,1.7976931348623157e308,-0.000123,3.14159265358979,null]",
+    "{\"shared\":{\"fw_title\":\"gateway\",\"fw_version\":\"1.2.3\","
+    "\"fw_size\":123456,\"fw_checksum\":\"e3b0c44298fc1c149afbf4c8996fb92\"}}",
+};
+
+static const size_t inputCount = sizeof(inputs) / sizeof(inputs[0]);
+
+TEST_CASE("Independent JsonDocuments in concurrent threads") {
+  std::string expectedJson[inputCount];
+  std::string expectedMsgPack[inputCount];
+
+  for (size_t i = 0; i < inputCount; i++) {
+    JsonDocument doc;
+    REQUIRE(deserializeJson(doc, inputs[i]) == DeserializationError::Ok);
+    serializeJson(doc, expectedJson[i]);
+    serializeMsgPack(doc, expectedMsgPack[i]);
+  }
+
+  SECTION("deserializeJson() and serializeJson()") {
+    int failures = runConcurrently([&](int t, int i) {
+      size_t n = static_cast<size_t>(t + i) % inputCount;
+      JsonDocument doc;
+      if (deserializeJson(doc, inputs[n]))
+        return false;
+      std::string output;
+      serializeJson(doc, output);
+      return output == expectedJson[n];
+    });
+
+    REQUIRE(failures == 0);
+  }
+
+  SECTION("deserializeMsgPack() and serializeMsgPack()") {
+    int failures = runConcurrently([&](int t, int i) {
+      size_t n = static_cast<size_t>(t + i) % inputCount;
+      JsonDocument doc;
+      if (deserializeMsgPack(doc, expectedMsgPack[n]))
+        return false;
+      std::string output;
+      serializeJson(doc, output);
+      return output == expectedJson[n];
+    });
+
+    REQUIRE(failures == 0);
+  }
+
+  SECTION("duplicate strings are deduplicated per document") {
+    int failures = runConcurrently([&](int t, int) {
+      JsonDocument doc;
+      std::string key = "key" + std::to_string(t);
+      for (int j = 0; j < 4; j++)
+        doc.add(key);
+      return doc[0].as<const char*>() == doc[3].as<const char*>() &&
+             doc[3] == key;
+    });
+
+    REQUIRE(failures == 0);
+  }
+
+  SECTION("one allocator per thread") {
+    int failures = runConcurrently(
+        [&](int t, int) {
+          SpyingAllocator spy;
+          {
+            JsonDocument doc(&spy);
+            size_t n = static_cast<size_t>(t) % inputCount;
+            if (deserializeJson(doc, inputs[n]) || spy.allocatedBytes() == 0)
+              return false;
+          }
+          return spy.allocatedBytes() == 0;
+        },
+        4, 50);
+
+    REQUIRE(failures == 0);
+  }
+
+  SECTION("DeserializationError::c_str()") {
+    int failures = runConcurrently([&](int, int i) {
+      DeserializationError err(
+          static_cast<DeserializationError::Code>(i % 6));
+      DeserializationError same(err.code());
+      return err.c_str() == same.c_str();
+    });
+
+    REQUIRE(failures == 0);
+  }
+}
+
+TEST_CASE("DefaultAllocator::instance() is shared by all threads") {
+  ArduinoJson::Allocator* mainInstance =
+      ArduinoJson::detail::DefaultAllocator::instance();
+
+  int failures = runConcurrently([&](int, int) {
+    return ArduinoJson::detail::DefaultAllocator::instance() == mainInstance;
+  });
+
+  REQUIRE(failures == 0);
+}
@@ -16,6 +16,11 @@
 ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
 
 // A JSON document.
+// The library has no mutable global state, so independent documents can be
+// used concurrently from different threads. However, a document (and the
+// variants that point into it) must not be accessed from two threads at the
+// same time, and a custom allocator shared by several documents must be
+// thread-safe.
 // https://arduinojson.org/v7/api/jsondocument/
 class JsonDocument : public detail::VariantOperators<const JsonDocument&> {
   friend class detail::VariantAttorney;
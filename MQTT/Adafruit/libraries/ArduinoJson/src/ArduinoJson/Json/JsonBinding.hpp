@@ -0,0 +1,289 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Binding/Binding.hpp>
+#include <ArduinoJson/Json/JsonCursor.hpp>
+#include <ArduinoJson/Json/JsonSerializer.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// Reads a JSON input straight into the members of a bound struct.
+// Keys are matched against the fields as they come, unknown keys are skipped.
+template <typename TCursor>
+class JsonBindingReader {
+ public:
+  JsonBindingReader(TCursor& cursor) : cursor_(cursor) {}
+
+  template <typename T>
+  enable_if_t<IsJsonBound<T>::value> read(T& object) {
+    if (cursor_.enterObject())
+      readMembers(object);
+    else
+      cursor_.skip();
+  }
+
+  // Reads the members of the object that the cursor just entered
+  template <typename T>
+  void readMembers(T& object) {
+    for (JsonString key = cursor_.nextKey(); key; key = cursor_.nextKey()) {
+      FieldVisitor visitor(*this, key);
+      visitJsonFields(object, visitor);
+    }
+  }
+
+  // Strings are truncated to N - 1 characters. Like keys, they must fit in
+  // the cursor's buffer first: a string longer than
+  // ARDUINOJSON_CURSOR_BUFFER_SIZE - 1 (63 by default) fails with NoMemory.
+  template <size_t N>
+  void read(char (&value)[N]) {
+    copyJsonString(cursor_.template value<JsonString>(), value);
+  }
+
+  template <typename T, size_t N>
+  void read(T (&values)[N]) {
+    if (!cursor_.enterArray()) {
+      cursor_.skip();
+      return;
+    }
+    size_t i = 0;
+    while (cursor_.nextElement()) {
+      if (i < N)
+        read(values[i++]);
+    }
+  }
+
+  template <typename T>
+  enable_if_t<!IsJsonBound<T>::value && !is_array<T>::value> read(T& value) {
+    static_assert(!is_same<T, const char*>::value &&
+                      !is_same<T, char*>::value,
+                  "'const char*' and 'char*' members would point to the "
+                  "cursor's buffer, use 'char[N]' or 'String' instead");
+    value = cursor_.template value<T>();
+  }
+
+ private:
+  class FieldVisitor {
+   public:
+    FieldVisitor(JsonBindingReader& reader, JsonString key)
+        : reader_(reader), key_(key) {}
+
+    template <typename T>
+    bool operator()(const char* name, T& value) {
+      // key_ points to the cursor's buffer, which is overwritten as soon as we
+      // read the value, so we must stop after the first match
+      if (matched_ || key_ != name)
+        return false;
+      matched_ = true;
+      reader_.read(value);
+      return true;
+    }
+
+   private:
+    JsonBindingReader& reader_;
+    JsonString key_;
+    bool matched_ = false;
+  };
+
+  TCursor& cursor_;
+};
+
+// Writes the members of a bound struct as JSON, without intermediate document
+template <typename TWriter>
+class JsonBindingWriter {
+ public:
+  JsonBindingWriter(TWriter writer) : formatter_(writer) {}
+
+  size_t bytesWritten() const {
+    return formatter_.bytesWritten();
+  }
+
+  template <typename T>
+  enable_if_t<IsJsonBound<T>::value> write(const T& object) {
+    FieldVisitor visitor(*this);
+    formatter_.writeRaw('{');
+    visitJsonFields(object, visitor);
+    formatter_.writeRaw('}');
+  }
+
+  template <size_t N>
+  void write(const char (&value)[N]) {
+    JsonString s = boundedJsonString(value);
+    formatter_.writeString(s.c_str(), s.size());
+  }
+
+  template <typename T, size_t N>
+  void write(const T (&values)[N]) {
+    formatter_.writeRaw('[');
+    for (size_t i = 0; i < N; i++) {
+      if (i)
+        formatter_.writeRaw(',');
+      write(values[i]);
+    }
+    formatter_.writeRaw(']');
+  }
+
+  void write(bool value) {
+    formatter_.writeBoolean(value);
+  }
+
+  template <typename T>
+  enable_if_t<is_integral<T>::value && !is_same<T, bool>::value> write(
+      T value) {
+    formatter_.writeInteger(value);
+  }
+
+  template <typename T>
+  enable_if_t<is_enum<T>::value> write(T value) {
+    formatter_.writeInteger(static_cast<JsonInteger>(value));
+  }
+
+  template <typename T>
+  enable_if_t<is_floating_point<T>::value> write(T value) {
+    formatter_.writeFloat(static_cast<JsonFloat>(value));
+  }
+
+  template <typename T>
+  enable_if_t<IsString<T>::value && !is_array<T>::value> write(
+      const T& value) {
+    auto s = adaptString(value);
+    if (s.isNull()) {
+      formatter_.writeRaw("null");
+      return;
+    }
+    formatter_.writeRaw('\"');
+    for (size_t i = 0; i < s.size(); i++)
+      formatter_.writeChar(s[i]);
+    formatter_.writeRaw('\"');
+  }
+
+  // Other types go through their Converter, which requires a temporary
+  // document
+  template <typename T>
+  enable_if_t<!IsJsonBound<T>::value && !is_array<T>::value &&
+              !is_integral<T>::value && !is_enum<T>::value &&
+              !is_floating_point<T>::value && !IsString<T>::value>
+  write(const T& value) {
+    JsonDocument doc;
+    doc.set(value);
+    JsonSerializer<FormatterWriter> serializer(
+        FormatterWriter(formatter_), VariantAttorney::getResourceManager(doc));
+    VariantData::accept(VariantAttorney::getData(doc), serializer);
+  }
+
+ private:
+  class FieldVisitor {
+   public:
+    FieldVisitor(JsonBindingWriter& writer) : writer_(writer) {}
+
+    template <typename T>
+    bool operator()(const char* name, const T& value) {
+      if (!first_)
+        writer_.formatter_.writeRaw(',');
+      first_ = false;
+      writer_.formatter_.writeString(name);
+      writer_.formatter_.writeRaw(':');
+      writer_.write(value);
+      return false;
+    }
+
+   private:
+    JsonBindingWriter& writer_;
+    bool first_ = true;
+  };
+
+  class FormatterWriter {
+   public:
+    FormatterWriter(TextFormatter<TWriter>& formatter)
+        : formatter_(&formatter) {}
+
+    size_t write(uint8_t c) {
+      formatter_->writeRaw(static_cast<char>(c));
+      return 1;
+    }
+
+    size_t write(const uint8_t* s, size_t n) {
+      formatter_->writeRaw(reinterpret_cast<const char*>(s), n);
+      return n;
+    }
+
+   private:
+    TextFormatter<TWriter>* formatter_;
+  };
+
+  TextFormatter<TWriter> formatter_;
+};
+
+template <typename T, typename TWriter>
+size_t serializeBound(const T& source, TWriter writer) {
+  JsonBindingWriter<TWriter> serializer(writer);
+  serializer.write(source);
+  return serializer.bytesWritten();
+}
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses a JSON input directly into a struct bound with ARDUINOJSON_BIND().
+// Accepts the same inputs as makeJsonCursor().
+// Unlike JsonVariant::as<T>(), which starts from T(), members whose key is
+// missing keep their value, so the struct can hold the defaults.
+template <typename T, typename... Args>
+detail::enable_if_t<detail::IsJsonBound<T>::value, DeserializationError>
+deserializeJson(T& dst, Args&&... args) {
+  using namespace detail;
+  auto cursor = makeJsonCursor(detail::forward<Args>(args)...);
+  if (!cursor.enterObject()) {
+    if (cursor.error())
+      return cursor.error();
+    return DeserializationError::InvalidInput;
+  }
+  JsonBindingReader<decltype(cursor)>(cursor).readMembers(dst);
+  return cursor.error();
+}
+
+// Produces a minified JSON document from a struct bound with
+// ARDUINOJSON_BIND().
+template <typename T, typename TDestination>
+detail::enable_if_t<detail::IsJsonBound<T>::value, size_t> serializeJson(
+    const T& source, TDestination& destination) {
+  using namespace detail;
+  return serializeBound(source, Writer<TDestination>(destination));
+}
+
+// Produces a minified JSON document from a struct bound with
+// ARDUINOJSON_BIND().
+template <typename T>
+detail::enable_if_t<detail::IsJsonBound<T>::value, size_t> serializeJson(
+    const T& source, void* buffer, size_t bufferSize) {
+  using namespace detail;
+  size_t n = serializeBound(
+      source,
+      StaticStringWriter(reinterpret_cast<char*>(buffer), bufferSize));
+  if (n < bufferSize)
+    reinterpret_cast<char*>(buffer)[n] = 0;
+  return n;
+}
+
+// Produces a minified JSON document from a struct bound with
+// ARDUINOJSON_BIND().
+template <typename T, typename TChar, size_t N>
+detail::enable_if_t<detail::IsJsonBound<T>::value &&
+                        detail::IsChar<TChar>::value,
+                    size_t>
+serializeJson(const T& source, TChar (&buffer)[N]) {
+  return serializeJson(source, buffer, N);
+}
+
+// Computes the length of the document that serializeJson() produces.
+template <typename T>
+detail::enable_if_t<detail::IsJsonBound<T>::value, size_t> measureJson(
+    const T& source) {
+  using namespace detail;
+  return serializeBound(source, DummyWriter());
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
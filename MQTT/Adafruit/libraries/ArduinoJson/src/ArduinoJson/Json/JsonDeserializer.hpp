@@ -18,8 +18,19 @@
 
 ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
 
+template <typename TReader>
+class JsonCursor;
+
+template <typename THandler, typename TStringBuilder>
+class JsonPushParser;
+
 template <typename TReader>
 class JsonDeserializer {
+  friend class JsonCursor<TReader>;
+
+  template <typename THandler, typename TStringBuilder>
+  friend class JsonPushParser;
+
  public:
   JsonDeserializer(ResourceManager* resources, TReader reader)
       : stringBuilder_(resources),
@@ -255,7 +266,7 @@ class JsonDeserializer {
     // Read each key value pair
     for (;;) {
       // Parse key
-      err = parseKey();
+      err = parseKey(stringBuilder_);
       if (err)
         return err;
 
@@ -372,12 +383,13 @@ class JsonDeserializer {
     }
   }
 
-  DeserializationError::Code parseKey() {
-    stringBuilder_.startString();
+  template <typename TStringBuilder>
+  DeserializationError::Code parseKey(TStringBuilder& builder) {
+    builder.startString();
     if (isQuote(current())) {
-      return parseQuotedString();
+      return parseQuotedString(builder);
     } else {
-      return parseNonQuotedString();
+      return parseNonQuotedString(builder);
     }
   }
 
@@ -386,7 +398,7 @@ class JsonDeserializer {
 
     stringBuilder_.startString();
 
-    err = parseQuotedString();
+    err = parseQuotedString(stringBuilder_);
     if (err)
       return err;
 
@@ -395,7 +407,8 @@ class JsonDeserializer {
     return DeserializationError::Ok;
   }
 
-  DeserializationError::Code parseQuotedString() {
+  template <typename TStringBuilder>
+  DeserializationError::Code parseQuotedString(TStringBuilder& builder) {
 #if ARDUINOJSON_DECODE_UNICODE
     Utf16::Codepoint codepoint;
     DeserializationError::Code err;
@@ -426,9 +439,9 @@ class JsonDeserializer {
           if (err)
             return err;
           if (codepoint.append(codeunit))
-            Utf8::encodeCodepoint(codepoint.value(), stringBuilder_);
+            Utf8::encodeCodepoint(codepoint.value(), builder);
 #else
-          stringBuilder_.append('\\');
+          builder.append('\\');
 #endif
           continue;
         }
@@ -440,30 +453,31 @@ class JsonDeserializer {
         move();
       }
 
-      stringBuilder_.append(c);
+      builder.append(c);
     }
 
-    if (!stringBuilder_.isValid())
+    if (!builder.isValid())
       return DeserializationError::NoMemory;
 
     return DeserializationError::Ok;
   }
 
-  DeserializationError::Code parseNonQuotedString() {
+  template <typename TStringBuilder>
+  DeserializationError::Code parseNonQuotedString(TStringBuilder& builder) {
     char c = current();
     ARDUINOJSON_ASSERT(c);
 
     if (canBeInNonQuotedString(c)) {  // no quotes
       do {
         move();
-        stringBuilder_.append(c);
+        builder.append(c);
         c = current();
       } while (canBeInNonQuotedString(c));
     } else {
       return DeserializationError::InvalidInput;
     }
 
-    if (!stringBuilder_.isValid())
+    if (!builder.isValid())
       return DeserializationError::NoMemory;
 
     return DeserializationError::Ok;
@@ -0,0 +1,717 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Deserialization/deserialize.hpp>
+#include <ArduinoJson/Document/JsonDocument.hpp>
+#include <ArduinoJson/Json/JsonCursor.hpp>
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+#include <ArduinoJson/Memory/StringBuilder.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A resumable JSON parser: the input can be split anywhere, the parser keeps
+// its state between the calls to feed().
+// Tokens are forwarded to THandler as soon as they are complete; strings and
+// numbers are decoded in TStringBuilder.
+// It accepts the same syntax as JsonDeserializer.
+template <typename THandler, typename TStringBuilder>
+class JsonPushParser {
+  // JsonDeserializer's character classes
+  using Syntax = JsonDeserializer<Reader<const char*>>;
+
+  static const uint8_t maxDepth = ARDUINOJSON_DEFAULT_NESTING_LIMIT;
+
+ public:
+  JsonPushParser(THandler handler, TStringBuilder stringBuilder,
+                 DeserializationOption::NestingLimit nestingLimit)
+      : handler_(handler),
+        string_(stringBuilder),
+        nestingLimit_(nestingLimit) {}
+
+  DeserializationError::Code feed(const char* data, size_t size) {
+    for (size_t i = 0; i < size && !error_ && state_ != Done; i++) {
+      // like deserializeJson(), stop at the first null character
+      if (data[i] == '\0')
+        return end();
+      while (!error_ && !step(data[i])) {
+      }
+    }
+    return error_;
+  }
+
+  DeserializationError::Code end() {
+    if (error_ || state_ == Done)
+      return error_;
+
+    // a number at the root has no delimiter, and like JsonDeserializer, a
+    // malformed number is reported before the unclosed containers
+    if (state_ == InNumber) {
+      endNumber();
+      if (error_ || depth_ == 0)
+        return error_;
+    }
+
+    if (state_ == ValueExpected && !foundSomething_)
+      error_ = DeserializationError::EmptyInput;
+    else
+      error_ = DeserializationError::IncompleteInput;
+    return error_;
+  }
+
+ private:
+  enum State : uint8_t {
+    ValueExpected,
+    FirstValueExpected,  // after '[', accepts ']'
+    KeyExpected,
+    FirstKeyExpected,  // after '{', accepts '}'
+    ColonExpected,
+    CommaExpected,
+    InString,
+    InEscapeSequence,
+    InUnicodeEscape,
+    InNonQuotedKey,
+    InNumber,
+    InKeyword,
+#if ARDUINOJSON_ENABLE_COMMENTS
+    InCommentStart,
+    InBlockComment,
+    InBlockCommentEnd,
+    InLineComment,
+#endif
+    Done,
+  };
+
+  // Processes one character.
+  // Returns false if the character must be processed again in the new state.
+  bool step(char c) {
+    switch (state_) {
+      case ValueExpected:
+        return startValue(c, false);
+
+      case FirstValueExpected:
+        return startValue(c, true);
+
+      case KeyExpected:
+        return startKey(c, false);
+
+      case FirstKeyExpected:
+        return startKey(c, true);
+
+      case ColonExpected:
+        if (skipSpace(c))
+          return true;
+        if (c != ':')
+          return fail(DeserializationError::InvalidInput);
+        state_ = ValueExpected;
+        return true;
+
+      case CommaExpected:
+        return expectComma(c);
+
+      case InString:
+        return readString(c);
+
+      case InEscapeSequence:
+        return readEscapeSequence(c);
+
+      case InUnicodeEscape:
+        return readUnicodeEscape(c);
+
+      case InNonQuotedKey:
+        if (Syntax::canBeInNonQuotedString(c)) {
+          string_.append(c);
+          return true;
+        }
+        endKey();
+        return false;
+
+      case InNumber:
+        if (Syntax::canBeInNumber(c)) {
+          // same limit as JsonDeserializer
+          if (++tokenLength_ > 63)
+            return fail(DeserializationError::InvalidInput);
+          string_.append(c);
+          return true;
+        }
+        endNumber();
+        // like deserializeJson(), reject anything after a number at the root
+        if (!error_ && depth_ == 0)
+          return fail(DeserializationError::InvalidInput);
+        return false;
+
+      case InKeyword:
+        if (c != *keyword_)
+          return fail(DeserializationError::InvalidInput);
+        if (*++keyword_ == '\0')
+          endKeyword();
+        return true;
+
+#if ARDUINOJSON_ENABLE_COMMENTS
+      case InCommentStart:
+        if (c == '*')
+          state_ = InBlockComment;
+        else if (c == '/')
+          state_ = InLineComment;
+        else
+          error_ = DeserializationError::InvalidInput;
+        return true;
+
+      case InBlockComment:
+        if (c == '*')
+          state_ = InBlockCommentEnd;
+        return true;
+
+      case InBlockCommentEnd:
+        if (c == '/')
+          state_ = stateAfterComment_;
+        else if (c != '*')
+          state_ = InBlockComment;
+        return true;
+
+      case InLineComment:
+        if (c == '\n')
+          state_ = stateAfterComment_;
+        return true;
+#endif
+
+      default:  // Done
+        return true;
+    }
+  }
+
+  bool fail(DeserializationError::Code err) {
+    error_ = err;
+    return true;
+  }
+
+  bool skipSpace(char c) {
+    switch (c) {
+      case ' ':
+      case '\t':
+      case '\r':
+      case '\n':
+        return true;
+
+#if ARDUINOJSON_ENABLE_COMMENTS
+      case '/':
+        stateAfterComment_ = state_;
+        state_ = InCommentStart;
+        return true;
+#endif
+
+      default:
+        return false;
+    }
+  }
+
+  bool startValue(char c, bool acceptClosingBracket) {
+    if (skipSpace(c))
+      return true;
+
+    foundSomething_ = true;
+
+    switch (c) {
+      case '[':
+        return openContainer(true);
+
+      case '{':
+        return openContainer(false);
+
+      case '\"':
+      case '\'':
+        startString(c, false);
+        return true;
+
+      case 't':
+        startKeyword("true");
+        return true;
+
+      case 'f':
+        startKeyword("false");
+        return true;
+
+      case 'n':
+        startKeyword("null");
+        return true;
+
+      case ']':
+        if (acceptClosingBracket)
+          return closeContainer();
+        return fail(DeserializationError::InvalidInput);
+
+      default:
+        if (!Syntax::canBeInNumber(c))
+          return fail(DeserializationError::InvalidInput);
+        string_.startString();
+        tokenLength_ = 0;
+        state_ = InNumber;
+        return false;
+    }
+  }
+
+  bool startKey(char c, bool acceptClosingBrace) {
+    if (skipSpace(c))
+      return true;
+
+    if (c == '}' && acceptClosingBrace)
+      return closeContainer();
+
+    if (Syntax::isQuote(c)) {
+      startString(c, true);
+      return true;
+    }
+
+    if (!Syntax::canBeInNonQuotedString(c))
+      return fail(DeserializationError::InvalidInput);
+
+    string_.startString();
+    state_ = InNonQuotedKey;
+    return false;
+  }
+
+  bool expectComma(char c) {
+    if (skipSpace(c))
+      return true;
+
+    if (c == ',') {
+      state_ = inArray() ? ValueExpected : KeyExpected;
+      return true;
+    }
+
+    if (c == (inArray() ? ']' : '}'))
+      return closeContainer();
+
+    return fail(DeserializationError::InvalidInput);
+  }
+
+  bool openContainer(bool isArray) {
+    if (depth_ >= maxDepth || remainingNesting().reached())
+      return fail(DeserializationError::TooDeep);
+
+    if (!check(isArray ? handler_.beginArray() : handler_.beginObject()))
+      return true;
+
+    uint8_t mask = uint8_t(1 << (depth_ % 8));
+    if (isArray)
+      containers_[depth_ / 8] |= mask;
+    else
+      containers_[depth_ / 8] &= uint8_t(~mask);
+    depth_++;
+
+    state_ = isArray ? FirstValueExpected : FirstKeyExpected;
+    return true;
+  }
+
+  bool closeContainer() {
+    if (inArray())
+      handler_.endArray();
+    else
+      handler_.endObject();
+    depth_--;
+    endValue();
+    return true;
+  }
+
+  bool inArray() const {
+    ARDUINOJSON_ASSERT(depth_ > 0);
+    uint8_t i = uint8_t(depth_ - 1);
+    return (containers_[i / 8] & (1 << (i % 8))) != 0;
+  }
+
+  DeserializationOption::NestingLimit remainingNesting() const {
+    auto nestingLimit = nestingLimit_;
+    for (uint8_t i = 0; i < depth_; i++)
+      nestingLimit = nestingLimit.decrement();
+    return nestingLimit;
+  }
+
+  void startString(char quote, bool isKey) {
+    string_.startString();
+    token_ = quote;
+    isKey_ = isKey;
+#if ARDUINOJSON_DECODE_UNICODE
+    codepoint_ = Utf16::Codepoint();
+#endif
+    state_ = InString;
+  }
+
+  bool readString(char c) {
+    if (c == token_) {
+      if (!string_.isValid())
+        return fail(DeserializationError::NoMemory);
+      if (isKey_)
+        endKey();
+      else if (check(handler_.string(string_)))
+        endValue();
+      return true;
+    }
+
+    if (c == '\\')
+      state_ = InEscapeSequence;
+    else
+      string_.append(c);
+    return true;
+  }
+
+  bool readEscapeSequence(char c) {
+    if (c == 'u') {
+#if ARDUINOJSON_DECODE_UNICODE
+      codeunit_ = 0;
+      tokenLength_ = 0;
+      state_ = InUnicodeEscape;
+      return true;
+#else
+      // keep the escape sequence as is
+      string_.append('\\');
+      state_ = InString;
+      return false;
+#endif
+    }
+
+    c = EscapeSequence::unescapeChar(c);
+    if (c == '\0')
+      return fail(DeserializationError::InvalidInput);
+    string_.append(c);
+    state_ = InString;
+    return true;
+  }
+
+  bool readUnicodeEscape(char c) {
+#if ARDUINOJSON_DECODE_UNICODE
+    uint8_t value = Syntax::decodeHex(c);
+    if (value > 0x0F)
+      return fail(DeserializationError::InvalidInput);
+    codeunit_ = uint16_t((codeunit_ << 4) | value);
+    if (++tokenLength_ == 4) {
+      if (codepoint_.append(codeunit_))
+        Utf8::encodeCodepoint(codepoint_.value(), string_);
+      state_ = InString;
+    }
+#else
+    (void)c;
+#endif
+    return true;
+  }
+
+  void endKey() {
+    if (!string_.isValid())
+      error_ = DeserializationError::NoMemory;
+    else if (check(handler_.key(string_)))
+      state_ = ColonExpected;
+  }
+
+  void endNumber() {
+    if (!string_.isValid())
+      error_ = DeserializationError::NoMemory;
+    else if (check(handler_.number(string_)))
+      endValue();
+  }
+
+  void startKeyword(const char* keyword) {
+    token_ = keyword[0];
+    keyword_ = keyword + 1;
+    state_ = InKeyword;
+  }
+
+  void endKeyword() {
+    if (check(token_ == 'n' ? handler_.null() : handler_.boolean(token_ == 't')))
+      endValue();
+  }
+
+  void endValue() {
+    state_ = depth_ > 0 ? CommaExpected : Done;
+  }
+
+  bool check(DeserializationError::Code err) {
+    if (err)
+      error_ = err;
+    return !err;
+  }
+
+  THandler handler_;
+  TStringBuilder string_;
+  DeserializationOption::NestingLimit nestingLimit_;
+  DeserializationError::Code error_ = DeserializationError::Ok;
+  State state_ = ValueExpected;
+#if ARDUINOJSON_ENABLE_COMMENTS
+  State stateAfterComment_ = ValueExpected;
+#endif
+  uint8_t depth_ = 0;
+  uint8_t containers_[maxDepth / 8 + 1] = {};  // one bit per level: 1 = array
+  uint8_t tokenLength_ = 0;
+  char token_ = 0;  // the quote of a string or the first letter of a keyword
+  bool isKey_ = false;
+  bool foundSomething_ = false;
+  const char* keyword_ = nullptr;
+#if ARDUINOJSON_DECODE_UNICODE
+  uint16_t codeunit_ = 0;
+  Utf16::Codepoint codepoint_;
+#endif
+};
+
+// Forwards the tokens of JsonPushParser to the user's handler
+template <typename THandler>
+class JsonStreamCallbacks {
+ public:
+  JsonStreamCallbacks(THandler& handler) : handler_(&handler) {}
+
+  DeserializationError::Code beginObject() {
+    handler_->beginObject();
+    return DeserializationError::Ok;
+  }
+
+  void endObject() {
+    handler_->endObject();
+  }
+
+  DeserializationError::Code beginArray() {
+    handler_->beginArray();
+    return DeserializationError::Ok;
+  }
+
+  void endArray() {
+    handler_->endArray();
+  }
+
+  template <typename TStringBuilder>
+  DeserializationError::Code key(TStringBuilder& builder) {
+    handler_->key(builder.str());
+    return DeserializationError::Ok;
+  }
+
+  template <typename TStringBuilder>
+  DeserializationError::Code string(TStringBuilder& builder) {
+    VariantData data;
+    data.setLinkedString(builder.str().c_str());
+    return value(data);
+  }
+
+  template <typename TStringBuilder>
+  DeserializationError::Code number(TStringBuilder& builder) {
+    VariantData data;
+    if (!parseNumber(builder.str().c_str(), data))
+      return DeserializationError::InvalidInput;
+    return value(data);
+  }
+
+  DeserializationError::Code boolean(bool b) {
+    VariantData data;
+    data.setBoolean(b);
+    return value(data);
+  }
+
+  DeserializationError::Code null() {
+    VariantData data;
+    return value(data);
+  }
+
+ private:
+  DeserializationError::Code value(VariantData& data) {
+    handler_->value(JsonVariantConst(&data, nullptr));
+    return DeserializationError::Ok;
+  }
+
+  THandler* handler_;
+};
+
+// Builds a JsonDocument from the tokens of JsonPushParser
+class JsonDocumentBuilder {
+ public:
+  JsonDocumentBuilder(VariantData* root, ResourceManager* resources)
+      : root_(root), resources_(resources) {}
+
+  DeserializationError::Code beginObject() {
+    VariantData* variant = nextValue();
+    if (!variant)
+      return DeserializationError::NoMemory;
+    variant->toObject();
+    containers_[depth_++] = variant;
+    return DeserializationError::Ok;
+  }
+
+  void endObject() {
+    depth_--;
+  }
+
+  DeserializationError::Code beginArray() {
+    VariantData* variant = nextValue();
+    if (!variant)
+      return DeserializationError::NoMemory;
+    variant->toArray();
+    containers_[depth_++] = variant;
+    return DeserializationError::Ok;
+  }
+
+  void endArray() {
+    depth_--;
+  }
+
+  DeserializationError::Code key(StringBuilder& builder) {
+    ObjectData* object = containers_[depth_ - 1]->asObject();
+    ARDUINOJSON_ASSERT(object != nullptr);
+
+    member_ =
+        object->getMember(adaptString(builder.str().c_str()), resources_);
+    if (member_) {
+      // same key used twice, as in {"a":1,"a":2}
+      member_->setNull(resources_);
+      return DeserializationError::Ok;
+    }
+
+    member_ = object->addMember(builder.save(), resources_);
+    if (!member_)
+      return DeserializationError::NoMemory;
+
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code string(StringBuilder& builder) {
+    VariantData* variant = nextValue();
+    if (!variant)
+      return DeserializationError::NoMemory;
+    variant->setOwnedString(builder.save());
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code number(StringBuilder& builder) {
+    VariantData* variant = nextValue();
+    if (!variant)
+      return DeserializationError::NoMemory;
+    if (!parseNumber(builder.str().c_str(), *variant))
+      return DeserializationError::InvalidInput;
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code boolean(bool b) {
+    VariantData* variant = nextValue();
+    if (!variant)
+      return DeserializationError::NoMemory;
+    variant->setBoolean(b);
+    return DeserializationError::Ok;
+  }
+
+  DeserializationError::Code null() {
+    if (!nextValue())
+      return DeserializationError::NoMemory;
+    return DeserializationError::Ok;
+  }
+
+ private:
+  // Returns the variant that receives the next value
+  VariantData* nextValue() {
+    if (depth_ == 0)
+      return root_;
+
+    ArrayData* array = containers_[depth_ - 1]->asArray();
+    if (array)
+      return array->addElement(resources_);
+
+    return member_;
+  }
+
+  VariantData* root_;
+  ResourceManager* resources_;
+  VariantData* member_ = nullptr;
+  VariantData* containers_[ARDUINOJSON_DEFAULT_NESTING_LIMIT + 1];
+  uint8_t depth_ = 0;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Parses a JSON input that arrives in chunks, and forwards the tokens to
+// a handler as soon as they are complete.
+// THandler must have the following member functions:
+//   void beginObject(), void endObject(), void beginArray(), void endArray(),
+//   void key(JsonString), and void value(JsonVariantConst).
+// Keys and strings are only valid during the call.
+// Each key or string value must fit in a buffer of
+// ARDUINOJSON_CURSOR_BUFFER_SIZE characters, terminator included (63
+// characters by default); a longer one makes feed() fail with NoMemory.
+// To receive long strings, for example from a large HTTP response, define
+// ARDUINOJSON_CURSOR_BUFFER_SIZE before including ArduinoJson.h; it also
+// sets the size of makeJsonCursor()'s buffers.
+// The nesting limit cannot exceed ARDUINOJSON_DEFAULT_NESTING_LIMIT.
+template <typename THandler>
+class JsonStreamParser {
+ public:
+  JsonStreamParser(THandler& handler,
+                   DeserializationOption::NestingLimit nestingLimit = {})
+      : parser_(Callbacks(handler), Buffer(), nestingLimit) {}
+
+  // Parses the next chunk of the input.
+  // Returns the first error encountered, if any.
+  DeserializationError feed(const char* data, size_t size) {
+    return parser_.feed(data, size);
+  }
+
+  // Parses the next chunk of the input.
+  // Returns the first error encountered, if any.
+  DeserializationError feed(const uint8_t* data, size_t size) {
+    return parser_.feed(reinterpret_cast<const char*>(data), size);
+  }
+
+  // Signals the end of the input.
+  // Returns IncompleteInput if the JSON document is not complete.
+  DeserializationError end() {
+    return parser_.end();
+  }
+
+ private:
+  using Callbacks = detail::JsonStreamCallbacks<THandler>;
+  using Buffer = detail::FixedStringBuilder<ARDUINOJSON_CURSOR_BUFFER_SIZE>;
+
+  detail::JsonPushParser<Callbacks, Buffer> parser_;
+};
+
+// Parses a JSON input that arrives in chunks, and puts the result in a
+// JsonDocument. The input doesn't need to be buffered.
+// The nesting limit cannot exceed ARDUINOJSON_DEFAULT_NESTING_LIMIT.
+class JsonStreamDeserializer {
+ public:
+  JsonStreamDeserializer(JsonDocument& doc,
+                         DeserializationOption::NestingLimit nestingLimit = {})
+      : doc_(doc),
+        parser_(detail::JsonDocumentBuilder(
+                    detail::VariantAttorney::getData(doc),
+                    detail::VariantAttorney::getResourceManager(doc)),
+                detail::StringBuilder(
+                    detail::VariantAttorney::getResourceManager(doc)),
+                nestingLimit) {
+    doc.clear();
+  }
+
+  JsonStreamDeserializer(const JsonStreamDeserializer&) = delete;
+  JsonStreamDeserializer& operator=(const JsonStreamDeserializer&) = delete;
+
+  // Parses the next chunk of the input.
+  // Returns the first error encountered, if any.
+  DeserializationError feed(const char* data, size_t size) {
+    return parser_.feed(data, size);
+  }
+
+  // Parses the next chunk of the input.
+  // Returns the first error encountered, if any.
+  DeserializationError feed(const uint8_t* data, size_t size) {
+    return parser_.feed(reinterpret_cast<const char*>(data), size);
+  }
+
+  // Signals the end of the input.
+  // Returns IncompleteInput if the JSON document is not complete.
+  DeserializationError end() {
+    auto err = parser_.end();
+    detail::shrinkJsonDocument(doc_);
+    return err;
+  }
+
+ private:
+  JsonDocument& doc_;
+  detail::JsonPushParser<detail::JsonDocumentBuilder, detail::StringBuilder>
+      parser_;
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -21,6 +21,9 @@ class Allocator {
 };
 
 namespace detail {
+// A stateless wrapper around malloc() and free().
+// The instance has no data member, so it's constant-initialized and can be
+// used from any thread, even when the compiler doesn't guard local statics.
 class DefaultAllocator : public Allocator {
  public:
   void* allocate(size_t size) override {
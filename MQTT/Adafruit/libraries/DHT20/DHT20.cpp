@@ -26,6 +26,10 @@ DHT20::DHT20(TwoWire *wire)
   _status      = DHT20_OK;
   _lastRequest = 0;
   _lastRead    = 0;
+  _measuring   = false;
+  _callback    = NULL;
+  _sampleHead  = 0;
+  _sampleCount = 0;
 }
 
 
@@ -100,6 +104,84 @@ int DHT20::read()
 }
 
 
+////////////////////////////////////////////////
+//
+//  NON-BLOCKING READ
+//
+int DHT20::startMeasurement()
+{
+  if (_measuring) return DHT20_ERROR_BUSY;
+  //  do not read to fast == more than once per second.
+  if (millis() - _lastRead < 1000)
+  {
+    return DHT20_ERROR_LASTREAD;
+  }
+  if (requestData() != 0) return DHT20_ERROR_CONNECT;
+  _measuring = true;
+  return DHT20_OK;
+}
+
+
+int DHT20::poll()
+{
+  if (!_measuring) return DHT20_IDLE;
+  //  datasheet 7.4 point 3: wait 80 ms before reading
+  if (millis() - _lastRequest < 80) return DHT20_MEASURING;
+
+  //  one transfer gives the busy flag and the data
+  int status = readData();
+  if ((status > 0) && (_bits[0] & 0x80))
+  {
+    if (millis() - _lastRequest < 1000) return DHT20_MEASURING;
+    status = DHT20_ERROR_READ_TIMEOUT;
+  }
+  else if (status > 0)
+  {
+    if (_crc8(_bits, 6) != _bits[6])
+    {
+      status = DHT20_ERROR_CHECKSUM;
+    }
+    else
+    {
+      status = convert();
+      DHT20_sample &s = _samples[_sampleHead];
+      s.time        = _lastRead;
+      s.humidity    = _humidity;
+      s.temperature = _temperature;
+      _sampleHead = (_sampleHead + 1) % DHT20_SAMPLES;
+      if (_sampleCount < DHT20_SAMPLES) _sampleCount++;
+    }
+  }
+  _measuring = false;
+  if (_callback != NULL) _callback(status);
+  return status;
+}
+
+
+void DHT20::onMeasurement(DHT20_callback callback)
+{
+  _callback = callback;
+}
+
+
+uint8_t DHT20::available()
+{
+  return _sampleCount;
+}
+
+
+bool DHT20::getSample(DHT20_sample &sample)
+{
+  if (_sampleCount == 0) return false;
+  uint8_t index = (_sampleHead + DHT20_SAMPLES - _sampleCount) % DHT20_SAMPLES;
+  sample = _samples[index];
+  sample.humidity    += _humOffset;
+  sample.temperature += _tempOffset;
+  _sampleCount--;
+  return true;
+}
+
+
 int DHT20::requestData()
 {
   //  reset sensor if needed.
@@ -0,0 +1,32 @@
+#ifndef _HOST_SPI_H
+#define _HOST_SPI_H
+
+#include <Arduino.h>
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+/// Defined by the test, the chip on the other end of the bus
+uint8_t spiTransfer(uint8_t b);
+
+struct SPISettings {
+  SPISettings() {}
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+public:
+  void begin(void) {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction(void) {}
+  uint8_t transfer(uint8_t b) { return spiTransfer(b); }
+  void transfer(void *buf, size_t n) {
+    uint8_t *p = (uint8_t *)buf;
+    for (size_t i = 0; i < n; i++)
+      p[i] = spiTransfer(p[i]);
+  }
+};
+
+extern SPIClass SPI;
+
+#endif
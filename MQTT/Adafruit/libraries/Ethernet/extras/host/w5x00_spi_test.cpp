@@ -0,0 +1,340 @@
+// Host test of the Ethernet library's socket layer against a register model
+// of a WIZnet chip behind the SPI stub, counting SPI transactions (chip
+// select cycles) and bytes. The Makefile builds it once per chip, with
+// MODEL_CHIP set to 55, 52 or 51 for the W5500, W5200 or W5100, each
+// speaking its own SPI framing. W5100.init() has to detect the chip.
+//
+// - A 16 kB stream, arriving in 1460-byte segments as the sketch reads,
+//   comes out intact through available() + read(), available() + peek() +
+//   read(), and read(buf, 512); peek() always returns the byte read next.
+// - available() with nothing received reports 0, and then sees data that
+//   arrives.
+// - write(byte) and write(buf, 64) put the same bytes on the wire.
+// Then prints transactions and SPI bytes per kB for each, and transactions
+// per idle available() call.
+#include <Ethernet.h>
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "utility/w5100.h"
+
+#ifndef MODEL_CHIP
+#define MODEL_CHIP 55
+#endif
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+SPIClass SPI;
+const IPAddress INADDR_NONE(0, 0, 0, 0);
+
+/// The registers and buffers of a chip with 8 sockets of 2 kB each way.
+/// Connections establish at once, sent data leaves at once, and the peer
+/// sends with inject().
+struct Chip {
+  uint8_t common[0x100] = {0};
+  uint8_t sreg[8][0x100] = {{0}};
+  uint8_t tx[8][2048] = {{0}}, rx[8][2048] = {{0}};
+  std::string sent[8];
+  unsigned long transactions = 0, bytes = 0;
+
+  // The frame under chip select
+  bool selected = false, writing = false;
+  uint8_t header[4];
+  int pos = 0, block = 0;
+  uint16_t addr = 0;
+
+  Chip() { version(); }
+
+  static uint16_t get16(const uint8_t *p) { return (p[0] << 8) | p[1]; }
+  uint16_t reg16(int s, int r) { return get16(&sreg[s][r]); }
+  void setReg16(int s, int r, uint16_t v) {
+    sreg[s][r] = v >> 8;
+    sreg[s][r + 1] = v;
+  }
+
+  void version(void) {
+    if (MODEL_CHIP == 55)
+      common[0x39] = 4;
+    if (MODEL_CHIP == 52)
+      common[0x1F] = 3;
+  }
+
+  void command(int s, uint8_t cmd) {
+    switch (cmd) {
+    case Sock_OPEN:
+      sreg[s][0x03] =
+          (sreg[s][0x00] & 0x0F) == SnMR::TCP ? SnSR::INIT : SnSR::UDP;
+      setReg16(s, 0x20, 2048); // Free TX size
+      setReg16(s, 0x22, 0);    // TX read and write pointers
+      setReg16(s, 0x24, 0);
+      setReg16(s, 0x26, 0); // Received size
+      setReg16(s, 0x28, 0); // RX read and write pointers
+      setReg16(s, 0x2A, 0);
+      sent[s].clear();
+      break;
+    case Sock_CONNECT:
+      sreg[s][0x03] = SnSR::ESTABLISHED;
+      sreg[s][0x02] |= SnIR::CON;
+      break;
+    case Sock_LISTEN:
+      sreg[s][0x03] = SnSR::LISTEN;
+      break;
+    case Sock_DISCON:
+    case Sock_CLOSE:
+      sreg[s][0x03] = SnSR::CLOSED;
+      break;
+    case Sock_RECV:
+      setReg16(s, 0x26, reg16(s, 0x2A) - reg16(s, 0x28));
+      break;
+    case Sock_SEND:
+      for (uint16_t p = reg16(s, 0x22); p != reg16(s, 0x24); p++)
+        sent[s].push_back(tx[s][p & 0x7FF]);
+      setReg16(s, 0x22, reg16(s, 0x24));
+      setReg16(s, 0x20, 2048);
+      sreg[s][0x02] |= SnIR::SEND_OK;
+      break;
+    }
+  }
+
+  /// The peer sends up to n bytes, as many as the receive buffer takes
+  size_t inject(int s, const uint8_t *data, size_t n) {
+    uint16_t wr = reg16(s, 0x2A);
+    uint16_t used = wr - reg16(s, 0x28); // Not yet given back with RECV
+    n = std::min(n, (size_t)(2048 - used));
+    for (size_t i = 0; i < n; i++)
+      rx[s][(wr + i) & 0x7FF] = data[i];
+    setReg16(s, 0x2A, wr + n);
+    setReg16(s, 0x26, reg16(s, 0x26) + n);
+    if (n)
+      sreg[s][0x02] |= SnIR::RECV;
+    return n;
+  }
+
+  /// The flat address map of the W5100 and W5200
+  uint8_t *flat(uint16_t a, int &sock, int &reg) {
+    uint16_t sockets = MODEL_CHIP == 51 ? 0x0400 : 0x4000;
+    uint16_t txBase = MODEL_CHIP == 51 ? 0x4000 : 0x8000;
+    uint16_t rxBase = MODEL_CHIP == 51 ? 0x6000 : 0xC000;
+    static uint8_t unused;
+    sock = -1;
+    if (a < 0x100)
+      return &common[a];
+    if (a >= sockets && a < sockets + 0x800) {
+      sock = (a - sockets) >> 8;
+      reg = a & 0xFF;
+      return &sreg[sock][reg];
+    }
+    if (a >= txBase && a < rxBase)
+      return &tx[(a - txBase) >> 11][a & 0x7FF];
+    if (a >= rxBase && a - rxBase < (MODEL_CHIP == 51 ? 0x2000 : 0x4000))
+      return &rx[(a - rxBase) >> 11][a & 0x7FF];
+    return &unused;
+  }
+
+  /// The W5500's blocks: common registers, then per socket its
+  /// registers, TX and RX buffers
+  uint8_t *blockAddr(uint16_t a, int &sock, int &reg) {
+    sock = -1;
+    if (!block)
+      return &common[a & 0xFF];
+    int s = block >> 2;
+    switch (block & 3) {
+    case 1:
+      sock = s;
+      reg = a & 0xFF;
+      return &sreg[s][reg];
+    case 2:
+      return &tx[s][a & 0x7FF];
+    default:
+      return &rx[s][a & 0x7FF];
+    }
+  }
+
+  uint8_t access(uint8_t *p, int sock, int reg, uint8_t b) {
+    if (!writing)
+      return *p;
+    if (sock >= 0 && reg == 0x01)
+      command(sock, b);
+    else if (sock >= 0 && reg == 0x02)
+      sreg[sock][0x02] &= ~b; // Interrupt flags clear when written with 1
+    else if (p == &common[0] && (b & 0x80))
+      common[0] = 0; // Soft reset, done at once
+    else
+      *p = b;
+    return 0;
+  }
+
+  /// One byte each way. Frames in another chip's framing land somewhere
+  /// harmless, so detecting the other chips fails
+  uint8_t transfer(uint8_t b) {
+    int sock, reg;
+    bytes++;
+    if (MODEL_CHIP == 55) {
+      // Address, control byte, then data to consecutive addresses
+      if (pos < 3) {
+        header[pos++] = b;
+        addr = (header[0] << 8) | header[1];
+        block = header[2] >> 3;
+        writing = header[2] & 0x04;
+        return 0;
+      }
+      uint8_t *p = blockAddr(addr++, sock, reg);
+      return access(p, sock, reg, b);
+    }
+    if (MODEL_CHIP == 52) {
+      // Address, write flag and length, then data
+      if (pos < 4) {
+        header[pos++] = b;
+        addr = (header[0] << 8) | header[1];
+        writing = header[2] & 0x80;
+        return 0;
+      }
+      uint8_t *p = flat(addr++, sock, reg);
+      return access(p, sock, reg, b);
+    }
+    // W5100: opcode, address, then one data byte
+    if (pos < 3) {
+      header[pos++] = b;
+      return 0;
+    }
+    addr = (header[1] << 8) | header[2];
+    writing = header[0] == 0xF0;
+    uint8_t *p = flat(addr, sock, reg);
+    return access(p, sock, reg, b);
+  }
+};
+
+static Chip chip;
+
+void digitalWrite(uint8_t, uint8_t value) {
+  // The library only drives the chip select
+  chip.selected = !value;
+  if (chip.selected) {
+    chip.pos = 0;
+    chip.transactions++;
+  }
+}
+
+uint8_t spiTransfer(uint8_t b) { return chip.selected ? chip.transfer(b) : 0; }
+
+static const size_t kStreamSize = 16384;
+
+struct Count {
+  unsigned long transactions, bytes;
+};
+
+static Count count(void) { return {chip.transactions, chip.bytes}; }
+
+static void report(const char *what, Count start, size_t n) {
+  double kb = n / 1024.0;
+  printf("  %-38s %7.1f transactions/kB %7.0f SPI bytes/kB\n", what,
+         (chip.transactions - start.transactions) / kb,
+         (chip.bytes - start.bytes) / kb);
+}
+
+static std::vector<uint8_t> pattern(void) {
+  std::vector<uint8_t> v(kStreamSize);
+  for (size_t i = 0; i < v.size(); i++)
+    v[i] = i * 31 + 7;
+  return v;
+}
+
+static void testReceive(int mode) {
+  const char *names[3] = {"available() + read() per byte",
+                          "available() + peek() + read() per byte",
+                          "read(buf, 512)"};
+  std::vector<uint8_t> sent = pattern(), got;
+  EthernetClient client;
+  CHECK(client.connect(IPAddress(10, 0, 0, 1), 80) == 1, "connect()");
+  int s = client.getSocketNumber();
+  size_t injected = 0;
+  Count start = count();
+  while (got.size() < sent.size()) {
+    // The peer sends a segment whenever there is room
+    if (injected < sent.size())
+      injected += chip.inject(s, sent.data() + injected,
+                              std::min((size_t)1460, sent.size() - injected));
+    if (mode == 2) {
+      uint8_t buf[512];
+      int n = client.read(buf, sizeof(buf));
+      if (n > 0)
+        got.insert(got.end(), buf, buf + n);
+    } else if (client.available()) {
+      int p = mode ? client.peek() : -2;
+      int b = client.read();
+      CHECK(!mode || p == b, "peek() %d, read() %d", p, b);
+      if (b >= 0)
+        got.push_back(b);
+    }
+  }
+  CHECK(got == sent, "%s: the data differs", names[mode]);
+  report(names[mode], start, sent.size());
+  client.stop();
+}
+
+static void testIdle(void) {
+  EthernetClient client;
+  client.connect(IPAddress(10, 0, 0, 1), 80);
+  Count start = count();
+  for (int i = 0; i < 1000; i++)
+    CHECK(client.available() == 0, "available() with nothing received");
+  printf("  %-38s %7.1f transactions/call\n",
+         "available() with nothing received",
+         (chip.transactions - start.transactions) / 1000.0);
+
+  const uint8_t hello[5] = {'h', 'e', 'l', 'l', 'o'};
+  chip.inject(client.getSocketNumber(), hello, sizeof(hello));
+  CHECK(client.available() == 5, "available() %d after data arrived",
+        client.available());
+  char buf[8] = {0};
+  CHECK(client.read((uint8_t *)buf, sizeof(buf)) == 5 &&
+            !strcmp(buf, "hello"),
+        "read() after data arrived: \"%s\"", buf);
+  client.stop();
+}
+
+static void testSend(bool bytewise) {
+  std::vector<uint8_t> data = pattern();
+  size_t n = bytewise ? 2048 : data.size();
+  EthernetClient client;
+  client.connect(IPAddress(10, 0, 0, 1), 80);
+  int s = client.getSocketNumber();
+  Count start = count();
+  if (bytewise) {
+    for (size_t i = 0; i < n; i++)
+      client.write(data[i]);
+  } else {
+    for (size_t i = 0; i < n; i += 64)
+      client.write(data.data() + i, 64);
+  }
+  CHECK(chip.sent[s] == std::string(data.begin(), data.begin() + n),
+        "%s: the data sent differs", bytewise ? "write(byte)" : "write(buf)");
+  report(bytewise ? "write(byte)" : "write(buf, 64)", start, n);
+  client.stop();
+}
+
+int main(void) {
+  CHECK(W5100.init() && W5100.getChip() == MODEL_CHIP,
+        "detected chip %d, should be %d", W5100.getChip(), MODEL_CHIP);
+  printf("W5%d00\n", MODEL_CHIP % 10);
+
+  for (int mode = 0; mode < 3; mode++)
+    testReceive(mode);
+  testIdle();
+  testSend(true);
+  testSend(false);
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
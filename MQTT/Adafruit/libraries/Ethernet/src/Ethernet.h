@@ -39,6 +39,18 @@
 #define MAX_SOCK_NUM 8
 #endif
 
+// Received bytes are read from the WIZnet chip in bursts of up to this
+// many, and kept for each socket, so reading or peeking one byte at a
+// time doesn't cost an SPI transaction for every byte.  Uses this many
+// bytes of RAM per socket.
+#ifndef ETHERNET_RX_CACHE_SIZE
+#if defined(RAMEND) && defined(RAMSTART) && ((RAMEND - RAMSTART) <= 2048)
+#define ETHERNET_RX_CACHE_SIZE 16
+#else
+#define ETHERNET_RX_CACHE_SIZE 64
+#endif
+#endif
+
 // By default, each socket uses 2K buffers inside the WIZnet chip.  If
 // MAX_SOCK_NUM is set to fewer than the chip's maximum, uncommenting
 // this will use larger buffers within the WIZnet chip.  Large buffers
@@ -36,6 +36,9 @@ typedef struct {
 	uint16_t RX_RD;  // Address to read
 	uint16_t TX_FSR; // Free space ready for transmit
 	uint8_t  RX_inc; // how much have we advanced RX_RD
+	uint8_t  RX_head;   // next byte in RX_cache
+	uint8_t  RX_cached; // bytes in RX_cache, already taken from the chip
+	uint8_t  RX_cache[ETHERNET_RX_CACHE_SIZE];
 } socketstate_t;
 
 static socketstate_t state[MAX_SOCK_NUM];
@@ -43,6 +46,8 @@ static socketstate_t state[MAX_SOCK_NUM];
 
 static uint16_t getSnTX_FSR(uint8_t s);
 static uint16_t getSnRX_RSR(uint8_t s);
+static uint16_t refreshRX_RSR(uint8_t s);
+static void consume_data(uint8_t s, uint16_t len);
 static void write_data(uint8_t s, uint16_t offset, const uint8_t *data, uint16_t len);
 static void read_data(uint8_t s, uint16_t src, uint8_t *dst, uint16_t len);
 
@@ -117,6 +122,8 @@ makesocket:
 	state[s].RX_RSR = 0;
 	state[s].RX_RD  = W5100.readSnRX_RD(s); // always zero?
 	state[s].RX_inc = 0;
+	state[s].RX_head = 0;
+	state[s].RX_cached = 0;
 	state[s].TX_FSR = 0;
 	//Serial.printf("W5000socket prot=%d, RX_RD=%d\n", W5100.readSnMR(s), state[s].RX_RD);
 	SPI.endTransaction();
@@ -189,6 +196,8 @@ makesocket:
 	state[s].RX_RSR = 0;
 	state[s].RX_RD  = W5100.readSnRX_RD(s); // always zero?
 	state[s].RX_inc = 0;
+	state[s].RX_head = 0;
+	state[s].RX_cached = 0;
 	state[s].TX_FSR = 0;
 	//Serial.printf("W5000socket prot=%d, RX_RD=%d\n", W5100.readSnMR(s), state[s].RX_RD);
 	SPI.endTransaction();
@@ -279,6 +288,21 @@ static uint16_t getSnRX_RSR(uint8_t s)
 #endif
 }
 
+// The received size only changes when data arrives, which also sets the
+// RECV interrupt flag, so the count we have is re-read from the chip only
+// when that flag is set.  Costs one register read while nothing arrives.
+static uint16_t refreshRX_RSR(uint8_t s)
+{
+	if (W5100.readSnIR(s) & SnIR::RECV) {
+		// clear the flag first, so data arriving during the read sets it again
+		W5100.writeSnIR(s, SnIR::RECV);
+		uint16_t rsr = getSnRX_RSR(s);
+		state[s].RX_RSR = rsr - state[s].RX_inc;
+		//Serial.printf("refreshRX_RSR, RX_RSR=%d, RX_inc=%d\n", rsr, state[s].RX_inc);
+	}
+	return state[s].RX_RSR;
+}
+
 static void read_data(uint8_t s, uint16_t src, uint8_t *dst, uint16_t len)
 {
 	uint16_t size;
@@ -299,48 +323,85 @@ static void read_data(uint8_t s, uint16_t src, uint8_t *dst, uint16_t len)
 	}
 }
 
+// Move past len bytes which have been read from the chip, and let it
+// reuse the space once enough has been read
+static void consume_data(uint8_t s, uint16_t len)
+{
+	uint16_t ptr = state[s].RX_RD + len;
+	state[s].RX_RD = ptr;
+	state[s].RX_RSR -= len;
+	uint16_t inc = state[s].RX_inc + len;
+	if (inc >= 250 || state[s].RX_RSR == 0) {
+		state[s].RX_inc = 0;
+		W5100.writeSnRX_RD(s, ptr);
+		W5100.execCmdSn(s, Sock_RECV);
+		//Serial.printf("Sock_RECV cmd, RX_RD=%d, RX_RSR=%d\n",
+		//  state[s].RX_RD, state[s].RX_RSR);
+	} else {
+		state[s].RX_inc = inc;
+	}
+}
+
 // Receive data.  Returns size, or -1 for no data, or 0 if connection closed
 //
 int EthernetClass::socketRecv(uint8_t s, uint8_t *buf, int16_t len)
 {
+	int cached = 0;
+
+	// Bytes already read ahead come first, and need no SPI at all
+	if (state[s].RX_cached > 0 && len > 0) {
+		cached = state[s].RX_cached;
+		if (cached > len) cached = len;
+		if (buf) {
+			memcpy(buf, state[s].RX_cache + state[s].RX_head, cached);
+			buf += cached;
+		}
+		state[s].RX_head += cached;
+		state[s].RX_cached -= cached;
+		len -= cached;
+		if (len == 0) return cached;
+	}
+
 	// Check how much data is available
 	int ret = state[s].RX_RSR;
 	SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
 	if (ret < len) {
-		uint16_t rsr = getSnRX_RSR(s);
-		ret = rsr - state[s].RX_inc;
-		state[s].RX_RSR = ret;
-		//Serial.printf("Sock_RECV, RX_RSR=%d, RX_inc=%d\n", ret, state[s].RX_inc);
+		ret = refreshRX_RSR(s);
 	}
 	if (ret == 0) {
-		// No data available.
-		uint8_t status = W5100.readSnSR(s);
-		if ( status == SnSR::LISTEN || status == SnSR::CLOSED ||
-		  status == SnSR::CLOSE_WAIT ) {
-			// The remote end has closed its side of the connection,
-			// so this is the eof state
-			ret = 0;
+		if (cached > 0) {
+			// No more yet, but there were cached bytes to return
+			ret = cached;
 		} else {
-			// The connection is still up, but there's no data waiting to be read
-			ret = -1;
+			// No data available.
+			uint8_t status = W5100.readSnSR(s);
+			if ( status == SnSR::LISTEN || status == SnSR::CLOSED ||
+			  status == SnSR::CLOSE_WAIT ) {
+				// The remote end has closed its side of the connection,
+				// so this is the eof state
+				ret = 0;
+			} else {
+				// The connection is still up, but there's no data waiting to be read
+				ret = -1;
+			}
 		}
+	} else if (buf && len < ETHERNET_RX_CACHE_SIZE) {
+		// A short read, fill the cache in the same burst and return
+		// the first part of it
+		uint16_t fill = ret;
+		if (fill > ETHERNET_RX_CACHE_SIZE) fill = ETHERNET_RX_CACHE_SIZE;
+		read_data(s, state[s].RX_RD, state[s].RX_cache, fill);
+		consume_data(s, fill);
+		if (ret > len) ret = len;
+		memcpy(buf, state[s].RX_cache, ret);
+		state[s].RX_head = ret;
+		state[s].RX_cached = fill - ret;
+		ret += cached;
 	} else {
 		if (ret > len) ret = len; // more data available than buffer length
-		uint16_t ptr = state[s].RX_RD;
-		if (buf) read_data(s, ptr, buf, ret);
-		ptr += ret;
-		state[s].RX_RD = ptr;
-		state[s].RX_RSR -= ret;
-		uint16_t inc = state[s].RX_inc + ret;
-		if (inc >= 250 || state[s].RX_RSR == 0) {
-			state[s].RX_inc = 0;
-			W5100.writeSnRX_RD(s, ptr);
-			W5100.execCmdSn(s, Sock_RECV);
-			//Serial.printf("Sock_RECV cmd, RX_RD=%d, RX_RSR=%d\n",
-			//  state[s].RX_RD, state[s].RX_RSR);
-		} else {
-			state[s].RX_inc = inc;
-		}
+		if (buf) read_data(s, state[s].RX_RD, buf, ret);
+		consume_data(s, ret);
+		ret += cached;
 	}
 	SPI.endTransaction();
 	//Serial.printf("socketRecv, ret=%d\n", ret);
@@ -350,27 +411,37 @@ int EthernetClass::socketRecv(uint8_t s, uint8_t *buf, int16_t len)
 uint16_t EthernetClass::socketRecvAvailable(uint8_t s)
 {
 	uint16_t ret = state[s].RX_RSR;
-	if (ret == 0) {
+	if (ret == 0 && state[s].RX_cached == 0) {
 		SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
-		uint16_t rsr = getSnRX_RSR(s);
+		ret = refreshRX_RSR(s);
 		SPI.endTransaction();
-		ret = rsr - state[s].RX_inc;
-		state[s].RX_RSR = ret;
 		//Serial.printf("sockRecvAvailable s=%d, RX_RSR=%d\n", s, ret);
 	}
-	return ret;
+	return ret + state[s].RX_cached;
 }
 
 // get the first byte in the receive queue (no checking)
 //
 uint8_t EthernetClass::socketPeek(uint8_t s)
 {
-	uint8_t b;
-	SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
-	uint16_t ptr = state[s].RX_RD;
-	W5100.read((ptr & W5100.SMASK) + W5100.RBASE(s), &b, 1);
-	SPI.endTransaction();
-	return b;
+	if (state[s].RX_cached == 0) {
+		// read ahead, so the byte peeked at and those after it are
+		// ready for the reads which usually follow
+		uint16_t fill = state[s].RX_RSR;
+		if (fill > ETHERNET_RX_CACHE_SIZE) fill = ETHERNET_RX_CACHE_SIZE;
+		if (fill == 0) fill = 1; // no checking, as before
+		SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
+		read_data(s, state[s].RX_RD, state[s].RX_cache, fill);
+		if (state[s].RX_RSR == 0) {
+			SPI.endTransaction();
+			return state[s].RX_cache[0];
+		}
+		consume_data(s, fill);
+		SPI.endTransaction();
+		state[s].RX_head = 0;
+		state[s].RX_cached = fill;
+	}
+	return state[s].RX_cache[state[s].RX_head];
 }
 
 
@@ -431,10 +502,13 @@ uint16_t EthernetClass::socketSend(uint8_t s, const uint8_t * buf, uint16_t len)
 		ret = len;
 	}
 
-	// if freebuf is available, start.
+	// if freebuf is available, start.  The free size only grows as the
+	// chip sends data, so the last one read is asked for again only when
+	// it's too small
 	do {
 		SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
-		freesize = getSnTX_FSR(s);
+		freesize = state[s].TX_FSR;
+		if (freesize < ret) freesize = getSnTX_FSR(s);
 		status = W5100.readSnSR(s);
 		SPI.endTransaction();
 		if ((status != SnSR::ESTABLISHED) && (status != SnSR::CLOSE_WAIT)) {
@@ -447,6 +521,7 @@ uint16_t EthernetClass::socketSend(uint8_t s, const uint8_t * buf, uint16_t len)
 	// copy data
 	SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
 	write_data(s, 0, (uint8_t *)buf, ret);
+	state[s].TX_FSR -= ret;
 	W5100.execCmdSn(s, Sock_SEND);
 
 	/* +2008.01 bj */
@@ -316,9 +316,12 @@ uint16_t W5100Class::write(uint16_t addr, const uint8_t *buf, uint16_t len)
 #ifdef SPI_HAS_TRANSFER_BUF
 		SPI.transfer(buf, NULL, len);
 #else
-		// TODO: copy 8 bytes at a time to cmd[] and block transfer
-		for (uint16_t i=0; i < len; i++) {
-			SPI.transfer(buf[i]);
+		// SPI.transfer(buf, len) overwrites buf, so copy 8 bytes
+		// at a time to cmd[] and block transfer those
+		for (uint16_t i=0; i < len; i += 8) {
+			uint8_t n = (len - i < 8) ? len - i : 8;
+			memcpy(cmd, buf + i, n);
+			SPI.transfer(cmd, n);
 		}
 #endif
 		resetSS();
@@ -372,9 +375,12 @@ uint16_t W5100Class::write(uint16_t addr, const uint8_t *buf, uint16_t len)
 #ifdef SPI_HAS_TRANSFER_BUF
 			SPI.transfer(buf, NULL, len);
 #else
-			// TODO: copy 8 bytes at a time to cmd[] and block transfer
-			for (uint16_t i=0; i < len; i++) {
-				SPI.transfer(buf[i]);
+			// SPI.transfer(buf, len) overwrites buf, so copy 8 bytes
+			// at a time to cmd[] and block transfer those
+			for (uint16_t i=0; i < len; i += 8) {
+				uint8_t n = (len - i < 8) ? len - i : 8;
+				memcpy(cmd, buf + i, n);
+				SPI.transfer(cmd, n);
 			}
 #endif
 		}
@@ -2,12 +2,19 @@
 
 #include "LiquidCrystal_I2C.h"
 #include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
 #if defined(ARDUINO) && ARDUINO >= 100
 
 #include "Arduino.h"
 
 #define printIIC(args)	Wire.write(args)
 inline size_t LiquidCrystal_I2C::write(uint8_t value) {
+	if (_shadow) {
+		if (_shadowCol < _cols)		// the rest of a long line is dropped
+			_shadow[_shadowRow * _cols + _shadowCol++] = value;
+		return 1;
+	}
 	send(value, Rs);
 	return 1;
 }
@@ -17,6 +24,11 @@ inline size_t LiquidCrystal_I2C::write(uint8_t value) {
 
 #define printIIC(args)	Wire.send(args)
 inline void LiquidCrystal_I2C::write(uint8_t value) {
+	if (_shadow) {
+		if (_shadowCol < _cols)		// the rest of a long line is dropped
+			_shadow[_shadowRow * _cols + _shadowCol++] = value;
+		return;
+	}
 	send(value, Rs);
 }
 
@@ -50,6 +62,16 @@ LiquidCrystal_I2C::LiquidCrystal_I2C(uint8_t lcd_Addr,uint8_t lcd_cols,uint8_t l
   _cols = lcd_cols;
   _rows = lcd_rows;
   _backlightval = LCD_NOBACKLIGHT;
+  _queued = 0;
+  _shadow = NULL;
+  _glass = NULL;
+  _shadowCol = 0;
+  _shadowRow = 0;
+}
+
+LiquidCrystal_I2C::~LiquidCrystal_I2C()
+{
+  free(_shadow);		// _glass is the second half of the same block
 }
 
 void LiquidCrystal_I2C::init(){
@@ -125,17 +147,33 @@ void LiquidCrystal_I2C::begin(uint8_t cols, uint8_t lines, uint8_t dotsize) {
 
 /********** high level commands, for the user! */
 void LiquidCrystal_I2C::clear(){
+	if (_shadow) {			// only the RAM copy, flush() sends the difference
+		memset(_shadow, ' ', _cols * _rows);
+		_shadowCol = 0;
+		_shadowRow = 0;
+		return;
+	}
 	command(LCD_CLEARDISPLAY);// clear display, set cursor position to zero
 	delayMicroseconds(2000);  // this command takes a long time!
 }
 
 void LiquidCrystal_I2C::home(){
+	if (_shadow) {
+		_shadowCol = 0;
+		_shadowRow = 0;
+		return;
+	}
 	command(LCD_RETURNHOME);  // set cursor position to zero
 	delayMicroseconds(2000);  // this command takes a long time!
 }
 
 void LiquidCrystal_I2C::setCursor(uint8_t col, uint8_t row){
 	int row_offsets[] = { 0x00, 0x40, 0x14, 0x54 };
+	if (_shadow) {
+		_shadowCol = col;
+		_shadowRow = (row < _rows) ? row : _rows - 1;
+		return;
+	}
 	if ( row > _numlines ) {
 		row = _numlines-1;    // we count rows starting w/0
 	}
@@ -210,7 +248,7 @@ void LiquidCrystal_I2C::createChar(uint8_t location, uint8_t charmap[]) {
 	location &= 0x7; // we only have 8 locations 0-7
 	command(LCD_SETCGRAMADDR | (location << 3));
 	for (int i=0; i<8; i++) {
-		write(charmap[i]);
+		send(charmap[i], Rs);		// not write(), that goes to the shadow buffer
 	}
 }
 
@@ -227,6 +265,72 @@ void LiquidCrystal_I2C::backlight(void) {
 
 
 
+/*********** shadow buffer */
+
+// In shadow mode, print(), write(), setCursor(), clear() and home() only
+// change a copy of the screen in RAM, so a whole screen can be rebuilt
+// (clear() included) without touching the bus. flush() then compares it
+// with what was last sent and rewrites only the cells that differ. The
+// LCD's own shifting and right-to-left modes are not modelled.
+bool LiquidCrystal_I2C::enableShadow(){
+	if (_shadow) {
+		return true;
+	}
+	_shadow = (uint8_t *)malloc(2 * _cols * _rows);
+	if (!_shadow) {
+		return false;
+	}
+	_glass = _shadow + _cols * _rows;
+	memset(_shadow, ' ', 2 * _cols * _rows);
+	_shadowCol = 0;
+	_shadowRow = 0;
+	command(LCD_CLEARDISPLAY);	// start from a known, blank screen
+	delayMicroseconds(2000);
+	return true;
+}
+
+void LiquidCrystal_I2C::disableShadow(){
+	if (_shadow) {
+		flush();
+		free(_shadow);
+		_shadow = NULL;
+		_glass = NULL;
+	}
+}
+
+void LiquidCrystal_I2C::flush(){
+	if (!_shadow) {
+		return;
+	}
+	int row_offsets[] = { 0x00, 0x40, 0x14, 0x54 };
+	for (uint8_t row = 0; row < _rows; row++) {
+		uint8_t *want = &_shadow[row * _cols];
+		uint8_t *have = &_glass[row * _cols];
+		uint8_t col = 0;
+		while (col < _cols) {
+			if (want[col] == have[col]) {
+				col++;
+				continue;
+			}
+			// A run of changed cells. One unchanged cell inside the run is
+			// sent again, it costs the same as a new address.
+			queueSend(LCD_SETDDRAMADDR | (col + row_offsets[row]), 0);
+			while ((col < _cols) && ((want[col] != have[col]) ||
+			       ((col + 1 < _cols) && (want[col + 1] != have[col + 1])))) {
+				queueSend(want[col], Rs);
+				have[col] = want[col];
+				col++;
+			}
+		}
+	}
+	if ((_displaycontrol & (LCD_CURSORON | LCD_BLINKON)) && (_shadowCol < _cols)) {
+		// leave the visible cursor where the sketch left the print position
+		queueSend(LCD_SETDDRAMADDR | (_shadowCol + row_offsets[_shadowRow]), 0);
+	}
+	endQueue();
+}
+
+
 /*********** mid level commands, for sending data/cmds */
 
 inline void LiquidCrystal_I2C::command(uint8_t value) {
@@ -236,17 +340,22 @@ inline void LiquidCrystal_I2C::command(uint8_t value) {
 
 /************ low level data pushing commands **********/
 
-// write either command or data
+// write either command or data, in a single I2C transaction
 void LiquidCrystal_I2C::send(uint8_t value, uint8_t mode) {
+	queueSend(value, mode);
+	endQueue();
+}
+
+void LiquidCrystal_I2C::queueSend(uint8_t value, uint8_t mode) {
 	uint8_t highnib=value&0xf0;
 	uint8_t lownib=(value<<4)&0xf0;
-       write4bits((highnib)|mode);
-	write4bits((lownib)|mode); 
+	queueNibble((highnib)|mode);
+	queueNibble((lownib)|mode);
 }
 
 void LiquidCrystal_I2C::write4bits(uint8_t value) {
-	expanderWrite(value);
-	pulseEnable(value);
+	queueNibble(value);
+	endQueue();
 }
 
 void LiquidCrystal_I2C::expanderWrite(uint8_t _data){                                        
@@ -255,13 +364,30 @@ void LiquidCrystal_I2C::expanderWrite(uint8_t _data){
 	Wire.endTransmission();   
 }
 
-void LiquidCrystal_I2C::pulseEnable(uint8_t _data){
-	expanderWrite(_data | En);	// En high
-	delayMicroseconds(1);		// enable pulse must be >450ns
-	
-	expanderWrite(_data & ~En);	// En low
-	delayMicroseconds(50);		// commands need > 37us to settle
-} 
+// Adds the three expander states that clock one nibble into the LCD (data
+// set up, En high, En low) to the open I2C transaction, opening one if
+// needed. The PCF8574 updates its pins after every byte, and a byte takes
+// 90us at 100kHz (22us at 400kHz): enough for the >450ns enable pulse, and
+// the two bytes before the next En high cover the >37us commands need.
+void LiquidCrystal_I2C::queueNibble(uint8_t value){
+	if (_queued + 3 > LCD_I2C_BATCH) {
+		endQueue();
+	}
+	if (!_queued) {
+		Wire.beginTransmission(_Addr);
+	}
+	printIIC((int)(value) | _backlightval);
+	printIIC((int)(value | En) | _backlightval);	// En high
+	printIIC((int)(value & ~En) | _backlightval);	// En low
+	_queued += 3;
+}
+
+void LiquidCrystal_I2C::endQueue(){
+	if (_queued) {
+		Wire.endTransmission();
+		_queued = 0;
+	}
+}
 
 
 // Alias functions
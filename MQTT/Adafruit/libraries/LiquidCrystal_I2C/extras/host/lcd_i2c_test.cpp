@@ -0,0 +1,107 @@
+// Host test of LiquidCrystal_I2C against a fake TwoWire feeding a PCF8574 +
+// HD44780 model (stub/Wire.h).
+//
+// - The workload is TaskTemperatureHumidity from HiveMQ.ino: clear() and
+//   two printed lines every 5 s, with realistic readings. After every
+//   update the LCD memory must show both lines, and no instruction may be
+//   started while the LCD is still busy, at 100 and 400 kHz.
+// - In shadow mode, a flush() with nothing changed sends nothing.
+// - The shadow buffer is freed by the destructor (the build uses
+//   LeakSanitizer) and the class cannot be copied.
+// Then prints the I2C transactions, bytes and bus time per update, printing
+// directly and with the shadow buffer.
+#include "LiquidCrystal_I2C.h"
+
+#include <type_traits>
+
+double simTime = 0;
+TwoWire Wire;
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static_assert(!std::is_copy_constructible<LiquidCrystal_I2C>::value,
+              "LiquidCrystal_I2C owns its shadow buffer");
+static_assert(!std::is_copy_assignable<LiquidCrystal_I2C>::value,
+              "LiquidCrystal_I2C owns its shadow buffer");
+
+static const float temps[] = {23.5, 23.5, 23.6, 23.6, 23.8,
+                              24.1, 24.1, 23.9, 23.9, 23.9};
+static const float hums[] = {41.2, 41.2, 41.3, 41.9, 42.0,
+                             42.0, 41.7, 41.7, 41.5, 41.5};
+
+static void update(LiquidCrystal_I2C &lcd, float t, float h, bool shadow) {
+  lcd.clear();
+  lcd.setCursor(0, 0);
+  lcd.print("Nhiet Do: ");
+  lcd.print(t);
+  lcd.setCursor(0, 1);
+  lcd.print("Do Am: ");
+  lcd.print(h);
+  if (shadow)
+    lcd.flush();
+}
+
+static void run(double kHz, bool shadow) {
+  Wire = TwoWire();
+  Wire.byteUs = 9e3 / kHz;
+  LiquidCrystal_I2C lcd(0x27, 16, 2);
+  lcd.init();
+  lcd.backlight();
+  if (shadow)
+    CHECK(lcd.enableShadow(), "enableShadow");
+
+  unsigned long transactions = Wire.transactions, bytes = Wire.bytes;
+  double start = simTime;
+  for (int i = 0; i < 10; i++) {
+    update(lcd, temps[i], hums[i], shadow);
+    char l0[40], l1[40];
+    snprintf(l0, sizeof(l0), "Nhiet Do: %.2f            ", temps[i]);
+    snprintf(l1, sizeof(l1), "Do Am: %.2f            ", hums[i]);
+    if (Wire.lcd.row(0, 16) != std::string(l0, 16) ||
+        Wire.lcd.row(1, 16) != std::string(l1, 16)) {
+      CHECK(false, "%.0f kHz %s, update %d: [%s] [%s]", kHz,
+            shadow ? "shadow" : "direct", i, Wire.lcd.row(0, 16).c_str(),
+            Wire.lcd.row(1, 16).c_str());
+      return;
+    }
+  }
+  CHECK(!Wire.lcd.violations, "%.0f kHz %s: %lu instructions while busy", kHz,
+        shadow ? "shadow" : "direct", Wire.lcd.violations);
+  printf("  %3.0f kHz %-8s %5.1f transactions %6.1f bytes %7.0f us\n", kHz,
+         shadow ? "shadow" : "direct", (Wire.transactions - transactions) / 10.0,
+         (Wire.bytes - bytes) / 10.0, (simTime - start) / 10);
+
+  if (shadow) {
+    transactions = Wire.transactions;
+    update(lcd, temps[9], hums[9], true);
+    CHECK(Wire.transactions == transactions,
+          "flush() with nothing changed sent %lu transactions",
+          Wire.transactions - transactions);
+  }
+}
+
+int main(void) {
+  printf("HiveMQ LCD update, per update\n");
+  run(100, false);
+  run(100, true);
+  run(400, false);
+  run(400, true);
+
+  // Left enabled: the destructor must free the shadow buffer
+  LiquidCrystal_I2C *lcd = new LiquidCrystal_I2C(0x27, 20, 4);
+  lcd->init();
+  CHECK(lcd->enableShadow(), "enableShadow 20x4");
+  delete lcd;
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
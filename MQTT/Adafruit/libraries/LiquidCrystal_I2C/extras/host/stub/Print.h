@@ -0,0 +1,26 @@
+#ifndef _HOST_PRINT_H
+#define _HOST_PRINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual void flush() {}
+  size_t print(const char *s) {
+    size_t n = 0;
+    while (*s)
+      n += write(*s++);
+    return n;
+  }
+  size_t print(double v, int digits = 2) {
+    char b[32];
+    snprintf(b, sizeof(b), "%.*f", digits, v);
+    return print(b);
+  }
+};
+
+#endif
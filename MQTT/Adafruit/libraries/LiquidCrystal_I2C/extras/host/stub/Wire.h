@@ -0,0 +1,96 @@
+#ifndef _HOST_WIRE_H
+#define _HOST_WIRE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+
+extern double simTime;
+
+/// A PCF8574 expander wired to an HD44780 in 4-bit mode, the usual I2C
+/// backpack: P0 RS, P1 RW, P2 En, P3 backlight, P4-P7 D4-D7. The LCD
+/// latches a nibble on the falling edge of En. Raising En while the LCD is
+/// still busy with the previous instruction is counted as a violation.
+struct HD44780 {
+  bool eightBit = true, half = false;
+  uint8_t high = 0, pins = 0, addr = 0;
+  uint8_t ddram[128];
+  double busyUntil = 0;
+  unsigned long violations = 0;
+
+  HD44780() { memset(ddram, ' ', sizeof(ddram)); }
+
+  void execute(uint8_t v, bool rs, double t) {
+    double busy = 37;
+    if (rs)
+      ddram[addr++ & 0x7F] = v;
+    else if (v == 0x01) { // clear display
+      memset(ddram, ' ', sizeof(ddram));
+      addr = 0;
+      busy = 1520;
+    } else if ((v & 0xFE) == 0x02) { // return home
+      addr = 0;
+      busy = 1520;
+    } else if (v & 0x80) // set DDRAM address
+      addr = v & 0x7F;
+    else if ((v & 0xE0) == 0x20) // function set
+      eightBit = v & 0x10;
+    busyUntil = t + busy;
+  }
+
+  /// The expander pins change, at virtual time t
+  void setPins(uint8_t p, double t) {
+    bool en = p & 4, wasEn = pins & 4;
+    if (en && !wasEn && t < busyUntil)
+      violations++;
+    if (!en && wasEn) {
+      uint8_t nibble = p & 0xF0;
+      if (eightBit)
+        execute(nibble, p & 1, t);
+      else if (!half) {
+        high = nibble;
+        half = true;
+      } else {
+        half = false;
+        execute(high | nibble >> 4, p & 1, t);
+      }
+    }
+    pins = p;
+  }
+
+  std::string row(int r, int cols) {
+    static const int offsets[] = {0x00, 0x40, 0x14, 0x54};
+    return std::string((const char *)&ddram[offsets[r]], cols);
+  }
+};
+
+/// TwoWire counting transactions and bytes, and taking 9 bit times of
+/// virtual time per byte on the bus. Every byte written goes to the
+/// expander, which updates its pins after each byte.
+class TwoWire {
+public:
+  double byteUs = 90; ///< 9 clocks at 100 kHz
+  unsigned long transactions = 0, bytes = 0;
+  HD44780 lcd;
+
+  void begin() {}
+  void beginTransmission(uint8_t) {
+    transactions++;
+    simTime += 2 * byteUs; // start and address
+  }
+  size_t write(uint8_t b) {
+    bytes++;
+    simTime += byteUs;
+    lcd.setPins(b, simTime);
+    return 1;
+  }
+  uint8_t endTransmission() {
+    simTime += byteUs / 9; // stop
+    return 0;
+  }
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,379 @@
+// Host test of WiFiClient and WiFiSocket against a model of the WINC1500
+// host interface (HIF): the socket API calls and hif_receive() the socket
+// layer makes, and the events m2m_wifi_handle_events() delivers. Time is
+// virtual. Every HIF operation advances the clock by a cost model of 12 MHz
+// SPI plus a per-command overhead, and the firmware answers a recv() after
+// a fixed latency. Rates are on that clock.
+//
+// - 256 kB received come out intact through available() + read(), read()
+//   and read(buf, 512).
+// - 64 kB sent with write(buf, n) for n from 1 to 1400 reach the socket
+//   intact once flush() is called.
+// - Requests print()ed piecewise go out before the reply is waited for.
+// - A write longer than one send() is sent whole.
+// - A peer close while data is still buffered does not lose the data, and
+//   connected() turns false after it has been read.
+// Then prints bytes/sec for each, with recv commands and events per kB
+// received and send() calls per kB sent.
+extern "C" {
+#include "driver/source/m2m_hif.h"
+#include "socket/include/socket.h"
+}
+#include <WiFi101.h>
+
+#include <stdio.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "utility/WiFiSocket.h"
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+double hostMicros = 0;
+
+// Cost model, in microseconds
+static const double kSPIByte = 8.0 / 12.0; // 12 MHz SPI
+static const double kRegister = 10.0;      // One register read or write
+static const double kCommand = 6 * kRegister; // hif_send() handshake
+// hif_isr(): the interrupt, the header and the reply
+static const double kEvent = 3 * kRegister + 2 * (kRegister + 16 * kSPIByte);
+static const double kRecvLatency = 150.0; // recv() to its RECV event
+static const double kIdlePoll = 0.5; // m2m_wifi_handle_events() with no event
+static const double kCall = 1.0;     // Host side of a client API call
+
+static struct {
+  unsigned long commands, events;
+} hif;
+
+/// A socket on the chip
+struct Socket {
+  bool used = false, recvPending = false, connectPending = false;
+  double readyAt = 0;
+  std::deque<uint8_t> incoming; // Sent by the peer, still in the chip
+  std::string sent;
+  unsigned long sends = 0;
+};
+
+static Socket sockets[MAX_SOCKET];
+
+// The received data the HIF is blocked on until it has been read
+static uint32 chunkAddr = 0;
+static std::vector<uint8_t> chunk;
+
+extern "C" {
+volatile uint8 hif_receive_blocked = 0;
+uint32 nmdrv_firm_ver = 0;
+
+SOCKET socket(uint16, uint8 type, uint8) {
+  int first = type == SOCK_STREAM ? 0 : TCP_SOCK_MAX;
+  int last = type == SOCK_STREAM ? TCP_SOCK_MAX : MAX_SOCKET;
+  for (int i = first; i < last; i++) {
+    if (!sockets[i].used) {
+      sockets[i] = Socket();
+      sockets[i].used = true;
+      return i;
+    }
+  }
+  return -1;
+}
+
+sint8 bind(SOCKET, struct sockaddr *, uint8) { return -1; }
+sint8 listen(SOCKET, uint8) { return -1; }
+
+sint8 connect(SOCKET s, struct sockaddr *, uint8) {
+  hostMicros += kCommand;
+  hif.commands++;
+  sockets[s].connectPending = true;
+  return 0;
+}
+
+sint16 recv(SOCKET s, void *, uint16, uint32) {
+  // The firmware takes one recv() at a time
+  if (!sockets[s].recvPending) {
+    sockets[s].recvPending = true;
+    sockets[s].readyAt = hostMicros + kCommand + kRecvLatency;
+    hostMicros += kCommand;
+    hif.commands++;
+  }
+  return 0;
+}
+
+sint16 recvfrom(SOCKET s, void *buf, uint16 n, uint32 timeout) {
+  return recv(s, buf, n, timeout);
+}
+
+sint16 send(SOCKET s, void *buf, uint16 n, uint16) {
+  if (!sockets[s].used || n > SOCKET_BUFFER_MAX_LENGTH || !buf)
+    return SOCK_ERR_INVALID_ARG;
+  hostMicros += kCommand + kRegister + n * kSPIByte;
+  hif.commands++;
+  sockets[s].sent.append((const char *)buf, n);
+  sockets[s].sends++;
+  return 0;
+}
+
+sint16 sendto(SOCKET s, void *buf, uint16 n, uint16 flags, struct sockaddr *,
+              uint8) {
+  return send(s, buf, n, flags);
+}
+
+sint8 close(SOCKET s) {
+  hostMicros += kCommand;
+  hif.commands++;
+  sockets[s].used = false;
+  return 0;
+}
+
+sint8 setsockopt(SOCKET, uint8, uint8, const void *, uint16) { return 0; }
+
+sint8 m2m_periph_gpio_set_val(uint8, uint8) {
+  hostMicros += kRegister;
+  return 0;
+}
+
+uint16 m2m_strlen(uint8 *s) { return strlen((char *)s); }
+
+sint8 hif_receive(uint32 addr, uint8 *buf, uint16 n, uint8 done) {
+  if (!addr && !buf) {
+    // Skip the rest of the chunk
+    hostMicros += 2 * kRegister;
+    hif_receive_blocked = 0;
+    chunk.clear();
+    return 0;
+  }
+  if (addr < chunkAddr || addr + n > chunkAddr + chunk.size()) {
+    printf("hif_receive() outside the received data\n");
+    return -1;
+  }
+  memcpy(buf, chunk.data() + (addr - chunkAddr), n);
+  hostMicros += kRegister + n * kSPIByte;
+  if (done) {
+    hostMicros += 2 * kRegister;
+    hif_receive_blocked = 0;
+  }
+  return 0;
+}
+
+sint8 m2m_wifi_handle_events(void *) {
+  hostMicros += kIdlePoll;
+  if (hif_receive_blocked)
+    return 0;
+  for (int s = 0; s < MAX_SOCKET; s++) {
+    Socket &k = sockets[s];
+    if (!k.used)
+      continue;
+    if (k.connectPending) {
+      k.connectPending = false;
+      hostMicros += kEvent;
+      hif.events++;
+      tstrSocketConnectMsg m;
+      m.sock = s;
+      m.s8Error = 0;
+      WiFiSocketClass::eventCallback(s, SOCKET_MSG_CONNECT, &m);
+      return 0;
+    }
+    if (k.recvPending && hostMicros >= k.readyAt && !k.incoming.empty()) {
+      k.recvPending = false;
+      hostMicros += kEvent;
+      hif.events++;
+      size_t n = std::min(k.incoming.size(), (size_t)SOCKET_BUFFER_MAX_LENGTH);
+      chunk.assign(k.incoming.begin(), k.incoming.begin() + n);
+      k.incoming.erase(k.incoming.begin(), k.incoming.begin() + n);
+      chunkAddr = 0x10000 + s * 0x1000;
+      hif_receive_blocked = 1;
+      tstrSocketRecvMsg m;
+      memset(&m, 0, sizeof(m));
+      m.s16BufferSize = n;
+      m.pu8Buffer = chunkAddr;
+      WiFiSocketClass::eventCallback(s, SOCKET_MSG_RECV, &m);
+      return 0;
+    }
+  }
+  return 0;
+}
+}
+
+// WiFiClient resolves host names through WiFi
+WiFiClass::WiFiClass() {}
+int WiFiClass::hostByName(const char *, IPAddress &result) {
+  result = IPAddress(10, 0, 0, 1);
+  return 1;
+}
+WiFiClass WiFi;
+
+static void reset(void) {
+  for (Socket &k : sockets)
+    k = Socket();
+  hif_receive_blocked = 0;
+  chunk.clear();
+}
+
+static std::vector<uint8_t> pattern(size_t n) {
+  std::vector<uint8_t> v(n);
+  for (size_t i = 0; i < n; i++)
+    v[i] = i * 31 + 7;
+  return v;
+}
+
+static void testReceive(int mode) {
+  const char *names[3] = {"available() + read() per byte", "read() per byte",
+                          "read(buf, 512)"};
+  const size_t n = 256 * 1024;
+  reset();
+  std::vector<uint8_t> sent = pattern(n), got;
+  WiFiClient client;
+  CHECK(client.connect(IPAddress(10, 0, 0, 1), 80) == 1, "connect()");
+  sockets[0].incoming.assign(sent.begin(), sent.end());
+  double start = hostMicros;
+  unsigned long commands = hif.commands, events = hif.events;
+  for (unsigned long spins = 0; got.size() < n && spins < 100000000; spins++) {
+    hostMicros += kCall;
+    if (mode == 0) {
+      if (client.available()) {
+        hostMicros += kCall;
+        int b = client.read();
+        if (b >= 0)
+          got.push_back(b);
+      }
+    } else if (mode == 1) {
+      int b = client.read();
+      if (b >= 0)
+        got.push_back(b);
+    } else {
+      uint8_t buf[512];
+      int k = client.read(buf, sizeof(buf));
+      if (k > 0)
+        got.insert(got.end(), buf, buf + k);
+    }
+  }
+  double secs = (hostMicros - start) / 1e6;
+  CHECK(got == sent, "%s: %zu bytes, the data differs", names[mode],
+        got.size());
+  printf("  %-30s %8.0f bytes/s %5.2f recv()s/kB %5.2f events/kB\n",
+         names[mode], n / secs, (hif.commands - commands) * 1024.0 / n,
+         (hif.events - events) * 1024.0 / n);
+  client.stop();
+}
+
+static void testSend(size_t piece) {
+  reset();
+  std::vector<uint8_t> data = pattern(64 * 1024);
+  WiFiClient client;
+  client.connect(IPAddress(10, 0, 0, 1), 80);
+  double start = hostMicros;
+  for (size_t i = 0; i < data.size(); i += piece) {
+    size_t k = std::min(piece, data.size() - i);
+    hostMicros += kCall;
+    CHECK(client.write(data.data() + i, k) == k, "write() at %zu", i);
+  }
+  client.flush();
+  double secs = (hostMicros - start) / 1e6;
+  CHECK(sockets[0].sent == std::string(data.begin(), data.end()),
+        "write(buf, %zu): %zu bytes sent, the data differs", piece,
+        sockets[0].sent.size());
+  printf("  write(buf, %4zu)               %8.0f bytes/s %6.1f send()s/kB\n",
+         piece, data.size() / secs, sockets[0].sends * 1024.0 / data.size());
+  client.stop();
+}
+
+static void testRequestReply(void) {
+  const int requests = 500;
+  const std::string reply = "HTTP/1.1 200 OK\r\n\r\n42";
+  reset();
+  WiFiClient client;
+  client.connect(IPAddress(10, 0, 0, 1), 80);
+  Socket &k = sockets[0];
+  double start = hostMicros;
+  for (int i = 0; i < requests; i++) {
+    client.print("GET /sensor/");
+    client.print(i);
+    client.println(" HTTP/1.1");
+    client.println("Host: example");
+    client.println();
+    // The peer only answers a whole request
+    bool answered = false;
+    std::string got;
+    for (unsigned long spins = 0; got.size() < reply.size() && spins < 1000000;
+         spins++) {
+      if (!answered && k.sent.size() >= 4 &&
+          !k.sent.compare(k.sent.size() - 4, 4, "\r\n\r\n")) {
+        k.incoming.insert(k.incoming.end(), reply.begin(), reply.end());
+        answered = true;
+      }
+      while (client.available())
+        got.push_back(client.read());
+    }
+    CHECK(got == reply, "reply to request %d: \"%s\"", i, got.c_str());
+  }
+  double secs = (hostMicros - start) / 1e6;
+  printf("  print()ed request + reply      %8.1f round trips/s %5.1f "
+         "send()s/request\n",
+         requests / secs, (double)k.sends / requests);
+  client.stop();
+}
+
+static void testLongWrite(void) {
+  reset();
+  std::vector<uint8_t> data = pattern(5000);
+  WiFiClient client;
+  client.connect(IPAddress(10, 0, 0, 1), 80);
+  size_t n = client.write(data.data(), data.size());
+  client.flush();
+  CHECK(n == data.size() &&
+            sockets[0].sent == std::string(data.begin(), data.end()),
+        "write(buf, 5000) returned %zu, %zu bytes sent", n,
+        sockets[0].sent.size());
+  client.stop();
+}
+
+static void testCloseWhileBuffered(void) {
+  reset();
+  std::vector<uint8_t> sent = pattern(3000), got;
+  WiFiClient client;
+  client.connect(IPAddress(10, 0, 0, 1), 80);
+  Socket &k = sockets[0];
+  k.incoming.assign(sent.begin(), sent.end());
+  for (unsigned long spins = 0;
+       spins < 2000000 && (client.connected() || client.available());
+       spins++) {
+    int b = client.read();
+    if (b >= 0)
+      got.push_back(b);
+    // Once everything has gone, answer the next recv() with the close
+    if (k.incoming.empty() && k.recvPending && hostMicros >= k.readyAt) {
+      k.recvPending = false;
+      tstrSocketRecvMsg m;
+      memset(&m, 0, sizeof(m));
+      WiFiSocketClass::eventCallback(0, SOCKET_MSG_RECV, &m);
+    }
+  }
+  CHECK(got == sent, "peer close while buffered: read %zu of %zu bytes",
+        got.size(), sent.size());
+  CHECK(!client.connected(), "still connected after the peer closed");
+}
+
+int main(void) {
+  printf("Receive 256 kB\n");
+  for (int mode = 0; mode < 3; mode++)
+    testReceive(mode);
+  printf("Send 64 kB\n");
+  const size_t pieces[5] = {1, 16, 64, 512, 1400};
+  for (size_t piece : pieces)
+    testSend(piece);
+  testRequestReply();
+  testLongWrite();
+  testCloseWhileBuffered();
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,157 @@
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+
+typedef uint8_t byte;
+using std::max;
+using std::min;
+
+/// Virtual time, in microseconds, advanced by the test's model of the chip
+extern double hostMicros;
+
+inline unsigned long millis(void) { return (unsigned long)(hostMicros / 1000); }
+inline unsigned long micros(void) { return (unsigned long)hostMicros; }
+inline void delay(unsigned long ms) { hostMicros += ms * 1000.0; }
+inline void delayMicroseconds(unsigned int us) { hostMicros += us; }
+inline void yield(void) {}
+inline long random(long high) { return high ? rand() % high : 0; }
+inline long random(long low, long high) { return low + random(high - low); }
+inline void pinMode(uint8_t, uint8_t) {}
+/// Defined by the test, which watches the chip select
+void digitalWrite(uint8_t pin, uint8_t value);
+inline bool isHexadecimalDigit(int c) { return isxdigit(c); }
+inline bool isSpace(int c) { return isspace(c); }
+
+/// The String calls the libraries make, on a std::string. A String made
+/// from NULL is invalid, as when the Arduino one runs out of memory.
+class String {
+public:
+  std::string s;
+  bool valid = true;
+
+  String(const char *c = "") {
+    if (c)
+      s = c;
+    else
+      valid = false;
+  }
+  String(const std::string &x) : s(x) {}
+  unsigned char reserve(unsigned n) {
+    s.reserve(n);
+    return 1;
+  }
+  unsigned char concat(const char *c) {
+    s += c;
+    return 1;
+  }
+  unsigned char concat(char c) {
+    s.push_back(c);
+    return 1;
+  }
+  String &operator+=(char c) {
+    s.push_back(c);
+    return *this;
+  }
+  String &operator+=(const char *c) {
+    s += c;
+    return *this;
+  }
+  String &operator+=(const String &c) {
+    s += c.s;
+    return *this;
+  }
+  unsigned length(void) const { return s.size(); }
+  const char *c_str(void) const { return s.c_str(); }
+  int indexOf(char c) const {
+    size_t p = s.find(c);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  String substring(int from, int to = -1) const {
+    return String(s.substr(from, to < 0 ? std::string::npos : to - from));
+  }
+  char operator[](int i) const { return s[i]; }
+  bool operator==(const char *c) const { return s == c; }
+};
+
+class Print;
+
+class Printable {
+public:
+  virtual size_t printTo(Print &) const = 0;
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  int getWriteError(void) { return write_error; }
+  void clearWriteError(void) { write_error = 0; }
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *b, size_t n) {
+    size_t k = 0;
+    while (n--)
+      k += write(*b++);
+    return k;
+  }
+  size_t print(const char *c) { return write((const uint8_t *)c, strlen(c)); }
+  size_t print(const String &c) { return print(c.c_str()); }
+  size_t print(long v) { return print(std::to_string(v).c_str()); }
+  size_t print(int v) { return print((long)v); }
+  size_t print(unsigned v) { return print((long)v); }
+  size_t println(const char *c = "") { return print(c) + print("\r\n"); }
+  size_t println(const String &c) { return println(c.c_str()); }
+  size_t println(long v) { return print(v) + println(); }
+  size_t println(int v) { return println((long)v); }
+  virtual void flush(void) {}
+
+protected:
+  void setWriteError(int e = 1) { write_error = e; }
+
+private:
+  int write_error = 0;
+};
+
+class Stream : public Print {
+public:
+  virtual int available(void) = 0;
+  virtual int read(void) = 0;
+  virtual int peek(void) = 0;
+  void setTimeout(unsigned long t) { _timeout = t; }
+  size_t readBytes(char *b, size_t n) {
+    size_t k = 0;
+    while (k < n) {
+      int c = timedRead();
+      if (c < 0)
+        break;
+      b[k++] = c;
+    }
+    return k;
+  }
+  size_t readBytes(uint8_t *b, size_t n) { return readBytes((char *)b, n); }
+
+protected:
+  unsigned long _timeout = 1000;
+  int timedRead(void) {
+    unsigned long start = millis();
+    do {
+      int c = read();
+      if (c >= 0)
+        return c;
+    } while (millis() - start < _timeout);
+    return -1;
+  }
+};
+
+#endif
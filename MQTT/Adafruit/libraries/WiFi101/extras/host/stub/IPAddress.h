@@ -0,0 +1,35 @@
+#ifndef _HOST_IPADDRESS_H
+#define _HOST_IPADDRESS_H
+
+#include <Arduino.h>
+
+class IPAddress {
+public:
+  uint8_t a[4] = {0};
+
+  IPAddress() {}
+  IPAddress(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3) {
+    a[0] = b0;
+    a[1] = b1;
+    a[2] = b2;
+    a[3] = b3;
+  }
+  IPAddress(uint32_t v) { memcpy(a, &v, 4); }
+  IPAddress(unsigned long v) : IPAddress((uint32_t)v) {}
+  IPAddress(const uint8_t *p) { memcpy(a, p, 4); }
+  operator uint32_t() const {
+    uint32_t v;
+    memcpy(&v, a, 4);
+    return v;
+  }
+  bool operator==(const IPAddress &o) const { return !memcmp(a, o.a, 4); }
+  bool operator==(const uint8_t *p) const { return !memcmp(a, p, 4); }
+  uint8_t operator[](int i) const { return a[i]; }
+  uint8_t &operator[](int i) { return a[i]; }
+  uint8_t *raw_address(void) { return a; }
+  int fromString(const char *) { return 0; }
+};
+
+extern const IPAddress INADDR_NONE;
+
+#endif
@@ -60,6 +60,8 @@
 #define NM_BUS_IOCTL_RW			((uint8)3)	/*!< Read/Write at the same time ==> SPI only. Parameter:tstrNmSpiRw */
 
 #define NM_BUS_IOCTL_WR_RESTART	((uint8)4)				/*!< Write buffer then made restart condition then read ==> I2C only. parameter:tstrNmI2cSpecial */
+#define NM_BUS_IOCTL_BEGIN		((uint8)5)	/*!< Select the chip until NM_BUS_IOCTL_END, so the transfers between are one frame ==> SPI only. Parameter:NULL */
+#define NM_BUS_IOCTL_END		((uint8)6)	/*!< Deselect the chip at the end of a frame ==> SPI only. Parameter:NULL */
 /**
 *	@struct	tstrNmBusCapabilities
 *	@brief	Structure holding bus capabilities information
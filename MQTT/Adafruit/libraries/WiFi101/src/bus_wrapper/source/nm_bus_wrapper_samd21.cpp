@@ -72,38 +72,53 @@ tstrNmBusCapabilities egstrNmBusCapabilities =
 
 static const SPISettings wifi_SPISettings(12000000L, MSBFIRST, SPI_MODE0);
 
-static sint8 spi_rw(uint8* pu8Mosi, uint8* pu8Miso, uint16 u16Sz)
+static uint8 gu8Frame = 0;
+
+static void spi_select(void)
 {
-	uint8 u8Dummy = 0;
-	uint8 u8SkipMosi = 0, u8SkipMiso = 0;
+	WINC1501_SPI.beginTransaction(wifi_SPISettings);
+	digitalWrite(gi8Winc1501CsPin, LOW);
+}
 
-	if (!pu8Mosi) {
-		pu8Mosi = &u8Dummy;
-		u8SkipMosi = 1;
-	}
-	else if(!pu8Miso) {
-		pu8Miso = &u8Dummy;
-		u8SkipMiso = 1;
-	}
-	else {
+static void spi_deselect(void)
+{
+	digitalWrite(gi8Winc1501CsPin, HIGH);
+	WINC1501_SPI.endTransaction();
+}
+
+static sint8 spi_rw(uint8* pu8Mosi, uint8* pu8Miso, uint16 u16Sz)
+{
+	if (pu8Mosi && pu8Miso) {
 		return M2M_ERR_BUS_FAIL;
 	}
 
-	WINC1501_SPI.beginTransaction(wifi_SPISettings);
-	digitalWrite(gi8Winc1501CsPin, LOW);
-
-	while (u16Sz) {
-		*pu8Miso = WINC1501_SPI.transfer(*pu8Mosi);
-			
-		u16Sz--;
-		if (!u8SkipMiso)
-			pu8Miso++;
-		if (!u8SkipMosi)
-			pu8Mosi++;
+	// a transfer outside of a frame selects the chip for itself
+	if (!gu8Frame)
+		spi_select();
+
+	if (pu8Miso) {
+		// send zeros, and read in place
+		memset(pu8Miso, 0, u16Sz);
+		WINC1501_SPI.transfer(pu8Miso, u16Sz);
+	} else {
+		// SPI.transfer(buf, len) overwrites buf, so copy the data out
+		// a block at a time and transfer that
+		uint8 au8Tmp[32];
+
+		while (u16Sz) {
+			uint16 n = u16Sz;
+
+			if (n > sizeof(au8Tmp))
+				n = sizeof(au8Tmp);
+			memcpy(au8Tmp, pu8Mosi, n);
+			WINC1501_SPI.transfer(au8Tmp, n);
+			pu8Mosi += n;
+			u16Sz -= n;
+		}
 	}
 
-	digitalWrite(gi8Winc1501CsPin, HIGH);
-	WINC1501_SPI.endTransaction();
+	if (!gu8Frame)
+		spi_deselect();
 
 	return M2M_SUCCESS;
 }
@@ -159,6 +174,18 @@ sint8 nm_bus_ioctl(uint8 u8Cmd, void* pvParameter)
 			s8Ret = spi_rw(pstrParam->pu8InBuf, pstrParam->pu8OutBuf, pstrParam->u16Sz);
 		}
 		break;
+		case NM_BUS_IOCTL_BEGIN:
+			if (!gu8Frame) {
+				spi_select();
+				gu8Frame = 1;
+			}
+		break;
+		case NM_BUS_IOCTL_END:
+			if (gu8Frame) {
+				gu8Frame = 0;
+				spi_deselect();
+			}
+		break;
 		default:
 			s8Ret = -1;
 			M2M_ERR("invalide ioclt cmd\n");
@@ -113,6 +113,50 @@ static sint8 nmi_spi_write(uint8* b, uint16 sz)
 	spi.u16Sz = sz;
 	return nm_bus_ioctl(NM_BUS_IOCTL_RW, &spi);
 }
+
+/*
+	Keep the chip selected from the command to the end of its response and
+	data, rather than selecting it again for every part of the exchange.
+*/
+static sint8 nmi_spi_begin(void)
+{
+	return nm_bus_ioctl(NM_BUS_IOCTL_BEGIN, NULL);
+}
+
+static sint8 nmi_spi_end(void)
+{
+	return nm_bus_ioctl(NM_BUS_IOCTL_END, NULL);
+}
+
+/*
+	The fixed part of a command response is read in one transfer, and the
+	response parsing below takes its bytes from here before reading more.
+	Never more is read ahead than the shortest response to the command.
+*/
+static uint8 gau8RxAhead[8];
+static uint8 gu8RxAheadLen	=	0;
+static uint8 gu8RxAheadPos	=	0;
+
+static sint8 spi_rx_ahead(uint8 sz)
+{
+	gu8RxAheadPos = 0;
+	gu8RxAheadLen = 0;
+	if (M2M_SUCCESS != nmi_spi_read(gau8RxAhead, sz))
+		return M2M_ERR_BUS_FAIL;
+	gu8RxAheadLen = sz;
+	return M2M_SUCCESS;
+}
+
+static sint8 spi_rx(uint8* b, uint16 sz)
+{
+	while (sz && (gu8RxAheadPos < gu8RxAheadLen)) {
+		*b++ = gau8RxAhead[gu8RxAheadPos++];
+		sz--;
+	}
+	if (sz)
+		return nmi_spi_read(b, sz);
+	return M2M_SUCCESS;
+}
 #ifndef USE_OLD_SPI_SW
 static sint8 nmi_spi_rw(uint8 *bin,uint8* bout,uint16 sz)
 {
@@ -214,8 +258,11 @@ static sint8 spi_cmd(uint8 cmd, uint32 adr, uint32 u32data, uint32 sz,uint8 cloc
 {
 	uint8 bc[9];
 	uint8 len = 5;
+	uint8 rsp_len = 2;
 	sint8 result = N_OK;
 
+	gu8RxAheadLen = 0;
+
 	bc[0] = cmd;
 	switch (cmd) {
 	case CMD_SINGLE_READ:				/* single word (4 bytes) read */
@@ -223,6 +270,7 @@ static sint8 spi_cmd(uint8 cmd, uint32 adr, uint32 u32data, uint32 sz,uint8 cloc
 		bc[2] = (uint8)(adr >> 8);
 		bc[3] = (uint8)adr;
 		len = 5;
+		rsp_len = 2 + 1 + 4;			/* response, data header, data */
 		break;
 	case CMD_INTERNAL_READ:			/* internal register read */
 		bc[1] = (uint8)(adr >> 8);
@@ -230,24 +278,28 @@ static sint8 spi_cmd(uint8 cmd, uint32 adr, uint32 u32data, uint32 sz,uint8 cloc
 		bc[2] = (uint8)adr;
 		bc[3] = 0x00;
 		len = 5;
+		rsp_len = 2 + 1 + 4;
 		break;
 	case CMD_TERMINATE:					/* termination */
 		bc[1] = 0x00;
 		bc[2] = 0x00;
 		bc[3] = 0x00;
 		len = 5;
+		rsp_len = 1 + 2;				/* skipped byte, response */
 		break;
 	case CMD_REPEAT:						/* repeat */
 		bc[1] = 0x00;
 		bc[2] = 0x00;
 		bc[3] = 0x00;
 		len = 5;
+		rsp_len = 1 + 2;
 		break;
 	case CMD_RESET:							/* reset */
 		bc[1] = 0xff;
 		bc[2] = 0xff;
 		bc[3] = 0xff;
 		len = 5;
+		rsp_len = 1 + 2;
 		break;
 	case CMD_DMA_WRITE:					/* dma write */
 	case CMD_DMA_READ:					/* dma read */
@@ -257,6 +309,8 @@ static sint8 spi_cmd(uint8 cmd, uint32 adr, uint32 u32data, uint32 sz,uint8 cloc
 		bc[4] = (uint8)(sz >> 8);
 		bc[5] = (uint8)(sz);
 		len = 7;
+		if (cmd == CMD_DMA_READ)
+			rsp_len = 2 + 1;			/* response, data header */
 		break;
 	case CMD_DMA_EXT_WRITE:		/* dma extended write */
 	case CMD_DMA_EXT_READ:			/* dma extended read */
@@ -267,6 +321,8 @@ static sint8 spi_cmd(uint8 cmd, uint32 adr, uint32 u32data, uint32 sz,uint8 cloc
 		bc[5] = (uint8)(sz >> 8);
 		bc[6] = (uint8)(sz);
 		len = 8;
+		if (cmd == CMD_DMA_EXT_READ)
+			rsp_len = 2 + 1;
 		break;
 	case CMD_INTERNAL_WRITE:		/* internal register write */
 		bc[1] = (uint8)(adr >> 8);
@@ -302,6 +358,9 @@ static sint8 spi_cmd(uint8 cmd, uint32 adr, uint32 u32data, uint32 sz,uint8 cloc
 		if (M2M_SUCCESS != nmi_spi_write(bc, len)) {
 			M2M_ERR("[nmi spi]: Failed cmd write, bus error...\n");
 			result = N_FAIL;
+		} else if (M2M_SUCCESS != spi_rx_ahead(rsp_len)) {
+			M2M_ERR("[nmi spi]: Failed cmd response read, bus error...\n");
+			result = N_FAIL;
 		}
 	}
 
@@ -322,7 +381,7 @@ static sint8 spi_data_rsp(uint8 cmd)
 	else
 		len = 3;
 
-	if (M2M_SUCCESS != nmi_spi_read(&rsp[0], len)) {
+	if (M2M_SUCCESS != spi_rx(&rsp[0], len)) {
 		M2M_ERR("[nmi spi]: Failed bus error...\n");
 		result = N_FAIL;
 		goto _fail_;
@@ -351,7 +410,7 @@ static sint8 spi_cmd_rsp(uint8 cmd)
 	if ((cmd == CMD_RESET) ||
 		 (cmd == CMD_TERMINATE) ||
 		 (cmd == CMD_REPEAT)) {
-		if (M2M_SUCCESS != nmi_spi_read(&rsp, 1)) {
+		if (M2M_SUCCESS != spi_rx(&rsp, 1)) {
 			result = N_FAIL;
 			goto _fail_;
 		}
@@ -361,7 +420,7 @@ static sint8 spi_cmd_rsp(uint8 cmd)
 	s8RetryCnt = SPI_RESP_RETRY_COUNT;
 	do
 	{
-		if (M2M_SUCCESS != nmi_spi_read(&rsp, 1)) {
+		if (M2M_SUCCESS != spi_rx(&rsp, 1)) {
 			M2M_ERR("[nmi spi]: Failed cmd response read, bus error...\n");
 			result = N_FAIL;
 			goto _fail_;
@@ -375,7 +434,7 @@ static sint8 spi_cmd_rsp(uint8 cmd)
 	s8RetryCnt = SPI_RESP_RETRY_COUNT;
 	do
 	{
-		if (M2M_SUCCESS != nmi_spi_read(&rsp, 1)) {
+		if (M2M_SUCCESS != spi_rx(&rsp, 1)) {
 			M2M_ERR("[nmi spi]: Failed cmd response read, bus error...\n");
 			result = N_FAIL;
 			goto _fail_;
@@ -774,7 +833,7 @@ static sint8 spi_data_read(uint8 *b, uint16 sz,uint8 clockless)
 		**/
 		retry = SPI_RESP_RETRY_COUNT;
 		do {
-			if (M2M_SUCCESS != nmi_spi_read(&rsp, 1)) {
+			if (M2M_SUCCESS != spi_rx(&rsp, 1)) {
 				M2M_ERR("[nmi spi]: Failed data response read, bus error...\n");
 				result = N_FAIL;
 				break;
@@ -795,7 +854,7 @@ static sint8 spi_data_read(uint8 *b, uint16 sz,uint8 clockless)
 		/**
 			Read bytes
 		**/
-		if (M2M_SUCCESS != nmi_spi_read(&b[ix], nbytes)) {
+		if (M2M_SUCCESS != spi_rx(&b[ix], nbytes)) {
 			M2M_ERR("[nmi spi]: Failed data block read, bus error...\n");
 			result = N_FAIL;
 			break;
@@ -806,7 +865,7 @@ static sint8 spi_data_read(uint8 *b, uint16 sz,uint8 clockless)
 			Read Crc
 			**/
 			if (!gu8Crc_off) {
-				if (M2M_SUCCESS != nmi_spi_read(crc, 2)) {
+				if (M2M_SUCCESS != spi_rx(crc, 2)) {
 					M2M_ERR("[nmi spi]: Failed data block crc read, bus error...\n");
 					result = N_FAIL;
 					break;
@@ -908,7 +967,8 @@ static sint8 spi_write_reg(uint32 addr, uint32 u32data)
 	uint8 cmd = CMD_SINGLE_WRITE;
 	uint8 clockless = 0;
 	
-_RETRY_:	
+_RETRY_:
+	nmi_spi_begin();
 	if (addr <= 0x30)
 	{
 		/**
@@ -946,6 +1006,7 @@ _RETRY_:
 
 #endif
 _FAIL_:
+	nmi_spi_end();
 	if(result != N_OK)
 	{
 		nm_bsp_sleep(1);
@@ -968,6 +1029,7 @@ static sint8 nm_spi_write(uint32 addr, uint8 *buf, uint16 size)
 
 
 _RETRY_:
+	nmi_spi_begin();
 	/**
 		Command
 	**/
@@ -1013,6 +1075,7 @@ _RETRY_:
 	}
 	
 _FAIL_:
+	nmi_spi_end();
 	if(result != N_OK)
 	{
 		nm_bsp_sleep(1);
@@ -1037,6 +1100,7 @@ static sint8 spi_read_reg(uint32 addr, uint32 *u32data)
 	uint8 clockless = 0;
 
 _RETRY_:
+	nmi_spi_begin();
 
 	if (addr <= 0xff)
 	{
@@ -1086,6 +1150,7 @@ _RETRY_:
 		((uint32)tmp[3] << 24);
 		
 _FAIL_:
+	nmi_spi_end();
 	if(result != N_OK)
 	{
 		
@@ -1112,6 +1177,7 @@ static sint8 nm_spi_read(uint32 addr, uint8 *buf, uint16 size)
 #endif
 
 _RETRY_:
+	nmi_spi_begin();
 
 	/**
 		Command
@@ -1159,6 +1225,7 @@ _RETRY_:
 #endif
 
 _FAIL_:
+	nmi_spi_end();
 	if(result != N_OK)
 	{
 		nm_bsp_sleep(1);
@@ -26,11 +26,25 @@ extern "C" {
 
 #include "WiFiSocket.h"
 
+// Receive ring and transmit buffer sizes, per socket.  The buffers are
+// allocated when the socket is first used.  A receive ring with room for
+// SOCKET_BUFFER_MAX_LENGTH more bytes asks the WINC1500 for the next TCP
+// segment while the current one is still being read.
+#ifndef SOCKET_BUFFER_SIZE
 #ifdef LIMITED_RAM_DEVICE
 #define SOCKET_BUFFER_SIZE 64
 #else
 #define SOCKET_BUFFER_SIZE 1472
 #endif
+#endif
+
+#ifndef SOCKET_TX_BUFFER_SIZE
+#ifdef LIMITED_RAM_DEVICE
+#define SOCKET_TX_BUFFER_SIZE 32
+#else
+#define SOCKET_TX_BUFFER_SIZE 256
+#endif
+#endif
 
 extern uint8 hif_receive_blocked;
 
@@ -50,11 +64,14 @@ WiFiSocketClass::WiFiSocketClass()
 {
 	for (int i = 0; i < MAX_SOCKET; i++) {
 		_info[i].state = SOCKET_STATE_INVALID;
+		_info[i].closing = 0;
 		_info[i].parent = -1;
 		_info[i].recvMsg.s16BufferSize = 0;
 		_info[i].buffer.data = NULL;
 		_info[i].buffer.head = NULL;
 		_info[i].buffer.length = 0;
+		_info[i].txBuffer.data = NULL;
+		_info[i].txBuffer.length = 0;
 		memset(&_info[i]._lastSendtoAddr, 0x00, sizeof(_info[i]._lastSendtoAddr));
 	}
 }
@@ -188,6 +205,9 @@ int WiFiSocketClass::available(SOCKET sock)
 		return 0;
 	}
 
+	// a reply can only come once buffered writes have gone out
+	flush(sock);
+
 	return (_info[sock].buffer.length + _info[sock].recvMsg.s16BufferSize);
 }
 
@@ -199,12 +219,10 @@ int WiFiSocketClass::peek(SOCKET sock)
 		return -1;
 	}
 
-	if (available(sock) == 0) {
-		return -1;
-	}
+	flush(sock);
 
-	if (_info[sock].buffer.length == 0 && _info[sock].recvMsg.s16BufferSize) {
-		if (!fillRecvBuffer(sock)) {
+	if (_info[sock].buffer.length == 0) {
+		if (_info[sock].recvMsg.s16BufferSize == 0 || !fillRecvBuffer(sock)) {
 			return -1;
 		}
 	}
@@ -220,48 +238,46 @@ int WiFiSocketClass::read(SOCKET sock, uint8_t* buf, size_t size)
 		return 0;
 	}
 
-	int avail = available(sock);
-
-	if (avail <= 0) {
-		return 0;
-	}
-
-	if ((int)size > avail) {
-		size = avail;
-	}
+	flush(sock);
 
 	int bytesRead = 0;
 
 	while (size) {
-		if (_info[sock].buffer.length == 0 && _info[sock].recvMsg.s16BufferSize) {
-			if (!fillRecvBuffer(sock)) {
+		if (_info[sock].buffer.length == 0) {
+			if (_info[sock].recvMsg.s16BufferSize == 0 || !fillRecvBuffer(sock)) {
 				break;
 			}
 		}
 
+		// up to the end of the data, or of the ring if it wraps
+		uint8_t* end = _info[sock].buffer.data + SOCKET_BUFFER_SIZE;
 		int toCopy = size;
 
 		if (toCopy > _info[sock].buffer.length) {
 			toCopy = _info[sock].buffer.length;
 		}
+		if (toCopy > end - _info[sock].buffer.head) {
+			toCopy = end - _info[sock].buffer.head;
+		}
 
 		memcpy(buf, _info[sock].buffer.head, toCopy);
 		_info[sock].buffer.head += toCopy;
 		_info[sock].buffer.length -= toCopy;
 
+		if (_info[sock].buffer.head == end || _info[sock].buffer.length == 0) {
+			_info[sock].buffer.head = _info[sock].buffer.data;
+		}
+
 		buf += toCopy;
 		size -= toCopy;
 		bytesRead += toCopy;
 	}
 
-	if (_info[sock].buffer.length == 0 && _info[sock].recvMsg.s16BufferSize == 0) {
-		if (sock < TCP_SOCK_MAX) {
-			// TCP
-			recv(sock, NULL, 0, 0);
-		} else {
-			// UDP
-			recvfrom(sock, NULL, 0, 0);
-		}
+	if (_info[sock].buffer.length == 0 && _info[sock].closing) {
+		// the remote end closed while data was still buffered, all read now
+		close(sock);
+	} else {
+		requestRecv(sock);
 		m2m_wifi_handle_events(NULL);
 	}
 
@@ -286,24 +302,78 @@ size_t WiFiSocketClass::write(SOCKET sock, const uint8_t *buf, size_t size)
 		return 0;
 	}
 
+	// Small writes are gathered and sent together, once the buffer is
+	// full or by flush(), which also happens before anything is read.
+	if (_info[sock].txBuffer.data == NULL && size < SOCKET_TX_BUFFER_SIZE) {
+		_info[sock].txBuffer.data = (uint8_t*)malloc(SOCKET_TX_BUFFER_SIZE);
+		_info[sock].txBuffer.length = 0;
+	}
+
+	if (_info[sock].txBuffer.data == NULL || _info[sock].txBuffer.length + size > SOCKET_TX_BUFFER_SIZE) {
+		if (!flush(sock)) {
+			return 0;
+		}
+
+		if (_info[sock].txBuffer.data == NULL || size >= SOCKET_TX_BUFFER_SIZE) {
+			return sendData(sock, buf, size);
+		}
+	}
+
+	memcpy(_info[sock].txBuffer.data + _info[sock].txBuffer.length, buf, size);
+	_info[sock].txBuffer.length += size;
+
+	return size;
+}
+
+int WiFiSocketClass::flush(SOCKET sock)
+{
+	int length = _info[sock].txBuffer.length;
+
+	if (length == 0) {
+		return 1;
+	}
+
+	_info[sock].txBuffer.length = 0;
+
+	return (sendData(sock, _info[sock].txBuffer.data, length) == (size_t)length);
+}
+
+size_t WiFiSocketClass::sendData(SOCKET sock, const uint8_t *buf, size_t size)
+{
 #ifdef CONF_PERIPH
 	// Network led ON (rev A then rev B).
 	m2m_periph_gpio_set_val(M2M_PERIPH_GPIO16, 0);
 	m2m_periph_gpio_set_val(M2M_PERIPH_GPIO5, 0);
 #endif
 
-	sint16 err;
+	size_t sent = 0;
 
-	while ((err = send(sock, (void *)buf, size, 0)) < 0) {
-		// Exit on fatal error, retry if buffer not ready.
-		if (err != SOCK_ERR_BUFFER_FULL) {
-			size = 0;
-			break;
-		} else if (hif_receive_blocked) {
-			size = 0;
+	// send() takes at most SOCKET_BUFFER_MAX_LENGTH bytes at a time
+	while (sent < size) {
+		uint16 length = SOCKET_BUFFER_MAX_LENGTH;
+		sint16 err;
+
+		if (size - sent < length) {
+			length = size - sent;
+		}
+
+		while ((err = send(sock, (void *)(buf + sent), length, 0)) < 0) {
+			// Exit on fatal error, retry if buffer not ready.
+			if (err != SOCK_ERR_BUFFER_FULL) {
+				length = 0;
+				break;
+			} else if (hif_receive_blocked) {
+				length = 0;
+				break;
+			}
+			m2m_wifi_handle_events(NULL);
+		}
+
+		if (length == 0) {
 			break;
 		}
-		m2m_wifi_handle_events(NULL);
+
+		sent += length;
 	}
 
 #ifdef CONF_PERIPH
@@ -312,7 +382,7 @@ size_t WiFiSocketClass::write(SOCKET sock, const uint8_t *buf, size_t size)
 	m2m_periph_gpio_set_val(M2M_PERIPH_GPIO5, 1);
 #endif
 
-	return size;
+	return sent;
 }
 
 sint16 WiFiSocketClass::sendto(SOCKET sock, void *pvSendBuffer, uint16 u16SendLength, uint16 flags, struct sockaddr *pstrDestAddr, uint8 u8AddrLen)
@@ -346,6 +416,7 @@ sint8 WiFiSocketClass::close(SOCKET sock)
 	}
 
 	_info[sock].state = SOCKET_STATE_INVALID;
+	_info[sock].closing = 0;
 	_info[sock].parent = -1;
 
 	if (_info[sock].buffer.data != NULL) {
@@ -354,6 +425,11 @@ sint8 WiFiSocketClass::close(SOCKET sock)
 	_info[sock].buffer.data = NULL;
 	_info[sock].buffer.head = NULL;
 	_info[sock].buffer.length = 0;
+	if (_info[sock].txBuffer.data != NULL) {
+		free(_info[sock].txBuffer.data);
+	}
+	_info[sock].txBuffer.data = NULL;
+	_info[sock].txBuffer.length = 0;
 	_info[sock].recvMsg.s16BufferSize = 0;
 	memset(&_info[sock]._lastSendtoAddr, 0x00, sizeof(_info[sock]._lastSendtoAddr));
 
@@ -455,7 +531,13 @@ void WiFiSocketClass::handleEvent(SOCKET sock, uint8 u8Msg, void *pvMsg)
 #endif
 
 			if (pstrRecvMsg->s16BufferSize <= 0) {
-				close(sock);
+				if (_info[sock].buffer.length > 0) {
+					// more was asked for before the last data was read,
+					// close once that has been read
+					_info[sock].closing = 1;
+				} else {
+					close(sock);
+				}
 			} else if (_info[sock].state == SOCKET_STATE_CONNECTED || _info[sock].state == SOCKET_STATE_BOUND) {
 				_info[sock].recvMsg.pu8Buffer = pstrRecvMsg->pu8Buffer;
 				_info[sock].recvMsg.s16BufferSize = pstrRecvMsg->s16BufferSize;
@@ -467,6 +549,7 @@ void WiFiSocketClass::handleEvent(SOCKET sock, uint8 u8Msg, void *pvMsg)
 				}
 
 				fillRecvBuffer(sock);
+				requestRecv(sock);
 			} else {
 				// not connected or bound, discard data
 				hif_receive(0, NULL, 0, 1);
@@ -499,24 +582,63 @@ int WiFiSocketClass::fillRecvBuffer(SOCKET sock)
 		_info[sock].buffer.length = 0;
 	}
 
+	// append to what is buffered, as much as the ring has room for
 	int size = _info[sock].recvMsg.s16BufferSize;
 
-	if (size > SOCKET_BUFFER_SIZE) {
-		size = SOCKET_BUFFER_SIZE;
+	if (size > SOCKET_BUFFER_SIZE - _info[sock].buffer.length) {
+		size = SOCKET_BUFFER_SIZE - _info[sock].buffer.length;
 	}
 
-	uint8 lastTransfer = ((sint16)size == _info[sock].recvMsg.s16BufferSize);
-
-	if (hif_receive(_info[sock].recvMsg.pu8Buffer, _info[sock].buffer.data, (sint16)size, lastTransfer) != M2M_SUCCESS) {
+	if (size == 0) {
 		return 0;
 	}
 
-	_info[sock].buffer.head = _info[sock].buffer.data;
-	_info[sock].buffer.length = size;
-	_info[sock].recvMsg.pu8Buffer += size;
-	_info[sock].recvMsg.s16BufferSize -= size;
+	uint8_t* end = _info[sock].buffer.data + SOCKET_BUFFER_SIZE;
+
+	while (size) {
+		uint8_t* tail = _info[sock].buffer.head + _info[sock].buffer.length;
+
+		if (tail >= end) {
+			tail -= SOCKET_BUFFER_SIZE;
+		}
+
+		int toCopy = size;
+
+		if (toCopy > end - tail) {
+			toCopy = end - tail;
+		}
+
+		uint8 lastTransfer = ((sint16)toCopy == _info[sock].recvMsg.s16BufferSize);
+
+		if (hif_receive(_info[sock].recvMsg.pu8Buffer, tail, (sint16)toCopy, lastTransfer) != M2M_SUCCESS) {
+			return 0;
+		}
+
+		_info[sock].buffer.length += toCopy;
+		_info[sock].recvMsg.pu8Buffer += toCopy;
+		_info[sock].recvMsg.s16BufferSize -= toCopy;
+		size -= toCopy;
+	}
 
 	return 1;
 }
 
+void WiFiSocketClass::requestRecv(SOCKET sock)
+{
+	if (_info[sock].recvMsg.s16BufferSize != 0 || _info[sock].closing) {
+		// the last data received is still being pulled in
+		return;
+	}
+
+	if (sock < TCP_SOCK_MAX) {
+		// TCP, ask for the next segment while there is room for it
+		if (_info[sock].buffer.length == 0 || SOCKET_BUFFER_SIZE - _info[sock].buffer.length >= SOCKET_BUFFER_MAX_LENGTH) {
+			recv(sock, NULL, 0, 0);
+		}
+	} else if (_info[sock].buffer.length == 0) {
+		// UDP, one datagram at a time so available() is its size
+		recvfrom(sock, NULL, 0, 0);
+	}
+}
+
 WiFiSocketClass WiFiSocket;
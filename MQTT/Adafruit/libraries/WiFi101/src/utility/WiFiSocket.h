@@ -45,6 +45,7 @@ public:
   int peek(SOCKET sock);
   int read(SOCKET sock, uint8_t* buf, size_t size);
   size_t write(SOCKET sock, const uint8_t *buf, size_t size);
+  int flush(SOCKET sock);
   sint16 sendto(SOCKET sock, void *pvSendBuffer, uint16 u16SendLength, uint16 flags, struct sockaddr *pstrDestAddr, uint8 u8AddrLen);
   IPAddress remoteIP(SOCKET sock);
   uint16_t remotePort(SOCKET sock);
@@ -57,10 +58,13 @@ public:
 private:
   void handleEvent(SOCKET sock, uint8 u8Msg, void *pvMsg);
   int fillRecvBuffer(SOCKET sock);
+  void requestRecv(SOCKET sock);
+  size_t sendData(SOCKET sock, const uint8_t *buf, size_t size);
 
   struct 
   {
     uint8_t state;
+    uint8_t closing;
     SOCKET parent;
     tstrSocketRecvMsg recvMsg;
     struct {
@@ -68,6 +72,10 @@ private:
       uint8_t* head;
       int length;
     } buffer;
+    struct {
+      uint8_t* data;
+      int length;
+    } txBuffer;
     struct sockaddr _lastSendtoAddr;
   } _info[MAX_SOCKET];
 };
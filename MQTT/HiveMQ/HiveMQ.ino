@@ -25,6 +25,7 @@ void TaskTemperatureHumidity(void *pvParameters);
 void TaskSoilMoistureAndRelay(void *pvParameters);
 void TaskLightAndLED(void *pvParameters);
 void TaskLEDMoving(void *pvParameters);
+void TaskLEDShow(void *pvParameters);
 // void TaskAutoFan(void *pvParameters);
 void TaskMQTT(void *pvParameters);
 
@@ -34,6 +35,8 @@ DHT20 DHT;
 WiFiClient network;
 MQTTClient mqtt = MQTTClient(256);
 Adafruit_NeoPixel rgb(4, D3, NEO_GRB + NEO_KHZ800);
+Adafruit_NeoPixel_Segment rgbLight;   // pixels 0-1, drawn by TaskLightAndLED
+Adafruit_NeoPixel_Segment rgbMoving;  // pixels 2-3, drawn by TaskLEDMoving
 
 void setup() {
   Serial.begin(115200);
@@ -41,13 +44,17 @@ void setup() {
   DHT.begin();
   lcd.init();
   lcd.backlight();
+  lcd.enableShadow();  // print into RAM, flush() sends only changed characters
   rgb.begin();
+  rgb.addSegment(rgbLight, 0, 2);
+  rgb.addSegment(rgbMoving, 2, 2);
 
   xTaskCreate( TaskBlink, "Task Blink" ,2048  ,NULL  ,2 , NULL);
   xTaskCreate( TaskTemperatureHumidity, "Task Temperature" ,2048  ,NULL  ,2 , NULL);
   xTaskCreate( TaskSoilMoistureAndRelay, "Task Soil Moisture" ,2048  ,NULL  ,2 , NULL);
   xTaskCreate( TaskLightAndLED, "Task Light and LED" ,2048  ,NULL  ,2 , NULL);
   xTaskCreate( TaskLEDMoving, "Task LED Moving" ,2048  ,NULL  ,2 , NULL);
+  xTaskCreate( TaskLEDShow, "Task LED Show" ,2048  ,NULL  ,2 , NULL);
   // xTaskCreate( TaskAutoFan, "Task Auto Fan", 2048, NULL, 2, NULL);
   xTaskCreate( TaskMQTT, "Task MQTT", 2048, NULL, 2, NULL);
 
@@ -89,7 +96,21 @@ void TaskTemperatureHumidity(void *pvParameters) {  // This is a task.
 
   while(1) {              
     Serial.println("Task Temperature and Humidity");
-    DHT.read();
+    // Non-blocking read: the task sleeps while the sensor measures
+    int status = DHT.startMeasurement();
+    if (status == DHT20_OK) {
+      while ((status = DHT.poll()) == DHT20_MEASURING) {
+        delay(10);
+      }
+    }
+    if (status != DHT20_OK) {
+      // Bus error, bad checksum or timeout: keep the old readings on the
+      // LCD and try again in a second
+      Serial.print("DHT20 error ");
+      Serial.println(status);
+      delay(1000);
+      continue;
+    }
     Serial.println(DHT.getTemperature());
     Serial.println(DHT.getHumidity());         
     lcd.clear();
@@ -99,6 +120,7 @@ void TaskTemperatureHumidity(void *pvParameters) {  // This is a task.
     lcd.setCursor(0, 1);
     lcd.print("Do Am: ");
     lcd.print(DHT.getHumidity());
+    lcd.flush();
     delay(5000);
   }
 }
@@ -129,14 +151,14 @@ void TaskLightAndLED(void *pvParameters) {
     Serial.println("Task Light and LED");
     Serial.println(analogRead(A0));
     if(analogRead(A0) < 1000){
-      rgb.setPixelColor(0, rgb.Color(255,0,0));
-      rgb.setPixelColor(1, rgb.Color(255,0,0));
-      rgb.show();
+      rgbLight.setPixelColor(0, rgb.Color(255,0,0));
+      rgbLight.setPixelColor(1, rgb.Color(255,0,0));
+      rgbLight.show();
     }
     if(analogRead(A0) > 1250){
-      rgb.setPixelColor(0, rgb.Color(0,0,0));
-      rgb.setPixelColor(1, rgb.Color(0,0,0));
-      rgb.show();
+      rgbLight.setPixelColor(0, rgb.Color(0,0,0));
+      rgbLight.setPixelColor(1, rgb.Color(0,0,0));
+      rgbLight.show();
     }
     delay(1000);
   }
@@ -149,20 +171,29 @@ void TaskLEDMoving(void *pvParameters) {
     Serial.println("Task Moving and LED");
     Serial.println(digitalRead(D7));
     if(digitalRead(D7) == 1){
-      rgb.setPixelColor(2, rgb.Color(0,0,255));
-      rgb.setPixelColor(3, rgb.Color(0,0,255));
-      rgb.show();
+      rgbMoving.setPixelColor(0, rgb.Color(0,0,255));
+      rgbMoving.setPixelColor(1, rgb.Color(0,0,255));
+      rgbMoving.show();
       delay(3000);
     }
     if(digitalRead(D7) == 0){
-      rgb.setPixelColor(2, rgb.Color(0,0,0));
-      rgb.setPixelColor(3, rgb.Color(0,0,0));
-      rgb.show();
+      rgbMoving.setPixelColor(0, rgb.Color(0,0,0));
+      rgbMoving.setPixelColor(1, rgb.Color(0,0,0));
+      rgbMoving.show();
     }
     delay(1000);
   }
 }
 
+// The only task that sends to the strip: the LED tasks only publish their
+// segments, this pushes whatever changed at most once per frame (50 fps)
+void TaskLEDShow(void *pvParameters) {
+  while(1) {
+    rgb.showSegments();
+    delay(20);
+  }
+}
+
 // void TaskAutoFan(void *pvParameters) {
 //   pinMode(A2, OUTPUT);
 
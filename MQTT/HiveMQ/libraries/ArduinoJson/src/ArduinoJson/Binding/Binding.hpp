@@ -0,0 +1,161 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Array/JsonArray.hpp>
+#include <ArduinoJson/Object/JsonObject.hpp>
+#include <ArduinoJson/Polyfills/preprocessor.hpp>
+#include <ArduinoJson/Polyfills/type_traits.hpp>
+
+// Binds the members of a struct to the members of a JSON object.
+// Must be used in the namespace of the struct, for example:
+//   struct Params { int relay; bool state; };
+//   ARDUINOJSON_BIND(Params, relay, state)
+// The generated visitJsonFields() functions are found by ADL; you can also
+// write them by hand, for example, to use different keys.
+#define ARDUINOJSON_BIND(T, ...)                                    \
+  template <typename TVisitor>                                      \
+  inline void visitJsonFields(T& object, TVisitor& visitor) {       \
+    ARDUINOJSON_FOR_EACH(ARDUINOJSON_BIND_FIELD, __VA_ARGS__)       \
+  }                                                                 \
+  template <typename TVisitor>                                      \
+  inline void visitJsonFields(const T& object, TVisitor& visitor) { \
+    ARDUINOJSON_FOR_EACH(ARDUINOJSON_BIND_FIELD, __VA_ARGS__)       \
+  }
+
+// The visitor returns true to stop the iteration
+#define ARDUINOJSON_BIND_FIELD(MEMBER) \
+  if (visitor(#MEMBER, object.MEMBER)) \
+    return;
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+struct JsonFieldProbe {
+  template <typename T>
+  bool operator()(const char*, const T&) {
+    return false;
+  }
+};
+
+// A meta-function that returns true if T has a visitJsonFields() overload,
+// for example, one generated by ARDUINOJSON_BIND()
+template <typename T, typename = void>
+struct IsJsonBound : false_type {};
+
+template <typename T>
+struct IsJsonBound<T, void_t<decltype(visitJsonFields(
+                          declval<T&>(), declval<JsonFieldProbe&>()))>>
+    : true_type {};
+
+// Copies a string into a char array, truncating if needed
+template <size_t N>
+inline void copyJsonString(JsonString src, char (&dst)[N]) {
+  size_t n = src.isNull() ? 0 : src.size();
+  if (n > N - 1)
+    n = N - 1;
+  for (size_t i = 0; i < n; i++)
+    dst[i] = src.c_str()[i];
+  dst[n] = 0;
+}
+
+// Returns the string stored in a char array that might not be terminated
+template <size_t N>
+inline JsonString boundedJsonString(const char (&src)[N]) {
+  size_t n = 0;
+  while (n < N && src[n])
+    n++;
+  return JsonString(src, n, JsonString::Copied);
+}
+
+class JsonFieldsToObject {
+ public:
+  JsonFieldsToObject(JsonObject object) : object_(object) {}
+
+  template <typename T>
+  bool operator()(const char* key, const T& value) {
+    write(object_[key], value);
+    return false;
+  }
+
+ private:
+  template <typename TDestination, typename T>
+  static enable_if_t<!is_array<T>::value> write(const TDestination& dst,
+                                                 const T& value) {
+    dst.set(value);
+  }
+
+  template <typename TDestination, size_t N>
+  static void write(const TDestination& dst, const char (&value)[N]) {
+    dst.set(boundedJsonString(value));
+  }
+
+  template <typename TDestination, typename T, size_t N>
+  static void write(const TDestination& dst, const T (&values)[N]) {
+    JsonArray array = dst.template to<JsonArray>();
+    for (size_t i = 0; i < N; i++)
+      write(array.add<JsonVariant>(), values[i]);
+  }
+
+  JsonObject object_;
+};
+
+class JsonFieldsFromObject {
+ public:
+  JsonFieldsFromObject(JsonObjectConst object) : object_(object) {}
+
+  template <typename T>
+  bool operator()(const char* key, T& value) {
+    read(object_[key], value);
+    return false;
+  }
+
+ private:
+  template <typename T>
+  static enable_if_t<!is_array<T>::value> read(JsonVariantConst src,
+                                                T& value) {
+    value = src.as<T>();
+  }
+
+  template <size_t N>
+  static void read(JsonVariantConst src, char (&value)[N]) {
+    copyJsonString(src.as<JsonString>(), value);
+  }
+
+  template <typename T, size_t N>
+  static void read(JsonVariantConst src, T (&values)[N]) {
+    JsonArrayConst array = src.as<JsonArrayConst>();
+    for (size_t i = 0; i < N; i++)
+      read(array[i], values[i]);
+  }
+
+  JsonObjectConst object_;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Converts bound structs to and from JSON objects, so they work with
+// JsonVariant::set(), as<T>() and is<T>() like any other type.
+template <typename T>
+struct Converter<T, detail::enable_if_t<detail::IsJsonBound<T>::value>> {
+  static void toJson(const T& src, JsonVariant dst) {
+    detail::JsonFieldsToObject visitor(dst.to<JsonObject>());
+    visitJsonFields(src, visitor);
+  }
+
+  static T fromJson(JsonVariantConst src) {
+    T result = T();
+    detail::JsonFieldsFromObject visitor(src.as<JsonObjectConst>());
+    visitJsonFields(result, visitor);
+    return result;
+  }
+
+  static bool checkJson(JsonVariantConst src) {
+    return src.is<JsonObjectConst>();
+  }
+};
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -89,6 +89,12 @@
 #  define ARDUINOJSON_DEFAULT_NESTING_LIMIT 10
 #endif
 
+// Size of the buffer where JsonCursor and JsonStreamParser decode keys and
+// strings
+#ifndef ARDUINOJSON_CURSOR_BUFFER_SIZE
+#  define ARDUINOJSON_CURSOR_BUFFER_SIZE 64
+#endif
+
 // Number of bytes to store a slot id
 // https://arduinojson.org/v7/config/slot_id_size/
 #ifndef ARDUINOJSON_SLOT_ID_SIZE
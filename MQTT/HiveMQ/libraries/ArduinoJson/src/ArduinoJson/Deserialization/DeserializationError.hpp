@@ -63,7 +63,7 @@ class DeserializationError {
   }
 
   const char* c_str() const {
-    static const char* messages[] = {
+    static const char* const messages[] = {
         "Ok",           "EmptyInput", "IncompleteInput",
         "InvalidInput", "NoMemory",   "TooDeep"};
     ARDUINOJSON_ASSERT(static_cast<size_t>(code_) <
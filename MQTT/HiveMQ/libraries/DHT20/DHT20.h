@@ -29,6 +29,27 @@
 #define DHT20_ERROR_BYTES_ALL_ZERO          -13
 #define DHT20_ERROR_READ_TIMEOUT            -14
 #define DHT20_ERROR_LASTREAD                -15
+#define DHT20_ERROR_BUSY                    -16
+
+//  poll() states, not errors
+#define DHT20_MEASURING                      1
+#define DHT20_IDLE                           2
+
+//  number of samples kept by the non-blocking interface
+#ifndef DHT20_SAMPLES
+#define DHT20_SAMPLES                        4
+#endif
+
+
+struct DHT20_sample
+{
+  uint32_t time;          //  millis() when the sample was read
+  float    humidity;
+  float    temperature;
+};
+
+//  called by poll() when a measurement ends, status as poll() returns it
+typedef void (*DHT20_callback)(int status);
 
 
 class DHT20
@@ -52,6 +73,21 @@ public:
   int      convert();
 
 
+  //  NON-BLOCKING CALL
+  //  start a measurement and return; the I2C bus stays free until poll()
+  //  reads the result, about 80 ms later.
+  int      startMeasurement();
+  //  call regularly, e.g. every 10 ms from a task or timer loop (not from
+  //  an ISR).  returns DHT20_MEASURING while waiting, then once the status
+  //  of the measurement (DHT20_OK or an error), DHT20_IDLE otherwise.
+  int      poll();
+  void     onMeasurement(DHT20_callback callback);
+  //  checksum checked samples, oldest first; the oldest is dropped when
+  //  more than DHT20_SAMPLES are waiting.
+  uint8_t  available();
+  bool     getSample(DHT20_sample &sample);
+
+
   //  SYNCHRONOUS CALL
   //  blocking read call to read + convert data
   int      read();
@@ -104,6 +140,12 @@ private:
   uint32_t _lastRead;
   uint8_t  _bits[7];
 
+  bool     _measuring;
+  DHT20_callback _callback;
+  DHT20_sample   _samples[DHT20_SAMPLES];
+  uint8_t  _sampleHead;   //  next slot to write
+  uint8_t  _sampleCount;
+
   uint8_t  _crc8(uint8_t *ptr, uint8_t len);
 
   //  use with care
@@ -0,0 +1,187 @@
+// Host test of the DHT20 non-blocking interface, startMeasurement() and
+// poll(), against a fake TwoWire with a DHT20 behind it (stub/Wire.h).
+//
+// - A normal measurement: DHT20_MEASURING until 80 ms have passed, no bus
+//   traffic meanwhile, one read at the end, the status reported once by
+//   poll() and the callback, then DHT20_IDLE.
+// - startMeasurement() refuses a second measurement and one within 1 s of
+//   the last reading, and reports a NACK.
+// - A slow sensor, a bad CRC and a sensor stuck busy: poll() keeps waiting,
+//   reports the checksum error or times out at 1 s. Failed measurements
+//   leave the readings and the sample ring alone.
+// - The sample ring keeps the newest DHT20_SAMPLES, oldest first.
+// - The temperature task of HiveMQ.ino skips a cycle on any error and
+//   succeeds on the next one.
+// Then prints the bus use of poll() against the blocking read().
+#include <math.h>
+#include <stdio.h>
+
+#include "DHT20.h"
+
+uint32_t fakeMillis = 5000;
+TwoWire Wire;
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static int callbacks = 0, callbackStatus = 99;
+static void onMeasurement(int status) {
+  callbacks++;
+  callbackStatus = status;
+}
+
+// Polls every 10 ms until the measurement ends, returns its status
+static int finish(DHT20 &dht) {
+  int status;
+  while ((status = dht.poll()) == DHT20_MEASURING)
+    fakeMillis += 10;
+  return status;
+}
+
+// One cycle of TaskTemperatureHumidity in HiveMQ.ino, returns true if the
+// readings were shown
+static bool taskCycle(DHT20 &dht) {
+  int status = dht.startMeasurement();
+  if (status == DHT20_OK) {
+    while ((status = dht.poll()) == DHT20_MEASURING)
+      delay(10);
+  }
+  if (status != DHT20_OK) {
+    delay(1000);
+    return false;
+  }
+  delay(5000);
+  return true;
+}
+
+int main(void) {
+  DHT20 dht(&Wire);
+  dht.onMeasurement(onMeasurement);
+  DHT20_sample s;
+
+  printf("Measurement\n");
+  CHECK(dht.poll() == DHT20_IDLE, "poll() before any measurement");
+  CHECK(dht.startMeasurement() == DHT20_OK, "startMeasurement()");
+  CHECK(dht.startMeasurement() == DHT20_ERROR_BUSY, "second measurement");
+  uint32_t start = fakeMillis;
+  unsigned long transactions = Wire.transactions;
+  int polls = 0, status;
+  while ((status = dht.poll()) == DHT20_MEASURING) {
+    CHECK(Wire.transactions == transactions, "bus used while waiting");
+    fakeMillis += 10;
+    polls++;
+  }
+  uint32_t elapsed = fakeMillis - start;
+  CHECK(status == DHT20_OK && callbacks == 1 && callbackStatus == DHT20_OK,
+        "status %d, %d callbacks", status, callbacks);
+  CHECK(elapsed >= 80 && elapsed <= 90, "%u ms", elapsed);
+  CHECK(Wire.transactions - transactions == 1, "%lu transactions",
+        Wire.transactions - transactions);
+  CHECK(dht.poll() == DHT20_IDLE && callbacks == 1, "status reported twice");
+  CHECK(fabs(dht.getHumidity() - 50) < 0.01 &&
+            fabs(dht.getTemperature() - 25) < 0.01,
+        "%.2f %%, %.2f C", dht.getHumidity(), dht.getTemperature());
+  dht.setTempOffset(1.5);
+  CHECK(dht.available() == 1 && dht.getSample(s) && s.time == fakeMillis &&
+            fabs(s.temperature - 26.5) < 0.01,
+        "sample");
+  CHECK(!dht.getSample(s) && !dht.available(), "sample read twice");
+  dht.setTempOffset(0);
+  printf("  %d polls, %u ms, %lu I2C transaction after the request\n", polls,
+         elapsed, Wire.transactions - transactions);
+  CHECK(dht.startMeasurement() == DHT20_ERROR_LASTREAD, "1 s rate limit");
+  CHECK(dht.poll() == DHT20_IDLE, "measuring after a refused start");
+
+  printf("Slow sensor\n");
+  fakeMillis += 1000;
+  Wire.latency = 130;
+  CHECK(dht.startMeasurement() == DHT20_OK, "startMeasurement()");
+  start = fakeMillis;
+  status = finish(dht);
+  CHECK(status == DHT20_OK && fakeMillis - start >= 130 &&
+            fakeMillis - start <= 140,
+        "status %d after %u ms", status, fakeMillis - start);
+  Wire.latency = 80;
+
+  printf("Checksum error\n");
+  fakeMillis += 1000;
+  Wire.badCrc = true;
+  Wire.rawTemperature = 0x70000;
+  uint8_t samples = dht.available();
+  CHECK(dht.startMeasurement() == DHT20_OK, "startMeasurement()");
+  status = finish(dht);
+  CHECK(status == DHT20_ERROR_CHECKSUM && callbackStatus == status,
+        "status %d", status);
+  CHECK(dht.available() == samples && fabs(dht.getTemperature() - 25) < 0.01,
+        "bad frame used");
+  Wire.badCrc = false;
+
+  printf("Sensor stuck busy\n");
+  fakeMillis += 1000;
+  Wire.stuck = true;
+  CHECK(dht.startMeasurement() == DHT20_OK, "startMeasurement()");
+  start = fakeMillis;
+  status = finish(dht);
+  CHECK(status == DHT20_ERROR_READ_TIMEOUT && fakeMillis - start >= 1000 &&
+            fakeMillis - start < 1020,
+        "status %d after %u ms", status, fakeMillis - start);
+  Wire.stuck = false;
+  Wire.measuring = false;
+
+  printf("NACK\n");
+  fakeMillis += 1000;
+  Wire.nack = true;
+  CHECK(dht.startMeasurement() == DHT20_ERROR_CONNECT, "NACK not reported");
+  CHECK(dht.poll() == DHT20_IDLE, "measuring after a NACK");
+  Wire.nack = false;
+
+  printf("Sample ring\n");
+  while (dht.getSample(s))
+    ;
+  for (int i = 0; i < DHT20_SAMPLES + 2; i++) {
+    fakeMillis += 1000;
+    Wire.rawTemperature = 0x60000 + i * 0x1000;
+    CHECK(dht.startMeasurement() == DHT20_OK, "startMeasurement()");
+    finish(dht);
+  }
+  CHECK(dht.available() == DHT20_SAMPLES, "%u samples", dht.available());
+  uint32_t lastTime = 0;
+  for (int i = 2; i < DHT20_SAMPLES + 2; i++) {
+    float expect = (0x60000 + i * 0x1000) * 1.9073486328125e-4 - 50;
+    CHECK(dht.getSample(s) && fabs(s.temperature - expect) < 0.001 &&
+              s.time > lastTime,
+          "sample %d", i);
+    lastTime = s.time;
+  }
+  CHECK(!dht.getSample(s), "more samples than DHT20_SAMPLES");
+
+  printf("HiveMQ temperature task\n");
+  fakeMillis += 1000;
+  CHECK(taskCycle(dht), "cycle failed");
+  Wire.nack = true;
+  CHECK(!taskCycle(dht), "cycle with a NACK used the readings");
+  Wire.nack = false;
+  CHECK(taskCycle(dht), "no retry after a NACK");
+  Wire.badCrc = true;
+  CHECK(!taskCycle(dht), "cycle with a bad checksum used the readings");
+  Wire.badCrc = false;
+  CHECK(taskCycle(dht), "no retry after a bad checksum");
+
+  fakeMillis += 1000;
+  transactions = Wire.transactions;
+  start = fakeMillis;
+  CHECK(dht.read() == DHT20_OK, "read()");
+  printf("Blocking read(): caller held %u ms, %lu I2C transactions\n",
+         fakeMillis - start, Wire.transactions - transactions);
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -52,9 +52,16 @@
 #define Rw B00000010  // Read/Write bit
 #define Rs B00000001  // Register select bit
 
+// Expander bytes per I2C transaction when several nibbles are sent in one;
+// fits the smallest Wire buffer (32 bytes on AVR)
+#define LCD_I2C_BATCH 30
+
 class LiquidCrystal_I2C : public Print {
 public:
   LiquidCrystal_I2C(uint8_t lcd_Addr,uint8_t lcd_cols,uint8_t lcd_rows);
+  ~LiquidCrystal_I2C();
+  LiquidCrystal_I2C(const LiquidCrystal_I2C &) = delete;	// owns the shadow buffer
+  LiquidCrystal_I2C &operator=(const LiquidCrystal_I2C &) = delete;
   void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS );
   void clear();
   void home();
@@ -86,6 +93,11 @@ public:
   void command(uint8_t);
   void init();
 
+////shadow buffer: print into RAM, send only the changed cells on flush()
+bool enableShadow();						// false if out of memory
+void disableShadow();
+void flush();
+
 ////compatibility API function aliases
 void blink_on();						// alias for blink()
 void blink_off();       					// alias for noBlink()
@@ -112,7 +124,9 @@ private:
   void send(uint8_t, uint8_t);
   void write4bits(uint8_t);
   void expanderWrite(uint8_t);
-  void pulseEnable(uint8_t);
+  void queueSend(uint8_t, uint8_t);
+  void queueNibble(uint8_t);
+  void endQueue();
   uint8_t _Addr;
   uint8_t _displayfunction;
   uint8_t _displaycontrol;
@@ -121,6 +135,10 @@ private:
   uint8_t _cols;
   uint8_t _rows;
   uint8_t _backlightval;
+  uint8_t _queued;		// expander bytes in the open I2C transaction
+  uint8_t *_shadow;		// cells as printed, NULL when not in shadow mode
+  uint8_t *_glass;		// cells as last sent to the LCD
+  uint8_t _shadowCol, _shadowRow;	// print position in the shadow buffer
 };
 
 #endif
@@ -0,0 +1,21 @@
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Print.h"
+
+#define B00000001 1
+#define B00000010 2
+#define B00000100 4
+
+/// Virtual time in us, advanced by the delays and by the I2C bus in Wire.h
+extern double simTime;
+
+inline void delayMicroseconds(unsigned int us) { simTime += us; }
+inline void delay(unsigned long ms) { simTime += ms * 1000.0; }
+
+#endif
@@ -0,0 +1,180 @@
+// Host test of the HttpClient response body functions, over a loopback
+// socket Client (posix_client.h) to the stand-in server in http_server.py.
+// Takes the server's port.
+//
+// - responseBody() on Content-Length, chunked, trickled chunked and
+//   until-close bodies: byte-exact, with the time taken and the calls
+//   into the Client.
+// - readBody() in 100, 333 and 1000-byte pieces on the same shapes, and
+//   endOfBodyReached() after it.
+// - deserializeJson(doc, http) on a trickled chunked JSON body.
+// - Six mixed responses, some read partly and skipped, on one kept-alive
+//   connection.
+// - read(), read(buf, size) and peek() go by HttpClient::available(),
+//   not by an override of it in a subclass, as in WebSocketClient.
+#define ARDUINOJSON_ENABLE_ARDUINO_STRING 0
+#define ARDUINOJSON_ENABLE_ARDUINO_PRINT 0
+#define ARDUINOJSON_ENABLE_ARDUINO_STREAM 1
+#define ARDUINOJSON_ENABLE_PROGMEM 0
+#include <ArduinoJson.h>
+#include <HttpClient.h>
+
+#include <stdio.h>
+
+#include "posix_client.h"
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static int port;
+
+static std::string expected(int n) {
+  std::string s;
+  for (int i = 0; i < n; i++)
+    s.push_back((i * 7 + i / 13) % 26 + 97);
+  return s;
+}
+
+static void get(HttpClient &http, const char *path, int n) {
+  char url[80];
+  snprintf(url, sizeof(url), "%s%sn=%d", path, strchr(path, '?') ? "&" : "?",
+           n);
+  CHECK(http.get(url) == 0, "get(%s)", url);
+  CHECK(http.responseStatusCode() == 200, "status of %s", url);
+}
+
+static void testResponseBody(const char *path, int n) {
+  PosixClient client;
+  HttpClient http(client, "localhost", port);
+  unsigned long start = millis();
+  get(http, path, n);
+  bool ok = http.responseBody().s == expected(n);
+  CHECK(ok, "responseBody() of %s", path);
+  printf("  responseBody() %-20s %6d bytes %5lu ms %6lu client calls\n", path,
+         n, millis() - start, client.calls);
+}
+
+static void testReadBody(const char *path, int n, size_t piece) {
+  PosixClient client;
+  HttpClient http(client, "localhost", port);
+  get(http, path, n);
+  std::string got;
+  uint8_t buf[1024];
+  int k;
+  do {
+    k = http.readBody(buf, piece);
+    got.append((char *)buf, k);
+  } while (k == (int)piece);
+  CHECK(got == expected(n), "readBody() of %s in %zu-byte pieces", path,
+        piece);
+  CHECK(http.endOfBodyReached() || !strncmp(path, "/close", 6),
+        "end of %s", path);
+  CHECK(http.readBody(buf, piece) == 0, "readBody() after the end");
+  printf("  readBody()     %-20s %6d bytes, %4zu at a time %6lu client "
+         "calls\n",
+         path, n, piece, client.calls);
+}
+
+static void testJson(void) {
+  PosixClient client;
+  HttpClient http(client, "localhost", port);
+  unsigned long start = millis();
+  CHECK(http.get("/json?n=500&c=37&s=50") == 0, "get()");
+  CHECK(http.responseStatusCode() == 200, "status");
+  http.skipResponseHeaders();
+#if ARDUINOJSON_VERSION_MAJOR >= 7
+  JsonDocument doc;
+#else
+  DynamicJsonDocument doc(16384);
+#endif
+  DeserializationError e = deserializeJson(doc, http);
+  CHECK(!e, "deserializeJson(): %s", e.c_str());
+  CHECK(doc["values"].size() == 500 && doc["values"][499] == 499 &&
+            doc["name"] == "feed",
+        "document");
+  printf("  deserializeJson(doc, http), trickled chunks: %s, %lu ms\n",
+         e.c_str(), millis() - start);
+}
+
+static void testKeepAlive(void) {
+  PosixClient client;
+  HttpClient http(client, "localhost", port);
+  http.connectionKeepAlive();
+  const char *paths[6] = {"/chunked?c=256", "/cl", "/chunked?c=3",
+                          "/cl",            "/chunked", "/cl"};
+  const int sizes[6] = {3000, 777, 10, 0, 0, 5};
+  for (int i = 0; i < 6; i++) {
+    get(http, paths[i], sizes[i]);
+    if (i % 2) {
+      uint8_t b[16];
+      CHECK(http.readBody(b, 3) == std::min(3, sizes[i]), "response %d", i);
+      CHECK(http.skipResponseBody() == HTTP_SUCCESS, "response %d", i);
+    } else {
+      CHECK(http.responseBody().s == expected(sizes[i]), "response %d", i);
+    }
+  }
+  CHECK(client.connects == 1, "%lu connections", client.connects);
+  printf("  keep-alive: 6 responses on %lu connection(s)\n", client.connects);
+}
+
+/// Reports no body data, as WebSocketClient does between frames
+class QuietClient : public HttpClient {
+public:
+  QuietClient(Client &c) : HttpClient(c, "localhost", port) {}
+  int available() override {
+    return endOfHeadersReached() ? 0 : HttpClient::available();
+  }
+};
+
+static void testOverride(void) {
+  PosixClient client;
+  QuietClient http(client);
+  get(http, "/chunked?c=5", 12);
+  http.skipResponseHeaders();
+  std::string got;
+  int c = http.peek();
+  CHECK(c == expected(1)[0], "peek() %d", c);
+  got.push_back(http.read());
+  uint8_t buf[32];
+  int k = http.read(buf, sizeof(buf)); // Up to the end of the chunk
+  if (k > 0)
+    got.append((char *)buf, k);
+  while ((k = http.read(buf, sizeof(buf))) > 0)
+    got.append((char *)buf, k);
+  CHECK(got == expected(12), "body read past the override: \"%s\"",
+        got.c_str());
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    printf("usage: %s PORT\n", argv[0]);
+    return 2;
+  }
+  port = atoi(argv[1]);
+
+  printf("Bodies\n");
+  testResponseBody("/cl", 20000);
+  testResponseBody("/chunked?c=500", 20000);
+  testResponseBody("/chunked?c=7&s=13", 2000);
+  testResponseBody("/close", 20000);
+  testReadBody("/cl", 20000, 100);
+  testReadBody("/chunked?c=500", 20000, 100);
+  testReadBody("/chunked?c=500&s=31", 20000, 333);
+  testReadBody("/close", 20000, 1000);
+  testJson();
+  printf("Connections\n");
+  testKeepAlive();
+  printf("Subclass available()\n");
+  testOverride();
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,12 @@
+#ifndef _HOST_IPADDRESS_H
+#define _HOST_IPADDRESS_H
+
+#include <Arduino.h>
+
+class IPAddress {
+public:
+  uint8_t a[4] = {0};
+  bool operator==(const IPAddress &o) const { return !memcmp(a, o.a, 4); }
+};
+
+#endif
@@ -0,0 +1,224 @@
+// Host test of WebSocketClient, over a loopback socket Client
+// (posix_client.h) to the WebSocket endpoints of http_server.py. Takes the
+// server's port.
+//
+// - Binary messages of 0 to 70001 bytes, across the 7 and 16-bit length
+//   boundaries and past WS_TX_BUFFER_SIZE, written 1, 3, 64 bytes or all at
+//   once, come back byte-exact from the echo endpoint, which checks that
+//   every client frame is masked and that fragments continue the message.
+//   Read back in 700-byte pieces, unmasked and masked by the server.
+// - A ping() between messages does not disturb them; peek() and
+//   readString() on a text message.
+// - The server's ping is answered with a pong carrying its data.
+// Then prints messages/sec and the writes per message the client makes for
+// print()ed JSON and for binary messages, and messages/sec and client calls
+// per message receiving binary messages, unmasked and masked.
+#include <WebSocketClient.h>
+
+#include <stdio.h>
+#include <vector>
+
+#include "posix_client.h"
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static int port;
+
+static std::string expected(int n) {
+  std::string s;
+  for (int i = 0; i < n; i++)
+    s.push_back((i * 7 + i / 13) % 26 + 97);
+  return s;
+}
+
+static std::string pattern(size_t n, int seed) {
+  std::string s(n, 0);
+  for (size_t i = 0; i < n; i++)
+    s[i] = (char)(i * 7 + seed);
+  return s;
+}
+
+/// Reads one whole message, following continuation frames; type is -1 if
+/// none came within 20 s
+static std::string readMessage(WebSocketClient &ws, int &type) {
+  std::string got;
+  unsigned long start = millis();
+  for (;;) {
+    int n;
+    while (!(n = ws.parseMessage()) && millis() - start < 20000)
+      ;
+    if (!n) {
+      type = -1;
+      return got;
+    }
+    type = ws.messageType();
+    uint8_t buf[700];
+    while (ws.available() && millis() - start < 20000) {
+      int k = ws.read(buf, std::min((int)sizeof(buf), ws.available()));
+      if (k > 0)
+        got.append((char *)buf, k);
+    }
+    if (ws.isFinal())
+      return got;
+  }
+}
+
+static void testEcho(const char *path) {
+  PosixClient client;
+  WebSocketClient ws(client, "localhost", port);
+  CHECK(ws.begin(path) == 0, "begin(%s)", path);
+  const size_t sizes[] = {0,   1,   3,    4,     5,     125,  126, 127,
+                          128, 129, 200, 1000, 65535, 65536, 70001};
+  const size_t pieces[] = {1, 3, 64, 100000};
+  for (size_t size : sizes) {
+    for (size_t piece : pieces) {
+      if (piece == 1 && size > 2000)
+        continue;
+      std::string sent = pattern(size, size + piece);
+      CHECK(ws.beginMessage(TYPE_BINARY) == 0, "beginMessage()");
+      size_t written = 0;
+      for (size_t i = 0; i < size; i += piece)
+        written += ws.write((const uint8_t *)sent.data() + i,
+                            std::min(piece, size - i));
+      CHECK(written == size, "wrote %zu of %zu", written, size);
+      CHECK(ws.endMessage() == 0, "endMessage()");
+      if (!size) {
+        // Parses as size 0, the same as no message
+        delay(5);
+        CHECK(ws.parseMessage() == 0, "empty message");
+        continue;
+      }
+      if (size == 200)
+        ws.ping();
+      int type;
+      std::string got = readMessage(ws, type);
+      CHECK(type == TYPE_BINARY && got == sent,
+            "%s: %zu bytes written %zu at a time, got type %d, %zu bytes",
+            path, size, piece, type, got.size());
+    }
+  }
+
+  ws.beginMessage(TYPE_TEXT);
+  ws.print("hello world");
+  ws.endMessage();
+  unsigned long start = millis();
+  while (!ws.parseMessage() && millis() - start < 2000)
+    ;
+  CHECK(ws.peek() == 'h', "peek() %d", ws.peek());
+  String s = ws.readString();
+  CHECK(s == "hello world", "readString() \"%s\"", s.c_str());
+  CHECK(ws.peek() == -1, "peek() past the message");
+}
+
+/// Sends count messages to the sink, returns what the server counted
+static std::string sink(WebSocketClient &ws, int count, size_t size,
+                        bool json) {
+  std::string sent = pattern(size, 1);
+  for (int i = 0; i < count; i++) {
+    if (json) {
+      ws.beginMessage(TYPE_TEXT);
+      ws.print("{\"temp\":");
+      ws.print(20 + i % 10);
+      ws.print(",\"hum\":");
+      ws.print(40 + i % 7);
+      ws.print("}");
+    } else {
+      ws.beginMessage(TYPE_BINARY);
+      ws.write((const uint8_t *)sent.data(), size);
+    }
+    ws.endMessage();
+  }
+  ws.beginMessage(TYPE_TEXT);
+  ws.print("done");
+  ws.endMessage();
+  int type;
+  return readMessage(ws, type);
+}
+
+static void benchSend(int count, size_t size) {
+  PosixClient client;
+  WebSocketClient ws(client, "localhost", port);
+  ws.begin("/ws/sink");
+  unsigned long writes = client.writes, start = millis();
+  std::string counts = sink(ws, count, size, !size);
+  double secs = (millis() - start + 1) / 1000.0;
+  unsigned long messages = 0, frames = 0, bytes = 0;
+  sscanf(counts.c_str(), "%lu %lu %lu", &messages, &frames, &bytes);
+  CHECK(messages == (unsigned long)count && (!size || bytes == size * count),
+        "the server counted %s", counts.c_str());
+  if (size)
+    printf("  send %6zu B     ", size);
+  else
+    printf("  send print()ed JSON");
+  printf(" %8.0f msg/s %5.2f writes/msg %5.2f frames/msg\n", count / secs,
+         (double)(client.writes - writes - 1) / count,
+         (double)(frames - 1) / count);
+}
+
+static void benchReceive(int count, size_t size, bool masked) {
+  PosixClient client;
+  WebSocketClient ws(client, "localhost", port);
+  char path[64];
+  snprintf(path, sizeof(path), "/ws/source?n=%zu&k=%d%s", size, count,
+           masked ? "&mask=1" : "");
+  ws.begin(path);
+  std::string sent = expected(size);
+  unsigned long calls = client.calls, start = millis();
+  int got = 0, good = 0;
+  for (;;) {
+    int type;
+    std::string message = readMessage(ws, type);
+    if (type != TYPE_BINARY) {
+      CHECK(type == TYPE_TEXT && message == "end", "last message type %d",
+            type);
+      break;
+    }
+    got++;
+    good += message == sent;
+  }
+  double secs = (millis() - start + 1) / 1000.0;
+  CHECK(got == count && good == count, "%s: %d of %d messages, %d right",
+        path, got, count, good);
+  printf("  receive %6zu B %s %8.0f msg/s %6.1f client calls/msg\n", size,
+         masked ? "masked  " : "unmasked", count / secs,
+         (double)(client.calls - calls) / count);
+
+  // Sent when the server's ping, before the messages, was parsed
+  int type;
+  std::string pong = readMessage(ws, type);
+  CHECK(pong == "pong", "answer to the ping: %s", pong.c_str());
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    printf("usage: %s PORT\n", argv[0]);
+    return 2;
+  }
+  port = atoi(argv[1]);
+
+  printf("Echo\n");
+  testEcho("/ws/echo");
+  testEcho("/ws/echo?mask=1");
+
+  printf("Throughput\n");
+  benchSend(2000, 0);
+  const size_t sizes[4] = {16, 125, 1024, 16384};
+  for (size_t size : sizes)
+    benchSend(size > 1000 ? 500 : 2000, size);
+  for (size_t size : sizes) {
+    benchReceive(size > 1000 ? 500 : 2000, size, false);
+    benchReceive(size > 1000 ? 500 : 2000, size, true);
+  }
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
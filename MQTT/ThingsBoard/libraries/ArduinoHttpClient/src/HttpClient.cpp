@@ -9,10 +9,14 @@
 const char* HttpClient::kUserAgent = "Arduino/2.2.0";
 const char* HttpClient::kContentLengthPrefix = HTTP_HEADER_CONTENT_LENGTH ": ";
 const char* HttpClient::kTransferEncodingChunked = HTTP_HEADER_TRANSFER_ENCODING ": " HTTP_HEADER_VALUE_CHUNKED;
+const char* HttpClient::kConnectionClose = HTTP_HEADER_CONNECTION ": close";
 
 HttpClient::HttpClient(Client& aClient, const char* aServerName, uint16_t aServerPort)
  : iClient(&aClient), iServerName(aServerName), iServerAddress(), iServerPort(aServerPort),
-   iConnectionClose(true), iSendDefaultRequestHeaders(true)
+   iHttpResponseTimeout(kHttpResponseTimeout), iHttpWaitForDataDelay(kHttpWaitForDataDelay),
+   iConnectionClose(true), iReusable(false), iLastRequestTime(0),
+   iKeepAliveTimeout(kKeepAliveTimeout), iPipelineDepth(1), iQueuedResponses(0),
+   iSendDefaultRequestHeaders(true)
 {
   resetState();
 }
@@ -24,7 +28,10 @@ HttpClient::HttpClient(Client& aClient, const String& aServerName, uint16_t aSer
 
 HttpClient::HttpClient(Client& aClient, const IPAddress& aServerAddress, uint16_t aServerPort)
  : iClient(&aClient), iServerName(NULL), iServerAddress(aServerAddress), iServerPort(aServerPort),
-   iConnectionClose(true), iSendDefaultRequestHeaders(true)
+   iHttpResponseTimeout(kHttpResponseTimeout), iHttpWaitForDataDelay(kHttpWaitForDataDelay),
+   iConnectionClose(true), iReusable(false), iLastRequestTime(0),
+   iKeepAliveTimeout(kKeepAliveTimeout), iPipelineDepth(1), iQueuedResponses(0),
+   iSendDefaultRequestHeaders(true)
 {
   resetState();
 }
@@ -37,16 +44,36 @@ void HttpClient::resetState()
   iBodyLengthConsumed = 0;
   iContentLengthPtr = kContentLengthPrefix;
   iTransferEncodingChunkedPtr = kTransferEncodingChunked;
+  iConnectionClosePtr = kConnectionClose;
   iIsChunked = false;
   iChunkLength = 0;
-  iHttpResponseTimeout = kHttpResponseTimeout;
-  iHttpWaitForDataDelay = kHttpWaitForDataDelay;
+  iChunkLineLength = 0;
+  iChunkExtension = false;
 }
 
 void HttpClient::stop()
 {
   iClient->stop();
   resetState();
+  iReusable = false;
+  iQueuedResponses = 0;
+}
+
+int HttpClient::connect(IPAddress ip, uint16_t port)
+{
+  int ret = iClient->connect(ip, port);
+  // Only a connection to our own server is any use for later requests
+  iReusable = (ret > 0) && !iServerName && (ip == iServerAddress) && (port == iServerPort);
+  iLastRequestTime = millis();
+  return ret;
+}
+
+int HttpClient::connect(const char *host, uint16_t port)
+{
+  int ret = iClient->connect(host, port);
+  iReusable = (ret > 0) && iServerName && !strcmp(host, iServerName) && (port == iServerPort);
+  iLastRequestTime = millis();
+  return ret;
 }
 
 void HttpClient::connectionKeepAlive()
@@ -61,18 +88,98 @@ void HttpClient::noDefaultRequestHeaders()
 
 void HttpClient::beginRequest()
 {
+  prepareRequest();
   iState = eRequestStarted;
 }
 
-int HttpClient::startRequest(const char* aURLPath, const char* aHttpMethod, 
-                                const char* aContentType, int aContentLength, const byte aBody[])
+void HttpClient::prepareRequest()
 {
-    if (iState == eReadingBody || iState == eReadingChunkLength || iState == eReadingBodyChunk)
+    if (iState < eRequestSent)
+    {
+        // Nothing outstanding, or this request has already been started
+        return;
+    }
+
+    if ((iState == eRequestSent) && (iQueuedResponses + 1 < iPipelineDepth) &&
+        connectionReusable())
+    {
+        // None of the waiting responses has been read yet, so this request
+        // can go out now and its response be read after theirs
+        iQueuedResponses++;
+        iState = eIdle;
+        return;
+    }
+
+    // Read out the waiting responses so the connection can be reused,
+    // anything that goes wrong means we have to reconnect
+    bool reusable = !iConnectionClose && iReusable;
+    while (reusable)
+    {
+        reusable = finishResponse();
+        if (!iQueuedResponses)
+        {
+            break;
+        }
+        startNextResponse();
+    }
+    if (!reusable)
     {
         flushClientRx();
+        iReusable = false;
+    }
+    iQueuedResponses = 0;
+    resetState();
+}
 
-        resetState();
+bool HttpClient::finishResponse()
+{
+    if ((iState == eRequestSent) && (responseStatusCode() < 0))
+    {
+        return false;
+    }
+    if ((iState < eStatusCodeRead) ||
+        (!endOfHeadersReached() && (skipResponseHeaders() != HTTP_SUCCESS)))
+    {
+        // Part way through a status line we can't make sense of, or the
+        // headers never ended
+        return false;
+    }
+    if (!iReusable || (iStatusCode == 101))
+    {
+        // The server said it will close the connection, or it has switched
+        // to another protocol (e.g. WebSockets)
+        return false;
     }
+    if ((iStatusCode == 204) || (iStatusCode == 304))
+    {
+        // These never have a body
+        return true;
+    }
+    if (!iIsChunked && (iContentLength == kNoContentLengthHeader))
+    {
+        // A body without a length only ends when the connection closes
+        return false;
+    }
+    return (skipResponseBody() == HTTP_SUCCESS);
+}
+
+void HttpClient::startNextResponse()
+{
+    iQueuedResponses--;
+    resetState();
+    iState = eRequestSent;
+}
+
+bool HttpClient::connectionReusable()
+{
+    return !iConnectionClose && iReusable && iClient->connected() &&
+           ((millis() - iLastRequestTime) < iKeepAliveTimeout);
+}
+
+int HttpClient::startRequest(const char* aURLPath, const char* aHttpMethod, 
+                                const char* aContentType, int aContentLength, const byte aBody[])
+{
+    prepareRequest();
 
     tHttpState initialState = iState;
 
@@ -81,11 +188,13 @@ int HttpClient::startRequest(const char* aURLPath, const char* aHttpMethod,
         return HTTP_ERROR_API;
     }
 
-    if (iConnectionClose || !iClient->connected())
+    if (!connectionReusable())
     {
+        // Any responses still queued went with the old connection
+        iQueuedResponses = 0;
         if (iServerName)
         {
-            if (!(iClient->connect(iServerName, iServerPort) > 0))
+            if (!(connect(iServerName, iServerPort) > 0))
             {
 #ifdef LOGGING
                 Serial.println("Connection failed");
@@ -95,7 +204,7 @@ int HttpClient::startRequest(const char* aURLPath, const char* aHttpMethod,
         }
         else
         {
-            if (!(iClient->connect(iServerAddress, iServerPort) > 0))
+            if (!(connect(iServerAddress, iServerPort) > 0))
             {
 #ifdef LOGGING
                 Serial.println("Connection failed");
@@ -257,6 +366,7 @@ void HttpClient::finishHeaders()
 {
     iClient->println();
     iState = eRequestSent;
+    iLastRequestTime = millis();
 }
 
 void HttpClient::flushClientRx()
@@ -398,6 +508,17 @@ int HttpClient::responseStatusCode()
     {
         return HTTP_ERROR_API;
     }
+
+    if ((iState > eRequestSent) && iQueuedResponses)
+    {
+        // Pipelined, so this is a call for the next response
+        if (!finishResponse())
+        {
+            iReusable = false;
+            return HTTP_ERROR_INVALID_RESPONSE;
+        }
+        startNextResponse();
+    }
     // The first line will be of the form Status-Line:
     //   HTTP-Version SP Status-Code SP Reason-Phrase CRLF
     // Where HTTP-Version is of the form:
@@ -470,6 +591,13 @@ int HttpClient::responseStatusCode()
                     timeoutStart = millis();
                 }
             }
+            else if (!iClient->connected())
+            {
+                // No point waiting, e.g. a kept-alive connection the server
+                // closed while it was idle
+                iReusable = false;
+                return HTTP_ERROR_CONNECTION_FAILED;
+            }
             else
             {
                 // We haven't got any data, so let's pause to allow some to
@@ -540,7 +668,9 @@ int HttpClient::skipResponseHeaders()
 
 bool HttpClient::endOfHeadersReached()
 {
-    return (iState == eReadingBody || iState == eReadingChunkLength || iState == eReadingBodyChunk);
+    return (iState == eReadingBody || iState == eReadingChunkLength ||
+            iState == eReadingBodyChunk || iState == eReadingChunkTrailer ||
+            iState == eChunkedBodyDone);
 };
 
 long HttpClient::contentLength()
@@ -568,24 +698,28 @@ String HttpClient::responseBody()
         }
     }
 
-    // keep on timedRead'ing, until:
-    //  - we have a content length: body length equals consumed or no bytes
-    //                              available
-    //  - no content length:        no bytes are available
-    while (iBodyLengthConsumed != bodyLength)
+    // Read in blocks until readBody() comes up short, which happens at the
+    // end of the body or when the read times out
+    char buffer[kBodyBlockSize + 1];
+    int n;
+    do
     {
-        int c = timedRead();
-
-        if (c == -1) {
-            // read timed out, done
-            break;
-        }
-
-        if (!response.concat((char)c)) {
-            // adding char failed
-            return String((const char*)NULL);
+        n = readBody((uint8_t*)buffer, kBodyBlockSize);
+        buffer[n] = '\0';
+        // concat() stops at a NUL, so a block holding one goes in piecewise
+        for (int i = 0; i < n; i++)
+        {
+            int len = strlen(buffer + i);
+            if (!response.concat(buffer + i) ||
+                ((i + len < n) && !response.concat('\0')))
+            {
+                // adding to the string failed
+                return String((const char*)NULL);
+            }
+            i += len;
         }
     }
+    while (n == kBodyBlockSize);
 
     if (bodyLength > 0 && (unsigned int)bodyLength != response.length()) {
         // failure, we did not read in response content length bytes
@@ -595,8 +729,70 @@ String HttpClient::responseBody()
     return response;
 }
 
+int HttpClient::readBody(uint8_t* aBuffer, size_t aSize)
+{
+    // skip the response headers, if they haven't been read already
+    contentLength();
+
+    size_t total = 0;
+    unsigned long timeoutStart = millis();
+    while ((total < aSize) && !endOfBodyReached() &&
+           ((millis() - timeoutStart) < _timeout))
+    {
+        int n = read(aBuffer + total, aSize - total);
+        if (n > 0)
+        {
+            total += n;
+            // We read something, reset the timeout counter
+            timeoutStart = millis();
+        }
+        else if (!iIsChunked && (iContentLength == kNoContentLengthHeader) &&
+                 !iClient->connected() && !iClient->available())
+        {
+            // Without a length the body ends when the server closes
+            break;
+        }
+        else
+        {
+            yield();
+        }
+    }
+    return total;
+}
+
+int HttpClient::skipResponseBody()
+{
+    uint8_t buffer[kBodyBlockSize];
+    while (readBody(buffer, sizeof(buffer)) == (int)sizeof(buffer))
+    {
+    }
+
+    if (endOfBodyReached() ||
+        (!iIsChunked && (iContentLength == kNoContentLengthHeader) &&
+         !iClient->connected()))
+    {
+        return HTTP_SUCCESS;
+    }
+    return HTTP_ERROR_TIMED_OUT;
+}
+
+size_t HttpClient::readBytes(char *buffer, size_t length)
+{
+    if (!endOfHeadersReached())
+    {
+        return Stream::readBytes(buffer, length);
+    }
+    return readBody((uint8_t*)buffer, length);
+}
+
 bool HttpClient::endOfBodyReached()
 {
+    if (iIsChunked && endOfHeadersReached())
+    {
+        // The end is the empty line after the last chunk's trailer
+        readChunkHeader();
+        return (iState == eChunkedBodyDone);
+    }
     if (endOfHeadersReached() && (contentLength() != kNoContentLengthHeader))
     {
         // We've got to the body and we know how long it will be
@@ -605,48 +801,95 @@ bool HttpClient::endOfBodyReached()
     return false;
 }
 
-int HttpClient::available()
+void HttpClient::readChunkHeader()
 {
-    if (iState == eReadingChunkLength)
+    while ((iState == eReadingChunkLength || iState == eReadingChunkTrailer) &&
+           iClient->available())
     {
-        while (iClient->available())
-        {
-            char c = iClient->read();
+        char c = iClient->read();
 
-            if (c == '\n')
+        if (c == '\r')
+        {
+            // no-op
+        }
+        else if (c != '\n')
+        {
+            iChunkLineLength++;
+            if (c == ';')
             {
-                iState = eReadingBodyChunk;
-                break;
+                iChunkExtension = true;
             }
-            else if (c == '\r')
+            else if ((iState == eReadingChunkLength) && !iChunkExtension &&
+                     isHexadecimalDigit(c))
             {
-                // no-op
+                iChunkLength = (iChunkLength * 16) +
+                               ((c <= '9') ? (c - '0') : ((c | 0x20) - 'a' + 10));
             }
-            else if (isHexadecimalDigit(c))
+        }
+        else if (iChunkLineLength == 0)
+        {
+            // The CRLF closing the previous chunk's data, or the empty line
+            // ending the trailer after the last chunk
+            if (iState == eReadingChunkTrailer)
             {
-                char digit[2] = {c, '\0'};
-
-                iChunkLength = (iChunkLength * 16) + strtol(digit, NULL, 16);
+                iState = eChunkedBodyDone;
             }
         }
+        else
+        {
+            if (iState == eReadingChunkLength)
+            {
+                // A zero size chunk is the last one, a trailer follows it
+                iState = iChunkLength ? eReadingBodyChunk : eReadingChunkTrailer;
+            }
+            iChunkLineLength = 0;
+            iChunkExtension = false;
+        }
     }
+}
 
-    if (iState == eReadingBodyChunk && iChunkLength == 0)
+void HttpClient::bodyConsumed(int aCount)
+{
+    if (endOfHeadersReached() && iContentLength > 0)
     {
-        iState = eReadingChunkLength;
+        // We're outputting the body now and we've seen a Content-Length header
+        // So keep track of how many bytes are left
+        iBodyLengthConsumed += aCount;
     }
-    
-    if (iState == eReadingChunkLength)
+
+    if (iState == eReadingBodyChunk)
+    {
+        iChunkLength -= aCount;
+
+        if (iChunkLength == 0)
+        {
+            iState = eReadingChunkLength;
+        }
+    }
+}
+
+int HttpClient::available()
+{
+    readChunkHeader();
+
+    if (iState == eReadingChunkLength || iState == eReadingChunkTrailer ||
+        iState == eChunkedBodyDone)
     {
         return 0;
     }
-    
+
     int clientAvailable = iClient->available();
 
     if (iState == eReadingBodyChunk)
     {
         return min(clientAvailable, iChunkLength);
     }
+    else if (endOfHeadersReached() && iContentLength >= 0)
+    {
+        // Don't offer bytes past the end of the body, on a kept-alive
+        // connection they belong to the next response
+        return (int)min((long)clientAvailable, iContentLength - iBodyLengthConsumed);
+    }
     else
     {
         return clientAvailable;
@@ -656,7 +899,7 @@ int HttpClient::available()
 
 int HttpClient::read()
 {
-    if (iIsChunked && !available())
+    if (endOfHeadersReached() && !HttpClient::available())
     {
         return -1;
     }
@@ -664,26 +907,41 @@ int HttpClient::read()
     int ret = iClient->read();
     if (ret >= 0)
     {
-        if (endOfHeadersReached() && iContentLength > 0)
-        {
-            // We're outputting the body now and we've seen a Content-Length header
-            // So keep track of how many bytes are left
-            iBodyLengthConsumed++;
-        }
+        bodyConsumed(1);
+    }
+    return ret;
+}
 
-        if (iState == eReadingBodyChunk)
+int HttpClient::read(uint8_t *buf, size_t size)
+{
+    if (endOfHeadersReached() && (iIsChunked || iContentLength >= 0))
+    {
+        // Stay within the current chunk, or the body, so the bytes after it
+        // are left for the chunk header or the next response
+        size = min(size, (size_t)HttpClient::available());
+        if (size == 0)
         {
-            iChunkLength--;
-
-            if (iChunkLength == 0)
-            {
-                iState = eReadingChunkLength;
-            }
+            return 0;
         }
     }
+
+    int ret = iClient->read(buf, size);
+    if (ret > 0)
+    {
+        bodyConsumed(ret);
+    }
     return ret;
 }
 
+int HttpClient::peek()
+{
+    if (endOfHeadersReached() && !HttpClient::available())
+    {
+        return -1;
+    }
+    return iClient->peek();
+}
+
 bool HttpClient::headerAvailable()
 {
     // clear the currently stored header line
@@ -746,19 +1004,18 @@ String HttpClient::readHeaderValue()
     return iHeaderLine.substring(startIndex);
 }
 
-int HttpClient::read(uint8_t *buf, size_t size)
+// Moves aPrefix along if c is its next character, ignoring case, else
+// stops it matching for the rest of the line.  Prefixes like "Content-Length"
+// and "Connection" start the same, so each one is followed on its own
+static bool matchHeaderPrefix(const char*& aPrefix, char c)
 {
-    int ret =iClient->read(buf, size);
-    if (endOfHeadersReached() && iContentLength > 0)
+    if (!*aPrefix || (tolower((unsigned char)*aPrefix) != tolower((unsigned char)c)))
     {
-        // We're outputting the body now and we've seen a Content-Length header
-        // So keep track of how many bytes are left
-        if (ret >= 0)
-        {
-            iBodyLengthConsumed += ret;
-        }
+        aPrefix = "";
+        return false;
     }
-    return ret;
+    aPrefix++;
+    return (*aPrefix == '\0');
 }
 
 int HttpClient::readHeader()
@@ -778,41 +1035,37 @@ int HttpClient::readHeader()
     {
     case eStatusCodeRead:
         // We're at the start of a line, or somewhere in the middle of reading
-        // the Content-Length prefix
-        if (*iContentLengthPtr == c)
+        // one of the prefixes we look for
+        if ((iContentLengthPtr == kContentLengthPrefix) && (c == '\r'))
         {
-            // This character matches, just move along
-            iContentLengthPtr++;
-            if (*iContentLengthPtr == '\0')
-            {
-                // We've reached the end of the prefix
-                iState = eReadingContentLength;
-                // Just in case we get multiple Content-Length headers, this
-                // will ensure we just get the value of the last one
-                iContentLength = 0;
-                iBodyLengthConsumed = 0;
-            }
+            // We've found a '\r' at the start of a line, so this is probably
+            // the end of the headers
+            iState = eLineStartingCRFound;
         }
-        else if (*iTransferEncodingChunkedPtr == c)
+        else if (matchHeaderPrefix(iContentLengthPtr, c))
         {
-            // This character matches, just move along
-            iTransferEncodingChunkedPtr++;
-            if (*iTransferEncodingChunkedPtr == '\0')
-            {
-                // We've reached the end of the Transfer Encoding: chunked header
-                iIsChunked = true;
-                iState = eSkipToEndOfHeader;
-            }
+            // We've reached the end of the prefix
+            iState = eReadingContentLength;
+            // Just in case we get multiple Content-Length headers, this
+            // will ensure we just get the value of the last one
+            iContentLength = 0;
+            iBodyLengthConsumed = 0;
         }
-        else if (((iContentLengthPtr == kContentLengthPrefix) && (iTransferEncodingChunkedPtr == kTransferEncodingChunked)) && (c == '\r'))
+        else if (matchHeaderPrefix(iTransferEncodingChunkedPtr, c))
         {
-            // We've found a '\r' at the start of a line, so this is probably
-            // the end of the headers
-            iState = eLineStartingCRFound;
+            // We've reached the end of the Transfer Encoding: chunked header
+            iIsChunked = true;
+            iState = eSkipToEndOfHeader;
         }
-        else
+        else if (matchHeaderPrefix(iConnectionClosePtr, c))
+        {
+            // The server will close the connection after this response
+            iReusable = false;
+            iState = eSkipToEndOfHeader;
+        }
+        else if (!*iContentLengthPtr && !*iTransferEncodingChunkedPtr && !*iConnectionClosePtr)
         {
-            // This isn't the Content-Length or Transfer Encoding chunked header, skip to the end of the line
+            // This isn't a header we're interested in, skip to the end of the line
             iState = eSkipToEndOfHeader;
         }
         break;
@@ -854,6 +1107,7 @@ int HttpClient::readHeader()
         iState = eStatusCodeRead;
         iContentLengthPtr = kContentLengthPrefix;
         iTransferEncodingChunkedPtr = kTransferEncodingChunked;
+        iConnectionClosePtr = kConnectionClose;
     }
     // And return the character read to whoever wants it
     return c;
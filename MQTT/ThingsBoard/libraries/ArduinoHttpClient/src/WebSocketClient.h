@@ -8,6 +8,8 @@
 
 #include "HttpClient.h"
 
+// Outgoing message bytes held until endMessage(), a longer message is sent
+// as several frames as it is written
 #ifndef WS_TX_BUFFER_SIZE
   #define WS_TX_BUFFER_SIZE 128
 #endif
@@ -36,12 +38,16 @@ public:
     /** Begin to send a message of type (TYPE_TEXT or TYPE_BINARY)
         Use the write or Stream API's to set message content, followed by endMessage
         to complete the message.
+        The content is masked as it is written.  Up to WS_TX_BUFFER_SIZE bytes
+        are held back, a write that doesn't fit is sent straight away as a
+        fragment of the message, so messages of any length can be sent.
       @param aURLPath     Path to use in request
       @return 0 if successful, else error
     */
     int beginMessage(int aType);
 
     /** Completes sending of a message started by beginMessage
+        Sends the held back content, and the frame header, with one write
       @return 0 if successful, else error
     */
     int endMessage();
@@ -81,23 +87,39 @@ public:
       @return Byte read or -1 if there are no bytes available.
     */
     virtual int read();
+    /** Read up to size bytes of the current message, unmasked in place.
+        Stops at the end of the current frame.
+      @return Number of bytes read
+    */
     virtual int read(uint8_t *buf, size_t size);
     virtual int peek();
 
 private:
     void flushRx();
+    bool readFrameHeader(uint8_t* aBuffer, size_t aSize);
+    bool sendFrame(uint64_t aLength, bool aFinal);
+    void newMaskKey();
+    static void mask(uint8_t* aDest, const uint8_t* aSource, size_t aSize,
+                     const uint8_t* aMaskKey, size_t aMaskIndex);
+
+    static const int kMaskKeySize = 4;
+    // Longest frame header: opcode, length, 64-bit extended length, mask key
+    static const int kMaxFrameHeaderSize = 14;
 
 private:
     bool iTxStarted;
+    // A fragment of the current message has been sent
+    bool iTxFragmented;
     uint8_t iTxMessageType;
-    uint8_t iTxBuffer[WS_TX_BUFFER_SIZE];
+    // Room for the frame header, which ends with the mask key, then the data
+    uint8_t iTxBuffer[kMaxFrameHeaderSize + WS_TX_BUFFER_SIZE];
     uint64_t iTxSize;
 
     uint8_t iRxOpCode;
     uint64_t iRxSize;
     bool iRxMasked;
     int iRxMaskIndex;
-    uint8_t iRxMaskKey[4];
+    uint8_t iRxMaskKey[kMaskKeySize];
 };
 
 #endif
@@ -0,0 +1,17 @@
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define F(x) (x)
+
+/// Virtual time in ms, advanced by the test and by delay() and yield()
+extern uint32_t fakeMillis;
+
+inline uint32_t millis(void) { return fakeMillis; }
+inline void delay(uint32_t ms) { fakeMillis += ms; }
+inline void yield(void) { fakeMillis += 1; }
+
+#endif
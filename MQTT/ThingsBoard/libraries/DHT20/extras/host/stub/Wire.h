@@ -0,0 +1,72 @@
+#ifndef _HOST_WIRE_H
+#define _HOST_WIRE_H
+
+#include "Arduino.h"
+
+#include <vector>
+
+/// TwoWire with a DHT20 behind it. A measurement, triggered by AC 33 00,
+/// takes 'latency' ms, and the status byte has bit 7 (busy) set until then.
+/// Faults: a bad CRC, a NACK on every transfer, a sensor stuck busy.
+class TwoWire {
+public:
+  uint32_t latency = 80, measureStart = 0;
+  unsigned long transactions = 0;
+  bool measuring = false, badCrc = false, nack = false, stuck = false;
+  uint32_t rawHumidity = 0x80000, rawTemperature = 0x60000; ///< 50 %, 25 C
+
+  void begin(void) {}
+  void beginTransmission(uint8_t) { tx.clear(); }
+  size_t write(uint8_t b) {
+    tx.push_back(b);
+    return 1;
+  }
+  uint8_t endTransmission(void) {
+    transactions++;
+    if (nack)
+      return 2;
+    if (tx.size() == 3 && tx[0] == 0xAC && tx[1] == 0x33) {
+      measuring = true;
+      measureStart = millis();
+    }
+    return 0;
+  }
+  uint8_t requestFrom(uint8_t, uint8_t n) {
+    transactions++;
+    if (nack)
+      return 0;
+    bool busy = measuring && (stuck || millis() - measureStart < latency);
+    if (measuring && !busy)
+      measuring = false;
+    uint8_t b[7] = {(uint8_t)(0x18 | (busy ? 0x80 : 0)),
+                    (uint8_t)(rawHumidity >> 12),
+                    (uint8_t)(rawHumidity >> 4),
+                    (uint8_t)((rawHumidity << 4) | (rawTemperature >> 16)),
+                    (uint8_t)(rawTemperature >> 8),
+                    (uint8_t)rawTemperature,
+                    0};
+    b[6] = crc(b, 6) ^ (badCrc ? 1 : 0);
+    rx.assign(b, b + (n < 7 ? n : 7));
+    rxPos = 0;
+    return rx.size();
+  }
+  int read(void) { return rxPos < rx.size() ? rx[rxPos++] : -1; }
+
+private:
+  std::vector<uint8_t> tx, rx;
+  size_t rxPos = 0;
+
+  static uint8_t crc(const uint8_t *p, int n) {
+    uint8_t c = 0xFF;
+    while (n--) {
+      c ^= *p++;
+      for (int i = 0; i < 8; i++)
+        c = (c & 0x80) ? (c << 1) ^ 0x31 : c << 1;
+    }
+    return c;
+  }
+};
+
+extern TwoWire Wire;
+
+#endif
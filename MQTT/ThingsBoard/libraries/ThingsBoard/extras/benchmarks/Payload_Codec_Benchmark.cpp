@@ -0,0 +1,139 @@
+// Host benchmark of the payload codecs, compares the size and the serialization and deserialization time of typical ThingsBoard payloads,
+// when they are sent as text JSON (Json_Codec) or MessagePack (MsgPack_Codec). Additionally sends telemetry through the ThingsBoard client
+// with a fake MQTT client, to ensure the published payloads decode to the same key value pairs with both codecs.
+//
+// Build and run from this directory on a desktop compiler, no Arduino core is needed:
+//   g++ -std=c++17 -O2 -I../../src -I../../../ArduinoJson/src Payload_Codec_Benchmark.cpp ../../src/*_Codec.cpp ../../src/Helper.cpp ../../src/Telemetry.cpp ../../src/RPC_Request_Callback.cpp -o Payload_Codec_Benchmark
+//   ./Payload_Codec_Benchmark
+#define THINGSBOARD_ENABLE_OTA 0
+#define ARDUINOJSON_USE_DOUBLE 1
+#define ARDUINOJSON_USE_LONG_LONG 1
+
+// Local includes.
+#include "ThingsBoard.h"
+#include "Json_Codec.h"
+#include "MsgPack_Codec.h"
+
+// Library includes.
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+
+constexpr size_t ITERATIONS = 200000U;
+constexpr size_t BUFFER_SIZE = 512U;
+
+/// @brief MQTT client that keeps the last published payload instead of sending it
+class Recording_MQTT_Client : public IMQTT_Client {
+  public:
+    std::string last_payload;
+
+    void set_data_callback(data_function) override {}
+    void set_connect_callback(connect_function) override {}
+    bool set_buffer_size(uint16_t const &) override { return true; }
+    uint16_t get_buffer_size() override { return 1024U; }
+    void set_server(char const * const, uint16_t const &) override {}
+    bool connect(char const * const, char const * const, char const * const) override { return true; }
+    void disconnect() override {}
+    bool loop() override { return true; }
+    bool publish(char const * const, uint8_t const * const payload, size_t const & length) override {
+        last_payload.assign(reinterpret_cast<char const *>(payload), length);
+        return true;
+    }
+    bool subscribe(char const * const) override { return true; }
+    bool unsubscribe(char const * const) override { return true; }
+    bool connected() override { return true; }
+};
+
+static bool failed = false;
+
+/// @brief Returns the time one call of the given function takes in nanoseconds, averaged over ITERATIONS calls
+template <typename Function>
+static double time_ns(Function const & function) {
+    auto const start = std::chrono::steady_clock::now();
+    for (size_t i = 0U; i < ITERATIONS; i++) {
+        function();
+    }
+    auto const stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / ITERATIONS;
+}
+
+/// @brief Serializes the given payload with the given codec, and checks that deserializing it again results in the same key value pairs
+static void run_codec(IPayload_Codec const & codec, JsonDocument const & source, size_t & size, double & serialize_ns, double & deserialize_ns) {
+    uint8_t buffer[BUFFER_SIZE] = {};
+    uint8_t payload[BUFFER_SIZE] = {};
+    size = codec.serialize(source, buffer, sizeof(buffer));
+    if (size != codec.measure(source)) {
+        printf("FAIL measure() returned %zu, but serialize() wrote %zu bytes\n", codec.measure(source), size);
+        failed = true;
+    }
+
+    StaticJsonDocument<1024> destination;
+    memcpy(payload, buffer, size);
+    if (codec.deserialize(destination, payload, size) != DeserializationError::Ok || destination != source) {
+        printf("FAIL payload did not survive the round trip\n");
+        failed = true;
+    }
+    if (codec.estimate_member_count(buffer, size) < source.size()) {
+        printf("FAIL estimate_member_count() is below the actual member count\n");
+        failed = true;
+    }
+
+    volatile size_t sink = 0U;
+    serialize_ns = time_ns([&] { sink += codec.serialize(source, buffer, sizeof(buffer)); });
+    // The payload is copied before every call, because the zero copy mode of ArduinoJson modifies it in place
+    deserialize_ns = time_ns([&] {
+        memcpy(payload, buffer, size);
+        sink += codec.deserialize(destination, payload, size) == DeserializationError::Ok;
+    });
+}
+
+static void run_payload(char const * const name, char const * const json) {
+    Json_Codec const json_codec;
+    MsgPack_Codec const msgpack_codec;
+    StaticJsonDocument<1024> source;
+    deserializeJson(source, json);
+
+    size_t json_size = 0U, msgpack_size = 0U;
+    double json_serialize = 0.0, json_deserialize = 0.0, msgpack_serialize = 0.0, msgpack_deserialize = 0.0;
+    run_codec(json_codec, source, json_size, json_serialize, json_deserialize);
+    run_codec(msgpack_codec, source, msgpack_size, msgpack_serialize, msgpack_deserialize);
+    printf("%-16s %4zu -> %4zu B | serialize %5.0f -> %5.0f ns | deserialize %5.0f -> %5.0f ns\n",
+           name, json_size, msgpack_size, json_serialize, msgpack_serialize, json_deserialize, msgpack_deserialize);
+}
+
+/// @brief Sends the same telemetry through the client with both codecs and compares the decoded payloads
+static void run_client() {
+    Recording_MQTT_Client client;
+    ThingsBoard tb(client);
+    MsgPack_Codec const msgpack_codec;
+    Telemetry const data[] = {{"temperature", 27.5}, {"humidity", 61}, {"relay", true}, {"status", "ok"}};
+
+    tb.sendTelemetry(&data[0], &data[4]);
+    std::string const json = client.last_payload;
+    tb.setPayloadCodec(msgpack_codec);
+    tb.sendTelemetry(&data[0], &data[4]);
+    std::string const msgpack = client.last_payload;
+
+    StaticJsonDocument<256> from_json, from_msgpack;
+    deserializeJson(from_json, json);
+    deserializeMsgPack(from_msgpack, msgpack.data(), msgpack.size());
+    if (from_json != from_msgpack) {
+        printf("FAIL published payloads differ\n");
+        failed = true;
+    }
+    printf("sendTelemetry()  %4zu -> %4zu B published\n", json.size(), msgpack.size());
+}
+
+int main() {
+    printf("JSON -> MessagePack, %zu iterations\n", ITERATIONS);
+    run_payload("telemetry", "{\"temperature\":27.5,\"humidity\":61}");
+    run_payload("telemetry 8 keys", "{\"temperature\":27.5,\"humidity\":61,\"pressure\":1013,\"co2\":412,\"relay1\":true,\"relay2\":false,\"rssi\":-67,\"uptime\":123456}");
+    run_payload("attributes", "{\"fw_version\":\"1.2.3\",\"mac\":\"AA:BB:CC:DD:EE:FF\",\"ip\":\"192.168.1.20\",\"interval\":5000}");
+    run_payload("rpc request", "{\"method\":\"setRelay\",\"params\":{\"relay\":3,\"state\":true}}");
+    run_payload("shared update", "{\"shared\":{\"ledState\":true,\"blinkingInterval\":1000}}");
+    run_client();
+    printf("%s\n", failed ? "FAILURES" : "all checks passed");
+    return failed ? 1 : 0;
+}
@@ -7,20 +7,6 @@
 // Library includes.
 #include <string.h>
 
-size_t Helper::getOccurences(char const * const str, char symbol) {
-    size_t count = 0;
-    if (str == nullptr) {
-      return count;
-    }
-    for (size_t i = 0; i < strlen(str); ++i) {
-      if (str[i] != symbol) {
-        continue;
-      }
-      count++;
-    }
-    return count;
-}
-
 bool Helper::stringIsNullorEmpty(char const * const str) {
     return str == nullptr || str[0] == '\0';
 }
@@ -32,12 +32,6 @@ class Helper {
         return result;
     }
 
-    /// @brief Returns the amount of occurences of the given smybol in the given string
-    /// @param str String that we want to check the symbol in
-    /// @param symbol Symbols we want to search for
-    /// @return Amount of occurences of the given symbol
-    static size_t getOccurences(char const * const str, char symbol);
-
     /// @brief Returns wheter the given string is either a nullptr or is an empty string,
     /// meaning it only contains a null terminator and no other characters
     /// @param str String that we want to check for emptiness
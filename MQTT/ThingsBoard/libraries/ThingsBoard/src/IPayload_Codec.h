@@ -0,0 +1,63 @@
+#ifndef IPayload_Codec_h
+#define IPayload_Codec_h
+
+// Local include.
+#include "Configuration.h"
+
+// Library includes.
+#include <ArduinoJson.h>
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+#include <Print.h>
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+#include <stdint.h>
+#include <stddef.h>
+
+
+/// @brief Payload codec interface that contains the methods that a class that converts the payloads sent to and received from ThingsBoard should implement.
+/// Seperates the wire format from the ThingsBoard client, the default is text JSON (Json_Codec), but telemetry, attributes and RPC can travel as MessagePack instead (MsgPack_Codec),
+/// as long as the server side is configured for it, for example with a transformation in a local gateway that converts the payloads from and to JSON before they reach ThingsBoard.
+/// Other formats, like CBOR, can be supported by implementing this interface.
+/// Payloads passed as a string, for example with sendTelemetryJson(char const * const json), are always sent as is, regardless of the codec.
+class IPayload_Codec {
+  public:
+    /// @brief Whether the serialized payloads are human readable text, if they are they can be printed to the console when debugging,
+    /// additionally the size passed to Send_Json, which is calculated with Helper::Measure_Json, only applies to text JSON payloads
+    /// @return Whether the serialized payloads are text
+    virtual bool is_text() const = 0;
+
+    /// @brief Calculates the amount of bytes the serialized payload of the given source will need, without any null terminator
+    /// @param source Data source containing our key value pairs we want to measure
+    /// @return Amount of bytes the serialize method would write
+    virtual size_t measure(JsonVariantConst const & source) const = 0;
+
+    /// @brief Serializes the given source into the given buffer, text formats additionally append a null terminator if there is enough space left
+    /// @param source Data source containing our key value pairs we want to serialize
+    /// @param buffer Buffer the serialized payload is written into
+    /// @param size Total size of the given buffer
+    /// @return Amount of bytes written into the buffer, without any null terminator
+    virtual size_t serialize(JsonVariantConst const & source, uint8_t * const buffer, size_t const & size) const = 0;
+
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+    /// @brief Serializes the given source directly into the given output, used to send payloads that are bigger than the internal buffer of the MQTT Client
+    /// @param source Data source containing our key value pairs we want to serialize
+    /// @param output Output the serialized payload is written into
+    /// @return Amount of bytes written into the output
+    virtual size_t serialize(JsonVariantConst const & source, Print & output) const = 0;
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+
+    /// @brief Deserializes the given received payload into the given JsonDocument
+    /// @param destination JsonDocument the deserialized key value pairs are written into, is cleared beforehand
+    /// @param payload Writeable payload received from the server, allows the implementation to use the zero copy mode of ArduinoJson
+    /// @param length Total length of the received payload
+    /// @return Error that occured while deserializing or DeserializationError::Ok if there was none
+    virtual DeserializationError deserialize(JsonDocument & destination, uint8_t * const payload, size_t const & length) const = 0;
+
+    /// @brief Estimates the amount of key value pairs contained in the given received payload,
+    /// used to calculate the size of the JsonDocument the payload is deserialized into, if THINGSBOARD_ENABLE_DYNAMIC is enabled
+    /// @param payload Payload received from the server
+    /// @param length Total length of the received payload
+    /// @return Estimated amount of key value pairs
+    virtual size_t estimate_member_count(uint8_t const * const payload, size_t const & length) const = 0;
+};
+
+#endif // IPayload_Codec_h
@@ -0,0 +1,38 @@
+// Header include.
+#include "Json_Codec.h"
+
+// Every key value pair in a JSON object is seperated by exactly one colon,
+// colons inside of strings are counted as well, which only results in a too big estimate
+constexpr char COLON = ':';
+
+bool Json_Codec::is_text() const {
+    return true;
+}
+
+size_t Json_Codec::measure(JsonVariantConst const & source) const {
+    return measureJson(source);
+}
+
+size_t Json_Codec::serialize(JsonVariantConst const & source, uint8_t * const buffer, size_t const & size) const {
+    return serializeJson(source, buffer, size);
+}
+
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+size_t Json_Codec::serialize(JsonVariantConst const & source, Print & output) const {
+    return serializeJson(source, output);
+}
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+
+DeserializationError Json_Codec::deserialize(JsonDocument & destination, uint8_t * const payload, size_t const & length) const {
+    return deserializeJson(destination, payload, length);
+}
+
+size_t Json_Codec::estimate_member_count(uint8_t const * const payload, size_t const & length) const {
+    size_t count = 0U;
+    for (size_t i = 0U; i < length; i++) {
+        if (payload[i] == COLON) {
+            count++;
+        }
+    }
+    return count;
+}
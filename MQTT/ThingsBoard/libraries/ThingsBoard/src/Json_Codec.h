@@ -0,0 +1,27 @@
+#ifndef Json_Codec_h
+#define Json_Codec_h
+
+// Local include.
+#include "IPayload_Codec.h"
+
+
+/// @brief Payload codec interface implementation that sends and receives the payloads as text JSON, which is the default format expected by ThingsBoard
+/// and the one used by the ThingsBoard client if no other codec has been set with setPayloadCodec()
+class Json_Codec : public IPayload_Codec {
+  public:
+    bool is_text() const override;
+
+    size_t measure(JsonVariantConst const & source) const override;
+
+    size_t serialize(JsonVariantConst const & source, uint8_t * const buffer, size_t const & size) const override;
+
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+    size_t serialize(JsonVariantConst const & source, Print & output) const override;
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+
+    DeserializationError deserialize(JsonDocument & destination, uint8_t * const payload, size_t const & length) const override;
+
+    size_t estimate_member_count(uint8_t const * const payload, size_t const & length) const override;
+};
+
+#endif // Json_Codec_h
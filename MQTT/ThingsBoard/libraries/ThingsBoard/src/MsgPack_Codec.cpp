@@ -0,0 +1,33 @@
+// Header include.
+#include "MsgPack_Codec.h"
+
+// The smallest possible key value pair consists of a fixstr key and a positive fixint value, which take up one byte each
+constexpr size_t MINIMUM_MEMBER_SIZE = 2U;
+
+bool MsgPack_Codec::is_text() const {
+    return false;
+}
+
+size_t MsgPack_Codec::measure(JsonVariantConst const & source) const {
+    return measureMsgPack(source);
+}
+
+size_t MsgPack_Codec::serialize(JsonVariantConst const & source, uint8_t * const buffer, size_t const & size) const {
+    return serializeMsgPack(source, buffer, size);
+}
+
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+size_t MsgPack_Codec::serialize(JsonVariantConst const & source, Print & output) const {
+    return serializeMsgPack(source, output);
+}
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+
+DeserializationError MsgPack_Codec::deserialize(JsonDocument & destination, uint8_t * const payload, size_t const & length) const {
+    return deserializeMsgPack(destination, payload, length);
+}
+
+size_t MsgPack_Codec::estimate_member_count(uint8_t const * const payload, size_t const & length) const {
+    // The keys are not seperated by any symbol that could be counted, therefore the upper bound is used instead
+    (void)payload;
+    return length / MINIMUM_MEMBER_SIZE;
+}
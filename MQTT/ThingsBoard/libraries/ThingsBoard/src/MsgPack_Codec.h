@@ -0,0 +1,29 @@
+#ifndef MsgPack_Codec_h
+#define MsgPack_Codec_h
+
+// Local include.
+#include "IPayload_Codec.h"
+
+
+/// @brief Payload codec interface implementation that sends and receives the payloads as MessagePack (https://msgpack.org/), using the serializer and deserializer included in ArduinoJson.
+/// Keys stay strings, but numbers, booleans and the structure of objects and arrays are encoded as binary, which results in smaller payloads that are cheaper to create and to parse.
+/// ThingsBoard itself expects text JSON on the device API topics, therefore this codec should only be used if the payloads are converted between MessagePack and JSON
+/// before they reach the server, for example by a local gateway or a broker side transformation.
+class MsgPack_Codec : public IPayload_Codec {
+  public:
+    bool is_text() const override;
+
+    size_t measure(JsonVariantConst const & source) const override;
+
+    size_t serialize(JsonVariantConst const & source, uint8_t * const buffer, size_t const & size) const override;
+
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+    size_t serialize(JsonVariantConst const & source, Print & output) const override;
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+
+    DeserializationError deserialize(JsonDocument & destination, uint8_t * const payload, size_t const & length) const override;
+
+    size_t estimate_member_count(uint8_t const * const payload, size_t const & length) const override;
+};
+
+#endif // MsgPack_Codec_h
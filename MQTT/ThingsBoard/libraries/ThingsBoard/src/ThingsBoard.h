@@ -9,6 +9,7 @@
 #include "Provision_Callback.h"
 #include "OTA_Handler.h"
 #include "IMQTT_Client.h"
+#include "Json_Codec.h"
 #include "DefaultLogger.h"
 #include "Telemetry.h"
 
@@ -122,7 +123,6 @@ char constexpr CLIENT_SHARED_ATTRIBUTE_SUBSCRIPTIONS[] PROGMEM = "client or shar
 char constexpr MAX_SUBSCRIPTIONS_EXCEEDED[] PROGMEM = "Too many (%s) subscriptions, increase MaxSubscribtions or unsubscribe";
 #else
 char constexpr RPC_RESPONSE_OVERFLOWED[] PROGMEM = "Server-side RPC response overflowed, increase responseSize (%u)";
-char constexpr COLON PROGMEM = ':';
 #endif // !THINGSBOARD_ENABLE_DYNAMIC
 char constexpr COMMA[] PROGMEM = ",";
 char constexpr NO_KEYS_TO_REQUEST[] PROGMEM = "No keys to request were given";
@@ -141,6 +141,7 @@ char constexpr CALLING_REQUEST_CB[] PROGMEM = "Calling subscribed callback for r
 char constexpr RECEIVE_MESSAGE[] PROGMEM = "Received data from server over topic (%s)";
 char constexpr SEND_MESSAGE[] PROGMEM = "Sending data to server over topic (%s) with data (%s)";
 char constexpr SEND_SERIALIZED[] PROGMEM = "Hidden, because json data is bigger than buffer, therefore showing in console is skipped";
+char constexpr SEND_BINARY[] PROGMEM = "Hidden, because the payload codec does not create text data, therefore showing in console is skipped";
 #endif // THINGSBOARD_ENABLE_DEBUG
 #else
 char constexpr UNABLE_TO_DE_SERIALIZE_JSON[] = "Unable to de-serialize received json data with error (DeserializationError::%s)";
@@ -158,7 +159,6 @@ char constexpr CLIENT_SHARED_ATTRIBUTE_SUBSCRIPTIONS[] = "client or shared attri
 char constexpr MAX_SUBSCRIPTIONS_EXCEEDED[] = "Too many (%s) subscriptions, increase MaxSubscribtions or unsubscribe";
 #else
 char constexpr RPC_RESPONSE_OVERFLOWED[] = "Server-side RPC response overflowed, increase responseSize (%u)";
-char constexpr COLON = ':';
 #endif // !THINGSBOARD_ENABLE_DYNAMIC
 char constexpr COMMA[] = ",";
 char constexpr NO_KEYS_TO_REQUEST[] = "No keys to request were given";
@@ -177,6 +177,7 @@ char constexpr CALLING_REQUEST_CB[] = "Calling subscribed callback for request w
 char constexpr RECEIVE_MESSAGE[] = "Received data from server over topic (%s)";
 char constexpr SEND_MESSAGE[] = "Sending data to server over topic (%s) with data (%s)";
 char constexpr SEND_SERIALIZED[] = "Hidden, because json data is bigger than buffer, therefore showing in console is skipped";
+char constexpr SEND_BINARY[] = "Hidden, because the payload codec does not create text data, therefore showing in console is skipped";
 #endif // THINGSBOARD_ENABLE_DEBUG
 #endif // THINGSBOARD_ENABLE_PROGMEM
 
@@ -356,6 +357,8 @@ class ThingsBoardSized {
 #if THINGSBOARD_ENABLE_STREAM_UTILS
       , m_buffering_size(bufferingSize)
 #endif // THINGSBOARD_ENABLE_STREAM_UTILS
+      , m_json_codec()
+      , m_codec(&m_json_codec)
       , m_rpc_callbacks()
       , m_rpc_request_callbacks()
       , m_shared_attribute_update_callbacks()
@@ -405,6 +408,13 @@ class ThingsBoardSized {
     }
 #endif // THINGSBOARD_ENABLE_STREAM_UTILS
 
+    /// @brief Sets the codec that is used to serialize the payloads sent to and deserialize the payloads received from the server, by default text JSON (Json_Codec) is used.
+    /// Only a pointer to the given codec is kept, therefore it has to live on for as long as this instance is used, see IPayload_Codec for more information
+    /// @param codec Payload codec that should be used from now on, for example an instance of MsgPack_Codec
+    void setPayloadCodec(IPayload_Codec const & codec) {
+        m_codec = &codec;
+    }
+
     /// @brief Sets the size of the buffer for the underlying network client that will be used to establish the connection to ThingsBoard
     /// @param bufferSize Maximum amount of data that can be either received or sent to ThingsBoard at once, if bigger packets are received they are discarded
     /// and if we attempt to send data that is bigger, it will not be sent, the internal value can be changed later at any time with the setBufferSize() method
@@ -513,46 +523,51 @@ class ThingsBoardSized {
         }
 #endif // !THINGSBOARD_ENABLE_DYNAMIC
         bool result = false;
+        // The given json size can only be used by text codecs, binary codecs need to measure the size of their payload themselves.
+        // The payload size does not include the null terminator, which is still allocated, so that text payloads can be printed to the console
+        bool const is_text = m_codec->is_text();
+        size_t const payloadSize = is_text ? jsonSize - 1U : m_codec->measure(source);
 
 #if THINGSBOARD_ENABLE_STREAM_UTILS
         // Check if the size of the given message would be too big for the actual client,
         // if it is utilize the serialize json work around, so that the internal client buffer can be circumvented
-        if (m_client.get_buffer_size() < jsonSize)  {
+        if (m_client.get_buffer_size() < payloadSize)  {
 #if THINGSBOARD_ENABLE_DEBUG
             Logger::printfln(SEND_MESSAGE, topic, SEND_SERIALIZED);
 #endif // THINGSBOARD_ENABLE_DEBUG
-            result = Serialize_Json(topic, source, jsonSize - 1);
+            result = Serialize_Json(topic, source, payloadSize);
         }
         // Check if the remaining stack size of the current task would overflow the stack,
         // if it would allocate the memory on the heap instead to ensure no stack overflow occurs
         else
 #endif // THINGSBOARD_ENABLE_STREAM_UTILS
-        if (getMaximumStackSize() < jsonSize) {
-            char* json = new char[jsonSize]();
-            if (serializeJson(source, json, jsonSize) < jsonSize - 1) {
+        if (getMaximumStackSize() < payloadSize + 1U) {
+            uint8_t* payload = new uint8_t[payloadSize + 1U]();
+            if (m_codec->serialize(source, payload, payloadSize + 1U) < payloadSize) {
                 Logger::println(UNABLE_TO_SERIALIZE_JSON);
             }
             else {
-                result = Send_Json_String(topic, json);
+                result = Send_Payload(topic, payload, payloadSize, is_text);
             }
             // Ensure to actually delete the memory placed onto the heap, to make sure we do not create a memory leak
             // and set the pointer to null so we do not have a dangling reference.
-            delete[] json;
-            json = nullptr;
+            delete[] payload;
+            payload = nullptr;
         }
         else {
-            char json[jsonSize] = {};
-            if (serializeJson(source, json, jsonSize) < jsonSize - 1) {
+            uint8_t payload[payloadSize + 1U] = {};
+            if (m_codec->serialize(source, payload, payloadSize + 1U) < payloadSize) {
                 Logger::println(UNABLE_TO_SERIALIZE_JSON);
                 return result;
             }
-            result = Send_Json_String(topic, json);
+            result = Send_Payload(topic, payload, payloadSize, is_text);
         }
 
         return result;
     }
 
-    /// @brief Attempts to send custom json string over the given topic to the server
+    /// @brief Attempts to send custom json string over the given topic to the server.
+    /// The string is sent as is, even if a payload codec that does not create text JSON has been set with setPayloadCodec()
     /// @param topic Topic we want to send the data over
     /// @param json String containing our json key value pairs we want to attempt to send
     /// @return Whether sending the data was successful or not
@@ -560,19 +575,7 @@ class ThingsBoardSized {
         if (json == nullptr) {
             return false;
         }
-
-        uint16_t const & currentBufferSize = m_client.get_buffer_size();
-        size_t const jsonSize = strlen(json);
-
-        if (currentBufferSize < jsonSize) {
-            Logger::printfln(INVALID_BUFFER_SIZE, currentBufferSize, jsonSize);
-            return false;
-        }
-
-#if THINGSBOARD_ENABLE_DEBUG
-        Logger::printfln(SEND_MESSAGE, topic, json);
-#endif // THINGSBOARD_ENABLE_DEBUG
-        return m_client.publish(topic, reinterpret_cast<uint8_t const *>(json), jsonSize);
+        return Send_Payload(topic, reinterpret_cast<uint8_t const *>(json), strlen(json), true);
     }
 
     //----------------------------------------------------------------------------
@@ -1057,6 +1060,8 @@ class ThingsBoardSized {
 #if THINGSBOARD_ENABLE_STREAM_UTILS
     size_t                                                            m_buffering_size;                     // Buffering size used to serialize directly into client.
 #endif // THINGSBOARD_ENABLE_STREAM_UTILS
+    Json_Codec                                                        m_json_codec;                         // Default payload codec, sends and receives text JSON.
+    IPayload_Codec const *                                            m_codec;                              // Payload codec currently used to serialize and deserialize payloads.
 
     // Vectors or array (depends on wheter if THINGSBOARD_ENABLE_DYNAMIC is set to 1 or 0), hold copy of the actual passed data, this is to ensure they stay valid,
     // even if the user only temporarily created the object before the method was called.
@@ -1088,13 +1093,35 @@ class ThingsBoardSized {
     OTA_Handler<Logger>                                                m_ota;                               // Class instance that handles the flashing and creating a hash from the given received binary firmware data
 #endif // THINGSBOARD_ENABLE_OTA
 
+    /// @brief Attempts to send the given already serialized payload over the given topic to the server
+    /// @param topic Topic we want to send the data over
+    /// @param payload Serialized payload we want to send, has to be null terminated if it is text
+    /// @param length Length of the serialized payload, without null terminator
+    /// @param is_text Whether the payload is text and can therefore be printed to the console
+    /// @return Whether sending the data was successful or not
+    bool Send_Payload(char const * const topic, uint8_t const * const payload, size_t const & length, bool const & is_text) {
+        uint16_t const & currentBufferSize = m_client.get_buffer_size();
+
+        if (currentBufferSize < length) {
+            Logger::printfln(INVALID_BUFFER_SIZE, currentBufferSize, length);
+            return false;
+        }
+
+#if THINGSBOARD_ENABLE_DEBUG
+        Logger::printfln(SEND_MESSAGE, topic, is_text ? reinterpret_cast<char const *>(payload) : SEND_BINARY);
+#else
+        (void)is_text;
+#endif // THINGSBOARD_ENABLE_DEBUG
+        return m_client.publish(topic, payload, length);
+    }
+
 #if THINGSBOARD_ENABLE_STREAM_UTILS
     /// @brief Serialize the custom attribute source into the underlying client.
     /// Sends the given bytes to the client without requiring any temporary buffer at the cost of hugely increased send times
     /// @tparam TSource Source class that should be used to serialize the json that is sent to the server
     /// @param topic Topic we want to send the data over
     /// @param source Data source containing our json key value pairs we want to send
-    /// @param jsonSize Size of the data inside the source
+    /// @param jsonSize Size of the serialized payload, without null terminator
     /// @return Whether sending the data was successful or not
     template <typename TSource>
     bool Serialize_Json(char const * const topic, TSource const & source, size_t const & jsonSize) {
@@ -1103,7 +1130,7 @@ class ThingsBoardSized {
             return false;
         }
         BufferingPrint buffered_print(m_client, getBufferingSize());
-        size_t const bytes_serialized = serializeJson(source, buffered_print);
+        size_t const bytes_serialized = m_codec->serialize(source, buffered_print);
         if (bytes_serialized < jsonSize) {
             Logger::println(UNABLE_TO_SERIALIZE_JSON);
             return false;
@@ -1825,15 +1852,15 @@ class ThingsBoardSized {
         // Buffer that we deserialize is writeable and not read only --> zero copy, meaning the size for the data is 0 bytes,
         // Data structure size depends on the amount of key value pairs received.
         // See https://arduinojson.org/v6/assistant/ for more information on the needed size for the JsonDocument
-        TBJsonDocument jsonBuffer(JSON_OBJECT_SIZE(Helper::getOccurences(reinterpret_cast<char *>(payload), COLON)));
+        TBJsonDocument jsonBuffer(JSON_OBJECT_SIZE(m_codec->estimate_member_count(payload, length)));
 #else
         StaticJsonDocument<JSON_OBJECT_SIZE(MaxFieldsAmount)> jsonBuffer;
 #endif // THINGSBOARD_ENABLE_DYNAMIC
 
-        // The deserializeJson method we use, can use the zero copy mode because a writeable input was passed,
+        // The deserialize method of the codec can use the zero copy mode because a writeable input was passed,
         // if that were not the case the needed allocated memory would drastically increase, because the keys would need to be copied as well.
         // See https://arduinojson.org/v6/doc/deserialization/ for more info on ArduinoJson deserialization
-        DeserializationError const error = deserializeJson(jsonBuffer, payload, length);
+        DeserializationError const error = m_codec->deserialize(jsonBuffer, payload, length);
         if (error) {
             Logger::printfln(UNABLE_TO_DE_SERIALIZE_JSON, error.c_str());
             return;
@@ -73,6 +73,7 @@ class ThingsBoardHttpSized {
       : m_client(client)
       , m_max_stack(maxStackSize)
       , m_token(access_token)
+      , m_keep_alive(keepAlive)
     {
         m_client.set_keep_alive(keepAlive);
         if (m_client.connect(host, port) != 0) {
@@ -263,6 +264,7 @@ class ThingsBoardHttpSized {
     IHTTP_Client& m_client;     // HttpClient instance
     size_t        m_max_stack;  // Maximum stack size we allocate at once on the stack.
     char const    *m_token;     // Access token used to connect with
+    bool          m_keep_alive; // Whether the connection is kept open between requests
 
     /// @brief Returns the maximum amount of bytes that we want to allocate on the stack, before the memory is allocated on the heap instead
     /// @return Maximum amount of bytes we want to allocate on the stack
@@ -271,9 +273,14 @@ class ThingsBoardHttpSized {
     }
 
     /// @brief Clears any remaining memory of the previous conenction,
-    /// and resets the TCP as well, if data is resend the TCP connection has to be re-established
-    void clearConnection() {
-        m_client.stop();
+    /// and resets the TCP as well, if data is resend the TCP connection has to be re-established.
+    /// With keep alive the connection is left open after a successful request instead, the client reads out
+    /// the rest of the response before it sends the next request over the same connection
+    /// @param success Whether the request that just finished was successful
+    void clearConnection(bool const & success) {
+        if (!m_keep_alive || !success) {
+            m_client.stop();
+        }
     }
 
     /// @brief Attempts to send a POST request over HTTP or HTTPS
@@ -289,7 +296,7 @@ class ThingsBoardHttpSized {
             success = false;
         }
 
-        clearConnection();
+        clearConnection(success);
         return success;
     }
 
@@ -303,7 +310,7 @@ class ThingsBoardHttpSized {
 #else
     bool getMessage(char const * const path, String& response) {
 #endif // THINGSBOARD_ENABLE_STL
-        bool success = m_client.get(path);
+        bool success = m_client.get(path) == 0;
         int const status = m_client.get_response_status_code();
 
         if (!success || status < HTTP_RESPONSE_SUCCESS_RANGE_START || status > HTTP_RESPONSE_SUCCESS_RANGE_END) {
@@ -315,7 +322,7 @@ class ThingsBoardHttpSized {
         response = m_client.get_response_body();
 
         cleanup:
-        clearConnection();
+        clearConnection(success);
         return success;
     }
 
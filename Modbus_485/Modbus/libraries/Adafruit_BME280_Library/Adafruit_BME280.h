@@ -226,9 +226,13 @@ public:
                    standby_duration duration = STANDBY_MS_0_5);
 
   bool takeForcedMeasurement(void);
+  bool startForcedMeasurement(void);
+  bool isMeasuring(void);
+  uint32_t measurementTime(void);
   float readTemperature(void);
   float readPressure(void);
   float readHumidity(void);
+  bool readAll(float *temperature, float *pressure, float *humidity);
 
   float readAltitude(float seaLevel);
   float seaLevelForAltitude(float altitude, float pressure);
@@ -257,7 +261,12 @@ protected:
   void readCoefficients(void);
   bool isReadingCalibration(void);
 
+  int32_t compensateTemperature(int32_t adc_T);
+  int64_t compensatePressure(int32_t adc_P);
+  uint32_t compensateHumidity(int32_t adc_H);
+
   void write8(byte reg, byte value);
+  bool readBurst(byte reg, uint8_t *buffer, size_t len);
   uint8_t read8(byte reg);
   uint16_t read16(byte reg);
   uint32_t read24(byte reg);
@@ -274,6 +283,9 @@ protected:
   int32_t t_fine_adjust = 0; //!< add to compensate temp readings and in turn
                              //!< to pressure and humidity readings
 
+  uint32_t _measureStart = 0; //!< millis() when the forced measurement began
+  bool _measuring = false;    //!< a forced measurement has not been seen done
+
   bme280_calib_data _bme280_calib; //!< here calibration data is stored
 
   /**************************************************************************/
@@ -0,0 +1,200 @@
+// Host test of Adafruit_BME280 against a fake TwoWire (stub/Wire.h) holding
+// the calibration of a real part.
+//
+// - 100000 raw samples, generated from a fixed seed: realistic and
+//   full-range values, disabled channels and a changing temperature
+//   compensation, with the calibration as read and with negative H4/H5.
+//   The floats from readTemperature/Pressure/Humidity() must hash to the
+//   values recorded from the driver before the compensation was shared,
+//   and readAll() must return the same bits in 2 transactions.
+// - begin() reads the calibration in bursts.
+// - Forced mode, with a sensor that stays busy for the conversion time:
+//   takeForcedMeasurement() and startForcedMeasurement()/isMeasuring()
+//   poll the status register only once the typical time has passed.
+#include <Adafruit_BME280.h>
+
+#include <stdio.h>
+
+#include <random>
+
+TwoWire Wire;
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+#define ADDRESS 0x77
+
+// FNV-1a of the float outputs of the previous driver, for the two
+// calibrations
+static const uint32_t recorded[2] = {0x4D323A15, 0x98C8E896};
+
+static uint32_t statusReads, busyMicros, started;
+
+static void setUpDevice(bool negativeH45) {
+  TwoWire::Device &d = Wire.devices[ADDRESS];
+  memset(d.regs, 0, sizeof(d.regs));
+  d.regs[0xD0] = 0x60;
+  const uint8_t tp[26] = {0x70, 0x6B, 0x43, 0x67, 0x18, 0xFC, 0x7D,
+                          0x8E, 0x43, 0xD6, 0xD0, 0x0B, 0x27, 0x0B,
+                          0x8C, 0x00, 0xF9, 0xFF, 0x8C, 0x3C, 0xF8,
+                          0xC6, 0x70, 0x17, 0x00, 0x4B};
+  const uint8_t h[7] = {0x6A, 0x01, 0x00, 0x13, 0x2F, 0x03, 0x1E};
+  memcpy(&d.regs[0x88], tp, sizeof(tp));
+  memcpy(&d.regs[0xE1], h, sizeof(h));
+  if (negativeH45) {
+    d.regs[0xE4] = 0xF3;
+    d.regs[0xE5] = 0x9A;
+    d.regs[0xE6] = 0x83;
+  }
+  // Forced mode: busy for busyMicros after a start
+  d.onWrite = [&d](uint8_t r) {
+    if (r == BME280_REGISTER_CONTROL && (d.regs[r] & 3) == 1)
+      started = micros();
+  };
+  d.onRead = [&d](uint8_t r) {
+    if (r == BME280_REGISTER_STATUS) {
+      statusReads++;
+      d.regs[r] = (micros() - started < busyMicros) ? 0x08 : 0;
+    }
+  };
+}
+
+static void fnv(uint32_t &hash, float v) {
+  uint8_t b[4];
+  memcpy(b, &v, 4);
+  for (int i = 0; i < 4; i++)
+    hash = (hash ^ b[i]) * 0x01000193;
+}
+
+static void testRecorded(bool negativeH45) {
+  setUpDevice(negativeH45);
+  Wire.bitNanos = 0;
+  Adafruit_BME280 bme;
+  unsigned long before = Wire.transactions;
+  CHECK(bme.begin(ADDRESS), "begin()");
+  unsigned long beginTransactions = Wire.transactions - before;
+
+  TwoWire::Device &d = Wire.devices[ADDRESS];
+  std::mt19937 rng(1);
+  uint32_t hash = 0x811C9DC5;
+  unsigned long separate = 0, together = 0;
+  int mismatches = 0;
+  for (int i = 0; i < 100000; i++) {
+    uint32_t T, P, H;
+    if (i % 2) {
+      T = 0x60000 + rng() % 0x30000;
+      P = 0x40000 + rng() % 0x40000;
+      H = 0x4000 + rng() % 0x8000;
+    } else {
+      T = rng() & 0xFFFFF;
+      P = rng() & 0xFFFFF;
+      H = rng() & 0xFFFF;
+    }
+    T <<= 4;
+    P <<= 4;
+    if (i % 97 == 0)
+      T = 0x800000; // Disabled
+    if (i % 89 == 0)
+      P = 0x800000;
+    if (i % 83 == 0)
+      H = 0x8000;
+    d.regs[0xF7] = P >> 16;
+    d.regs[0xF8] = P >> 8;
+    d.regs[0xF9] = P;
+    d.regs[0xFA] = T >> 16;
+    d.regs[0xFB] = T >> 8;
+    d.regs[0xFC] = T;
+    d.regs[0xFD] = H >> 8;
+    d.regs[0xFE] = H;
+    if (i % 1000 == 0)
+      bme.setTemperatureCompensation((int)(rng() % 11) - 5);
+
+    before = Wire.transactions;
+    float v[3];
+    v[0] = bme.readTemperature();
+    v[1] = bme.readPressure();
+    v[2] = bme.readHumidity();
+    separate = Wire.transactions - before;
+    for (float x : v)
+      fnv(hash, x);
+
+    float a[3];
+    before = Wire.transactions;
+    CHECK(bme.readAll(&a[0], &a[1], &a[2]) || isnan(a[0]), "readAll()");
+    together = Wire.transactions - before;
+    mismatches += memcmp(a, v, sizeof(a)) != 0;
+  }
+  printf("  %s H4/H5: begin() %lu transactions, a sample %lu separately, "
+         "%lu with readAll()\n",
+         negativeH45 ? "negative" : "positive", beginTransactions, separate,
+         together);
+  CHECK(hash == recorded[negativeH45], "outputs hash to %08X", hash);
+  CHECK(!mismatches, "%d readAll() samples differ", mismatches);
+  CHECK(together == 2, "readAll()");
+  float p;
+  CHECK(bme.readAll(nullptr, &p, nullptr), "readAll() with nullptr");
+  Wire.bitNanos = 2500;
+}
+
+static void testForced(void) {
+  setUpDevice(false);
+  Adafruit_BME280 bme;
+  CHECK(bme.begin(ADDRESS), "begin()");
+  bme.setSampling(Adafruit_BME280::MODE_FORCED);
+  printf("  measurementTime() x16/x16/x16 %u ms\n", bme.measurementTime());
+
+  busyMicros = 104000; // A bit over the typical time
+  statusReads = 0;
+  unsigned long before = Wire.transactions;
+  uint32_t start = micros();
+  CHECK(bme.takeForcedMeasurement(), "takeForcedMeasurement()");
+  printf("  takeForcedMeasurement(): %.1f ms, %u status reads, %lu "
+         "transactions\n",
+         (micros() - start) / 1000.0, statusReads,
+         Wire.transactions - before);
+  CHECK(statusReads <= 10, "%u status reads", statusReads);
+
+  statusReads = 0;
+  int polls = 0;
+  start = micros();
+  CHECK(bme.startForcedMeasurement(), "startForcedMeasurement()");
+  while (bme.isMeasuring()) {
+    polls++;
+    delay(1);
+  }
+  printf("  start/isMeasuring(): %d polls, %u status reads, %.1f ms\n", polls,
+         statusReads, (micros() - start) / 1000.0);
+  CHECK(statusReads <= 10 && micros() - start >= busyMicros,
+        "%u status reads", statusReads);
+
+  bme.setSampling(Adafruit_BME280::MODE_FORCED, Adafruit_BME280::SAMPLING_X1,
+                  Adafruit_BME280::SAMPLING_X1,
+                  Adafruit_BME280::SAMPLING_NONE);
+  busyMicros = 5800;
+  statusReads = 0;
+  CHECK(bme.takeForcedMeasurement(), "takeForcedMeasurement() x1");
+  printf("  measurementTime() x1/x1/off %u ms, %u status reads\n",
+         bme.measurementTime(), statusReads);
+
+  bme.setSampling(Adafruit_BME280::MODE_NORMAL);
+  CHECK(!bme.startForcedMeasurement() && !bme.isMeasuring(), "normal mode");
+}
+
+int main(void) {
+  printf("Recorded samples\n");
+  testRecorded(false);
+  testRecorded(true);
+  printf("Forced mode\n");
+  testForced();
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
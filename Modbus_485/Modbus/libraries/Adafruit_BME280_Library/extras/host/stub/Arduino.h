@@ -0,0 +1,43 @@
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#define ARDUINO 100
+#define F(x) (x)
+#define HEX 16
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+typedef uint8_t byte;
+using std::max;
+using std::min;
+
+inline uint32_t micros(void) {
+  static auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+inline uint32_t millis(void) { return micros() / 1000; }
+inline void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+/// Sink for the debug prints of the libraries
+class Stream {
+public:
+  template <class T> size_t print(T, int = 0) { return 0; }
+  template <class T> size_t println(T, int = 0) { return 0; }
+  size_t println(void) { return 0; }
+};
+static Stream Serial __attribute__((unused));
+
+#endif
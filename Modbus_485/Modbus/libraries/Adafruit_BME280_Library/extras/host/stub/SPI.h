@@ -0,0 +1,9 @@
+#ifndef _HOST_SPI_H
+#define _HOST_SPI_H
+
+#define SPI_MODE0 0
+
+class SPIClass {};
+static SPIClass SPI __attribute__((unused));
+
+#endif
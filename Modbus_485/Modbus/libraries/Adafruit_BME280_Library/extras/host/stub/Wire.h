@@ -0,0 +1,97 @@
+#ifndef _HOST_WIRE_H
+#define _HOST_WIRE_H
+
+#include <Arduino.h>
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#define I2C_BUFFER_LENGTH 128
+
+/// TwoWire with register-file devices that auto-increment. A device can
+/// hook register reads and writes to model its behaviour, and transfers
+/// can take their bus time, spinning (bitNanos 0 for none).
+class TwoWire {
+public:
+  struct Device {
+    uint8_t regs[256];
+    uint8_t pointer = 0;
+    std::function<void(uint8_t)> onRead;  ///< Before a register is read
+    std::function<void(uint8_t)> onWrite; ///< After a register is written
+  };
+  std::map<uint8_t, Device> devices;
+  unsigned long transactions = 0;
+  uint32_t bitNanos = 2500; ///< 400 kHz
+
+  void begin(void) {}
+  void end(void) {}
+  void setClock(uint32_t hz) { bitNanos = 1000000000u / hz; }
+
+  void beginTransmission(uint8_t address) {
+    addr = address;
+    tx.clear();
+  }
+  size_t write(uint8_t b) {
+    tx.push_back(b);
+    return 1;
+  }
+  size_t write(const uint8_t *b, size_t n) {
+    tx.insert(tx.end(), b, b + n);
+    return n;
+  }
+  uint8_t endTransmission(bool stop = true) {
+    (void)stop;
+    transactions++;
+    spend(tx.size());
+    auto it = devices.find(addr);
+    if (it == devices.end())
+      return 2; // NACK on the address
+    Device &d = it->second;
+    if (!tx.empty()) {
+      d.pointer = tx[0];
+      for (size_t i = 1; i < tx.size(); i++) {
+        d.regs[d.pointer] = tx[i];
+        if (d.onWrite)
+          d.onWrite(d.pointer);
+        d.pointer++;
+      }
+    }
+    return 0;
+  }
+  uint8_t requestFrom(uint8_t address, uint8_t n, uint8_t stop = 1) {
+    (void)stop;
+    transactions++;
+    spend(n);
+    rx.clear();
+    rxPos = 0;
+    auto it = devices.find(address);
+    if (it != devices.end()) {
+      Device &d = it->second;
+      for (uint8_t i = 0; i < n; i++) {
+        if (d.onRead)
+          d.onRead(d.pointer);
+        rx.push_back(d.regs[d.pointer++]);
+      }
+    }
+    return rx.size();
+  }
+  int read(void) { return rxPos < rx.size() ? rx[rxPos++] : -1; }
+
+private:
+  uint8_t addr = 0;
+  std::vector<uint8_t> tx, rx;
+  size_t rxPos = 0;
+
+  /// Start, address, bytes and stop, 9 bits each
+  void spend(size_t bytes) {
+    uint64_t ns = (uint64_t)(bytes + 1) * 9 * bitNanos + 2 * bitNanos;
+    auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(ns);
+    while (std::chrono::steady_clock::now() < until)
+      ;
+  }
+};
+
+extern TwoWire Wire;
+
+#endif
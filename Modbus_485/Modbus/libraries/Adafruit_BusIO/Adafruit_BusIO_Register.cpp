@@ -88,6 +88,29 @@ Adafruit_BusIO_Register::Adafruit_BusIO_Register(
   _width = width;
 }
 
+/*!
+ *    @brief  Create a register that lives in a register map, so it is read
+ * from and written to the map's RAM copy instead of the device whenever
+ * possible
+ *    @param  map      The Adafruit_BusIO_RegisterMap holding the register
+ *    @param  reg_addr The address of the register, within the map
+ *    @param  width    The width of the register data itself, defaults to 1 byte
+ *    @param  byteorder The byte order of the register (used when width is > 1),
+ * defaults to LSBFIRST
+ */
+Adafruit_BusIO_Register::Adafruit_BusIO_Register(
+    Adafruit_BusIO_RegisterMap *map, uint16_t reg_addr, uint8_t width,
+    uint8_t byteorder) {
+  _map = map;
+  _i2cdevice = map ? map->_device._i2cdevice : nullptr;
+  _spidevice = map ? map->_device._spidevice : nullptr;
+  _spiregtype = map ? map->_device._spiregtype : ADDRBIT8_HIGH_TOREAD;
+  _addrwidth = map ? map->_device._addrwidth : 1;
+  _address = reg_addr;
+  _byteorder = byteorder;
+  _width = width;
+}
+
 /*!
  *    @brief  Write a buffer of data to the register location
  *    @param  buffer Pointer to data to write
@@ -96,6 +119,9 @@ Adafruit_BusIO_Register::Adafruit_BusIO_Register(
  * uncheckable)
  */
 bool Adafruit_BusIO_Register::write(uint8_t *buffer, uint8_t len) {
+  if (_map && _map->covers(_address, len)) {
+    return _map->write(_address, buffer, len);
+  }
 
   uint8_t addrbuffer[2] = {(uint8_t)(_address & 0xFF),
                            (uint8_t)(_address >> 8)};
@@ -199,6 +225,11 @@ uint32_t Adafruit_BusIO_Register::readCached(void) { return _cached; }
  * uncheckable)
  */
 bool Adafruit_BusIO_Register::read(uint8_t *buffer, uint8_t len) {
+  if (_map && _map->covers(_address, len) &&
+      _map->read(_address, buffer, len)) {
+    return true;
+  }
+
   uint8_t addrbuffer[2] = {(uint8_t)(_address & 0xFF),
                            (uint8_t)(_address >> 8)};
 
@@ -362,4 +393,199 @@ void Adafruit_BusIO_Register::setAddressWidth(uint16_t address_width) {
   _addrwidth = address_width;
 }
 
+/*!
+ *    @brief  Create a RAM copy of a block of consecutive registers. Nothing is
+ * read until a register in the map is first read, or load() is called.
+ *    @param  i2cdevice The I2CDevice to use for underlying I2C access, if
+ * nullptr we use SPI
+ *    @param  spidevice The SPIDevice to use for underlying SPI access, if
+ * nullptr we use I2C
+ *    @param  type     The method we use to read/write data to SPI; it must
+ * make the device advance the address during a burst
+ *    @param  first_reg The address of the first register in the block
+ *    @param  count    How many registers, up to BUSIO_REGMAP_MAX
+ *    @param  i2c_autoinc Bits to set in the I2C register address so the device
+ * advances it during a burst, 0 if it always does
+ *    @param  address_width The width of the register address itself, defaults
+ * to 1 byte
+ */
+Adafruit_BusIO_RegisterMap::Adafruit_BusIO_RegisterMap(
+    Adafruit_I2CDevice *i2cdevice, Adafruit_SPIDevice *spidevice,
+    Adafruit_BusIO_SPIRegType type, uint16_t first_reg, uint8_t count,
+    uint8_t i2c_autoinc, uint8_t address_width)
+    : _device(i2cdevice, spidevice, type, first_reg, 1, LSBFIRST,
+              address_width) {
+  _first = first_reg;
+  _count = min((int)count, BUSIO_REGMAP_MAX);
+  _autoinc = i2c_autoinc;
+  _updating = 0;
+  _volatile = _valid = _dirty = 0;
+}
+
+/*!
+ *    @brief  Mark registers whose value the device changes by itself, or
+ * whose reading has side effects. They are always read and written on the
+ * device, and never read as part of a burst.
+ *    @param  reg_addr The first volatile register
+ *    @param  count    How many registers from there, defaults to 1
+ */
+void Adafruit_BusIO_RegisterMap::setVolatile(uint16_t reg_addr,
+                                             uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    uint16_t r = reg_addr + i - _first;
+    if (r < _count) {
+      _volatile |= 1UL << r;
+      _valid &= ~(1UL << r);
+      _dirty &= ~(1UL << r);
+    }
+  }
+}
+
+/*!
+ *    @brief  Read every register of the map that is not volatile, one burst
+ * per run of them. Registers with changes not yet committed keep them.
+ *    @return True if all the reads worked
+ */
+bool Adafruit_BusIO_RegisterMap::load(void) {
+  bool ok = true;
+  for (uint8_t i = 0; i < _count;) {
+    if (_volatile & (1UL << i)) {
+      i++;
+      continue;
+    }
+    uint8_t n = 1;
+    while ((i + n < _count) && !(_volatile & (1UL << (i + n)))) {
+      n++;
+    }
+    ok = transfer(i, n, false) && ok;
+    i += n;
+  }
+  return ok;
+}
+
+/*!
+ *    @brief  Forget the RAM copy, for example after a device reset, so the
+ * next read loads it again. Changes not yet committed are dropped.
+ */
+void Adafruit_BusIO_RegisterMap::invalidate(void) { _valid = _dirty = 0; }
+
+/*!
+ *    @brief  Hold writes to the map's registers in RAM until the matching
+ * commit(), so several fields of the same registers cost one write
+ */
+void Adafruit_BusIO_RegisterMap::beginUpdate(void) { _updating++; }
+
+/*!
+ *    @brief  End a beginUpdate() and write the registers changed since, one
+ * burst for each stretch of them
+ *    @return True if the writes worked, or are still held by an outer
+ * beginUpdate()
+ */
+bool Adafruit_BusIO_RegisterMap::commit(void) {
+  if (_updating && --_updating) {
+    return true;
+  }
+  return flush();
+}
+
+// Bits for len registers from index 'from' in the per-register masks
+static uint32_t bitMask(uint8_t from, uint8_t len) {
+  return ((len >= 32) ? 0xFFFFFFFFUL : ((1UL << len) - 1)) << from;
+}
+
+// A register range this map can serve from RAM
+bool Adafruit_BusIO_RegisterMap::covers(uint16_t reg_addr, uint8_t len) {
+  uint16_t r = reg_addr - _first;
+  if (!len || (r >= _count) || (r + len > _count)) {
+    return false;
+  }
+  return !(_volatile & bitMask(r, len));
+}
+
+bool Adafruit_BusIO_RegisterMap::read(uint16_t reg_addr, uint8_t *buffer,
+                                      uint8_t len) {
+  uint8_t r = reg_addr - _first;
+  uint32_t mask = bitMask(r, len);
+  if (((_valid & mask) != mask) && (!load() || ((_valid & mask) != mask))) {
+    return false;
+  }
+  memcpy(buffer, &_cache[r], len);
+  return true;
+}
+
+bool Adafruit_BusIO_RegisterMap::write(uint16_t reg_addr,
+                                       const uint8_t *buffer, uint8_t len) {
+  uint8_t r = reg_addr - _first;
+  uint32_t mask = bitMask(r, len);
+  memcpy(&_cache[r], buffer, len);
+  _valid |= mask;
+  _dirty |= mask;
+  return _updating ? true : flush();
+}
+
+// Writes the changed registers. A burst may also rewrite unchanged ones
+// between them, if their value is known, rather than being split in two.
+bool Adafruit_BusIO_RegisterMap::flush(void) {
+  bool ok = true;
+  for (uint8_t i = 0; i < _count;) {
+    if (!(_dirty & (1UL << i))) {
+      i++;
+      continue;
+    }
+    uint8_t end = i + 1;
+    for (uint8_t j = end; j < _count; j++) {
+      if (_dirty & (1UL << j)) {
+        end = j + 1;
+      } else if (!(_valid & (1UL << j)) || (_volatile & (1UL << j))) {
+        break;
+      }
+    }
+    ok = transfer(i, end - i, true) && ok;
+    i = end;
+  }
+  return ok;
+}
+
+// Moves len registers from index 'from' between the device and the cache,
+// in chunks the bus can carry. Failed registers are left invalid so the
+// next read gets them from the device.
+bool Adafruit_BusIO_RegisterMap::transfer(uint8_t from, uint8_t len,
+                                          bool write) {
+  uint8_t chunk = len;
+  if (_device._i2cdevice &&
+      (_device._i2cdevice->maxBufferSize() < len + _device._addrwidth)) {
+    chunk = _device._i2cdevice->maxBufferSize() - _device._addrwidth;
+  }
+  bool ok = true;
+  for (uint8_t pos = from; pos < from + len; pos += chunk) {
+    uint8_t n = min(chunk, (uint8_t)(from + len - pos));
+    uint16_t addr = _first + pos;
+    if (_device._i2cdevice && (n > 1)) {
+      addr |= _autoinc;
+    }
+    _device.setAddress(addr);
+    uint32_t mask = bitMask(pos, n);
+    if (write) {
+      if (!_device.write(&_cache[pos], n)) {
+        _valid &= ~mask;
+        ok = false;
+      }
+      _dirty &= ~mask;
+    } else {
+      uint8_t buffer[BUSIO_REGMAP_MAX];
+      if (_device.read(buffer, n)) {
+        for (uint8_t i = 0; i < n; i++) {
+          if (!(_dirty & (1UL << (pos + i)))) {
+            _cache[pos + i] = buffer[i];
+          }
+        }
+        _valid |= mask;
+      } else {
+        ok = false;
+      }
+    }
+  }
+  return ok;
+}
+
 #endif // SPI exists
@@ -36,6 +36,12 @@ typedef enum _Adafruit_BusIO_SPIRegType {
 
 } Adafruit_BusIO_SPIRegType;
 
+#ifndef BUSIO_REGMAP_MAX
+#define BUSIO_REGMAP_MAX 32 ///< Most registers in one register map
+#endif
+
+class Adafruit_BusIO_RegisterMap;
+
 /*!
  * @brief The class which defines a device register (a location to read/write
  * data from)
@@ -57,6 +63,9 @@ public:
                           uint8_t width = 1, uint8_t byteorder = LSBFIRST,
                           uint8_t address_width = 1);
 
+  Adafruit_BusIO_Register(Adafruit_BusIO_RegisterMap *map, uint16_t reg_addr,
+                          uint8_t width = 1, uint8_t byteorder = LSBFIRST);
+
   bool read(uint8_t *buffer, uint8_t len);
   bool read(uint8_t *value);
   bool read(uint16_t *value);
@@ -75,6 +84,8 @@ public:
   void println(Stream *s = &Serial);
 
 private:
+  friend class Adafruit_BusIO_RegisterMap;
+
   Adafruit_I2CDevice *_i2cdevice;
   Adafruit_SPIDevice *_spidevice;
   Adafruit_BusIO_SPIRegType _spiregtype;
@@ -83,6 +94,7 @@ private:
   uint8_t _buffer[4]; // we won't support anything larger than uint32 for
                       // non-buffered read
   uint32_t _cached = 0;
+  Adafruit_BusIO_RegisterMap *_map = nullptr;
 };
 
 /*!
@@ -101,5 +113,44 @@ private:
   uint8_t _bits, _shift;
 };
 
+/*!
+ * @brief A RAM copy of a block of consecutive registers. Registers created
+ * on the map read from the copy, loaded in one burst, and write to it;
+ * between beginUpdate() and commit() their writes stay in RAM, and commit()
+ * sends the changed bytes back in as few bursts as possible. Registers
+ * marked volatile (status, data, clear-on-read) always go to the device and
+ * are never part of a burst.
+ */
+class Adafruit_BusIO_RegisterMap {
+public:
+  Adafruit_BusIO_RegisterMap(Adafruit_I2CDevice *i2cdevice,
+                             Adafruit_SPIDevice *spidevice,
+                             Adafruit_BusIO_SPIRegType type,
+                             uint16_t first_reg, uint8_t count,
+                             uint8_t i2c_autoinc = 0,
+                             uint8_t address_width = 1);
+
+  void setVolatile(uint16_t reg_addr, uint8_t count = 1);
+  bool load(void);
+  void invalidate(void);
+  void beginUpdate(void);
+  bool commit(void);
+
+private:
+  friend class Adafruit_BusIO_Register;
+
+  bool covers(uint16_t reg_addr, uint8_t len);
+  bool read(uint16_t reg_addr, uint8_t *buffer, uint8_t len);
+  bool write(uint16_t reg_addr, const uint8_t *buffer, uint8_t len);
+  bool flush(void);
+  bool transfer(uint8_t from, uint8_t len, bool write);
+
+  Adafruit_BusIO_Register _device; // Plain register used for the bursts
+  uint16_t _first;
+  uint8_t _count, _autoinc, _updating;
+  uint32_t _volatile, _valid, _dirty; // One bit per register
+  uint8_t _cache[BUSIO_REGMAP_MAX];
+};
+
 #endif // SPI exists
 #endif // BusIO_Register_h
@@ -0,0 +1,260 @@
+#include "Adafruit_I2CBus.h"
+#include "Adafruit_I2CDevice.h"
+
+// Zero-initialized before any constructor runs, so devices declared as
+// globals can use get() from their own constructors or begin()
+static Adafruit_I2CBus buses[I2CBUS_MAX_BUSES];
+#ifdef I2CBUS_RTOS
+static portMUX_TYPE registryMux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+/*!
+ *    @brief  Get the bus manager of a TwoWire, creating it on first use
+ *    @param  theWire The I2C bus, defaults to &Wire
+ *    @return The manager, or nullptr if I2CBUS_MAX_BUSES are already in
+ *            use (the TwoWire is then used without arbitration)
+ */
+Adafruit_I2CBus *Adafruit_I2CBus::get(TwoWire *theWire) {
+  Adafruit_I2CBus *bus = nullptr;
+#ifdef I2CBUS_RTOS
+  portENTER_CRITICAL(&registryMux);
+#endif
+  for (uint8_t i = 0; i < I2CBUS_MAX_BUSES; i++) {
+    if (buses[i]._wire == theWire) {
+      bus = &buses[i];
+      break;
+    }
+    if (!bus && !buses[i]._wire) {
+      bus = &buses[i]; // First free slot, unless theWire turns up later
+    }
+  }
+  if (bus && !bus->_wire) {
+    bus->_wire = theWire;
+  }
+#ifdef I2CBUS_RTOS
+  portEXIT_CRITICAL(&registryMux);
+#endif
+  return bus;
+}
+
+void Adafruit_I2CBus::lockState(void) {
+#ifdef I2CBUS_RTOS
+  portENTER_CRITICAL(&_mux);
+#endif
+}
+
+void Adafruit_I2CBus::unlockState(void) {
+#ifdef I2CBUS_RTOS
+  portEXIT_CRITICAL(&_mux);
+#endif
+}
+
+void *Adafruit_I2CBus::currentTask(void) {
+#ifdef I2CBUS_RTOS
+  return (void *)xTaskGetCurrentTaskHandle();
+#else
+  return nullptr; // Only one thread of execution
+#endif
+}
+
+// True if waiter a should get the bus before waiter b
+bool Adafruit_I2CBus::before(const Waiter *a, const Waiter *b) {
+  if (a->priority != b->priority) {
+    return a->priority > b->priority;
+  }
+  if (a->timed != b->timed) {
+    return a->timed;
+  }
+  if (a->timed && (a->deadline != b->deadline)) {
+    return (int32_t)(a->deadline - b->deadline) < 0;
+  }
+  return (int32_t)(a->order - b->order) < 0;
+}
+
+/*!
+ *    @brief  Take the bus for the calling task, waiting if another task
+ *    has it. Calls nest: the bus is freed by the matching last release().
+ *    @param  priority Higher values are served first among waiting tasks
+ *    @param  timeout_ms Give up after this many milliseconds; with the same
+ *            priority, the task whose deadline comes first is served first.
+ *            I2CBUS_NO_TIMEOUT to wait as long as needed.
+ *    @return True if the calling task now owns the bus
+ */
+bool Adafruit_I2CBus::acquire(uint8_t priority, uint32_t timeout_ms) {
+  void *self = currentTask();
+  lockState();
+  if (!_depth || (_owner == self)) {
+    if (!_depth++) {
+      _owner = self;
+      _ownedSince = micros();
+    }
+    unlockState();
+    return true;
+  }
+#ifdef I2CBUS_RTOS
+  Waiter w;
+  w.task = self;
+  w.timed = (timeout_ms != I2CBUS_NO_TIMEOUT);
+  w.deadline = millis() + timeout_ms;
+  w.order = _arrivals++;
+  w.priority = priority;
+  w.granted = false;
+  w.wake = xSemaphoreCreateBinaryStatic(&w.wakeBuffer);
+  w.next = _waiters;
+  _waiters = &w;
+  unlockState();
+
+  bool granted = false;
+  for (;;) {
+    TickType_t wait = portMAX_DELAY;
+    if (w.timed) {
+      int32_t remaining = (int32_t)(w.deadline - millis());
+      wait = (remaining > 0) ? pdMS_TO_TICKS(remaining) + 1 : 0;
+    }
+    if (xSemaphoreTake(w.wake, wait) == pdTRUE) {
+      granted = true; // release() made us the owner and dequeued us
+      break;
+    }
+    lockState();
+    if (w.granted) {
+      // Granted as the wait timed out: take the semaphore anyway, so that
+      // release() is done with w before it goes out of scope
+      unlockState();
+      xSemaphoreTake(w.wake, portMAX_DELAY);
+      granted = true;
+      break;
+    }
+    if (w.timed && ((int32_t)(millis() - w.deadline) >= 0)) {
+      Waiter **p = &_waiters;
+      while (*p != &w) {
+        p = &(*p)->next;
+      }
+      *p = w.next;
+      _timeouts++;
+      unlockState();
+      break;
+    }
+    unlockState(); // Woken early by tick rounding, keep waiting
+  }
+  vSemaphoreDelete(w.wake);
+  return granted;
+#else
+  // Without tasks the owner is always the caller, so this is unreachable
+  (void)priority;
+  (void)timeout_ms;
+  unlockState();
+  return false;
+#endif
+}
+
+/*!
+ *    @brief  Give back the bus taken with acquire(). The last release()
+ *    hands it straight to the first waiting task, if any.
+ */
+void Adafruit_I2CBus::release(void) {
+  Waiter *wake = nullptr;
+  lockState();
+  if (!_depth || (_owner != currentTask())) {
+    unlockState(); // Not ours to release
+    return;
+  }
+  if (!--_depth) {
+    uint32_t now = micros();
+    _busyMicros += now - _ownedSince;
+    Waiter **best = nullptr;
+    for (Waiter **p = &_waiters; *p; p = &(*p)->next) {
+      if (!best || before(*p, *best)) {
+        best = p;
+      }
+    }
+    if (best) {
+      Waiter *w = *best;
+      *best = w->next;
+      w->granted = true;
+      _owner = w->task;
+      wake = w;
+      _depth = 1;
+      _ownedSince = now;
+    } else {
+      _owner = nullptr;
+    }
+  }
+  unlockState();
+#ifdef I2CBUS_RTOS
+  if (wake) {
+    xSemaphoreGive(wake->wake);
+  }
+#else
+  (void)wake;
+#endif
+}
+
+/*!
+ *    @brief  Run a batch of transfers while owning the bus once. Register
+ *    reads that follow each other on a device with setAutoIncrement()
+ *    enabled, each starting where the previous one ended, are merged into
+ *    a single burst read of up to I2CBUS_MAX_BURST bytes.
+ *    @param  transfers The transfers, each gets its own 'ok' result
+ *    @param  count Number of transfers
+ *    @param  priority As for acquire()
+ *    @param  timeout_ms As for acquire()
+ *    @return True if the bus was acquired and every transfer worked
+ */
+bool Adafruit_I2CBus::run(Adafruit_I2CTransfer *transfers, size_t count,
+                          uint8_t priority, uint32_t timeout_ms) {
+  for (size_t i = 0; i < count; i++) {
+    transfers[i].ok = false;
+  }
+  if (!acquire(priority, timeout_ms)) {
+    return false;
+  }
+
+  bool all_ok = true;
+  for (size_t i = 0; i < count;) {
+    Adafruit_I2CTransfer *t = &transfers[i];
+    Adafruit_I2CDevice *dev = t->device;
+    bool reg_read = (t->write_len == 1) && (t->read_len > 0);
+    size_t n = 1, total = t->read_len;
+    size_t limit = dev->maxBufferSize();
+    if (limit > I2CBUS_MAX_BURST) {
+      limit = I2CBUS_MAX_BURST;
+    }
+    if (reg_read && dev->_autoIncrement) {
+      while ((i + n < count) && (transfers[i + n].device == dev) &&
+             (transfers[i + n].write_len == 1) &&
+             (transfers[i + n].read_len > 0) &&
+             (transfers[i + n].write_buffer[0] ==
+              (uint8_t)(t->write_buffer[0] + total)) &&
+             (total + transfers[i + n].read_len <= limit)) {
+        total += transfers[i + n].read_len;
+        n++;
+      }
+    }
+
+    bool ok;
+    if (n > 1) {
+      uint8_t burst[I2CBUS_MAX_BURST];
+      ok = dev->_write(t->write_buffer, 1, false) &&
+           dev->_readAll(burst, total, true);
+      for (size_t k = 0, pos = 0; k < n; k++) {
+        if (ok) {
+          memcpy(transfers[i + k].read_buffer, burst + pos,
+                 transfers[i + k].read_len);
+        }
+        pos += transfers[i + k].read_len;
+        transfers[i + k].ok = ok;
+      }
+      _merged += n - 1;
+    } else {
+      ok = (!t->write_len ||
+            dev->_write(t->write_buffer, t->write_len, !t->read_len)) &&
+           (!t->read_len || dev->_readAll(t->read_buffer, t->read_len, true));
+      t->ok = ok;
+    }
+    all_ok = all_ok && ok;
+    i += n;
+  }
+
+  release();
+  return all_ok;
+}
@@ -0,0 +1,118 @@
+#ifndef Adafruit_I2CBus_h
+#define Adafruit_I2CBus_h
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#define I2CBUS_RTOS ///< Tasks can contend for the bus and wait for it
+#endif
+
+#ifndef I2CBUS_MAX_BUSES
+#define I2CBUS_MAX_BUSES 2 ///< TwoWire instances that can get a bus manager
+#endif
+#ifndef I2CBUS_MAX_BURST
+#define I2CBUS_MAX_BURST 32 ///< Largest merged register read, in bytes
+#endif
+
+#define I2CBUS_PRIORITY_DEFAULT 8 ///< Priority of plain I2CDevice calls
+#define I2CBUS_NO_TIMEOUT 0xFFFFFFFF ///< Wait for the bus as long as needed
+
+class Adafruit_I2CDevice;
+
+/*!
+ *    @brief  One transfer in a batch for Adafruit_I2CBus::run(): an
+ *    optional write, then an optional read with a repeated start.
+ *    A write of a single register address followed by a read is a register
+ *    read, which run() can merge with the next one.
+ */
+typedef struct {
+  Adafruit_I2CDevice *device; ///< Device to talk to
+  const uint8_t *write_buffer; ///< Bytes to write, usually a register
+  size_t write_len;            ///< Number of bytes to write, may be 0
+  uint8_t *read_buffer;        ///< Where to put the bytes read
+  size_t read_len;             ///< Number of bytes to read, may be 0
+  bool ok;                     ///< Set by run(): true if this transfer worked
+} Adafruit_I2CTransfer;
+
+/*!
+ *    @brief  Arbitration for one TwoWire shared by several tasks. A task
+ *    owns the bus from acquire() to release(), may nest them, and waiting
+ *    tasks are served by priority, then earliest deadline, then in order
+ *    of arrival. Adafruit_I2CDevice takes the bus around every call, so
+ *    drivers built on it need no changes; code that uses the TwoWire
+ *    directly can wrap its transactions in acquire() and release().
+ */
+class Adafruit_I2CBus {
+public:
+  static Adafruit_I2CBus *get(TwoWire *theWire = &Wire);
+
+  bool acquire(uint8_t priority = I2CBUS_PRIORITY_DEFAULT,
+               uint32_t timeout_ms = I2CBUS_NO_TIMEOUT);
+  void release(void);
+
+  bool run(Adafruit_I2CTransfer *transfers, size_t count,
+           uint8_t priority = I2CBUS_PRIORITY_DEFAULT,
+           uint32_t timeout_ms = I2CBUS_NO_TIMEOUT);
+
+  /*!   @brief  The TwoWire this manager arbitrates
+   *    @return Pointer to the TwoWire */
+  TwoWire *wire(void) { return _wire; }
+  /*!   @brief  Time the bus has been owned, for occupancy figures
+   *    @return Microseconds, wraps like micros() */
+  uint32_t busyMicros(void) { return _busyMicros; }
+  /*!   @brief  I2C transactions sent through Adafruit_I2CDevice
+   *    @return Count since start-up */
+  uint32_t transactions(void) { return _transactions; }
+  /*!   @brief  Register reads that run() saved by merging bursts
+   *    @return Count since start-up */
+  uint32_t mergedReads(void) { return _merged; }
+  /*!   @brief  acquire() calls that gave up at their deadline
+   *    @return Count since start-up */
+  uint32_t timeouts(void) { return _timeouts; }
+
+private:
+  friend class Adafruit_I2CDevice;
+
+  // A task waiting in acquire(), lives on that task's stack
+  struct Waiter {
+    Waiter *next;
+    void *task;
+    uint32_t deadline; // millis(), if timed
+    uint32_t order;    // Arrival, for first come first served
+    uint8_t priority;
+    bool timed;
+    bool granted;
+#ifdef I2CBUS_RTOS
+    // Given once, by the release() that grants the bus. A semaphore of its
+    // own rather than a task notification, which the task's other code
+    // may be using.
+    SemaphoreHandle_t wake;
+    StaticSemaphore_t wakeBuffer;
+#endif
+  };
+
+  void lockState(void);
+  void unlockState(void);
+  static void *currentTask(void);
+  static bool before(const Waiter *a, const Waiter *b);
+
+  TwoWire *_wire = nullptr;
+  void *_owner = nullptr; // Task holding the bus
+  uint16_t _depth = 0;    // Nested acquire() count of the owner
+  Waiter *_waiters = nullptr;
+  uint32_t _arrivals = 0;
+  uint32_t _ownedSince = 0;
+  uint32_t _busyMicros = 0;
+  uint32_t _transactions = 0;
+  uint32_t _merged = 0;
+  uint32_t _timeouts = 0;
+#ifdef I2CBUS_RTOS
+  portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+};
+
+#endif // Adafruit_I2CBus_h
@@ -0,0 +1,267 @@
+// Host test of Adafruit_I2CBus, built for ESP32 against a stand-in FreeRTOS
+// (one std::thread per task) and a fake TwoWire with three register-file
+// devices (stub/Wire.h).
+//
+// - run() merges back-to-back register reads on an auto-increment device
+//   into bursts of up to I2CBUS_MAX_BURST bytes; gaps, other devices and
+//   writes break a burst, and a missing device fails its transfer only.
+// - acquire() nests, and waiters are served by priority, then earliest
+//   deadline, then arrival; a waiter gives up at its timeout.
+// - Waiting for the bus leaves the task's notification value alone.
+// - Under load from four tasks, a priority-30 device with a 5 ms limit
+//   never misses it.
+// Then six tasks poll the three devices for 1 s, and the occupancy report
+// is printed: reads, wrong data, bus collisions, wire and ownership time.
+#include <Adafruit_I2CDevice.h>
+
+#include <mutex>
+#include <vector>
+
+TwoWire Wire;
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static const uint8_t addresses[3] = {0x18, 0x38, 0x76};
+
+static void testBatches(Adafruit_I2CBus *bus) {
+  Adafruit_I2CDevice acc(0x18);
+  acc.begin(false);
+  uint8_t regs[8] = {0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x40, 0x43};
+  uint8_t out[8][3];
+  Adafruit_I2CTransfer tr[8];
+  for (int i = 0; i < 6; i++)
+    tr[i] = {&acc, &regs[i], 1, out[i], 1, false};
+  unsigned long before = Wire.transactions;
+  CHECK(bus->run(tr, 6) && Wire.transactions - before == 12,
+        "%lu transactions without auto-increment",
+        Wire.transactions - before);
+
+  acc.setAutoIncrement(true);
+  before = Wire.transactions;
+  uint32_t merged = bus->mergedReads();
+  CHECK(bus->run(tr, 6) && Wire.transactions - before == 2,
+        "%lu transactions for 6 merged reads", Wire.transactions - before);
+  CHECK(bus->mergedReads() - merged == 5, "%u merged",
+        bus->mergedReads() - merged);
+  for (int i = 0; i < 6; i++)
+    CHECK(tr[i].ok && out[i][0] == (0x18 ^ regs[i]), "read %d", i);
+
+  tr[0] = {&acc, &regs[6], 1, out[6], 3, false};
+  tr[1] = {&acc, &regs[7], 1, out[7], 3, false};
+  before = Wire.transactions;
+  CHECK(bus->run(tr, 2) && Wire.transactions - before == 2 &&
+            out[7][2] == (0x18 ^ 0x45),
+        "two 3-byte reads");
+
+  // A different device, a write and a gap each break the burst
+  uint8_t w[2] = {0x20, 0x57}, r60 = 0x60;
+  Adafruit_I2CDevice other(0x38);
+  other.setAutoIncrement(true);
+  tr[0] = {&acc, &regs[0], 1, out[0], 1, false};
+  tr[1] = {&other, &regs[1], 1, out[1], 1, false};
+  tr[2] = {&acc, w, 2, nullptr, 0, false};
+  tr[3] = {&acc, &regs[2], 1, out[2], 1, false};
+  tr[4] = {&acc, &r60, 1, out[3], 1, false};
+  before = Wire.transactions;
+  CHECK(bus->run(tr, 5) && Wire.transactions - before == 9,
+        "%lu transactions for broken bursts", Wire.transactions - before);
+  CHECK(out[1][0] == (0x38 ^ 0x29) && Wire.devices[0x18].regs[0x20] == 0x57,
+        "other device or write");
+  Wire.devices[0x18].regs[0x20] = 0x18 ^ 0x20;
+
+  Adafruit_I2CDevice ghost(0x50);
+  tr[0] = {&ghost, &regs[0], 1, out[0], 1, false};
+  tr[1] = {&acc, &regs[0], 1, out[1], 1, false};
+  CHECK(!bus->run(tr, 2) && !tr[0].ok && tr[1].ok, "missing device");
+
+  uint8_t many[40], values[40];
+  Adafruit_I2CTransfer burst[40];
+  for (int i = 0; i < 40; i++) {
+    many[i] = i;
+    burst[i] = {&acc, &many[i], 1, &values[i], 1, false};
+  }
+  before = Wire.transactions;
+  CHECK(bus->run(burst, 40) && Wire.transactions - before == 4,
+        "%lu transactions for 40 reads", Wire.transactions - before);
+  for (int i = 0; i < 40; i++)
+    CHECK(values[i] == (0x18 ^ i), "burst read %d", i);
+}
+
+static void testOrder(Adafruit_I2CBus *bus) {
+  CHECK(bus->acquire() && bus->acquire(), "nested acquire()");
+  bus->release();
+  bool got = true;
+  std::thread([&] {
+    got = bus->acquire(8, 20);
+    if (got)
+      bus->release();
+  }).join();
+  CHECK(!got, "bus taken after one of two release()");
+  bus->release();
+  CHECK(bus->timeouts() == 1, "%u timeouts", bus->timeouts());
+
+  // The main task holds the bus while the waiters line up
+  std::vector<int> served;
+  std::mutex lock;
+  auto waiter = [&](int id, uint8_t priority, uint32_t timeout) {
+    return std::thread([&, id, priority, timeout] {
+      bool ok = bus->acquire(priority, timeout);
+      std::lock_guard<std::mutex> l(lock);
+      served.push_back(ok ? id : -id);
+      if (ok)
+        bus->release();
+    });
+  };
+  CHECK(bus->acquire(), "acquire()");
+  std::vector<std::thread> waiters;
+  waiters.push_back(waiter(1, 8, I2CBUS_NO_TIMEOUT));
+  delay(5);
+  waiters.push_back(waiter(2, 8, 500)); // Same priority, with a deadline
+  delay(5);
+  waiters.push_back(waiter(3, 8, 200)); // Earlier deadline, later arrival
+  delay(5);
+  waiters.push_back(waiter(4, 20, I2CBUS_NO_TIMEOUT)); // Higher priority
+  delay(5);
+  waiters.push_back(waiter(5, 8, 10)); // Gives up
+  delay(50);
+  bus->release();
+  for (std::thread &t : waiters)
+    t.join();
+  printf("  served:");
+  for (int s : served)
+    printf(" %d", s);
+  printf("\n");
+  CHECK((served == std::vector<int>{-5, 4, 3, 2, 1}), "service order");
+  CHECK(bus->timeouts() == 2, "%u timeouts", bus->timeouts());
+}
+
+// A task's own notifications must survive a wait for the bus, and the
+// wait must not leave one behind
+static void testNotifications(Adafruit_I2CBus *bus) {
+  for (int pending = 0; pending < 2; pending++) {
+    for (uint32_t timeout : {I2CBUS_NO_TIMEOUT, (uint32_t)500}) {
+      CHECK(bus->acquire(), "acquire()");
+      uint32_t after = 99;
+      bool ok = false;
+      std::thread task([&] {
+        if (pending)
+          xTaskNotifyGive(xTaskGetCurrentTaskHandle());
+        ok = bus->acquire(8, timeout);
+        if (ok)
+          bus->release();
+        after = ulTaskNotifyTake(pdTRUE, 0);
+      });
+      delay(20);
+      bus->release();
+      task.join();
+      CHECK(ok && after == (uint32_t)pending,
+            "notification %d before waiting, %u after", pending, after);
+    }
+  }
+}
+
+static void testDeadline(void) {
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> load;
+  for (int t = 0; t < 4; t++)
+    load.emplace_back([&] {
+      Adafruit_I2CDevice d(0x76);
+      uint8_t r = 0, b[24];
+      while (!stop)
+        d.write_then_read(&r, 1, b, 24);
+    });
+  Adafruit_I2CDevice urgent(0x38);
+  urgent.setBusPriority(30, 5);
+  uint32_t worst = 0;
+  int missed = 0;
+  for (int i = 0; i < 200; i++) {
+    uint8_t r = 0, b[2];
+    uint32_t start = micros();
+    if (!urgent.write_then_read(&r, 1, b, 2))
+      missed++;
+    uint32_t took = micros() - start;
+    if (took > worst)
+      worst = took;
+    delay(1);
+  }
+  stop = true;
+  for (std::thread &t : load)
+    t.join();
+  CHECK(!missed, "%d urgent reads missed their 5 ms limit", missed);
+  printf("  urgent reads with four busy tasks: worst %u us\n", worst);
+}
+
+static void occupancy(Adafruit_I2CBus *bus, int ms, int tasks) {
+  std::atomic<unsigned long> reads{0}, wrong{0};
+  std::atomic<bool> stop{false};
+  unsigned long collisions = Wire.collisions, stolen = Wire.stolenRestarts;
+  unsigned long wireTransactions = Wire.transactions;
+  uint64_t busNanos = Wire.busNanos;
+  uint32_t owned = bus->busyMicros(), transactions = bus->transactions();
+  uint32_t timeouts = bus->timeouts(), start = micros();
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < tasks; t++)
+    threads.emplace_back([&, t] {
+      Adafruit_I2CDevice dev(addresses[t % 3]);
+      dev.begin(false);
+      uint8_t reg = 0x10 + 0x10 * (t / 3), buf[6];
+      while (!stop) {
+        bool ok = dev.write_then_read(&reg, 1, buf, 6);
+        for (int i = 0; ok && i < 6; i++)
+          ok = buf[i] == (uint8_t)(addresses[t % 3] ^ (reg + i));
+        reads++;
+        wrong += !ok;
+      }
+    });
+  delay(ms);
+  stop = true;
+  for (std::thread &t : threads)
+    t.join();
+  double wall = micros() - start;
+
+  collisions = Wire.collisions - collisions;
+  stolen = Wire.stolenRestarts - stolen;
+  CHECK(!wrong && !collisions && !stolen,
+        "%lu wrong reads, %lu collisions, %lu stolen restarts", wrong.load(),
+        collisions, stolen);
+  printf("  %d tasks, %d ms: %lu reads, %lu wrong, %lu collisions, "
+         "%lu stolen restarts\n",
+         tasks, ms, reads.load(), wrong.load(), collisions, stolen);
+  printf("  wire busy %.0f%%, bus owned %.0f%%, %u transactions (wire saw "
+         "%lu), %u timeouts\n",
+         (Wire.busNanos - busNanos) / 10.0 / wall,
+         (bus->busyMicros() - owned) * 100.0 / wall,
+         bus->transactions() - transactions,
+         Wire.transactions - wireTransactions, bus->timeouts() - timeouts);
+}
+
+int main(void) {
+  for (uint8_t a : addresses)
+    for (int r = 0; r < 256; r++)
+      Wire.devices[a].regs[r] = a ^ r;
+  Adafruit_I2CBus *bus = Adafruit_I2CBus::get(&Wire);
+
+  printf("Batches\n");
+  testBatches(bus);
+  printf("Waiting order\n");
+  testOrder(bus);
+  printf("Task notifications\n");
+  testNotifications(bus);
+  printf("Deadline under load\n");
+  testDeadline();
+  printf("Occupancy\n");
+  occupancy(bus, 1000, 6);
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,26 @@
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <chrono>
+#include <thread>
+
+#define F(x) (x)
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+inline uint32_t micros(void) {
+  static auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+inline uint32_t millis(void) { return micros() / 1000; }
+inline void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef _HOST_SEMPHR_H
+#define _HOST_SEMPHR_H
+
+#include <freertos/FreeRTOS.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+/// Binary semaphore. Giving one that was deleted aborts.
+struct StaticSemaphore_t {
+  std::mutex lock;
+  std::condition_variable cv;
+  bool given = false, created = false;
+};
+typedef StaticSemaphore_t *SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *s) {
+  s->given = false;
+  s->created = true;
+  return s;
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t s) { s->created = false; }
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  std::lock_guard<std::mutex> l(s->lock);
+  if (!s->created) {
+    fprintf(stderr, "xSemaphoreGive: semaphore deleted\n");
+    abort();
+  }
+  if (s->given)
+    return pdFALSE;
+  s->given = true;
+  s->cv.notify_one();
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+  std::unique_lock<std::mutex> l(s->lock);
+  auto given = [s] { return s->given; };
+  if (ticks == portMAX_DELAY)
+    s->cv.wait(l, given);
+  else if (!s->cv.wait_for(l, std::chrono::milliseconds(ticks), given))
+    return pdFALSE;
+  s->given = false;
+  return pdTRUE;
+}
+
+#endif
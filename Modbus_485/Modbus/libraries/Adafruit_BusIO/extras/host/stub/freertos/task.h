@@ -0,0 +1,47 @@
+#ifndef _HOST_TASK_H
+#define _HOST_TASK_H
+
+#include <freertos/FreeRTOS.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+/// A task, with its default notification value
+struct HostTask {
+  std::mutex lock;
+  std::condition_variable cv;
+  uint32_t notification = 0;
+};
+typedef HostTask *TaskHandle_t;
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+  static thread_local HostTask task;
+  return &task;
+}
+
+inline void xTaskNotifyGive(TaskHandle_t task) {
+  {
+    std::lock_guard<std::mutex> l(task->lock);
+    task->notification++;
+  }
+  task->cv.notify_one();
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+  HostTask *t = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> l(t->lock);
+  auto given = [t] { return t->notification > 0; };
+  if (ticks == portMAX_DELAY)
+    t->cv.wait(l, given);
+  else
+    t->cv.wait_for(l, std::chrono::milliseconds(ticks), given);
+  uint32_t value = t->notification;
+  if (clear)
+    t->notification = 0;
+  else if (value)
+    t->notification--;
+  return value;
+}
+
+#endif
@@ -68,6 +68,8 @@ public:
   void invertDisplay(bool i);
   void setContrast(uint8_t contrastlevel);
   void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   bool getPixel(int16_t x, int16_t y);
   uint8_t *getBuffer(void);
 
@@ -87,6 +89,11 @@ protected:
       window_y1,     ///< Dirty tracking window minimum y
       window_x2,     ///< Dirty tracking window maximum x
       window_y2;     ///< Dirty tracking window maximum y
+  GFXdirtyTiles dirty; ///< Dirty 8x8 tiles, a tile row is one display page
+
+  void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+  void drawFastRawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastRawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
 
   int dcPin,  ///< The Arduino pin connected to D/C (for SPI)
       csPin,  ///< The Arduino pin connected to CS (for SPI)
@@ -0,0 +1,353 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeMono24pt7bRLEBitmaps[] PROGMEM = {
+    0xEC, 0x13, 0x1E, 0x50, 0x21, 0x2E, 0x50, 0x63, 0x1E, 0x25, 0x13, 0x10,
+    0x07, 0x27, 0xE6, 0x15, 0x45, 0x34, 0x45, 0x1E, 0x40, 0x23, 0x63, 0x20,
+    0xE6, 0x72, 0x42, 0xB2, 0x33, 0xB2, 0x32, 0x5F, 0x06, 0x24, 0x25, 0xF0,
+    0x1D, 0x5E, 0x56, 0x24, 0x25, 0xFD, 0x57, 0x24, 0x2B, 0x23, 0x3A, 0x33,
+    0x26, 0xE7, 0x05, 0x24, 0x26, 0xE2, 0x82, 0xD1, 0x6A, 0xA1, 0x24, 0x36,
+    0x53, 0x39, 0x32, 0x3B, 0x22, 0x2C, 0x21, 0xF0, 0x12, 0xD3, 0x3D, 0x33,
+    0xD3, 0x5D, 0x28, 0xD0, 0x7D, 0x25, 0xD3, 0x2D, 0x33, 0xD3, 0x3D, 0x24,
+    0xD1, 0x4D, 0x06, 0xB3, 0x16, 0x64, 0x22, 0x1C, 0x88, 0x5E, 0x50, 0x82,
+    0x80, 0x54, 0xD1, 0x8B, 0x34, 0x3A, 0x26, 0x28, 0xE3, 0x01, 0x28, 0x29,
+    0x26, 0x2A, 0x34, 0x3B, 0x87, 0x25, 0x46, 0x5B, 0x6B, 0x6B, 0x6B, 0x6C,
+    0x5D, 0x22, 0x94, 0xD1, 0x8B, 0x34, 0x3A, 0x26, 0x22, 0xE3, 0x07, 0x28,
+    0x29, 0x26, 0x39, 0x34, 0x3B, 0x8D, 0x14, 0x50, 0x65, 0x12, 0x99, 0x83,
+    0x41, 0x93, 0xCE, 0x20, 0x32, 0xD0, 0xF0, 0x42, 0xCF, 0x05, 0x2D, 0x15,
+    0xC3, 0x13, 0x54, 0x12, 0x42, 0x57, 0x52, 0x42, 0x22, 0x63, 0x22, 0x32,
+    0x72, 0x22, 0x32, 0x82, 0x12, 0x32, 0x84, 0x42, 0x93, 0x52, 0x83, 0x53,
+    0x64, 0x63, 0x43, 0x15, 0x38, 0x25, 0x54, 0x90, 0x07, 0xE6, 0x15, 0x34,
+    0x1E, 0x40, 0x23, 0x20, 0x52, 0x43, 0x42, 0x43, 0x42, 0x2F, 0x02, 0x34,
+    0x23, 0xE2, 0x01, 0x34, 0x24, 0xE8, 0x35, 0x24, 0xE2, 0x01, 0x35, 0x23,
+    0xF0, 0x23, 0x52, 0x53, 0x1F, 0x04, 0x26, 0x26, 0x10, 0x02, 0x53, 0x52,
+    0x53, 0x52, 0x3F, 0x02, 0x35, 0x22, 0xE3, 0x03, 0x31, 0xE8, 0x04, 0x34,
+    0x21, 0xE2, 0x03, 0x31, 0xF0, 0x32, 0x43, 0x42, 0x43, 0x42, 0x43, 0x42,
+    0x51, 0x60, 0xE4, 0x82, 0x91, 0x62, 0x67, 0x32, 0x35, 0x2D, 0x17, 0x8C,
+    0x4D, 0x15, 0xC2, 0x22, 0xB2, 0x42, 0x93, 0x43, 0x82, 0x62, 0x72, 0x82,
+    0x30, 0xE9, 0x92, 0x9F, 0xD7, 0xE9, 0x92, 0x90, 0x36, 0xF3, 0x51, 0xF0,
+    0x25, 0x44, 0x45, 0x3F, 0x01, 0x45, 0x35, 0x45, 0xF3, 0x62, 0x70, 0xF1,
+    0xD8, 0x15, 0x1E, 0x37, 0x15, 0x10, 0xD3, 0x2D, 0x23, 0xFD, 0x22, 0x1F,
+    0x0D, 0x12, 0x2F, 0x0D, 0x02, 0x3F, 0x0C, 0x24, 0xF0, 0xB2, 0x5F, 0x0A,
+    0x26, 0xF0, 0x92, 0x7F, 0x08, 0x28, 0xF0, 0x72, 0xD2, 0x3D, 0x22, 0xD2,
+    0x3D, 0x22, 0xD2, 0x3D, 0x22, 0xD2, 0x3D, 0x22, 0xD2, 0x3D, 0x22, 0xD2,
+    0x3D, 0x1F, 0x01, 0x2D, 0x2F, 0x2D, 0x30, 0x66, 0xAA, 0x74, 0x44, 0x53,
+    0x82, 0x52, 0xA2, 0x33, 0xA3, 0x1F, 0x01, 0x2C, 0x21, 0x3C, 0x3E, 0xB0,
+    0x2D, 0x15, 0xC3, 0xF1, 0x2C, 0x22, 0x3A, 0x33, 0x2A, 0x24, 0x38, 0x26,
+    0x44, 0x47, 0xAA, 0x66, 0x63, 0xC4, 0xB5, 0xA3, 0x12, 0x93, 0x22, 0x83,
+    0x32, 0x73, 0x42, 0x72, 0x52, 0x7E, 0xD5, 0x07, 0x27, 0xFD, 0x30, 0x66,
+    0xAA, 0x73, 0x63, 0x52, 0x93, 0x32, 0xB3, 0x13, 0xC2, 0x1F, 0x2D, 0x12,
+    0xFD, 0x32, 0xFD, 0x22, 0xD2, 0x2D, 0x22, 0xD2, 0x2D, 0x22, 0xD2, 0x2D,
+    0x22, 0xD2, 0x2D, 0x22, 0xD2, 0x2D, 0x22, 0xD2, 0x2D, 0x22, 0xD2, 0x2C,
+    0x21, 0x1D, 0x13, 0xD2, 0x2F, 0x0D, 0x50, 0x67, 0xAB, 0x73, 0x64, 0x52,
+    0xA3, 0x32, 0xC2, 0x2E, 0x40, 0xD3, 0x2D, 0x32, 0xD3, 0x3D, 0x23, 0xB7,
+    0xC6, 0xD4, 0x4D, 0x43, 0xD4, 0x3D, 0x42, 0x1E, 0x40, 0xD4, 0x2D, 0x32,
+    0x12, 0xD0, 0x31, 0x3B, 0x33, 0x56, 0x46, 0xCA, 0x67, 0xA4, 0xB5, 0xB2,
+    0x12, 0xA2, 0x22, 0xA1, 0x32, 0x92, 0x32, 0x2F, 0x06, 0x24, 0x27, 0x25,
+    0x27, 0x16, 0x26, 0x26, 0x26, 0x17, 0x25, 0x18, 0x24, 0x28, 0x24, 0x19,
+    0x23, 0x29, 0x23, 0x1A, 0x22, 0x1B, 0x22, 0xFD, 0x3E, 0x5C, 0x22, 0xF0,
+    0x88, 0xF2, 0xD1, 0x3E, 0x70, 0x22, 0xD4, 0x23, 0x68, 0xD0, 0x63, 0x83,
+    0xD5, 0x22, 0xF0, 0xD3, 0x21, 0xE5, 0x0D, 0x42, 0xFD, 0x32, 0x12, 0xD0,
+    0x31, 0x3B, 0x33, 0x56, 0x46, 0xCA, 0x67, 0xA7, 0x9A, 0x65, 0xC4, 0xD0,
+    0x3D, 0x13, 0xD1, 0x3D, 0x22, 0xD2, 0x3D, 0x1F, 0x01, 0x2D, 0x23, 0xD2,
+    0x25, 0x65, 0x23, 0x94, 0x22, 0x44, 0x42, 0x21, 0x38, 0x22, 0x21, 0x2A,
+    0x21, 0x4B, 0x21, 0xF3, 0xD0, 0x4D, 0x12, 0xE2, 0x12, 0xD0, 0x22, 0x2B,
+    0x23, 0x3A, 0x24, 0x38, 0x26, 0x35, 0x38, 0x9B, 0x56, 0xF0, 0xD5, 0xF0,
+    0x2D, 0x14, 0xD0, 0x3F, 0xD2, 0x2D, 0x23, 0x1E, 0x20, 0xD1, 0x22, 0xE2,
+    0x0D, 0x02, 0x3E, 0x20, 0xC2, 0x4E, 0x20, 0xB2, 0x5E, 0x20, 0xA2, 0x6E,
+    0x20, 0x92, 0x7F, 0x08, 0x28, 0x66, 0xAA, 0x64, 0x64, 0x33, 0xA3, 0x22,
+    0xC2, 0x13, 0xC3, 0xE3, 0x02, 0xD1, 0x21, 0x2C, 0x23, 0x2A, 0x25, 0x36,
+    0x33, 0xF0, 0x4A, 0x73, 0x63, 0x52, 0xA2, 0x2F, 0x01, 0x2C, 0x21, 0xE4,
+    0x2D, 0x12, 0x12, 0xC2, 0x22, 0xB3, 0x32, 0x93, 0x53, 0x63, 0x7A, 0xA6,
+    0x60, 0x56, 0xB9, 0x83, 0x53, 0x62, 0x83, 0x42, 0xA3, 0x32, 0xB2, 0x2E,
+    0x22, 0xD0, 0x21, 0x2D, 0x12, 0xF0, 0x2D, 0x03, 0x12, 0xB4, 0x12, 0xA2,
+    0x12, 0x22, 0x82, 0x22, 0x24, 0x44, 0x22, 0x49, 0x32, 0x56, 0x52, 0xD2,
+    0x3F, 0xD2, 0x2D, 0x23, 0xD2, 0x2D, 0x23, 0xD1, 0x3D, 0x13, 0xD0, 0x4C,
+    0x56, 0xA9, 0x7A, 0x15, 0x1E, 0x37, 0x15, 0x1E, 0x80, 0x85, 0x1E, 0x37,
+    0x15, 0x10, 0x45, 0x1E, 0x30, 0x37, 0x45, 0x1E, 0x60, 0xD0, 0x73, 0x64,
+    0x54, 0x62, 0xF0, 0x25, 0x54, 0x55, 0x4F, 0x01, 0x46, 0x36, 0x46, 0x38,
+    0x18, 0xD6, 0x2D, 0x54, 0xD3, 0x4D, 0x43, 0xD4, 0x4D, 0x34, 0xD3, 0x4D,
+    0x34, 0xD4, 0x3D, 0x44, 0xD3, 0x4D, 0x64, 0xD6, 0x4D, 0x74, 0xD7, 0x4D,
+    0x74, 0xD7, 0x4D, 0x64, 0xD7, 0x4D, 0x74, 0xD7, 0x3D, 0x81, 0x10, 0xF1,
+    0xDA, 0xE4, 0xDB, 0xF0, 0x1D, 0xA0, 0x02, 0xD6, 0x4D, 0x64, 0xD6, 0x4D,
+    0x63, 0xD6, 0x4D, 0x64, 0xD6, 0x4D, 0x64, 0xD6, 0x33, 0xF0, 0xD3, 0x4D,
+    0x24, 0xD2, 0x4D, 0x24, 0xD2, 0x4D, 0x34, 0xD2, 0x4D, 0x24, 0xD2, 0x4D,
+    0x33, 0xD5, 0x2D, 0x60, 0x57, 0x7C, 0x35, 0x64, 0x22, 0xB3, 0x12, 0xC2,
+    0x1F, 0x2D, 0x02, 0xFD, 0x22, 0xD1, 0x3D, 0x12, 0xD0, 0x3C, 0x4B, 0x5B,
+    0x37, 0xE2, 0x07, 0x28, 0xE4, 0x0D, 0xA4, 0x7E, 0x20, 0x56, 0xC4, 0x70,
+    0x66, 0xAA, 0x74, 0x53, 0x53, 0x83, 0x42, 0xA2, 0x33, 0xB2, 0x1F, 0x01,
+    0x2C, 0x21, 0x2D, 0x02, 0x12, 0x96, 0x12, 0x78, 0x12, 0x64, 0x32, 0x12,
+    0x53, 0x52, 0x12, 0x43, 0x62, 0x1E, 0x32, 0x42, 0x72, 0x12, 0x52, 0x62,
+    0x12, 0x54, 0x42, 0x12, 0x6C, 0x88, 0xF0, 0x2D, 0x3F, 0x01, 0x2D, 0x33,
+    0xD3, 0x2D, 0x33, 0xD3, 0x47, 0x26, 0xC8, 0x75, 0xF5, 0xBD, 0xA2, 0x12,
+    0xDA, 0x22, 0x2D, 0x91, 0x32, 0xBF, 0x0A, 0x24, 0x2D, 0x62, 0x52, 0xAF,
+    0x09, 0x26, 0x29, 0xF0, 0x82, 0x82, 0xD3, 0x19, 0x28, 0xF0, 0x72, 0xA2,
+    0xD0, 0xD2, 0xD0, 0xD3, 0xC1, 0xD0, 0x26, 0xF0, 0x52, 0xD1, 0x29, 0x2D,
+    0x22, 0x5F, 0x04, 0x2D, 0x32, 0x72, 0xD5, 0x23, 0xF0, 0x19, 0x8A, 0x0D,
+    0x36, 0xD5, 0x72, 0xB3, 0x62, 0xC3, 0x52, 0xD0, 0x31, 0xE2, 0x03, 0x2D,
+    0x12, 0x42, 0xD0, 0x34, 0x2C, 0x35, 0x2A, 0x46, 0xD1, 0x8D, 0x27, 0x2B,
+    0x45, 0x2D, 0x03, 0x42, 0xD1, 0x24, 0x2D, 0x13, 0xE3, 0x32, 0xD2, 0x23,
+    0x2D, 0x12, 0x42, 0xD0, 0x34, 0x2C, 0x32, 0xD6, 0x3D, 0x45, 0x86, 0xD1,
+    0xB2, 0x25, 0x46, 0x41, 0x24, 0x3A, 0x53, 0x3D, 0x03, 0x32, 0xD1, 0x32,
+    0x3D, 0x22, 0x22, 0xD3, 0x22, 0x2D, 0x6E, 0x92, 0xD7, 0xF0, 0x12, 0xD7,
+    0x3D, 0x73, 0xD2, 0x23, 0x3D, 0x02, 0x53, 0xA3, 0x74, 0x64, 0x9C, 0xD0,
+    0x67, 0x0D, 0x27, 0xD4, 0x72, 0xA4, 0x62, 0xC3, 0x52, 0xD0, 0x34, 0x2D,
+    0x12, 0x42, 0xD1, 0x33, 0x2D, 0x22, 0x32, 0xD2, 0x3E, 0x82, 0x2D, 0x32,
+    0xF2, 0x2D, 0x22, 0x32, 0xD1, 0x24, 0x2D, 0x03, 0x42, 0xC3, 0x52, 0xA4,
+    0x4D, 0x45, 0xD2, 0x70, 0xF0, 0xD8, 0x1E, 0x40, 0x32, 0xD1, 0x24, 0x2D,
+    0x4E, 0x20, 0x32, 0x72, 0x8F, 0x03, 0xB8, 0xE2, 0x03, 0x27, 0x28, 0xF0,
+    0x32, 0xD4, 0xE5, 0x03, 0x2D, 0x22, 0xF0, 0xD9, 0xF0, 0xD9, 0xE4, 0x32,
+    0xD2, 0x23, 0x2D, 0x4E, 0x20, 0x32, 0x72, 0x8F, 0x03, 0xB8, 0xE2, 0x03,
+    0x27, 0x28, 0xE7, 0x03, 0x2D, 0x4F, 0xCA, 0x88, 0xD0, 0xC2, 0x26, 0x47,
+    0x65, 0x3B, 0x44, 0x2D, 0x13, 0x32, 0xD3, 0x22, 0x3D, 0x32, 0x1F, 0x01,
+    0x2D, 0x73, 0xD7, 0xE4, 0x2D, 0x8F, 0x2B, 0xAF, 0x02, 0xD5, 0x21, 0x3D,
+    0x42, 0x1F, 0x01, 0x2D, 0x42, 0x32, 0xD3, 0x23, 0x3D, 0x22, 0x44, 0xD0,
+    0x26, 0x48, 0x57, 0xD1, 0xC8, 0x60, 0xF1, 0x77, 0x71, 0xE8, 0x03, 0x2D,
+    0x02, 0x3F, 0x03, 0xD4, 0x3E, 0xA0, 0x32, 0xD0, 0x23, 0xF8, 0x78, 0xF0,
+    0xD3, 0xED, 0x87, 0x27, 0xFD, 0x30, 0xF8, 0xD2, 0xEC, 0xD3, 0x25, 0xE5,
+    0x2D, 0x12, 0x52, 0xD0, 0x26, 0x3C, 0x27, 0x3A, 0x29, 0x46, 0x3B, 0xBD,
+    0x26, 0xB0, 0xF0, 0x96, 0x84, 0x2D, 0x02, 0x72, 0xB3, 0x82, 0xA3, 0x92,
+    0x93, 0xA2, 0x83, 0xB2, 0x73, 0xC2, 0x62, 0xD1, 0x24, 0x3D, 0x22, 0x33,
+    0xD3, 0x22, 0x4D, 0x32, 0x17, 0xD1, 0x53, 0x3D, 0x03, 0x72, 0xC2, 0x92,
+    0xB2, 0x93, 0xA2, 0xA2, 0x7F, 0x03, 0x2B, 0x26, 0xF0, 0x32, 0xC2, 0x82,
+    0xC3, 0x72, 0xD0, 0x24, 0x99, 0xD2, 0xA5, 0xF0, 0xC9, 0xED, 0x00, 0x52,
+    0xD1, 0xE7, 0x05, 0x2C, 0x2F, 0x0D, 0x80, 0xF0, 0x6D, 0x16, 0xF2, 0x21,
+    0x2C, 0x21, 0x22, 0xF0, 0x22, 0x22, 0xA2, 0x22, 0x42, 0x23, 0x83, 0x22,
+    0x42, 0x32, 0x82, 0x32, 0x42, 0x33, 0x63, 0x32, 0x2F, 0x02, 0x24, 0x26,
+    0x24, 0x22, 0xF0, 0x22, 0x52, 0x42, 0x52, 0x2F, 0x02, 0x26, 0x22, 0x26,
+    0x22, 0xF0, 0x22, 0x74, 0x72, 0x42, 0x82, 0x82, 0x2E, 0x50, 0x22, 0xD5,
+    0x22, 0xF8, 0xA8, 0xF0, 0x6A, 0x83, 0x4D, 0x02, 0x55, 0xC2, 0x52, 0x12,
+    0xC2, 0x52, 0x22, 0xB2, 0x52, 0x23, 0xA2, 0x52, 0x32, 0xA2, 0x2F, 0x03,
+    0x24, 0x29, 0x25, 0x25, 0x28, 0x25, 0x25, 0x37, 0x25, 0x26, 0x27, 0x25,
+    0x27, 0x26, 0x25, 0x27, 0x35, 0x25, 0x28, 0x25, 0x22, 0xF0, 0x32, 0x92,
+    0x42, 0x52, 0xA2, 0x32, 0x52, 0xA3, 0x22, 0x52, 0xB2, 0x22, 0x52, 0xC2,
+    0x12, 0x52, 0xC5, 0x52, 0xD0, 0x42, 0xF0, 0x18, 0xA3, 0x20, 0x96, 0xD3,
+    0xBB, 0x46, 0x49, 0x3A, 0x37, 0x3C, 0x35, 0x3D, 0x13, 0x42, 0xD3, 0x23,
+    0x3D, 0x33, 0x1F, 0x01, 0x2D, 0x52, 0x1E, 0x72, 0xD7, 0x2F, 0x12, 0xD5,
+    0x22, 0x3D, 0x33, 0x32, 0xD3, 0x24, 0x3D, 0x13, 0x53, 0xC3, 0x73, 0xA3,
+    0x94, 0x64, 0xBC, 0xD2, 0x69, 0x0D, 0x35, 0xD5, 0x62, 0xA4, 0x52, 0xC3,
+    0x42, 0xD0, 0x21, 0xE3, 0x03, 0x2D, 0x12, 0x32, 0xD0, 0x33, 0x2D, 0x02,
+    0x42, 0xC2, 0x52, 0xA4, 0x5D, 0x17, 0xC6, 0xE8, 0x03, 0x2D, 0x3F, 0xC9,
+    0x96, 0xD3, 0xAC, 0x46, 0x49, 0x3A, 0x37, 0x3C, 0x35, 0x3D, 0x13, 0x42,
+    0xD3, 0x23, 0x3D, 0x33, 0x1F, 0x01, 0x2D, 0x52, 0x1E, 0x72, 0xD7, 0x2F,
+    0x12, 0xD5, 0x22, 0x3D, 0x33, 0x32, 0xD3, 0x25, 0x2D, 0x13, 0x62, 0xC3,
+    0x82, 0xA3, 0xA3, 0x64, 0xD0, 0xAD, 0x26, 0xD4, 0x3D, 0x6B, 0x43, 0x5D,
+    0x56, 0x38, 0x53, 0x0D, 0x29, 0xD4, 0xA2, 0x94, 0x92, 0xB3, 0x82, 0xC2,
+    0x5E, 0x30, 0x32, 0xD0, 0x27, 0x2C, 0x37, 0x2C, 0x28, 0x2A, 0x39, 0x28,
+    0x4A, 0xD0, 0xBB, 0xD0, 0x27, 0x3C, 0x28, 0x3B, 0x29, 0x3A, 0x2A, 0x39,
+    0x2B, 0x38, 0x2C, 0x25, 0xF0, 0x32, 0xD0, 0x27, 0x2D, 0x12, 0x39, 0xAD,
+    0x1B, 0x40, 0x67, 0xBB, 0x22, 0x44, 0x66, 0x33, 0xA4, 0x32, 0xC3, 0x1E,
+    0x20, 0x12, 0xD1, 0x22, 0x2D, 0x53, 0xD5, 0x2D, 0x63, 0xD5, 0x6D, 0x38,
+    0xD3, 0x7D, 0x53, 0xD5, 0x3D, 0x53, 0xFD, 0x52, 0xF0, 0x2D, 0x35, 0xD1,
+    0x6D, 0x12, 0x15, 0xA4, 0x12, 0x14, 0x65, 0x22, 0x2C, 0xA8, 0x60, 0xF0,
+    0xD9, 0xE4, 0x02, 0x82, 0x82, 0xED, 0x3A, 0x2A, 0xF0, 0x4D, 0x14, 0xF0,
+    0x87, 0x8E, 0xD4, 0x22, 0xD2, 0x24, 0x3D, 0x03, 0x52, 0xD0, 0x26, 0x3B,
+    0x37, 0x39, 0x39, 0x45, 0x4B, 0xBD, 0x17, 0x80, 0xF1, 0x98, 0xA3, 0x2D,
+    0x52, 0x3F, 0x04, 0x2D, 0x32, 0x92, 0xD2, 0x24, 0xF0, 0x52, 0xD1, 0x25,
+    0xF0, 0x62, 0xC2, 0xC3, 0xB2, 0x6F, 0x07, 0x2A, 0x27, 0xF0, 0x82, 0x82,
+    0xD3, 0x37, 0x28, 0xF0, 0x92, 0x62, 0x9F, 0x0A, 0x24, 0x2D, 0x72, 0x41,
+    0xBF, 0x0B, 0x22, 0x2B, 0xF0, 0xC4, 0xDB, 0x3D, 0x00, 0xF0, 0x98, 0x9E,
+    0x22, 0x2D, 0x52, 0x42, 0x83, 0x72, 0x42, 0x74, 0x72, 0x52, 0x64, 0x72,
+    0x52, 0x65, 0x61, 0x62, 0x61, 0x22, 0x61, 0x3F, 0x03, 0x25, 0x22, 0x25,
+    0x26, 0x25, 0x23, 0x24, 0x23, 0xF0, 0x32, 0x42, 0x42, 0x42, 0x63, 0x32,
+    0x43, 0x32, 0x72, 0x31, 0x62, 0x32, 0x72, 0x22, 0x62, 0x31, 0x82, 0x22,
+    0x62, 0x22, 0x82, 0x22, 0x72, 0x12, 0x4E, 0x20, 0x42, 0x12, 0x82, 0x12,
+    0x82, 0x11, 0xA4, 0x93, 0xA4, 0x93, 0xA3, 0x50, 0xF1, 0x78, 0x83, 0x2D,
+    0x12, 0x72, 0xC3, 0x73, 0xA3, 0x93, 0x92, 0xB2, 0x82, 0xD0, 0x26, 0x2D,
+    0x13, 0x43, 0xD2, 0x32, 0x3D, 0x43, 0x12, 0xD6, 0x4D, 0x82, 0xD8, 0x4D,
+    0x66, 0xD5, 0x22, 0x2D, 0x42, 0x42, 0xD2, 0x26, 0x2D, 0x03, 0x63, 0xB3,
+    0x83, 0xA2, 0xA2, 0x92, 0xC2, 0x72, 0xD1, 0x25, 0x3D, 0x13, 0x2F, 0x88,
+    0x80, 0xF0, 0x88, 0x83, 0x2D, 0x12, 0x72, 0xC2, 0x83, 0xA3, 0x92, 0xA2,
+    0xB2, 0x82, 0xC3, 0x63, 0xD0, 0x26, 0x2D, 0x22, 0x42, 0xD3, 0x32, 0x3D,
+    0x42, 0x22, 0x9F, 0x0A, 0x4A, 0xE9, 0x0B, 0x2B, 0xF0, 0x5D, 0x15, 0xF1,
+    0xD3, 0x22, 0xC2, 0x22, 0xB2, 0x32, 0xA3, 0x32, 0x93, 0x42, 0x92, 0x52,
+    0x83, 0xD1, 0x3D, 0x22, 0xD2, 0x3D, 0x13, 0xD2, 0x2D, 0x22, 0xD2, 0x3D,
+    0x13, 0xD2, 0x2D, 0x23, 0x92, 0x33, 0xA2, 0x32, 0xB2, 0x22, 0xC2, 0x13,
+    0xC5, 0xD0, 0x4D, 0x12, 0xF0, 0xD5, 0xF0, 0x7E, 0xDF, 0x02, 0x52, 0x5F,
+    0x70, 0xF0, 0x2D, 0x3F, 0x01, 0x2D, 0x2F, 0x02, 0x2D, 0x1F, 0x03, 0x2D,
+    0x0F, 0x04, 0x2C, 0xF0, 0x52, 0xBF, 0x06, 0x2A, 0xF0, 0x72, 0x9F, 0x08,
+    0x28, 0xF0, 0x92, 0x7F, 0x0A, 0x2D, 0x33, 0xD3, 0x2D, 0x33, 0xD3, 0x2D,
+    0x33, 0xD3, 0x2D, 0x33, 0x2F, 0x0D, 0x12, 0x2F, 0x0D, 0x22, 0x1F, 0x0D,
+    0x32, 0xF0, 0x7E, 0xDF, 0x52, 0x52, 0xF0, 0x70, 0x91, 0xD3, 0x2D, 0x24,
+    0xD0, 0x31, 0x2B, 0x32, 0x3A, 0x24, 0x38, 0x26, 0x27, 0x28, 0x25, 0x39,
+    0x23, 0x3A, 0x32, 0x2C, 0x5D, 0x12, 0xF0, 0xDF, 0x02, 0x63, 0x63, 0x64,
+    0x63, 0x63, 0x62, 0x77, 0xBD, 0x09, 0x38, 0x4D, 0x72, 0x4E, 0x40, 0xD4,
+    0x29, 0x92, 0x26, 0xD3, 0x55, 0x93, 0x43, 0xD0, 0x23, 0x3D, 0x12, 0x3F,
+    0x2D, 0x22, 0x32, 0xD1, 0x33, 0x2D, 0x04, 0x42, 0xA3, 0x12, 0x44, 0x64,
+    0x25, 0x2B, 0x45, 0x47, 0xB0, 0xF0, 0x5D, 0x5E, 0x40, 0x32, 0xD8, 0x25,
+    0x6A, 0x23, 0xA8, 0x22, 0x36, 0x37, 0x21, 0x38, 0x36, 0x4C, 0x25, 0x4C,
+    0x34, 0x3D, 0x12, 0x43, 0xD1, 0x3E, 0x53, 0x2D, 0x32, 0xF3, 0x3D, 0x12,
+    0x44, 0xC3, 0x45, 0xA3, 0x52, 0x13, 0x83, 0x35, 0x23, 0x63, 0x45, 0x3A,
+    0xD2, 0x67, 0x77, 0xCB, 0x22, 0x54, 0x66, 0x43, 0xA4, 0x32, 0xD0, 0x32,
+    0x3D, 0x12, 0x22, 0xD2, 0x21, 0x3D, 0x22, 0x1E, 0x52, 0xD6, 0x3D, 0x62,
+    0xD6, 0x3D, 0x62, 0xD2, 0x23, 0x3B, 0x44, 0x47, 0x47, 0xD0, 0xA8, 0x60,
+    0xFD, 0x35, 0x3E, 0x40, 0xD6, 0x2A, 0x66, 0x28, 0xA4, 0x27, 0x45, 0x42,
+    0x26, 0x39, 0x31, 0x25, 0x3B, 0x54, 0x3D, 0x04, 0x42, 0xD2, 0x33, 0x3D,
+    0x23, 0x3E, 0x52, 0xD4, 0x23, 0xF0, 0x12, 0xD2, 0x34, 0x3D, 0x04, 0x53,
+    0xB2, 0x12, 0x63, 0x93, 0x12, 0x74, 0x54, 0x25, 0x5A, 0x45, 0x76, 0xB0,
+    0x77, 0xCB, 0x84, 0x74, 0x53, 0xB3, 0x42, 0xD0, 0x32, 0x2D, 0x22, 0x22,
+    0xD3, 0x2F, 0x02, 0xD4, 0x2F, 0x0D, 0x8E, 0x20, 0x2D, 0x6F, 0x01, 0x2D,
+    0x72, 0xD6, 0x3D, 0x12, 0x33, 0xC3, 0x44, 0x75, 0x7C, 0xB7, 0x60, 0x99,
+    0x8C, 0x63, 0xD2, 0x3B, 0xE3, 0x05, 0x2C, 0xFD, 0x42, 0xED, 0x20, 0x52,
+    0xCF, 0xD3, 0x30, 0x76, 0xD2, 0xA3, 0x54, 0x36, 0x32, 0x53, 0x39, 0x21,
+    0x25, 0x2C, 0x44, 0x3C, 0x44, 0x2D, 0x13, 0x33, 0xD1, 0x33, 0xE5, 0x2D,
+    0x32, 0x3F, 0x01, 0x2D, 0x13, 0x52, 0xC4, 0x53, 0xA2, 0x12, 0x64, 0x63,
+    0x22, 0x8A, 0x32, 0xA6, 0x52, 0x3E, 0x30, 0xD5, 0x2D, 0x72, 0xD7, 0x3D,
+    0x63, 0xBB, 0xC9, 0x80, 0xF0, 0x5D, 0x5E, 0x40, 0x32, 0xD8, 0x24, 0x6B,
+    0x23, 0x99, 0x21, 0x36, 0x38, 0x58, 0x37, 0x4A, 0x36, 0x3C, 0x23, 0xEC,
+    0x03, 0x2D, 0x02, 0x3F, 0x87, 0x80, 0xE4, 0x73, 0x8E, 0x30, 0xD5, 0xF0,
+    0x28, 0x8E, 0xD2, 0x08, 0x28, 0xFD, 0x50, 0xE4, 0x93, 0x2E, 0x30, 0xD1,
+    0xFD, 0x1E, 0xD8, 0xC2, 0xB3, 0xA3, 0xA3, 0x2B, 0x3A, 0x40, 0xF0, 0x5D,
+    0x4E, 0x50, 0x32, 0xD4, 0xF0, 0x32, 0x68, 0x62, 0x82, 0xA2, 0x63, 0xB2,
+    0x53, 0xC2, 0x43, 0xD0, 0x23, 0x3D, 0x12, 0x23, 0xD2, 0x21, 0x3D, 0x37,
+    0xD2, 0x32, 0x3D, 0x12, 0x43, 0xD0, 0x25, 0x3C, 0x26, 0x3B, 0x27, 0x3A,
+    0x28, 0x39, 0x29, 0x38, 0x2A, 0x34, 0xF5, 0x89, 0xF2, 0x88, 0xED, 0xA0,
+    0x82, 0x8F, 0xD5, 0x84, 0x64, 0x65, 0x26, 0x46, 0x55, 0x12, 0x33, 0x22,
+    0x33, 0x74, 0x52, 0x12, 0x53, 0x63, 0x73, 0x72, 0x3E, 0xD0, 0x03, 0x28,
+    0x28, 0x23, 0xF7, 0x65, 0x55, 0xB5, 0x85, 0x39, 0x65, 0x23, 0x53, 0x82,
+    0x12, 0x83, 0x74, 0xA3, 0x63, 0xC2, 0x2E, 0xC0, 0x42, 0xD0, 0x22, 0xF9,
+    0x86, 0x86, 0xD0, 0xC9, 0x46, 0x47, 0x3A, 0x35, 0x3C, 0x33, 0x3D, 0x13,
+    0x1F, 0x01, 0x2D, 0x32, 0x1E, 0x52, 0xD5, 0x2F, 0x12, 0xD3, 0x22, 0x3D,
+    0x13, 0x33, 0xC3, 0x53, 0xA3, 0x74, 0x64, 0x9C, 0xD0, 0x68, 0xA6, 0x75,
+    0x3A, 0x55, 0x23, 0x63, 0x72, 0x12, 0xA2, 0x64, 0xC2, 0x54, 0xC3, 0x43,
+    0xD1, 0x24, 0x3D, 0x13, 0xE5, 0x32, 0xD3, 0x2F, 0x33, 0xD1, 0x24, 0x4C,
+    0x25, 0x21, 0x2A, 0x35, 0x22, 0x36, 0x46, 0x23, 0xA8, 0x25, 0x67, 0xE6,
+    0x03, 0x2D, 0x5F, 0xAD, 0x00, 0x76, 0xD3, 0xB3, 0x54, 0x45, 0x42, 0x53,
+    0x39, 0x31, 0x25, 0x3C, 0x44, 0x3D, 0x04, 0x42, 0xD2, 0x33, 0x3D, 0x23,
+    0x3E, 0x52, 0xD4, 0x24, 0x2D, 0x23, 0x43, 0xD0, 0x45, 0x2D, 0x04, 0x63,
+    0x93, 0x12, 0x74, 0x54, 0x22, 0x8B, 0x32, 0xA7, 0x52, 0x3E, 0x60, 0xD6,
+    0x23, 0xF0, 0xD1, 0xA0, 0x16, 0x74, 0x46, 0x58, 0x62, 0x34, 0x43, 0x52,
+    0x23, 0xD1, 0x6D, 0x24, 0xD4, 0x3D, 0x0E, 0xA0, 0x52, 0xD1, 0xFD, 0x35,
+    0x57, 0x9B, 0x12, 0x34, 0x65, 0x23, 0xA3, 0x1E, 0x20, 0x12, 0xC2, 0x23,
+    0xD3, 0x3D, 0x35, 0xD2, 0x9D, 0x25, 0xD3, 0x3D, 0x33, 0xD3, 0x2F, 0x02,
+    0xD1, 0x5C, 0x7A, 0x31, 0x66, 0x42, 0x21, 0xC9, 0x75, 0xE5, 0x42, 0xD2,
+    0xFD, 0x44, 0xED, 0x10, 0x42, 0xD7, 0x2B, 0x35, 0x37, 0x57, 0xD0, 0xA7,
+    0x60, 0xF0, 0x59, 0x63, 0xEC, 0x03, 0x2D, 0x02, 0x62, 0xC3, 0x62, 0xB4,
+    0x72, 0x92, 0x12, 0x73, 0x54, 0x25, 0x5A, 0x35, 0x75, 0xB0, 0xF1, 0x96,
+    0xAF, 0x42, 0xD1, 0x29, 0x2C, 0x39, 0x2C, 0x2B, 0x2B, 0x2B, 0x2A, 0x2C,
+    0x39, 0x26, 0xF0, 0x72, 0x82, 0x7F, 0x08, 0x26, 0x2D, 0x42, 0x52, 0xD4,
+    0x24, 0x2D, 0x62, 0x32, 0xD6, 0x22, 0x2D, 0x73, 0x12, 0xAF, 0x0B, 0x4B,
+    0xF1, 0x7A, 0x83, 0x2D, 0x41, 0x3F, 0x03, 0x2D, 0x32, 0x62, 0x72, 0x72,
+    0x71, 0x64, 0x62, 0x72, 0x54, 0x61, 0x82, 0x54, 0x52, 0x4F, 0x04, 0x24,
+    0x22, 0x24, 0x29, 0x14, 0x22, 0x24, 0x24, 0xE2, 0x05, 0x22, 0x24, 0x22,
+    0x2B, 0x11, 0x26, 0x21, 0x2B, 0x46, 0x21, 0x1C, 0x47, 0x36, 0xF0, 0x63,
+    0x83, 0x60, 0xF2, 0x76, 0x85, 0x2C, 0x38, 0x2A, 0x3A, 0x28, 0x3C, 0x26,
+    0x3D, 0x12, 0x43, 0xD3, 0x22, 0x3D, 0x54, 0xD8, 0x2D, 0x84, 0xD6, 0x22,
+    0x3D, 0x32, 0x43, 0xD1, 0x26, 0x3C, 0x28, 0x3A, 0x2A, 0x38, 0x2C, 0x36,
+    0x2D, 0x13, 0x2F, 0x01, 0x86, 0x90, 0xF1, 0x78, 0x83, 0x2D, 0x22, 0x52,
+    0xD1, 0x27, 0x2D, 0x02, 0x72, 0xC2, 0x92, 0xB2, 0x92, 0xA2, 0xB2, 0x92,
+    0xB2, 0x82, 0xD0, 0x27, 0x2D, 0x02, 0x62, 0xD2, 0x25, 0x2D, 0x22, 0x42,
+    0xD4, 0x23, 0x2D, 0x42, 0x22, 0xD6, 0x21, 0x2D, 0x62, 0x11, 0xD7, 0x4A,
+    0xE2, 0x0B, 0x2B, 0xF0, 0xA2, 0xCF, 0x09, 0x2D, 0x82, 0xD1, 0xF0, 0x1D,
+    0x0A, 0xF0, 0xD3, 0x12, 0xB2, 0x22, 0xA3, 0x22, 0x93, 0xD1, 0x2D, 0x12,
+    0xD1, 0x2D, 0x12, 0xD1, 0x2D, 0x13, 0xD1, 0x2D, 0x12, 0xD1, 0x2D, 0x12,
+    0xD1, 0x2B, 0x21, 0x3B, 0x21, 0x2C, 0x2F, 0x0D, 0x40, 0x83, 0x65, 0x62,
+    0x3E, 0xA0, 0x52, 0x82, 0x83, 0x5F, 0x4A, 0x39, 0x25, 0xEA, 0x05, 0x2A,
+    0x29, 0x58, 0x30, 0xED, 0xF0, 0x2E, 0x40, 0x20, 0x03, 0x85, 0x92, 0x6E,
+    0xA0, 0x42, 0xA2, 0x93, 0x3F, 0x07, 0x45, 0x38, 0x24, 0xEA, 0x04, 0x28,
+    0x26, 0x56, 0x38, 0x44, 0xD1, 0x88, 0x21, 0x34, 0x36, 0x31, 0x26, 0x43,
+    0x31, 0x29, 0x7D, 0x14, 0x40};
+
+const GFXglyph FreeMono24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 28, 0, 1},         // 0x20 ' '
+    {0, 5, 30, 28, 11, -28},     // 0x21 '!'
+    {12, 16, 14, 28, 6, -28},    // 0x22 '"'
+    {24, 19, 32, 28, 4, -29},    // 0x23 '#'
+    {53, 18, 33, 28, 5, -29},    // 0x24 '$'
+    {97, 20, 29, 28, 4, -27},    // 0x25 '%'
+    {140, 18, 25, 28, 5, -23},   // 0x26 '&'
+    {188, 7, 14, 28, 11, -28},   // 0x27 '''
+    {196, 7, 34, 28, 14, -27},   // 0x28 '('
+    {225, 7, 34, 28, 8, -27},    // 0x29 ')'
+    {254, 18, 16, 28, 5, -27},   // 0x2A '*'
+    {277, 20, 22, 28, 4, -23},   // 0x2B '+'
+    {284, 9, 14, 28, 6, -6},     // 0x2C ','
+    {299, 22, 2, 28, 3, -13},    // 0x2D '-'
+    {301, 7, 6, 28, 11, -4},     // 0x2E '.'
+    {306, 18, 35, 28, 5, -30},   // 0x2F '/'
+    {355, 18, 30, 28, 5, -28},   // 0x30 '0'
+    {388, 16, 29, 28, 6, -28},   // 0x31 '1'
+    {407, 18, 29, 28, 5, -28},   // 0x32 '2'
+    {451, 19, 30, 28, 5, -28},   // 0x33 '3'
+    {489, 16, 28, 28, 6, -27},   // 0x34 '4'
+    {529, 19, 29, 28, 5, -27},   // 0x35 '5'
+    {559, 18, 30, 28, 6, -28},   // 0x36 '6'
+    {609, 18, 28, 28, 5, -27},   // 0x37 '7'
+    {641, 18, 30, 28, 5, -28},   // 0x38 '8'
+    {685, 18, 30, 28, 6, -28},   // 0x39 '9'
+    {735, 7, 21, 28, 11, -19},   // 0x3A ':'
+    {746, 10, 27, 28, 7, -19},   // 0x3B ';'
+    {769, 22, 22, 28, 3, -23},   // 0x3C '<'
+    {803, 24, 9, 28, 2, -17},    // 0x3D '='
+    {810, 21, 22, 28, 4, -23},   // 0x3E '>'
+    {844, 17, 28, 28, 6, -26},   // 0x3F '?'
+    {876, 18, 32, 28, 5, -28},   // 0x40 '@'
+    {932, 28, 26, 28, 0, -25},   // 0x41 'A'
+    {983, 22, 26, 28, 3, -25},   // 0x42 'B'
+    {1030, 22, 28, 28, 3, -26},  // 0x43 'C'
+    {1069, 22, 26, 28, 3, -25},  // 0x44 'D'
+    {1108, 22, 26, 28, 3, -25},  // 0x45 'E'
+    {1136, 22, 26, 28, 3, -25},  // 0x46 'F'
+    {1159, 23, 28, 28, 3, -26},  // 0x47 'G'
+    {1206, 23, 26, 28, 3, -25},  // 0x48 'H'
+    {1223, 16, 26, 28, 6, -25},  // 0x49 'I'
+    {1230, 23, 27, 28, 4, -25},  // 0x4A 'J'
+    {1250, 24, 26, 28, 3, -25},  // 0x4B 'K'
+    {1303, 21, 26, 28, 4, -25},  // 0x4C 'L'
+    {1315, 26, 26, 28, 1, -25},  // 0x4D 'M'
+    {1371, 24, 26, 28, 2, -25},  // 0x4E 'N'
+    {1438, 24, 28, 28, 2, -26},  // 0x4F 'O'
+    {1481, 21, 26, 28, 3, -25},  // 0x50 'P'
+    {1512, 24, 32, 28, 2, -26},  // 0x51 'Q'
+    {1563, 24, 26, 28, 3, -25},  // 0x52 'R'
+    {1610, 20, 28, 28, 4, -26},  // 0x53 'S'
+    {1655, 22, 26, 28, 3, -25},  // 0x54 'T'
+    {1667, 23, 27, 28, 3, -25},  // 0x55 'U'
+    {1688, 28, 26, 28, 0, -25},  // 0x56 'V'
+    {1737, 26, 26, 28, 1, -25},  // 0x57 'W'
+    {1808, 24, 26, 28, 2, -25},  // 0x58 'X'
+    {1861, 24, 26, 28, 2, -25},  // 0x59 'Y'
+    {1895, 18, 26, 28, 5, -25},  // 0x5A 'Z'
+    {1938, 7, 34, 28, 13, -27},  // 0x5B '['
+    {1945, 18, 35, 28, 5, -30},  // 0x5C '\'
+    {1993, 7, 34, 28, 8, -27},   // 0x5D ']'
+    {2000, 18, 12, 28, 5, -28},  // 0x5E '^'
+    {2022, 28, 2, 28, 0, 5},     // 0x5F '_'
+    {2024, 8, 7, 28, 7, -29},    // 0x60 '`'
+    {2031, 22, 22, 28, 3, -20},  // 0x61 'a'
+    {2069, 23, 29, 28, 2, -27},  // 0x62 'b'
+    {2114, 21, 22, 28, 4, -20},  // 0x63 'c'
+    {2148, 24, 29, 28, 3, -27},  // 0x64 'd'
+    {2196, 21, 22, 28, 3, -20},  // 0x65 'e'
+    {2231, 19, 28, 28, 6, -27},  // 0x66 'f'
+    {2247, 23, 30, 28, 3, -20},  // 0x67 'g'
+    {2296, 23, 28, 28, 3, -27},  // 0x68 'h'
+    {2322, 18, 29, 28, 5, -28},  // 0x69 'i'
+    {2335, 14, 38, 28, 6, -28},  // 0x6A 'j'
+    {2350, 22, 28, 28, 4, -27},  // 0x6B 'k'
+    {2396, 18, 28, 28, 5, -27},  // 0x6C 'l'
+    {2403, 28, 21, 28, 0, -20},  // 0x6D 'm'
+    {2429, 23, 21, 28, 2, -20},  // 0x6E 'n'
+    {2449, 22, 22, 28, 3, -20},  // 0x6F 'o'
+    {2482, 23, 30, 28, 2, -20},  // 0x70 'p'
+    {2525, 24, 30, 28, 3, -20},  // 0x71 'q'
+    {2572, 21, 20, 28, 5, -19},  // 0x72 'r'
+    {2592, 18, 22, 28, 5, -20},  // 0x73 's'
+    {2625, 21, 27, 28, 3, -25},  // 0x74 't'
+    {2641, 23, 21, 28, 3, -19},  // 0x75 'u'
+    {2662, 26, 20, 28, 1, -19},  // 0x76 'v'
+    {2700, 26, 20, 28, 1, -19},  // 0x77 'w'
+    {2750, 24, 20, 28, 2, -19},  // 0x78 'x'
+    {2790, 24, 29, 28, 2, -19},  // 0x79 'y'
+    {2845, 17, 20, 28, 6, -19},  // 0x7A 'z'
+    {2877, 11, 34, 28, 8, -27},  // 0x7B '{'
+    {2895, 2, 34, 28, 13, -27},  // 0x7C '|'
+    {2900, 11, 34, 28, 9, -27},  // 0x7D '}'
+    {2919, 20, 6, 28, 4, -15}};  // 0x7E '~'
+
+const GFXpackedFont FreeMono24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeMono24pt7bRLEBitmaps,
+     (GFXglyph *)FreeMono24pt7bRLEGlyphs, 0x20, 0x7E, 47},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 3606 bytes, glyph bitmaps 2933 bytes (5658 uncompressed)
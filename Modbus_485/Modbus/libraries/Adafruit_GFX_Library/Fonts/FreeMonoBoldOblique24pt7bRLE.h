@@ -0,0 +1,429 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeMonoBoldOblique24pt7bRLEBitmaps[] PROGMEM = {
+    0x74, 0x76, 0x57, 0xE2, 0x48, 0xE3, 0x47, 0x1F, 0x04, 0x65, 0x72, 0xE3,
+    0x03, 0x63, 0xE2, 0x03, 0x57, 0x49, 0x17, 0xE2, 0x0D, 0x14, 0x76, 0x5F,
+    0x75, 0x67, 0x47, 0xF1, 0x64, 0x61, 0x64, 0x51, 0xF0, 0x15, 0x55, 0x25,
+    0x54, 0x2F, 0x01, 0x45, 0x53, 0x45, 0x43, 0xF0, 0x13, 0x64, 0x43, 0x63,
+    0x43, 0x73, 0x52, 0x72, 0x50, 0xB3, 0x53, 0x2F, 0x0A, 0x53, 0x5B, 0x44,
+    0x42, 0xE2, 0x09, 0x53, 0x52, 0xE2, 0x08, 0x53, 0x57, 0xD7, 0xE2, 0x3D,
+    0x83, 0xD7, 0x1F, 0x06, 0x53, 0x5B, 0x44, 0x4B, 0x53, 0x57, 0xD7, 0x3F,
+    0xD9, 0x2D, 0x83, 0xD7, 0x84, 0x44, 0x8E, 0x20, 0x35, 0x35, 0xA5, 0x44,
+    0x9F, 0x02, 0x53, 0x5B, 0x44, 0x4B, 0x53, 0x5C, 0x35, 0x3B, 0xD3, 0x3D,
+    0x84, 0x6F, 0x0D, 0x15, 0xD5, 0x8D, 0x2D, 0x28, 0xD4, 0xF7, 0xD5, 0x67,
+    0x57, 0x56, 0x94, 0x65, 0xA4, 0x65, 0xB1, 0x86, 0xD6, 0x9D, 0x3D, 0x0D,
+    0x0D, 0x2B, 0xD2, 0xD0, 0xCD, 0x49, 0xD6, 0x65, 0x3C, 0x54, 0x4C, 0x53,
+    0x5B, 0x63, 0x69, 0x64, 0x76, 0x84, 0xD7, 0x5D, 0x65, 0xD6, 0x7D, 0x3D,
+    0x27, 0xD6, 0x5C, 0xF0, 0x84, 0xD0, 0xF0, 0x75, 0xD7, 0x4D, 0x83, 0xD2,
+    0x85, 0xD2, 0x9C, 0xAB, 0x44, 0x4A, 0x36, 0x36, 0xE2, 0x03, 0x37, 0x39,
+    0x36, 0x3A, 0x44, 0x4B, 0xAC, 0x94, 0x56, 0x53, 0x8B, 0x9A, 0x99, 0xA9,
+    0x9C, 0x74, 0x56, 0x45, 0x9C, 0xAB, 0x44, 0x4A, 0x36, 0x33, 0xE2, 0x06,
+    0x37, 0x39, 0x36, 0x3A, 0x44, 0x4B, 0xAC, 0x9D, 0x25, 0x80, 0xB5, 0xD2,
+    0xA9, 0xC8, 0xD0, 0x8C, 0x85, 0x34, 0x85, 0x51, 0x5E, 0x20, 0x55, 0xBF,
+    0x05, 0x6D, 0x36, 0xD0, 0x8C, 0xA3, 0x52, 0xB2, 0x61, 0x61, 0xD0, 0x15,
+    0x2C, 0x24, 0x49, 0x35, 0x49, 0x3F, 0x55, 0x74, 0x64, 0x92, 0xD6, 0x2F,
+    0x01, 0xD5, 0x4A, 0x15, 0x76, 0xB0, 0xF1, 0x6E, 0x21, 0x52, 0x42, 0xF5,
+    0x2E, 0x24, 0x3F, 0x34, 0x25, 0xB2, 0xB4, 0x95, 0x86, 0x76, 0x85, 0x85,
+    0x86, 0x85, 0x4F, 0x04, 0x55, 0xF0, 0x35, 0x6F, 0x02, 0x57, 0xE3, 0x01,
+    0x58, 0xE8, 0x59, 0x68, 0xF0, 0x15, 0x8F, 0x01, 0x67, 0xF0, 0x26, 0x95,
+    0x94, 0x70, 0x82, 0xB4, 0x3E, 0x20, 0x66, 0x2F, 0x07, 0x61, 0xF0, 0x85,
+    0x96, 0xE8, 0x95, 0xE2, 0x85, 0x1E, 0x20, 0x75, 0x2F, 0x06, 0x58, 0x58,
+    0x68, 0x58, 0x58, 0x68, 0x58, 0x58, 0xF5, 0x94, 0xA0, 0xFA, 0x47, 0xE2,
+    0x09, 0x5A, 0x15, 0x46, 0x12, 0x62, 0x42, 0x6F, 0x0D, 0x81, 0xD6, 0x4D,
+    0x1A, 0x8C, 0x9B, 0xB9, 0xC8, 0x62, 0x67, 0x53, 0x67, 0x45, 0x57, 0x36,
+    0x46, 0xD0, 0x3D, 0x75, 0x7F, 0x0C, 0x48, 0xE2, 0x0B, 0x5D, 0x64, 0x9F,
+    0x0A, 0x5A, 0xDA, 0xE2, 0x0D, 0xF0, 0xD6, 0xA5, 0xAF, 0x09, 0x4B, 0xE2,
+    0x08, 0x5B, 0xF0, 0x84, 0xCF, 0x07, 0x5D, 0x73, 0xD0, 0x66, 0x56, 0x65,
+    0x66, 0x65, 0x65, 0x74, 0x75, 0x74, 0x6F, 0x01, 0x47, 0x48, 0x39, 0x2A,
+    0x1D, 0xAE, 0x20, 0xDF, 0x0D, 0x61, 0x24, 0x26, 0xF0, 0xD0, 0x24, 0x20,
+    0xDC, 0x2D, 0xC4, 0xDA, 0x5F, 0xD9, 0x5D, 0x95, 0x2F, 0x0D, 0x75, 0xD9,
+    0x54, 0xF0, 0xD5, 0x5D, 0x95, 0xD9, 0x5D, 0x96, 0xD9, 0x5D, 0x95, 0xD9,
+    0x6D, 0x95, 0xD9, 0x5D, 0x96, 0xD9, 0x5D, 0x95, 0xD0, 0xF0, 0x95, 0xD9,
+    0x5D, 0x2F, 0x07, 0x5D, 0x95, 0xD9, 0x5D, 0x96, 0xD9, 0x5D, 0x95, 0xD9,
+    0x6D, 0x95, 0xD8, 0xF0, 0x15, 0xD9, 0x5D, 0xB3, 0xDB, 0xC6, 0xD1, 0xBB,
+    0xD0, 0x8D, 0x36, 0xD4, 0x66, 0x56, 0x56, 0x76, 0x36, 0x95, 0x35, 0xA5,
+    0xE2, 0x25, 0xB5, 0x24, 0xB5, 0x25, 0xB5, 0x1F, 0x01, 0x5B, 0x42, 0xF0,
+    0x14, 0xB5, 0x25, 0xB5, 0x25, 0xB4, 0x3F, 0x5A, 0x53, 0xF5, 0x95, 0x46,
+    0x75, 0x57, 0x47, 0x6D, 0x37, 0xD2, 0x9D, 0x0B, 0xAD, 0x26, 0xC0, 0xD0,
+    0x6D, 0x16, 0xD0, 0x8B, 0xAA, 0xB8, 0x71, 0x58, 0x62, 0x49, 0x43, 0x54,
+    0xE2, 0x0C, 0x5D, 0x34, 0x5E, 0x20, 0xB5, 0x5F, 0x0B, 0x46, 0xE2, 0x0A,
+    0x5D, 0x34, 0x7E, 0x30, 0x95, 0x9D, 0x52, 0xDF, 0x0D, 0xF0, 0x52, 0xD5,
+    0x20, 0xD1, 0x7D, 0x4B, 0xD0, 0xD1, 0xBD, 0x39, 0xD4, 0x87, 0x57, 0x75,
+    0x86, 0xF6, 0x5A, 0x56, 0x4B, 0x5F, 0xD7, 0x5D, 0x75, 0xD6, 0x7D, 0x57,
+    0xD5, 0x7D, 0x48, 0xD4, 0x7D, 0x48, 0xD4, 0x8D, 0x38, 0xD4, 0x8D, 0x38,
+    0xD4, 0x88, 0x36, 0x79, 0x53, 0xE2, 0x01, 0xD8, 0x4F, 0xD9, 0x40, 0xD0,
+    0x8D, 0x2B, 0xCD, 0x1A, 0xD3, 0x8D, 0x57, 0x56, 0x77, 0x3A, 0x5F, 0xD7,
+    0x5D, 0x66, 0xD6, 0x5D, 0x56, 0xD0, 0xBD, 0x0B, 0xD1, 0x9D, 0x3A, 0xD3,
+    0xAD, 0x67, 0xD7, 0x62, 0xE3, 0x0D, 0x55, 0xD6, 0x5D, 0x66, 0x44, 0x97,
+    0x4D, 0x75, 0xD6, 0x6D, 0x58, 0xD3, 0xCA, 0xB0, 0xD3, 0x6D, 0x27, 0xD1,
+    0x8D, 0x08, 0xD0, 0x9C, 0xAB, 0xBA, 0x61, 0x5A, 0x52, 0x4A, 0x52, 0x59,
+    0x53, 0x58, 0x54, 0x57, 0x64, 0x47, 0x65, 0x46, 0x65, 0x56, 0x56, 0x55,
+    0x57, 0x45, 0xD6, 0x2F, 0xD8, 0x1D, 0x72, 0xD6, 0xD2, 0x5D, 0x0B, 0x3E,
+    0x20, 0x7C, 0xAB, 0x40, 0xE3, 0x7D, 0x47, 0xD4, 0x2E, 0x20, 0x65, 0xD7,
+    0x4D, 0x75, 0xD7, 0x51, 0x7C, 0xD2, 0xAD, 0x34, 0xF0, 0x5D, 0x48, 0x47,
+    0x7D, 0x66, 0x2E, 0x40, 0xD5, 0x52, 0xF0, 0xD4, 0x5D, 0x65, 0x54, 0x88,
+    0x4D, 0x75, 0xD6, 0x6D, 0x58, 0xD2, 0xD0, 0x9C, 0xD2, 0x7D, 0x2A, 0xCD,
+    0x09, 0xD2, 0x8D, 0x28, 0x84, 0x38, 0x7D, 0x36, 0xD4, 0x6D, 0x46, 0xD5,
+    0x5D, 0x55, 0x35, 0xB5, 0x19, 0x85, 0x1B, 0x6F, 0x01, 0xD5, 0x68, 0x47,
+    0x48, 0x66, 0x46, 0x95, 0x4E, 0x25, 0xA5, 0x4F, 0x59, 0x55, 0x67, 0x56,
+    0x75, 0x67, 0xD3, 0x8D, 0x2A, 0xD0, 0xCB, 0xD2, 0x7C, 0x1D, 0x8F, 0x1D,
+    0x71, 0xFD, 0x81, 0x5A, 0x52, 0x4B, 0x52, 0xF0, 0xD1, 0x53, 0xF0, 0xD0,
+    0x54, 0xF0, 0xC5, 0xD3, 0x5D, 0x44, 0xD4, 0x57, 0xF0, 0x95, 0x8F, 0x08,
+    0x59, 0xF0, 0x75, 0xAF, 0x06, 0x5B, 0xF0, 0x55, 0xCF, 0x04, 0x5D, 0x35,
+    0xD5, 0x3D, 0x20, 0xB7, 0xD1, 0xBA, 0xD1, 0x8D, 0x36, 0xD4, 0x66, 0x57,
+    0x46, 0x76, 0x36, 0x95, 0xF3, 0x5A, 0x53, 0x59, 0x54, 0x67, 0x65, 0x65,
+    0x66, 0xD3, 0x8D, 0x0B, 0xC9, 0xD2, 0x7D, 0x45, 0x75, 0x64, 0x68, 0x63,
+    0x5A, 0x52, 0xF5, 0xB5, 0x25, 0xA6, 0x26, 0x86, 0x37, 0x58, 0x3D, 0x65,
+    0xD4, 0x7D, 0x29, 0xCD, 0x07, 0xB0, 0xC7, 0xD2, 0xBB, 0xD1, 0x9D, 0x37,
+    0xD4, 0x76, 0x57, 0x56, 0x76, 0x55, 0x95, 0x46, 0x95, 0xF4, 0x5A, 0x54,
+    0x59, 0x64, 0x67, 0x74, 0x74, 0x9F, 0x5D, 0x57, 0xB1, 0x58, 0x91, 0x5A,
+    0x63, 0x5D, 0x56, 0x2F, 0x0D, 0x26, 0xD4, 0x6D, 0x37, 0xD3, 0x78, 0x34,
+    0x88, 0xD2, 0x8D, 0x29, 0xD0, 0xCA, 0xD2, 0x7D, 0x20, 0x54, 0x56, 0xF3,
+    0x73, 0x65, 0x42, 0xE9, 0x0C, 0x45, 0x63, 0xF7, 0x36, 0x54, 0x50, 0xA4,
+    0xA6, 0xF8, 0x78, 0x6A, 0x42, 0xE8, 0x0D, 0x86, 0x95, 0x96, 0x95, 0x95,
+    0xA4, 0xA5, 0xA4, 0xA4, 0xB3, 0xB4, 0xB3, 0xB3, 0xC0, 0xDA, 0x1D, 0x94,
+    0xD5, 0x7D, 0x39, 0xD1, 0x9D, 0x19, 0xD1, 0x9D, 0x0A, 0xD0, 0xAD, 0x0A,
+    0xD0, 0x9D, 0x2B, 0xD4, 0x9D, 0x59, 0xD4, 0xAD, 0x49, 0xD5, 0x9D, 0x59,
+    0xD4, 0x9D, 0x57, 0xD7, 0x44, 0x3D, 0xAE, 0x22, 0xDB, 0x2D, 0xA1, 0xE3,
+    0x0D, 0xED, 0xA2, 0xE2, 0xDB, 0x2D, 0xA3, 0xDF, 0x01, 0x4D, 0x77, 0xD5,
+    0x8D, 0x59, 0xD5, 0x9D, 0x4A, 0xD4, 0xAD, 0x49, 0xD4, 0xA3, 0xF0, 0xD1,
+    0xAD, 0x0A, 0xD0, 0xAD, 0x09, 0xD1, 0x9D, 0x0A, 0xD0, 0xAD, 0x18, 0xD4,
+    0x6D, 0x64, 0xDF, 0x0D, 0x50, 0x77, 0x9C, 0x4D, 0x33, 0xD4, 0x2D, 0xB6,
+    0xC9, 0x5F, 0x04, 0xA5, 0xD1, 0x5D, 0x05, 0xC7, 0xA8, 0x8A, 0x8A, 0x89,
+    0xA7, 0xC5, 0xD1, 0x4D, 0x33, 0xBE, 0x20, 0xD9, 0x4D, 0x16, 0xBF, 0x01,
+    0x7C, 0x6D, 0x14, 0xD0, 0xC7, 0xD1, 0xBB, 0xD0, 0x8D, 0x27, 0x65, 0x66,
+    0x57, 0x55, 0x4A, 0x44, 0x5A, 0x44, 0x4B, 0x34, 0x4B, 0x44, 0x48, 0x73,
+    0x47, 0x93, 0x45, 0xA4, 0x44, 0xB4, 0x34, 0x62, 0x43, 0x43, 0x54, 0x43,
+    0x43, 0x45, 0x43, 0x42, 0x46, 0x33, 0xF0, 0x13, 0x34, 0x54, 0x34, 0x34,
+    0x54, 0x34, 0x35, 0x43, 0x44, 0x3D, 0x03, 0x44, 0xD0, 0x24, 0x5B, 0x34,
+    0x79, 0x3E, 0x24, 0xD6, 0x5D, 0x64, 0xD6, 0x67, 0x37, 0xD3, 0x8D, 0x1A,
+    0xCD, 0x07, 0xB0, 0xAD, 0x07, 0xE3, 0x09, 0xD1, 0xD8, 0xAD, 0x6B, 0xD6,
+    0x42, 0x5D, 0x55, 0x25, 0xD4, 0x53, 0x5D, 0x44, 0x46, 0xD2, 0x54, 0x65,
+    0xF0, 0x95, 0x65, 0xD0, 0x57, 0x5D, 0x0D, 0x5B, 0xD6, 0x4F, 0x06, 0xD7,
+    0x9D, 0x97, 0x6B, 0x67, 0x5D, 0x05, 0x4B, 0x6B, 0x1F, 0xC5, 0xDC, 0x5C,
+    0x1B, 0x6B, 0x20, 0x6D, 0x69, 0xD9, 0x2F, 0x05, 0xDA, 0x6D, 0xB8, 0x5A,
+    0x68, 0x5B, 0x58, 0x4C, 0x57, 0x5C, 0x57, 0x5B, 0x58, 0x59, 0x69, 0xD6,
+    0xAD, 0x5A, 0xD6, 0x4F, 0x06, 0xD8, 0x84, 0xA8, 0x65, 0xC6, 0x1F, 0x05,
+    0x5D, 0x05, 0x64, 0xD1, 0x56, 0x4C, 0x63, 0xDD, 0x2D, 0xD3, 0xDC, 0x4D,
+    0xA7, 0xD7, 0x80, 0xD0, 0x7D, 0x5D, 0x02, 0x2A, 0xD6, 0x7D, 0x86, 0xD9,
+    0x58, 0x69, 0x47, 0xA6, 0x46, 0xD0, 0x54, 0x5D, 0x15, 0x36, 0xD1, 0x44,
+    0x5D, 0x24, 0x36, 0xD8, 0xE2, 0x01, 0x5D, 0x9E, 0x45, 0xDA, 0x6D, 0x96,
+    0xD2, 0x35, 0x6C, 0x55, 0x88, 0x76, 0xD9, 0x6D, 0x88, 0xD5, 0xCD, 0x1D,
+    0x48, 0xC0, 0x6D, 0x3B, 0xD6, 0x9D, 0x78, 0xD8, 0x8D, 0x88, 0x58, 0x78,
+    0x59, 0x68, 0x4B, 0x67, 0x4C, 0x5E, 0x26, 0x5C, 0x56, 0x4D, 0x05, 0x55,
+    0xD0, 0x55, 0x5C, 0x65, 0x5C, 0x56, 0x4D, 0x05, 0x64, 0xC6, 0x55, 0xC5,
+    0x65, 0xB6, 0x65, 0xA6, 0x74, 0x97, 0x5D, 0x96, 0xD8, 0x6D, 0x87, 0xD6,
+    0xAD, 0x2C, 0x6D, 0xA5, 0xDB, 0x4D, 0xC4, 0xDB, 0x6D, 0xA9, 0x4B, 0x51,
+    0xF0, 0x75, 0xB5, 0x85, 0x44, 0x34, 0x94, 0x45, 0x33, 0xA4, 0x45, 0xD2,
+    0xD1, 0x9E, 0x20, 0x6D, 0x0D, 0x2D, 0x1D, 0x25, 0x44, 0xD3, 0x54, 0x44,
+    0x48, 0x45, 0x35, 0x48, 0x4C, 0x53, 0xF0, 0x45, 0xC5, 0x4D, 0xB4, 0xE2,
+    0xDC, 0x4D, 0xB5, 0x6D, 0xCE, 0x25, 0xDC, 0x7D, 0xB9, 0x5C, 0x59, 0x5C,
+    0x4A, 0x4C, 0x5A, 0x45, 0x34, 0x59, 0x54, 0x54, 0x3A, 0x54, 0x4B, 0xF0,
+    0x7D, 0x0B, 0xF0, 0x6D, 0x1D, 0x4D, 0x0C, 0xF0, 0x64, 0x45, 0xD4, 0x55,
+    0x3D, 0x0F, 0x05, 0x5D, 0xD4, 0xDB, 0xD1, 0xD3, 0xD2, 0xD2, 0xFD, 0x3D,
+    0x3D, 0x1D, 0x30, 0xD0, 0x84, 0x2B, 0xD5, 0x9D, 0x67, 0xD8, 0x6D, 0x86,
+    0x87, 0x75, 0x7B, 0x55, 0x5D, 0x04, 0x55, 0xD1, 0x44, 0x6D, 0x7F, 0x02,
+    0x5D, 0x8E, 0x20, 0x15, 0xDA, 0x57, 0xD0, 0x2F, 0x57, 0xD2, 0x15, 0x7D,
+    0x12, 0x58, 0xC3, 0x5D, 0x15, 0x46, 0xD0, 0x54, 0x7C, 0x55, 0x88, 0x66,
+    0xD9, 0x7D, 0x88, 0xD6, 0xBD, 0x1D, 0x48, 0xC0, 0x79, 0x49, 0x7A, 0x3B,
+    0x5B, 0x3B, 0x5B, 0x3A, 0x79, 0x49, 0x95, 0xA5, 0xA5, 0xA4, 0xB4, 0xB4,
+    0xB4, 0xA5, 0x4F, 0x06, 0x5A, 0x54, 0xF0, 0x6D, 0x65, 0xF0, 0x5D, 0x7A,
+    0xD6, 0x6F, 0x05, 0x4A, 0x56, 0xF0, 0x45, 0xA5, 0xA5, 0xA4, 0xB4, 0xA5,
+    0x8A, 0x4A, 0x5F, 0xB3, 0xC4, 0xB3, 0xB5, 0xA4, 0xB5, 0x6D, 0x6E, 0x25,
+    0xD7, 0x5D, 0x61, 0xF0, 0xC5, 0xD7, 0x49, 0xE2, 0x0B, 0x5D, 0x74, 0xAE,
+    0x30, 0xA5, 0xD7, 0x4B, 0xE2, 0x09, 0x5D, 0x74, 0xD7, 0x5D, 0x0D, 0x65,
+    0xE2, 0xD7, 0x6D, 0x56, 0xD0, 0xD5, 0xE2, 0xCD, 0x6D, 0x0D, 0x41, 0xF0,
+    0xD7, 0x56, 0xF0, 0xD7, 0x47, 0xE2, 0x0D, 0x65, 0xDD, 0x4D, 0xD5, 0xB3,
+    0xC5, 0x8F, 0x02, 0x5B, 0x5A, 0x4C, 0x49, 0xF0, 0x15, 0xB5, 0xA5, 0xA5,
+    0xB5, 0x96, 0xB7, 0x66, 0xBD, 0x7B, 0xD6, 0xD1, 0xD2, 0xD5, 0xCD, 0x87,
+    0xD5, 0x6C, 0x49, 0x5D, 0x03, 0xAF, 0x5D, 0x02, 0xB5, 0xC4, 0x99, 0x57,
+    0x7C, 0x56, 0x7D, 0x04, 0x57, 0xD1, 0x54, 0x7D, 0x25, 0x36, 0xD4, 0x51,
+    0x7D, 0x5B, 0xD7, 0xCD, 0x5D, 0x1D, 0x4D, 0x2D, 0x37, 0x26, 0xD3, 0x55,
+    0x6D, 0x15, 0x66, 0x9F, 0x05, 0x57, 0x6D, 0x04, 0x95, 0xD0, 0x49, 0x68,
+    0xC5, 0x94, 0xD0, 0x5A, 0x3F, 0xD0, 0x69, 0x4B, 0x78, 0x40, 0x6D, 0x26,
+    0xE2, 0x05, 0xD3, 0xBD, 0x27, 0xF0, 0xA5, 0xD9, 0x4D, 0x0E, 0x20, 0x95,
+    0xD0, 0xF0, 0x94, 0xD1, 0xF0, 0x85, 0xD9, 0x5A, 0x39, 0x4B, 0x4E, 0x27,
+    0x5A, 0x57, 0x4A, 0x57, 0x5A, 0x52, 0xDC, 0x1D, 0xD1, 0xFD, 0xC3, 0xDB,
+    0x20, 0x68, 0xC8, 0xF5, 0x9B, 0x95, 0x9A, 0x98, 0x88, 0x83, 0xF0, 0x69,
+    0x79, 0x99, 0x69, 0xAA, 0x4A, 0xA4, 0x15, 0x4A, 0x95, 0x15, 0x35, 0x15,
+    0x95, 0x15, 0x26, 0x15, 0x95, 0x16, 0x15, 0x24, 0x5F, 0x05, 0x43, 0xA2,
+    0x59, 0x53, 0x93, 0x59, 0x54, 0x74, 0x59, 0x54, 0x74, 0x4A, 0x45, 0x64,
+    0x59, 0x55, 0x55, 0x59, 0x5D, 0x25, 0x95, 0xD2, 0x48, 0xA8, 0xA5, 0xC6,
+    0xC4, 0xC5, 0xD0, 0x4B, 0x6C, 0x5A, 0x8A, 0x60, 0x58, 0x8B, 0xE2, 0x4A,
+    0x6C, 0x4B, 0x5B, 0x88, 0x95, 0xA9, 0x84, 0xB9, 0x75, 0x4F, 0x06, 0xB6,
+    0x5A, 0x51, 0x65, 0x5A, 0x42, 0x65, 0x45, 0xF0, 0x55, 0x36, 0x35, 0xA5,
+    0x46, 0x25, 0xA5, 0x46, 0x24, 0xB4, 0x65, 0x15, 0xA5, 0x6B, 0x6F, 0x04,
+    0x57, 0xAA, 0x48, 0x9B, 0x49, 0x88, 0xB5, 0x87, 0xC6, 0x77, 0xC6, 0x68,
+    0xC7, 0x59, 0xA8, 0x58, 0xD0, 0x7D, 0x5B, 0xD1, 0xD1, 0xBD, 0x49, 0xD6,
+    0x78, 0x58, 0x57, 0x96, 0x46, 0xB6, 0x45, 0xD0, 0x62, 0x6D, 0x15, 0x25,
+    0xD2, 0x5F, 0x15, 0xD3, 0x51, 0x4D, 0x4A, 0xD4, 0x5E, 0x20, 0x5D, 0x35,
+    0x15, 0xD2, 0x52, 0x5D, 0x16, 0x26, 0xD0, 0x54, 0x5C, 0x64, 0x69, 0x75,
+    0x85, 0x87, 0xD6, 0x9D, 0x4B, 0xD1, 0xD1, 0xBD, 0x57, 0xD0, 0x6D, 0x4A,
+    0xD7, 0x8D, 0x87, 0xD9, 0x6D, 0xA8, 0x58, 0x78, 0x5A, 0x58, 0x4B, 0x5F,
+    0x75, 0xB5, 0x75, 0xA5, 0x84, 0xA6, 0x84, 0x96, 0x8D, 0x78, 0xD6, 0x9D,
+    0x4B, 0xD3, 0xBD, 0x19, 0xF0, 0x55, 0xD5, 0xF0, 0x54, 0xD7, 0xD2, 0xCE,
+    0x2D, 0x3D, 0x0D, 0x1D, 0x00, 0xD0, 0x7D, 0x4C, 0xD0, 0xD2, 0xBD, 0x49,
+    0xD6, 0x78, 0x58, 0x57, 0x96, 0x46, 0xC6, 0x35, 0xD0, 0x62, 0x5D, 0x25,
+    0x16, 0xD2, 0x5F, 0x15, 0xD3, 0x5F, 0x05, 0xD4, 0x5F, 0x05, 0xD3, 0x51,
+    0x5D, 0x26, 0x15, 0xD2, 0x52, 0x6D, 0x05, 0x36, 0xC6, 0x46, 0x97, 0x58,
+    0x58, 0x7D, 0x69, 0xD4, 0xBD, 0x2D, 0x0C, 0xD3, 0x8D, 0x54, 0xD9, 0xA5,
+    0x35, 0xF0, 0x2D, 0x85, 0xD8, 0x6D, 0x78, 0x47, 0x68, 0x6D, 0x4B, 0xD7,
+    0x9D, 0x88, 0xD9, 0x8D, 0x99, 0x58, 0x79, 0x5A, 0x51, 0xF0, 0x84, 0xB5,
+    0x85, 0xA6, 0x85, 0x96, 0x95, 0x77, 0xAD, 0x69, 0xD5, 0xBD, 0x4C, 0xD2,
+    0xD1, 0xD3, 0xD0, 0x46, 0x7B, 0x57, 0x7A, 0x58, 0x6A, 0x58, 0x79, 0x4A,
+    0x66, 0xB6, 0x92, 0xC7, 0xD9, 0x7D, 0x98, 0x81, 0xB9, 0x71, 0xC7, 0x42,
+    0xBD, 0x38, 0xD5, 0x7D, 0x66, 0xD7, 0x57, 0x67, 0x65, 0x96, 0x55, 0xB5,
+    0x1F, 0x04, 0x5B, 0x46, 0x6D, 0x79, 0xD5, 0xCD, 0x1D, 0x2C, 0xD2, 0xD0,
+    0xD1, 0xD4, 0xAD, 0x67, 0xD8, 0x54, 0x4D, 0x05, 0x35, 0xD0, 0x53, 0x5C,
+    0x63, 0x6A, 0x64, 0x86, 0x84, 0xD8, 0x5D, 0x76, 0xD6, 0x73, 0x2C, 0xD3,
+    0x8B, 0xF2, 0xDB, 0x1D, 0xCF, 0x1D, 0xB2, 0x55, 0x45, 0x52, 0x45, 0x55,
+    0x51, 0x55, 0x55, 0x51, 0x55, 0x55, 0x42, 0x55, 0x45, 0x52, 0x45, 0x55,
+    0x52, 0x36, 0x56, 0x3C, 0x5C, 0xF0, 0x94, 0xD0, 0xE2, 0x08, 0x5D, 0x84,
+    0xD1, 0xE2, 0x07, 0x5D, 0x1F, 0x01, 0xD3, 0x9F, 0xD4, 0xAD, 0x2A, 0x2A,
+    0x5A, 0x2C, 0x3C, 0x1C, 0x2D, 0x01, 0xB3, 0xC2, 0xB4, 0xA2, 0xF0, 0x34,
+    0xC5, 0x4F, 0x02, 0x5C, 0x56, 0x5C, 0x47, 0x4C, 0x55, 0xF0, 0x15, 0xC5,
+    0x5F, 0x01, 0x5C, 0x47, 0x4C, 0x56, 0xF5, 0xC5, 0x65, 0xC4, 0x75, 0xB5,
+    0x76, 0x96, 0x76, 0x86, 0x88, 0x56, 0xAD, 0x5A, 0xD4, 0xCD, 0x1D, 0x3B,
+    0xD6, 0x6D, 0x30, 0x1B, 0x7B, 0xE2, 0x0C, 0x6C, 0x1A, 0x7B, 0x45, 0xD0,
+    0x54, 0xF0, 0x35, 0xC5, 0x86, 0xA5, 0x6F, 0x04, 0x59, 0x5B, 0x58, 0x5C,
+    0x66, 0x6D, 0x05, 0x65, 0xD1, 0x55, 0x5D, 0x25, 0x46, 0xD2, 0x54, 0x5D,
+    0x36, 0x25, 0xD5, 0x51, 0x6D, 0x55, 0x15, 0xD0, 0xF0, 0x6A, 0xD7, 0x9D,
+    0x2F, 0x07, 0x7D, 0xA6, 0xDB, 0x5D, 0x50, 0x1B, 0x6B, 0xE2, 0x0C, 0x5D,
+    0xA6, 0xB3, 0x4D, 0x34, 0x54, 0x55, 0x55, 0x45, 0x46, 0x54, 0x55, 0x46,
+    0x45, 0x55, 0x37, 0x45, 0x55, 0x38, 0x34, 0x5F, 0x01, 0x52, 0x92, 0x56,
+    0x51, 0xA2, 0x47, 0x51, 0x41, 0x51, 0x57, 0xA1, 0x51, 0x57, 0x41, 0x42,
+    0xA8, 0x92, 0xA7, 0x93, 0xA7, 0x94, 0x88, 0xF8, 0x58, 0x8F, 0x76, 0x79,
+    0x67, 0x79, 0x67, 0x6A, 0x58, 0x6A, 0x78, 0x79, 0x7A, 0x5B, 0x5B, 0x5B,
+    0x5A, 0x6A, 0x78, 0x88, 0xA6, 0x86, 0xC7, 0x66, 0xD1, 0x64, 0x7D, 0x36,
+    0x26, 0xD6, 0xCD, 0x7B, 0xD9, 0x9D, 0xB7, 0xDC, 0x6D, 0xC8, 0xDA, 0xAD,
+    0x7C, 0xD6, 0x62, 0x6D, 0x46, 0x46, 0xD2, 0x65, 0x6D, 0x16, 0x76, 0xC6,
+    0x96, 0x8A, 0x6A, 0x5E, 0x2B, 0x5B, 0x69, 0x6A, 0x60, 0x19, 0x79, 0xE2,
+    0x0A, 0x6A, 0x18, 0x79, 0x45, 0x95, 0x76, 0x75, 0x95, 0x65, 0xA6, 0x45,
+    0xC5, 0x35, 0xD0, 0x61, 0x5D, 0x2A, 0xD3, 0x9D, 0x58, 0xD5, 0x7D, 0x75,
+    0xD8, 0x4D, 0x1E, 0x20, 0x75, 0xD1, 0xF0, 0x74, 0xD3, 0xD2, 0xAF, 0xD4,
+    0x9D, 0x3A, 0xD2, 0xB0, 0xE3, 0x7D, 0x67, 0xD7, 0x75, 0x86, 0x85, 0x76,
+    0x95, 0x66, 0xA4, 0x66, 0xA5, 0x56, 0xC3, 0x56, 0xD7, 0x6D, 0x76, 0xD6,
+    0x6D, 0x76, 0xD7, 0x6D, 0x76, 0x73, 0xA6, 0x75, 0x86, 0x85, 0x76, 0x94,
+    0x76, 0x95, 0x66, 0xA5, 0x4F, 0x01, 0xD9, 0x4E, 0x20, 0x1D, 0x85, 0xE2,
+    0x8A, 0x7B, 0x7A, 0x85, 0x6F, 0x07, 0x47, 0xE2, 0x06, 0x5D, 0x04, 0x8E,
+    0x30, 0x55, 0xD0, 0x49, 0xE2, 0x04, 0x59, 0xF0, 0x44, 0xAE, 0x20, 0x35,
+    0xAF, 0x03, 0x4B, 0xE2, 0x02, 0x5D, 0x04, 0xD0, 0x5C, 0xE3, 0x01, 0xA7,
+    0xA8, 0x21, 0xB4, 0x8F, 0x58, 0xE3, 0x01, 0x57, 0xE3, 0x02, 0x56, 0xE3,
+    0x03, 0x55, 0xE2, 0x04, 0x58, 0x63, 0xE2, 0x05, 0x53, 0xE3, 0x06, 0x52,
+    0xE3, 0x07, 0x51, 0xE3, 0x08, 0x5F, 0x94, 0x93, 0x10, 0x8A, 0xE3, 0x7A,
+    0xD0, 0x5D, 0x04, 0x2E, 0x20, 0xB5, 0x2F, 0x0B, 0x43, 0xE2, 0x0A, 0x53,
+    0xF0, 0xA4, 0x4E, 0x20, 0x95, 0xD0, 0x45, 0xE3, 0x08, 0x5D, 0x04, 0x6E,
+    0x20, 0x75, 0x6F, 0x07, 0x4D, 0x05, 0x8A, 0x7B, 0x7E, 0x2A, 0x80, 0xC1,
+    0xD5, 0x3D, 0x34, 0xD2, 0x6D, 0x07, 0xC9, 0xAB, 0x7D, 0x06, 0x72, 0x64,
+    0x73, 0x72, 0x66, 0x61, 0x68, 0xB9, 0xAB, 0x8D, 0x03, 0x10, 0xF1, 0xDF,
+    0x0D, 0xF0, 0x1F, 0x0D, 0xF1, 0x12, 0x54, 0x45, 0x45, 0x45, 0x45, 0x44,
+    0x52, 0x10, 0xA9, 0xBD, 0x28, 0xD4, 0x2F, 0x05, 0xD5, 0xD5, 0x61, 0xF0,
+    0xD5, 0x5A, 0xD1, 0x7D, 0x36, 0xD5, 0x5D, 0x64, 0xD7, 0x37, 0x94, 0x45,
+    0xB4, 0x35, 0xB5, 0x35, 0x97, 0x36, 0x6B, 0x1D, 0xBF, 0x1D, 0xA2, 0xC1,
+    0x85, 0x7D, 0x00, 0x68, 0xD2, 0xF0, 0x59, 0xD7, 0x8D, 0x97, 0xD3, 0xE2,
+    0x08, 0x5D, 0xB4, 0x47, 0xD0, 0x51, 0xC4, 0xF0, 0x7D, 0x79, 0xD8, 0x88,
+    0x67, 0x77, 0xA6, 0x66, 0xB6, 0xF6, 0x5D, 0x05, 0x64, 0xD1, 0x55, 0x5D,
+    0x15, 0xF5, 0x5D, 0x05, 0x65, 0xC6, 0x66, 0xB5, 0x67, 0xA6, 0x3C, 0x67,
+    0x3D, 0xC4, 0xDB, 0x5D, 0xA6, 0x82, 0xBD, 0x77, 0xA0, 0xB8, 0x33, 0x8D,
+    0x47, 0xD5, 0x5D, 0x74, 0xD8, 0x38, 0x77, 0x36, 0xA5, 0x36, 0xB5, 0x35,
+    0xD0, 0x32, 0xF0, 0x15, 0xD6, 0xE4, 0x5D, 0x76, 0xD1, 0x23, 0x89, 0x63,
+    0xD9, 0x3D, 0x85, 0xD6, 0x8D, 0x2C, 0xA9, 0xD7, 0x8E, 0x3D, 0x68, 0xDA,
+    0x5D, 0xA4, 0xDA, 0x5C, 0x74, 0x5A, 0xC1, 0x58, 0xD7, 0x7D, 0x77, 0xD8,
+    0x67, 0x69, 0x56, 0xA7, 0x55, 0xC5, 0x4F, 0x01, 0x5D, 0x05, 0x4F, 0x5D,
+    0x15, 0x45, 0xD1, 0x45, 0xF5, 0xD0, 0x55, 0x6B, 0x65, 0x6A, 0x76, 0x76,
+    0xB4, 0xDC, 0x2F, 0x02, 0xDB, 0x6B, 0x28, 0x97, 0xD2, 0xB7, 0xD1, 0xCA,
+    0xD2, 0x8D, 0x46, 0xD6, 0x48, 0x66, 0x37, 0xA5, 0x26, 0xC4, 0x16, 0xD0,
+    0x41, 0xDA, 0xE3, 0x0D, 0xF0, 0x1D, 0x66, 0xD5, 0x6D, 0x03, 0x37, 0x78,
+    0x2D, 0x93, 0xD8, 0x4D, 0x66, 0xD3, 0xAA, 0x80, 0xD4, 0x9D, 0x3D, 0x1D,
+    0x0D, 0x2C, 0xD3, 0xBD, 0x3C, 0x5C, 0xF0, 0xA5, 0xDA, 0x4D, 0x6D, 0x64,
+    0xE2, 0x04, 0xD7, 0x8D, 0x6D, 0x14, 0xD2, 0xE2, 0x08, 0x5D, 0xA4, 0xD3,
+    0xE3, 0x07, 0x5D, 0xA4, 0xDA, 0x5D, 0x5D, 0x68, 0xE2, 0xD7, 0x9D, 0x59,
+    0xA7, 0xD6, 0xB1, 0x86, 0xD9, 0x5D, 0xA4, 0xDB, 0x37, 0x5C, 0x37, 0x87,
+    0x65, 0xB6, 0x56, 0xB5, 0x65, 0xC5, 0x5E, 0x25, 0xD0, 0x55, 0x5D, 0x04,
+    0x65, 0xC5, 0x66, 0xA6, 0x66, 0x97, 0x77, 0x58, 0x8D, 0x77, 0xF0, 0x2D,
+    0x6B, 0xB1, 0x5D, 0x06, 0x44, 0x8F, 0x0D, 0x25, 0xD8, 0x6C, 0xD3, 0xBD,
+    0x3C, 0xD2, 0xD0, 0xD0, 0xD2, 0xBD, 0x20, 0x67, 0xD5, 0x8D, 0x0F, 0x04,
+    0x9D, 0x57, 0xD9, 0x4D, 0x1F, 0x07, 0x5D, 0x85, 0x36, 0xC4, 0x2A, 0xA4,
+    0x1C, 0x8D, 0x58, 0xD6, 0x78, 0x56, 0x76, 0x85, 0x66, 0x95, 0x65, 0xA5,
+    0x1F, 0x05, 0x5A, 0x47, 0x4A, 0x52, 0xF0, 0x45, 0xA5, 0x65, 0xA4, 0x3F,
+    0x04, 0x4A, 0x54, 0xA5, 0x91, 0xE2, 0xB4, 0xD8, 0x69, 0x10, 0xE2, 0xD0,
+    0x64, 0xF0, 0xD0, 0x55, 0xE2, 0x0D, 0xF0, 0x2B, 0xBC, 0x5E, 0x20, 0x6B,
+    0xD5, 0x56, 0xF0, 0xC4, 0x7E, 0x20, 0xB5, 0x7F, 0x0B, 0x48, 0xE2, 0x0A,
+    0x5A, 0xD7, 0x2D, 0xF0, 0xDF, 0x0B, 0x2D, 0x72, 0xFD, 0x45, 0x1E, 0x20,
+    0xD3, 0x61, 0xE2, 0x0D, 0xF0, 0x2D, 0x3E, 0x26, 0xD4, 0x6D, 0x3D, 0x64,
+    0x1E, 0x20, 0xD4, 0x51, 0xF0, 0xD4, 0x42, 0xE2, 0x0D, 0x35, 0xD5, 0x43,
+    0xE2, 0x0D, 0x25, 0x3F, 0x0D, 0x24, 0x4E, 0x20, 0xD1, 0x5D, 0x45, 0xD4,
+    0x66, 0xD3, 0x6D, 0x37, 0xD2, 0x8D, 0x1A, 0xAC, 0xF6, 0x8C, 0xF0, 0x59,
+    0xD5, 0x7D, 0x0E, 0x30, 0x85, 0xD8, 0x44, 0xAE, 0x27, 0x53, 0xB7, 0x44,
+    0xA8, 0x42, 0x8B, 0x51, 0x7D, 0x0C, 0xD1, 0xAD, 0x39, 0xD4, 0xAD, 0x2C,
+    0xD1, 0x51, 0x7D, 0x05, 0x27, 0xC4, 0x47, 0xA5, 0x57, 0x68, 0x5B, 0x19,
+    0x5B, 0x19, 0x4C, 0x18, 0x5C, 0x27, 0x6A, 0x20, 0x9B, 0x3E, 0x30, 0x8B,
+    0xD5, 0x5D, 0x54, 0x5E, 0x30, 0xD0, 0x5D, 0x54, 0x6E, 0x20, 0xC5, 0x6F,
+    0x0C, 0x47, 0xE2, 0x0B, 0x57, 0xF0, 0xB4, 0x8E, 0x20, 0xA5, 0xAD, 0x72,
+    0xDF, 0x0D, 0xF0, 0xB2, 0xD7, 0x20, 0xD0, 0x46, 0x47, 0x71, 0x72, 0x84,
+    0xD3, 0x19, 0x1F, 0x03, 0xDE, 0x39, 0x37, 0x35, 0x56, 0x46, 0x45, 0x55,
+    0x55, 0x55, 0x54, 0x64, 0x65, 0x54, 0x55, 0x64, 0x1E, 0x20, 0x45, 0x55,
+    0x55, 0x54, 0x64, 0x64, 0x55, 0x55, 0x64, 0x2F, 0x03, 0x55, 0x55, 0x53,
+    0x84, 0x64, 0x61, 0xA3, 0x73, 0xD4, 0x28, 0x3D, 0x42, 0x82, 0xD4, 0x37,
+    0x37, 0x10, 0xD2, 0x6A, 0x62, 0xA7, 0x71, 0xC5, 0xD8, 0x5D, 0x95, 0xA5,
+    0x67, 0x68, 0x56, 0x69, 0x56, 0x5A, 0x51, 0xF0, 0x55, 0xA4, 0x74, 0xA5,
+    0x2F, 0x04, 0x5A, 0x56, 0x5A, 0x43, 0xF0, 0x44, 0xA5, 0x4A, 0x59, 0x1E,
+    0x2B, 0x4D, 0x86, 0x91, 0xB7, 0xD2, 0xD0, 0xBD, 0x28, 0xD5, 0x6D, 0x74,
+    0x86, 0x73, 0x79, 0x72, 0x5C, 0x6F, 0x15, 0xD1, 0x5E, 0x20, 0x5D, 0x2A,
+    0xD1, 0x51, 0x5D, 0x06, 0x16, 0xC5, 0x27, 0x97, 0x37, 0x68, 0x4D, 0x76,
+    0xD5, 0x8D, 0x2B, 0xD0, 0xD2, 0x7B, 0xD5, 0x7C, 0x82, 0xB9, 0x91, 0xD0,
+    0x8D, 0xB7, 0xDC, 0x7B, 0x67, 0x97, 0xA6, 0x86, 0xB6, 0xF8, 0x5D, 0x05,
+    0x84, 0xD1, 0x57, 0x5D, 0x15, 0x75, 0xD0, 0x67, 0x5D, 0x05, 0x85, 0xC6,
+    0x77, 0xA6, 0x89, 0x68, 0x8D, 0x99, 0xD8, 0xA4, 0x1D, 0x1B, 0x52, 0xCC,
+    0x54, 0x7A, 0xF0, 0x55, 0xDD, 0x4D, 0xD5, 0xDA, 0xD0, 0xD4, 0xE2, 0xD1,
+    0xD4, 0xD0, 0xD5, 0xA7, 0xD7, 0xB2, 0x86, 0xD1, 0x18, 0x5D, 0xB4, 0xDC,
+    0x37, 0x6C, 0x36, 0xA7, 0x65, 0xC5, 0x5F, 0x01, 0x5D, 0x05, 0x64, 0xD1,
+    0x55, 0x5D, 0x15, 0x55, 0xD1, 0x46, 0x5D, 0x05, 0x66, 0xB6, 0x66, 0xA7,
+    0x68, 0x68, 0x7F, 0x01, 0xD8, 0x9D, 0x7B, 0xB2, 0x5D, 0x07, 0x44, 0xDC,
+    0x48, 0xE2, 0x0D, 0x35, 0xD6, 0xCD, 0x3D, 0x1D, 0x1D, 0x2D, 0x1D, 0x1D,
+    0x3C, 0x70, 0xD7, 0x59, 0x84, 0x96, 0x92, 0xB6, 0x91, 0xD0, 0x5D, 0x96,
+    0xD2, 0x33, 0xB9, 0xD6, 0x7D, 0x77, 0xD8, 0x6D, 0x95, 0xDA, 0x4D, 0x3E,
+    0x20, 0x75, 0xD3, 0xF0, 0x74, 0xD5, 0xD6, 0x8E, 0x2D, 0x79, 0xD5, 0x90,
+    0xA8, 0x23, 0x7D, 0x36, 0xD4, 0x5D, 0x54, 0xD5, 0x47, 0x75, 0x45, 0xA3,
+    0x55, 0xD5, 0x9D, 0x1D, 0x29, 0xD3, 0x8D, 0x39, 0xD2, 0xD0, 0xAD, 0x46,
+    0x33, 0xC5, 0x25, 0xB5, 0x26, 0x86, 0x2D, 0x82, 0xD7, 0x3D, 0x64, 0xD4,
+    0xC8, 0x90, 0x64, 0xAE, 0x20, 0x55, 0xAF, 0x05, 0x4C, 0xD5, 0x1E, 0x2D,
+    0xF0, 0xB1, 0xF0, 0x35, 0xCF, 0x03, 0x4D, 0x0E, 0x20, 0x25, 0xD2, 0x4D,
+    0x1E, 0x20, 0x15, 0xD2, 0x69, 0x4F, 0x1D, 0x62, 0xD4, 0x4D, 0x18, 0x87,
+    0x17, 0x7D, 0x36, 0x9F, 0x07, 0x6D, 0x47, 0x83, 0x5B, 0x43, 0x5A, 0x51,
+    0xF0, 0x15, 0xB5, 0x25, 0xB4, 0x2E, 0x30, 0x15, 0xA5, 0x35, 0x95, 0x45,
+    0x86, 0x46, 0x5A, 0x2D, 0x83, 0xD7, 0x3C, 0x17, 0x4A, 0x17, 0x76, 0xC0,
+    0x1B, 0x5B, 0xE2, 0x0C, 0x4D, 0xA5, 0xB4, 0x69, 0x59, 0x59, 0x59, 0x58,
+    0x5A, 0x57, 0x5B, 0x65, 0x6C, 0x55, 0x5D, 0x05, 0x45, 0xD1, 0x62, 0x6D,
+    0x25, 0x25, 0xD3, 0x51, 0x5B, 0xF0, 0x6A, 0xD6, 0x8D, 0x0F, 0x07, 0x7D,
+    0x95, 0xD2, 0x19, 0x98, 0x1A, 0x8D, 0x77, 0xD8, 0x7A, 0x28, 0x98, 0x45,
+    0x45, 0x45, 0x55, 0x36, 0x44, 0x65, 0x36, 0x35, 0x65, 0x27, 0x34, 0x75,
+    0x27, 0x25, 0x75, 0x19, 0x14, 0x6F, 0x02, 0xD7, 0x6F, 0x02, 0x91, 0x99,
+    0x82, 0x8A, 0x73, 0x8A, 0x74, 0x6B, 0x65, 0x6C, 0x55, 0x5D, 0x04, 0x65,
+    0xA0, 0x69, 0x59, 0x5A, 0x4A, 0xF5, 0xA3, 0xB5, 0x95, 0x98, 0x74, 0x7C,
+    0x72, 0x7D, 0x1D, 0x1D, 0x3B, 0xD6, 0x9D, 0x78, 0xD7, 0xAD, 0x4D, 0x0D,
+    0x27, 0x17, 0xD0, 0x73, 0x7B, 0x75, 0x77, 0x96, 0x94, 0xB4, 0xB2, 0xC3,
+    0xC2, 0xC3, 0xB4, 0xA5, 0x94, 0x78, 0x79, 0x7A, 0x5B, 0x5B, 0x5B, 0x5B,
+    0x5A, 0x78, 0x88, 0x96, 0xA5, 0xC5, 0x96, 0xC5, 0x95, 0xD0, 0x67, 0x56,
+    0xF0, 0x95, 0x65, 0xD3, 0x64, 0x5D, 0x46, 0x35, 0x9F, 0x0A, 0x52, 0x5D,
+    0x7B, 0xD9, 0x9D, 0xA8, 0xDB, 0x7D, 0xD6, 0xDD, 0x5D, 0xD5, 0xDE, 0x4D,
+    0xE5, 0xDD, 0x5D, 0x6D, 0x2D, 0x3E, 0x2D, 0x3D, 0x4D, 0x1D, 0x40, 0x5D,
+    0x7F, 0x5D, 0x65, 0xD7, 0x5D, 0x66, 0x56, 0x77, 0x46, 0x78, 0x45, 0x6D,
+    0x47, 0xD4, 0x7D, 0x47, 0xD4, 0x6D, 0x47, 0xD4, 0x7D, 0x47, 0x74, 0x66,
+    0x85, 0x5D, 0x74, 0xD8, 0x3F, 0x01, 0xD7, 0x4D, 0x84, 0xC4, 0xB7, 0x98,
+    0x89, 0x87, 0x96, 0xB5, 0x5E, 0x30, 0x65, 0xC4, 0x7E, 0x20, 0x55, 0x7F,
+    0x04, 0x59, 0x79, 0x89, 0xF7, 0xA8, 0xB6, 0x9E, 0x20, 0x35, 0xC4, 0xAE,
+    0x30, 0x25, 0xC6, 0xB7, 0xA8, 0x7F, 0x03, 0x7C, 0x48, 0xF7, 0x4E, 0x26,
+    0x5F, 0x64, 0x1F, 0x05, 0x51, 0xE2, 0x05, 0x42, 0xF0, 0x45, 0x2E, 0x20,
+    0x44, 0x3F, 0x03, 0x53, 0xE2, 0x03, 0x44, 0xF0, 0x25, 0x4E, 0x20, 0x24,
+    0x5F, 0x01, 0x55, 0xF0, 0x14, 0x6E, 0x25, 0x64, 0x73, 0x80, 0x84, 0xC6,
+    0xB7, 0xA8, 0xA7, 0xB6, 0x2E, 0x40, 0xA5, 0x2F, 0x0A, 0x43, 0xE2, 0x09,
+    0x5C, 0x6B, 0x8F, 0xA7, 0x98, 0x88, 0x95, 0x4F, 0x07, 0x55, 0xF0, 0x74,
+    0x6E, 0x20, 0x65, 0xC4, 0xB6, 0x89, 0x79, 0x88, 0x97, 0xB4, 0xC0, 0x65,
+    0xD3, 0x8D, 0x1A, 0x73, 0x2C, 0x54, 0x1D, 0x12, 0xD0, 0x2D, 0x65, 0xC2,
+    0x37, 0xAD, 0x17, 0xD4, 0x55};
+
+const GFXglyph FreeMonoBoldOblique24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 28, 0, 1},          // 0x20 ' '
+    {0, 12, 31, 28, 12, -29},     // 0x21 '!'
+    {27, 17, 14, 28, 11, -28},    // 0x22 '"'
+    {53, 24, 34, 28, 5, -30},     // 0x23 '#'
+    {106, 25, 38, 28, 4, -31},    // 0x24 '$'
+    {168, 22, 30, 28, 6, -28},    // 0x25 '%'
+    {214, 21, 28, 28, 5, -26},    // 0x26 '&'
+    {258, 7, 14, 28, 16, -28},    // 0x27 '''
+    {269, 14, 37, 28, 14, -29},   // 0x28 '('
+    {302, 14, 37, 28, 5, -29},    // 0x29 ')'
+    {333, 21, 19, 28, 8, -28},    // 0x2A '*'
+    {361, 24, 26, 28, 5, -25},    // 0x2B '+'
+    {393, 12, 14, 28, 6, -6},     // 0x2C ','
+    {408, 24, 5, 28, 5, -15},     // 0x2D '-'
+    {414, 7, 6, 28, 11, -4},      // 0x2E '.'
+    {420, 28, 38, 28, 3, -32},    // 0x2F '/'
+    {477, 23, 31, 28, 6, -29},    // 0x30 '0'
+    {527, 21, 30, 28, 4, -29},    // 0x31 '1'
+    {565, 26, 30, 28, 3, -29},    // 0x32 '2'
+    {611, 25, 31, 28, 4, -29},    // 0x33 '3'
+    {656, 22, 28, 28, 5, -27},    // 0x34 '4'
+    {700, 25, 31, 28, 4, -29},    // 0x35 '5'
+    {740, 24, 31, 28, 7, -29},    // 0x36 '6'
+    {789, 22, 30, 28, 9, -29},    // 0x37 '7'
+    {831, 23, 31, 28, 6, -29},    // 0x38 '8'
+    {882, 24, 31, 28, 5, -29},    // 0x39 '9'
+    {933, 10, 22, 28, 11, -20},   // 0x3A ':'
+    {947, 15, 28, 28, 5, -20},    // 0x3B ';'
+    {969, 25, 21, 28, 5, -23},    // 0x3C '<'
+    {1001, 26, 14, 28, 4, -19},   // 0x3D '='
+    {1015, 25, 22, 28, 4, -23},   // 0x3E '>'
+    {1049, 19, 29, 28, 10, -27},  // 0x3F '?'
+    {1084, 23, 36, 28, 5, -28},   // 0x40 '@'
+    {1155, 30, 27, 28, 0, -26},   // 0x41 'A'
+    {1203, 29, 27, 28, 1, -26},   // 0x42 'B'
+    {1251, 28, 29, 28, 3, -27},   // 0x43 'C'
+    {1298, 28, 27, 28, 1, -26},   // 0x44 'D'
+    {1346, 29, 27, 28, 1, -26},   // 0x45 'E'
+    {1395, 31, 27, 28, 0, -26},   // 0x46 'F'
+    {1443, 28, 29, 28, 3, -27},   // 0x47 'G'
+    {1496, 30, 27, 28, 1, -26},   // 0x48 'H'
+    {1545, 25, 27, 28, 3, -26},   // 0x49 'I'
+    {1576, 31, 28, 28, 0, -26},   // 0x4A 'J'
+    {1621, 31, 27, 28, 0, -26},   // 0x4B 'K'
+    {1678, 27, 27, 28, 1, -26},   // 0x4C 'L'
+    {1717, 34, 27, 28, 0, -26},   // 0x4D 'M'
+    {1784, 32, 27, 28, 1, -26},   // 0x4E 'N'
+    {1840, 27, 29, 28, 3, -27},   // 0x4F 'O'
+    {1894, 28, 27, 28, 1, -26},   // 0x50 'P'
+    {1937, 27, 35, 28, 3, -27},   // 0x51 'Q'
+    {2001, 29, 27, 28, 0, -26},   // 0x52 'R'
+    {2050, 26, 29, 28, 3, -27},   // 0x53 'S'
+    {2101, 26, 27, 28, 4, -26},   // 0x54 'T'
+    {2147, 28, 28, 28, 4, -26},   // 0x55 'U'
+    {2199, 30, 27, 28, 2, -26},   // 0x56 'V'
+    {2251, 29, 27, 28, 3, -26},   // 0x57 'W'
+    {2310, 32, 27, 28, 0, -26},   // 0x58 'X'
+    {2361, 26, 27, 28, 4, -26},   // 0x59 'Y'
+    {2404, 27, 27, 28, 2, -26},   // 0x5A 'Z'
+    {2447, 18, 37, 28, 10, -29},  // 0x5B '['
+    {2485, 13, 38, 28, 10, -32},  // 0x5C '\'
+    {2517, 18, 37, 28, 5, -29},   // 0x5D ']'
+    {2555, 20, 15, 28, 8, -29},   // 0x5E '^'
+    {2578, 29, 5, 28, -2, 5},     // 0x5F '_'
+    {2585, 8, 8, 28, 13, -30},    // 0x60 '`'
+    {2594, 24, 23, 28, 3, -21},   // 0x61 'a'
+    {2631, 29, 31, 28, 0, -29},   // 0x62 'b'
+    {2685, 25, 23, 28, 3, -21},   // 0x63 'c'
+    {2719, 28, 31, 28, 3, -29},   // 0x64 'd'
+    {2769, 24, 23, 28, 3, -21},   // 0x65 'e'
+    {2804, 28, 30, 28, 4, -29},   // 0x66 'f'
+    {2844, 28, 31, 28, 3, -21},   // 0x67 'g'
+    {2899, 26, 30, 28, 2, -29},   // 0x68 'h'
+    {2950, 23, 29, 28, 3, -28},   // 0x69 'i'
+    {2984, 23, 38, 28, 3, -28},   // 0x6A 'j'
+    {3032, 26, 30, 28, 2, -29},   // 0x6B 'k'
+    {3080, 23, 30, 28, 3, -29},   // 0x6C 'l'
+    {3114, 30, 22, 28, 0, -21},   // 0x6D 'm'
+    {3170, 26, 22, 28, 2, -21},   // 0x6E 'n'
+    {3208, 25, 23, 28, 3, -21},   // 0x6F 'o'
+    {3246, 31, 31, 28, -1, -21},  // 0x70 'p'
+    {3303, 29, 31, 28, 2, -21},   // 0x71 'q'
+    {3362, 28, 22, 28, 2, -21},   // 0x72 'r'
+    {3396, 23, 23, 28, 4, -21},   // 0x73 's'
+    {3434, 20, 28, 28, 5, -26},   // 0x74 't'
+    {3468, 23, 22, 28, 5, -20},   // 0x75 'u'
+    {3504, 28, 21, 28, 3, -20},   // 0x76 'v'
+    {3542, 28, 21, 28, 3, -20},   // 0x77 'w'
+    {3589, 29, 21, 28, 1, -20},   // 0x78 'x'
+    {3629, 32, 30, 28, -1, -20},  // 0x79 'y'
+    {3683, 25, 21, 28, 4, -20},   // 0x7A 'z'
+    {3717, 17, 37, 28, 10, -29},  // 0x7B '{'
+    {3753, 11, 36, 28, 11, -28},  // 0x7C '|'
+    {3790, 17, 37, 28, 6, -29},   // 0x7D '}'
+    {3827, 23, 10, 28, 5, -17}};  // 0x7E '~'
+
+const GFXpackedFont FreeMonoBoldOblique24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeMonoBoldOblique24pt7bRLEBitmaps,
+     (GFXglyph *)FreeMonoBoldOblique24pt7bRLEGlyphs, 0x20, 0x7E, 47},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 4518 bytes, glyph bitmaps 3845 bytes (7635 uncompressed)
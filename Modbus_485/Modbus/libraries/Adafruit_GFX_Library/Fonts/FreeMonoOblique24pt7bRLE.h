@@ -0,0 +1,419 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeMonoOblique24pt7bRLEBitmaps[] PROGMEM = {
+    0x73, 0xF6, 0x4F, 0x63, 0x1F, 0x05, 0x41, 0xE2, 0x05, 0x32, 0xE2, 0x04,
+    0x33, 0xF0, 0x42, 0x4F, 0x03, 0x34, 0xF0, 0x32, 0x5E, 0x50, 0xB3, 0x6E,
+    0x25, 0x63, 0x60, 0xF1, 0x63, 0x6E, 0x21, 0x54, 0x52, 0x45, 0x42, 0x54,
+    0x52, 0xE2, 0x45, 0x43, 0xE2, 0x36, 0x34, 0x27, 0x25, 0xB2, 0x52, 0x2F,
+    0x0B, 0x24, 0x2D, 0x11, 0x52, 0x3E, 0x20, 0xA2, 0x42, 0xD0, 0x25, 0x24,
+    0xE2, 0x09, 0x24, 0x25, 0xF0, 0x3D, 0x68, 0x24, 0x2D, 0x02, 0x52, 0x6E,
+    0x20, 0x72, 0x42, 0xD0, 0x24, 0x28, 0xF0, 0x1D, 0x58, 0x25, 0x28, 0xE2,
+    0x05, 0x24, 0x2D, 0x02, 0x51, 0xAF, 0x04, 0x24, 0x2D, 0x02, 0x52, 0xAE,
+    0x20, 0x32, 0x42, 0xB0, 0xFD, 0x12, 0xD6, 0x1D, 0x46, 0xD0, 0x91, 0x28,
+    0x35, 0x57, 0x29, 0x36, 0x2B, 0x16, 0x3B, 0x11, 0xE2, 0x05, 0x2D, 0x63,
+    0xD6, 0x5D, 0x48, 0xD3, 0x7D, 0x54, 0xD6, 0x32, 0xF0, 0xD4, 0x24, 0x1D,
+    0x12, 0x2F, 0x01, 0x2D, 0x02, 0x34, 0xB2, 0x46, 0x73, 0x52, 0x2B, 0xC7,
+    0x8E, 0x20, 0x82, 0xBE, 0x20, 0x72, 0xC0, 0x94, 0xD3, 0x8D, 0x03, 0x42,
+    0xC3, 0x62, 0xB2, 0x72, 0x6F, 0x04, 0x28, 0x2A, 0x27, 0x2B, 0x26, 0x3B,
+    0x34, 0x3D, 0x08, 0x63, 0x65, 0x56, 0xD0, 0x5D, 0x06, 0xD0, 0x6D, 0x05,
+    0xD2, 0x4D, 0x51, 0x94, 0xD3, 0x8D, 0x03, 0x42, 0x5F, 0x07, 0x27, 0x24,
+    0xF0, 0x62, 0x82, 0xA2, 0x72, 0xB2, 0x63, 0xC2, 0x43, 0xD0, 0x8D, 0x34,
+    0x90, 0xB4, 0xD0, 0x99, 0x33, 0x39, 0x2D, 0x33, 0xAE, 0x20, 0x62, 0xD5,
+    0x1B, 0xF0, 0x72, 0xD2, 0x5C, 0x32, 0x26, 0x32, 0x25, 0x24, 0x41, 0x26,
+    0x24, 0x23, 0x26, 0x23, 0x23, 0x28, 0x22, 0x23, 0x28, 0x21, 0x24, 0xE2,
+    0x29, 0x36, 0x27, 0x46, 0x34, 0x31, 0x54, 0x83, 0x45, 0x5B, 0xF1, 0x6E,
+    0x21, 0x52, 0x42, 0x52, 0xE2, 0x43, 0xE2, 0x34, 0x25, 0x92, 0x82, 0x83,
+    0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x6F, 0x02, 0x36, 0xE2,
+    0x01, 0x37, 0x47, 0xE9, 0x38, 0xE2, 0x01, 0x29, 0x37, 0xF0, 0x22, 0xA1,
+    0x70, 0xE2, 0x72, 0x93, 0x1E, 0x20, 0x82, 0x1E, 0x90, 0x83, 0xE2, 0x73,
+    0x74, 0x1F, 0x06, 0x32, 0xF0, 0x53, 0x3F, 0x04, 0x37, 0x38, 0x28, 0x38,
+    0x28, 0x28, 0x29, 0x1A, 0xA1, 0x7E, 0x20, 0x92, 0x7F, 0x08, 0x28, 0x35,
+    0x26, 0x11, 0x62, 0x22, 0x53, 0xD0, 0x87, 0xC4, 0xD0, 0x5C, 0x32, 0x2A,
+    0x33, 0x2A, 0x25, 0x28, 0x26, 0x27, 0x27, 0x26, 0xE2, 0xC2, 0xD6, 0x38,
+    0xE3, 0x0B, 0x29, 0xF0, 0xA2, 0xAD, 0xF0, 0xD2, 0xB2, 0xAE, 0x40, 0x92,
+    0xBE, 0x30, 0x82, 0xC0, 0x66, 0x56, 0x65, 0x2F, 0x04, 0x56, 0x57, 0x47,
+    0x57, 0x47, 0x48, 0x38, 0x48, 0x39, 0x2A, 0x0D, 0xF0, 0xD2, 0x10, 0x24,
+    0x26, 0xF0, 0xD0, 0x24, 0x20, 0xFD, 0x92, 0xD8, 0x21, 0xF0, 0xD7, 0x2D,
+    0x82, 0x3F, 0x0D, 0x52, 0xD8, 0x25, 0xF0, 0xD3, 0x2D, 0x82, 0xD8, 0x2D,
+    0x83, 0xD8, 0x2D, 0x82, 0xD8, 0x3D, 0x82, 0xD8, 0x2D, 0x83, 0xD8, 0x2D,
+    0x82, 0xD1, 0xF0, 0x72, 0xD8, 0x2D, 0x3F, 0x05, 0x2D, 0x82, 0xD5, 0xF0,
+    0x32, 0xD8, 0x2D, 0x82, 0xD8, 0x3D, 0x82, 0xD9, 0x1D, 0xA0, 0xA6, 0xC9,
+    0xA3, 0x53, 0x83, 0x73, 0x63, 0x92, 0x53, 0xB2, 0x42, 0xC2, 0xF3, 0x2D,
+    0x02, 0xE2, 0x22, 0xD1, 0x22, 0x1D, 0x21, 0x1E, 0x20, 0x12, 0xD1, 0x22,
+    0x1D, 0x21, 0x2E, 0x22, 0xD1, 0x22, 0xE2, 0x2D, 0x02, 0x32, 0xC2, 0x42,
+    0xB3, 0x52, 0x93, 0x62, 0x83, 0x83, 0x44, 0x9A, 0xC6, 0xA0, 0xC3, 0xD0,
+    0x4C, 0x5B, 0x31, 0x29, 0x32, 0x29, 0x33, 0x28, 0x34, 0x28, 0x16, 0x2D,
+    0x13, 0x3E, 0x30, 0xB2, 0xD1, 0x34, 0xE3, 0x0A, 0x25, 0xE4, 0x09, 0x26,
+    0xE3, 0x08, 0x27, 0xFD, 0x40, 0xD0, 0x6D, 0x29, 0xC4, 0x53, 0xA3, 0x83,
+    0x83, 0xA3, 0x72, 0xC2, 0x62, 0xD0, 0x26, 0x1D, 0x12, 0xD8, 0x2F, 0xD7,
+    0x2D, 0x72, 0xD7, 0x2D, 0x63, 0xD6, 0x3D, 0x63, 0xD6, 0x3D, 0x53, 0xD6,
+    0x3D, 0x63, 0xD6, 0x3D, 0x53, 0xD6, 0x3D, 0x63, 0xD5, 0x4D, 0x53, 0xD0,
+    0x24, 0x3D, 0x12, 0x4D, 0x64, 0xD5, 0x50, 0xC6, 0xD0, 0xB9, 0x46, 0x47,
+    0x3A, 0x27, 0x2C, 0x2E, 0x3D, 0x72, 0xD6, 0x2D, 0x63, 0xD5, 0x3D, 0x53,
+    0xD0, 0x7D, 0x26, 0xD7, 0x4D, 0x73, 0xD7, 0x23, 0xE4, 0x0D, 0x52, 0xD6,
+    0x2D, 0x63, 0x32, 0xD0, 0x34, 0x3B, 0x36, 0x47, 0x48, 0xCD, 0x07, 0xA0,
+    0xD1, 0x5D, 0x05, 0xD1, 0x21, 0x2D, 0x02, 0x22, 0xC2, 0x32, 0xB2, 0x32,
+    0xB2, 0x42, 0xA3, 0x42, 0xA2, 0x52, 0x92, 0x62, 0x82, 0x62, 0x82, 0x72,
+    0x3F, 0x04, 0x28, 0x26, 0x29, 0x25, 0x29, 0x25, 0x2A, 0x24, 0x2B, 0x24,
+    0xFD, 0x42, 0xE3, 0x0C, 0x25, 0xF0, 0xB2, 0x6F, 0x06, 0xA3, 0xF7, 0xD1,
+    0x71, 0xD0, 0xE3, 0x06, 0x2D, 0x0E, 0x20, 0x52, 0xD6, 0x21, 0x8A, 0xD0,
+    0x75, 0x64, 0x71, 0xB2, 0xD6, 0x31, 0xE4, 0x0D, 0x52, 0x1F, 0x0D, 0x42,
+    0xD5, 0x3D, 0x52, 0x32, 0xD0, 0x24, 0x3A, 0x36, 0x46, 0x48, 0xCC, 0x6A,
+    0xD1, 0x6C, 0xA9, 0x5D, 0x23, 0xD4, 0x3D, 0x42, 0xD5, 0x2D, 0x53, 0xD4,
+    0x3D, 0x52, 0xD5, 0x3D, 0x52, 0xD5, 0x34, 0x59, 0x23, 0x97, 0x22, 0x34,
+    0x46, 0x21, 0x28, 0x25, 0x21, 0x29, 0x34, 0x4B, 0x24, 0xF3, 0xC2, 0x4F,
+    0x2D, 0x02, 0x4F, 0x2C, 0x25, 0x3A, 0x27, 0x2A, 0x27, 0x37, 0x39, 0x35,
+    0x3B, 0x9D, 0x06, 0xB0, 0xF1, 0xD4, 0xF0, 0x2D, 0x12, 0xFD, 0x22, 0xD2,
+    0x22, 0xF0, 0xD0, 0x23, 0xF0, 0xC2, 0x4F, 0x0B, 0x25, 0xF0, 0xA2, 0x6F,
+    0x09, 0x27, 0xF0, 0x82, 0x8F, 0x07, 0x2D, 0x22, 0xAF, 0x05, 0x2B, 0xF0,
+    0x42, 0xCF, 0x03, 0x2D, 0x00, 0xA6, 0xCA, 0x93, 0x54, 0x63, 0x92, 0x62,
+    0xB2, 0x42, 0xC2, 0x33, 0xC2, 0xF3, 0x2D, 0x02, 0x32, 0xC2, 0x42, 0xB3,
+    0x52, 0x93, 0x64, 0x54, 0x3F, 0x06, 0x99, 0x36, 0x37, 0x29, 0x35, 0x2B,
+    0x32, 0xF0, 0x12, 0xD0, 0x22, 0xE2, 0x2D, 0x12, 0x22, 0xD0, 0x23, 0x2C,
+    0x33, 0x3A, 0x35, 0x29, 0x36, 0x45, 0x48, 0xAC, 0x6A, 0xC5, 0xD2, 0x9B,
+    0x45, 0x39, 0x38, 0x37, 0x3A, 0x27, 0x2B, 0x3F, 0x52, 0xD0, 0x2F, 0x42,
+    0xD1, 0x24, 0x2D, 0x03, 0x42, 0xC4, 0x42, 0xB2, 0x12, 0x43, 0x96, 0x52,
+    0x83, 0x12, 0x64, 0x44, 0x22, 0x79, 0x42, 0x95, 0x52, 0xD7, 0x2D, 0x63,
+    0xD6, 0x2D, 0x62, 0xD6, 0x3D, 0x53, 0xD5, 0x3D, 0x53, 0xD4, 0x4D, 0x25,
+    0xAA, 0xD0, 0x6D, 0x20, 0x54, 0x56, 0xF3, 0x73, 0x65, 0x42, 0xE8, 0x0C,
+    0x45, 0x63, 0xF7, 0x36, 0x54, 0x50, 0xA4, 0xA6, 0xF8, 0x78, 0x6A, 0x42,
+    0xE6, 0x0D, 0x2F, 0x06, 0x68, 0x69, 0x55, 0xF0, 0x45, 0x95, 0xA4, 0x8F,
+    0x02, 0x4A, 0x4B, 0x3B, 0x3D, 0x01, 0xD0, 0xD8, 0x2D, 0x64, 0xD4, 0x4D,
+    0x44, 0xD4, 0x4D, 0x44, 0xD4, 0x4D, 0x44, 0xD4, 0x4D, 0x44, 0xD3, 0xF0,
+    0x14, 0xD8, 0x4D, 0x74, 0xD8, 0x4D, 0x83, 0xD8, 0x4D, 0x84, 0xD7, 0x4D,
+    0x84, 0xD7, 0x4D, 0x82, 0x40, 0xF2, 0xDA, 0xE4, 0xDC, 0xF0, 0x1D, 0xA1,
+    0x52, 0xD9, 0x4D, 0x94, 0xD8, 0x4D, 0x94, 0xD8, 0x4D, 0x94, 0xD9, 0x3D,
+    0x94, 0xD9, 0x4D, 0x84, 0xD6, 0x4D, 0x54, 0xD5, 0x4D, 0x54, 0xD5, 0x4D,
+    0x54, 0xD5, 0x4D, 0x54, 0xD5, 0x4D, 0x63, 0xD7, 0x2D, 0x90, 0x57, 0x6C,
+    0x34, 0x64, 0x12, 0xB3, 0xF0, 0x2C, 0x2F, 0xD1, 0x2F, 0xD0, 0x2C, 0x3C,
+    0x3B, 0x3A, 0x5B, 0x38, 0xE2, 0x04, 0x2A, 0xE4, 0x0D, 0x54, 0xB6, 0x9F,
+    0x7A, 0x5A, 0xA6, 0xB9, 0x93, 0x53, 0x73, 0x73, 0x52, 0xA2, 0x43, 0xA2,
+    0x42, 0xB2, 0xF3, 0x2C, 0x22, 0x29, 0x62, 0x27, 0x82, 0x26, 0x33, 0x22,
+    0x26, 0x25, 0x21, 0xF0, 0x12, 0x52, 0x62, 0x22, 0x42, 0x63, 0x22, 0x42,
+    0x62, 0x2F, 0x25, 0x26, 0x22, 0x25, 0x44, 0x22, 0x26, 0x92, 0x28, 0x72,
+    0xE3, 0x2D, 0x43, 0xD4, 0x2D, 0x43, 0xD4, 0x37, 0x27, 0xBA, 0x78, 0xF9,
+    0xBD, 0x92, 0x12, 0xD9, 0x22, 0x26, 0xF0, 0xD1, 0x23, 0x2D, 0x62, 0x42,
+    0xD5, 0x25, 0x2D, 0x52, 0x53, 0xD3, 0x27, 0x2D, 0x31, 0x82, 0xD2, 0x28,
+    0x25, 0xF0, 0x92, 0x92, 0xD0, 0x2B, 0x2C, 0xD2, 0xBD, 0x34, 0xF0, 0x62,
+    0xD0, 0x29, 0x2D, 0x12, 0x91, 0xD3, 0x27, 0x2D, 0x32, 0x3F, 0x03, 0x2D,
+    0x42, 0x3F, 0x98, 0xA0, 0x6D, 0x39, 0xD6, 0xB2, 0xB3, 0xA2, 0xC3, 0xE3,
+    0x82, 0xD1, 0x28, 0x2D, 0x02, 0x82, 0xD0, 0x29, 0x2A, 0x4A, 0xD1, 0xCD,
+    0x2A, 0x3B, 0x39, 0x2D, 0x03, 0x82, 0xD1, 0x31, 0xF0, 0x62, 0xD2, 0x21,
+    0xF0, 0x52, 0xD3, 0x26, 0x2D, 0x22, 0x72, 0xD1, 0x37, 0x2D, 0x03, 0x72,
+    0xD0, 0x34, 0xD8, 0x5D, 0x67, 0xC7, 0xD2, 0xC2, 0x28, 0x46, 0x41, 0x26,
+    0x4A, 0x55, 0x3D, 0x03, 0x53, 0xD2, 0x25, 0x2D, 0x32, 0x42, 0xD4, 0x23,
+    0x3D, 0x41, 0x42, 0xD9, 0x3D, 0x8E, 0x30, 0x12, 0xD9, 0xE5, 0x2D, 0xB2,
+    0xDA, 0x2D, 0x32, 0x62, 0xD1, 0x27, 0x3B, 0x39, 0x47, 0x4B, 0xCD, 0x36,
+    0xC0, 0x6D, 0x1B, 0xD4, 0xC2, 0xA4, 0xA2, 0xB3, 0x93, 0xC3, 0x82, 0xD1,
+    0x28, 0x2D, 0x13, 0xF7, 0x2D, 0x22, 0xE3, 0x62, 0xD3, 0x26, 0x2D, 0x22,
+    0x1F, 0x05, 0x2D, 0x32, 0x1F, 0x05, 0x2D, 0x22, 0x63, 0xD1, 0x36, 0x2D,
+    0x22, 0x72, 0xD1, 0x28, 0x2D, 0x02, 0x92, 0xB3, 0x92, 0xA4, 0x7D, 0x58,
+    0xD2, 0xB0, 0x6D, 0x85, 0xD9, 0x92, 0xD1, 0x29, 0x2D, 0x02, 0x1E, 0x20,
+    0x82, 0xD1, 0x29, 0x2D, 0xC2, 0x62, 0x9F, 0x07, 0x27, 0x2D, 0x3B, 0xD3,
+    0xAD, 0x33, 0x62, 0xAF, 0x06, 0x27, 0x2A, 0xF0, 0x62, 0xD6, 0xE2, 0x05,
+    0x2D, 0x22, 0x3F, 0x05, 0x2D, 0x12, 0x82, 0xD2, 0x24, 0xFD, 0xA4, 0x6D,
+    0x95, 0xDA, 0x92, 0xD2, 0x29, 0x2D, 0x12, 0x1E, 0x20, 0x82, 0xD2, 0x29,
+    0x2D, 0xD2, 0x62, 0xAF, 0x07, 0x27, 0x2D, 0x4B, 0xD4, 0xAD, 0x43, 0x62,
+    0xBF, 0x06, 0x27, 0x2B, 0xF0, 0x62, 0xD7, 0xE4, 0x05, 0x2D, 0xC2, 0xD9,
+    0xFD, 0x1D, 0x10, 0xC7, 0xD2, 0xC2, 0x28, 0x46, 0x76, 0x4A, 0x55, 0x3D,
+    0x12, 0x53, 0xD2, 0x24, 0x3D, 0x32, 0x42, 0xD7, 0xF0, 0x22, 0xD8, 0xE4,
+    0x01, 0x2D, 0x9F, 0x2A, 0xC1, 0x2D, 0x52, 0x3E, 0x22, 0xD4, 0x24, 0x3D,
+    0x32, 0x52, 0xD2, 0x35, 0x3D, 0x12, 0x73, 0xC3, 0x84, 0x85, 0x9D, 0x1D,
+    0x17, 0xB0, 0xF6, 0x85, 0x88, 0x2D, 0x02, 0xA2, 0xC2, 0xA3, 0xC2, 0x3F,
+    0x07, 0x2D, 0x02, 0xA2, 0xC3, 0xA2, 0xC2, 0x4F, 0x06, 0x2D, 0x02, 0xAD,
+    0x4A, 0xD3, 0xB2, 0xC2, 0x5E, 0x20, 0x52, 0xD0, 0x2A, 0x2C, 0x2A, 0x3C,
+    0x26, 0xF0, 0x42, 0xD0, 0x2A, 0x2C, 0x3A, 0x2C, 0x2A, 0x3C, 0x27, 0xF9,
+    0x59, 0x40, 0xF5, 0xD4, 0xE2, 0xC2, 0xD6, 0x38, 0xE3, 0x0B, 0x29, 0xE4,
+    0x0A, 0x2A, 0xE3, 0x09, 0x2D, 0x63, 0xBE, 0x30, 0x82, 0xCF, 0xD4, 0x50,
+    0xCD, 0x3B, 0xD4, 0xFD, 0x72, 0x6E, 0x30, 0xD6, 0x2D, 0xC3, 0x7E, 0x30,
+    0xD5, 0x2D, 0xC3, 0xA1, 0xD1, 0x29, 0xE2, 0x01, 0x2D, 0x12, 0xA2, 0xD0,
+    0x2A, 0xF2, 0xD1, 0x2A, 0x2D, 0x02, 0xB3, 0xB2, 0xD0, 0x39, 0x3D, 0x14,
+    0x53, 0xD4, 0xAD, 0x76, 0xD4, 0x6A, 0x58, 0x5B, 0x58, 0x92, 0xC3, 0xC2,
+    0xB3, 0xC2, 0xB2, 0xD1, 0x29, 0x3D, 0x22, 0x83, 0xD3, 0x27, 0x2D, 0x52,
+    0x53, 0xD5, 0x25, 0x3D, 0x62, 0x42, 0xD8, 0x22, 0x4D, 0x82, 0x12, 0x14,
+    0xD5, 0x54, 0x3D, 0x44, 0x63, 0xD3, 0x29, 0x2D, 0x32, 0x93, 0xD2, 0x2A,
+    0x29, 0xF0, 0x52, 0xB2, 0x9E, 0x20, 0x52, 0xC2, 0xC2, 0xD0, 0x28, 0xB8,
+    0x64, 0xB9, 0x54, 0xF5, 0xD1, 0x6F, 0x0B, 0x2C, 0xE3, 0x0A, 0x2D, 0x93,
+    0xD0, 0xE3, 0x09, 0x2D, 0x1E, 0x20, 0x82, 0xD2, 0xF0, 0x82, 0xC2, 0x1E,
+    0x20, 0x72, 0xD0, 0x28, 0x2C, 0x28, 0x3C, 0x28, 0x2D, 0x02, 0x2F, 0xDA,
+    0x20, 0x57, 0xD1, 0x65, 0x7D, 0x07, 0xF7, 0x21, 0x2C, 0x21, 0x2A, 0x22,
+    0x2A, 0x22, 0x23, 0xF0, 0x72, 0x22, 0x92, 0x22, 0xA2, 0x32, 0x82, 0x32,
+    0xA2, 0x33, 0x62, 0x42, 0xA2, 0x42, 0x62, 0x42, 0xA2, 0x42, 0x52, 0x42,
+    0xA3, 0x42, 0x42, 0x52, 0xA2, 0x52, 0x42, 0x52, 0xA2, 0x62, 0x22, 0x62,
+    0xA2, 0x62, 0x12, 0x72, 0xA2, 0x62, 0x12, 0x62, 0xA2, 0x74, 0x72, 0xA2,
+    0x82, 0x82, 0xA2, 0xD5, 0x2A, 0x2D, 0x43, 0xA2, 0xD4, 0x27, 0xE2, 0x03,
+    0x2D, 0x52, 0x7F, 0x99, 0x95, 0x56, 0x9A, 0x47, 0x9A, 0x84, 0xD0, 0x2B,
+    0x4D, 0x01, 0x4F, 0x07, 0x22, 0x2B, 0x2B, 0x22, 0x3A, 0x2B, 0x23, 0x2A,
+    0x2B, 0x14, 0x29, 0x25, 0xF0, 0x62, 0x52, 0x82, 0xB2, 0x53, 0x72, 0xB2,
+    0x62, 0x71, 0xC1, 0x72, 0x62, 0x6F, 0x05, 0x28, 0x25, 0x2B, 0x28, 0x34,
+    0x2B, 0x29, 0x23, 0x2B, 0x2A, 0x23, 0x27, 0xF0, 0x42, 0xB2, 0x22, 0xB2,
+    0xB3, 0x12, 0xB1, 0xD0, 0x4B, 0x2D, 0x04, 0x8A, 0x93, 0x89, 0xA3, 0x80,
+    0xC6, 0xD2, 0xBC, 0x45, 0x49, 0x3A, 0x37, 0x3C, 0x35, 0x3D, 0x12, 0x52,
+    0xD2, 0x24, 0x2D, 0x33, 0x23, 0xD4, 0x22, 0x2D, 0x52, 0xE2, 0x12, 0xD6,
+    0x2F, 0x02, 0xD7, 0x2E, 0x20, 0x2D, 0x62, 0x12, 0xD5, 0x22, 0x2D, 0x43,
+    0x22, 0xD4, 0x24, 0x2D, 0x22, 0x52, 0xD1, 0x35, 0x3C, 0x37, 0x3A, 0x39,
+    0x45, 0x4C, 0xBD, 0x26, 0xC0, 0x6D, 0x39, 0xD6, 0xB2, 0xA4, 0xA2, 0xC2,
+    0x92, 0xD0, 0x3E, 0x28, 0x2D, 0x12, 0x82, 0xD0, 0x37, 0x2D, 0x12, 0x82,
+    0xD0, 0x29, 0x2C, 0x2A, 0x29, 0x4A, 0xD2, 0xBC, 0x8E, 0x20, 0x62, 0xD5,
+    0xE4, 0x05, 0x2D, 0xA2, 0xD7, 0xFD, 0x1C, 0xC6, 0xD2, 0xBC, 0x45, 0x49,
+    0x3A, 0x37, 0x3C, 0x35, 0x3D, 0x12, 0x52, 0xD2, 0x24, 0x2D, 0x42, 0x23,
+    0xD4, 0x22, 0x2D, 0x52, 0xE2, 0x12, 0xD6, 0x2F, 0x02, 0xD7, 0x2E, 0x20,
+    0x2D, 0x62, 0x12, 0xD5, 0x22, 0x2D, 0x43, 0x22, 0xD4, 0x24, 0x2D, 0x22,
+    0x52, 0xD1, 0x36, 0x2C, 0x37, 0x3A, 0x3A, 0x35, 0x4D, 0x0A, 0xD2, 0x6D,
+    0x34, 0xD6, 0xA5, 0x26, 0xD5, 0x54, 0x75, 0x70, 0x5D, 0x49, 0xD6, 0xB2,
+    0xA4, 0xA2, 0xB3, 0x92, 0xD0, 0x3E, 0x38, 0x2D, 0x12, 0x72, 0xD1, 0x28,
+    0x2D, 0x02, 0x92, 0xB3, 0xA2, 0x94, 0xAD, 0x1C, 0xCD, 0x12, 0x74, 0xD0,
+    0x29, 0x3C, 0x2A, 0x3A, 0x2C, 0x2A, 0x2C, 0x39, 0x2D, 0x02, 0x92, 0xD0,
+    0x38, 0x2D, 0x12, 0x72, 0xD2, 0x32, 0xBA, 0xD3, 0xB4, 0xB7, 0xD2, 0xB2,
+    0x28, 0x37, 0x31, 0x26, 0x3B, 0x45, 0x3C, 0x36, 0x2D, 0x12, 0x1F, 0x04,
+    0x2D, 0x22, 0x1F, 0x04, 0x2D, 0x93, 0xD9, 0x3D, 0x96, 0xD8, 0x7D, 0x95,
+    0xD9, 0x3D, 0x93, 0x3F, 0x0D, 0x62, 0x51, 0xD3, 0x24, 0x2D, 0x32, 0x42,
+    0xD2, 0x25, 0x2D, 0x13, 0x44, 0xC3, 0x55, 0xA3, 0x62, 0x13, 0x74, 0x71,
+    0x3B, 0xD2, 0x6C, 0xF2, 0xD8, 0x32, 0x72, 0x82, 0x1F, 0x01, 0x28, 0x28,
+    0x22, 0x27, 0x37, 0x23, 0x27, 0x29, 0x12, 0xE2, 0x0A, 0x2D, 0x83, 0xCE,
+    0x30, 0x92, 0xD0, 0xE4, 0x08, 0x2D, 0x1E, 0x30, 0x72, 0xD2, 0xD2, 0x9D,
+    0x1A, 0xF1, 0x96, 0xA3, 0x2D, 0x32, 0x3E, 0x20, 0x32, 0xD2, 0x26, 0x3D,
+    0x22, 0x62, 0xD3, 0x24, 0xE2, 0x02, 0x2D, 0x22, 0x63, 0xD2, 0x26, 0x2D,
+    0x32, 0x5E, 0x20, 0x12, 0xD2, 0x26, 0x2D, 0x32, 0x62, 0xD2, 0x36, 0xF2,
+    0xD2, 0x27, 0x2D, 0x12, 0x82, 0xD0, 0x38, 0x3B, 0x3A, 0x39, 0x3C, 0x36,
+    0x4D, 0x1A, 0xD5, 0x6D, 0x20, 0xF0, 0x99, 0x92, 0x3D, 0x42, 0x3F, 0x03,
+    0x2D, 0x32, 0x72, 0xD2, 0x28, 0x2D, 0x21, 0x92, 0xD1, 0x26, 0xF0, 0x42,
+    0xC2, 0xB2, 0xB2, 0x8F, 0x04, 0x2A, 0x2D, 0x02, 0x92, 0xAF, 0x05, 0x27,
+    0x2B, 0xF0, 0x52, 0x62, 0xD4, 0x25, 0x2D, 0x53, 0x32, 0xD7, 0x23, 0x2D,
+    0x72, 0x22, 0xD2, 0xF0, 0x62, 0x12, 0xD9, 0x4D, 0xB3, 0xD4, 0x0A, 0x7D,
+    0x77, 0x91, 0xE2, 0x02, 0x2D, 0x52, 0x52, 0x91, 0x72, 0x62, 0x73, 0x72,
+    0x62, 0x64, 0x72, 0x52, 0x71, 0x12, 0x62, 0x62, 0x62, 0x12, 0x62, 0x62,
+    0x61, 0x22, 0x62, 0x62, 0x52, 0x22, 0x52, 0x72, 0x51, 0x32, 0x52, 0x72,
+    0x42, 0x42, 0x42, 0x72, 0x41, 0x52, 0x32, 0x82, 0x32, 0x52, 0x32, 0x82,
+    0x31, 0x62, 0x32, 0x82, 0x22, 0x62, 0x22, 0x82, 0x31, 0x72, 0x22, 0x82,
+    0x22, 0x72, 0x22, 0x82, 0x21, 0x82, 0x12, 0x92, 0x12, 0x82, 0x12, 0x92,
+    0x11, 0x92, 0x12, 0x94, 0x94, 0xAF, 0x3A, 0x4A, 0x67, 0x97, 0x67, 0x88,
+    0x82, 0xD1, 0x2B, 0x3C, 0x2D, 0x02, 0xB2, 0xD2, 0x29, 0x2D, 0x33, 0x72,
+    0xD5, 0x26, 0x2D, 0x63, 0x42, 0xD8, 0x23, 0x2D, 0x93, 0x12, 0xDB, 0x4D,
+    0xD2, 0xDD, 0x4D, 0xB2, 0x12, 0xDA, 0x22, 0x3D, 0x82, 0x42, 0xD7, 0x25,
+    0x3D, 0x52, 0x72, 0xD4, 0x29, 0x2D, 0x22, 0xA3, 0xD0, 0x2C, 0x2C, 0x2D,
+    0x03, 0xA2, 0xD2, 0x27, 0xF9, 0x78, 0x50, 0x18, 0x87, 0x17, 0x97, 0x33,
+    0xD0, 0x27, 0x2C, 0x28, 0x2B, 0x39, 0x29, 0x3A, 0x29, 0x2C, 0x27, 0x2D,
+    0x02, 0x62, 0xD2, 0x24, 0x2D, 0x32, 0x32, 0xD5, 0x21, 0x2D, 0x64, 0xD7,
+    0x3D, 0x92, 0xD0, 0xE4, 0x08, 0x2D, 0x1E, 0x30, 0x72, 0xD2, 0xD2, 0x9D,
+    0x1A, 0x6D, 0x46, 0xD3, 0x72, 0xC2, 0x71, 0xC2, 0x72, 0xB3, 0x72, 0xA3,
+    0x82, 0x93, 0x92, 0x83, 0xD6, 0x3D, 0x63, 0xD6, 0x3D, 0x63, 0xD7, 0x2D,
+    0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x72, 0xA2, 0x82, 0xB2, 0x72, 0xC2,
+    0x62, 0xD0, 0x16, 0x2D, 0x02, 0x52, 0xD1, 0x24, 0x2D, 0x22, 0x4D, 0x64,
+    0xD5, 0x50, 0xF7, 0x87, 0x2D, 0x01, 0x7E, 0x30, 0x62, 0x7E, 0x30, 0x52,
+    0xD0, 0x19, 0xE3, 0x04, 0x2D, 0x01, 0xAE, 0x30, 0x32, 0xAE, 0x30, 0x22,
+    0xD0, 0x1C, 0xE3, 0x01, 0x2D, 0x01, 0xD0, 0xF8, 0x70, 0xF0, 0x28, 0x37,
+    0xE2, 0x01, 0x28, 0x36, 0xE2, 0x02, 0x28, 0x35, 0xE2, 0x03, 0x25, 0xE3,
+    0x04, 0x24, 0xE3, 0x05, 0x23, 0xE3, 0x06, 0x22, 0xE3, 0x07, 0x21, 0xE3,
+    0x08, 0x29, 0x10, 0xF7, 0x8D, 0x01, 0x1E, 0x30, 0xC2, 0xD0, 0x12, 0xE3,
+    0x0B, 0x22, 0xE4, 0x0A, 0x23, 0xE3, 0x09, 0x2D, 0x01, 0x5E, 0x30, 0x82,
+    0x5E, 0x40, 0x72, 0xC2, 0x7F, 0x87, 0xB1, 0xD3, 0x2D, 0x24, 0xD0, 0x21,
+    0x2C, 0x23, 0x2A, 0x24, 0x37, 0x36, 0x26, 0x37, 0x34, 0x39, 0x23, 0x3B,
+    0x21, 0x3C, 0x5D, 0x11, 0x10, 0xF0, 0xDF, 0x02, 0x43, 0x42, 0x52, 0x52,
+    0x43, 0x42, 0xA7, 0xBD, 0x08, 0x48, 0x3D, 0x73, 0x1E, 0x30, 0xD6, 0x2D,
+    0x63, 0x98, 0x22, 0x7D, 0x25, 0x5A, 0x24, 0x3D, 0x02, 0x33, 0xD0, 0x32,
+    0x3D, 0x12, 0x32, 0xD2, 0x23, 0x2D, 0x13, 0x32, 0xD0, 0x43, 0x3A, 0x55,
+    0x36, 0x42, 0x62, 0xA4, 0x63, 0x7C, 0x66, 0xD8, 0x5D, 0x3E, 0x30, 0x92,
+    0xDC, 0x1D, 0xC2, 0x66, 0xD0, 0x24, 0xAB, 0x22, 0x36, 0x4A, 0x21, 0x2A,
+    0x38, 0x21, 0x2C, 0x28, 0x4D, 0x03, 0x73, 0xD2, 0x2F, 0x72, 0xD3, 0x2E,
+    0x26, 0x2D, 0x42, 0x62, 0xD3, 0x26, 0x3D, 0x32, 0x1F, 0x05, 0x3D, 0x22,
+    0x74, 0xD0, 0x28, 0x11, 0x2C, 0x28, 0x21, 0x3A, 0x25, 0x62, 0x45, 0x46,
+    0x63, 0xBD, 0x56, 0xA0, 0xA6, 0xD0, 0xB2, 0x26, 0x37, 0x65, 0x2A, 0x54,
+    0x2D, 0x02, 0x42, 0xD1, 0x23, 0x2D, 0x22, 0x23, 0xD2, 0x21, 0xF0, 0x12,
+    0xD6, 0xE5, 0x2D, 0x73, 0xD7, 0x2D, 0x22, 0x33, 0xC3, 0x54, 0x75, 0x7D,
+    0x0B, 0x89, 0xD6, 0x6D, 0x65, 0x1E, 0x20, 0xD9, 0x2D, 0xA1, 0xDA, 0x2B,
+    0x66, 0x29, 0xA4, 0x28, 0x36, 0x33, 0x26, 0x3A, 0x21, 0x26, 0x3C, 0x11,
+    0x26, 0x2D, 0x04, 0x52, 0xD2, 0x33, 0xE2, 0x01, 0x2D, 0x32, 0x4F, 0x2D,
+    0x42, 0x42, 0xD4, 0x15, 0xF2, 0xD3, 0x25, 0x2D, 0x23, 0x53, 0xD0, 0x46,
+    0x2C, 0x47, 0x3A, 0x21, 0x28, 0x46, 0x32, 0x56, 0xA4, 0x58, 0x6D, 0x10,
+    0xA6, 0xD0, 0xC8, 0x47, 0x46, 0x3B, 0x34, 0x3D, 0x02, 0x33, 0xD1, 0x32,
+    0x2D, 0x32, 0xF1, 0x2D, 0x42, 0xF0, 0xD9, 0xE3, 0x02, 0xD7, 0x3D, 0x72,
+    0xD7, 0x3D, 0x73, 0xD0, 0x25, 0x47, 0x57, 0xD0, 0xB8, 0x80, 0xD3, 0x9D,
+    0x2C, 0xC4, 0xD8, 0x3C, 0xF0, 0xB2, 0xD0, 0xF0, 0xA2, 0xD6, 0xD4, 0x8D,
+    0x5D, 0x12, 0xD1, 0xE3, 0x09, 0x2D, 0xA3, 0xD2, 0xE3, 0x08, 0x2D, 0x3E,
+    0x40, 0x72, 0xDA, 0x2D, 0x5D, 0x58, 0xD4, 0x90, 0x96, 0xD4, 0x94, 0x55,
+    0x45, 0x42, 0x54, 0x39, 0x21, 0x27, 0x3B, 0x46, 0x3C, 0x46, 0x2D, 0x13,
+    0x4F, 0x01, 0x2D, 0x22, 0x5E, 0x22, 0xD3, 0x25, 0xF2, 0xD2, 0x26, 0x2D,
+    0x13, 0x63, 0xD0, 0x37, 0x2C, 0x38, 0x39, 0x21, 0x29, 0x45, 0x32, 0x2A,
+    0xA3, 0x2C, 0x65, 0x27, 0xE2, 0x0D, 0x22, 0x8F, 0x0D, 0x12, 0xD9, 0x2D,
+    0x83, 0xD0, 0xBD, 0x19, 0xD1, 0x56, 0xD5, 0x5D, 0x1E, 0x30, 0x82, 0xD8,
+    0x2D, 0x92, 0x56, 0xB2, 0x39, 0xA2, 0x22, 0x63, 0x83, 0x12, 0x83, 0x72,
+    0x11, 0xB2, 0x73, 0xC2, 0x1F, 0x06, 0x2D, 0x02, 0x63, 0xD0, 0x21, 0xE2,
+    0x05, 0x2D, 0x03, 0x62, 0xD0, 0x26, 0x2D, 0x12, 0x2F, 0x04, 0x2D, 0x03,
+    0x2F, 0x04, 0x2D, 0x02, 0x62, 0xD1, 0x23, 0xF8, 0x79, 0xD0, 0x3D, 0x32,
+    0x4E, 0x20, 0xC3, 0x4E, 0x30, 0xD6, 0xF0, 0x59, 0xD4, 0x2D, 0x33, 0x5E,
+    0x30, 0xB2, 0xD3, 0x36, 0xE3, 0x0A, 0x2D, 0x33, 0x7E, 0x30, 0x92, 0x8F,
+    0xD6, 0xE2, 0xD4, 0x3D, 0x42, 0xD4, 0x31, 0xE3, 0x0D, 0x7F, 0x06, 0xD1,
+    0xFD, 0x52, 0xE4, 0xD4, 0x21, 0xE3, 0x0D, 0x32, 0xD4, 0x32, 0xE3, 0x0D,
+    0x22, 0xD4, 0x33, 0xE3, 0x0D, 0x12, 0xD4, 0x2D, 0x43, 0xD3, 0x3D, 0x33,
+    0x7C, 0x8A, 0xA0, 0x66, 0xD5, 0x5D, 0x0E, 0x30, 0x92, 0xD0, 0xF0, 0x82,
+    0xD9, 0x26, 0x88, 0x25, 0x98, 0x18, 0x3B, 0x27, 0x2D, 0x02, 0x53, 0xD1,
+    0x24, 0x3D, 0x22, 0x32, 0xD3, 0x22, 0x3D, 0x42, 0x13, 0xD5, 0x7D, 0x43,
+    0x23, 0xD3, 0x24, 0x2D, 0x22, 0x53, 0xD1, 0x26, 0x3D, 0x02, 0x73, 0xC2,
+    0x82, 0xC1, 0xA2, 0xA2, 0xA3, 0x56, 0x89, 0x16, 0x88, 0x20, 0xF7, 0x9D,
+    0x42, 0x3E, 0x30, 0xD0, 0x2D, 0x33, 0x4E, 0x30, 0xC2, 0x5E, 0x40, 0xB2,
+    0x6E, 0x30, 0xA2, 0xD3, 0x37, 0xE3, 0x09, 0x28, 0xFD, 0x60, 0xB4, 0x64,
+    0x64, 0x26, 0x46, 0x54, 0x12, 0x33, 0x13, 0x33, 0x64, 0x55, 0x52, 0x63,
+    0x64, 0x62, 0x62, 0x73, 0x72, 0xE2, 0x52, 0x82, 0x82, 0x52, 0x82, 0x81,
+    0x62, 0x72, 0x82, 0x1E, 0x20, 0x42, 0x82, 0x82, 0x52, 0x81, 0x82, 0x61,
+    0x82, 0x82, 0x2E, 0x20, 0x32, 0x82, 0x82, 0x27, 0x64, 0x5C, 0x55, 0x55,
+    0xD1, 0x58, 0x53, 0x96, 0x52, 0x26, 0x38, 0x58, 0x36, 0x4B, 0x26, 0x3C,
+    0x2F, 0x62, 0xD0, 0x25, 0x3D, 0x02, 0x52, 0xD0, 0x3E, 0x25, 0x2D, 0x02,
+    0x53, 0xD0, 0x21, 0xE3, 0x04, 0x2D, 0x02, 0x53, 0xD0, 0x22, 0x97, 0xD2,
+    0x87, 0xA6, 0xD0, 0xBA, 0x46, 0x47, 0x39, 0x36, 0x2C, 0x34, 0x2D, 0x12,
+    0x32, 0xD3, 0x21, 0x3D, 0x32, 0xF1, 0x2D, 0x42, 0xF0, 0x2D, 0x52, 0xF0,
+    0x2D, 0x42, 0x12, 0xD3, 0x31, 0x2D, 0x32, 0x32, 0xD1, 0x24, 0x3C, 0x26,
+    0x39, 0x37, 0x46, 0x4A, 0xBD, 0x06, 0xA0, 0xD4, 0x7B, 0x63, 0xB9, 0x62,
+    0x36, 0x4B, 0x22, 0x2A, 0x3A, 0x21, 0x2C, 0x2A, 0x4D, 0x03, 0x93, 0xD2,
+    0x29, 0x2D, 0x32, 0x83, 0xD3, 0x2E, 0x28, 0x2D, 0x42, 0x82, 0xD3, 0x28,
+    0x3D, 0x32, 0x83, 0xD2, 0x29, 0x4D, 0x03, 0x94, 0xC3, 0xA2, 0x12, 0xA3,
+    0xA2, 0x24, 0x64, 0xB2, 0x3B, 0xD0, 0x25, 0x79, 0xF0, 0x62, 0xD8, 0xE4,
+    0x05, 0x2D, 0xAB, 0xD4, 0xCD, 0x40, 0x96, 0xD5, 0xA4, 0x55, 0x46, 0x32,
+    0x64, 0x3A, 0x21, 0x27, 0x3C, 0x11, 0x26, 0x3D, 0x04, 0x62, 0xD2, 0x34,
+    0xF0, 0x12, 0xD3, 0x25, 0xE2, 0x2D, 0x42, 0x5F, 0x2D, 0x32, 0x62, 0xD2,
+    0x36, 0x3D, 0x04, 0x72, 0xC2, 0x12, 0x73, 0xA2, 0x12, 0x94, 0x63, 0x22,
+    0xAB, 0x32, 0xC6, 0x62, 0xDB, 0x27, 0xE4, 0x0D, 0x32, 0xDA, 0x29, 0xF0,
+    0x9C, 0x50, 0x57, 0x65, 0x77, 0x49, 0x92, 0x34, 0x52, 0x92, 0x23, 0xD5,
+    0x6D, 0x64, 0xD7, 0x4D, 0x0E, 0x30, 0x82, 0xD9, 0x3D, 0x2E, 0x30, 0x72,
+    0xD9, 0x3D, 0x92, 0xD4, 0xD5, 0x7D, 0x48, 0xA6, 0xCB, 0x12, 0x64, 0x65,
+    0x53, 0xA3, 0x43, 0xC1, 0x1F, 0x04, 0x2D, 0x01, 0x53, 0xD6, 0x3D, 0x5A,
+    0xD1, 0x9D, 0x55, 0xD6, 0x31, 0xF0, 0xD5, 0x21, 0xF0, 0x12, 0xD2, 0x22,
+    0x2D, 0x12, 0x24, 0xB3, 0x36, 0x74, 0x42, 0x1D, 0x0B, 0x78, 0x62, 0x9E,
+    0x30, 0x52, 0xD1, 0x3A, 0xFD, 0x4F, 0x42, 0xBE, 0x30, 0x32, 0xD1, 0x3C,
+    0xE3, 0x02, 0x2D, 0x13, 0xD0, 0xE2, 0x01, 0x2D, 0x22, 0xC2, 0x23, 0x75,
+    0x2D, 0x06, 0x76, 0xF0, 0x68, 0x7E, 0x33, 0x2D, 0x02, 0x42, 0xC2, 0x2E,
+    0x30, 0x22, 0xD0, 0x24, 0x2C, 0x23, 0xE2, 0x01, 0x2D, 0x02, 0x42, 0xC3,
+    0x42, 0xA4, 0x53, 0x82, 0x12, 0x54, 0x44, 0x25, 0x3A, 0x35, 0x55, 0xC0,
+    0x19, 0x6D, 0x76, 0xA3, 0x3D, 0x12, 0x4F, 0x04, 0x2D, 0x02, 0x92, 0xC2,
+    0xA3, 0xA2, 0xC2, 0xA2, 0x7F, 0x05, 0x29, 0x2D, 0x02, 0x82, 0x9F, 0x06,
+    0x26, 0x2D, 0x32, 0x52, 0xD4, 0x24, 0x2D, 0x62, 0x32, 0xD6, 0x22, 0x2D,
+    0x72, 0x12, 0xD8, 0x5D, 0x84, 0xD2, 0xF0, 0x7A, 0x8F, 0x22, 0xD3, 0x25,
+    0x2D, 0x22, 0x62, 0x62, 0x72, 0x62, 0x54, 0x62, 0x62, 0x54, 0x52, 0x72,
+    0x42, 0x12, 0x52, 0x72, 0x42, 0x12, 0x42, 0x82, 0x32, 0x22, 0x42, 0x82,
+    0x32, 0x22, 0x32, 0x92, 0x22, 0x32, 0x32, 0x92, 0x22, 0x42, 0x22, 0x7F,
+    0x02, 0x21, 0x25, 0x21, 0x28, 0xF0, 0x24, 0x64, 0x9F, 0x02, 0x37, 0x3A,
+    0x57, 0x68, 0x48, 0x68, 0x63, 0xC2, 0xA3, 0x93, 0xC3, 0x73, 0xD1, 0x26,
+    0x3D, 0x32, 0x42, 0xD5, 0x31, 0x3D, 0x75, 0xD9, 0x3D, 0x94, 0xD7, 0x31,
+    0x3D, 0x53, 0x33, 0xD3, 0x35, 0x3D, 0x13, 0x73, 0xC2, 0xA2, 0xA3, 0xC2,
+    0x83, 0xD0, 0x35, 0xF8, 0x69, 0x30, 0x67, 0x88, 0x58, 0x88, 0x72, 0xD2,
+    0x2B, 0x2D, 0x12, 0xB2, 0xD0, 0x2C, 0x2C, 0x2D, 0x03, 0xB2, 0xD1, 0x2A,
+    0x26, 0xF0, 0x92, 0x92, 0xD4, 0x27, 0x2D, 0x52, 0x62, 0xD6, 0x25, 0x2D,
+    0x73, 0x42, 0xD8, 0x23, 0x2B, 0xF0, 0xB2, 0x22, 0xDB, 0x4D, 0x0F, 0x0C,
+    0x3D, 0xD2, 0xD2, 0xF0, 0xB2, 0xDD, 0x2D, 0x4F, 0x09, 0x2D, 0xD2, 0xD6,
+    0xD1, 0xD2, 0xD0, 0xD3, 0xF5, 0xD3, 0x42, 0xC2, 0x52, 0xB2, 0x62, 0xA2,
+    0xD5, 0x2D, 0x43, 0xD4, 0x3D, 0x43, 0xD4, 0x3D, 0x43, 0xD4, 0x3D, 0x42,
+    0xD5, 0x2D, 0x52, 0xD5, 0x2B, 0x25, 0x2C, 0x24, 0x2D, 0x01, 0x3F, 0x01,
+    0xD4, 0x30, 0xC3, 0xA5, 0x93, 0xC2, 0x4E, 0x30, 0x82, 0xC3, 0x5E, 0x30,
+    0x72, 0xC2, 0xC3, 0xA4, 0x8F, 0x5D, 0x12, 0x9E, 0x20, 0x52, 0xC3, 0x8E,
+    0x30, 0x42, 0xC3, 0x9E, 0x20, 0x32, 0xD0, 0x3D, 0x04, 0xC3, 0x70, 0xE2,
+    0x72, 0xE4, 0x62, 0x1E, 0x30, 0x52, 0x71, 0x3E, 0x30, 0x42, 0x3E, 0x40,
+    0x32, 0x4E, 0x30, 0x22, 0x71, 0x6E, 0x30, 0x12, 0x71, 0x7E, 0x22, 0x70,
+    0x73, 0xC4, 0xD0, 0x33, 0xE3, 0x0A, 0x23, 0xE4, 0x09, 0x24, 0xF0, 0x82,
+    0xD0, 0x3D, 0x03, 0x3F, 0x0A, 0x58, 0x4A, 0x3C, 0x2C, 0x36, 0xE3, 0x06,
+    0x27, 0xE3, 0x05, 0x2C, 0x2C, 0x39, 0x5A, 0x3C, 0x44, 0xD2, 0x78, 0x21,
+    0x34, 0x36, 0x66, 0x33, 0x41, 0x28, 0x7D, 0x14, 0x50};
+
+const GFXglyph FreeMonoOblique24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 28, 0, 1},          // 0x20 ' '
+    {0, 10, 30, 28, 12, -28},     // 0x21 '!'
+    {27, 16, 14, 28, 10, -28},    // 0x22 '"'
+    {45, 22, 32, 28, 6, -29},     // 0x23 '#'
+    {100, 21, 33, 28, 6, -29},    // 0x24 '$'
+    {151, 22, 29, 28, 6, -27},    // 0x25 '%'
+    {205, 19, 25, 28, 6, -23},    // 0x26 '&'
+    {250, 7, 14, 28, 16, -28},    // 0x27 '''
+    {261, 11, 34, 28, 16, -27},   // 0x28 '('
+    {289, 11, 34, 28, 7, -27},    // 0x29 ')'
+    {316, 18, 17, 28, 10, -28},   // 0x2A '*'
+    {344, 22, 22, 28, 6, -23},    // 0x2B '+'
+    {364, 12, 14, 28, 5, -6},     // 0x2C ','
+    {379, 22, 2, 28, 6, -13},     // 0x2D '-'
+    {383, 7, 6, 28, 11, -4},      // 0x2E '.'
+    {389, 24, 35, 28, 5, -30},    // 0x2F '/'
+    {442, 20, 30, 28, 7, -28},    // 0x30 '0'
+    {490, 17, 29, 28, 6, -28},    // 0x31 '1'
+    {521, 23, 29, 28, 4, -28},    // 0x32 '2'
+    {571, 22, 30, 28, 5, -28},    // 0x33 '3'
+    {612, 19, 28, 28, 7, -27},    // 0x34 '4'
+    {658, 21, 29, 28, 6, -27},    // 0x35 '5'
+    {696, 21, 30, 28, 9, -28},    // 0x36 '6'
+    {748, 18, 28, 28, 10, -27},   // 0x37 '7'
+    {785, 20, 30, 28, 7, -28},    // 0x38 '8'
+    {837, 22, 30, 28, 6, -28},    // 0x39 '9'
+    {892, 10, 21, 28, 11, -19},   // 0x3A ':'
+    {906, 15, 27, 28, 5, -19},    // 0x3B ';'
+    {931, 23, 22, 28, 6, -23},    // 0x3C '<'
+    {965, 25, 9, 28, 4, -17},     // 0x3D '='
+    {972, 24, 22, 28, 4, -23},    // 0x3E '>'
+    {1006, 16, 28, 28, 11, -26},  // 0x3F '?'
+    {1034, 19, 32, 28, 7, -28},   // 0x40 '@'
+    {1091, 27, 26, 28, 1, -25},   // 0x41 'A'
+    {1144, 26, 26, 28, 2, -25},   // 0x42 'B'
+    {1193, 25, 28, 28, 5, -26},   // 0x43 'C'
+    {1237, 26, 26, 28, 2, -25},   // 0x44 'D'
+    {1286, 27, 26, 28, 2, -25},   // 0x45 'E'
+    {1331, 28, 26, 28, 2, -25},   // 0x46 'F'
+    {1371, 25, 28, 28, 5, -26},   // 0x47 'G'
+    {1418, 27, 26, 28, 3, -25},   // 0x48 'H'
+    {1466, 22, 26, 28, 6, -25},   // 0x49 'I'
+    {1488, 28, 27, 28, 5, -25},   // 0x4A 'J'
+    {1529, 29, 26, 28, 2, -25},   // 0x4B 'K'
+    {1587, 25, 26, 28, 3, -25},   // 0x4C 'L'
+    {1621, 32, 26, 28, 1, -25},   // 0x4D 'M'
+    {1697, 30, 26, 28, 2, -25},   // 0x4E 'N'
+    {1764, 24, 28, 28, 5, -26},   // 0x4F 'O'
+    {1817, 26, 26, 28, 2, -25},   // 0x50 'P'
+    {1855, 24, 32, 28, 5, -26},   // 0x51 'Q'
+    {1916, 26, 26, 28, 2, -25},   // 0x52 'R'
+    {1965, 24, 28, 28, 5, -26},   // 0x53 'S'
+    {2019, 24, 26, 28, 7, -25},   // 0x54 'T'
+    {2053, 26, 27, 28, 6, -25},   // 0x55 'U'
+    {2105, 27, 26, 28, 6, -25},   // 0x56 'V'
+    {2158, 27, 26, 28, 6, -25},   // 0x57 'W'
+    {2240, 29, 26, 28, 2, -25},   // 0x58 'X'
+    {2299, 24, 26, 28, 7, -25},   // 0x59 'Y'
+    {2341, 23, 26, 28, 5, -25},   // 0x5A 'Z'
+    {2390, 15, 34, 28, 12, -27},  // 0x5B '['
+    {2421, 10, 35, 28, 12, -30},  // 0x5C '\'
+    {2451, 15, 34, 28, 6, -27},   // 0x5D ']'
+    {2478, 18, 12, 28, 9, -28},   // 0x5E '^'
+    {2501, 28, 2, 28, -1, 5},     // 0x5F '_'
+    {2503, 6, 7, 28, 13, -29},    // 0x60 '`'
+    {2510, 22, 22, 28, 4, -20},   // 0x61 'a'
+    {2550, 27, 29, 28, 1, -27},   // 0x62 'b'
+    {2608, 22, 22, 28, 6, -20},   // 0x63 'c'
+    {2642, 25, 29, 28, 5, -27},   // 0x64 'd'
+    {2700, 22, 22, 28, 5, -20},   // 0x65 'e'
+    {2734, 26, 28, 28, 5, -27},   // 0x66 'f'
+    {2768, 25, 30, 28, 5, -20},   // 0x67 'g'
+    {2825, 24, 28, 28, 3, -27},   // 0x68 'h'
+    {2877, 19, 29, 28, 5, -28},   // 0x69 'i'
+    {2905, 20, 38, 28, 4, -28},   // 0x6A 'j'
+    {2943, 24, 28, 28, 3, -27},   // 0x6B 'k'
+    {2998, 19, 28, 28, 5, -27},   // 0x6C 'l'
+    {3022, 27, 21, 28, 1, -20},   // 0x6D 'm'
+    {3072, 23, 21, 28, 3, -20},   // 0x6E 'n'
+    {3109, 22, 22, 28, 5, -20},   // 0x6F 'o'
+    {3151, 29, 30, 28, -1, -20},  // 0x70 'p'
+    {3210, 26, 30, 28, 5, -20},   // 0x71 'q'
+    {3266, 25, 20, 28, 4, -19},   // 0x72 'r'
+    {3295, 21, 22, 28, 5, -20},   // 0x73 's'
+    {3334, 17, 27, 28, 7, -25},   // 0x74 't'
+    {3363, 21, 21, 28, 6, -19},   // 0x75 'u'
+    {3396, 26, 20, 28, 5, -19},   // 0x76 'v'
+    {3438, 25, 20, 28, 6, -19},   // 0x77 'w'
+    {3492, 26, 20, 28, 3, -19},   // 0x78 'x'
+    {3534, 29, 29, 28, 1, -19},   // 0x79 'y'
+    {3592, 21, 20, 28, 5, -19},   // 0x7A 'z'
+    {3626, 15, 34, 28, 10, -27},  // 0x7B '{'
+    {3659, 9, 35, 28, 12, -28},   // 0x7C '|'
+    {3684, 15, 34, 28, 8, -27},   // 0x7D '}'
+    {3716, 20, 6, 28, 7, -15}};   // 0x7E '~'
+
+const GFXpackedFont FreeMonoOblique24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeMonoOblique24pt7bRLEBitmaps,
+     (GFXglyph *)FreeMonoOblique24pt7bRLEGlyphs, 0x20, 0x7E, 47},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 4402 bytes, glyph bitmaps 3729 bytes (6452 uncompressed)
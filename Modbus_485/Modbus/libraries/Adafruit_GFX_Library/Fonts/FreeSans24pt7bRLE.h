@@ -0,0 +1,390 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeSans24pt7bRLEBitmaps[] PROGMEM = {
+    0xED, 0x60, 0x41, 0x3E, 0x41, 0x21, 0xE2, 0x04, 0xE4, 0x40, 0xE8, 0x04,
+    0x34, 0xE2, 0x12, 0x52, 0x10, 0xF9, 0x36, 0x42, 0xF0, 0x84, 0x63, 0xB4,
+    0x54, 0x3F, 0x08, 0x36, 0x43, 0xF0, 0x74, 0x63, 0x4E, 0x20, 0x1D, 0xAE,
+    0x26, 0x46, 0x35, 0xE2, 0x06, 0x36, 0x45, 0xF0, 0x54, 0x63, 0x6E, 0x2D,
+    0xA1, 0xF0, 0x44, 0x63, 0xB4, 0x54, 0x7F, 0x04, 0x36, 0x47, 0xE2, 0x03,
+    0x46, 0x38, 0xF0, 0x33, 0x64, 0x80, 0xA3, 0xD5, 0x7D, 0x0C, 0xAD, 0x18,
+    0xD3, 0x66, 0x23, 0x25, 0x55, 0x33, 0x34, 0x45, 0x43, 0x44, 0x2E, 0x20,
+    0x14, 0x53, 0x53, 0x2F, 0x01, 0x45, 0x3B, 0x54, 0x3C, 0x53, 0x3C, 0x71,
+    0x3D, 0x0A, 0xD1, 0xD0, 0xCD, 0x0C, 0xCD, 0x0B, 0xC3, 0x36, 0xB3, 0x45,
+    0xB3, 0x55, 0xA3, 0x64, 0xF0, 0x37, 0x36, 0x4F, 0x04, 0x63, 0x64, 0x14,
+    0x53, 0x54, 0x25, 0x43, 0x54, 0x25, 0x43, 0x45, 0x36, 0x23, 0x26, 0x5D,
+    0x47, 0xD1, 0xC9, 0x7E, 0x40, 0xA3, 0xA0, 0xDE, 0x3D, 0x16, 0xD2, 0x4D,
+    0x09, 0xD0, 0x3C, 0xCB, 0x3D, 0x0D, 0x0A, 0x3C, 0x54, 0x59, 0x3C, 0x48,
+    0x48, 0x3C, 0x3A, 0x37, 0x3D, 0x03, 0xA3, 0x64, 0xD0, 0x3A, 0x36, 0x3D,
+    0x13, 0xA3, 0x54, 0xD1, 0x48, 0x45, 0x3D, 0x35, 0x45, 0x54, 0xD4, 0xD0,
+    0x53, 0xD5, 0xC5, 0x4D, 0x6A, 0x63, 0xD9, 0x67, 0x3D, 0xF0, 0x83, 0xDF,
+    0x07, 0x38, 0x6D, 0x93, 0x79, 0xD6, 0x36, 0xCD, 0x44, 0x6D, 0x0D, 0x33,
+    0x65, 0x45, 0xD2, 0x45, 0x48, 0x4D, 0x13, 0x63, 0xA3, 0xD0, 0x46, 0x3A,
+    0x3D, 0x03, 0x73, 0xA3, 0xC4, 0x73, 0xA3, 0xC3, 0x84, 0x84, 0xB3, 0xA5,
+    0x45, 0xC3, 0xBD, 0x0B, 0x3C, 0xCC, 0x3D, 0x19, 0xC3, 0xD3, 0x65, 0x96,
+    0xD7, 0x9D, 0x5B, 0xD3, 0xD0, 0xD2, 0x54, 0x4D, 0x15, 0x64, 0x9E, 0x30,
+    0x44, 0x83, 0xD1, 0x46, 0x4D, 0x15, 0x44, 0xD3, 0x51, 0x5D, 0x59, 0xD6,
+    0x8D, 0x76, 0xD8, 0x8D, 0x5B, 0xD3, 0x53, 0x46, 0x45, 0x55, 0x45, 0x44,
+    0x56, 0x53, 0x54, 0x48, 0x52, 0x44, 0x4A, 0xA4, 0x4B, 0x85, 0x4C, 0x75,
+    0x4C, 0x66, 0x4D, 0x06, 0x55, 0xB8, 0x55, 0x99, 0x57, 0x55, 0x16, 0x5D,
+    0x23, 0x65, 0xD0, 0x56, 0x5B, 0x75, 0x77, 0xD2, 0xE8, 0x04, 0xE2, 0x12,
+    0x10, 0xF7, 0x36, 0x31, 0xF0, 0x53, 0x64, 0x63, 0x64, 0x3F, 0x03, 0x36,
+    0x46, 0x35, 0xE3, 0x01, 0x46, 0x36, 0xEA, 0x47, 0x36, 0xE2, 0x01, 0x47,
+    0x35, 0xF0, 0x24, 0x73, 0x74, 0x3F, 0x04, 0x33, 0xF0, 0x53, 0x83, 0x82,
+    0x83, 0xF0, 0x37, 0xF0, 0x13, 0x83, 0x74, 0x73, 0x74, 0x3F, 0x04, 0x37,
+    0x42, 0xF0, 0x53, 0x2E, 0x20, 0x54, 0x73, 0x1E, 0xA0, 0x64, 0xE3, 0x54,
+    0x63, 0x2F, 0x04, 0x46, 0x36, 0x43, 0xF0, 0x33, 0x4F, 0x02, 0x36, 0x37,
+    0x27, 0x37, 0xE3, 0x62, 0x72, 0x32, 0x32, 0x1F, 0xD1, 0x46, 0x94, 0x96,
+    0x73, 0x23, 0x63, 0x24, 0x43, 0x43, 0x61, 0x41, 0x40, 0xE8, 0xA3, 0xAE,
+    0x3D, 0xAE, 0x8A, 0x3A, 0xE4, 0x04, 0xE3, 0x22, 0x12, 0x13, 0x12, 0x20,
+    0xE3, 0x0B, 0xE4, 0x04, 0xFA, 0x3A, 0x21, 0xF0, 0x93, 0xA2, 0x2F, 0x08,
+    0x32, 0xF0, 0x82, 0x3F, 0x07, 0x3A, 0x24, 0xF0, 0x63, 0x4F, 0x06, 0x2A,
+    0x35, 0xF0, 0x52, 0x6F, 0x04, 0x3A, 0x27, 0xF0, 0x33, 0x7F, 0x03, 0x28,
+    0xF0, 0x23, 0xA2, 0x9F, 0x01, 0x3A, 0x2A, 0xF3, 0xA0, 0x86, 0xD1, 0xAA,
+    0xD1, 0x7D, 0x36, 0x64, 0x65, 0x58, 0x54, 0x4A, 0x43, 0x5A, 0x51, 0xE2,
+    0x01, 0x4C, 0x41, 0xEB, 0x4D, 0x14, 0xE2, 0x14, 0xC4, 0x25, 0xA5, 0x34,
+    0xA4, 0x45, 0x85, 0x55, 0x56, 0x6D, 0x37, 0xD1, 0xAA, 0xD1, 0x68, 0x92,
+    0xF8, 0x37, 0x46, 0x53, 0x8E, 0x20, 0xBE, 0xDA, 0x74, 0x78, 0xCC, 0x8D,
+    0x35, 0xD5, 0x46, 0x67, 0x25, 0xA5, 0x24, 0xCA, 0xC5, 0xE2, 0x04, 0xD1,
+    0x4D, 0x54, 0xFD, 0x45, 0xD3, 0x5D, 0x35, 0xD2, 0x7D, 0x08, 0xC8, 0xD0,
+    0x8C, 0x8D, 0x07, 0xD1, 0x6D, 0x25, 0xD3, 0x5D, 0x43, 0xD5, 0x4D, 0x4F,
+    0x01, 0x3D, 0x5E, 0x3D, 0x90, 0x87, 0xD0, 0xD0, 0x9D, 0x27, 0xD4, 0x56,
+    0x76, 0x45, 0x95, 0x35, 0xB5, 0x1E, 0x20, 0x14, 0xD0, 0x41, 0xF0, 0xD5,
+    0x4D, 0x54, 0xD3, 0x7B, 0xBC, 0x9D, 0x1A, 0xD0, 0xCD, 0x47, 0xD5, 0x5D,
+    0x65, 0xE2, 0xD6, 0x4F, 0x04, 0xD2, 0x9D, 0x05, 0x14, 0xD0, 0x42, 0x5B,
+    0x53, 0x67, 0x64, 0xD6, 0x5D, 0x48, 0xD0, 0xC8, 0x80, 0xD2, 0x3D, 0x64,
+    0xD5, 0x55, 0xF0, 0xC6, 0xD3, 0x7D, 0x28, 0xD1, 0x9D, 0x14, 0x14, 0xD0,
+    0x42, 0x45, 0xF0, 0x74, 0x34, 0xB4, 0x44, 0xA4, 0x54, 0x5F, 0x04, 0x46,
+    0x48, 0x47, 0x47, 0x48, 0x45, 0xF0, 0x14, 0x94, 0x54, 0xA4, 0x5E, 0x3D,
+    0xAE, 0x7D, 0x14, 0x50, 0xE3, 0x3D, 0x42, 0xE6, 0x02, 0x4D, 0x45, 0x27,
+    0x84, 0x1B, 0x6D, 0x45, 0xD5, 0x46, 0x76, 0x34, 0xA6, 0xD4, 0x5D, 0x55,
+    0xE5, 0xD5, 0x8D, 0x19, 0xC4, 0x24, 0xC4, 0x25, 0xA4, 0x37, 0x66, 0x4D,
+    0x46, 0xD2, 0x8D, 0x0C, 0x78, 0x87, 0xD0, 0xBA, 0xD0, 0x8D, 0x26, 0x65,
+    0x64, 0x58, 0x54, 0x4A, 0x53, 0x4B, 0x42, 0x4C, 0x42, 0x4D, 0x53, 0xD5,
+    0x4D, 0x54, 0x47, 0x74, 0x2B, 0x54, 0x1D, 0x13, 0xD7, 0x28, 0x66, 0x26,
+    0xA5, 0x15, 0xC4, 0x15, 0xC5, 0xE3, 0x04, 0xD1, 0x4F, 0x13, 0xD1, 0x41,
+    0x4C, 0x42, 0x5A, 0x53, 0x59, 0x53, 0x66, 0x65, 0xD3, 0x7D, 0x19, 0xCC,
+    0x87, 0xE3, 0x0D, 0x8D, 0x43, 0xD4, 0x4D, 0x34, 0xD4, 0x3D, 0x44, 0xD3,
+    0x4D, 0x43, 0xD4, 0x4D, 0x43, 0xD4, 0x4D, 0x43, 0xD4, 0x4D, 0x43, 0xD4,
+    0x4D, 0x43, 0xD4, 0x4D, 0x43, 0xAF, 0x07, 0x4D, 0x43, 0xBF, 0x06, 0x4D,
+    0x43, 0xCE, 0x20, 0x54, 0xD4, 0x3D, 0x0F, 0x04, 0x4D, 0x00, 0x78, 0xCC,
+    0x9D, 0x17, 0xD3, 0x56, 0x66, 0x35, 0xA4, 0x35, 0xA5, 0x1E, 0x20, 0x14,
+    0xC4, 0x24, 0xB5, 0x34, 0xA4, 0x46, 0x66, 0x5D, 0x38, 0xC9, 0xD1, 0x7D,
+    0x35, 0x66, 0x63, 0x5A, 0x52, 0x4C, 0x41, 0x5C, 0x5E, 0x40, 0x4D, 0x19,
+    0xC5, 0x14, 0xC4, 0x25, 0xA5, 0x36, 0x66, 0x4D, 0x55, 0xD3, 0x8C, 0xC8,
+    0x70, 0x77, 0xCB, 0x9D, 0x07, 0xD2, 0x56, 0x56, 0x35, 0x94, 0x34, 0xA5,
+    0x24, 0xB4, 0x1F, 0x4D, 0x03, 0x1E, 0x34, 0xD0, 0x9B, 0x51, 0x4B, 0x51,
+    0x59, 0x62, 0x65, 0x82, 0xD6, 0x3D, 0x01, 0x44, 0xB2, 0x47, 0x64, 0x4D,
+    0x44, 0xD4, 0x31, 0xF0, 0xD3, 0x42, 0x4B, 0x42, 0x4A, 0x43, 0x58, 0x54,
+    0x56, 0x55, 0xD2, 0x7D, 0x09, 0xBC, 0x78, 0xE4, 0x04, 0xED, 0x14, 0xE4,
+    0x40, 0xE4, 0x04, 0xED, 0x14, 0xE4, 0x4E, 0x32, 0x21, 0x21, 0x31, 0x22,
+    0xDF, 0x0D, 0x23, 0xD5, 0x5D, 0x37, 0xD0, 0x9C, 0x8C, 0x9C, 0x9C, 0x8C,
+    0x9D, 0x07, 0xD3, 0x5D, 0x57, 0xD4, 0x8D, 0x49, 0xD3, 0x9D, 0x48, 0xD4,
+    0x9D, 0x39, 0xD4, 0x8D, 0x46, 0xD7, 0x3D, 0x91, 0xE3, 0x0D, 0xAE, 0x3D,
+    0xAE, 0x3D, 0xA0, 0x01, 0xD9, 0x3D, 0x76, 0xD4, 0x8D, 0x48, 0xD4, 0x9D,
+    0x39, 0xD4, 0x8D, 0x49, 0xD4, 0x8D, 0x47, 0xD5, 0x5D, 0x46, 0xD2, 0x8C,
+    0x8D, 0x08, 0xC9, 0xC8, 0xC9, 0xC9, 0xD1, 0x6D, 0x44, 0xD6, 0x2D, 0x80,
+    0x67, 0xBC, 0x7D, 0x15, 0xD3, 0x36, 0x57, 0x24, 0x95, 0x24, 0xA5, 0xE3,
+    0x04, 0xC4, 0xD2, 0x5D, 0x24, 0xD2, 0x5D, 0x15, 0xD1, 0x5D, 0x06, 0xD0,
+    0x6D, 0x15, 0xD1, 0x5D, 0x15, 0x8E, 0x40, 0x74, 0x9E, 0x30, 0xD7, 0xE4,
+    0x07, 0x49, 0xD5, 0x9D, 0xF0, 0x2D, 0x4D, 0xBD, 0x8D, 0x8D, 0xBD, 0x49,
+    0x8A, 0xD2, 0x7D, 0x18, 0xD0, 0x6D, 0x57, 0xB5, 0xD9, 0x69, 0x5D, 0xB6,
+    0x75, 0xDD, 0x66, 0x4B, 0x6B, 0x55, 0x4A, 0x93, 0x44, 0x53, 0x58, 0xC2,
+    0x45, 0x43, 0x48, 0x64, 0x95, 0x51, 0x57, 0x57, 0x76, 0x51, 0x47, 0x59,
+    0x67, 0x41, 0x47, 0x4A, 0x67, 0x41, 0x46, 0x4B, 0x58, 0x4F, 0x04, 0x74,
+    0xB5, 0x88, 0x64, 0xC4, 0x98, 0x64, 0xC4, 0x89, 0x64, 0xB5, 0x84, 0x14,
+    0x64, 0xB4, 0x94, 0x14, 0x64, 0xB4, 0x84, 0x24, 0x64, 0xA5, 0x75, 0x25,
+    0x55, 0x85, 0x84, 0x44, 0x65, 0x66, 0x75, 0x44, 0x66, 0x48, 0x46, 0x55,
+    0x6C, 0x1D, 0x07, 0x47, 0x93, 0xB9, 0x58, 0x57, 0x7C, 0x5D, 0xF0, 0xA6,
+    0xDF, 0x0A, 0x6D, 0xF0, 0xA7, 0xDF, 0x09, 0x7D, 0xF0, 0x99, 0xA5, 0xD8,
+    0xD9, 0xD9, 0xD9, 0xDA, 0xD5, 0xDF, 0x01, 0xAD, 0x40, 0xC6, 0xCF, 0x0B,
+    0x7D, 0xA8, 0xD8, 0x9B, 0xF0, 0xA4, 0x15, 0xD6, 0x52, 0x4A, 0xF0, 0x94,
+    0x35, 0xD4, 0x54, 0x4D, 0x44, 0x55, 0xD2, 0x55, 0x5D, 0x24, 0x74, 0xD2,
+    0x47, 0x5D, 0x05, 0x75, 0xD0, 0x49, 0x4D, 0x04, 0x95, 0xB5, 0x95, 0xB4,
+    0xB4, 0xBD, 0x79, 0xD8, 0x9D, 0x97, 0xDA, 0x75, 0xD0, 0x57, 0x4D, 0x25,
+    0x3F, 0x02, 0x5D, 0x25, 0x54, 0xD4, 0x52, 0xF0, 0x15, 0xD4, 0x53, 0x4D,
+    0x65, 0x15, 0xD6, 0x51, 0x5D, 0x74, 0x10, 0x0D, 0x48, 0xD6, 0x6F, 0xD8,
+    0x44, 0xC6, 0x34, 0xD1, 0x43, 0x4D, 0x15, 0x2E, 0x34, 0xD2, 0x42, 0xF4,
+    0xD1, 0x43, 0x4C, 0x54, 0xD7, 0x5D, 0x66, 0xD8, 0x4D, 0x93, 0x4D, 0x15,
+    0x24, 0xD2, 0x51, 0x4D, 0x34, 0x1E, 0x54, 0xD4, 0x8D, 0x39, 0xD2, 0x51,
+    0x4D, 0x16, 0x1D, 0xA2, 0xD9, 0x3D, 0x84, 0xD6, 0x60, 0xB8, 0xD5, 0xD1,
+    0xD1, 0xD4, 0xAD, 0x78, 0x78, 0x68, 0x5C, 0x56, 0x5D, 0x15, 0x45, 0xD3,
+    0x44, 0x4D, 0x44, 0x35, 0xD5, 0x42, 0x4D, 0x64, 0x1F, 0x01, 0x4D, 0xBE,
+    0x94, 0xDC, 0xF0, 0x14, 0xD7, 0x41, 0x4D, 0x65, 0x15, 0xD5, 0x43, 0x4D,
+    0x54, 0x35, 0xD3, 0x54, 0x5D, 0x15, 0x65, 0xC6, 0x68, 0x77, 0x8D, 0x7B,
+    0xD4, 0xD0, 0xD1, 0xD5, 0x8A, 0x0D, 0x4A, 0xD7, 0x7D, 0x86, 0xD9, 0x54,
+    0xC7, 0x44, 0xD1, 0x63, 0x4D, 0x26, 0x24, 0xD3, 0x52, 0x4D, 0x45, 0x1E,
+    0x24, 0xD5, 0x41, 0xE9, 0x4D, 0x64, 0xE2, 0x04, 0xD5, 0x41, 0x4D, 0x45,
+    0x14, 0xD3, 0x52, 0x4D, 0x26, 0x24, 0xD1, 0x63, 0x4C, 0x74, 0xD9, 0x5D,
+    0x86, 0xD7, 0x7D, 0x4A, 0xE3, 0x0D, 0xA1, 0xEA, 0x4D, 0x7E, 0x3D, 0xA1,
+    0xEA, 0x4D, 0x7E, 0x3D, 0xB0, 0xE3, 0x0D, 0x9E, 0xA0, 0x4D, 0x5E, 0x3D,
+    0x72, 0xED, 0x14, 0xD5, 0xC9, 0xD6, 0xD2, 0xD1, 0xD6, 0xBD, 0x89, 0x88,
+    0x77, 0x6D, 0x06, 0x56, 0xD3, 0x54, 0x5D, 0x54, 0x35, 0xD6, 0x52, 0x4D,
+    0x84, 0x15, 0xDC, 0xF0, 0x14, 0xDD, 0x5D, 0xDE, 0x24, 0xDE, 0xE3, 0x4D,
+    0x0D, 0x5D, 0xA9, 0xD9, 0x4F, 0x14, 0xD9, 0x4F, 0x15, 0xD7, 0x52, 0x5D,
+    0x56, 0x26, 0xD4, 0x63, 0x6D, 0x27, 0x46, 0xC9, 0x58, 0x76, 0x14, 0x6D,
+    0x62, 0x47, 0xD4, 0x43, 0x9D, 0x06, 0x3C, 0x8B, 0xED, 0x10, 0x4D, 0x54,
+    0xE3, 0x0D, 0xDE, 0xD1, 0x04, 0xD5, 0x40, 0xED, 0xF0, 0x4E, 0x40, 0x40,
+    0xED, 0x9D, 0x24, 0xE3, 0x04, 0xB8, 0xAA, 0x95, 0x14, 0x85, 0x26, 0x56,
+    0x3D, 0x24, 0xD1, 0x7B, 0xA7, 0x60, 0x04, 0xD4, 0x51, 0x4D, 0x35, 0x24,
+    0xD2, 0x53, 0x4D, 0x15, 0x44, 0xD0, 0x55, 0x4C, 0x56, 0x4B, 0x57, 0x4A,
+    0x58, 0x49, 0x59, 0x48, 0x5A, 0x47, 0x5B, 0x46, 0x5C, 0x45, 0x5D, 0x04,
+    0x45, 0xD1, 0x43, 0x6D, 0x14, 0x28, 0xD0, 0x41, 0xAC, 0x91, 0x5C, 0x83,
+    0x5B, 0x75, 0x5A, 0x66, 0x5A, 0x58, 0x59, 0x4A, 0x58, 0x4A, 0x67, 0x4B,
+    0x57, 0x4C, 0x56, 0x4C, 0x65, 0x4D, 0x05, 0x54, 0xD1, 0x54, 0xF4, 0xD2,
+    0x53, 0x4D, 0x35, 0x24, 0xD4, 0x51, 0x4D, 0x46, 0xED, 0xF0, 0x4D, 0x44,
+    0xD4, 0xE3, 0xD8, 0xF0, 0x6D, 0x76, 0xE2, 0x07, 0xD5, 0x7F, 0x08, 0xD3,
+    0xC1, 0x3D, 0x33, 0x14, 0xF0, 0x41, 0x4D, 0x14, 0x18, 0x24, 0xD0, 0x32,
+    0x4F, 0x04, 0x24, 0xC4, 0x28, 0x34, 0xB3, 0x34, 0xF0, 0x43, 0x4A, 0x43,
+    0x4E, 0x20, 0x44, 0x48, 0x44, 0x4E, 0x20, 0x45, 0x46, 0x45, 0x4E, 0x20,
+    0x46, 0x44, 0x46, 0x4F, 0x04, 0x74, 0x24, 0x78, 0x83, 0x24, 0x74, 0xF0,
+    0x48, 0x88, 0x89, 0x78, 0x4F, 0x04, 0x96, 0x98, 0xA5, 0x94, 0x05, 0xD4,
+    0x4F, 0x06, 0xD3, 0x4F, 0x07, 0xD2, 0xCD, 0x1D, 0x0D, 0x08, 0x14, 0xD0,
+    0x81, 0x5C, 0x82, 0x5B, 0x83, 0x4B, 0x83, 0x5A, 0x84, 0x4A, 0x84, 0x59,
+    0x85, 0x58, 0x86, 0x48, 0x86, 0x57, 0x87, 0x56, 0x88, 0x46, 0x88, 0x55,
+    0x89, 0x45, 0x89, 0x54, 0x8A, 0x53, 0x8B, 0x43, 0x8B, 0x52, 0x8C, 0x51,
+    0x8D, 0x04, 0x18, 0xD0, 0x9F, 0x04, 0xD1, 0xCD, 0x27, 0xF0, 0x4D, 0x3A,
+    0xD4, 0x50, 0xC9, 0xD8, 0xD2, 0xD3, 0xD6, 0xD0, 0xD8, 0xB8, 0x78, 0x96,
+    0xD0, 0x67, 0x6D, 0x26, 0x65, 0xD4, 0x55, 0x5D, 0x65, 0x44, 0xD8, 0x43,
+    0x5D, 0x85, 0x1F, 0x01, 0x4D, 0xA4, 0x15, 0xDA, 0x5E, 0x70, 0x4D, 0xC8,
+    0xDB, 0x5F, 0x14, 0xDA, 0x42, 0x5D, 0x85, 0x34, 0xD8, 0x44, 0x5D, 0x65,
+    0x55, 0xD4, 0x56, 0x6D, 0x26, 0x76, 0xD0, 0x69, 0x87, 0x8B, 0xD8, 0xD0,
+    0xD6, 0xD3, 0xD2, 0xD8, 0x9C, 0x0D, 0x47, 0xD7, 0x4D, 0x83, 0xD9, 0x24,
+    0xC7, 0x14, 0xD1, 0x51, 0x4D, 0x25, 0xE5, 0x04, 0xD3, 0x8D, 0x29, 0xD1,
+    0x51, 0x4C, 0x71, 0xD9, 0x2D, 0x83, 0xD7, 0x4D, 0x56, 0xED, 0x04, 0xD7,
+    0xC9, 0xD8, 0xD2, 0xD3, 0xD5, 0xD1, 0xD8, 0xB8, 0x78, 0x96, 0xD0, 0x67,
+    0x6D, 0x26, 0x65, 0xD4, 0x55, 0x5D, 0x65, 0x44, 0xD8, 0x43, 0x5D, 0x85,
+    0x1F, 0x01, 0x4D, 0xA4, 0x15, 0xDA, 0x5E, 0x70, 0x4D, 0xC8, 0xDB, 0x5F,
+    0x14, 0xDA, 0x42, 0x5D, 0x85, 0x34, 0xD1, 0x34, 0x44, 0x5C, 0x52, 0x55,
+    0x5C, 0xA6, 0x6C, 0x97, 0x6C, 0x79, 0x87, 0x9A, 0xDB, 0xAD, 0xBB, 0xD2,
+    0x35, 0xD0, 0x97, 0x4D, 0xF0, 0x23, 0xDF, 0x03, 0x12, 0x0D, 0x67, 0xD8,
+    0x5D, 0x94, 0xDA, 0x34, 0xD1, 0x62, 0x4D, 0x25, 0x24, 0xD3, 0x51, 0xE5,
+    0x4D, 0x44, 0x14, 0xD3, 0x42, 0x4D, 0x25, 0x24, 0xD1, 0x53, 0xD9, 0x4D,
+    0x85, 0xD9, 0x4D, 0xA3, 0x4D, 0x16, 0x24, 0xD3, 0x42, 0x4D, 0x35, 0x1E,
+    0x84, 0xD4, 0x41, 0xF4, 0xD4, 0x50, 0x99, 0xD2, 0xD2, 0xBD, 0x48, 0xD8,
+    0x66, 0x87, 0x55, 0xD0, 0x54, 0x4D, 0x24, 0x35, 0xD2, 0x51, 0xF0, 0x14,
+    0xD4, 0x41, 0xF0, 0x14, 0xDA, 0x5D, 0xA6, 0xD8, 0x8D, 0x7B, 0xD4, 0xD1,
+    0xD2, 0xD2, 0xD2, 0xD1, 0xD4, 0xBD, 0x78, 0xD8, 0x7D, 0x95, 0xDA, 0x5D,
+    0xA4, 0xE2, 0x04, 0xD6, 0x41, 0x4D, 0x45, 0x15, 0xD3, 0x42, 0x6D, 0x15,
+    0x38, 0x87, 0x5D, 0x87, 0xD6, 0xAD, 0x2D, 0x29, 0x90, 0xE3, 0x0D, 0xDE,
+    0xDF, 0xB4, 0xD9, 0x4B, 0xED, 0xC0, 0x4D, 0x58, 0xD4, 0x51, 0x4D, 0x34,
+    0x25, 0xD1, 0x52, 0x6C, 0x63, 0x78, 0x75, 0xD7, 0x7D, 0x5A, 0xD1, 0xD1,
+    0x99, 0x05, 0xD6, 0x41, 0x5D, 0x55, 0x24, 0xD5, 0x52, 0x5D, 0x44, 0x35,
+    0xD3, 0x54, 0x4D, 0x35, 0x45, 0xD2, 0x45, 0x5D, 0x15, 0x64, 0xD1, 0x56,
+    0x5D, 0x04, 0x75, 0xC5, 0x84, 0xC5, 0x85, 0xB4, 0x5F, 0x05, 0x4A, 0x5A,
+    0x59, 0x4C, 0x49, 0x4C, 0x57, 0x5C, 0x57, 0x4D, 0x14, 0x74, 0x7F, 0x07,
+    0x55, 0x4D, 0x34, 0x54, 0xD3, 0x53, 0x49, 0xF0, 0x94, 0x34, 0xD5, 0x51,
+    0x4A, 0xF0, 0xA4, 0x14, 0xD7, 0x8B, 0xF0, 0xB7, 0xD9, 0x6D, 0xB5, 0xC0,
+    0xE2, 0x05, 0xD0, 0x6D, 0x05, 0x14, 0xD0, 0x6D, 0x04, 0x1E, 0x20, 0x15,
+    0xB8, 0xB5, 0x34, 0xB9, 0xA4, 0x2E, 0x20, 0x25, 0x94, 0x24, 0x95, 0x54,
+    0x85, 0x34, 0x84, 0x65, 0x74, 0x44, 0x84, 0x65, 0x74, 0x44, 0x75, 0x74,
+    0x74, 0x44, 0x75, 0x74, 0x65, 0x54, 0x64, 0x85, 0x54, 0x64, 0x64, 0x85,
+    0x54, 0x64, 0x55, 0x94, 0x54, 0x65, 0x45, 0x4F, 0x05, 0x44, 0x48, 0x44,
+    0x4A, 0x53, 0x48, 0x44, 0x4B, 0x42, 0x59, 0x42, 0x55, 0xF0, 0x64, 0x24,
+    0xA4, 0x24, 0xC5, 0x14, 0xA5, 0x14, 0xD0, 0x9B, 0x96, 0xF0, 0x78, 0xC8,
+    0xD1, 0x8D, 0x07, 0xD2, 0x6D, 0x17, 0x7F, 0x08, 0x6D, 0x16, 0xD3, 0x6D,
+    0x25, 0x80, 0x15, 0xD4, 0x52, 0x6D, 0x26, 0x35, 0xD2, 0x55, 0x5D, 0x05,
+    0x3F, 0x04, 0x5B, 0x59, 0x59, 0x55, 0xF0, 0x65, 0x75, 0xD0, 0x55, 0x57,
+    0xF0, 0x85, 0x35, 0xD4, 0x51, 0x59, 0xF0, 0xA9, 0xD8, 0x7D, 0xA5, 0xDA,
+    0x7D, 0x88, 0xD8, 0x9D, 0x65, 0x15, 0xD4, 0x53, 0x4D, 0x45, 0x35, 0xD2,
+    0x55, 0x57, 0xF0, 0x65, 0x75, 0xB5, 0x95, 0x95, 0xA6, 0x85, 0xB5, 0x75,
+    0xD0, 0x55, 0x5D, 0x16, 0x36, 0xD2, 0x53, 0x5D, 0x45, 0x15, 0xD5, 0x60,
+    0x06, 0xD5, 0x61, 0x5D, 0x55, 0x26, 0xD3, 0x54, 0x5D, 0x35, 0x55, 0xD1,
+    0x56, 0x5D, 0x05, 0x85, 0xC5, 0x4F, 0x05, 0x5A, 0x5B, 0x58, 0x5D, 0x04,
+    0x84, 0xD1, 0x56, 0x5D, 0x25, 0x45, 0xD3, 0x54, 0x4D, 0x55, 0x25, 0xD6,
+    0x42, 0x4D, 0x7A, 0xD8, 0x8B, 0xF0, 0xC6, 0xCE, 0xD0, 0x0D, 0x04, 0xD0,
+    0xE3, 0x2D, 0xBD, 0x95, 0xD8, 0x5D, 0x86, 0xD7, 0x6D, 0x76, 0xD8, 0x5D,
+    0x85, 0xD8, 0x6D, 0x76, 0xD7, 0x6D, 0x85, 0xD8, 0x5D, 0x86, 0xD7, 0x6D,
+    0x76, 0xD8, 0x5D, 0x85, 0xD8, 0x6D, 0x76, 0xD8, 0x5D, 0x85, 0xD8, 0x5D,
+    0x86, 0xD7, 0x6D, 0x85, 0xD8, 0x5D, 0x8E, 0x3D, 0xE0, 0xE3, 0x08, 0xED,
+    0xF0, 0x44, 0xE6, 0x44, 0xE3, 0x80, 0xF0, 0x3B, 0x2A, 0xF0, 0x13, 0xB2,
+    0x9F, 0x02, 0x38, 0xF0, 0x32, 0x8F, 0x03, 0x3B, 0x27, 0xF0, 0x43, 0x6F,
+    0x05, 0x2B, 0x35, 0xF0, 0x62, 0x5F, 0x06, 0x3B, 0x24, 0xF0, 0x73, 0x3F,
+    0x08, 0x23, 0xF0, 0x83, 0xB2, 0x2F, 0x09, 0x3B, 0x21, 0xF0, 0xA3, 0xE3,
+    0x08, 0xED, 0xF4, 0x4E, 0x64, 0x4E, 0x30, 0x80, 0xF7, 0x47, 0xF0, 0x66,
+    0xB8, 0x5F, 0x05, 0x32, 0x39, 0x43, 0x38, 0x34, 0x37, 0x44, 0x43, 0xF0,
+    0x33, 0x63, 0x3F, 0x02, 0x38, 0x33, 0x48, 0x41, 0xF0, 0x13, 0xA3, 0x13,
+    0xC3, 0xF0, 0xDF, 0x06, 0x64, 0x74, 0x74, 0x73, 0x83, 0x83, 0x79, 0xCD,
+    0x19, 0xD3, 0x7D, 0x55, 0x67, 0x74, 0x5A, 0x54, 0x4C, 0x43, 0xE2, 0x0D,
+    0x44, 0xD6, 0x5D, 0x47, 0xBD, 0x07, 0xD4, 0x5D, 0x02, 0x44, 0x88, 0x43,
+    0x6B, 0x43, 0x5C, 0x43, 0x4D, 0x04, 0x3F, 0x4C, 0x53, 0x59, 0x74, 0x65,
+    0x94, 0xD2, 0x17, 0x2D, 0x03, 0x63, 0xB4, 0x65, 0x68, 0x50, 0xE7, 0x04,
+    0xD5, 0x45, 0x67, 0x43, 0xA5, 0x41, 0xD0, 0x44, 0x1D, 0x13, 0x85, 0x72,
+    0x78, 0x52, 0x6A, 0x51, 0xF5, 0xC4, 0x15, 0xC5, 0xE6, 0x04, 0xD1, 0x8D,
+    0x05, 0xF0, 0x5C, 0x41, 0x6A, 0x51, 0x78, 0x52, 0x85, 0x72, 0x31, 0xD2,
+    0x33, 0x2D, 0x04, 0x33, 0xBD, 0x07, 0x70, 0x87, 0xBC, 0x8D, 0x16, 0xD3,
+    0x46, 0x66, 0x35, 0x85, 0x25, 0xA4, 0x24, 0xC4, 0x14, 0xD3, 0x5D, 0x3E,
+    0x74, 0xD4, 0xF0, 0x14, 0xC4, 0x15, 0xA5, 0x25, 0x85, 0x36, 0x66, 0x4D,
+    0x36, 0xD1, 0x8C, 0xB7, 0x70, 0xE7, 0xD6, 0x47, 0x75, 0x45, 0xB3, 0x44,
+    0xD1, 0x14, 0x3D, 0x72, 0x75, 0x92, 0x59, 0x71, 0x5B, 0x61, 0x5C, 0x51,
+    0x4D, 0x0A, 0xD0, 0x5E, 0x60, 0x4D, 0x29, 0xD0, 0x5F, 0x14, 0xD0, 0x51,
+    0x5B, 0x62, 0x59, 0x72, 0x75, 0x93, 0xD3, 0x13, 0x4D, 0x12, 0x35, 0xC3,
+    0x37, 0x88, 0x87, 0xD0, 0xB9, 0xD1, 0x7D, 0x36, 0x65, 0x64, 0x58, 0x53,
+    0x5A, 0x51, 0xF0, 0x14, 0xC4, 0x1E, 0x24, 0xD1, 0x4E, 0x20, 0xD9, 0xE2,
+    0x04, 0xD6, 0x4D, 0x54, 0xC4, 0x25, 0xB4, 0x35, 0x95, 0x36, 0x66, 0x5D,
+    0x37, 0xD2, 0x8C, 0xD0, 0x77, 0x64, 0xF4, 0x63, 0x73, 0x52, 0xE3, 0x03,
+    0x43, 0xE2, 0xAE, 0xD8, 0x34, 0x30, 0x86, 0xD0, 0xA3, 0x44, 0xD0, 0x14,
+    0x3D, 0x62, 0x75, 0x82, 0x58, 0x71, 0x5A, 0x6F, 0x14, 0xCA, 0xD0, 0x4E,
+    0x70, 0x4D, 0x14, 0xF1, 0x4C, 0x51, 0x5A, 0x62, 0x58, 0x72, 0x75, 0x83,
+    0xD1, 0x14, 0x4C, 0x24, 0x5A, 0x34, 0x76, 0x54, 0xD5, 0x4D, 0x44, 0x24,
+    0xC4, 0x25, 0xA5, 0x35, 0x76, 0x4D, 0x55, 0xD3, 0x7D, 0x1B, 0x87, 0xE7,
+    0x04, 0xD2, 0x44, 0x74, 0x43, 0x93, 0x42, 0xC1, 0x41, 0xD0, 0x18, 0x4D,
+    0x08, 0xB9, 0x4F, 0x05, 0xA4, 0xED, 0x30, 0x4B, 0x40, 0xE4, 0x04, 0xE3,
+    0x4E, 0xDB, 0x40, 0xE4, 0x44, 0xE3, 0x8E, 0xDF, 0x04, 0x44, 0x43, 0xD0,
+    0xF0, 0x71, 0x53, 0xE8, 0x04, 0xD4, 0x4A, 0x52, 0x49, 0x53, 0x48, 0x54,
+    0x47, 0x55, 0x46, 0x56, 0x45, 0x57, 0x44, 0x58, 0x43, 0x59, 0x42, 0x5A,
+    0x41, 0x6A, 0xC9, 0xD0, 0x87, 0x15, 0x86, 0x35, 0x75, 0x55, 0x64, 0x65,
+    0x64, 0x75, 0x54, 0x84, 0x54, 0x85, 0x4F, 0x49, 0x53, 0x4A, 0x52, 0x4B,
+    0x42, 0x4B, 0x51, 0x4C, 0x50, 0xED, 0xF0, 0x4E, 0x40, 0x40, 0x86, 0x86,
+    0x43, 0x39, 0x5A, 0x23, 0x2B, 0x3C, 0x13, 0x1D, 0x01, 0xD0, 0x17, 0x59,
+    0x5C, 0x77, 0x75, 0xF0, 0x59, 0x59, 0x4E, 0xD4, 0x04, 0xA4, 0xA4, 0x96,
+    0x53, 0x4A, 0x33, 0x2D, 0x02, 0x31, 0xD2, 0x13, 0x14, 0x5D, 0x18, 0xB9,
+    0x5F, 0x05, 0xB4, 0xED, 0x30, 0x4C, 0x40, 0x87, 0xD1, 0xBA, 0xD2, 0x7D,
+    0x45, 0x75, 0x74, 0x59, 0x53, 0x5B, 0x51, 0xF0, 0x14, 0xD0, 0x41, 0x5D,
+    0x05, 0xE6, 0x04, 0xD2, 0x9D, 0x05, 0xF1, 0x4D, 0x04, 0x25, 0xB5, 0x35,
+    0x95, 0x47, 0x57, 0x5D, 0x47, 0xD2, 0x9D, 0x0D, 0x07, 0x80, 0x87, 0x73,
+    0x3B, 0x53, 0x2D, 0x04, 0x31, 0xD2, 0x39, 0x47, 0x27, 0x85, 0x26, 0xA5,
+    0x1F, 0x5C, 0x41, 0x5C, 0x5E, 0x60, 0x4D, 0x18, 0xD0, 0x5F, 0x05, 0xC4,
+    0x16, 0xA5, 0x17, 0x85, 0x28, 0x57, 0x2D, 0x63, 0x41, 0xD0, 0x44, 0x3A,
+    0x54, 0x56, 0x7E, 0x74, 0xD5, 0x87, 0xD1, 0xB3, 0x34, 0xD1, 0x23, 0x3D,
+    0x31, 0x32, 0x75, 0x92, 0x59, 0x71, 0x5B, 0x61, 0x5C, 0x51, 0x4D, 0x0A,
+    0xD0, 0x5E, 0x60, 0x4D, 0x29, 0xD0, 0x5F, 0x14, 0xD0, 0x51, 0x5B, 0x62,
+    0x59, 0x72, 0x75, 0x93, 0xD2, 0x14, 0x4D, 0x11, 0x45, 0xB3, 0x47, 0x75,
+    0x4E, 0x7D, 0x64, 0x87, 0x48, 0x2A, 0x1D, 0x43, 0x66, 0xE2, 0x57, 0xED,
+    0x34, 0x80, 0x77, 0xAC, 0x7D, 0x15, 0xD3, 0x45, 0x66, 0x25, 0x85, 0x24,
+    0xA4, 0x1F, 0x01, 0x4D, 0x35, 0xD2, 0x6D, 0x28, 0xD0, 0xBA, 0xD0, 0x9C,
+    0xC9, 0xD2, 0x6D, 0x25, 0xD3, 0x4F, 0x04, 0xC9, 0xA5, 0x16, 0x66, 0x2D,
+    0x53, 0xD3, 0x5D, 0x0A, 0x86, 0xE5, 0x34, 0x3E, 0x2A, 0xED, 0x53, 0x43,
+    0xF0, 0x37, 0x46, 0x55, 0xED, 0x30, 0x4C, 0x4F, 0x04, 0xB9, 0xAB, 0x8D,
+    0x15, 0x81, 0xD2, 0x13, 0x1D, 0x12, 0x33, 0xB3, 0x35, 0x69, 0x14, 0xD0,
+    0x51, 0x4D, 0x04, 0x25, 0xC4, 0x34, 0xB5, 0x34, 0xB4, 0x45, 0xA4, 0x2F,
+    0x03, 0x49, 0x46, 0x57, 0x53, 0xF0, 0x44, 0x74, 0x85, 0x55, 0x4F, 0x05,
+    0x45, 0x4A, 0x53, 0x46, 0xF0, 0x64, 0x34, 0x6F, 0x07, 0x41, 0x4D, 0x14,
+    0x13, 0x8F, 0x08, 0x7D, 0x36, 0x9F, 0x09, 0x59, 0x05, 0x95, 0xA4, 0x1F,
+    0x01, 0x49, 0x69, 0x42, 0x58, 0x68, 0x53, 0x47, 0x78, 0x42, 0xF0, 0x24,
+    0x78, 0x74, 0x54, 0x63, 0x14, 0x64, 0x64, 0x54, 0x23, 0x64, 0x3F, 0x03,
+    0x45, 0x42, 0x45, 0x47, 0x44, 0x33, 0x44, 0x48, 0x43, 0x44, 0x34, 0x48,
+    0x43, 0x44, 0x43, 0x49, 0x33, 0x44, 0x43, 0x3A, 0x42, 0x35, 0x42, 0x4A,
+    0x41, 0x46, 0x32, 0x4A, 0x41, 0x46, 0x41, 0x4B, 0x31, 0x46, 0x41, 0x3C,
+    0x77, 0x8C, 0x78, 0x76, 0xF0, 0x76, 0x86, 0xD1, 0x59, 0x6D, 0x15, 0xA4,
+    0x80, 0x15, 0xB4, 0x34, 0xA5, 0x44, 0x94, 0x55, 0x74, 0x74, 0x65, 0x84,
+    0x54, 0x95, 0x34, 0xB4, 0x25, 0xC4, 0x14, 0xD0, 0x8D, 0x26, 0x8F, 0x09,
+    0x5D, 0x36, 0xD3, 0x7D, 0x19, 0xC4, 0x24, 0xC4, 0x34, 0xA4, 0x45, 0x85,
+    0x54, 0x84, 0x65, 0x64, 0x85, 0x45, 0x94, 0x35, 0xA5, 0x24, 0xC5, 0x14,
+    0xD0, 0x41, 0x4C, 0x51, 0x4C, 0x43, 0x4B, 0x41, 0xF0, 0x24, 0xA4, 0x54,
+    0x94, 0x2F, 0x03, 0x48, 0x47, 0x47, 0x43, 0xF0, 0x44, 0x64, 0x94, 0x45,
+    0x4F, 0x05, 0x44, 0x45, 0xE2, 0x06, 0x42, 0x46, 0xE2, 0x07, 0x87, 0xF0,
+    0x86, 0xD3, 0x59, 0xF0, 0x94, 0x9F, 0x08, 0x4D, 0x45, 0xD4, 0x4D, 0x45,
+    0xBF, 0x02, 0x8D, 0x17, 0xD3, 0x4D, 0x20, 0xE3, 0x1D, 0x6D, 0x24, 0xD2,
+    0x5D, 0x15, 0xD1, 0x5D, 0x15, 0xD1, 0x5D, 0x15, 0xD2, 0x4D, 0x25, 0xD1,
+    0x5D, 0x15, 0xD1, 0x5D, 0x15, 0xD1, 0x5D, 0x15, 0xD2, 0x4D, 0x25, 0xD1,
+    0xE3, 0xD7, 0x74, 0xF5, 0x64, 0x43, 0xED, 0x00, 0x43, 0x74, 0x64, 0x55,
+    0x6F, 0x47, 0x58, 0x48, 0x35, 0xED, 0x00, 0x43, 0x84, 0x3F, 0x05, 0x67,
+    0x40, 0xED, 0xF0, 0x3E, 0xD1, 0x03, 0x04, 0x7F, 0x68, 0x44, 0xED, 0x00,
+    0x43, 0x93, 0x84, 0x85, 0xF7, 0x46, 0x55, 0x47, 0x33, 0xED, 0x00, 0x43,
+    0x74, 0x4F, 0x65, 0x47, 0x25, 0xD0, 0x88, 0x21, 0x97, 0x54, 0x54, 0x56,
+    0xA1, 0x28, 0x8D, 0x05, 0x20};
+
+const GFXglyph FreeSans24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 12, 0, 1},         // 0x20 ' '
+    {0, 4, 34, 16, 6, -33},      // 0x21 '!'
+    {10, 11, 12, 16, 2, -32},    // 0x22 '"'
+    {17, 24, 33, 26, 1, -31},    // 0x23 '#'
+    {66, 23, 41, 26, 1, -34},    // 0x24 '$'
+    {139, 39, 34, 42, 1, -32},   // 0x25 '%'
+    {239, 28, 34, 31, 2, -32},   // 0x26 '&'
+    {308, 4, 12, 9, 2, -32},     // 0x27 '''
+    {313, 10, 44, 16, 3, -33},   // 0x28 '('
+    {349, 10, 44, 16, 2, -33},   // 0x29 ')'
+    {386, 14, 14, 18, 2, -33},   // 0x2A '*'
+    {405, 23, 22, 27, 2, -21},   // 0x2B '+'
+    {412, 4, 12, 13, 4, -4},     // 0x2C ','
+    {420, 11, 4, 16, 2, -14},    // 0x2D '-'
+    {422, 4, 5, 12, 4, -4},      // 0x2E '.'
+    {424, 13, 35, 13, 0, -33},   // 0x2F '/'
+    {465, 22, 34, 26, 2, -32},   // 0x30 '0'
+    {503, 11, 33, 26, 5, -32},   // 0x31 '1'
+    {513, 22, 33, 26, 2, -32},   // 0x32 '2'
+    {557, 23, 34, 26, 1, -32},   // 0x33 '3'
+    {609, 23, 33, 26, 1, -32},   // 0x34 '4'
+    {652, 22, 34, 26, 2, -32},   // 0x35 '5'
+    {689, 22, 34, 26, 2, -32},   // 0x36 '6'
+    {745, 21, 33, 26, 2, -32},   // 0x37 '7'
+    {790, 22, 34, 26, 2, -32},   // 0x38 '8'
+    {841, 21, 34, 26, 2, -32},   // 0x39 '9'
+    {895, 4, 25, 12, 4, -24},    // 0x3A ':'
+    {901, 4, 32, 12, 4, -24},    // 0x3B ';'
+    {912, 23, 23, 27, 2, -22},   // 0x3C '<'
+    {944, 23, 12, 27, 2, -16},   // 0x3D '='
+    {951, 23, 23, 27, 2, -22},   // 0x3E '>'
+    {984, 20, 35, 26, 4, -34},   // 0x3F '?'
+    {1022, 43, 42, 48, 2, -34},  // 0x40 '@'
+    {1149, 30, 34, 31, 1, -33},  // 0x41 'A'
+    {1219, 25, 34, 31, 4, -33},  // 0x42 'B'
+    {1269, 29, 36, 33, 2, -34},  // 0x43 'C'
+    {1325, 27, 34, 33, 4, -33},  // 0x44 'D'
+    {1372, 24, 34, 30, 4, -33},  // 0x45 'E'
+    {1385, 22, 34, 28, 4, -33},  // 0x46 'F'
+    {1396, 31, 36, 36, 2, -34},  // 0x47 'G'
+    {1460, 26, 34, 34, 4, -33},  // 0x48 'H'
+    {1471, 4, 34, 13, 5, -33},   // 0x49 'I'
+    {1476, 19, 35, 25, 2, -33},  // 0x4A 'J'
+    {1494, 27, 34, 32, 4, -33},  // 0x4B 'K'
+    {1568, 21, 34, 26, 4, -33},  // 0x4C 'L'
+    {1575, 32, 34, 40, 4, -33},  // 0x4D 'M'
+    {1642, 26, 34, 34, 4, -33},  // 0x4E 'N'
+    {1706, 33, 36, 37, 2, -34},  // 0x4F 'O'
+    {1769, 24, 34, 31, 4, -33},  // 0x50 'P'
+    {1800, 33, 38, 37, 2, -34},  // 0x51 'Q'
+    {1869, 26, 34, 33, 4, -33},  // 0x52 'R'
+    {1914, 27, 36, 31, 2, -34},  // 0x53 'S'
+    {1977, 26, 34, 30, 2, -33},  // 0x54 'T'
+    {1984, 26, 35, 34, 4, -33},  // 0x55 'U'
+    {2005, 29, 34, 30, 1, -33},  // 0x56 'V'
+    {2076, 42, 34, 44, 1, -33},  // 0x57 'W'
+    {2174, 29, 34, 31, 1, -33},  // 0x58 'X'
+    {2244, 30, 34, 32, 1, -33},  // 0x59 'Y'
+    {2292, 27, 34, 29, 1, -33},  // 0x5A 'Z'
+    {2337, 8, 44, 13, 3, -33},   // 0x5B '['
+    {2346, 13, 35, 13, 0, -33},  // 0x5C '\'
+    {2387, 8, 44, 13, 1, -33},   // 0x5D ']'
+    {2396, 18, 18, 22, 2, -32},  // 0x5E '^'
+    {2425, 28, 2, 26, -1, 7},    // 0x5F '_'
+    {2427, 10, 7, 12, 1, -34},   // 0x60 '`'
+    {2434, 24, 27, 26, 1, -25},  // 0x61 'a'
+    {2482, 22, 35, 26, 3, -33},  // 0x62 'b'
+    {2527, 21, 27, 24, 1, -25},  // 0x63 'c'
+    {2561, 23, 35, 26, 1, -33},  // 0x64 'd'
+    {2606, 22, 27, 25, 1, -25},  // 0x65 'e'
+    {2645, 10, 34, 13, 1, -33},  // 0x66 'f'
+    {2658, 22, 36, 26, 1, -25},  // 0x67 'g'
+    {2711, 19, 34, 25, 3, -33},  // 0x68 'h'
+    {2733, 4, 34, 10, 3, -33},   // 0x69 'i'
+    {2739, 8, 44, 11, 0, -33},   // 0x6A 'j'
+    {2751, 21, 34, 24, 3, -33},  // 0x6B 'k'
+    {2801, 4, 34, 10, 3, -33},   // 0x6C 'l'
+    {2806, 32, 26, 38, 3, -25},  // 0x6D 'm'
+    {2831, 20, 26, 25, 3, -25},  // 0x6E 'n'
+    {2851, 23, 27, 25, 1, -25},  // 0x6F 'o'
+    {2890, 22, 35, 26, 3, -25},  // 0x70 'p'
+    {2933, 23, 35, 26, 1, -25},  // 0x71 'q'
+    {2979, 12, 26, 16, 3, -25},  // 0x72 'r'
+    {2990, 20, 27, 23, 1, -25},  // 0x73 's'
+    {3029, 10, 32, 13, 1, -30},  // 0x74 't'
+    {3040, 20, 26, 25, 3, -24},  // 0x75 'u'
+    {3058, 23, 25, 23, 0, -24},  // 0x76 'v'
+    {3104, 34, 25, 34, 0, -24},  // 0x77 'w'
+    {3181, 22, 25, 22, 0, -24},  // 0x78 'x'
+    {3227, 22, 35, 22, 0, -24},  // 0x79 'y'
+    {3283, 20, 25, 23, 1, -24},  // 0x7A 'z'
+    {3314, 11, 44, 16, 2, -33},  // 0x7B '{'
+    {3337, 3, 44, 12, 4, -33},   // 0x7C '|'
+    {3342, 11, 44, 16, 2, -33},  // 0x7D '}'
+    {3364, 19, 7, 24, 2, -19}};  // 0x7E '~'
+
+const GFXpackedFont FreeSans24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeSans24pt7bRLEBitmaps,
+     (GFXglyph *)FreeSans24pt7bRLEGlyphs, 0x20, 0x7E, 56},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 4050 bytes, glyph bitmaps 3377 bytes (7464 uncompressed)
@@ -0,0 +1,495 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeSansOblique24pt7bRLEBitmaps[] PROGMEM = {
+    0xF7, 0x46, 0x5E, 0x36, 0x41, 0xE4, 0x05, 0x42, 0xE4, 0x04, 0x43, 0xE3,
+    0x03, 0x44, 0xE2, 0x03, 0x35, 0xF0, 0x32, 0x6E, 0x20, 0xBF, 0x01, 0x46,
+    0xE2, 0x47, 0xE2, 0x14, 0x44, 0xE3, 0x04, 0x44, 0x1E, 0x23, 0x53, 0x2F,
+    0x26, 0x23, 0xD0, 0x46, 0x3D, 0x24, 0x54, 0xD2, 0x36, 0x4D, 0x14, 0x63,
+    0xD2, 0x36, 0x4D, 0x14, 0x63, 0xD2, 0x45, 0x4D, 0x23, 0x64, 0xD1, 0x46,
+    0x35, 0xE2, 0x04, 0xDA, 0xA3, 0x64, 0xD1, 0x46, 0x3D, 0x24, 0x54, 0xD2,
+    0x36, 0x4D, 0x14, 0x63, 0xD2, 0x36, 0x4D, 0x14, 0x63, 0xD2, 0x45, 0x4D,
+    0x23, 0x64, 0x9E, 0x2D, 0xA9, 0x46, 0x3D, 0x23, 0x64, 0xD1, 0x46, 0x3C,
+    0xF0, 0x33, 0x64, 0xD1, 0x46, 0x3D, 0x23, 0x64, 0xD1, 0x46, 0x3D, 0x24,
+    0x54, 0xD2, 0x36, 0x4D, 0x10, 0xD3, 0x3D, 0xA2, 0xD8, 0x8D, 0x2D, 0x0C,
+    0xD2, 0x9D, 0x58, 0x53, 0x23, 0x57, 0x53, 0x34, 0x55, 0x54, 0x35, 0x45,
+    0x45, 0x35, 0x45, 0x36, 0x35, 0x44, 0x46, 0x26, 0x4E, 0x24, 0x45, 0x3D,
+    0x15, 0x43, 0xD1, 0x72, 0x2D, 0x3B, 0xD3, 0xD0, 0xD2, 0xD0, 0xD2, 0xCD,
+    0x3B, 0xD1, 0x33, 0x7D, 0x03, 0x55, 0xD0, 0x36, 0x4D, 0x02, 0x74, 0x2F,
+    0x46, 0x37, 0x42, 0x46, 0x37, 0x33, 0x46, 0x36, 0x43, 0x46, 0x27, 0x43,
+    0x54, 0x36, 0x44, 0x54, 0x35, 0x46, 0x62, 0x32, 0x68, 0xD4, 0xAD, 0x2D,
+    0x19, 0xBF, 0x08, 0x3D, 0xA2, 0xD3, 0xF0, 0x73, 0xD3, 0xDF, 0x01, 0x4A,
+    0x5D, 0x43, 0x99, 0xD1, 0x39, 0xBC, 0x39, 0x44, 0x4B, 0x48, 0x37, 0x4A,
+    0x38, 0x39, 0x39, 0x39, 0x39, 0x38, 0x39, 0x3A, 0x37, 0x3A, 0x3A, 0x36,
+    0x4A, 0x39, 0x37, 0x3B, 0x39, 0x36, 0x3C, 0x47, 0x36, 0x3D, 0x14, 0x45,
+    0x54, 0xD1, 0xC6, 0x3D, 0x39, 0x73, 0xD6, 0x58, 0x3D, 0xF0, 0x43, 0xDF,
+    0x04, 0x48, 0x5D, 0x63, 0x79, 0xD3, 0x37, 0xBD, 0x13, 0x74, 0x44, 0xD0,
+    0x46, 0x37, 0x4C, 0x36, 0x39, 0x3B, 0x37, 0x39, 0x3A, 0x37, 0x3A, 0x39,
+    0x38, 0x3A, 0x38, 0x48, 0x39, 0x39, 0x39, 0x39, 0x38, 0x3A, 0x47, 0x38,
+    0x3C, 0x44, 0x57, 0x3D, 0x0C, 0x83, 0xD1, 0x99, 0x3D, 0x45, 0x70, 0xD2,
+    0x6D, 0x4A, 0xD2, 0xCD, 0x05, 0x45, 0x2F, 0x09, 0x47, 0x42, 0xF0, 0x84,
+    0x84, 0x2F, 0x08, 0x47, 0x4B, 0x54, 0x5D, 0x04, 0x35, 0xD1, 0xBD, 0x39,
+    0xD4, 0x7D, 0x48, 0xD3, 0xAD, 0x26, 0x15, 0x63, 0x45, 0x45, 0x53, 0x35,
+    0x55, 0x43, 0x34, 0x85, 0x33, 0x24, 0xA4, 0x24, 0x24, 0xA9, 0x2F, 0x4C,
+    0x73, 0xF4, 0xD0, 0x54, 0x5B, 0x73, 0x59, 0x93, 0x75, 0x61, 0x53, 0xD3,
+    0x34, 0x4D, 0x14, 0x54, 0xB7, 0x46, 0x7D, 0x10, 0xE2, 0x14, 0xE3, 0x04,
+    0x1E, 0x23, 0x2F, 0x23, 0xC3, 0xB3, 0xB3, 0x2F, 0x09, 0x3B, 0x3B, 0x3B,
+    0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x48, 0xF0, 0x33, 0x9E, 0x20, 0x23,
+    0xAE, 0x30, 0x13, 0xB4, 0xBE, 0xB3, 0xD0, 0x2C, 0xE2, 0x01, 0x3D, 0x02,
+    0xBF, 0x02, 0x3D, 0x02, 0xA0, 0xA2, 0x3F, 0x0A, 0x3D, 0x02, 0x2E, 0x30,
+    0xB3, 0x1E, 0xB0, 0xC3, 0xB4, 0xE2, 0xB3, 0xB4, 0x1E, 0x20, 0xA3, 0x2F,
+    0x09, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x4B, 0x3B, 0x38, 0xF0,
+    0x33, 0xB3, 0xB3, 0xB3, 0xC0, 0xF7, 0x3A, 0x36, 0x23, 0x33, 0x21, 0x41,
+    0x31, 0xD5, 0x2A, 0x74, 0x87, 0x64, 0x13, 0x54, 0x24, 0x43, 0x43, 0x51,
+    0x52, 0x40, 0xFC, 0x3D, 0x64, 0x8E, 0x30, 0xB3, 0xD6, 0x3A, 0xE2, 0xDF,
+    0x0D, 0x41, 0xE2, 0x09, 0x3D, 0x64, 0xBE, 0x30, 0x83, 0xCF, 0x07, 0x3D,
+    0x00, 0xE2, 0x25, 0x24, 0x25, 0x1F, 0x04, 0x21, 0xF0, 0x32, 0x42, 0x34,
+    0x32, 0x50, 0x1B, 0xF0, 0xDA, 0x10, 0xF1, 0x51, 0x41, 0xF5, 0x10, 0xD6,
+    0x2D, 0x53, 0xFD, 0x43, 0x1F, 0x0D, 0x33, 0xD4, 0x3D, 0x52, 0xD5, 0x3D,
+    0x52, 0xD5, 0x3D, 0x52, 0xD5, 0x3D, 0x52, 0xD5, 0x3D, 0x52, 0xD5, 0x3D,
+    0x52, 0xD5, 0x3D, 0x52, 0xD5, 0x3D, 0x52, 0xD5, 0x3B, 0xF0, 0x63, 0xD4,
+    0x3D, 0x52, 0xD5, 0x3D, 0x52, 0xD5, 0x3D, 0x52, 0xD5, 0x3D, 0x52, 0xD5,
+    0x3D, 0x52, 0xD5, 0xC6, 0xD1, 0xBB, 0xD0, 0x9D, 0x27, 0x64, 0x66, 0x58,
+    0x46, 0x49, 0x54, 0x4B, 0x43, 0x5B, 0x4F, 0x34, 0xC4, 0xF2, 0x4D, 0x04,
+    0x24, 0xC5, 0x14, 0xD0, 0x5E, 0x31, 0x4D, 0x04, 0x1F, 0x4D, 0x05, 0x1F,
+    0x4D, 0x04, 0x24, 0xC5, 0x24, 0xC4, 0x34, 0xB5, 0x34, 0xB4, 0x45, 0x95,
+    0x45, 0x85, 0x66, 0x46, 0x7D, 0x29, 0xD0, 0xBB, 0xD1, 0x6C, 0xB2, 0xA3,
+    0x93, 0x94, 0x85, 0x49, 0x1C, 0x1F, 0xB2, 0xF0, 0x74, 0x85, 0x2E, 0x30,
+    0x64, 0x85, 0x3E, 0x30, 0x54, 0x85, 0x4E, 0x30, 0x44, 0x85, 0x5E, 0x30,
+    0x34, 0x85, 0x84, 0x70, 0xD1, 0x8D, 0x3D, 0x0D, 0x0D, 0x2B, 0xD4, 0x96,
+    0x66, 0x85, 0xA5, 0x65, 0xB5, 0x65, 0xC4, 0x64, 0xD0, 0x45, 0x5D, 0x04,
+    0x54, 0xD1, 0x4F, 0xD9, 0x4D, 0x95, 0xD8, 0x5D, 0x85, 0xD7, 0x6D, 0x67,
+    0xD5, 0x7D, 0x57, 0xD5, 0x7D, 0x57, 0xD6, 0x6D, 0x76, 0xD7, 0x5D, 0x85,
+    0xD8, 0x5D, 0x94, 0xD9, 0x4D, 0xAD, 0x94, 0xE2, 0xD9, 0x50, 0xD0, 0x7D,
+    0x2C, 0xBD, 0x29, 0xD4, 0x86, 0x66, 0x65, 0x95, 0x55, 0xB4, 0x54, 0xC4,
+    0x45, 0xC4, 0x44, 0xD0, 0x4F, 0xD7, 0x4D, 0x74, 0xD5, 0x7D, 0x0A, 0xD2,
+    0x9D, 0x3A, 0xD1, 0xCD, 0x66, 0xD8, 0x52, 0xE2, 0x0D, 0x64, 0x2F, 0x4D,
+    0x24, 0x2F, 0x4D, 0x14, 0x34, 0xD0, 0x44, 0x5A, 0x65, 0x66, 0x76, 0xD5,
+    0x8D, 0x3A, 0xD0, 0xD1, 0x8C, 0xD7, 0x3D, 0x74, 0xD6, 0x5D, 0x56, 0xD4,
+    0x7D, 0x37, 0xD3, 0x8D, 0x24, 0x14, 0xD1, 0x51, 0x4D, 0x05, 0x15, 0xC5,
+    0x24, 0xC5, 0x34, 0xB5, 0x44, 0xB4, 0x54, 0xA4, 0x54, 0xA4, 0x64, 0x94,
+    0x74, 0x84, 0x84, 0x74, 0x85, 0x64, 0x94, 0x64, 0xA4, 0x5F, 0x01, 0xDA,
+    0xF0, 0xDA, 0x1E, 0x20, 0xD1, 0x46, 0xE3, 0x0D, 0x04, 0xD6, 0x57, 0x9D,
+    0x41, 0xE2, 0x08, 0xD5, 0x1E, 0x20, 0x74, 0xD3, 0xE2, 0x06, 0x4D, 0x94,
+    0xDA, 0x43, 0x6D, 0x04, 0x1C, 0xAD, 0x59, 0xD6, 0x77, 0x76, 0x75, 0xA6,
+    0x64, 0xC5, 0x3E, 0x40, 0xD7, 0x4D, 0xA3, 0xDA, 0x44, 0x4D, 0x24, 0x44,
+    0xD1, 0x45, 0x5C, 0x46, 0x5B, 0x57, 0x67, 0x68, 0xD5, 0xAD, 0x3C, 0xD0,
+    0xD4, 0x7D, 0x10, 0xD0, 0x6D, 0x2B, 0xCD, 0x0A, 0xD2, 0x86, 0x55, 0x75,
+    0x85, 0x55, 0x95, 0x45, 0xB4, 0x44, 0xC4, 0x35, 0xD3, 0xF0, 0x34, 0xD6,
+    0x45, 0x69, 0x43, 0xA7, 0x41, 0xD0, 0x54, 0x1D, 0x24, 0x95, 0x64, 0x79,
+    0x53, 0x6A, 0x52, 0x6C, 0x42, 0xF5, 0xD0, 0x42, 0x4D, 0x14, 0x24, 0xD1,
+    0x33, 0xF4, 0xD0, 0x43, 0x4C, 0x44, 0x5A, 0x55, 0x58, 0x56, 0x65, 0x68,
+    0xD3, 0x8D, 0x2B, 0xBD, 0x27, 0xB0, 0xE2, 0x3D, 0x93, 0xDA, 0xD8, 0x4D,
+    0x84, 0xD8, 0x4D, 0x84, 0xD8, 0x46, 0xF0, 0xD2, 0x4D, 0x84, 0xD8, 0x4D,
+    0x84, 0xAF, 0x0B, 0x4D, 0x84, 0xD8, 0x4D, 0x85, 0xD8, 0x4D, 0x84, 0xD8,
+    0x5D, 0x84, 0xD8, 0x5D, 0x84, 0xD4, 0xF0, 0x44, 0xD5, 0xF0, 0x34, 0xD6,
+    0xF0, 0x24, 0xD8, 0x5D, 0x84, 0xD8, 0xD0, 0x7D, 0x2C, 0xCD, 0x1A, 0xD3,
+    0x86, 0x66, 0x65, 0x95, 0x64, 0xB4, 0xE2, 0x54, 0xC4, 0x54, 0xB4, 0x65,
+    0x94, 0x76, 0x65, 0x9D, 0x24, 0xF0, 0x7D, 0x0A, 0xD3, 0x86, 0x66, 0x65,
+    0xA4, 0x54, 0xC5, 0x35, 0xD0, 0x43, 0x4D, 0x14, 0x2F, 0x4D, 0x24, 0x24,
+    0xD2, 0x33, 0xF4, 0xD1, 0x43, 0x5C, 0x44, 0x6A, 0x55, 0x66, 0x76, 0xD5,
+    0x8D, 0x3B, 0xCD, 0x28, 0xB0, 0xB7, 0xD2, 0xBB, 0xD2, 0x8D, 0x37, 0x75,
+    0x66, 0x58, 0x55, 0x5A, 0x54, 0x4C, 0x4F, 0x34, 0xD0, 0x4F, 0x24, 0xD1,
+    0x4F, 0x24, 0xD0, 0x52, 0x4C, 0x62, 0x5A, 0x63, 0x59, 0x74, 0x65, 0x94,
+    0xD7, 0x5D, 0x01, 0x47, 0xA3, 0x49, 0x64, 0x5D, 0x65, 0xD6, 0x4D, 0x65,
+    0xD6, 0x44, 0x4B, 0x54, 0x4A, 0x55, 0x58, 0x56, 0x65, 0x77, 0xD3, 0x9D,
+    0x0C, 0xBD, 0x27, 0xC0, 0xF5, 0x55, 0x41, 0xF0, 0x45, 0x1E, 0xD1, 0x0A,
+    0xF0, 0x15, 0x54, 0x5F, 0x55, 0xF6, 0x56, 0x41, 0xF0, 0x55, 0x1E, 0xD1,
+    0x0B, 0xE2, 0x02, 0x56, 0x46, 0x55, 0xF0, 0x42, 0x5F, 0x03, 0x28, 0x27,
+    0x47, 0x29, 0xDC, 0x1D, 0xA3, 0xD7, 0x5D, 0x67, 0xD3, 0x9D, 0x19, 0xD2,
+    0x9D, 0x19, 0xD2, 0x9D, 0x19, 0xD3, 0x7D, 0x56, 0xD7, 0x7D, 0x78, 0xD7,
+    0x8D, 0x78, 0xD7, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD7, 0x6D, 0x93, 0xDC,
+    0x15, 0x3D, 0xA3, 0xD9, 0x1F, 0x02, 0xDA, 0x1E, 0x30, 0xDD, 0xF0, 0x1D,
+    0xA2, 0xF0, 0x1D, 0x93, 0x51, 0xDC, 0x3D, 0x96, 0xD7, 0x9D, 0x69, 0xD6,
+    0x9D, 0x69, 0xD7, 0x8D, 0x78, 0xD7, 0x8D, 0x77, 0xD7, 0x6D, 0x57, 0xD3,
+    0x9D, 0x19, 0xD2, 0x9D, 0x19, 0xD2, 0x9D, 0x19, 0xD3, 0x7D, 0x65, 0xD7,
+    0x3D, 0xA1, 0xDC, 0x87, 0xBB, 0x7D, 0x15, 0xD3, 0x45, 0x65, 0x35, 0x85,
+    0x15, 0xA4, 0xF1, 0x4B, 0x8C, 0x8B, 0x5D, 0x24, 0xD2, 0x5D, 0x15, 0xD1,
+    0x5D, 0x15, 0xD1, 0x5D, 0x06, 0xD0, 0x6D, 0x15, 0xD1, 0x5D, 0x15, 0xAF,
+    0x05, 0x4D, 0x25, 0xD2, 0x4C, 0xE3, 0x0D, 0x7E, 0x30, 0x34, 0xD2, 0x5D,
+    0x00, 0xDA, 0xAD, 0xF0, 0x3D, 0x4D, 0xDD, 0x8D, 0x9D, 0xCD, 0x5A, 0x99,
+    0xD2, 0x8D, 0x28, 0xD0, 0x7D, 0x67, 0xB6, 0xD9, 0x6A, 0x6D, 0xC5, 0x86,
+    0xDD, 0x57, 0x5B, 0x6C, 0x55, 0x5A, 0xA2, 0x44, 0x55, 0x49, 0xC2, 0x45,
+    0x44, 0x58, 0x64, 0x86, 0x43, 0x58, 0x57, 0x67, 0x43, 0x48, 0x58, 0x67,
+    0x42, 0x57, 0x59, 0x58, 0x42, 0x48, 0x4A, 0x58, 0x41, 0x57, 0x4B, 0x48,
+    0x51, 0x47, 0x5A, 0x58, 0x42, 0x47, 0x4B, 0x49, 0x42, 0x38, 0x4B, 0x48,
+    0x51, 0x47, 0x4B, 0x49, 0x42, 0x47, 0x4B, 0x48, 0x52, 0x47, 0x4A, 0x48,
+    0x53, 0x47, 0x49, 0x57, 0x63, 0x47, 0x48, 0x57, 0x64, 0x47, 0x56, 0x66,
+    0x65, 0x48, 0x54, 0x83, 0x67, 0x57, 0xB1, 0xD0, 0x94, 0x89, 0x3A, 0xB4,
+    0x96, 0x58, 0xD0, 0x5D, 0xF0, 0xD0, 0x5D, 0xF0, 0xC6, 0xDF, 0x0C, 0x6D,
+    0xF0, 0xC7, 0xDF, 0x0B, 0x99, 0x5D, 0xAD, 0x9D, 0xCD, 0x8D, 0xDD, 0x4D,
+    0xF0, 0x3A, 0xD9, 0xD6, 0x65, 0xF0, 0xD5, 0x7D, 0x98, 0xD8, 0xAD, 0x74,
+    0x15, 0x4F, 0x0D, 0x24, 0x25, 0x4F, 0x0D, 0x14, 0x35, 0xD4, 0x45, 0x4D,
+    0x35, 0x54, 0xD3, 0x46, 0x53, 0xF0, 0xB4, 0x75, 0x3F, 0x0A, 0x48, 0x5C,
+    0x49, 0x5B, 0x5A, 0x4B, 0x4B, 0x52, 0xF0, 0x7D, 0x82, 0xF0, 0x6D, 0x97,
+    0x5D, 0x05, 0x65, 0xD2, 0x46, 0x5D, 0x25, 0x45, 0xD3, 0x54, 0x4D, 0x45,
+    0x35, 0xD4, 0x53, 0x4D, 0x55, 0x25, 0xD5, 0x51, 0x5D, 0x74, 0x15, 0xD7,
+    0x50, 0x7D, 0x4C, 0xD6, 0x3F, 0x07, 0xD8, 0x75, 0xC6, 0x64, 0xD1, 0x5E,
+    0x26, 0x4D, 0x24, 0x54, 0xD3, 0x4F, 0x54, 0xD2, 0x46, 0x4D, 0x14, 0x65,
+    0xC5, 0x7D, 0x79, 0xD6, 0xAD, 0x78, 0xDA, 0x64, 0xD1, 0x56, 0x4D, 0x25,
+    0x2F, 0x03, 0x4D, 0x34, 0x2E, 0x20, 0x24, 0xD4, 0x44, 0x4D, 0x34, 0x45,
+    0xD3, 0x44, 0x4D, 0x35, 0x44, 0xD2, 0x55, 0x4D, 0x06, 0x6D, 0x96, 0xD9,
+    0x7D, 0x88, 0xD6, 0xA0, 0xD2, 0x8D, 0x6D, 0x0D, 0x2D, 0x4C, 0xD6, 0xA7,
+    0x76, 0x96, 0xB5, 0x75, 0xD1, 0x46, 0x5D, 0x24, 0x64, 0xD4, 0x44, 0x4D,
+    0x54, 0x35, 0xD5, 0x43, 0x4D, 0xAE, 0x20, 0x24, 0xDB, 0xE2, 0x01, 0x4D,
+    0xCE, 0x44, 0xDD, 0x4D, 0x74, 0x24, 0xD6, 0x52, 0x4D, 0x64, 0x35, 0xD4,
+    0x53, 0x5D, 0x44, 0x55, 0xD2, 0x55, 0x5D, 0x15, 0x75, 0xB6, 0x87, 0x77,
+    0xAD, 0x6C, 0xD4, 0xD1, 0xD1, 0xD6, 0x8D, 0x10, 0x7D, 0x4D, 0x1D, 0x6C,
+    0xD7, 0xAD, 0x99, 0x5B, 0x78, 0x4D, 0x16, 0x74, 0xD2, 0x56, 0x5D, 0x34,
+    0x65, 0xD3, 0x5E, 0x25, 0x4D, 0x54, 0xF4, 0x5D, 0x54, 0xF4, 0x4D, 0x64,
+    0x44, 0xD5, 0x41, 0xF0, 0x35, 0xD5, 0x44, 0x4D, 0x64, 0x44, 0xD5, 0x44,
+    0x5D, 0x54, 0x45, 0xD4, 0x54, 0x4D, 0x54, 0x54, 0xD4, 0x55, 0x4D, 0x44,
+    0x55, 0xD3, 0x46, 0x5D, 0x25, 0x64, 0xD1, 0x67, 0x4C, 0x78, 0xD9, 0x8D,
+    0x99, 0xD7, 0xBD, 0x4D, 0x10, 0xF7, 0xDB, 0x7D, 0xA7, 0xDB, 0x75, 0xD7,
+    0xF0, 0x64, 0xD8, 0xF0, 0x55, 0xD8, 0xE2, 0x05, 0x4D, 0x9F, 0x04, 0x5D,
+    0xD4, 0xDA, 0xF0, 0x4D, 0xA4, 0xF0, 0x3D, 0xA5, 0xF0, 0x34, 0xDB, 0xF0,
+    0x25, 0xDB, 0xE2, 0x02, 0x4D, 0xCF, 0x01, 0x5D, 0xCF, 0x01, 0x4D, 0xED,
+    0xB6, 0xFD, 0xC6, 0xDB, 0x70, 0xE2, 0x7D, 0xA6, 0xDA, 0x75, 0xD6, 0xF0,
+    0x64, 0xD7, 0xF0, 0x55, 0xD7, 0xE2, 0x05, 0x4D, 0x8F, 0x04, 0x5D, 0xC4,
+    0xD9, 0xF0, 0x4D, 0x76, 0xF0, 0x3D, 0x86, 0xF0, 0x34, 0xDA, 0xF0, 0x25,
+    0xDA, 0xE2, 0x02, 0x4D, 0xBF, 0x01, 0x5D, 0xBE, 0x20, 0x14, 0xDC, 0x5D,
+    0xCF, 0x4D, 0xD0, 0xD4, 0x9D, 0x8D, 0x1D, 0x3D, 0x6D, 0x0D, 0x8B, 0x78,
+    0x88, 0x6D, 0x15, 0x76, 0xD3, 0x56, 0x4D, 0x55, 0x54, 0xD7, 0x44, 0x5D,
+    0x74, 0x44, 0xDF, 0x4D, 0xF5, 0xDD, 0xF0, 0x24, 0xDE, 0xF0, 0x14, 0xDF,
+    0x01, 0x4D, 0x0D, 0x11, 0x4D, 0x1D, 0x11, 0xF4, 0xD0, 0xD2, 0x1F, 0x4D,
+    0xB3, 0x2F, 0x4D, 0xA4, 0x24, 0xD9, 0x52, 0x5D, 0x85, 0x34, 0xD7, 0x54,
+    0x5D, 0x56, 0x46, 0xD3, 0x75, 0x6D, 0x09, 0x58, 0x87, 0x14, 0x6D, 0x73,
+    0x39, 0xD4, 0x43, 0xAD, 0x16, 0x3D, 0x08, 0xD3, 0xF7, 0x4D, 0x54, 0x74,
+    0xD4, 0x56, 0x5D, 0x45, 0x65, 0xD4, 0x41, 0xF0, 0x64, 0xD5, 0x41, 0xF0,
+    0x55, 0xD4, 0x51, 0xE2, 0x05, 0x4D, 0x54, 0x2F, 0x04, 0x5D, 0x45, 0x64,
+    0xD5, 0x43, 0xF0, 0x4D, 0xD6, 0xDE, 0x6D, 0xD4, 0xF0, 0x34, 0xD5, 0x44,
+    0xF0, 0x25, 0xD4, 0x54, 0xE2, 0x02, 0x4D, 0x54, 0x65, 0xD4, 0x56, 0x5D,
+    0x44, 0x6F, 0x01, 0x4D, 0x54, 0x74, 0xD4, 0x56, 0x5D, 0x45, 0x6F, 0x4D,
+    0x54, 0x70, 0xE2, 0x65, 0xE2, 0x64, 0x1F, 0x05, 0x51, 0xE2, 0x05, 0x42,
+    0xF0, 0x45, 0x2E, 0x20, 0x44, 0x3F, 0x03, 0x53, 0xE2, 0x03, 0x44, 0xF0,
+    0x25, 0x4E, 0x20, 0x24, 0x5F, 0x01, 0x55, 0xE2, 0x01, 0x46, 0xF5, 0x64,
+    0x70, 0xFD, 0x84, 0xE3, 0xD7, 0x4D, 0x75, 0x1E, 0x30, 0xD6, 0x4D, 0x75,
+    0x2E, 0x30, 0xD5, 0x43, 0xE3, 0x0D, 0x44, 0xD7, 0x54, 0xF0, 0xD3, 0x45,
+    0xF0, 0x14, 0xB4, 0x54, 0xB5, 0x5F, 0x4B, 0x46, 0x4A, 0x56, 0x58, 0x57,
+    0x65, 0x69, 0xD3, 0xAD, 0x1C, 0xBD, 0x37, 0xD0, 0x74, 0xD4, 0x67, 0x4D,
+    0x35, 0x94, 0xD2, 0x59, 0x5D, 0x06, 0xA5, 0xC6, 0xB4, 0xC6, 0xC4, 0xB5,
+    0xD0, 0x5A, 0x5D, 0x15, 0x86, 0xD2, 0x48, 0x6D, 0x34, 0x75, 0xD5, 0x46,
+    0x5D, 0x55, 0x55, 0xD6, 0x53, 0x6D, 0x74, 0x37, 0xD7, 0x42, 0x8D, 0x74,
+    0x1A, 0xD5, 0xA1, 0x5D, 0x58, 0x44, 0xD5, 0x75, 0x5D, 0x46, 0x74, 0xD3,
+    0x68, 0x5D, 0x25, 0xA4, 0xD0, 0xF0, 0x24, 0xB5, 0xD1, 0x4C, 0x5C, 0x5C,
+    0x5C, 0x5D, 0x05, 0xB4, 0xD1, 0x5A, 0xF0, 0x14, 0xD2, 0x59, 0x5D, 0x35,
+    0x84, 0xD4, 0x58, 0x4D, 0x55, 0x70, 0xE2, 0x74, 0xBF, 0x06, 0x5B, 0xF0,
+    0x64, 0xCF, 0x05, 0x5C, 0xE2, 0x05, 0x4D, 0x0F, 0x04, 0x5D, 0x0E, 0x20,
+    0x44, 0xD4, 0x5D, 0x1E, 0x20, 0x34, 0xD2, 0xF0, 0x25, 0xD2, 0xE2, 0x02,
+    0x4D, 0x3F, 0x01, 0x5D, 0x3F, 0x01, 0x4D, 0x5D, 0xF0, 0xD2, 0xF0, 0xD8,
+    0x10, 0x76, 0xD7, 0x67, 0x7D, 0x57, 0x68, 0xD5, 0x76, 0x8D, 0x48, 0x68,
+    0xD4, 0x77, 0x8D, 0x38, 0x78, 0xD3, 0x31, 0x46, 0x9D, 0x29, 0x64, 0x14,
+    0xD1, 0x41, 0x47, 0x42, 0x4D, 0x04, 0x14, 0x2F, 0x05, 0x42, 0x4C, 0x42,
+    0x46, 0x52, 0x4B, 0x42, 0x56, 0x43, 0x4B, 0x42, 0x47, 0x43, 0x4A, 0x43,
+    0x47, 0x43, 0x4A, 0x34, 0x46, 0x53, 0x49, 0x44, 0x46, 0x45, 0x47, 0x44,
+    0x56, 0x45, 0x47, 0x44, 0x44, 0xF0, 0x34, 0x54, 0x64, 0x54, 0x65, 0x54,
+    0x54, 0x55, 0x64, 0x64, 0x54, 0x54, 0x74, 0x64, 0x44, 0x64, 0x74, 0x64,
+    0x43, 0x74, 0x74, 0x74, 0x24, 0x74, 0x65, 0x74, 0x23, 0x75, 0x64, 0x84,
+    0x14, 0x74, 0x6F, 0x01, 0x48, 0x88, 0x46, 0x58, 0x79, 0x46, 0x49, 0x78,
+    0x56, 0x49, 0x69, 0x47, 0x4A, 0x4A, 0x47, 0x75, 0xD5, 0x47, 0x6D, 0x35,
+    0xF6, 0x7D, 0x34, 0x78, 0xD2, 0x47, 0x8D, 0x15, 0x79, 0xD0, 0x47, 0xAD,
+    0x04, 0x74, 0x24, 0xD0, 0x47, 0x42, 0x5C, 0x47, 0x43, 0x4B, 0x57, 0x43,
+    0x5A, 0x47, 0x54, 0x4A, 0x43, 0xF0, 0x44, 0x55, 0x94, 0x74, 0x64, 0x85,
+    0x65, 0x65, 0x74, 0x74, 0x84, 0x74, 0x74, 0x85, 0x64, 0x74, 0x85, 0x55,
+    0x74, 0x95, 0x44, 0x75, 0x95, 0x44, 0x74, 0xB4, 0x44, 0x74, 0xB5, 0x34,
+    0x74, 0xC4, 0x25, 0x74, 0xC5, 0x14, 0x75, 0xC5, 0x14, 0x6F, 0x01, 0x4D,
+    0x19, 0x74, 0xD2, 0x86, 0x5D, 0x27, 0x7E, 0x24, 0xD4, 0x67, 0xD3, 0x8D,
+    0x9D, 0x1D, 0x4D, 0x4D, 0x1D, 0x8B, 0x87, 0x7A, 0x6C, 0x68, 0x5D, 0x26,
+    0x65, 0xD4, 0x55, 0x5D, 0x64, 0x54, 0xD7, 0x53, 0x5D, 0x84, 0x34, 0xD9,
+    0x4F, 0x24, 0xDA, 0x4E, 0x21, 0x4D, 0xB8, 0xDB, 0x5E, 0x20, 0x4D, 0xB4,
+    0x14, 0xDA, 0x51, 0xF4, 0xDA, 0x42, 0x4D, 0x95, 0x24, 0xD9, 0x43, 0x5D,
+    0x75, 0x44, 0xD6, 0x55, 0x5D, 0x45, 0x66, 0xD2, 0x58, 0x6C, 0x79, 0x78,
+    0x8A, 0xD8, 0xD1, 0xD5, 0xD3, 0xD2, 0xD8, 0x9D, 0x20, 0x7D, 0x4C, 0xD6,
+    0xAD, 0x78, 0xD9, 0x75, 0xB7, 0x64, 0xD1, 0x56, 0x4D, 0x24, 0xF5, 0x5D,
+    0x24, 0xF5, 0x4D, 0x34, 0x54, 0xD2, 0x45, 0x5D, 0x24, 0x55, 0xD1, 0x55,
+    0x4D, 0x15, 0x64, 0xC6, 0x7D, 0x96, 0xD9, 0x7D, 0x79, 0xD5, 0xB4, 0xD9,
+    0xF0, 0x25, 0xD9, 0xE2, 0x02, 0x4D, 0xAF, 0x01, 0x5D, 0xAE, 0x20, 0x14,
+    0xDB, 0x5D, 0xBF, 0x4D, 0xC0, 0xD3, 0x8D, 0x9D, 0x1D, 0x4D, 0x4D, 0x1D,
+    0x8B, 0x87, 0x7A, 0x6C, 0x68, 0x6D, 0x16, 0x65, 0xD4, 0x55, 0x5D, 0x64,
+    0x54, 0xD7, 0x53, 0x5D, 0x84, 0x34, 0xD9, 0x4F, 0x24, 0xDA, 0x4E, 0x21,
+    0x4D, 0xB4, 0x13, 0xDC, 0x4E, 0x30, 0x4D, 0xB4, 0x1F, 0x4D, 0xA4, 0x24,
+    0xD9, 0x43, 0x4D, 0x21, 0x55, 0x35, 0xD0, 0x34, 0x45, 0x4C, 0x52, 0x55,
+    0x5B, 0xB6, 0x6B, 0x98, 0x6B, 0x7A, 0x77, 0x9A, 0xDB, 0xBD, 0xAB, 0xD1,
+    0x36, 0xD0, 0x87, 0x5D, 0xF0, 0x13, 0xDF, 0x0A, 0x7D, 0x6B, 0xD8, 0x9D,
+    0x97, 0xDA, 0x75, 0xD0, 0x66, 0x4D, 0x25, 0x64, 0xD3, 0x4F, 0x55, 0xD3,
+    0x4F, 0x54, 0xD4, 0x45, 0x4D, 0x34, 0x55, 0xD3, 0x45, 0x5D, 0x25, 0x54,
+    0xD2, 0x56, 0x4D, 0x06, 0x7D, 0x94, 0xF0, 0x3D, 0x98, 0xDA, 0x74, 0xD1,
+    0x65, 0x5D, 0x25, 0x55, 0xD3, 0x43, 0xE2, 0x02, 0x4D, 0x44, 0x45, 0xD4,
+    0x44, 0x5D, 0x34, 0x4E, 0x20, 0x14, 0xD4, 0x44, 0x5D, 0x44, 0x4F, 0x4D,
+    0x54, 0x40, 0xD1, 0x9D, 0x4D, 0x1D, 0x0D, 0x5A, 0xD6, 0x97, 0x77, 0x75,
+    0xC6, 0x64, 0xD1, 0x55, 0x4D, 0x34, 0x53, 0xD4, 0x4F, 0x44, 0xD4, 0x44,
+    0x4D, 0xC5, 0xDB, 0x6D, 0xB7, 0xD9, 0xBD, 0x6D, 0x1D, 0x3D, 0x3D, 0x3D,
+    0x1D, 0x6B, 0xD8, 0x9D, 0xA7, 0xDB, 0x5D, 0xC4, 0x2F, 0x4D, 0x64, 0x24,
+    0xD6, 0x33, 0xF4, 0xD5, 0x43, 0x5D, 0x34, 0x55, 0xD0, 0x56, 0x78, 0x78,
+    0xD7, 0xAD, 0x5C, 0xD2, 0xD4, 0x9D, 0x00, 0xE2, 0x1D, 0xE1, 0xDD, 0xD0,
+    0x4C, 0xF0, 0xB5, 0xCE, 0x20, 0xB4, 0xD0, 0xF0, 0xA5, 0xD0, 0xF0, 0xA4,
+    0xD1, 0xF0, 0x95, 0xD1, 0xE2, 0x09, 0x4D, 0x2F, 0x08, 0x5D, 0x2E, 0x20,
+    0x84, 0xD3, 0xF0, 0x75, 0xD3, 0xF0, 0x74, 0xD4, 0xF0, 0x65, 0xD4, 0xE2,
+    0x06, 0x4D, 0xA5, 0xD5, 0xF5, 0x4D, 0x54, 0x54, 0xD4, 0x54, 0x5D, 0x45,
+    0x45, 0xD4, 0x41, 0xF0, 0x44, 0xD5, 0x41, 0xF0, 0x35, 0xD4, 0x51, 0xE2,
+    0x03, 0x4D, 0x54, 0x2F, 0x02, 0x5D, 0x45, 0x2F, 0x02, 0x4D, 0x54, 0x54,
+    0xD4, 0x54, 0x5D, 0x45, 0x45, 0xD4, 0x44, 0xF0, 0x14, 0xD5, 0x44, 0xF5,
+    0xD4, 0x54, 0xF4, 0xD5, 0x45, 0x4D, 0x45, 0x54, 0xD4, 0x46, 0x4D, 0x35,
+    0x65, 0xD1, 0x58, 0x5C, 0x68, 0x77, 0x8A, 0xD7, 0xCD, 0x4D, 0x2D, 0x2D,
+    0x69, 0xD2, 0x05, 0xD6, 0xAD, 0x55, 0x15, 0xD5, 0x42, 0x5D, 0x45, 0x34,
+    0xD4, 0x44, 0x4D, 0x35, 0x44, 0xD3, 0x45, 0x5D, 0x15, 0x55, 0xD1, 0x46,
+    0x5D, 0x05, 0x65, 0xC5, 0x84, 0xC4, 0x94, 0xB5, 0x94, 0xB4, 0xA4, 0xA5,
+    0xA5, 0x94, 0xB5, 0x85, 0xB5, 0x84, 0xAF, 0x03, 0x47, 0x4D, 0x14, 0x64,
+    0xD2, 0x45, 0x5D, 0x25, 0x44, 0xD3, 0x53, 0x5D, 0x35, 0x34, 0xD4, 0x52,
+    0x5D, 0x54, 0x24, 0xD2, 0xF0, 0x44, 0x14, 0xD3, 0xF0, 0x48, 0xD4, 0xF0,
+    0x47, 0xDA, 0x5D, 0x60, 0x04, 0xD2, 0x5D, 0x14, 0x14, 0xD1, 0x6D, 0x05,
+    0x14, 0xD1, 0x6D, 0x04, 0x2F, 0x4D, 0x07, 0xC5, 0x24, 0xC8, 0xB5, 0x34,
+    0xB9, 0xB5, 0x34, 0xB4, 0x14, 0xA5, 0x44, 0xA5, 0x14, 0xA5, 0x44, 0xA4,
+    0x24, 0x95, 0x54, 0x95, 0x24, 0x95, 0x54, 0x94, 0x34, 0x94, 0x64, 0x85,
+    0x34, 0x85, 0x73, 0x84, 0x44, 0x84, 0x83, 0x75, 0x53, 0x75, 0x83, 0x74,
+    0x64, 0x64, 0x93, 0x65, 0x64, 0x55, 0x93, 0x64, 0x74, 0x54, 0xA3, 0x55,
+    0x74, 0x45, 0xA4, 0x44, 0x84, 0x45, 0xA4, 0x35, 0x84, 0x44, 0xB4, 0x34,
+    0x94, 0x35, 0xB4, 0x25, 0x94, 0x34, 0xC4, 0x24, 0xA4, 0x25, 0xC4, 0x15,
+    0xA4, 0x24, 0xD0, 0x41, 0x4B, 0x41, 0x5D, 0x09, 0xB4, 0x14, 0xD1, 0x8C,
+    0x9D, 0x18, 0xC8, 0xD2, 0x7D, 0x17, 0xD2, 0x7D, 0x16, 0xD3, 0x6D, 0x26,
+    0xD3, 0x6D, 0x25, 0xD4, 0x5D, 0x35, 0xD3, 0x86, 0xD3, 0x69, 0x5D, 0x35,
+    0xA5, 0xD2, 0x5C, 0x5D, 0x05, 0xD0, 0x5C, 0x5D, 0x25, 0xA5, 0xD3, 0x59,
+    0x5D, 0x55, 0x75, 0xD6, 0x56, 0x5D, 0x85, 0x55, 0xD8, 0x54, 0x5D, 0x95,
+    0x35, 0xDB, 0x51, 0x5D, 0xCA, 0xDE, 0x8D, 0xF7, 0xDF, 0x02, 0x5D, 0xF0,
+    0x27, 0xDF, 0x8D, 0xE9, 0xDD, 0x51, 0x5D, 0xB5, 0x25, 0xD0, 0xF0, 0xA5,
+    0x45, 0xD8, 0x56, 0x5D, 0x65, 0x75, 0xD5, 0x59, 0x5D, 0x35, 0xA5, 0xD2,
+    0x5C, 0x5D, 0x05, 0xD0, 0x5C, 0x5D, 0x16, 0xA6, 0xD2, 0x59, 0x6D, 0x36,
+    0x76, 0xD5, 0x57, 0x05, 0xD7, 0x51, 0x5D, 0x55, 0x25, 0xD4, 0x53, 0x6D,
+    0x25, 0x55, 0xD2, 0x55, 0x5D, 0x15, 0x75, 0xC5, 0x85, 0xB5, 0xA4, 0xA5,
+    0x7F, 0x04, 0x58, 0x5D, 0x05, 0x65, 0xD1, 0x55, 0x5D, 0x34, 0x45, 0xD4,
+    0x52, 0x5D, 0x64, 0x24, 0xD7, 0xAD, 0x79, 0xD9, 0x7D, 0xA6, 0xD3, 0xF0,
+    0x94, 0xDC, 0x5D, 0x4E, 0x20, 0x84, 0xD5, 0xF0, 0x75, 0xD5, 0xE2, 0x07,
+    0x4D, 0x6F, 0x06, 0x5D, 0xC4, 0xD7, 0x9D, 0xCF, 0x9D, 0xB9, 0xDC, 0xDF,
+    0x5D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF,
+    0x5D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF,
+    0x5D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF, 0x5D, 0xF5, 0xDF,
+    0x5D, 0xF5, 0xDE, 0xE3, 0x01, 0xDD, 0x70, 0xE2, 0x99, 0x98, 0x1E, 0x30,
+    0x84, 0xD0, 0x56, 0xE3, 0x07, 0x4D, 0x05, 0x7E, 0x30, 0x64, 0x8E, 0x30,
+    0x54, 0xD0, 0x59, 0xE3, 0x04, 0x4D, 0x05, 0xAE, 0x30, 0x34, 0xBE, 0x30,
+    0x24, 0xD0, 0x5C, 0xE2, 0x01, 0x4D, 0x19, 0x8E, 0x29, 0x90, 0xE4, 0x03,
+    0x3E, 0x40, 0x12, 0x3E, 0x40, 0x13, 0x2E, 0x40, 0x22, 0x2E, 0x40, 0x23,
+    0x1E, 0x40, 0x32, 0x1E, 0x40, 0x33, 0xE2, 0x99, 0x89, 0x1E, 0x20, 0xD0,
+    0x4D, 0x05, 0x1E, 0x30, 0xC4, 0x2E, 0x30, 0xB4, 0xD0, 0x53, 0xE3, 0x0A,
+    0x4D, 0x05, 0x4E, 0x30, 0x94, 0x5E, 0x30, 0x84, 0xD0, 0x56, 0xE3, 0x07,
+    0x4D, 0x05, 0x7E, 0x30, 0x64, 0x98, 0x9E, 0x29, 0x90, 0xFA, 0x4C, 0x5B,
+    0x7A, 0x31, 0x39, 0x32, 0x38, 0x42, 0x38, 0x33, 0x37, 0x34, 0x37, 0x35,
+    0x35, 0x36, 0x34, 0x46, 0x34, 0x37, 0x33, 0x38, 0x32, 0x49, 0x31, 0x3A,
+    0x7A, 0x6B, 0x30, 0x1D, 0xF0, 0xDF, 0x01, 0x05, 0x44, 0x54, 0x53, 0x2F,
+    0x04, 0x36, 0x30, 0xB8, 0xCD, 0x09, 0xD2, 0x7D, 0x45, 0x66, 0x64, 0x59,
+    0x54, 0x4B, 0x4F, 0xD6, 0x4D, 0x63, 0xD6, 0x4D, 0x46, 0x9D, 0x16, 0xD3,
+    0x5C, 0x24, 0x47, 0x84, 0x35, 0xB4, 0x34, 0xC4, 0x2F, 0x4C, 0x43, 0x4B,
+    0x53, 0x4A, 0x63, 0x65, 0x94, 0xD1, 0x16, 0x2D, 0x02, 0x63, 0xB4, 0x55,
+    0x68, 0x41, 0xF7, 0x4D, 0x75, 0xD1, 0xE3, 0x06, 0x4D, 0x74, 0xD8, 0x45,
+    0x5B, 0x43, 0x99, 0x41, 0xC8, 0xD5, 0x64, 0x14, 0x56, 0x57, 0x85, 0x56,
+    0xA5, 0x45, 0xC4, 0x36, 0xC4, 0x35, 0xD0, 0x4E, 0x23, 0x4D, 0x14, 0x25,
+    0xD1, 0x4E, 0x22, 0x4D, 0x14, 0x34, 0xD0, 0x52, 0x5D, 0x04, 0x36, 0xB5,
+    0x36, 0xA5, 0x47, 0x85, 0x58, 0x56, 0x54, 0x1D, 0x25, 0x42, 0xC7, 0x43,
+    0xAD, 0x46, 0xA0, 0xA7, 0xD0, 0xB9, 0xD1, 0x7D, 0x35, 0x75, 0x54, 0x68,
+    0x53, 0x5A, 0x42, 0x5B, 0x42, 0x4C, 0x41, 0x5D, 0x3F, 0x01, 0x4D, 0x45,
+    0xD4, 0xE4, 0x4D, 0x5F, 0x4C, 0x42, 0x5A, 0x44, 0x58, 0x54, 0x65, 0x66,
+    0xD2, 0x7D, 0x19, 0xCC, 0x7A, 0xD9, 0x5E, 0x3D, 0x94, 0xD9, 0x51, 0xF0,
+    0xD8, 0x4C, 0x65, 0x4A, 0xA3, 0x48, 0xC2, 0x57, 0xD1, 0x14, 0x76, 0x59,
+    0x66, 0x87, 0x65, 0xA6, 0x55, 0xB5, 0x64, 0xC5, 0x55, 0xC5, 0x54, 0xD1,
+    0x45, 0x4D, 0x05, 0x45, 0xD0, 0x45, 0xE2, 0x4D, 0x14, 0x54, 0xD0, 0x55,
+    0x4D, 0x04, 0x6F, 0x4C, 0x56, 0x5A, 0x67, 0x58, 0x77, 0x65, 0x88, 0xD6,
+    0x9D, 0x01, 0x4A, 0xA3, 0x4C, 0x6D, 0x30, 0xB6, 0xD1, 0xBB, 0xD1, 0x7D,
+    0x36, 0x75, 0x65, 0x59, 0x53, 0x5A, 0x53, 0x4C, 0x4F, 0x24, 0xD0, 0x41,
+    0x4D, 0x14, 0xF1, 0xD9, 0xF0, 0xD9, 0x1E, 0x34, 0xD6, 0x4D, 0x04, 0x25,
+    0xB4, 0x45, 0x95, 0x46, 0x66, 0x6D, 0x38, 0xD1, 0xAB, 0xD1, 0x7A, 0xA5,
+    0x87, 0x78, 0x77, 0x75, 0x4E, 0x20, 0x64, 0xA5, 0x5F, 0x02, 0xB3, 0xC7,
+    0x46, 0xE3, 0x04, 0x4A, 0x57, 0xE3, 0x03, 0x4A, 0x58, 0xE3, 0x02, 0x49,
+    0xE4, 0x01, 0x4A, 0xF4, 0xB0, 0xC6, 0xD6, 0xA3, 0x49, 0xC2, 0x38, 0xD2,
+    0x13, 0x86, 0x58, 0x75, 0x87, 0x65, 0xA6, 0x64, 0xB5, 0x2F, 0x04, 0x4C,
+    0x52, 0xF0, 0x34, 0xD0, 0x55, 0x4D, 0x04, 0x63, 0xD1, 0x45, 0x4D, 0x14,
+    0x3F, 0x02, 0x4D, 0x05, 0x54, 0xD0, 0x46, 0x4C, 0x56, 0x4B, 0x66, 0x5A,
+    0x67, 0x58, 0x68, 0x65, 0x89, 0xD0, 0x14, 0x9C, 0x24, 0xAA, 0x24, 0xD0,
+    0x64, 0x4D, 0xA4, 0xD9, 0x47, 0x4B, 0x57, 0x4A, 0x58, 0x66, 0x79, 0xD4,
+    0xAD, 0x3D, 0x0C, 0xD4, 0x8D, 0x10, 0xF7, 0x4D, 0x55, 0xCE, 0x30, 0x64,
+    0xD5, 0x4D, 0x64, 0x56, 0x84, 0x39, 0x74, 0x1C, 0x6D, 0x45, 0x94, 0x64,
+    0x77, 0x54, 0x69, 0x44, 0x5A, 0x4F, 0x35, 0xB4, 0x34, 0xC4, 0xF3, 0x4B,
+    0x43, 0x5B, 0x41, 0xF0, 0x24, 0xC4, 0x1F, 0x02, 0x4B, 0x42, 0xF0, 0x14,
+    0xC4, 0x34, 0xB5, 0x2F, 0x01, 0x4B, 0x43, 0xF4, 0xC4, 0x34, 0xB4, 0x40,
+    0xF7, 0x4E, 0x26, 0x41, 0xE3, 0x0B, 0xE2, 0x05, 0x42, 0xE4, 0x04, 0x43,
+    0xE4, 0x03, 0x44, 0xE4, 0x02, 0x45, 0xE4, 0x01, 0x46, 0xF4, 0x70, 0xE4,
+    0xD0, 0x41, 0xE3, 0x0D, 0xF0, 0x15, 0x2E, 0x30, 0xB4, 0x3E, 0x40, 0xA4,
+    0x4E, 0x30, 0x94, 0xD0, 0x55, 0xE3, 0x08, 0x46, 0xE4, 0x07, 0x47, 0xE3,
+    0x06, 0x4D, 0x05, 0xD0, 0x4D, 0x05, 0xA8, 0x98, 0xA7, 0xB5, 0xD0, 0xF7,
+    0x4D, 0x75, 0xD1, 0xE3, 0x06, 0x4D, 0x2F, 0x05, 0x4D, 0x84, 0xA5, 0x64,
+    0x95, 0x74, 0x85, 0x74, 0x75, 0x94, 0x65, 0xA4, 0x55, 0xB4, 0x45, 0xB5,
+    0x35, 0xC4, 0x34, 0xD1, 0x41, 0x7D, 0x0C, 0xD0, 0x71, 0x4C, 0x72, 0x5B,
+    0x64, 0x4B, 0x55, 0x58, 0xF0, 0x24, 0x74, 0x95, 0x75, 0x84, 0x94, 0x84,
+    0x95, 0x6F, 0x01, 0x4A, 0x46, 0x4B, 0x55, 0x4C, 0x45, 0x4C, 0x54, 0xF7,
+    0x4E, 0x46, 0x41, 0xE4, 0x05, 0x42, 0xE4, 0x04, 0x43, 0xE4, 0x03, 0x44,
+    0xE4, 0x02, 0x45, 0xE4, 0x01, 0x46, 0xF4, 0x70, 0xD0, 0x68, 0x67, 0x52,
+    0x95, 0x96, 0x42, 0xB3, 0xB5, 0x41, 0xC2, 0xD0, 0x48, 0x4A, 0x46, 0x46,
+    0x78, 0x65, 0x36, 0x96, 0x84, 0x35, 0xA5, 0x94, 0xE2, 0x34, 0xB4, 0xA4,
+    0x34, 0xA4, 0xB4, 0x24, 0xB4, 0xA5, 0xF2, 0x4B, 0x4A, 0x43, 0x4A, 0x5A,
+    0x43, 0x4A, 0x4B, 0x42, 0x5A, 0x4A, 0x42, 0xF0, 0x14, 0xB4, 0xA4, 0x2F,
+    0x01, 0x4A, 0x4B, 0x42, 0x5A, 0x4A, 0x43, 0xF4, 0xB4, 0xA4, 0x34, 0xA4,
+    0xB4, 0x30, 0xD0, 0x68, 0x52, 0xA6, 0x42, 0xC5, 0x41, 0xD0, 0x58, 0x56,
+    0x46, 0x85, 0x36, 0xA4, 0xF3, 0x5B, 0x4F, 0x34, 0xC4, 0x34, 0xB4, 0x1E,
+    0x20, 0x24, 0xC4, 0x34, 0xB5, 0x34, 0xB4, 0x2E, 0x20, 0x14, 0xC4, 0x34,
+    0xB5, 0x34, 0xB4, 0x35, 0xB4, 0x3F, 0x4C, 0x43, 0x4B, 0x44, 0xB6, 0xD1,
+    0xBA, 0xD2, 0x7D, 0x36, 0x75, 0x65, 0x58, 0x54, 0x5A, 0x53, 0x4C, 0x4F,
+    0x24, 0xD0, 0x4E, 0x21, 0x4D, 0x18, 0xD2, 0x4E, 0x20, 0x4D, 0x14, 0x1F,
+    0x4D, 0x04, 0x24, 0xC4, 0x35, 0xA5, 0x45, 0x85, 0x56, 0x57, 0x6D, 0x37,
+    0xD1, 0xBB, 0xD1, 0x6B, 0xD3, 0x6C, 0x43, 0xAA, 0x41, 0xD0, 0x8D, 0x68,
+    0x41, 0x45, 0x67, 0x78, 0x57, 0x6A, 0x56, 0x5C, 0x4E, 0x25, 0x5D, 0x04,
+    0xF5, 0x4D, 0x14, 0x45, 0xD1, 0x4E, 0x24, 0x4D, 0x14, 0x45, 0xD0, 0x54,
+    0x5D, 0x04, 0x55, 0xC5, 0x56, 0xA5, 0x67, 0x85, 0x69, 0x57, 0x64, 0x1D,
+    0x27, 0x42, 0xD0, 0x84, 0x3A, 0xA4, 0x47, 0xB5, 0xD8, 0xE3, 0x01, 0x4D,
+    0x95, 0xD9, 0xE2, 0x4D, 0xA0, 0xB6, 0xD4, 0xB3, 0x47, 0xD0, 0x24, 0x6D,
+    0x11, 0x55, 0x65, 0x95, 0x58, 0x84, 0x5A, 0x74, 0x4B, 0x73, 0x4D, 0x06,
+    0x34, 0xD0, 0x52, 0xE2, 0x01, 0x4D, 0x15, 0x2E, 0x34, 0xD1, 0x53, 0x4D,
+    0x06, 0x3F, 0x4C, 0x64, 0x5A, 0x75, 0x58, 0x85, 0x65, 0xA6, 0xD1, 0x14,
+    0x8C, 0x24, 0x9A, 0x25, 0xB6, 0x45, 0x5E, 0x20, 0xD3, 0x46, 0xF0, 0xD2,
+    0x56, 0xF0, 0xD2, 0x47, 0xF0, 0xD1, 0x57, 0xD0, 0x44, 0x52, 0x64, 0x42,
+    0x74, 0x41, 0x75, 0x98, 0x76, 0xF0, 0x36, 0xB5, 0x9E, 0x20, 0x34, 0xAE,
+    0x40, 0x24, 0xC5, 0xBE, 0x30, 0x14, 0xC5, 0xCE, 0x24, 0xD0, 0xA7, 0xCB,
+    0x8D, 0x16, 0xD2, 0x56, 0x56, 0x44, 0x94, 0x35, 0x94, 0x34, 0xA4, 0xF3,
+    0x4D, 0x45, 0xD3, 0x8D, 0x1B, 0xBC, 0xBC, 0xCA, 0xD2, 0x6D, 0x44, 0x1F,
+    0x4C, 0x41, 0x4B, 0x51, 0x59, 0x52, 0x67, 0x63, 0xD4, 0x4D, 0x37, 0xCB,
+    0x88, 0xF6, 0x43, 0xE3, 0x05, 0x44, 0xF0, 0x1C, 0x1B, 0x1F, 0x04, 0x45,
+    0xE4, 0x03, 0x46, 0xE4, 0x02, 0x47, 0xE3, 0x01, 0x48, 0x58, 0xF4, 0x9F,
+    0x86, 0x68, 0x56, 0x44, 0xC4, 0xF4, 0x4B, 0x44, 0x5B, 0x41, 0xF0, 0x34,
+    0xC4, 0x1F, 0x03, 0x4B, 0x44, 0x5B, 0x42, 0xF0, 0x24, 0xC4, 0x44, 0xB5,
+    0x44, 0xB4, 0x3E, 0x20, 0x14, 0xC4, 0x44, 0xB5, 0x44, 0xB4, 0x44, 0xB5,
+    0x44, 0xA6, 0x44, 0x97, 0x45, 0x69, 0x4D, 0x66, 0xD0, 0x14, 0x7A, 0x34,
+    0x87, 0xD1, 0x04, 0xD0, 0x9D, 0x04, 0x14, 0xC5, 0x14, 0xC4, 0x2F, 0x01,
+    0x4A, 0x44, 0x49, 0x45, 0x48, 0x55, 0x48, 0x46, 0x47, 0x56, 0x47, 0x47,
+    0x46, 0x49, 0x36, 0x49, 0x44, 0x4A, 0x43, 0x5A, 0x43, 0x49, 0xF0, 0x24,
+    0x24, 0xC4, 0x14, 0xD1, 0x31, 0x4D, 0x17, 0xCF, 0x03, 0x6D, 0x0F, 0x03,
+    0x5D, 0x10, 0x04, 0x95, 0xA4, 0x14, 0x95, 0x95, 0x1F, 0x48, 0x69, 0x42,
+    0x48, 0x68, 0x43, 0x47, 0x78, 0x43, 0x47, 0x31, 0x37, 0x45, 0x36, 0x41,
+    0x37, 0x45, 0x36, 0x32, 0x36, 0x46, 0x35, 0x42, 0x36, 0x46, 0x35, 0x42,
+    0x44, 0x47, 0x43, 0x43, 0x44, 0x47, 0x43, 0x43, 0x43, 0x48, 0x43, 0x34,
+    0x43, 0x48, 0x42, 0x44, 0x42, 0x49, 0x42, 0x36, 0x32, 0x49, 0x41, 0x46,
+    0x31, 0x4A, 0x41, 0x37, 0x31, 0x49, 0xF0, 0x18, 0x77, 0xB7, 0x86, 0xD0,
+    0x68, 0x6B, 0xF0, 0x25, 0x95, 0xD1, 0x4A, 0x4D, 0x00, 0x64, 0xB5, 0x65,
+    0xA4, 0x84, 0x94, 0x94, 0x84, 0xB4, 0x64, 0xC4, 0x55, 0xC5, 0x35, 0xD1,
+    0x42, 0x5D, 0x25, 0x14, 0xD4, 0x8D, 0x57, 0x9F, 0x0B, 0x5D, 0x76, 0xD6,
+    0x7D, 0x59, 0xD3, 0x51, 0x4D, 0x25, 0x25, 0xD1, 0x44, 0x4D, 0x04, 0x55,
+    0xB4, 0x74, 0xA4, 0x85, 0x85, 0x94, 0x75, 0xA5, 0x55, 0xC4, 0x50, 0x64,
+    0xD0, 0x4F, 0x64, 0xC4, 0x1F, 0x06, 0x4B, 0x48, 0x59, 0x4A, 0x48, 0x5A,
+    0x48, 0x44, 0xF0, 0x74, 0x74, 0x5F, 0x07, 0x46, 0x4D, 0x04, 0x54, 0xD1,
+    0x45, 0x3D, 0x34, 0x34, 0x8F, 0x08, 0x42, 0x49, 0xF0, 0x84, 0x14, 0xD5,
+    0x8B, 0xF0, 0x87, 0xCF, 0x09, 0x5D, 0x0F, 0x09, 0x4D, 0x94, 0xD2, 0xF0,
+    0x74, 0xD9, 0x4D, 0x95, 0xD5, 0x8D, 0x58, 0xD6, 0x7D, 0x75, 0xD9, 0x7D,
+    0x5F, 0x6D, 0x66, 0xD5, 0xD7, 0x5D, 0x65, 0xD6, 0x5D, 0x65, 0xD6, 0x5D,
+    0x64, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x65, 0xD6, 0x5D, 0x65, 0xD6, 0x5D,
+    0x65, 0xD6, 0x5D, 0x65, 0xD6, 0x4D, 0x6E, 0x30, 0x1D, 0x74, 0xB5, 0x96,
+    0x97, 0x94, 0x4E, 0x20, 0x74, 0x5E, 0x30, 0x64, 0xB5, 0x6E, 0x30, 0x54,
+    0x7F, 0x04, 0x4B, 0x4B, 0x4A, 0x5B, 0x3D, 0x04, 0xD0, 0x4B, 0xE4, 0x02,
+    0x3D, 0x04, 0xB5, 0xAE, 0x30, 0x14, 0xBE, 0x24, 0xCF, 0x3D, 0x04, 0xCF,
+    0x6B, 0x5A, 0xF9, 0x3F, 0x92, 0x1E, 0x20, 0x83, 0x92, 0x2E, 0x30, 0x73,
+    0x92, 0x3E, 0x20, 0x63, 0x3F, 0x06, 0x24, 0xE2, 0x05, 0x39, 0x25, 0xE3,
+    0x04, 0x39, 0x26, 0xE3, 0x03, 0x39, 0x27, 0xE2, 0x02, 0x39, 0x28, 0xE3,
+    0x01, 0x39, 0x29, 0xF3, 0xA2, 0x90, 0xFA, 0x5B, 0x6C, 0x4F, 0xD0, 0x3E,
+    0x2C, 0x4E, 0x3B, 0x4B, 0x5B, 0x42, 0xE4, 0x0B, 0x3D, 0x04, 0xD0, 0x4D,
+    0x03, 0xB5, 0xA4, 0xB4, 0x3F, 0x08, 0x44, 0xE3, 0x07, 0x4B, 0x55, 0xE3,
+    0x06, 0x46, 0xE2, 0x05, 0x4B, 0x49, 0x79, 0x69, 0x5B, 0x44, 0xD2, 0x89,
+    0x22, 0xA6, 0x31, 0x33, 0x64, 0x32, 0x26, 0xB1, 0x29, 0x8D, 0x24, 0x40};
+
+const GFXglyph FreeSansOblique24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 13, 0, 1},          // 0x20 ' '
+    {0, 11, 34, 13, 6, -33},      // 0x21 '!'
+    {26, 13, 12, 17, 8, -32},     // 0x22 '"'
+    {38, 28, 34, 26, 3, -32},     // 0x23 '#'
+    {113, 26, 42, 26, 3, -35},    // 0x24 '$'
+    {201, 36, 34, 42, 6, -32},    // 0x25 '%'
+    {299, 26, 34, 31, 4, -32},    // 0x26 '&'
+    {368, 5, 12, 9, 8, -32},      // 0x27 '''
+    {376, 15, 44, 16, 5, -33},    // 0x28 '('
+    {413, 15, 44, 16, 1, -33},    // 0x29 ')'
+    {449, 14, 13, 18, 8, -33},    // 0x2A '*'
+    {470, 23, 22, 27, 5, -20},    // 0x2B '+'
+    {493, 7, 12, 13, 3, -4},      // 0x2C ','
+    {506, 12, 4, 16, 5, -14},     // 0x2D '-'
+    {510, 6, 5, 13, 4, -4},       // 0x2E '.'
+    {515, 21, 35, 13, -1, -33},   // 0x2F '/'
+    {567, 23, 34, 26, 5, -32},    // 0x30 '0'
+    {622, 13, 33, 26, 10, -32},   // 0x31 '1'
+    {652, 27, 33, 26, 2, -32},    // 0x32 '2'
+    {706, 25, 34, 26, 3, -32},    // 0x33 '3'
+    {761, 24, 33, 26, 3, -32},    // 0x34 '4'
+    {815, 27, 34, 26, 3, -32},    // 0x35 '5'
+    {867, 24, 34, 26, 4, -32},    // 0x36 '6'
+    {930, 26, 33, 26, 6, -32},    // 0x37 '7'
+    {978, 25, 34, 26, 3, -32},    // 0x38 '8'
+    {1037, 24, 34, 26, 4, -32},   // 0x39 '9'
+    {1096, 10, 25, 13, 5, -24},   // 0x3A ':'
+    {1109, 11, 32, 13, 4, -24},   // 0x3B ';'
+    {1130, 26, 23, 27, 4, -22},   // 0x3C '<'
+    {1165, 26, 12, 27, 3, -16},   // 0x3D '='
+    {1180, 26, 23, 27, 2, -21},   // 0x3E '>'
+    {1215, 20, 35, 26, 9, -34},   // 0x3F '?'
+    {1261, 45, 42, 48, 4, -34},   // 0x40 '@'
+    {1395, 30, 34, 31, 1, -33},   // 0x41 'A'
+    {1465, 29, 34, 31, 4, -33},   // 0x42 'B'
+    {1528, 30, 36, 33, 5, -34},   // 0x43 'C'
+    {1592, 31, 34, 33, 4, -33},   // 0x44 'D'
+    {1661, 31, 34, 31, 4, -33},   // 0x45 'E'
+    {1709, 30, 34, 28, 4, -33},   // 0x46 'F'
+    {1755, 33, 36, 37, 5, -34},   // 0x47 'G'
+    {1832, 33, 34, 34, 4, -33},   // 0x48 'H'
+    {1898, 11, 34, 13, 5, -33},   // 0x49 'I'
+    {1933, 25, 35, 24, 2, -33},   // 0x4A 'J'
+    {1976, 34, 34, 31, 4, -33},   // 0x4B 'K'
+    {2058, 22, 34, 26, 4, -33},   // 0x4C 'L'
+    {2101, 39, 34, 40, 4, -33},   // 0x4D 'M'
+    {2215, 34, 34, 34, 4, -33},   // 0x4E 'N'
+    {2302, 33, 36, 36, 5, -34},   // 0x4F 'O'
+    {2373, 29, 34, 30, 4, -33},   // 0x50 'P'
+    {2429, 33, 38, 36, 5, -34},   // 0x51 'Q'
+    {2504, 30, 34, 33, 4, -33},   // 0x52 'R'
+    {2570, 29, 36, 31, 4, -34},   // 0x53 'S'
+    {2635, 28, 34, 29, 7, -33},   // 0x54 'T'
+    {2680, 31, 35, 34, 6, -33},   // 0x55 'U'
+    {2750, 29, 34, 30, 8, -33},   // 0x56 'V'
+    {2824, 43, 34, 44, 8, -33},   // 0x57 'W'
+    {2947, 36, 34, 31, 1, -33},   // 0x58 'X'
+    {3027, 30, 34, 32, 8, -33},   // 0x59 'Y'
+    {3090, 34, 34, 29, 1, -33},   // 0x5A 'Z'
+    {3139, 18, 44, 13, 1, -33},   // 0x5B '['
+    {3178, 6, 35, 13, 7, -33},    // 0x5C '\'
+    {3198, 18, 44, 13, -1, -33},  // 0x5D ']'
+    {3237, 17, 18, 22, 6, -32},   // 0x5E '^'
+    {3267, 29, 2, 26, -3, 7},     // 0x5F '_'
+    {3271, 8, 7, 16, 8, -34},     // 0x60 '`'
+    {3279, 23, 27, 26, 3, -25},   // 0x61 'a'
+    {3326, 25, 35, 26, 3, -33},   // 0x62 'b'
+    {3387, 22, 27, 24, 4, -25},   // 0x63 'c'
+    {3425, 27, 35, 26, 4, -33},   // 0x64 'd'
+    {3487, 23, 27, 26, 4, -25},   // 0x65 'e'
+    {3527, 15, 34, 12, 3, -33},   // 0x66 'f'
+    {3557, 27, 36, 26, 2, -25},   // 0x67 'g'
+    {3630, 23, 34, 25, 3, -33},   // 0x68 'h'
+    {3684, 11, 34, 10, 3, -33},   // 0x69 'i'
+    {3707, 18, 44, 11, -2, -33},  // 0x6A 'j'
+    {3743, 25, 34, 24, 3, -33},   // 0x6B 'k'
+    {3803, 11, 34, 10, 3, -33},   // 0x6C 'l'
+    {3824, 36, 26, 38, 3, -25},   // 0x6D 'm'
+    {3890, 23, 26, 25, 3, -25},   // 0x6E 'n'
+    {3934, 23, 27, 26, 4, -25},   // 0x6F 'o'
+    {3976, 27, 36, 26, 1, -25},   // 0x70 'p'
+    {4037, 26, 36, 26, 3, -25},   // 0x71 'q'
+    {4099, 17, 26, 15, 3, -25},   // 0x72 'r'
+    {4126, 21, 27, 24, 3, -25},   // 0x73 's'
+    {4165, 13, 32, 12, 4, -30},   // 0x74 't'
+    {4191, 24, 26, 25, 4, -24},   // 0x75 'u'
+    {4238, 22, 25, 23, 6, -24},   // 0x76 'v'
+    {4286, 33, 25, 34, 6, -24},   // 0x77 'w'
+    {4365, 26, 25, 23, 1, -24},   // 0x78 'x'
+    {4415, 27, 35, 23, 0, -24},   // 0x79 'y'
+    {4475, 25, 25, 23, 1, -24},   // 0x7A 'z'
+    {4510, 16, 44, 16, 5, -33},   // 0x7B '{'
+    {4550, 12, 44, 12, 3, -33},   // 0x7C '|'
+    {4590, 16, 44, 16, -1, -33},  // 0x7D '}'
+    {4629, 21, 7, 27, 6, -19}};   // 0x7E '~'
+
+const GFXpackedFont FreeSansOblique24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeSansOblique24pt7bRLEBitmaps,
+     (GFXglyph *)FreeSansOblique24pt7bRLEGlyphs, 0x20, 0x7E, 56},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 5317 bytes, glyph bitmaps 4644 bytes (8811 uncompressed)
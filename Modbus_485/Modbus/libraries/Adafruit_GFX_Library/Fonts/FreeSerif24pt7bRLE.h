@@ -0,0 +1,401 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeSerif24pt7bRLEBitmaps[] PROGMEM = {
+    0x13, 0x14, 0x1E, 0x65, 0xE6, 0x13, 0x22, 0x2E, 0x60, 0x21, 0x2E, 0x20,
+    0x63, 0x1E, 0x25, 0x13, 0x10, 0x12, 0x62, 0x1E, 0x44, 0x44, 0xE5, 0x12,
+    0x62, 0x10, 0xE3, 0x83, 0x63, 0xB3, 0x62, 0xC2, 0x72, 0xC2, 0x63, 0x4E,
+    0x20, 0x73, 0x63, 0x4F, 0x01, 0xD9, 0x72, 0x72, 0x5E, 0x40, 0x63, 0x63,
+    0xB2, 0x72, 0x6F, 0xD9, 0x1E, 0x20, 0x53, 0x63, 0xB2, 0x73, 0xB2, 0x72,
+    0x7E, 0x40, 0x43, 0x63, 0x70, 0xE2, 0x91, 0xD2, 0x79, 0x42, 0x12, 0x54,
+    0x34, 0x14, 0x42, 0x35, 0x15, 0x31, 0xF3, 0x61, 0x62, 0x13, 0x61, 0x71,
+    0x13, 0x61, 0x94, 0x51, 0xA4, 0x41, 0xA6, 0x21, 0xB8, 0xC7, 0xD1, 0x7D,
+    0x08, 0xD0, 0x8C, 0x8B, 0x11, 0x7A, 0x13, 0x5A, 0x14, 0x59, 0x15, 0x49,
+    0x16, 0x3F, 0x01, 0x81, 0x63, 0xF0, 0x27, 0x16, 0x66, 0x15, 0x31, 0x45,
+    0x14, 0x33, 0x53, 0x12, 0x45, 0xD0, 0x97, 0x7E, 0x20, 0x91, 0x90, 0x75,
+    0xC2, 0xC8, 0x94, 0xB4, 0x34, 0x64, 0xB4, 0x77, 0x12, 0xB4, 0x81, 0x63,
+    0xB4, 0x81, 0x62, 0xB4, 0x91, 0x53, 0xB3, 0xA1, 0x52, 0xB4, 0xA1, 0x43,
+    0xB4, 0x91, 0x52, 0xC3, 0xA1, 0x43, 0xC3, 0x92, 0x42, 0xD0, 0x39, 0x14,
+    0x2D, 0x13, 0x81, 0x43, 0x65, 0x42, 0x72, 0x42, 0x59, 0x23, 0x43, 0x43,
+    0x45, 0x32, 0x38, 0x52, 0x44, 0x62, 0x35, 0x63, 0x34, 0x81, 0xD1, 0x24,
+    0x48, 0x1D, 0x03, 0x34, 0x91, 0xD0, 0x24, 0x3A, 0x1C, 0x24, 0x4A, 0x1B,
+    0x34, 0x49, 0x2B, 0x25, 0x3A, 0x1B, 0x35, 0x39, 0x2B, 0x26, 0x39, 0x1B,
+    0x36, 0x38, 0x2B, 0x27, 0x37, 0x2B, 0x38, 0x34, 0x3C, 0x2A, 0x8C, 0x2C,
+    0x5D, 0x03, 0xDB, 0xB5, 0xDD, 0x8D, 0xA3, 0x43, 0xD8, 0x36, 0x2D, 0x82,
+    0x82, 0xCE, 0x20, 0x73, 0x82, 0xD6, 0x37, 0x3D, 0x64, 0x53, 0xD7, 0x44,
+    0x3D, 0x94, 0x23, 0xDA, 0x84, 0xAA, 0x68, 0x6C, 0x5A, 0x4C, 0x79, 0x3B,
+    0x31, 0x59, 0x3A, 0x42, 0x58, 0x2A, 0x43, 0x57, 0x2A, 0x45, 0x56, 0x29,
+    0x55, 0x55, 0x2A, 0x47, 0x54, 0x2A, 0x48, 0x52, 0x2A, 0x58, 0x61, 0x1B,
+    0x59, 0x7B, 0x5A, 0x5C, 0x5A, 0x6B, 0x6A, 0x69, 0x79, 0x88, 0x11, 0x67,
+    0x31, 0x74, 0x22, 0x74, 0x43, 0xC3, 0xC6, 0x97, 0x7B, 0x64, 0x12, 0x1E,
+    0x44, 0xE5, 0x12, 0x10, 0xB1, 0xA1, 0x92, 0x92, 0x92, 0x92, 0x93, 0x92,
+    0x93, 0x6E, 0x20, 0x23, 0x84, 0x7F, 0x01, 0x38, 0xE9, 0x48, 0xF0, 0x13,
+    0x94, 0x7E, 0x20, 0x23, 0xA3, 0x6F, 0x04, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+    0x2B, 0x20, 0x02, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xA3, 0xA2, 0xA3, 0x3E,
+    0x20, 0x73, 0x94, 0x1F, 0x08, 0x31, 0xE9, 0x08, 0x4F, 0x83, 0x84, 0x1E,
+    0x20, 0x73, 0x83, 0x92, 0x93, 0x83, 0x92, 0x92, 0x92, 0x91, 0xA1, 0xB0,
+    0xE2, 0x63, 0x81, 0x43, 0x42, 0x13, 0x41, 0x48, 0x31, 0x3A, 0x21, 0x25,
+    0x34, 0x11, 0x14, 0x85, 0xD0, 0x1D, 0x05, 0x92, 0x21, 0x22, 0x45, 0x21,
+    0x34, 0x14, 0x31, 0x47, 0x41, 0x53, 0xE3, 0x63, 0x70, 0xEA, 0xA3, 0xAF,
+    0xDA, 0xE9, 0xA3, 0xA0, 0x13, 0x25, 0x1F, 0x61, 0x5F, 0x51, 0xF4, 0x13,
+    0x23, 0x23, 0xF0, 0xB0, 0x13, 0x1E, 0x25, 0x13, 0x10, 0xB3, 0xE2, 0xA3,
+    0x1E, 0x20, 0x93, 0x2E, 0x20, 0x83, 0x3E, 0x20, 0x73, 0x4F, 0x06, 0x3A,
+    0x45, 0xF0, 0x53, 0xA4, 0x6F, 0x04, 0x3A, 0x47, 0xF0, 0x33, 0xA4, 0x8F,
+    0x02, 0x3A, 0x49, 0xF0, 0x13, 0xA4, 0xA3, 0xB0, 0x86, 0xD1, 0x34, 0x3B,
+    0x36, 0x39, 0x38, 0x37, 0x48, 0x45, 0x4A, 0x33, 0xF0, 0x24, 0xA4, 0x35,
+    0xA5, 0x1F, 0x01, 0x4C, 0x41, 0xEA, 0x5C, 0x5F, 0x14, 0xC4, 0x25, 0xA5,
+    0x1F, 0x02, 0x4A, 0x45, 0x3A, 0x36, 0x48, 0x47, 0x38, 0x39, 0x36, 0x3B,
+    0x34, 0x3D, 0x16, 0x80, 0x81, 0xA3, 0x85, 0x67, 0x42, 0x34, 0x4E, 0xDB,
+    0x05, 0x48, 0x64, 0xC0, 0x76, 0xD0, 0xA9, 0xD1, 0x63, 0x67, 0x52, 0x95,
+    0x42, 0xB5, 0x31, 0xC5, 0x22, 0xD0, 0x42, 0x1D, 0x14, 0x2F, 0x0D, 0x24,
+    0x2F, 0x0D, 0x23, 0x3F, 0x0D, 0x13, 0x4F, 0x0D, 0x03, 0xD4, 0x3D, 0x52,
+    0xD5, 0x2D, 0x52, 0xD5, 0x2D, 0x52, 0xD5, 0x2D, 0x52, 0xD5, 0x2D, 0x01,
+    0x42, 0xD1, 0x13, 0x2D, 0x11, 0x3D, 0x52, 0xD5, 0x2D, 0x62, 0x67, 0x9A,
+    0x72, 0x55, 0x51, 0x94, 0x31, 0xA4, 0x31, 0xB3, 0x21, 0xC3, 0xD2, 0x3D,
+    0x22, 0xD2, 0x2D, 0x31, 0xD2, 0x2D, 0x24, 0xC8, 0x8B, 0xB8, 0xD0, 0x5D,
+    0x15, 0xFD, 0x14, 0xE3, 0xD2, 0x3F, 0xD2, 0x21, 0xF0, 0xD1, 0x23, 0x39,
+    0x23, 0x65, 0x34, 0xC8, 0x88, 0xD1, 0x25, 0xF0, 0xD0, 0x3D, 0x44, 0x5F,
+    0x0B, 0x5D, 0x22, 0x13, 0xD1, 0x22, 0x3D, 0x11, 0x33, 0xD0, 0x23, 0x3C,
+    0x24, 0x35, 0xF0, 0x62, 0x53, 0xA2, 0x63, 0x5F, 0x04, 0x27, 0x38, 0x28,
+    0x37, 0x29, 0x37, 0x1A, 0x36, 0x2A, 0x35, 0x2B, 0x35, 0xFD, 0x8E, 0x7D,
+    0x03, 0x50, 0xD4, 0x17, 0xC1, 0xF0, 0x5C, 0x2F, 0x04, 0x2D, 0x0F, 0x03,
+    0x2D, 0x43, 0xD2, 0x8B, 0xA8, 0xD0, 0x9B, 0xC8, 0xD0, 0x7D, 0x15, 0xD2,
+    0x4D, 0x25, 0x1F, 0x0D, 0x14, 0x1E, 0x40, 0xD2, 0x3D, 0x32, 0xD3, 0x3D,
+    0x32, 0xD3, 0x33, 0x48, 0x34, 0x65, 0x35, 0xC9, 0x7A, 0xD3, 0x4D, 0x15,
+    0xD0, 0x5D, 0x15, 0xD2, 0x5D, 0x25, 0xD2, 0x5D, 0x25, 0xD2, 0x5D, 0x26,
+    0xD2, 0x5D, 0x26, 0xD2, 0x53, 0x67, 0x51, 0xA4, 0x75, 0x63, 0x68, 0x52,
+    0x59, 0x61, 0x5A, 0x51, 0x5A, 0x6E, 0x40, 0x5B, 0x51, 0x4B, 0x5F, 0x15,
+    0xA4, 0x34, 0x95, 0x35, 0x84, 0x55, 0x64, 0x75, 0x44, 0x9B, 0xD0, 0x67,
+    0xF2, 0xD5, 0x2D, 0x42, 0x3C, 0x32, 0x1D, 0x13, 0x12, 0xD0, 0x32, 0x1D,
+    0x13, 0xD4, 0x32, 0xE2, 0x0D, 0x13, 0x3E, 0x20, 0xD0, 0x34, 0xE2, 0x0C,
+    0x35, 0xE2, 0x0B, 0x36, 0xE2, 0x0A, 0x37, 0xE2, 0x09, 0x38, 0xE2, 0x08,
+    0x3D, 0x34, 0xD3, 0x3A, 0x66, 0xAA, 0x64, 0x54, 0x52, 0x93, 0x33, 0x93,
+    0x32, 0xB3, 0x1F, 0x3B, 0x31, 0xF4, 0xA3, 0x24, 0x83, 0x35, 0x63, 0x55,
+    0x43, 0x76, 0x13, 0x97, 0xC7, 0xC7, 0x9A, 0x73, 0x36, 0x53, 0x56, 0x33,
+    0x85, 0x22, 0xA4, 0x1F, 0x3B, 0x4E, 0x20, 0x3C, 0x7B, 0x31, 0x3A, 0x32,
+    0x49, 0x33, 0x55, 0x45, 0xB9, 0x76, 0x76, 0xD0, 0xAA, 0x44, 0x57, 0x46,
+    0x55, 0x48, 0x44, 0x59, 0x42, 0xF0, 0x14, 0xA5, 0x15, 0xB4, 0x1E, 0x45,
+    0xBB, 0xA5, 0xF1, 0x5A, 0x52, 0x58, 0x63, 0x64, 0x75, 0xA2, 0x47, 0x63,
+    0x5D, 0x34, 0xD3, 0x5D, 0x34, 0xD3, 0x5D, 0x25, 0xD3, 0x4D, 0x34, 0xD2,
+    0x5D, 0x25, 0xD1, 0x5D, 0x14, 0xD1, 0x4D, 0x30, 0x13, 0x1E, 0x25, 0x13,
+    0x1E, 0xB0, 0x63, 0x1E, 0x25, 0x13, 0x10, 0x23, 0x1E, 0x20, 0x15, 0x23,
+    0x1E, 0xA0, 0x73, 0x25, 0x1F, 0x61, 0x5F, 0x51, 0xF4, 0x13, 0x23, 0x23,
+    0xDF, 0x0D, 0x43, 0xD6, 0x5D, 0x47, 0xD2, 0x7D, 0x27, 0xD1, 0x8D, 0x18,
+    0xD1, 0x8D, 0x17, 0xD2, 0x7D, 0x27, 0xD4, 0x5D, 0x66, 0xD6, 0x8D, 0x58,
+    0xD5, 0x8D, 0x67, 0xD6, 0x7D, 0x68, 0xD5, 0x8D, 0x58, 0xD6, 0x5D, 0x83,
+    0xDA, 0x10, 0xF0, 0xDB, 0xE6, 0xDB, 0xFD, 0xB0, 0x01, 0xDA, 0x3D, 0x85,
+    0xD6, 0x8D, 0x58, 0xD5, 0x8D, 0x67, 0xD6, 0x7D, 0x68, 0xD5, 0x8D, 0x58,
+    0xD6, 0x6D, 0x65, 0xD4, 0x7D, 0x27, 0xD2, 0x7D, 0x18, 0xD1, 0x8D, 0x18,
+    0xD1, 0x7D, 0x27, 0xD2, 0x7D, 0x45, 0xD6, 0x3D, 0xF0, 0xD4, 0x56, 0x9B,
+    0x52, 0x56, 0x31, 0x95, 0x12, 0x95, 0x13, 0x95, 0xF0, 0x48, 0x51, 0x38,
+    0x5C, 0x5F, 0xC4, 0x1F, 0x0B, 0x4D, 0x03, 0xD0, 0x3D, 0x12, 0xD2, 0x1D,
+    0x22, 0x6F, 0x09, 0x1D, 0x22, 0x7F, 0x08, 0x18, 0xE2, 0x0D, 0xB3, 0x7E,
+    0x20, 0x65, 0xD0, 0x37, 0xD0, 0x8D, 0x8D, 0x1D, 0x36, 0x75, 0xD0, 0x4D,
+    0x03, 0xA5, 0xD3, 0x28, 0x4D, 0x62, 0x64, 0xD8, 0x25, 0x4D, 0x91, 0x44,
+    0xA5, 0x82, 0x34, 0x97, 0x13, 0x41, 0x24, 0x94, 0x35, 0x42, 0x14, 0x83,
+    0x54, 0x61, 0xF0, 0x48, 0x37, 0x36, 0x57, 0x37, 0x46, 0x57, 0x37, 0x37,
+    0x56, 0x38, 0x37, 0x56, 0x38, 0x36, 0x66, 0x37, 0x46, 0x11, 0x46, 0x37,
+    0x37, 0x11, 0x46, 0x36, 0x46, 0x13, 0x45, 0x36, 0x45, 0x23, 0x46, 0x33,
+    0x21, 0x34, 0x25, 0x36, 0x73, 0x76, 0x46, 0x46, 0x55, 0xF0, 0x34, 0xDF,
+    0x01, 0x4D, 0xF0, 0x15, 0xDF, 0x5D, 0x12, 0xD0, 0x68, 0x5D, 0x2D, 0x2D,
+    0x79, 0xA0, 0xD2, 0x1D, 0xF0, 0x32, 0xDF, 0x01, 0x3D, 0xF0, 0x14, 0xDE,
+    0x5D, 0x1F, 0x0D, 0x06, 0xD0, 0xF0, 0xC2, 0x15, 0xDA, 0x23, 0x4D, 0xA2,
+    0x35, 0xD8, 0x34, 0x4B, 0xF0, 0xA2, 0x55, 0xAF, 0x09, 0x27, 0x5D, 0x43,
+    0x84, 0x9F, 0x08, 0x29, 0x5D, 0x22, 0xB5, 0xD1, 0xD5, 0xD0, 0xD7, 0xC2,
+    0xD0, 0x5B, 0x3D, 0x05, 0x6F, 0x05, 0x2D, 0x25, 0x93, 0xD3, 0x58, 0x2D,
+    0x45, 0x73, 0xD4, 0x65, 0x4D, 0x46, 0x46, 0xD3, 0x72, 0x9B, 0xC0, 0x0D,
+    0x6B, 0xD6, 0xA5, 0x76, 0x95, 0x95, 0x85, 0xA5, 0x75, 0xA6, 0x1E, 0x40,
+    0x55, 0xB5, 0x65, 0xA5, 0x75, 0x95, 0x85, 0x76, 0x4F, 0x05, 0xD3, 0xB5,
+    0x77, 0x85, 0xA5, 0x2F, 0x05, 0x5B, 0x51, 0xE4, 0x05, 0x5C, 0x5F, 0x55,
+    0xB5, 0x65, 0xA5, 0x75, 0x77, 0x7D, 0x64, 0xD7, 0x70, 0xB9, 0x61, 0xAD,
+    0x11, 0x38, 0x66, 0x87, 0x5A, 0x66, 0x4D, 0x14, 0x54, 0xD2, 0x44, 0x5D,
+    0x33, 0x35, 0xD5, 0x23, 0x4D, 0x62, 0x1F, 0x01, 0x5D, 0x71, 0x24, 0xDA,
+    0xE9, 0x5D, 0xAE, 0x20, 0x15, 0xDB, 0x5D, 0xA6, 0xDA, 0x5D, 0x51, 0x55,
+    0xD2, 0x36, 0x6C, 0x38, 0x77, 0x4C, 0xD1, 0xD4, 0x89, 0x0D, 0x5D, 0x2D,
+    0x7D, 0x05, 0x78, 0xB5, 0xA6, 0xA5, 0xC6, 0x85, 0xD0, 0x67, 0x5D, 0x15,
+    0x3F, 0x04, 0x5D, 0x25, 0x2F, 0x04, 0x5D, 0x35, 0x55, 0xD3, 0x6E, 0x74,
+    0x5D, 0x45, 0xF4, 0x5D, 0x35, 0x55, 0xD3, 0x46, 0x5D, 0x25, 0x2F, 0x04,
+    0x5D, 0x15, 0x75, 0xC6, 0x85, 0xB5, 0xA5, 0x78, 0x9D, 0x79, 0xD5, 0xD0,
+    0x0D, 0xB5, 0xD9, 0x65, 0xD0, 0x33, 0xF0, 0x35, 0xD1, 0x26, 0x5D, 0x21,
+    0x3E, 0x30, 0x35, 0xD6, 0xF0, 0x35, 0xC1, 0x95, 0xB2, 0x95, 0xA3, 0x6F,
+    0x03, 0xD5, 0x95, 0xA3, 0x95, 0xB2, 0x6F, 0x03, 0x5C, 0x16, 0xE2, 0x03,
+    0x5D, 0x95, 0xD4, 0x23, 0x5D, 0x41, 0x45, 0xD3, 0x24, 0x5D, 0x23, 0x45,
+    0xD1, 0x35, 0x5C, 0x54, 0xDA, 0x2D, 0xC2, 0x0D, 0xB2, 0xD9, 0x35, 0xD0,
+    0x3F, 0x35, 0xD1, 0x23, 0x5D, 0x21, 0xE3, 0x35, 0xD3, 0xF0, 0x35, 0xC1,
+    0x65, 0xB2, 0x65, 0xA3, 0x3F, 0x03, 0xD5, 0x65, 0xA3, 0x65, 0xB2, 0x3F,
+    0x03, 0x5C, 0x13, 0xE8, 0x03, 0x5D, 0x57, 0xD2, 0xCC, 0xC8, 0x81, 0xBD,
+    0x22, 0x39, 0x68, 0x88, 0x5C, 0x67, 0x4D, 0x34, 0x64, 0xD5, 0x35, 0x5D,
+    0x53, 0x45, 0xD7, 0x24, 0x5D, 0x81, 0x2E, 0x20, 0x15, 0xDC, 0xE2, 0x5D,
+    0xD5, 0xD3, 0xD2, 0xD5, 0x71, 0xE3, 0x5D, 0x65, 0x2E, 0x20, 0x15, 0xD5,
+    0x52, 0xF0, 0x25, 0xD4, 0x55, 0x5D, 0x35, 0x56, 0xD2, 0x56, 0x6D, 0x15,
+    0x85, 0xC6, 0x97, 0x77, 0xCD, 0x3D, 0x59, 0xA0, 0x0B, 0x8B, 0x27, 0xC7,
+    0x2E, 0xB0, 0x35, 0xD1, 0x53, 0xF0, 0x3D, 0xB3, 0xEC, 0x03, 0x5D, 0x15,
+    0x57, 0xC7, 0x2B, 0x8B, 0x0D, 0x03, 0x73, 0xED, 0xD0, 0x45, 0x77, 0x3D,
+    0x00, 0x4D, 0x07, 0x73, 0xED, 0xA0, 0x85, 0xC4, 0x63, 0x44, 0x55, 0x34,
+    0x55, 0x24, 0x79, 0x96, 0x90, 0x0D, 0x05, 0xC4, 0x8B, 0x69, 0x5C, 0x4B,
+    0x5C, 0x3C, 0x5B, 0x3D, 0x05, 0xA3, 0xD1, 0x59, 0x3D, 0x25, 0x83, 0xD3,
+    0x57, 0x3D, 0x45, 0x63, 0xD5, 0x55, 0x3D, 0x65, 0x43, 0xD7, 0x52, 0x4D,
+    0x85, 0x14, 0xD9, 0xBD, 0x8C, 0xD7, 0x61, 0x6D, 0x65, 0x36, 0xD5, 0x54,
+    0x6D, 0x45, 0x56, 0xD3, 0x56, 0x6D, 0x25, 0x76, 0xD1, 0x58, 0x6D, 0x05,
+    0x96, 0xC5, 0x97, 0xB5, 0xA6, 0xB5, 0xB6, 0xA5, 0xC6, 0x95, 0xC7, 0x77,
+    0xB9, 0x2D, 0x05, 0xD1, 0x0C, 0xD3, 0x8D, 0x3E, 0xD7, 0x03, 0x5D, 0x85,
+    0xD4, 0x13, 0x5D, 0x32, 0x35, 0xD3, 0x14, 0x5D, 0x22, 0x45, 0xD1, 0x34,
+    0x5B, 0x63, 0xD9, 0x2D, 0xB2, 0x09, 0xD8, 0x92, 0x8D, 0x77, 0x2F, 0x04,
+    0x6D, 0x67, 0x77, 0xD4, 0x87, 0x7D, 0x42, 0x15, 0x72, 0x15, 0xD3, 0x21,
+    0x57, 0x21, 0x5D, 0x23, 0x15, 0x72, 0x16, 0xD1, 0x22, 0x57, 0x22, 0x5D,
+    0x03, 0x25, 0x72, 0x26, 0xC2, 0x35, 0x72, 0x35, 0xB3, 0x35, 0x72, 0x36,
+    0xA2, 0x45, 0x72, 0x45, 0x93, 0x45, 0x72, 0x46, 0x82, 0x55, 0x72, 0x55,
+    0x82, 0x55, 0x72, 0x56, 0x62, 0x65, 0x72, 0x65, 0x62, 0x65, 0x72, 0x66,
+    0x42, 0x75, 0x72, 0x75, 0x42, 0x75, 0x72, 0x75, 0x33, 0x75, 0x72, 0x85,
+    0x22, 0x85, 0x72, 0x85, 0x13, 0x85, 0x3F, 0x04, 0x29, 0x79, 0x57, 0x29,
+    0x6A, 0x57, 0x2A, 0x5A, 0x57, 0x2A, 0x4B, 0x56, 0x4A, 0x3B, 0x55, 0x69,
+    0x2A, 0x82, 0xA8, 0x18, 0xC0, 0x08, 0xD1, 0xA2, 0x7D, 0x26, 0x57, 0xD2,
+    0x47, 0x6D, 0x32, 0x87, 0xD2, 0x28, 0x8D, 0x12, 0x82, 0x16, 0xD0, 0x28,
+    0x21, 0x7C, 0x28, 0x22, 0x6C, 0x28, 0x23, 0x6B, 0x28, 0x24, 0x6A, 0x28,
+    0x25, 0x69, 0x28, 0x25, 0x78, 0x28, 0x26, 0x77, 0x28, 0x27, 0x67, 0x28,
+    0x28, 0x66, 0x28, 0x29, 0x65, 0x28, 0x29, 0x74, 0x28, 0x2A, 0x73, 0x28,
+    0x2B, 0x63, 0x28, 0x2C, 0x62, 0x28, 0x2D, 0x06, 0x12, 0x4F, 0x04, 0x2D,
+    0x18, 0x82, 0xD2, 0x78, 0x2D, 0x36, 0x82, 0xD4, 0x58, 0x2D, 0x54, 0x74,
+    0xD4, 0x46, 0x6D, 0x43, 0x4A, 0xD3, 0x2D, 0xF0, 0x31, 0x40, 0xB8, 0xD6,
+    0xD1, 0xD2, 0x56, 0x5C, 0x5A, 0x59, 0x5C, 0x57, 0x5D, 0x14, 0x74, 0xD3,
+    0x45, 0x5D, 0x35, 0x44, 0xD5, 0x42, 0xF0, 0x15, 0xD5, 0x52, 0x4D, 0x74,
+    0x1E, 0x85, 0xD7, 0x5E, 0x21, 0x5D, 0x55, 0x34, 0xD5, 0x44, 0x5D, 0x35,
+    0x54, 0xD3, 0x46, 0x5D, 0x15, 0x75, 0xC5, 0x95, 0xA5, 0xC5, 0x65, 0xD2,
+    0xD1, 0xD6, 0x8B, 0x0D, 0x39, 0xD3, 0x85, 0x57, 0x65, 0x85, 0x2F, 0x03,
+    0x59, 0x51, 0xE5, 0x03, 0x5A, 0x5F, 0x35, 0x95, 0x45, 0x85, 0x55, 0x66,
+    0x6D, 0x28, 0xD0, 0x7E, 0xA0, 0x35, 0xD4, 0x7D, 0x1C, 0xB0, 0xB8, 0xD7,
+    0xD1, 0xD3, 0x56, 0x5D, 0x05, 0xA5, 0xA5, 0xC5, 0x85, 0xD1, 0x57, 0x4D,
+    0x34, 0x65, 0xD3, 0x55, 0x4D, 0x54, 0x3F, 0x01, 0x5D, 0x55, 0x34, 0xD7,
+    0x42, 0xE8, 0x5D, 0x75, 0x24, 0xD6, 0x52, 0xF0, 0x15, 0xD5, 0x54, 0x4D,
+    0x45, 0x55, 0xD3, 0x56, 0x4D, 0x25, 0x84, 0xD1, 0x4A, 0x4C, 0x4C, 0x58,
+    0x5D, 0x26, 0x26, 0xD6, 0xAD, 0x97, 0xDC, 0x7D, 0xC7, 0xDC, 0x7D, 0xD7,
+    0xDC, 0x7D, 0xE7, 0xDE, 0x80, 0x0D, 0x3D, 0x1D, 0x4C, 0x56, 0x7A, 0x58,
+    0x5A, 0x59, 0x56, 0xE5, 0x03, 0x5A, 0x55, 0xF0, 0x35, 0x95, 0x95, 0x85,
+    0xA5, 0x57, 0xBD, 0x2D, 0x0C, 0xD3, 0x53, 0x5D, 0x25, 0x36, 0xD1, 0x54,
+    0x5D, 0x15, 0x55, 0xD0, 0x56, 0x5C, 0x56, 0x6B, 0x57, 0x6A, 0x58, 0x69,
+    0x59, 0x59, 0x59, 0x68, 0x5A, 0x67, 0x5B, 0x65, 0x7B, 0x62, 0xC8, 0x80,
+    0x66, 0x61, 0x6B, 0x22, 0x55, 0x56, 0x44, 0x94, 0x43, 0xB3, 0x34, 0xC2,
+    0x34, 0xC3, 0x24, 0xD0, 0x21, 0xF0, 0x15, 0xC2, 0x26, 0xD3, 0x6D, 0x28,
+    0xD1, 0x8D, 0x19, 0xD0, 0xAD, 0x09, 0xD0, 0xAD, 0x09, 0xD1, 0x7D, 0x27,
+    0xD2, 0x7D, 0x27, 0xD2, 0x5F, 0x02, 0xD1, 0x8D, 0x08, 0xD0, 0x41, 0x4B,
+    0x52, 0x49, 0x53, 0x66, 0x54, 0x22, 0xC5, 0x16, 0x76, 0xF0, 0xDF, 0x03,
+    0x75, 0x77, 0x85, 0x94, 0x95, 0x92, 0xF0, 0x1A, 0x5A, 0x1E, 0xD8, 0xB5,
+    0xD8, 0x7D, 0x4D, 0x07, 0x0D, 0x09, 0xA2, 0x9D, 0x06, 0x65, 0xD3, 0x43,
+    0xED, 0x70, 0x45, 0xD4, 0x28, 0x5D, 0x41, 0x5F, 0x05, 0x5D, 0x22, 0xB5,
+    0xD0, 0x2C, 0x6B, 0x3D, 0x07, 0x74, 0xD3, 0xD1, 0xD8, 0x9B, 0x0D, 0x0A,
+    0x92, 0x8D, 0x26, 0x55, 0xD4, 0x46, 0x6D, 0x33, 0x85, 0xD3, 0x38, 0x5D,
+    0x32, 0xA5, 0xD1, 0x3A, 0x5D, 0x12, 0xC5, 0xD0, 0x2C, 0x5C, 0x3C, 0x6B,
+    0x2D, 0x15, 0xA3, 0xD1, 0x5A, 0x2D, 0x35, 0x92, 0xD3, 0x58, 0x3D, 0x45,
+    0x72, 0xD5, 0x56, 0x38, 0xF0, 0xB5, 0x52, 0xD7, 0x63, 0x3D, 0x85, 0x32,
+    0xD9, 0x52, 0x3A, 0xF0, 0xD0, 0x51, 0x2D, 0xC7, 0xDC, 0x6C, 0xF0, 0xD2,
+    0x5D, 0xE4, 0xDF, 0x01, 0x3D, 0xF0, 0x12, 0xDF, 0x03, 0x1D, 0x10, 0x0C,
+    0x3D, 0x07, 0x92, 0x78, 0x8C, 0x55, 0x69, 0x6D, 0x13, 0x3F, 0x04, 0x5A,
+    0x5D, 0x12, 0x95, 0xA5, 0xD0, 0x29, 0x5A, 0x5C, 0x25, 0xF0, 0x65, 0xA5,
+    0xB2, 0xB5, 0xA5, 0xA2, 0xD0, 0x59, 0x69, 0x2D, 0x05, 0x87, 0x83, 0xD0,
+    0x58, 0x21, 0x48, 0x2D, 0x25, 0x72, 0x15, 0x72, 0xD2, 0x56, 0x22, 0x56,
+    0x2D, 0x45, 0x52, 0x35, 0x52, 0xD4, 0x54, 0x33, 0x55, 0x2D, 0x45, 0x42,
+    0x45, 0x42, 0xD6, 0x53, 0x25, 0x53, 0x2D, 0x65, 0x23, 0x55, 0x23, 0xD6,
+    0x52, 0x27, 0x51, 0x2D, 0x85, 0x12, 0x75, 0x12, 0xD8, 0x87, 0x8D, 0x87,
+    0x96, 0xDA, 0x69, 0x6D, 0xA5, 0xA6, 0xDA, 0x5B, 0x4D, 0xC4, 0xB4, 0xDC,
+    0x3D, 0x03, 0xDC, 0x3D, 0x02, 0xDE, 0x2D, 0x02, 0xDE, 0x1D, 0x21, 0xD0,
+    0x1D, 0x17, 0xB3, 0x9C, 0x68, 0x7D, 0x03, 0xB6, 0xC3, 0xD0, 0x5C, 0x2D,
+    0x25, 0xA3, 0xD2, 0x68, 0x3D, 0x45, 0x73, 0xD6, 0x56, 0x2D, 0x76, 0x42,
+    0xD9, 0x53, 0x3D, 0xA5, 0x13, 0xDB, 0x8D, 0xD6, 0xDF, 0x5D, 0xF6, 0xDE,
+    0x7D, 0xC8, 0xDB, 0x32, 0x5D, 0xA2, 0x36, 0xD8, 0x25, 0x6D, 0x63, 0x65,
+    0xD5, 0x37, 0x6D, 0x33, 0x96, 0xD1, 0x3B, 0x5D, 0x12, 0xC6, 0xC3, 0xD0,
+    0x6A, 0x3D, 0x17, 0x84, 0xD2, 0x67, 0x6D, 0x09, 0x2B, 0x8D, 0x10, 0x0D,
+    0x09, 0xA2, 0x9D, 0x15, 0x57, 0xD2, 0x47, 0x6D, 0x23, 0x96, 0xD1, 0x2B,
+    0x6C, 0x3C, 0x5B, 0x3D, 0x06, 0xA2, 0xD2, 0x68, 0x3D, 0x35, 0x73, 0xD4,
+    0x66, 0x2D, 0x66, 0x43, 0xD7, 0x53, 0x3D, 0x86, 0x22, 0xDA, 0x9D, 0xB7,
+    0xDC, 0x6D, 0x0E, 0xB0, 0xD1, 0x5D, 0xD7, 0xD9, 0xD0, 0x90, 0xF2, 0xDB,
+    0x34, 0xD1, 0x53, 0x3D, 0x25, 0x42, 0xD2, 0x64, 0x2D, 0x25, 0x51, 0xD2,
+    0x56, 0x1D, 0x15, 0xD8, 0x6D, 0x85, 0xD8, 0x5D, 0x86, 0xD7, 0x6D, 0x85,
+    0xD8, 0x5D, 0x86, 0xD7, 0x6D, 0x85, 0xD8, 0x6D, 0x76, 0xD8, 0x5D, 0x85,
+    0xD8, 0x6D, 0x76, 0xD3, 0x14, 0x5D, 0x32, 0x36, 0xD3, 0x22, 0x6D, 0x33,
+    0x16, 0xD3, 0x32, 0x5D, 0x25, 0x1F, 0xDD, 0x10, 0x09, 0xED, 0xF0, 0x36,
+    0xE5, 0x36, 0x45, 0x90, 0x03, 0xBE, 0x20, 0x13, 0xAE, 0x20, 0x23, 0x9E,
+    0x20, 0x33, 0x8E, 0x20, 0x43, 0x7E, 0x20, 0x53, 0x6E, 0x20, 0x63, 0x5E,
+    0x20, 0x73, 0x4E, 0x20, 0x83, 0x3F, 0x09, 0x3B, 0x41, 0xF0, 0xA3, 0xB4,
+    0xB3, 0x09, 0x54, 0xED, 0xF6, 0x3E, 0x56, 0xC0, 0xF8, 0x48, 0xF0, 0x76,
+    0xD0, 0x41, 0x3C, 0x32, 0x3B, 0x42, 0x4A, 0x34, 0x39, 0x44, 0x48, 0x36,
+    0x37, 0x46, 0x46, 0x38, 0x35, 0x48, 0x44, 0x3A, 0x33, 0x4A, 0x42, 0x3C,
+    0x31, 0x4C, 0x40, 0xF0, 0xDB, 0x03, 0x74, 0x65, 0x65, 0x74, 0x74, 0x83,
+    0x83, 0x66, 0x93, 0x43, 0x73, 0x63, 0x54, 0x72, 0x4F, 0x01, 0x47, 0x35,
+    0x28, 0x3D, 0x23, 0xD0, 0x5A, 0x32, 0x38, 0x34, 0x36, 0x36, 0x35, 0x37,
+    0x34, 0x38, 0x33, 0xE2, 0x48, 0x33, 0x56, 0x43, 0x64, 0x54, 0x92, 0x63,
+    0x55, 0x41, 0x52, 0xD3, 0x5D, 0x17, 0xD1, 0xE7, 0x03, 0x4D, 0x44, 0x36,
+    0x84, 0x1A, 0x66, 0x46, 0x55, 0x74, 0x54, 0x85, 0x44, 0x94, 0x44, 0x95,
+    0xE5, 0x34, 0xA4, 0xF3, 0x4A, 0x31, 0xF0, 0x34, 0x93, 0x54, 0x83, 0x66,
+    0x53, 0x9B, 0xC7, 0x70, 0x77, 0xAB, 0x73, 0x55, 0x53, 0x75, 0x33, 0x85,
+    0x23, 0xA3, 0x2F, 0x01, 0x2D, 0x3E, 0x43, 0xD3, 0x4D, 0x24, 0xD0, 0x21,
+    0x4C, 0x12, 0x59, 0x24, 0x66, 0x26, 0xC8, 0xAB, 0x67, 0xD4, 0x2D, 0x45,
+    0xD2, 0x73, 0xE7, 0x0D, 0x24, 0xA5, 0x34, 0x89, 0x14, 0x74, 0x47, 0x63,
+    0x85, 0x53, 0x95, 0x53, 0xA4, 0x44, 0xA4, 0x43, 0xB4, 0x3E, 0x54, 0xB4,
+    0x35, 0xA4, 0x44, 0xA4, 0x45, 0x94, 0x55, 0x75, 0x56, 0x59, 0x4A, 0x15,
+    0x86, 0x32, 0x50, 0x67, 0x9A, 0x73, 0x54, 0x52, 0x84, 0x33, 0x85, 0x22,
+    0xA4, 0x2D, 0x31, 0xD4, 0x1E, 0x33, 0xD2, 0x4D, 0x1F, 0x4D, 0x01, 0x14,
+    0xB1, 0x25, 0x92, 0x36, 0x53, 0x4D, 0x06, 0xB9, 0x76, 0x96, 0x9A, 0x63,
+    0x35, 0x62, 0x63, 0xE2, 0x53, 0x9E, 0x40, 0x44, 0x9F, 0x01, 0xC4, 0xED,
+    0x30, 0x44, 0xC6, 0x8C, 0x50, 0x76, 0xD0, 0xAA, 0x43, 0xA3, 0x45, 0x93,
+    0x37, 0x37, 0x47, 0x44, 0xE3, 0x02, 0x48, 0x37, 0x47, 0x28, 0x55, 0x3A,
+    0x43, 0x3C, 0x7D, 0x02, 0xD5, 0x2D, 0x52, 0xD5, 0x4D, 0x4D, 0x18, 0xD2,
+    0x7D, 0x25, 0x2C, 0x33, 0x2D, 0x21, 0x1F, 0x01, 0x2D, 0x31, 0x1F, 0x3D,
+    0x21, 0x24, 0xD0, 0x14, 0x58, 0x36, 0xD0, 0xA8, 0x90, 0x52, 0xD4, 0x5D,
+    0x27, 0xD2, 0xE7, 0x03, 0x4D, 0x54, 0x46, 0x84, 0x29, 0x74, 0x12, 0x45,
+    0x66, 0x64, 0x3E, 0xD1, 0x03, 0x49, 0x44, 0x67, 0x62, 0x93, 0x90, 0x43,
+    0x4E, 0x20, 0x35, 0x73, 0x4E, 0x50, 0xD5, 0x18, 0x35, 0x64, 0x73, 0xED,
+    0x10, 0x44, 0x66, 0x2B, 0x83, 0x1E, 0x20, 0x75, 0x83, 0x1E, 0x50, 0xDA,
+    0x19, 0x36, 0x65, 0x7E, 0xD7, 0x84, 0xF8, 0x31, 0x35, 0x31, 0x43, 0x32,
+    0x94, 0x65, 0x52, 0xD5, 0x5D, 0x37, 0xD3, 0xE7, 0x03, 0x4D, 0x64, 0x5A,
+    0x44, 0x75, 0x74, 0x73, 0x94, 0x62, 0xB4, 0x52, 0xC4, 0x42, 0xD0, 0x43,
+    0x2D, 0x14, 0x22, 0xD2, 0x8D, 0x29, 0xD1, 0x41, 0x4D, 0x14, 0x24, 0xD0,
+    0x42, 0x5C, 0x43, 0x5B, 0x44, 0x5A, 0x45, 0x4A, 0x46, 0x49, 0x46, 0x58,
+    0x47, 0x56, 0x66, 0x72, 0xA3, 0xA0, 0x62, 0x65, 0x47, 0x3E, 0xDD, 0x04,
+    0x46, 0x62, 0xB0, 0x34, 0x45, 0x76, 0x67, 0x28, 0x49, 0x78, 0x44, 0x13,
+    0x45, 0x75, 0x66, 0x74, 0x4E, 0xD1, 0x03, 0x48, 0x49, 0x45, 0x66, 0x67,
+    0x62, 0xA2, 0xA3, 0xA0, 0x34, 0x46, 0x57, 0x29, 0x68, 0x45, 0x65, 0x75,
+    0x2E, 0xD1, 0x03, 0x49, 0x44, 0x67, 0x62, 0x94, 0x80, 0x78, 0xCC, 0x94,
+    0x55, 0x65, 0x75, 0x54, 0x95, 0x2F, 0x01, 0x4B, 0x51, 0x5B, 0x6E, 0x40,
+    0x5C, 0xBB, 0x42, 0x5B, 0x42, 0x69, 0x53, 0x59, 0x45, 0x57, 0x47, 0x55,
+    0x49, 0xCD, 0x06, 0x80, 0x43, 0x36, 0x57, 0x1A, 0x66, 0x55, 0x55, 0x75,
+    0x44, 0x94, 0x1F, 0x03, 0x49, 0x5E, 0x53, 0x4A, 0x43, 0x4A, 0x31, 0xF0,
+    0x34, 0x94, 0x44, 0x93, 0x55, 0x73, 0x66, 0x53, 0x74, 0x18, 0x84, 0x25,
+    0x7E, 0x70, 0x34, 0xD3, 0x6D, 0x0B, 0xA0, 0x76, 0x51, 0x7A, 0x22, 0x64,
+    0x56, 0x54, 0x75, 0x44, 0x94, 0x43, 0xA4, 0x34, 0xA4, 0x33, 0xB4, 0x2E,
+    0x54, 0xB4, 0x2F, 0x5A, 0x43, 0x59, 0x43, 0x58, 0x54, 0x65, 0x65, 0xA2,
+    0x47, 0x64, 0x42, 0xE7, 0x0D, 0x24, 0xD2, 0x7C, 0xA0, 0x52, 0x34, 0x26,
+    0x27, 0x15, 0x11, 0x24, 0x35, 0x43, 0xED, 0x13, 0x4A, 0x67, 0xA5, 0x36,
+    0x21, 0x32, 0x44, 0x22, 0x63, 0x1F, 0x37, 0x21, 0x38, 0x11, 0x47, 0x11,
+    0x68, 0x68, 0x77, 0x78, 0x77, 0x69, 0x68, 0x59, 0x3F, 0x02, 0x86, 0x72,
+    0x14, 0x52, 0x21, 0x35, 0x40, 0x51, 0x6F, 0x04, 0x29, 0x38, 0x47, 0x92,
+    0xA2, 0xED, 0x20, 0x24, 0x85, 0x31, 0x47, 0x65, 0x30, 0x06, 0x67, 0x45,
+    0x85, 0x3E, 0xD1, 0x02, 0x49, 0x45, 0x57, 0x56, 0x54, 0x86, 0x92, 0x75,
+    0x64, 0x34, 0x09, 0x67, 0x26, 0x93, 0x54, 0xA3, 0x54, 0xA2, 0x74, 0x92,
+    0x74, 0x91, 0x4F, 0x05, 0x47, 0x29, 0x46, 0x2B, 0x45, 0x2B, 0x45, 0x16,
+    0xF0, 0x74, 0x32, 0xD1, 0x32, 0x2D, 0x24, 0x12, 0xD2, 0x41, 0x18, 0xF0,
+    0x95, 0x8F, 0x0A, 0x3D, 0x62, 0xD8, 0x1A, 0x09, 0x39, 0x56, 0x16, 0x66,
+    0x93, 0x35, 0x74, 0xA2, 0x54, 0x75, 0x92, 0x54, 0x84, 0x92, 0x54, 0x84,
+    0x82, 0x74, 0x84, 0x72, 0x74, 0x75, 0x71, 0x94, 0x65, 0x62, 0x94, 0x61,
+    0x14, 0x52, 0x94, 0x52, 0x14, 0x42, 0xB4, 0x42, 0x23, 0x42, 0xB4, 0x32,
+    0x34, 0x31, 0xD0, 0x33, 0x23, 0x42, 0x2D, 0x04, 0x12, 0x54, 0x12, 0xD0,
+    0x41, 0x25, 0x6D, 0x25, 0x75, 0xD2, 0x57, 0x4D, 0x43, 0x84, 0xD4, 0x39,
+    0x3D, 0x42, 0xA2, 0xD6, 0x1B, 0x19, 0x1A, 0x27, 0x56, 0x54, 0x85, 0x53,
+    0xA4, 0x52, 0xB5, 0x32, 0xD0, 0x42, 0x2D, 0x24, 0x12, 0xD2, 0x6D, 0x44,
+    0xD6, 0x4D, 0x55, 0xD3, 0x6D, 0x32, 0x14, 0xD1, 0x22, 0x5C, 0x24, 0x4B,
+    0x35, 0x4A, 0x26, 0x58, 0x28, 0x47, 0x39, 0x45, 0x48, 0x62, 0x76, 0x90,
+    0x0A, 0x66, 0x26, 0x94, 0x44, 0xB2, 0x54, 0xA2, 0x3F, 0x04, 0x49, 0x23,
+    0xF0, 0x54, 0x72, 0xA4, 0x62, 0xA4, 0x52, 0xB5, 0x42, 0xC4, 0x41, 0xD0,
+    0x52, 0x2D, 0x14, 0x22, 0xD1, 0x7D, 0x36, 0xD3, 0x58, 0xF0, 0xA4, 0x8F,
+    0x0B, 0x2D, 0x71, 0xAF, 0x0A, 0x2A, 0xF0, 0x92, 0xD6, 0x2D, 0x18, 0xD0,
+    0x8D, 0x17, 0xD3, 0x5D, 0x20, 0xF1, 0xD3, 0x22, 0x94, 0x31, 0x94, 0x41,
+    0x85, 0xD0, 0x4D, 0x04, 0xD0, 0x5D, 0x04, 0xD0, 0x4D, 0x05, 0xD0, 0x4D,
+    0x04, 0xD0, 0x5C, 0x59, 0x13, 0x4A, 0x12, 0x59, 0x21, 0x5A, 0x21, 0x4A,
+    0x3F, 0x0D, 0x41, 0x74, 0x64, 0x63, 0x74, 0x3E, 0xD0, 0x04, 0x37, 0x37,
+    0x36, 0x3A, 0x39, 0x35, 0xED, 0x10, 0x43, 0x93, 0x94, 0x93, 0xED, 0xF0,
+    0x3E, 0x20, 0x30, 0x03, 0x94, 0x93, 0x84, 0x4E, 0xD0, 0x04, 0x39, 0x39,
+    0x3A, 0x36, 0x37, 0x33, 0xED, 0x00, 0x43, 0x74, 0x73, 0x64, 0x64, 0x70,
+    0x36, 0xD2, 0x97, 0x23, 0x34, 0x54, 0x41, 0x37, 0xAD, 0x25, 0x40};
+
+const GFXglyph FreeSerif24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 12, 0, 1},         // 0x20 ' '
+    {0, 5, 32, 16, 6, -31},      // 0x21 '!'
+    {17, 12, 12, 19, 4, -31},    // 0x22 '"'
+    {26, 23, 31, 23, 0, -30},    // 0x23 '#'
+    {65, 19, 37, 24, 2, -33},    // 0x24 '$'
+    {131, 33, 32, 39, 3, -30},   // 0x25 '%'
+    {231, 32, 33, 37, 2, -31},   // 0x26 '&'
+    {310, 4, 12, 9, 3, -31},     // 0x27 '''
+    {316, 12, 40, 16, 2, -31},   // 0x28 '('
+    {350, 12, 40, 16, 2, -30},   // 0x29 ')'
+    {384, 16, 19, 24, 4, -30},   // 0x2A '*'
+    {417, 23, 23, 27, 2, -22},   // 0x2B '+'
+    {424, 6, 11, 12, 2, -4},     // 0x2C ','
+    {434, 11, 2, 16, 2, -10},    // 0x2D '-'
+    {436, 5, 5, 12, 3, -3},      // 0x2E '.'
+    {441, 14, 32, 14, 0, -30},   // 0x2F '/'
+    {476, 22, 33, 23, 1, -31},   // 0x30 '0'
+    {520, 13, 32, 24, 5, -31},   // 0x31 '1'
+    {532, 21, 31, 23, 1, -30},   // 0x32 '2'
+    {586, 18, 32, 23, 2, -30},   // 0x33 '3'
+    {629, 21, 31, 24, 1, -30},   // 0x34 '4'
+    {674, 19, 33, 24, 2, -31},   // 0x35 '5'
+    {717, 21, 33, 23, 2, -31},   // 0x36 '6'
+    {768, 20, 31, 24, 1, -30},   // 0x37 '7'
+    {808, 18, 33, 23, 3, -31},   // 0x38 '8'
+    {858, 21, 33, 24, 1, -31},   // 0x39 '9'
+    {908, 5, 22, 12, 4, -20},    // 0x3A ':'
+    {919, 6, 27, 12, 3, -20},    // 0x3B ';'
+    {936, 24, 25, 27, 1, -24},   // 0x3C '<'
+    {974, 24, 11, 27, 1, -16},   // 0x3D '='
+    {980, 24, 25, 27, 2, -23},   // 0x3E '>'
+    {1018, 17, 32, 21, 3, -31},  // 0x3F '?'
+    {1060, 32, 33, 41, 4, -31},  // 0x40 '@'
+    {1154, 32, 32, 34, 1, -31},  // 0x41 'A'
+    {1223, 27, 31, 30, 0, -30},  // 0x42 'B'
+    {1269, 28, 33, 31, 2, -31},  // 0x43 'C'
+    {1317, 31, 31, 34, 1, -30},  // 0x44 'D'
+    {1368, 27, 31, 29, 2, -30},  // 0x45 'E'
+    {1423, 24, 31, 27, 2, -30},  // 0x46 'F'
+    {1461, 31, 33, 35, 2, -31},  // 0x47 'G'
+    {1520, 30, 31, 34, 2, -30},  // 0x48 'H'
+    {1540, 13, 31, 15, 1, -30},  // 0x49 'I'
+    {1549, 17, 32, 18, 0, -30},  // 0x4A 'J'
+    {1565, 32, 31, 33, 1, -30},  // 0x4B 'K'
+    {1636, 26, 31, 29, 2, -30},  // 0x4C 'L'
+    {1661, 39, 31, 41, 1, -30},  // 0x4D 'M'
+    {1769, 32, 32, 34, 1, -30},  // 0x4E 'N'
+    {1858, 30, 33, 34, 2, -31},  // 0x4F 'O'
+    {1911, 23, 31, 27, 2, -30},  // 0x50 'P'
+    {1942, 31, 40, 34, 2, -31},  // 0x51 'Q'
+    {2009, 28, 31, 31, 2, -30},  // 0x52 'R'
+    {2064, 21, 33, 25, 2, -31},  // 0x53 'S'
+    {2121, 27, 31, 28, 1, -30},  // 0x54 'T'
+    {2140, 32, 32, 34, 1, -30},  // 0x55 'U'
+    {2170, 32, 32, 33, 0, -30},  // 0x56 'V'
+    {2243, 44, 32, 45, 0, -30},  // 0x57 'W'
+    {2352, 33, 31, 34, 0, -30},  // 0x58 'X'
+    {2423, 32, 31, 33, 0, -30},  // 0x59 'Y'
+    {2470, 27, 31, 29, 1, -30},  // 0x5A 'Z'
+    {2528, 9, 38, 16, 4, -30},   // 0x5B '['
+    {2536, 14, 32, 14, 0, -30},  // 0x5C '\'
+    {2569, 9, 38, 16, 3, -30},   // 0x5D ']'
+    {2576, 20, 17, 22, 1, -30},  // 0x5E '^'
+    {2607, 24, 2, 23, 0, 5},     // 0x5F '_'
+    {2609, 10, 8, 12, 1, -31},   // 0x60 '`'
+    {2617, 18, 21, 20, 1, -20},  // 0x61 'a'
+    {2654, 21, 32, 24, 1, -31},  // 0x62 'b'
+    {2692, 19, 21, 21, 1, -20},  // 0x63 'c'
+    {2721, 22, 32, 23, 1, -31},  // 0x64 'd'
+    {2763, 18, 21, 21, 1, -20},  // 0x65 'e'
+    {2793, 17, 33, 18, 0, -32},  // 0x66 'f'
+    {2813, 21, 31, 22, 1, -20},  // 0x67 'g'
+    {2865, 22, 32, 23, 0, -31},  // 0x68 'h'
+    {2891, 11, 32, 13, 0, -31},  // 0x69 'i'
+    {2908, 12, 42, 16, 0, -31},  // 0x6A 'j'
+    {2930, 23, 32, 24, 1, -31},  // 0x6B 'k'
+    {2982, 11, 32, 12, 0, -31},  // 0x6C 'l'
+    {2991, 35, 21, 37, 1, -20},  // 0x6D 'm'
+    {3016, 22, 21, 23, 0, -20},  // 0x6E 'n'
+    {3033, 22, 21, 23, 1, -20},  // 0x6F 'o'
+    {3064, 21, 31, 24, 1, -20},  // 0x70 'p'
+    {3103, 21, 31, 23, 1, -20},  // 0x71 'q'
+    {3141, 15, 21, 16, 1, -20},  // 0x72 'r'
+    {3155, 13, 21, 17, 2, -20},  // 0x73 's'
+    {3185, 12, 26, 13, 1, -25},  // 0x74 't'
+    {3201, 22, 21, 23, 1, -20},  // 0x75 'u'
+    {3218, 22, 22, 22, 0, -20},  // 0x76 'v'
+    {3259, 32, 22, 32, 0, -20},  // 0x77 'w'
+    {3330, 22, 21, 23, 0, -20},  // 0x78 'x'
+    {3372, 22, 31, 22, 0, -20},  // 0x79 'y'
+    {3425, 18, 21, 20, 1, -20},  // 0x7A 'z'
+    {3459, 11, 41, 23, 5, -31},  // 0x7B '{'
+    {3478, 3, 32, 9, 3, -30},    // 0x7C '|'
+    {3483, 11, 41, 23, 7, -31},  // 0x7D '}'
+    {3504, 22, 5, 23, 1, -13}};  // 0x7E '~'
+
+const GFXpackedFont FreeSerif24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeSerif24pt7bRLEBitmaps,
+     (GFXglyph *)FreeSerif24pt7bRLEGlyphs, 0x20, 0x7E, 56},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 4188 bytes, glyph bitmaps 3515 bytes (7010 uncompressed)
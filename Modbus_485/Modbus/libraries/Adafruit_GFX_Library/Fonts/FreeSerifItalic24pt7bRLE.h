@@ -0,0 +1,490 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+const uint8_t FreeSerifItalic24pt7bRLEBitmaps[] PROGMEM = {
+    0xE3, 0x84, 0x75, 0xF7, 0x41, 0xF0, 0x73, 0x84, 0x2E, 0x20, 0x63, 0x92,
+    0x93, 0x4E, 0x20, 0x52, 0x5F, 0x05, 0x1A, 0x26, 0xF0, 0x41, 0x7E, 0x30,
+    0xD0, 0x38, 0xE2, 0x58, 0x38, 0x23, 0x63, 0x14, 0x63, 0x14, 0x54, 0xF1,
+    0x36, 0x32, 0x35, 0x41, 0xF3, 0x63, 0x2E, 0x22, 0x72, 0x31, 0x81, 0x40,
+    0xD0, 0x27, 0x21, 0xF0, 0xC3, 0x63, 0x1E, 0x20, 0xB3, 0x63, 0x2F, 0x0A,
+    0x36, 0x3D, 0x02, 0x72, 0xD0, 0x36, 0x34, 0xF0, 0x4D, 0x88, 0x36, 0x3D,
+    0x02, 0x72, 0x6F, 0x07, 0x36, 0x36, 0xE2, 0x06, 0x36, 0x37, 0xD9, 0x3D,
+    0x84, 0xF0, 0x43, 0x63, 0xD0, 0x36, 0x2A, 0xF0, 0x33, 0x63, 0xAE, 0x20,
+    0x23, 0x63, 0xBF, 0x01, 0x36, 0x3C, 0xD2, 0x15, 0xF0, 0xD1, 0x2D, 0x19,
+    0xA3, 0x41, 0x14, 0x72, 0x52, 0x24, 0x53, 0x52, 0x33, 0xF4, 0x36, 0x24,
+    0x2F, 0x43, 0x52, 0x51, 0x54, 0x42, 0xB5, 0x32, 0xC5, 0x12, 0xD1, 0x7D,
+    0x26, 0xD3, 0x6D, 0x36, 0xD3, 0x6D, 0x27, 0xD1, 0x21, 0x5D, 0x02, 0x24,
+    0x3F, 0x09, 0x24, 0x4B, 0x25, 0x33, 0x17, 0x25, 0x33, 0x16, 0x26, 0x32,
+    0x26, 0x26, 0x32, 0x35, 0x26, 0x23, 0x35, 0x25, 0x33, 0x43, 0x26, 0x25,
+    0x42, 0x25, 0x28, 0x62, 0x4B, 0x79, 0xE3, 0x06, 0x2D, 0x00, 0x75, 0xC2,
+    0xC9, 0x84, 0xB4, 0x34, 0x55, 0xB4, 0x77, 0x12, 0xB4, 0x81, 0x63, 0xB3,
+    0x91, 0x62, 0xB4, 0x91, 0x53, 0xB3, 0xA1, 0x52, 0xB4, 0xA1, 0x43, 0xB3,
+    0xA1, 0x52, 0xC3, 0xA1, 0x43, 0xC3, 0x92, 0x33, 0xD0, 0x39, 0x14, 0x2D,
+    0x13, 0x81, 0x43, 0x65, 0x42, 0x72, 0x42, 0x59, 0x23, 0x43, 0x43, 0x45,
+    0x32, 0x37, 0x62, 0x44, 0x62, 0x35, 0x63, 0x34, 0x81, 0xD1, 0x24, 0x48,
+    0x1D, 0x03, 0x34, 0x91, 0xD0, 0x24, 0x3A, 0x1C, 0x24, 0x4A, 0x1B, 0x34,
+    0x49, 0x2B, 0x25, 0x3A, 0x1B, 0x35, 0x39, 0x2B, 0x26, 0x39, 0x1B, 0x36,
+    0x38, 0x2B, 0x27, 0x37, 0x2B, 0x38, 0x34, 0x3C, 0x2A, 0x8C, 0x2C, 0x5D,
+    0x03, 0xDB, 0xD3, 0x4D, 0xB8, 0xD8, 0x33, 0x3D, 0x83, 0x43, 0x7F, 0x0C,
+    0x35, 0x3D, 0x54, 0x53, 0xD5, 0x44, 0x3D, 0x64, 0x42, 0xD7, 0x43, 0x2D,
+    0x84, 0x22, 0xD9, 0x7D, 0xA5, 0xDC, 0x4D, 0xB6, 0xD9, 0x95, 0x87, 0x32,
+    0x56, 0x57, 0x44, 0x47, 0x37, 0x45, 0x56, 0x36, 0x46, 0x55, 0x36, 0x57,
+    0x45, 0x27, 0x48, 0x53, 0x37, 0x48, 0x53, 0x27, 0x59, 0x51, 0x28, 0x59,
+    0x88, 0x5A, 0x69, 0x5A, 0x5A, 0x6A, 0x5A, 0x5A, 0x69, 0x67, 0x8A, 0x64,
+    0x42, 0x64, 0x14, 0xB5, 0x97, 0x79, 0x54, 0xF2, 0x31, 0x4E, 0x21, 0x31,
+    0xF3, 0x2E, 0x22, 0x31, 0x40, 0xB1, 0xB1, 0xB2, 0xA2, 0xA2, 0xA2, 0xA3,
+    0xA2, 0xA3, 0x6F, 0x03, 0x39, 0x49, 0x38, 0xF0, 0x14, 0x8F, 0x01, 0x39,
+    0xE2, 0x49, 0xE8, 0x3A, 0xE3, 0x01, 0x2A, 0xE2, 0x02, 0x2C, 0x1C, 0x2C,
+    0x18, 0x81, 0xC2, 0x3F, 0x09, 0x13, 0xF0, 0x92, 0x2E, 0x40, 0xA2, 0x1E,
+    0x60, 0xA3, 0xE3, 0x94, 0x93, 0x1E, 0x20, 0x84, 0x93, 0x94, 0x2F, 0x07,
+    0x39, 0x3A, 0x2A, 0x3A, 0x2A, 0x2A, 0x2A, 0x2B, 0x1B, 0x1B, 0x71, 0x8E,
+    0x30, 0x63, 0x73, 0x41, 0x56, 0x41, 0x48, 0x31, 0x35, 0x32, 0x21, 0x22,
+    0x95, 0xC3, 0xB2, 0x11, 0x12, 0x64, 0x21, 0x24, 0x24, 0x31, 0x38, 0x41,
+    0x47, 0x41, 0x53, 0xE2, 0x63, 0xD0, 0x28, 0xE9, 0xA3, 0xAE, 0x2D, 0xAE,
+    0x9A, 0x3A, 0x33, 0x1E, 0x20, 0x25, 0x34, 0x43, 0x42, 0x42, 0x51, 0x42,
+    0x51, 0x50, 0x1D, 0xF0, 0x31, 0x13, 0x1E, 0x25, 0x13, 0x10, 0xD4, 0x4D,
+    0x43, 0xD4, 0x4D, 0x43, 0xD4, 0x4D, 0x43, 0xD4, 0x3D, 0x44, 0xD4, 0x3D,
+    0x44, 0xD4, 0x3D, 0x44, 0xD4, 0x3D, 0x44, 0xD4, 0x3D, 0x44, 0xD4, 0x3D,
+    0x44, 0xD4, 0x3D, 0x43, 0xD4, 0x4D, 0x43, 0xD4, 0x4D, 0x43, 0xD4, 0x4D,
+    0x43, 0xD4, 0x4D, 0x43, 0xD4, 0x4D, 0x43, 0xD4, 0x4D, 0x43, 0xD4, 0x3D,
+    0x50, 0xB6, 0xD0, 0x34, 0x2B, 0x27, 0x29, 0x28, 0x28, 0x39, 0x26, 0x3A,
+    0x25, 0x3B, 0x25, 0x3B, 0x3F, 0x33, 0xC3, 0x24, 0xC3, 0x23, 0xD0, 0x3E,
+    0x21, 0x4C, 0x41, 0x3D, 0x08, 0xD0, 0x31, 0xF4, 0xC4, 0x13, 0xD0, 0x32,
+    0xF3, 0xC4, 0x23, 0xC3, 0x33, 0xB4, 0x33, 0xB3, 0x52, 0xA3, 0x62, 0x93,
+    0x73, 0x82, 0x92, 0x72, 0xB2, 0x43, 0xD1, 0x5B, 0xD3, 0x1A, 0x78, 0x9C,
+    0x5E, 0x2C, 0x4D, 0x03, 0x2E, 0x20, 0xB4, 0x2E, 0x30, 0xA4, 0x3E, 0x20,
+    0x94, 0x4E, 0x30, 0x84, 0x5E, 0x20, 0x74, 0x6E, 0x30, 0x64, 0xC4, 0xC6,
+    0x7D, 0x04, 0xA6, 0xD0, 0xAA, 0xC8, 0x35, 0x66, 0x28, 0x55, 0x2A, 0x54,
+    0x1C, 0x4E, 0x2D, 0x44, 0xD4, 0x3D, 0x44, 0xD4, 0x3D, 0x44, 0xD4, 0x3D,
+    0x43, 0xD4, 0x3D, 0x43, 0xD5, 0x2D, 0x52, 0xD5, 0x2D, 0x52, 0xD5, 0x2D,
+    0x52, 0xD5, 0x2D, 0x52, 0xB1, 0x62, 0xC1, 0x52, 0xC2, 0x4D, 0x34, 0xD4,
+    0x3D, 0x44, 0xC6, 0xD1, 0xAB, 0x25, 0x59, 0x27, 0x48, 0x29, 0x4E, 0x2D,
+    0x54, 0xFD, 0x44, 0xD4, 0x3D, 0x44, 0xD3, 0x3D, 0x36, 0xD0, 0xBD, 0x28,
+    0xD4, 0x54, 0xF0, 0xD1, 0x53, 0xE3, 0x0D, 0x24, 0x3E, 0x20, 0xD2, 0x3D,
+    0x53, 0xD6, 0x27, 0x39, 0x27, 0x74, 0x39, 0xBC, 0x8C, 0xD7, 0x2D, 0x63,
+    0xD5, 0x4D, 0x45, 0xD3, 0x5D, 0x36, 0xD2, 0x21, 0x4D, 0x22, 0x13, 0xD2,
+    0x22, 0x3D, 0x12, 0x24, 0xD0, 0x23, 0x4C, 0x24, 0x3C, 0x25, 0x3B, 0x25,
+    0x4A, 0x26, 0x49, 0x27, 0x39, 0x27, 0x48, 0x28, 0x47, 0x29, 0x37, 0x2A,
+    0x36, 0x39, 0x46, 0xD7, 0x1F, 0xD8, 0xD0, 0x46, 0xF0, 0xC3, 0x7F, 0x0B,
+    0x4D, 0x53, 0x8F, 0x0A, 0x48, 0xFA, 0xC9, 0xC1, 0xF0, 0x91, 0xCF, 0x08,
+    0x1D, 0x73, 0xD6, 0x6D, 0x28, 0xD1, 0xAD, 0x28, 0xD3, 0x6D, 0x55, 0xD5,
+    0x44, 0xF0, 0xD2, 0x43, 0xE4, 0x0D, 0x33, 0xD6, 0x24, 0xF0, 0xD2, 0x3D,
+    0x62, 0xD6, 0x2D, 0x62, 0x83, 0x83, 0x76, 0x43, 0xAB, 0xC7, 0xD0, 0xD7,
+    0x3D, 0x35, 0xD2, 0x5D, 0x35, 0xD4, 0x5D, 0x44, 0xD4, 0x5D, 0x45, 0xD5,
+    0x4D, 0x55, 0xD4, 0x5D, 0x45, 0x26, 0xAD, 0x27, 0x66, 0x56, 0x58, 0x54,
+    0x5A, 0x43, 0xF0, 0x14, 0xC4, 0x2E, 0x24, 0xD0, 0x42, 0x3D, 0x14, 0x23,
+    0xD0, 0x52, 0xF3, 0xD0, 0x43, 0x3C, 0x45, 0x2C, 0x45, 0x2B, 0x47, 0x2A,
+    0x38, 0x28, 0x4B, 0x25, 0x3D, 0x26, 0xB0, 0x3D, 0x52, 0xD6, 0x2D, 0x52,
+    0x3D, 0x02, 0x22, 0xD1, 0x32, 0x1D, 0x22, 0xD5, 0x33, 0xF0, 0xD1, 0x3D,
+    0x43, 0xD5, 0x2D, 0x53, 0x6F, 0x0B, 0x37, 0xF0, 0xA3, 0xD4, 0x39, 0xF0,
+    0x83, 0xAF, 0x07, 0x3D, 0x43, 0xD4, 0x4D, 0x43, 0xD0, 0xF0, 0x43, 0xD4,
+    0x3D, 0x44, 0xD4, 0x3D, 0x3F, 0x01, 0x3D, 0x43, 0xD5, 0xA7, 0xD0, 0x35,
+    0x3A, 0x38, 0x28, 0x39, 0x31, 0xE3, 0x05, 0x3B, 0x35, 0x4A, 0x35, 0x49,
+    0x37, 0x47, 0x47, 0x64, 0x3A, 0x61, 0x44, 0xF0, 0x87, 0xD1, 0x9B, 0x33,
+    0x68, 0x45, 0x66, 0x38, 0x55, 0x49, 0x54, 0x3B, 0x43, 0x3D, 0x04, 0x2E,
+    0x33, 0xD1, 0x32, 0x3D, 0x12, 0x43, 0xC3, 0x43, 0xB3, 0x63, 0x93, 0x84,
+    0x53, 0xC8, 0x90, 0xB6, 0xD0, 0x44, 0x2B, 0x38, 0x19, 0x39, 0x27, 0x3B,
+    0x25, 0x4B, 0x25, 0x3C, 0x3F, 0x34, 0xC3, 0xE2, 0x24, 0xD0, 0x3E, 0x22,
+    0x4C, 0x42, 0x4B, 0x44, 0x4A, 0x44, 0x58, 0x55, 0x55, 0x67, 0xA1, 0x48,
+    0x63, 0x4D, 0x45, 0xD4, 0x4D, 0x45, 0xD3, 0x5D, 0x35, 0xD3, 0x5D, 0x35,
+    0xD3, 0x4D, 0x35, 0xD3, 0x4D, 0x25, 0xD2, 0x3D, 0x60, 0x53, 0x1E, 0x20,
+    0x45, 0x53, 0x1E, 0xB0, 0xA3, 0x5E, 0x25, 0x53, 0x50, 0x73, 0x1E, 0x20,
+    0x65, 0x73, 0x1E, 0xA0, 0xD1, 0x28, 0x45, 0xF0, 0x25, 0x74, 0x83, 0x82,
+    0x5F, 0x03, 0x28, 0x19, 0x19, 0xDF, 0x0D, 0x32, 0xD5, 0x5D, 0x37, 0xD1,
+    0x8D, 0x07, 0xD1, 0x7D, 0x08, 0xD0, 0x8D, 0x08, 0xD0, 0x7D, 0x26, 0xD4,
+    0x4D, 0x66, 0xD4, 0x8D, 0x48, 0xD5, 0x7D, 0x57, 0xD5, 0x8D, 0x48, 0xD4,
+    0x8D, 0x57, 0xD5, 0x5D, 0x73, 0xD9, 0x10, 0xE2, 0x0D, 0xBE, 0x5D, 0xBE,
+    0x2D, 0xB0, 0x01, 0xDA, 0x3D, 0x85, 0xD6, 0x7D, 0x67, 0xD6, 0x8D, 0x58,
+    0xD5, 0x8D, 0x67, 0xD6, 0x7D, 0x68, 0xD5, 0x7D, 0x65, 0xD5, 0x6D, 0x37,
+    0xD1, 0x8D, 0x18, 0xD1, 0x8D, 0x17, 0xD2, 0x7D, 0x18, 0xD1, 0x8D, 0x36,
+    0xD5, 0x3D, 0x81, 0xDA, 0x66, 0x92, 0x43, 0x62, 0x63, 0x43, 0x72, 0x1E,
+    0x20, 0x33, 0x73, 0xD0, 0x3C, 0x4C, 0x3C, 0x4B, 0x4C, 0x3C, 0x3C, 0x3C,
+    0x3C, 0x3D, 0x02, 0xD0, 0x2D, 0x11, 0xAE, 0x20, 0x41, 0xD1, 0x1C, 0xE3,
+    0x0D, 0x43, 0xCE, 0x25, 0xC3, 0xC0, 0xD0, 0x9D, 0x8D, 0x1D, 0x46, 0x75,
+    0xD1, 0x4D, 0x04, 0xA5, 0xD2, 0x48, 0x5D, 0x53, 0x74, 0xD7, 0x35, 0x4D,
+    0x92, 0x44, 0xB4, 0x83, 0x34, 0x97, 0x13, 0x42, 0x24, 0x94, 0x35, 0x43,
+    0x14, 0x83, 0x54, 0x62, 0x14, 0x73, 0x73, 0x66, 0x83, 0x73, 0x62, 0xF0,
+    0x47, 0x37, 0x46, 0x67, 0x28, 0x37, 0x66, 0x38, 0x37, 0x66, 0x38, 0x36,
+    0x21, 0x46, 0x37, 0x46, 0x21, 0x46, 0x37, 0x36, 0x32, 0x45, 0x36, 0x46,
+    0x23, 0x45, 0x44, 0x55, 0x24, 0x46, 0x33, 0x21, 0x34, 0x26, 0x45, 0x73,
+    0x78, 0x36, 0x46, 0x59, 0x4D, 0xF0, 0x24, 0xDF, 0x02, 0x4D, 0xF0, 0x25,
+    0xD2, 0x1D, 0x16, 0x85, 0xD3, 0xD2, 0xD8, 0x9B, 0xD6, 0x28, 0xF0, 0xD5,
+    0x3D, 0xC4, 0xDC, 0x57, 0xF0, 0xD3, 0x6D, 0x92, 0x14, 0x7F, 0x0D, 0x12,
+    0x24, 0xD7, 0x23, 0x5D, 0x61, 0x45, 0xD5, 0x24, 0x56, 0xF0, 0xB2, 0x64,
+    0xD3, 0x27, 0x4D, 0x31, 0x85, 0xD1, 0x28, 0x55, 0xF0, 0x8D, 0x35, 0xF0,
+    0x72, 0xB4, 0xB2, 0xC5, 0x93, 0xC5, 0x92, 0xD0, 0x58, 0x3D, 0x14, 0x82,
+    0xD2, 0x47, 0x3D, 0x25, 0x54, 0xD2, 0x54, 0x5D, 0x17, 0x28, 0x9C, 0x6D,
+    0x4D, 0x1D, 0x3D, 0x05, 0x65, 0xC5, 0x75, 0xB5, 0x85, 0xA4, 0x95, 0xF9,
+    0x59, 0x59, 0x4A, 0x59, 0x49, 0x59, 0x59, 0x59, 0x58, 0x5A, 0x46, 0x6B,
+    0xD1, 0xD1, 0xD2, 0xD0, 0x55, 0x6C, 0x48, 0x5A, 0x59, 0x59, 0x5A, 0x52,
+    0xF0, 0x64, 0xB5, 0x2F, 0x05, 0x5B, 0x57, 0x4C, 0x52, 0xF0, 0x45, 0xB5,
+    0x74, 0xB5, 0x84, 0xA5, 0x86, 0x67, 0x8D, 0x67, 0xD5, 0xA0, 0xD2, 0x86,
+    0x1C, 0xD4, 0xB6, 0x76, 0xA5, 0xA5, 0x94, 0xD0, 0x47, 0x5D, 0x23, 0x74,
+    0xD3, 0x36, 0x5D, 0x41, 0x65, 0xD5, 0x15, 0x5D, 0x61, 0x55, 0xD9, 0xF0,
+    0x25, 0xDA, 0xE2, 0x01, 0x5D, 0xBE, 0x85, 0xDD, 0x5D, 0x51, 0x65, 0xD4,
+    0x27, 0x5D, 0x22, 0x85, 0xD1, 0x2A, 0x5B, 0x3C, 0x67, 0x3D, 0x3D, 0x0D,
+    0x68, 0xD1, 0x6D, 0x5D, 0x5D, 0x4D, 0x46, 0x66, 0xD2, 0x59, 0x5D, 0x15,
+    0xA5, 0xD0, 0x4C, 0x52, 0xF0, 0x95, 0xD0, 0x5A, 0x5D, 0x14, 0xA4, 0xD2,
+    0x5F, 0x85, 0xD2, 0x58, 0x4D, 0x35, 0xE2, 0x75, 0xD3, 0x57, 0x4D, 0x36,
+    0xF6, 0x5D, 0x35, 0x74, 0xD4, 0x57, 0x4D, 0x35, 0x75, 0xD3, 0x57, 0x5D,
+    0x25, 0x84, 0xD2, 0x58, 0x5D, 0x16, 0x85, 0xD0, 0x5A, 0x5C, 0x5B, 0x4B,
+    0x6B, 0x67, 0x7C, 0xD6, 0xCD, 0x4D, 0x30, 0x6D, 0xA9, 0xD7, 0xA5, 0xA4,
+    0xA5, 0xC2, 0xA5, 0xC1, 0xB4, 0xD0, 0x1A, 0x5D, 0x01, 0xA5, 0xDB, 0x4D,
+    0xC4, 0x91, 0xD1, 0x58, 0x2D, 0x15, 0x81, 0xD2, 0x47, 0x37, 0xF0, 0x7D,
+    0x2D, 0x15, 0x63, 0xD2, 0x48, 0x2D, 0x15, 0x82, 0xD1, 0x58, 0x1D, 0x24,
+    0x91, 0xD2, 0x4D, 0x6F, 0x05, 0x5D, 0xB4, 0xD3, 0x17, 0x5D, 0x22, 0x75,
+    0xD1, 0x37, 0x4D, 0x13, 0x84, 0xD0, 0x47, 0x69, 0x76, 0xD9, 0x5D, 0xB5,
+    0x6D, 0xA9, 0xD7, 0xA5, 0xA4, 0xA5, 0xC2, 0xA5, 0xC1, 0xB4, 0xD0, 0x11,
+    0xF0, 0x95, 0xD0, 0x1A, 0x5D, 0xB4, 0xDB, 0x59, 0x1D, 0x15, 0x82, 0xD1,
+    0x48, 0x2D, 0x15, 0x73, 0xD1, 0xD2, 0xD1, 0xD1, 0xD2, 0x48, 0x28, 0xF0,
+    0x65, 0x82, 0xD1, 0x58, 0x1D, 0x24, 0x91, 0x9F, 0x05, 0x5D, 0xB4, 0xD7,
+    0xE2, 0x04, 0x5D, 0xB4, 0xDB, 0x5D, 0xA7, 0xD7, 0xCD, 0x40, 0xD2, 0x87,
+    0x1C, 0xD1, 0x32, 0xA6, 0x78, 0x95, 0xB6, 0x84, 0xD1, 0x48, 0x4D, 0x33,
+    0x74, 0xD4, 0x36, 0x4D, 0x53, 0x55, 0xD6, 0x15, 0x5D, 0x71, 0x55, 0xDA,
+    0xF0, 0x25, 0xDB, 0xE2, 0x01, 0x5D, 0xC6, 0xDC, 0x5D, 0x1D, 0x4D, 0x47,
+    0x2F, 0x5D, 0x54, 0x45, 0xD4, 0x54, 0xF5, 0xD4, 0x46, 0x4D, 0x44, 0x5F,
+    0x01, 0x5D, 0x24, 0x85, 0xD1, 0x49, 0x4D, 0x05, 0xA5, 0xA5, 0xC6, 0x75,
+    0xD2, 0xD1, 0xD6, 0x9D, 0x00, 0x6D, 0x06, 0xB9, 0x8A, 0x72, 0xF0, 0xA5,
+    0xD0, 0x53, 0xF0, 0xA4, 0xD1, 0x44, 0xF0, 0x95, 0xD0, 0x54, 0xF0, 0x94,
+    0xD1, 0x45, 0xF0, 0x85, 0xD0, 0x5D, 0x04, 0xD1, 0x4D, 0x05, 0xD1, 0x4D,
+    0x0D, 0xAD, 0x0D, 0x9D, 0x14, 0xD1, 0x47, 0xF0, 0x65, 0xD0, 0x57, 0xF0,
+    0x64, 0xD1, 0x48, 0xF0, 0x55, 0xD0, 0x5D, 0x04, 0xD1, 0x49, 0xF0, 0x45,
+    0xD0, 0x59, 0xF0, 0x44, 0xD1, 0x4D, 0x05, 0xD0, 0x5C, 0x7B, 0x79, 0xB6,
+    0xD0, 0x60, 0x7B, 0x98, 0x1E, 0x20, 0xA5, 0xD0, 0x44, 0xF0, 0x95, 0x4F,
+    0x09, 0x45, 0xF0, 0x85, 0xD0, 0x46, 0xE2, 0x07, 0x5D, 0x04, 0x7F, 0x06,
+    0x57, 0xF0, 0x64, 0x8F, 0x05, 0x5D, 0x04, 0x9F, 0x04, 0x59, 0xF0, 0x44,
+    0xD0, 0x5C, 0x79, 0xB7, 0xBC, 0xD1, 0x72, 0xF0, 0xD2, 0x53, 0xF0, 0xD2,
+    0x4D, 0x55, 0x4F, 0x0D, 0x14, 0x5F, 0x0D, 0x05, 0x5F, 0x0D, 0x04, 0x6F,
+    0x0C, 0x5D, 0x54, 0x7F, 0x0B, 0x57, 0xF0, 0xB4, 0x8F, 0x0A, 0x58, 0xF0,
+    0xA4, 0xD5, 0x5D, 0x54, 0xB3, 0x54, 0xAF, 0x53, 0x4B, 0x52, 0x4D, 0x09,
+    0xD3, 0x5D, 0x20, 0x7C, 0x4A, 0x98, 0x96, 0xB5, 0xB4, 0xD0, 0x5A, 0x4D,
+    0x14, 0xA4, 0xD2, 0x49, 0x3D, 0x35, 0x83, 0xD4, 0x57, 0x3D, 0x54, 0x63,
+    0xD7, 0x45, 0x3D, 0x75, 0x34, 0xD8, 0x52, 0x3D, 0xA4, 0x23, 0xDB, 0x8D,
+    0xBA, 0xDA, 0x41, 0x5D, 0xA4, 0x25, 0xD8, 0x52, 0x5D, 0x85, 0x35, 0xD7,
+    0x45, 0x4D, 0x74, 0x55, 0xD0, 0xF0, 0x55, 0x65, 0xD4, 0x48, 0x5D, 0x25,
+    0x94, 0xD2, 0x59, 0x5D, 0x14, 0xB4, 0xD1, 0x4B, 0x5C, 0x5B, 0x6A, 0x79,
+    0x87, 0xC4, 0xD0, 0x40, 0x6D, 0x0D, 0x48, 0xD7, 0x6B, 0xF0, 0xA5, 0xD9,
+    0x4D, 0x0F, 0x09, 0x5D, 0x0F, 0x09, 0x4D, 0x1F, 0x08, 0x5D, 0x94, 0xD2,
+    0xE2, 0x07, 0x5D, 0x94, 0xD3, 0xF0, 0x65, 0xD3, 0xF0, 0x64, 0xD9, 0x5D,
+    0x95, 0xD3, 0x15, 0x4D, 0x32, 0x45, 0xD3, 0x15, 0x5D, 0x22, 0x54, 0xD2,
+    0x35, 0x4D, 0x13, 0x56, 0xA6, 0x4D, 0xA2, 0xDB, 0x30, 0x79, 0xD5, 0x8A,
+    0x6D, 0x47, 0xD0, 0x5D, 0x37, 0xD0, 0x6D, 0x36, 0xD1, 0x6D, 0x27, 0xD1,
+    0x6D, 0x18, 0xD1, 0x11, 0x4D, 0x12, 0x14, 0xD1, 0x21, 0x4D, 0x02, 0x24,
+    0xD1, 0x21, 0x5B, 0x31, 0x5D, 0x12, 0x15, 0xB2, 0x25, 0xD1, 0x13, 0x4A,
+    0x23, 0x4D, 0x12, 0x34, 0x93, 0x25, 0xD1, 0x23, 0x49, 0x23, 0x5D, 0x11,
+    0x44, 0x82, 0x44, 0xD1, 0x24, 0x47, 0x34, 0x4D, 0x12, 0x44, 0x72, 0x45,
+    0xD1, 0x24, 0x46, 0x25, 0x5D, 0x11, 0x55, 0x43, 0x54, 0xD1, 0x25, 0x54,
+    0x26, 0x4D, 0x12, 0x64, 0x32, 0x65, 0xD1, 0x26, 0x42, 0x36, 0x5D, 0x02,
+    0x74, 0x22, 0x74, 0xD1, 0x27, 0x41, 0x27, 0x5D, 0x12, 0x77, 0x75, 0xD0,
+    0x28, 0x68, 0x4D, 0x12, 0x85, 0x94, 0xD1, 0x28, 0x58, 0x5D, 0x03, 0x84,
+    0x95, 0xD0, 0x39, 0x29, 0x6C, 0x58, 0x28, 0x7A, 0x96, 0x17, 0xC7, 0x68,
+    0xC9, 0x87, 0xD0, 0x61, 0xF0, 0xA5, 0xD1, 0x33, 0xF0, 0xA6, 0xD0, 0x2D,
+    0x11, 0x15, 0xB3, 0xD0, 0x21, 0x5B, 0x2D, 0x12, 0x24, 0xB2, 0xD1, 0x22,
+    0x59, 0x3D, 0x02, 0x44, 0x93, 0x5F, 0x08, 0x24, 0x58, 0x2D, 0x12, 0x54,
+    0x73, 0xD0, 0x26, 0x56, 0x2D, 0x12, 0x74, 0x62, 0xD1, 0x27, 0x55, 0x2D,
+    0x02, 0x94, 0x43, 0xD0, 0x29, 0x44, 0x2D, 0x12, 0x95, 0x32, 0xD1, 0x2A,
+    0x42, 0x3D, 0x02, 0xB5, 0x12, 0x9F, 0x05, 0x2C, 0x41, 0x2D, 0x03, 0xC7,
+    0x9F, 0x04, 0x2D, 0x15, 0xD0, 0x3D, 0x24, 0xD0, 0x3D, 0x23, 0xD0, 0x5D,
+    0x22, 0xB9, 0xD0, 0x2D, 0xF0, 0x52, 0xB0, 0xD3, 0x7D, 0x7C, 0xD3, 0x55,
+    0x5D, 0x14, 0x94, 0xC4, 0xB4, 0x95, 0xC5, 0x75, 0xD1, 0x46, 0x5D, 0x24,
+    0x65, 0xD2, 0x54, 0x5D, 0x35, 0xF3, 0x5D, 0x45, 0x26, 0xD4, 0x52, 0x5D,
+    0x55, 0x16, 0xD4, 0x61, 0x5D, 0x56, 0x15, 0xD5, 0x51, 0xF6, 0xD4, 0x61,
+    0x5D, 0x55, 0x25, 0xD4, 0x62, 0xF5, 0xD4, 0x53, 0x5D, 0x35, 0x45, 0xD2,
+    0x56, 0x4D, 0x25, 0x64, 0xD1, 0x57, 0x5C, 0x59, 0x4B, 0x5B, 0x49, 0x4D,
+    0x15, 0x55, 0xD3, 0xCD, 0x77, 0xD3, 0x6D, 0x4D, 0x2D, 0x4D, 0x05, 0x66,
+    0x2F, 0x0A, 0x58, 0x5B, 0x4A, 0x5F, 0x95, 0xA5, 0xF9, 0x4B, 0x58, 0x5B,
+    0x49, 0x5A, 0x59, 0x4A, 0x59, 0x59, 0x69, 0x57, 0x6B, 0xD4, 0xC4, 0x19,
+    0x8F, 0x06, 0x5D, 0x5F, 0x06, 0x4D, 0x6F, 0x05, 0x5D, 0xB4, 0xD7, 0xF0,
+    0x45, 0xD7, 0xF0, 0x44, 0xDB, 0x5D, 0xA7, 0xD7, 0xBD, 0x50, 0xD3, 0x7D,
+    0x7C, 0xD4, 0x45, 0x5D, 0x14, 0x94, 0xC4, 0xB4, 0xA4, 0xC5, 0x84, 0xD1,
+    0x47, 0x4D, 0x24, 0x65, 0xD2, 0x54, 0x5D, 0x35, 0x36, 0xD3, 0x53, 0x5D,
+    0x45, 0x26, 0xD4, 0x52, 0x5D, 0x55, 0xF1, 0x6D, 0x46, 0x15, 0xD5, 0x51,
+    0x6D, 0x55, 0x16, 0xD4, 0x61, 0xF5, 0xD5, 0x52, 0xF5, 0xD4, 0x53, 0xF5,
+    0xD3, 0x54, 0x5D, 0x25, 0x64, 0xD1, 0x57, 0x5D, 0x04, 0x94, 0xC4, 0xA5,
+    0xA4, 0xC4, 0x84, 0xD3, 0x52, 0x5D, 0x78, 0xDA, 0x2D, 0xE2, 0xDD, 0x3D,
+    0x61, 0x68, 0xD0, 0x26, 0xD0, 0x73, 0x6D, 0xA5, 0x36, 0xD1, 0xD7, 0x89,
+    0x6D, 0x4D, 0x1D, 0x3D, 0x05, 0x56, 0xC5, 0x75, 0xB5, 0x85, 0xA4, 0x95,
+    0xF9, 0x59, 0x59, 0x4A, 0x59, 0x49, 0x59, 0x59, 0x59, 0x58, 0x5A, 0x47,
+    0x6A, 0xD3, 0xCD, 0x08, 0xF0, 0x74, 0x44, 0xD2, 0x54, 0x5D, 0x15, 0x54,
+    0xD1, 0x46, 0x4D, 0x14, 0x65, 0xC5, 0x74, 0xC5, 0x75, 0xB4, 0x94, 0xA5,
+    0x94, 0xA5, 0x95, 0x5F, 0x04, 0x4B, 0x48, 0x5B, 0x56, 0x7B, 0x53, 0xB9,
+    0x71, 0xA6, 0x52, 0x8B, 0x13, 0x75, 0x55, 0x74, 0x84, 0x74, 0x93, 0x64,
+    0xA3, 0x64, 0xB2, 0x1F, 0x05, 0x4B, 0x12, 0xF0, 0x55, 0xD6, 0x5D, 0x56,
+    0xD5, 0x6D, 0x56, 0xD5, 0x6D, 0x56, 0xD5, 0x6D, 0x56, 0xD5, 0x5D, 0x56,
+    0xD5, 0x54, 0xE2, 0x02, 0x1C, 0x44, 0xF0, 0x12, 0xC4, 0x4F, 0x01, 0x3A,
+    0x46, 0x48, 0x47, 0x64, 0x58, 0x13, 0xA8, 0x16, 0x6A, 0xF2, 0xDC, 0x15,
+    0x65, 0x64, 0x13, 0x85, 0x73, 0x12, 0x95, 0x81, 0x21, 0x95, 0x91, 0x12,
+    0x95, 0x91, 0x11, 0xA5, 0x91, 0xC4, 0xCE, 0x20, 0xA5, 0xD9, 0x4D, 0x0F,
+    0x09, 0x5D, 0x94, 0xD1, 0xE2, 0x08, 0x5D, 0x94, 0xD2, 0xF0, 0x75, 0xD2,
+    0xF0, 0x74, 0xD3, 0xF0, 0x65, 0xD9, 0x4D, 0x4F, 0x05, 0x5D, 0x78, 0xD3,
+    0xD1, 0xD0, 0x1D, 0x17, 0x94, 0x8C, 0x66, 0x6D, 0x13, 0x3F, 0x05, 0x5D,
+    0x23, 0x85, 0xD2, 0x28, 0x5D, 0x32, 0x85, 0xD2, 0x34, 0xF0, 0x45, 0xD2,
+    0x28, 0x5D, 0x32, 0x85, 0xD2, 0x38, 0x5D, 0x22, 0x6F, 0x02, 0x5D, 0x32,
+    0x6F, 0x02, 0x5D, 0x22, 0x85, 0xD3, 0x27, 0xE2, 0x01, 0x5D, 0x22, 0x85,
+    0xD3, 0x28, 0xF5, 0xD2, 0x29, 0xF5, 0xD1, 0x2A, 0x5D, 0x02, 0xC5, 0xB3,
+    0xD0, 0x59, 0x3D, 0x26, 0x54, 0xD4, 0xCD, 0x88, 0xD4, 0x0B, 0x99, 0x27,
+    0xD0, 0x55, 0x5D, 0x24, 0x55, 0xD2, 0x36, 0x5D, 0x22, 0x75, 0xD1, 0x37,
+    0x5D, 0x12, 0x94, 0xD0, 0x2A, 0x5C, 0x2A, 0x5B, 0x2B, 0x5A, 0x3B, 0x5A,
+    0x2C, 0x59, 0x2D, 0x14, 0x92, 0xD1, 0x48, 0x2D, 0x25, 0x63, 0xD2, 0x56,
+    0x2B, 0xF0, 0x55, 0x52, 0xCF, 0x06, 0x44, 0x2D, 0x64, 0x32, 0xD1, 0xF0,
+    0x65, 0x12, 0xD8, 0x7D, 0xA6, 0xDA, 0x5D, 0x4F, 0x07, 0x4D, 0x5F, 0x07,
+    0x3D, 0xE1, 0xD7, 0x0B, 0x3B, 0x68, 0x27, 0x77, 0xA5, 0x45, 0x95, 0xC3,
+    0x55, 0x95, 0xC2, 0x65, 0xA4, 0xB3, 0x65, 0xA4, 0xB2, 0x84, 0xA4, 0xB2,
+    0x84, 0xA4, 0xA2, 0x94, 0x96, 0x92, 0x95, 0x86, 0x82, 0xA5, 0x77, 0x82,
+    0xA5, 0x71, 0x15, 0x72, 0xB5, 0x62, 0x15, 0x72, 0xB5, 0x62, 0x24, 0x62,
+    0xD0, 0x45, 0x23, 0x45, 0x3D, 0x04, 0x52, 0x34, 0x52, 0xD1, 0x44, 0x24,
+    0x44, 0x3D, 0x14, 0x42, 0x44, 0x42, 0xD2, 0x52, 0x25, 0x52, 0x3D, 0x25,
+    0x22, 0x55, 0x22, 0xD3, 0x51, 0x26, 0x51, 0x3D, 0x35, 0x12, 0x65, 0x12,
+    0xD4, 0x78, 0x7D, 0x56, 0x86, 0xD0, 0xF0, 0x65, 0x95, 0xD1, 0xF0, 0x64,
+    0xA4, 0xD2, 0xF0, 0x63, 0xB3, 0xD9, 0x2C, 0x2D, 0xB1, 0xC2, 0xD4, 0x5C,
+    0x5A, 0x78, 0x97, 0xA5, 0xB4, 0xC5, 0xB3, 0xD1, 0x4A, 0x3D, 0x25, 0x83,
+    0xD3, 0x58, 0x2D, 0x55, 0x62, 0xD6, 0x55, 0x3D, 0x74, 0x43, 0xD8, 0x52,
+    0x3D, 0x95, 0x13, 0xDB, 0x7D, 0xC6, 0xDE, 0x4D, 0x1F, 0x0D, 0x15, 0xDD,
+    0x7D, 0xB8, 0xDA, 0x32, 0x4D, 0x93, 0x35, 0xD8, 0x24, 0x5D, 0x72, 0x65,
+    0xD5, 0x27, 0x5D, 0x43, 0x84, 0xD3, 0x39, 0x5D, 0x13, 0xA5, 0xD0, 0x3C,
+    0x5B, 0x4C, 0x59, 0x7A, 0x86, 0xA5, 0xD0, 0x40, 0x1B, 0x59, 0x37, 0xA5,
+    0x55, 0xC3, 0x65, 0xB3, 0x84, 0xB2, 0x94, 0xA3, 0x95, 0x83, 0xA5, 0x82,
+    0xC4, 0x72, 0xD0, 0x46, 0x2D, 0x15, 0x43, 0xD2, 0x43, 0x3D, 0x34, 0x32,
+    0xD4, 0x51, 0x2D, 0x57, 0xD7, 0x6D, 0x75, 0xD0, 0xF0, 0x84, 0xD1, 0xF0,
+    0x75, 0xD8, 0x4D, 0x2F, 0x06, 0x5D, 0x2F, 0x06, 0x4D, 0x3F, 0x05, 0x5D,
+    0x76, 0xD6, 0x7D, 0x3D, 0x1C, 0x6D, 0xA6, 0xD9, 0x65, 0xC6, 0x63, 0xD0,
+    0x67, 0x2D, 0x06, 0x72, 0xD0, 0x68, 0x1D, 0x15, 0xDA, 0x6D, 0x96, 0xD9,
+    0x6D, 0x96, 0xDA, 0x5D, 0xA6, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0xA5, 0xDA,
+    0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xDA, 0x5D, 0xA6, 0xD9, 0x6D, 0x11, 0x76,
+    0xD1, 0x17, 0x6D, 0x12, 0x75, 0xD2, 0x26, 0x6D, 0x13, 0x56, 0xC5, 0x5F,
+    0xDB, 0x50, 0xA7, 0x94, 0x4E, 0x20, 0x93, 0x5E, 0x30, 0x83, 0x6E, 0x30,
+    0x73, 0x7E, 0x30, 0x63, 0x8E, 0x30, 0x53, 0x9E, 0x30, 0x43, 0xAE, 0x30,
+    0x33, 0xBE, 0x30, 0x23, 0xCE, 0x30, 0x13, 0xD0, 0x4D, 0x08, 0x90, 0x04,
+    0xD1, 0x3D, 0x14, 0xCF, 0x02, 0x3D, 0x14, 0xD1, 0x3D, 0x14, 0xAF, 0x04,
+    0x3D, 0x14, 0xD1, 0x3D, 0x14, 0x8F, 0x06, 0x38, 0xF0, 0x73, 0xD1, 0x4D,
+    0x13, 0xD1, 0x45, 0xF0, 0x93, 0xD1, 0x4D, 0x13, 0xD1, 0x43, 0xF0, 0xB3,
+    0xD1, 0x4D, 0x13, 0xD1, 0x41, 0xF0, 0xD0, 0x3D, 0x14, 0x89, 0xC4, 0x1F,
+    0x0D, 0x03, 0xD0, 0x41, 0xE3, 0x0C, 0x32, 0xE3, 0x0B, 0x3D, 0x04, 0x3E,
+    0x30, 0xA3, 0x4E, 0x30, 0x93, 0x5E, 0x30, 0x83, 0xD0, 0x46, 0xE3, 0x07,
+    0x37, 0xE3, 0x06, 0x3D, 0x04, 0x8F, 0x05, 0x39, 0x89, 0xF8, 0x48, 0xF0,
+    0x76, 0xD0, 0x31, 0x4C, 0x32, 0x3B, 0x33, 0x4A, 0x34, 0x39, 0x35, 0x48,
+    0x36, 0x37, 0x46, 0x46, 0x38, 0x35, 0x48, 0x44, 0x3A, 0x33, 0x4A, 0x42,
+    0x3C, 0x31, 0x4C, 0x40, 0xF0, 0xDB, 0x12, 0x54, 0x45, 0x44, 0x54, 0x54,
+    0x53, 0x63, 0xB4, 0x23, 0xA2, 0x41, 0x13, 0x83, 0x64, 0x73, 0x74, 0x63,
+    0x83, 0x63, 0x93, 0x54, 0x93, 0x53, 0x93, 0x54, 0x93, 0x53, 0xA3, 0x44,
+    0x94, 0x44, 0x93, 0x4F, 0x49, 0x44, 0x48, 0x54, 0x48, 0x11, 0x34, 0x47,
+    0x11, 0x34, 0x56, 0x12, 0x33, 0x11, 0x54, 0x13, 0x32, 0x13, 0x84, 0x55,
+    0x65, 0x35, 0x84, 0xD0, 0x7A, 0xE2, 0x07, 0x4A, 0xF0, 0x73, 0xD4, 0x4B,
+    0xF0, 0x63, 0xD4, 0x4D, 0x44, 0x45, 0x83, 0x38, 0x73, 0x22, 0x35, 0x54,
+    0x11, 0x65, 0x44, 0x11, 0x74, 0x43, 0x11, 0x84, 0x44, 0x94, 0x35, 0x94,
+    0x34, 0xA4, 0x34, 0x94, 0x1F, 0x02, 0x4A, 0x43, 0x49, 0x44, 0x3A, 0x43,
+    0x49, 0x44, 0x49, 0x35, 0x39, 0x36, 0x38, 0x45, 0x48, 0x36, 0x46, 0x39,
+    0x44, 0x3C, 0x6C, 0xA6, 0xA3, 0x42, 0x73, 0x63, 0x53, 0x64, 0x43, 0x73,
+    0x44, 0xD0, 0x4D, 0x13, 0xD0, 0xF0, 0x14, 0xD1, 0x3D, 0x1E, 0x44, 0xD1,
+    0x4A, 0x13, 0x58, 0x24, 0x47, 0x25, 0x55, 0x27, 0xAA, 0x68, 0xD7, 0x3D,
+    0x47, 0x1F, 0x0D, 0x64, 0x1E, 0x20, 0xD6, 0x3D, 0x74, 0x2F, 0x0D, 0x53,
+    0xD7, 0x4D, 0x14, 0x24, 0xC3, 0x31, 0x13, 0xC2, 0x51, 0x13, 0xA3, 0x74,
+    0x94, 0x73, 0xA3, 0x74, 0x93, 0x84, 0x84, 0x84, 0x5F, 0x02, 0x49, 0x36,
+    0xF0, 0x14, 0x94, 0x74, 0x93, 0x7F, 0x49, 0x47, 0x48, 0x57, 0x48, 0x48,
+    0x47, 0x11, 0x34, 0x13, 0x46, 0x12, 0x33, 0x15, 0x44, 0x13, 0x32, 0x16,
+    0x84, 0x59, 0x46, 0x38, 0xB5, 0xB3, 0x24, 0x73, 0x53, 0x63, 0x63, 0x53,
+    0x73, 0x44, 0x64, 0x34, 0x73, 0x43, 0x73, 0x44, 0x63, 0x45, 0x44, 0x54,
+    0x34, 0x78, 0x9E, 0x34, 0xD1, 0x4B, 0x12, 0x4A, 0x23, 0x48, 0x24, 0x55,
+    0x27, 0xAA, 0x59, 0xD8, 0x5D, 0x72, 0x33, 0xD5, 0x24, 0x3D, 0x43, 0x43,
+    0xD4, 0x2D, 0xB3, 0xDB, 0x29, 0xF0, 0xD2, 0x3D, 0xA4, 0x9F, 0x0D, 0x13,
+    0xAF, 0x09, 0xD0, 0xD5, 0x4A, 0xF0, 0xD0, 0x3B, 0xE2, 0x0C, 0x4B, 0xF0,
+    0xC3, 0xCF, 0x0B, 0x4C, 0xF0, 0xB3, 0xD0, 0xF0, 0xA4, 0xD0, 0xE2, 0x0A,
+    0x3D, 0xA4, 0xD1, 0xE2, 0x09, 0x3D, 0x2F, 0x08, 0x3D, 0xB2, 0xD4, 0xF3,
+    0x42, 0xD5, 0x33, 0x2D, 0x75, 0xD8, 0xA6, 0xD0, 0x34, 0x3A, 0x36, 0x56,
+    0x37, 0x55, 0x38, 0x32, 0xF0, 0x44, 0x83, 0x63, 0x93, 0x63, 0x84, 0x63,
+    0x83, 0x73, 0x74, 0x83, 0x54, 0xA2, 0x43, 0xD0, 0x7D, 0x02, 0xD5, 0x2D,
+    0x53, 0xD5, 0x6D, 0x29, 0xD0, 0xAA, 0x13, 0x87, 0x27, 0x65, 0x2A, 0x53,
+    0x2C, 0x43, 0xF2, 0xD0, 0x33, 0x2D, 0x02, 0x43, 0xB3, 0x52, 0xA3, 0x73,
+    0x63, 0xB8, 0x90, 0x84, 0xD0, 0x7A, 0xE2, 0x07, 0x4A, 0xF0, 0x73, 0xBF,
+    0x06, 0x4B, 0xF0, 0x63, 0xD4, 0x46, 0x38, 0x44, 0x67, 0x34, 0x22, 0x36,
+    0x43, 0x14, 0x36, 0x42, 0x15, 0x36, 0x32, 0x16, 0x36, 0x31, 0x16, 0x36,
+    0x41, 0x16, 0x36, 0x57, 0x33, 0xF0, 0x34, 0x83, 0x3F, 0x02, 0x48, 0x34,
+    0xF0, 0x23, 0x93, 0x54, 0x92, 0x41, 0x14, 0x83, 0x31, 0x23, 0x93, 0x22,
+    0x23, 0x93, 0x21, 0x24, 0x95, 0x34, 0x93, 0x50, 0x63, 0x1E, 0x20, 0x55,
+    0x63, 0x1E, 0x40, 0xD2, 0x33, 0x75, 0x52, 0xE2, 0x03, 0x43, 0xF0, 0x33,
+    0x4F, 0x02, 0x44, 0xF0, 0x23, 0x5F, 0x01, 0x45, 0xF0, 0x13, 0x64, 0x63,
+    0x41, 0x23, 0x31, 0x33, 0x21, 0x45, 0x63, 0x60, 0xD2, 0x31, 0xE2, 0x0D,
+    0x15, 0xD2, 0x31, 0xE4, 0x0D, 0xF0, 0x53, 0xB8, 0x2E, 0x30, 0xC4, 0xD2,
+    0x34, 0xE2, 0x0B, 0x44, 0xF0, 0xB3, 0x5F, 0x0A, 0x45, 0xF0, 0xA3, 0xD2,
+    0x46, 0xE2, 0x09, 0x3D, 0x24, 0x7E, 0x20, 0x83, 0x8E, 0x20, 0x73, 0x93,
+    0x33, 0xA3, 0x32, 0xB3, 0x22, 0xD0, 0x5D, 0x00, 0x84, 0xD0, 0x7A, 0xE2,
+    0x07, 0x4A, 0xF0, 0x73, 0xBF, 0x06, 0x4B, 0xF0, 0x63, 0xD4, 0x4D, 0x43,
+    0x49, 0x53, 0x74, 0x64, 0x72, 0x84, 0x62, 0x93, 0x62, 0xA3, 0x43, 0xA4,
+    0x32, 0xC4, 0x22, 0xD0, 0x32, 0x2D, 0x18, 0xC9, 0xC4, 0x24, 0xB3, 0x34,
+    0xB3, 0x43, 0xA4, 0x44, 0x94, 0x53, 0x93, 0x64, 0x41, 0x24, 0x73, 0x41,
+    0x24, 0x74, 0x21, 0x34, 0x85, 0xD4, 0x35, 0x83, 0x47, 0x65, 0x73, 0x1E,
+    0x20, 0x64, 0x73, 0x2E, 0x20, 0x54, 0x73, 0x3E, 0x20, 0x44, 0x73, 0x4E,
+    0x20, 0x34, 0x73, 0x5F, 0x02, 0x45, 0xF0, 0x23, 0x6F, 0x01, 0x47, 0x38,
+    0x34, 0x12, 0x43, 0x13, 0x42, 0x14, 0x32, 0x15, 0x57, 0x37, 0x54, 0x63,
+    0x74, 0x37, 0x56, 0x56, 0x54, 0x42, 0x23, 0x41, 0x33, 0x54, 0x31, 0x43,
+    0x31, 0x43, 0x54, 0x21, 0x53, 0x21, 0x53, 0x53, 0x21, 0x53, 0x21, 0x54,
+    0x1F, 0x03, 0x41, 0x16, 0x31, 0x16, 0x44, 0x57, 0x47, 0x35, 0x47, 0x56,
+    0x44, 0x57, 0x47, 0x44, 0x48, 0x47, 0x44, 0x48, 0x38, 0x35, 0x38, 0x47,
+    0x44, 0x48, 0x47, 0x44, 0x48, 0x38, 0x42, 0x11, 0x39, 0x38, 0x33, 0x11,
+    0x38, 0x47, 0x33, 0x11, 0x48, 0x47, 0x32, 0x12, 0x48, 0x38, 0x53, 0x39,
+    0x38, 0x44, 0x54, 0x64, 0x38, 0x47, 0x54, 0x41, 0x34, 0x54, 0x31, 0x44,
+    0x54, 0x21, 0x54, 0x53, 0x21, 0x63, 0x63, 0x21, 0x54, 0x54, 0x11, 0x64,
+    0x55, 0x74, 0x53, 0x11, 0x73, 0x55, 0x74, 0x54, 0x84, 0x54, 0x83, 0x63,
+    0x93, 0x54, 0x84, 0x54, 0x84, 0x31, 0x13, 0x93, 0x41, 0x13, 0x93, 0x31,
+    0x14, 0x93, 0x21, 0x24, 0x95, 0x33, 0xB3, 0x40, 0xB6, 0xC4, 0x34, 0x93,
+    0x64, 0x73, 0x83, 0x63, 0x94, 0x44, 0x94, 0x34, 0xA4, 0xF2, 0x4B, 0x41,
+    0x4C, 0x41, 0x4B, 0x41, 0xF5, 0xB4, 0x1F, 0x4B, 0x42, 0x4A, 0x43, 0x4A,
+    0x34, 0x49, 0x36, 0x38, 0x37, 0x46, 0x39, 0x44, 0x2D, 0x06, 0xB0, 0xA4,
+    0x46, 0x98, 0x38, 0xB5, 0x13, 0x26, 0xB3, 0x12, 0x56, 0x94, 0x11, 0x75,
+    0x95, 0x85, 0xF9, 0x49, 0x5F, 0x84, 0xA5, 0x84, 0x95, 0x93, 0xA5, 0x84,
+    0xA4, 0x94, 0x95, 0x93, 0xA4, 0xA3, 0x95, 0x94, 0x94, 0xA4, 0x84, 0xB4,
+    0x74, 0xC4, 0x63, 0xD0, 0x54, 0x4D, 0x14, 0x15, 0xD4, 0x3D, 0x6E, 0x20,
+    0x44, 0xDA, 0x3D, 0x7F, 0x03, 0x4D, 0x96, 0xD6, 0xAD, 0x40, 0xB5, 0xD1,
+    0x33, 0x21, 0x38, 0x35, 0x11, 0x36, 0x47, 0x45, 0x48, 0x36, 0x39, 0x35,
+    0x39, 0x44, 0x49, 0x41, 0xF0, 0x24, 0xA3, 0x34, 0xA4, 0x34, 0xA3, 0x44,
+    0x94, 0x34, 0xA4, 0x34, 0x95, 0x34, 0x81, 0x13, 0x4F, 0x47, 0x11, 0x44,
+    0x46, 0x12, 0x36, 0x43, 0x23, 0x36, 0x83, 0x47, 0x55, 0x4D, 0x43, 0x6F,
+    0x0B, 0x4D, 0x43, 0x7E, 0x20, 0xA4, 0xD3, 0x5D, 0x0B, 0x40, 0x54, 0x43,
+    0x27, 0x45, 0x44, 0x36, 0x44, 0x22, 0x14, 0x44, 0x12, 0xA3, 0x21, 0x7F,
+    0x04, 0x31, 0x1B, 0x5C, 0x31, 0x19, 0xF0, 0x34, 0xAE, 0x20, 0x24, 0xBE,
+    0x20, 0x14, 0xD0, 0x3D, 0x0F, 0x4D, 0x00, 0x76, 0x31, 0x62, 0x45, 0x52,
+    0x73, 0x43, 0x72, 0x1F, 0x04, 0x38, 0x15, 0x47, 0x15, 0x58, 0xF0, 0x55,
+    0xD0, 0x5D, 0x05, 0xD0, 0x4D, 0x14, 0x51, 0x74, 0x4F, 0x01, 0x18, 0x35,
+    0x27, 0x34, 0x37, 0x25, 0x36, 0x35, 0x44, 0x36, 0x13, 0x58, 0x82, 0x92,
+    0x93, 0x84, 0x65, 0x6A, 0x1B, 0x44, 0x4F, 0x04, 0x35, 0xF0, 0x34, 0x5F,
+    0x03, 0x36, 0xF0, 0x24, 0x6F, 0x02, 0x37, 0xF0, 0x14, 0x83, 0x41, 0x3F,
+    0x43, 0x14, 0x42, 0x15, 0x67, 0x47, 0xDB, 0x48, 0x32, 0x78, 0x35, 0x47,
+    0x45, 0x38, 0x41, 0xE2, 0x03, 0x47, 0x45, 0x37, 0x54, 0x47, 0x45, 0x46,
+    0x55, 0x46, 0x11, 0x35, 0x36, 0x64, 0x45, 0x21, 0x35, 0x45, 0x12, 0x35,
+    0x44, 0x22, 0x35, 0x34, 0x23, 0x33, 0x54, 0x13, 0x34, 0x44, 0x14, 0x33,
+    0x11, 0x32, 0x25, 0x32, 0x12, 0x66, 0x54, 0x39, 0x34, 0x33, 0x83, 0x16,
+    0x84, 0x34, 0x74, 0x34, 0x83, 0x34, 0x92, 0x43, 0x92, 0x43, 0x91, 0x53,
+    0x82, 0x53, 0x81, 0x63, 0x72, 0x64, 0x61, 0x74, 0x51, 0x93, 0x51, 0x93,
+    0x41, 0xA3, 0x31, 0xB3, 0x22, 0xB3, 0x12, 0xC5, 0xD0, 0x4D, 0x13, 0xD2,
+    0x2D, 0x31, 0xC0, 0x42, 0xB1, 0x83, 0x17, 0xA1, 0x84, 0x34, 0x92, 0x84,
+    0x43, 0x84, 0x83, 0x43, 0x84, 0x92, 0x43, 0x75, 0x91, 0x53, 0x62, 0x13,
+    0x91, 0x53, 0x61, 0x23, 0x81, 0x64, 0x42, 0x23, 0x81, 0x73, 0x41, 0x33,
+    0x71, 0x83, 0x32, 0x33, 0x62, 0x83, 0x22, 0x43, 0x61, 0x93, 0x21, 0x53,
+    0x51, 0xA3, 0x12, 0x53, 0x42, 0xA5, 0x73, 0x22, 0xB5, 0x73, 0x21, 0xC4,
+    0x83, 0x11, 0xD0, 0x48, 0x5D, 0x03, 0x94, 0xD1, 0x39, 0x3D, 0x22, 0xA2,
+    0xD3, 0x1B, 0x1C, 0x83, 0x73, 0x66, 0x65, 0x41, 0x34, 0x41, 0x22, 0x94,
+    0x31, 0xD2, 0x32, 0x1D, 0x33, 0x11, 0xD4, 0x5D, 0x44, 0x9E, 0x20, 0xA3,
+    0xD6, 0x4D, 0x45, 0xD4, 0x11, 0x3D, 0x31, 0x23, 0xD2, 0x22, 0x3D, 0x21,
+    0x34, 0x41, 0x81, 0x53, 0x41, 0x71, 0x63, 0x31, 0x33, 0x21, 0x64, 0x11,
+    0x45, 0x75, 0x54, 0x93, 0x60, 0x54, 0x92, 0x28, 0x84, 0x54, 0x84, 0x64,
+    0x83, 0x64, 0x92, 0x73, 0x92, 0xF7, 0x48, 0x19, 0x37, 0x1A, 0x46, 0x1A,
+    0x45, 0x2A, 0x45, 0x1C, 0x34, 0x2C, 0x34, 0x1D, 0x04, 0x21, 0xD1, 0x41,
+    0x2D, 0x23, 0x11, 0xD3, 0x5D, 0x34, 0x7F, 0x0A, 0x3D, 0x52, 0xD6, 0x1D,
+    0x62, 0xD6, 0x1D, 0x61, 0xD6, 0x1D, 0x61, 0xD1, 0x32, 0x1D, 0x25, 0xD3,
+    0x4D, 0x40, 0x4D, 0x04, 0xC5, 0x19, 0x15, 0x28, 0x25, 0x18, 0x2D, 0x12,
+    0x4F, 0x0A, 0x2D, 0x12, 0xD1, 0x2D, 0x12, 0xD2, 0x1D, 0x22, 0xD1, 0x2D,
+    0x12, 0xBF, 0x03, 0x2D, 0x14, 0xC7, 0x99, 0x43, 0x11, 0x36, 0x33, 0x74,
+    0x33, 0x93, 0x31, 0xC4, 0x30, 0xC4, 0xB4, 0xC4, 0xD0, 0x35, 0xF0, 0x84,
+    0x5F, 0x08, 0x36, 0xF0, 0x74, 0xD0, 0x37, 0xF0, 0x64, 0x7F, 0x06, 0x38,
+    0xF0, 0x54, 0x8F, 0x04, 0x4B, 0x5B, 0x5D, 0x11, 0xD3, 0x2C, 0xE2, 0x03,
+    0x3B, 0xF0, 0x24, 0xBF, 0x02, 0x3C, 0xF0, 0x14, 0xCF, 0x01, 0x3D, 0x0F,
+    0x4D, 0x0F, 0x3D, 0x22, 0xD3, 0x3C, 0xED, 0xF0, 0x3E, 0x30, 0x30, 0xB2,
+    0xD2, 0x3D, 0x12, 0x1E, 0x30, 0xD0, 0x3F, 0xC4, 0xFC, 0x31, 0xF0, 0xB4,
+    0x1F, 0x0B, 0x32, 0xF0, 0xA4, 0x2F, 0x0A, 0x3D, 0x12, 0xD2, 0x1D, 0x13,
+    0xB6, 0xA4, 0xB4, 0xC3, 0x5F, 0x07, 0x45, 0xF0, 0x73, 0xC4, 0x6F, 0x06,
+    0x37, 0xF0, 0x54, 0x7F, 0x05, 0x3C, 0x4C, 0x3C, 0x3A, 0x5B, 0x36, 0xD2,
+    0x97, 0x23, 0xC4, 0x41, 0x44, 0xD0, 0x22, 0x7A, 0xD2, 0x54};
+
+const GFXglyph FreeSerifItalic24pt7bRLEGlyphs[] PROGMEM = {
+    {0, 0, 0, 12, 0, 1},          // 0x20 ' '
+    {0, 12, 32, 16, 2, -30},      // 0x21 '!'
+    {29, 14, 12, 16, 6, -31},     // 0x22 '"'
+    {48, 25, 31, 23, 0, -30},     // 0x23 '#'
+    {102, 21, 38, 24, 2, -33},    // 0x24 '$'
+    {178, 33, 32, 39, 4, -30},    // 0x25 '%'
+    {278, 30, 33, 37, 4, -31},    // 0x26 '&'
+    {355, 5, 12, 9, 6, -31},      // 0x27 '''
+    {365, 13, 39, 16, 2, -30},    // 0x28 '('
+    {397, 13, 39, 16, 0, -30},    // 0x29 ')'
+    {430, 16, 20, 23, 7, -31},    // 0x2A '*'
+    {463, 23, 23, 32, 4, -22},    // 0x2B '+'
+    {470, 7, 11, 12, -1, -4},     // 0x2C ','
+    {482, 11, 3, 16, 2, -11},     // 0x2D '-'
+    {485, 5, 5, 12, 1, -3},       // 0x2E '.'
+    {490, 21, 33, 14, 0, -31},    // 0x2F '/'
+    {541, 21, 31, 23, 2, -30},    // 0x30 '0'
+    {596, 17, 32, 23, 2, -31},    // 0x31 '1'
+    {626, 21, 31, 24, 0, -30},    // 0x32 '2'
+    {674, 22, 32, 23, 0, -31},    // 0x33 '3'
+    {717, 22, 32, 23, 0, -31},    // 0x34 '4'
+    {773, 22, 32, 24, 0, -31},    // 0x35 '5'
+    {815, 23, 32, 23, 1, -31},    // 0x36 '6'
+    {871, 21, 32, 23, 4, -31},    // 0x37 '7'
+    {921, 22, 32, 23, 1, -31},    // 0x38 '8'
+    {975, 22, 33, 23, 1, -31},    // 0x39 '9'
+    {1029, 9, 22, 12, 2, -20},    // 0x3A ':'
+    {1041, 11, 27, 12, 1, -20},   // 0x3B ';'
+    {1061, 23, 25, 27, 3, -24},   // 0x3C '<'
+    {1099, 24, 12, 31, 4, -17},   // 0x3D '='
+    {1106, 24, 25, 27, 3, -24},   // 0x3E '>'
+    {1144, 16, 33, 21, 6, -31},   // 0x3F '?'
+    {1182, 33, 33, 37, 3, -31},   // 0x40 '@'
+    {1280, 29, 31, 31, 0, -30},   // 0x41 'A'
+    {1343, 28, 31, 28, 0, -30},   // 0x42 'B'
+    {1402, 30, 33, 29, 2, -31},   // 0x43 'C'
+    {1454, 33, 31, 33, 0, -30},   // 0x44 'D'
+    {1519, 29, 31, 27, 0, -30},   // 0x45 'E'
+    {1584, 29, 31, 27, 0, -30},   // 0x46 'F'
+    {1642, 31, 33, 32, 2, -31},   // 0x47 'G'
+    {1709, 36, 31, 33, 0, -30},   // 0x48 'H'
+    {1778, 18, 31, 15, 0, -30},   // 0x49 'I'
+    {1816, 23, 32, 20, 0, -30},   // 0x4A 'J'
+    {1863, 33, 31, 30, 0, -30},   // 0x4B 'K'
+    {1936, 27, 31, 27, 0, -30},   // 0x4C 'L'
+    {1989, 42, 31, 39, 0, -30},   // 0x4D 'M'
+    {2111, 35, 32, 32, 0, -30},   // 0x4E 'N'
+    {2203, 30, 33, 31, 2, -31},   // 0x4F 'O'
+    {2274, 29, 31, 27, 0, -30},   // 0x50 'P'
+    {2326, 30, 41, 31, 2, -31},   // 0x51 'Q'
+    {2412, 28, 31, 29, 0, -30},   // 0x52 'R'
+    {2473, 23, 33, 21, 0, -31},   // 0x53 'S'
+    {2529, 27, 31, 28, 4, -30},   // 0x54 'T'
+    {2582, 31, 32, 33, 5, -30},   // 0x55 'U'
+    {2649, 29, 32, 31, 6, -30},   // 0x56 'V'
+    {2715, 39, 32, 42, 6, -30},   // 0x57 'W'
+    {2819, 32, 31, 31, 0, -30},   // 0x58 'X'
+    {2888, 26, 31, 28, 5, -30},   // 0x59 'Y'
+    {2945, 29, 31, 26, 0, -30},   // 0x5A 'Z'
+    {3002, 17, 39, 18, 1, -31},   // 0x5B '['
+    {3035, 17, 33, 23, 5, -31},   // 0x5C '\'
+    {3081, 17, 39, 18, 1, -31},   // 0x5D ']'
+    {3117, 20, 17, 20, 0, -31},   // 0x5E '^'
+    {3148, 24, 2, 23, 0, 5},      // 0x5F '_'
+    {3150, 8, 8, 12, 6, -31},     // 0x60 '`'
+    {3158, 21, 21, 23, 1, -20},   // 0x61 'a'
+    {3206, 21, 33, 22, 1, -31},   // 0x62 'b'
+    {3267, 18, 22, 19, 1, -20},   // 0x63 'c'
+    {3298, 24, 33, 23, 1, -31},   // 0x64 'd'
+    {3364, 18, 22, 19, 1, -20},   // 0x65 'e'
+    {3399, 27, 42, 20, -4, -31},  // 0x66 'f'
+    {3462, 21, 31, 21, -1, -20},  // 0x67 'g'
+    {3519, 21, 32, 23, 1, -31},   // 0x68 'h'
+    {3584, 10, 32, 12, 2, -30},   // 0x69 'i'
+    {3620, 19, 41, 13, -3, -30},  // 0x6A 'j'
+    {3668, 21, 33, 21, 1, -31},   // 0x6B 'k'
+    {3727, 11, 33, 12, 2, -31},   // 0x6C 'l'
+    {3766, 31, 21, 34, 1, -20},   // 0x6D 'm'
+    {3842, 21, 21, 23, 1, -20},   // 0x6E 'n'
+    {3896, 21, 22, 22, 1, -20},   // 0x6F 'o'
+    {3935, 27, 31, 22, -4, -20},  // 0x70 'p'
+    {3994, 21, 31, 23, 1, -20},   // 0x71 'q'
+    {4054, 17, 21, 17, 1, -20},   // 0x72 'r'
+    {4087, 17, 22, 16, 0, -20},   // 0x73 's'
+    {4126, 12, 26, 11, 1, -24},   // 0x74 't'
+    {4158, 20, 22, 23, 1, -20},   // 0x75 'u'
+    {4209, 18, 22, 21, 3, -20},   // 0x76 'v'
+    {4251, 30, 22, 32, 2, -20},   // 0x77 'w'
+    {4323, 22, 22, 20, -1, -20},  // 0x78 'x'
+    {4373, 21, 31, 22, 1, -20},   // 0x79 'y'
+    {4430, 17, 24, 18, 0, -19},   // 0x7A 'z'
+    {4469, 17, 40, 19, 2, -31},   // 0x7B '{'
+    {4518, 3, 33, 13, 5, -31},    // 0x7C '|'
+    {4523, 16, 41, 19, 0, -32},   // 0x7D '}'
+    {4570, 22, 6, 25, 2, -14}};   // 0x7E '~'
+
+const GFXpackedFont FreeSerifItalic24pt7bRLE PROGMEM = {
+    {(uint8_t *)FreeSerifItalic24pt7bRLEBitmaps,
+     (GFXglyph *)FreeSerifItalic24pt7bRLEGlyphs, 0x20, 0x7E, 56},
+    GFX_FONT_1BPP | GFX_FONT_RLE};
+
+// Approx. 5255 bytes, glyph bitmaps 4582 bytes (7579 uncompressed)
@@ -0,0 +1,383 @@
+// Host test and benchmark of the packed font formats (GFXpackedFont).
+//
+// - The bundled fonts, plain and RLE, are included in a translation unit
+//   built with -Werror=missing-field-initializers.
+// - Each bundled RLE font draws exactly the pixels of its plain version on
+//   GFXcanvas1/8/16, in every rotation, at sizes 1-3, clipped, wrapped, with
+//   opaque and transparent colors. Packing the plain font again with
+//   fontconvert/gfxpack.h gives the bundled bitmaps byte for byte.
+// - Anti-aliased fonts, raw and RLE at 2 and 4 bpp, packed from coverage
+//   data with gfxpack.h, match a reference renderer that draws one pixel at
+//   a time.
+// Then prints glyphs/s and draw calls for "Temp 23.5" on a GFXcanvas16,
+// plain vs packed. `make bench` builds it with -O2 and no sanitizers.
+#include <Adafruit_GFX.h>
+
+#include "../../fontconvert/gfxpack.h"
+
+#include <Fonts/FreeMono24pt7b.h>
+#include <Fonts/FreeMono24pt7bRLE.h>
+#include <Fonts/FreeMonoBold24pt7b.h>
+#include <Fonts/FreeMonoBold24pt7bRLE.h>
+#include <Fonts/FreeMonoBoldOblique24pt7b.h>
+#include <Fonts/FreeMonoBoldOblique24pt7bRLE.h>
+#include <Fonts/FreeMonoOblique24pt7b.h>
+#include <Fonts/FreeMonoOblique24pt7bRLE.h>
+#include <Fonts/FreeSans24pt7b.h>
+#include <Fonts/FreeSans24pt7bRLE.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/FreeSansBold24pt7b.h>
+#include <Fonts/FreeSansBold24pt7bRLE.h>
+#include <Fonts/FreeSansBoldOblique24pt7b.h>
+#include <Fonts/FreeSansBoldOblique24pt7bRLE.h>
+#include <Fonts/FreeSansOblique24pt7b.h>
+#include <Fonts/FreeSansOblique24pt7bRLE.h>
+#include <Fonts/FreeSerif18pt7b.h>
+#include <Fonts/FreeSerif24pt7b.h>
+#include <Fonts/FreeSerif24pt7bRLE.h>
+#include <Fonts/FreeSerifBold24pt7b.h>
+#include <Fonts/FreeSerifBold24pt7bRLE.h>
+#include <Fonts/FreeSerifBoldItalic24pt7b.h>
+#include <Fonts/FreeSerifBoldItalic24pt7bRLE.h>
+#include <Fonts/FreeSerifItalic24pt7b.h>
+#include <Fonts/FreeSerifItalic24pt7bRLE.h>
+#include <Fonts/Org_01.h>
+#include <Fonts/Picopixel.h>
+#include <Fonts/Tiny3x3a2pt7b.h>
+#include <Fonts/TomThumb.h>
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static uint32_t rng = 4321;
+static int rnd(int n) {
+  rng = rng * 1103515245 + 12345;
+  return (int)((rng >> 8) % (uint32_t)n);
+}
+
+static const char text[] = "Hello World! 0123456789 AaBbQqYy {|}~ @#$%&*";
+
+// Coverage of each pixel of a plain glyph, 0 or 15
+static std::vector<uint8_t> unpack(const GFXfont *f, const GFXglyph &g) {
+  std::vector<uint8_t> px(g.width * g.height);
+  const uint8_t *bits = f->bitmap + g.bitmapOffset;
+  for (size_t i = 0; i < px.size(); i++)
+    px[i] = (bits[i / 8] & (0x80 >> (i % 8))) ? 15 : 0;
+  return px;
+}
+
+/// A font packed at run time with gfxpack.h
+struct PackedFont {
+  std::vector<uint8_t> bitmap;
+  std::vector<GFXglyph> glyph;
+  uint8_t format, yAdvance;
+  GFXpackedFont packed;
+
+  // Packs glyphs given as coverage arrays
+  PackedFont(const std::vector<GFXglyph> &glyphs,
+             const std::vector<std::vector<uint8_t> > &pixels, uint8_t format,
+             uint8_t yAdvance) {
+    for (size_t c = 0; c < glyphs.size(); c++) {
+      GFXglyph g = glyphs[c];
+      std::vector<uint8_t> out(g.width * g.height + g.height + 1);
+      g.bitmapOffset = bitmap.size();
+      int n = gfxpack_glyph(pixels[c].data(), g.width, g.height, format,
+                            out.data());
+      bitmap.insert(bitmap.end(), out.begin(), out.begin() + n);
+      glyph.push_back(g);
+    }
+    this->format = format;
+    this->yAdvance = yAdvance;
+  }
+
+  // The font, pointing at the vectors where they are now
+  const GFXpackedFont *font(void) {
+    packed.font = {bitmap.data(), glyph.data(), 0x20,
+                   (uint16_t)(0x20 + glyph.size() - 1), yAdvance};
+    packed.format = format;
+    return &packed;
+  }
+};
+
+// Packs a plain font again, the way fontpack -w does
+static PackedFont repack(const GFXfont *f, uint8_t format) {
+  std::vector<GFXglyph> glyphs(f->glyph, f->glyph + (f->last - f->first + 1));
+  std::vector<std::vector<uint8_t> > pixels;
+  for (size_t c = 0; c < glyphs.size(); c++)
+    pixels.push_back(unpack(f, glyphs[c]));
+  return PackedFont(glyphs, pixels, format, f->yAdvance);
+}
+
+template <typename Canvas> static size_t bytes(Canvas &c);
+template <> size_t bytes(GFXcanvas1 &c) {
+  return (c.width() + 7) / 8 * c.height();
+}
+template <> size_t bytes(GFXcanvas8 &c) { return c.width() * c.height(); }
+template <> size_t bytes(GFXcanvas16 &c) {
+  return c.width() * c.height() * 2;
+}
+
+// Draws the text at a random place and style with both fonts, returns
+// whether the canvases are identical
+template <typename Canvas>
+static bool drawSame(const GFXfont *plain, const GFXpackedFont *packed,
+                     uint16_t maxColor, int it) {
+  Canvas a(300, 120), b(300, 120);
+  int r = rnd(4), sx = it < 10 ? 1 : 1 + rnd(3), sy = it < 10 ? 1 : 1 + rnd(3);
+  int x = rnd(400) - 100, y = rnd(200) - 40;
+  uint16_t fg = rnd(maxColor + 1), bg = rnd(2) ? fg : rnd(maxColor + 1);
+  bool wrap = it & 1;
+  a.setRotation(r);
+  b.setRotation(r);
+  a.setFont(plain);
+  b.setPackedFont(packed);
+  Canvas *c[2] = {&a, &b};
+  for (int i = 0; i < 2; i++) {
+    c[i]->fillScreen(maxColor / 3);
+    c[i]->setTextSize(sx, sy);
+    c[i]->setTextColor(fg, bg);
+    c[i]->setTextWrap(wrap);
+    c[i]->setCursor(x, y);
+    c[i]->print(text);
+  }
+  return !memcmp(a.getBuffer(), b.getBuffer(), bytes(a));
+}
+
+static const struct {
+  const char *name;
+  const GFXfont *plain;
+  const GFXpackedFont *rle;
+} bundled[] = {
+    {"FreeMono24pt7b", &FreeMono24pt7b, &FreeMono24pt7bRLE},
+    {"FreeMonoBold24pt7b", &FreeMonoBold24pt7b, &FreeMonoBold24pt7bRLE},
+    {"FreeMonoBoldOblique24pt7b", &FreeMonoBoldOblique24pt7b,
+     &FreeMonoBoldOblique24pt7bRLE},
+    {"FreeMonoOblique24pt7b", &FreeMonoOblique24pt7b,
+     &FreeMonoOblique24pt7bRLE},
+    {"FreeSans24pt7b", &FreeSans24pt7b, &FreeSans24pt7bRLE},
+    {"FreeSansBold24pt7b", &FreeSansBold24pt7b, &FreeSansBold24pt7bRLE},
+    {"FreeSansBoldOblique24pt7b", &FreeSansBoldOblique24pt7b,
+     &FreeSansBoldOblique24pt7bRLE},
+    {"FreeSansOblique24pt7b", &FreeSansOblique24pt7b,
+     &FreeSansOblique24pt7bRLE},
+    {"FreeSerif24pt7b", &FreeSerif24pt7b, &FreeSerif24pt7bRLE},
+    {"FreeSerifBold24pt7b", &FreeSerifBold24pt7b, &FreeSerifBold24pt7bRLE},
+    {"FreeSerifBoldItalic24pt7b", &FreeSerifBoldItalic24pt7b,
+     &FreeSerifBoldItalic24pt7bRLE},
+    {"FreeSerifItalic24pt7b", &FreeSerifItalic24pt7b,
+     &FreeSerifItalic24pt7bRLE},
+};
+
+static void testBundled(void) {
+  for (size_t i = 0; i < sizeof(bundled) / sizeof(bundled[0]); i++) {
+    const GFXpackedFont *rle = bundled[i].rle;
+    CHECK(rle->format == (GFX_FONT_1BPP | GFX_FONT_RLE), "%s format %02X",
+          bundled[i].name, rle->format);
+    PackedFont again = repack(bundled[i].plain, rle->format);
+    // Same glyph table first, then the bitmaps are the same length
+    bool same = !memcmp(again.glyph.data(), rle->font.glyph,
+                        again.glyph.size() * sizeof(GFXglyph)) &&
+                !memcmp(again.bitmap.data(), rle->font.bitmap,
+                        again.bitmap.size());
+    CHECK(same, "%s differs from gfxpack.h output", bundled[i].name);
+    int diff = 0;
+    for (int it = 0; it < 30; it++) {
+      diff += !drawSame<GFXcanvas1>(bundled[i].plain, rle, 1, it);
+      diff += !drawSame<GFXcanvas8>(bundled[i].plain, rle, 0xFF, it);
+      diff += !drawSame<GFXcanvas16>(bundled[i].plain, rle, 0xFFFF, it);
+    }
+    CHECK(!diff, "%s: %d of 90 drawings differ", bundled[i].name, diff);
+  }
+  // Switching back to a plain or the built-in font drops the format
+  GFXcanvas16 a(40, 20), b(40, 20);
+  a.setPackedFont(&FreeSans24pt7bRLE);
+  a.setFont(&FreeSans9pt7b);
+  b.setFont(&FreeSans9pt7b);
+  a.print("Ab");
+  b.print("Ab");
+  a.setPackedFont(NULL);
+  b.setFont(NULL);
+  a.print("c");
+  b.print("c");
+  CHECK(!memcmp(a.getBuffer(), b.getBuffer(), 40 * 20 * 2),
+        "setFont() after setPackedFont()");
+}
+
+// 5-6-5 blend as documented for anti-aliased fonts, alpha on a 0-15 scale
+static uint16_t blend(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  int a = alpha * 17 / 8, r[3];
+  const int shift[3] = {11, 5, 0}, mask[3] = {31, 63, 31};
+  for (int i = 0; i < 3; i++) {
+    int f = (fg >> shift[i]) & mask[i], b = (bg >> shift[i]) & mask[i];
+    r[i] = (f * a + b * (32 - a)) >> 5;
+  }
+  return (r[0] << 11) | (r[1] << 5) | r[2];
+}
+
+// Reference renderer: one fillRect() per font pixel, straight from the
+// coverage the font was packed from
+static void drawReference(GFXcanvas16 &c, const std::vector<GFXglyph> &glyphs,
+                          const std::vector<std::vector<uint8_t> > &cov,
+                          uint8_t bpp, int16_t x, int16_t y, uint16_t fg,
+                          uint16_t bg, int sx, int sy) {
+  for (const char *s = text; *s; s++) {
+    const GFXglyph &g = glyphs[*s - 0x20];
+    for (int i = 0; i < g.width * g.height; i++) {
+      uint8_t a = gfxpack_level(cov[*s - 0x20][i], bpp);
+      if (!a || ((fg == bg) && (a < 8)))
+        continue;
+      c.fillRect(x + (g.xOffset + i % g.width) * sx,
+                 y + (g.yOffset + i / g.width) * sy, sx, sy,
+                 (a == 15 || fg == bg) ? fg : blend(fg, bg, a));
+    }
+    x += g.xAdvance * sx;
+  }
+}
+
+// Coverage made by averaging 2x2 blocks of a plain font, plus noise so
+// that every level shows up
+static void antiAlias(const GFXfont *f, std::vector<GFXglyph> &glyphs,
+                      std::vector<std::vector<uint8_t> > &cov) {
+  for (uint16_t c = 0; c <= f->last - f->first; c++) {
+    const GFXglyph &src = f->glyph[c];
+    std::vector<uint8_t> px = unpack(f, src);
+    GFXglyph g = {0,
+                  (uint8_t)((src.width + 1) / 2),
+                  (uint8_t)((src.height + 1) / 2),
+                  (uint8_t)(src.xAdvance / 2),
+                  (int8_t)(src.xOffset / 2),
+                  (int8_t)(src.yOffset / 2)};
+    std::vector<uint8_t> a(g.width * g.height);
+    for (int y = 0; y < g.height; y++) {
+      for (int x = 0; x < g.width; x++) {
+        int sum = 0;
+        for (int j = 0; j < 4; j++) {
+          int xx = 2 * x + j % 2, yy = 2 * y + j / 2;
+          if (xx < src.width && yy < src.height)
+            sum += px[yy * src.width + xx];
+        }
+        sum = sum / 4 + rnd(3) - 1;
+        a[y * g.width + x] = sum < 0 ? 0 : sum > 15 ? 15 : sum;
+      }
+    }
+    glyphs.push_back(g);
+    cov.push_back(a);
+  }
+}
+
+static void testAntiAliased(void) {
+  std::vector<GFXglyph> glyphs;
+  std::vector<std::vector<uint8_t> > cov;
+  antiAlias(&FreeSerifBold24pt7b, glyphs, cov);
+  const uint8_t formats[] = {GFX_FONT_2BPP, GFX_FONT_2BPP | GFX_FONT_RLE,
+                             GFX_FONT_4BPP, GFX_FONT_4BPP | GFX_FONT_RLE};
+  for (int f = 0; f < 4; f++) {
+    PackedFont font(glyphs, cov, formats[f], 28);
+    uint8_t bpp = (formats[f] & GFX_FONT_BPP_MASK) == GFX_FONT_4BPP ? 4 : 2;
+    int diff = 0;
+    for (int it = 0; it < 100; it++) {
+      int sx = it < 30 ? 1 : 1 + rnd(2), sy = it < 30 ? 1 : 1 + rnd(2);
+      int16_t x = rnd(60), y = 40 + rnd(30);
+      uint16_t fg = rnd(0x10000), bg = rnd(2) ? fg : rnd(0x10000);
+      GFXcanvas16 ref(1200, 160), out(1200, 160);
+      ref.fillScreen(0x1234);
+      out.fillScreen(0x1234);
+      drawReference(ref, glyphs, cov, bpp, x, y, fg, bg, sx, sy);
+      out.setPackedFont(font.font());
+      out.setTextWrap(false);
+      out.setTextSize(sx, sy);
+      out.setTextColor(fg, bg);
+      out.setCursor(x, y);
+      out.print(text);
+      diff += !!memcmp(ref.getBuffer(), out.getBuffer(), 1200 * 160 * 2);
+    }
+    CHECK(!diff, "AA%d%s: %d of 100 drawings differ from the reference", bpp,
+          (formats[f] & GFX_FONT_RLE) ? " RLE" : "", diff);
+  }
+}
+
+/// Counts the drawing calls text rendering makes
+class CallCounter : public Adafruit_GFX {
+public:
+  CallCounter(void) : Adafruit_GFX(320, 80) {}
+  void drawPixel(int16_t, int16_t, uint16_t) { calls++; }
+  void writePixel(int16_t, int16_t, uint16_t) { calls++; }
+  void writeFastHLine(int16_t, int16_t, int16_t, uint16_t) { calls++; }
+  void writeFastVLine(int16_t, int16_t, int16_t, uint16_t) { calls++; }
+  void writeFillRect(int16_t, int16_t, int16_t, int16_t, uint16_t) {
+    calls++;
+  }
+  unsigned long calls = 0;
+};
+
+// A plain font is a packed one in GFX_FONT_1BPP
+static GFXpackedFont plain(const GFXfont &f) {
+  GFXpackedFont p = {f, GFX_FONT_1BPP};
+  return p;
+}
+
+static void bench(const char *name, const GFXpackedFont *before,
+                  const GFXpackedFont *after, uint16_t bg) {
+  static const char line[] = "Temp 23.5";
+  const int lines = 300;
+  double rate[2];
+  unsigned long calls[2];
+  for (int p = 0; p < 2; p++) {
+    GFXcanvas16 c(320, 80);
+    CallCounter counter;
+    c.setPackedFont(p ? after : before);
+    counter.setPackedFont(p ? after : before);
+    c.setTextColor(0xFFFF, bg);
+    counter.setTextColor(0xFFFF, bg);
+    counter.setCursor(0, 50);
+    counter.print(line);
+    calls[p] = counter.calls;
+    // Best of 5 runs
+    rate[p] = 0;
+    for (int rep = 0; rep < 5; rep++) {
+      unsigned long start = micros();
+      for (int i = 0; i < lines; i++) {
+        c.setCursor(0, 50);
+        c.print(line);
+      }
+      unsigned long us = micros() - start;
+      double r = lines * (sizeof(line) - 1) * 1e6 / (us ? us : 1);
+      rate[p] = r > rate[p] ? r : rate[p];
+    }
+  }
+  printf("  %-28s %5.2f -> %5.2f M glyphs/s %5lu -> %5lu draw calls\n", name,
+         rate[0] / 1e6, rate[1] / 1e6, calls[0], calls[1]);
+}
+
+int main(void) {
+  printf("Bundled RLE fonts\n");
+  testBundled();
+  printf("Anti-aliased fonts\n");
+  testAntiAliased();
+
+  printf("\"Temp 23.5\" on GFXcanvas16, plain -> packed\n");
+  PackedFont sans9 = repack(&FreeSans9pt7b, GFX_FONT_1BPP | GFX_FONT_RLE);
+  PackedFont serif18 = repack(&FreeSerif18pt7b, GFX_FONT_1BPP | GFX_FONT_RLE);
+  GFXpackedFont p9 = plain(FreeSans9pt7b), p18 = plain(FreeSerif18pt7b),
+                p24 = plain(FreeSansBold24pt7b);
+  bench("FreeSans9pt7b RLE", &p9, sans9.font(), 0xFFFF);
+  bench("FreeSerif18pt7b RLE", &p18, serif18.font(), 0xFFFF);
+  bench("FreeSansBold24pt7b RLE", &p24, &FreeSansBold24pt7bRLE, 0xFFFF);
+  std::vector<GFXglyph> glyphs;
+  std::vector<std::vector<uint8_t> > cov;
+  antiAlias(&FreeSansBold24pt7b, glyphs, cov);
+  PackedFont aa4(glyphs, cov, GFX_FONT_4BPP, 28);
+  PackedFont aa4rle(glyphs, cov, GFX_FONT_4BPP | GFX_FONT_RLE, 28);
+  bench("AA4 -> AA4 RLE, blended", aa4.font(), aa4rle.font(), 0x0000);
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,60 @@
+#ifndef _HOST_ADAFRUIT_I2CDEVICE_H
+#define _HOST_ADAFRUIT_I2CDEVICE_H
+
+#include <Wire.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Traffic seen by every fake I2C device since the last reset
+struct I2CStats {
+  unsigned long transactions; ///< One per write() call, ie. one bus START
+  unsigned long bytes;        ///< Prefix and data bytes, without the address
+  unsigned long speedChanges; ///< Calls to setSpeed()
+};
+
+extern I2CStats i2cStats;
+
+/// If set, called with every write, e.g. to model the device's memory
+extern void (*i2cWriteHook)(uint8_t addr, const uint8_t *prefix,
+                            size_t prefix_len, const uint8_t *buffer,
+                            size_t len);
+
+/// Stand-in for the BusIO I2C device that only counts the traffic
+class Adafruit_I2CDevice {
+public:
+  Adafruit_I2CDevice(uint8_t addr, TwoWire *theWire = &Wire)
+      : _addr(addr), _wire(theWire) {}
+  bool begin(bool addr_detect = true) {
+    (void)addr_detect;
+    return true;
+  }
+  uint8_t address(void) { return _addr; }
+  bool write(const uint8_t *buffer, size_t len, bool stop = true,
+             const uint8_t *prefix_buffer = NULL, size_t prefix_len = 0) {
+    (void)stop;
+    if (i2cWriteHook)
+      i2cWriteHook(_addr, prefix_buffer, prefix_len, buffer, len);
+    i2cStats.transactions++;
+    i2cStats.bytes += prefix_len + len;
+    return true;
+  }
+  bool read(uint8_t *buffer, size_t len, bool stop = true) {
+    (void)stop;
+    for (size_t i = 0; i < len; i++)
+      buffer[i] = 0;
+    return true;
+  }
+  bool setSpeed(uint32_t desiredclk) {
+    (void)desiredclk;
+    i2cStats.speedChanges++;
+    return true;
+  }
+  /// Same as the AVR Wire buffer, which is the smallest in use
+  size_t maxBufferSize() { return 32; }
+
+private:
+  uint8_t _addr;
+  TwoWire *_wire;
+};
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef _HOST_ADAFRUIT_SPIDEVICE_H
+#define _HOST_ADAFRUIT_SPIDEVICE_H
+
+#include <SPI.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum _BitOrder {
+  SPI_BITORDER_MSBFIRST = MSBFIRST,
+  SPI_BITORDER_LSBFIRST = 0,
+} BusIOBitOrder;
+
+/// Stand-in for the BusIO SPI device, the host tests only use I2C displays
+class Adafruit_SPIDevice {
+public:
+  Adafruit_SPIDevice(int8_t, uint32_t = 1000000,
+                     BusIOBitOrder = SPI_BITORDER_MSBFIRST, uint8_t = SPI_MODE0,
+                     SPIClass * = &SPI) {}
+  Adafruit_SPIDevice(int8_t, int8_t, int8_t, int8_t, uint32_t = 1000000,
+                     BusIOBitOrder = SPI_BITORDER_MSBFIRST,
+                     uint8_t = SPI_MODE0) {}
+  bool begin(void) { return true; }
+  bool write(const uint8_t *, size_t, const uint8_t * = NULL, size_t = 0) {
+    return true;
+  }
+  void beginTransaction(void) {}
+  void endTransaction(void) {}
+};
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef _HOST_PRINT_H
+#define _HOST_PRINT_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+class __FlashStringHelper;
+
+/// Print with the text overloads the host tests use
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--)
+      n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char *str) {
+    return write((const uint8_t *)str, strlen(str));
+  }
+  size_t print(const char *str) { return write(str); }
+  size_t print(const __FlashStringHelper *str) {
+    return print(reinterpret_cast<const char *>(str));
+  }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(long n) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), "%ld", n);
+    return print(buf);
+  }
+  size_t print(int n) { return print((long)n); }
+  size_t print(double n, int digits = 2) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", digits, n);
+    return print(buf);
+  }
+  size_t println(const char *str = "") { return print(str) + print('\n'); }
+};
+
+#endif
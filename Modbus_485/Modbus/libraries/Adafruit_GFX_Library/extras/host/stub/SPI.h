@@ -0,0 +1,109 @@
+#ifndef _HOST_SPI_H
+#define _HOST_SPI_H
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define SPI_HAS_TRANSACTION
+#define SPI_MODE0 0x00
+#define MSBFIRST 1
+
+/// The SPI wire, shared by SPIClass and the ESP-IDF driver model in
+/// driver/spi_master.h. Keeps every byte sent with the level of the DC pin,
+/// and a virtual clock of the CPU and of the wire for frame rate estimates.
+struct SPIWire {
+  std::mutex lock;
+  std::vector<uint8_t> bytes;
+  std::vector<bool> isData;          ///< DC level of each byte
+  std::atomic<bool> dc{true};        ///< Follows the display's DC pin
+  std::atomic<int> dmaActive{0};     ///< DMA transactions not sent yet
+  unsigned long violations = 0;      ///< SPIClass writes during DMA
+  double bitrate = 40e6;             ///< Bits/second
+  double cpuTime = 0, wireTime = 0;  ///< Virtual time in us
+
+  /// Reserves the wire for n bytes once both the CPU and the wire are
+  /// ready, returns the virtual time the transfer ends
+  double reserve(size_t n) {
+    double start = cpuTime > wireTime ? cpuTime : wireTime;
+    wireTime = start + n * 8 / bitrate * 1e6;
+    return wireTime;
+  }
+
+  /// Sends n bytes, taking the real time they would take on the wire so
+  /// that a DMA transfer really overlaps with the CPU
+  void send(const uint8_t *p, size_t n, bool fromDma) {
+    if (!fromDma) {
+      if (dmaActive.load())
+        violations++;
+      cpuTime = reserve(n); // Blocking write
+    }
+    std::this_thread::sleep_for(
+        std::chrono::nanoseconds((long long)(n * 8 / bitrate * 1e9)));
+    std::lock_guard<std::mutex> l(lock);
+    bytes.insert(bytes.end(), p, p + n);
+    isData.insert(isData.end(), n, dc.load());
+  }
+};
+
+extern SPIWire spiWire;
+
+class SPISettings {
+public:
+  SPISettings(uint32_t = 0, uint8_t = 0, uint8_t = 0) {}
+};
+
+/// SPIClass with the write functions of the ESP32 core, sending to spiWire
+class SPIClass {
+public:
+  void begin(void) {}
+  void beginTransaction(SPISettings) {
+    transactions++;
+    begun++;
+  }
+  void endTransaction(void) {
+    // Like the bus lock: an end without a begin releases nothing
+    if (transactions)
+      transactions--;
+  }
+  void setFrequency(uint32_t) {}
+  void setBitOrder(uint8_t) {}
+  void setDataMode(uint8_t) {}
+  uint8_t transfer(uint8_t data) {
+    write(data);
+    return 0;
+  }
+  void write(uint8_t data) { spiWire.send(&data, 1, false); }
+  void write16(uint16_t data) {
+    uint8_t b[2] = {(uint8_t)(data >> 8), (uint8_t)data};
+    spiWire.send(b, 2, false);
+  }
+  void write32(uint32_t data) {
+    uint8_t b[4] = {(uint8_t)(data >> 24), (uint8_t)(data >> 16),
+                    (uint8_t)(data >> 8), (uint8_t)data};
+    spiWire.send(b, 4, false);
+  }
+  void writeBytes(const uint8_t *data, uint32_t size) {
+    spiWire.send(data, size, false);
+  }
+  /// Sends 16-bit pixels most significant byte first
+  void writePixels(const void *data, uint32_t size) {
+    const uint8_t *p = (const uint8_t *)data;
+    std::vector<uint8_t> b(size);
+    for (uint32_t i = 0; i + 1 < size; i += 2) {
+      b[i] = p[i + 1];
+      b[i + 1] = p[i];
+    }
+    spiWire.send(b.data(), size, false);
+  }
+  int transactions = 0;    ///< Begun and not ended, holding the bus lock
+  unsigned long begun = 0; ///< beginTransaction() calls
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef _HOST_ESP_HEAP_CAPS_H
+#define _HOST_ESP_HEAP_CAPS_H
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA (1 << 3)
+
+inline void *heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+inline void heap_caps_free(void *ptr) { free(ptr); }
+
+#endif
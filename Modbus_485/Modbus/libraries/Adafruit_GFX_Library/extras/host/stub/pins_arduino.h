@@ -0,0 +1 @@
+// Empty, included by the display drivers
@@ -8,6 +8,16 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+Options ahead of the font file select a smaller or smoother format
+(see gfxpack.h for the layouts), e.g.:
+  ./fontconvert -c ~/Library/Fonts/FreeSans.ttf 24 > FreeSans24pt7bRLE.h
+  -c   run-length encode the glyphs, usually 50-60% smaller at 18 pt
+       and up, often larger below 12 pt
+  -a2  anti-aliased, 2 bits of coverage per pixel
+  -a4  anti-aliased, 4 bits of coverage per pixel
+Options append RLE, AA2 or AA4 to the font name so the variants can be
+included side by side.  fontpack does the same for existing headers.
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
 Currently this only extracts the printable 7-bit ASCII chars of a font.
@@ -25,34 +35,32 @@ See notes at end for glyph nomenclature & other tidbits.
 #include FT_GLYPH_H
 #include FT_MODULE_H
 #include FT_TRUETYPE_DRIVER_H
-#include "../gfxfont.h" // Adafruit_GFX font structures
+#include "gfxpack.h" // Adafruit_GFX font structures & glyph packing
+#include <stdlib.h>
+#include <string.h>
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
-// Accumulate bits for output, with periodic hexadecimal byte write
-void enbit(uint8_t value) {
-  static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
-  if (value)
-    sum |= bit;          // Set bit if needed
-  if (!(bit >>= 1)) {    // Advance to next bit, end of byte reached?
-    if (!firstCall) {    // Format output table nicely
-      if (++row >= 12) { // Last entry on line?
-        printf(",\n  "); //   Newline format output
-        row = 0;         //   Reset row counter
-      } else {           // Not end of line
-        printf(", ");    //   Simple comma delim
-      }
+// Hexadecimal byte write for output, formatted 12 to a line
+void enbyte(uint8_t value) {
+  static uint8_t row = 0, firstCall = 1;
+  if (!firstCall) {    // Format output table nicely
+    if (++row >= 12) { // Last entry on line?
+      printf(",\n  "); //   Newline format output
+      row = 0;         //   Reset row counter
+    } else {           // Not end of line
+      printf(", ");    //   Simple comma delim
     }
-    printf("0x%02X", sum); // Write byte value
-    sum = 0;               // Clear for next byte
-    bit = 0x80;            // Reset bit counter
-    firstCall = 0;         // Formatting flag
   }
+  printf("0x%02X", value); // Write byte value
+  firstCall = 0;           // Formatting flag
 }
 
 int main(int argc, char *argv[]) {
   int i, j, err, size, first = ' ', last = '~', bitmapOffset = 0, x, y, byte;
-  char *fontName, c, *ptr;
+  int arg, bpp = 1, plainSize = 0, n;
+  uint8_t format = GFX_FONT_1BPP, *pixels, *packed;
+  char *fontName, *progName = argv[0], c, *ptr;
   FT_Library library;
   FT_Face face;
   FT_Glyph glyph;
@@ -62,14 +70,31 @@ int main(int argc, char *argv[]) {
   uint8_t bit;
 
   // Parse command line.  Valid syntaxes are:
-  //   fontconvert [filename] [size]
-  //   fontconvert [filename] [size] [last char]
-  //   fontconvert [filename] [size] [first char] [last char]
+  //   fontconvert [options] [filename] [size]
+  //   fontconvert [options] [filename] [size] [last char]
+  //   fontconvert [options] [filename] [size] [first char] [last char]
   // Unless overridden, default first and last chars are
   // ' ' (space) and '~', respectively
 
+  for (arg = 1; (arg < argc) && (argv[arg][0] == '-'); arg++) {
+    if (!strcmp(argv[arg], "-c")) {
+      format |= GFX_FONT_RLE;
+    } else if (!strcmp(argv[arg], "-a2")) {
+      format = (format & ~GFX_FONT_BPP_MASK) | GFX_FONT_2BPP;
+      bpp = 2;
+    } else if (!strcmp(argv[arg], "-a4")) {
+      format = (format & ~GFX_FONT_BPP_MASK) | GFX_FONT_4BPP;
+      bpp = 4;
+    } else {
+      break;
+    }
+  }
+  argc -= arg - 1; // Options out of the way of the positional arguments
+  argv += arg - 1;
+
   if (argc < 3) {
-    fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
+    fprintf(stderr, "Usage: %s [-c] [-a2|-a4] fontfile size [first] [last]\n",
+            progName);
     return 1;
   }
 
@@ -109,7 +134,9 @@ int main(int argc, char *argv[]) {
     ptr = &fontName[strlen(fontName)]; // If none, append
   // Insert font size and 7/8 bit.  fontName was alloc'd w/extra
   // space to allow this, we're not sprintfing into Forbidden Zone.
-  sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
+  sprintf(ptr, "%dpt%db%s%s", size, (last > 127) ? 8 : 7,
+          (bpp == 4) ? "AA4" : (bpp == 2) ? "AA2" : "",
+          (format & GFX_FONT_RLE) ? "RLE" : "");
   // Space and punctuation chars in name replaced w/ underscores.
   for (i = 0; (c = fontName[i]); i++) {
     if (isspace(c) || ispunct(c))
@@ -123,8 +150,8 @@ int main(int argc, char *argv[]) {
   }
 
   // Use TrueType engine version 35, without subpixel rendering.
-  // This improves clarity of fonts since this library does not
-  // support rendering multiple levels of gray in a glyph.
+  // This improves clarity of fonts, most of which are drawn with a
+  // single level of gray.
   // See https://github.com/adafruit/Adafruit-GFX-Library/issues/103
   FT_UInt interpreter_version = TT_INTERPRETER_VERSION_35;
   FT_Property_Set(library, "truetype", "interpreter-version",
@@ -150,13 +177,17 @@ int main(int argc, char *argv[]) {
   // Process glyphs and output huge bitmap data array
   for (i = first, j = 0; i <= last; i++, j++) {
     // MONO renderer provides clean image with perfect crop
-    // (no wasted pixels) via bitmap struct.
-    if ((err = FT_Load_Char(face, i, FT_LOAD_TARGET_MONO))) {
+    // (no wasted pixels) via bitmap struct.  Anti-aliased formats
+    // use the 256-level gray renderer instead.
+    int mono = (bpp == 1);
+    if ((err = FT_Load_Char(face, i, mono ? FT_LOAD_TARGET_MONO
+                                          : FT_LOAD_TARGET_NORMAL))) {
       fprintf(stderr, "Error %d loading char '%c'\n", err, i);
       continue;
     }
 
-    if ((err = FT_Render_Glyph(face->glyph, FT_RENDER_MODE_MONO))) {
+    if ((err = FT_Render_Glyph(face->glyph, mono ? FT_RENDER_MODE_MONO
+                                                 : FT_RENDER_MODE_NORMAL))) {
       fprintf(stderr, "Error %d rendering char '%c'\n", err, i);
       continue;
     }
@@ -184,22 +215,35 @@ int main(int argc, char *argv[]) {
     table[j].xOffset = g->left;
     table[j].yOffset = 1 - g->top;
 
+    // Coverage of each pixel on a 0-15 scale, packed by gfxpack_glyph()
+    n = bitmap->width * bitmap->rows;
+    if ((!(pixels = malloc(n + 1))) ||
+        (!(packed = malloc(n + bitmap->rows + 1)))) {
+      fprintf(stderr, "Malloc error\n");
+      return 1;
+    }
     for (y = 0; y < bitmap->rows; y++) {
       for (x = 0; x < bitmap->width; x++) {
-        byte = x / 8;
-        bit = 0x80 >> (x & 7);
-        enbit(bitmap->buffer[y * bitmap->pitch + byte] & bit);
+        if (mono) {
+          byte = x / 8;
+          bit = 0x80 >> (x & 7);
+          pixels[y * bitmap->width + x] =
+              (bitmap->buffer[y * bitmap->pitch + byte] & bit) ? 15 : 0;
+        } else {
+          pixels[y * bitmap->width + x] =
+              (bitmap->buffer[y * bitmap->pitch + x] * 15 + 127) / 255;
+        }
       }
     }
 
-    // Pad end of char bitmap to next byte boundary if needed
-    int n = (bitmap->width * bitmap->rows) & 7;
-    if (n) {     // Pixel count not an even multiple of 8?
-      n = 8 - n; // # bits to next multiple
-      while (n--)
-        enbit(0);
-    }
-    bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
+    // Each char bitmap is padded to the next byte boundary if needed
+    n = gfxpack_glyph(pixels, bitmap->width, bitmap->rows, format, packed);
+    for (x = 0; x < n; x++)
+      enbyte(packed[x]);
+    bitmapOffset += n;
+    plainSize += (bitmap->width * bitmap->rows * bpp + 7) / 8;
+    free(pixels);
+    free(packed);
 
     FT_Done_Glyph(glyph);
   }
@@ -226,17 +270,34 @@ int main(int argc, char *argv[]) {
   printf("\n\n");
 
   // Output font structure
-  printf("const GFXfont %s PROGMEM = {\n", fontName);
+  if (format) { // A GFXfont wrapped with its format
+    printf("const GFXpackedFont %s PROGMEM = {{\n", fontName);
+  } else {
+    printf("const GFXfont %s PROGMEM = {\n", fontName);
+  }
   printf("  (uint8_t  *)%sBitmaps,\n", fontName);
   printf("  (GFXglyph *)%sGlyphs,\n", fontName);
   if (face->size->metrics.height == 0) {
     // No face height info, assume fixed width and get from a glyph.
-    printf("  0x%02X, 0x%02X, %d };\n\n", first, last, table[0].height);
+    printf("  0x%02X, 0x%02X, %d", first, last, table[0].height);
   } else {
-    printf("  0x%02X, 0x%02X, %ld };\n\n", first, last,
+    printf("  0x%02X, 0x%02X, %ld", first, last,
            face->size->metrics.height >> 6);
   }
-  printf("// Approx. %d bytes\n", bitmapOffset + (last - first + 1) * 7 + 7);
+  if (format) {
+    printf(" },\n  GFX_FONT_%dBPP%s };\n\n", bpp,
+           (format & GFX_FONT_RLE) ? " | GFX_FONT_RLE" : "");
+  } else {
+    printf(" };\n\n");
+  }
+  printf("// Approx. %d bytes", bitmapOffset + (last - first + 1) * 7 + 8);
+  if (format & GFX_FONT_RLE) {
+    printf(", glyph bitmaps %d bytes (%d uncompressed)", bitmapOffset,
+           plainSize);
+    if (bitmapOffset >= plainSize)
+      fprintf(stderr, "RLE does not save space on this font, drop -c\n");
+  }
+  printf("\n");
   // Size estimate is based on AVR struct and pointer sizes;
   // actual size may vary.
 
@@ -0,0 +1,327 @@
+/*
+Adafruit_GFX font header repacker and size report.
+
+NOT AN ARDUINO SKETCH.  This is a command-line tool that reads font
+headers already converted by fontconvert (such as the ones in the
+'Fonts' folder) and tells how much flash the run-length encoded format
+saves on each, or writes the run-length encoded version of one font.
+No FreeType or original outline font is needed.
+
+  ./fontpack ../Fonts/[A-Z]*.h
+      Size report: plain and RLE glyph bitmap bytes for every font, each
+      font checked by decoding it again.
+  ./fontpack -w ../Fonts/FreeSans24pt7b.h > FreeSans24pt7bRLE.h
+      Writes the RLE version of a font, named with an RLE suffix.
+
+Only plain 1 bpp headers are read; anti-aliased fonts must come from
+fontconvert, which has the coverage the gray levels are made from.
+*/
+#ifndef ARDUINO
+
+#include "gfxpack.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+  char name[80];
+  uint8_t *bitmap;
+  int bitmapSize;
+  GFXglyph *glyph;
+  int first, last, yAdvance;
+} font_t;
+
+// Reads a whole file with its comments blanked out, NULL on failure
+static char *readSource(const char *path) {
+  FILE *f = fopen(path, "rb");
+  long len;
+  char *text, *p;
+  if (!f)
+    return NULL;
+  fseek(f, 0, SEEK_END);
+  len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  if ((text = malloc(len + 1)) && (fread(text, 1, len, f) == (size_t)len)) {
+    text[len] = 0;
+    for (p = text; *p; p++) {
+      if ((p[0] == '/') && (p[1] == '/')) {
+        while (*p && (*p != '\n'))
+          *p++ = ' ';
+      } else if ((p[0] == '/') && (p[1] == '*')) {
+        while (*p && !((p[0] == '*') && (p[1] == '/')))
+          *p++ = ' ';
+        if (*p)
+          p[0] = p[1] = ' ';
+      }
+      if (!*p)
+        break;
+    }
+  } else {
+    free(text);
+    text = NULL;
+  }
+  fclose(f);
+  return text;
+}
+
+// Next integer in text, skipping anything that is not part of a number.
+// Returns 0 once the closing brace of the current table is reached.
+static int nextNumber(char **text, long *value) {
+  char *p = *text;
+  while (*p && !isdigit((unsigned char)*p) && (*p != '-')) {
+    if ((p[0] == '}') && (p[1] == ';'))
+      return 0;
+    p++;
+  }
+  if (!*p)
+    return 0;
+  *value = strtol(p, text, 0);
+  return 1;
+}
+
+static int loadFont(const char *path, font_t *font) {
+  char *text = readSource(path), *p, *q;
+  long v[6];
+  int i, n = 0, cap = 0;
+
+  memset(font, 0, sizeof(*font));
+  if (!text)
+    return 0;
+  if (!(p = strstr(text, "Bitmaps[]")) || !(p = strchr(p, '{'))) {
+    free(text);
+    return 0;
+  }
+  for (p++; nextNumber(&p, v);) {
+    if (n == cap)
+      font->bitmap = realloc(font->bitmap, cap = cap ? cap * 2 : 1024);
+    font->bitmap[n++] = v[0];
+  }
+  font->bitmapSize = n;
+
+  n = cap = 0;
+  if (!(p = strstr(text, "Glyphs[]")) || !(p = strchr(p, '{'))) {
+    free(text);
+    return 0;
+  }
+  for (p++;;) {
+    for (i = 0; (i < 6) && nextNumber(&p, &v[i]); i++)
+      ;
+    if (i < 6)
+      break;
+    if (n == cap)
+      font->glyph = realloc(font->glyph, (cap = cap ? cap * 2 : 128) *
+                                             sizeof(GFXglyph));
+    font->glyph[n].bitmapOffset = v[0];
+    font->glyph[n].width = v[1];
+    font->glyph[n].height = v[2];
+    font->glyph[n].xAdvance = v[3];
+    font->glyph[n].xOffset = v[4];
+    font->glyph[n].yOffset = v[5];
+    n++;
+  }
+
+  // const GFXfont Name PROGMEM = {(uint8_t *)..., (GFXglyph *)...Glyphs,
+  //                               first, last, yAdvance};
+  // Packed fonts are GFXpackedFont and don't match.
+  if (!(p = strstr(text, "GFXfont ")) || strstr(p, "GFX_FONT_")) {
+    free(text);
+    return 0;
+  }
+  for (p += 8; isspace((unsigned char)*p); p++)
+    ;
+  for (q = p; (isalnum((unsigned char)*q) || (*q == '_')) &&
+              (q - p < (int)sizeof(font->name) - 1);
+       q++)
+    ;
+  memcpy(font->name, p, q - p);
+  if (!(p = strstr(q, "Glyphs")) || !(p += 6, nextNumber(&p, &v[0])) ||
+      !nextNumber(&p, &v[1]) || !nextNumber(&p, &v[2])) {
+    free(text);
+    return 0;
+  }
+  font->first = v[0];
+  font->last = v[1];
+  font->yAdvance = v[2];
+  free(text);
+  // Glyphs past 'last' belong to optional sections (#if) that are off
+  return n >= (font->last - font->first + 1);
+}
+
+// Unpacks a plain 1 bpp glyph into coverage values of 0 or 15
+static void unpackPlain(const uint8_t *data, int w, int h, uint8_t *pixels) {
+  int i;
+  for (i = 0; i < w * h; i++)
+    pixels[i] = (data[i / 8] & (0x80 >> (i & 7))) ? 15 : 0;
+}
+
+// Nibble reader for unpackRLE()
+typedef struct {
+  const uint8_t *data;
+  int pos; // In nibbles
+} nibbles_t;
+
+static int peekNibble(const nibbles_t *in) {
+  return (in->pos & 1) ? (in->data[in->pos / 2] & 15)
+                       : (in->data[in->pos / 2] >> 4);
+}
+
+static int readNibble(nibbles_t *in) {
+  int value = peekNibble(in);
+  in->pos++;
+  return value;
+}
+
+static int readRun(nibbles_t *in) {
+  int code = readNibble(in);
+  return (code == 13) ? 13 + readNibble(in) : code;
+}
+
+// Independent decoder for the 1 bpp RLE format, mirrors the one in
+// Adafruit_GFX::drawChar() and is used to check every packed glyph
+static void unpackRLE(const uint8_t *data, int w, int h, uint8_t *pixels) {
+  nibbles_t in = {data, 0};
+  int y = 0, x, rem = 0, set = 1, rep, i, len;
+  while (y < h) {
+    rep = 0;
+    if (!rem && (peekNibble(&in) >= 14))
+      rep = (readNibble(&in) == 15) ? 1 : readRun(&in);
+    for (x = 0; x < w;) {
+      while (!rem) {
+        rem = readRun(&in);
+        set = !set;
+      }
+      len = (rem < w - x) ? rem : w - x;
+      for (i = 0; i < len; i++, x++)
+        pixels[y * w + x] = set ? 15 : 0;
+      rem -= len;
+    }
+    for (i = 1; (i <= rep) && (y + i < h); i++)
+      memcpy(&pixels[(y + i) * w], &pixels[y * w], w);
+    y += rep + 1;
+  }
+}
+
+// Packs every glyph of the font as RLE into packed/offsets, returns the
+// total size or -1 if a glyph does not decode back to the original
+static int packFont(const font_t *font, uint8_t *packed, uint16_t *offsets) {
+  int i, total = 0;
+  for (i = 0; i <= font->last - font->first; i++) {
+    const GFXglyph *g = &font->glyph[i];
+    int n = g->width * g->height;
+    uint8_t *pixels = malloc(n + 1), *check = malloc(n + 1);
+    unpackPlain(&font->bitmap[g->bitmapOffset], g->width, g->height, pixels);
+    offsets[i] = total;
+    if (n) {
+      total += gfxpack_glyph(pixels, g->width, g->height,
+                             GFX_FONT_1BPP | GFX_FONT_RLE, &packed[total]);
+      unpackRLE(&packed[offsets[i]], g->width, g->height, check);
+      if (memcmp(pixels, check, n)) {
+        fprintf(stderr, "%s: glyph 0x%02X does not round-trip\n", font->name,
+                font->first + i);
+        total = -1;
+      }
+    }
+    free(pixels);
+    free(check);
+    if (total < 0)
+      break;
+  }
+  return total;
+}
+
+// Writes the RLE font, laid out like the headers in the Fonts folder
+static void writeFont(const font_t *font, const uint8_t *packed, int size,
+                      const uint16_t *offsets) {
+  int i, pass, width = 0;
+  printf("#pragma once\n#include <Adafruit_GFX.h>\n\n");
+  printf("const uint8_t %sRLEBitmaps[] PROGMEM = {\n", font->name);
+  for (i = 0; i < size; i++)
+    printf("%s0x%02X%s", (i % 12) ? " " : "    ", packed[i],
+           (i == size - 1) ? "};\n\n" : ((i % 12) == 11) ? ",\n" : ",");
+  printf("const GFXglyph %sRLEGlyphs[] PROGMEM = {\n", font->name);
+  for (pass = 0; pass < 2; pass++) { // Measure, then print aligned
+    for (i = 0; i <= font->last - font->first; i++) {
+      const GFXglyph *g = &font->glyph[i];
+      char entry[48];
+      int c = font->first + i;
+      int len = sprintf(entry, "{%d, %d, %d, %d, %d, %d}%s", offsets[i],
+                        g->width, g->height, g->xAdvance, g->xOffset,
+                        g->yOffset, (c == font->last) ? "};" : ",");
+      if (!pass) {
+        if (len > width)
+          width = len;
+        continue;
+      }
+      printf("    %-*s  // 0x%02X", width, entry, c);
+      if ((c >= ' ') && (c <= '~'))
+        printf(" '%c'", c);
+      putchar('\n');
+    }
+  }
+  printf("\nconst GFXpackedFont %sRLE PROGMEM = {\n", font->name);
+  printf("    {(uint8_t *)%sRLEBitmaps,\n", font->name);
+  printf("     (GFXglyph *)%sRLEGlyphs, 0x%02X, 0x%02X, %d},\n", font->name,
+         font->first, font->last, font->yAdvance);
+  printf("    GFX_FONT_1BPP | GFX_FONT_RLE};\n\n");
+  printf("// Approx. %d bytes, glyph bitmaps %d bytes (%d uncompressed)\n",
+         size + (font->last - font->first + 1) * 7 + 8, size,
+         font->bitmapSize);
+}
+
+int main(int argc, char *argv[]) {
+  int i, write = 0, status = 0;
+  long plainTotal = 0, packedTotal = 0;
+
+  if ((argc > 1) && !strcmp(argv[1], "-w")) {
+    write = 1;
+    argc--;
+    argv++;
+  }
+  if ((argc < 2) || (write && (argc != 2))) {
+    fprintf(stderr,
+            "Usage: %s font.h [font.h ...]   (size report)\n"
+            "       %s -w font.h             (write the RLE version)\n",
+            argv[0], argv[0]);
+    return 1;
+  }
+
+  if (!write)
+    printf("%-32s %8s %8s %7s\n", "font", "plain", "RLE", "saved");
+  for (i = 1; i < argc; i++) {
+    font_t font;
+    uint8_t *packed;
+    uint16_t *offsets;
+    int size;
+    if (!loadFont(argv[i], &font)) {
+      fprintf(stderr, "%s: not a plain 1 bpp GFX font header\n", argv[i]);
+      status = 1;
+      continue;
+    }
+    // Worst case for a glyph is w * h + h + 1 bytes
+    packed = malloc(font.bitmapSize * 8 + (font.last - font.first + 1) * 512);
+    offsets = malloc((font.last - font.first + 1) * sizeof(uint16_t));
+    size = packFont(&font, packed, offsets);
+    if (size < 0) {
+      status = 1;
+    } else if (write) {
+      writeFont(&font, packed, size, offsets);
+    } else {
+      printf("%-32s %8d %8d %6.1f%%%s\n", font.name, font.bitmapSize, size,
+             100.0 * (font.bitmapSize - size) / font.bitmapSize,
+             (size >= font.bitmapSize) ? "  (keep plain)" : "");
+      plainTotal += font.bitmapSize;
+      packedTotal += (size < font.bitmapSize) ? size : font.bitmapSize;
+    }
+    free(packed);
+    free(offsets);
+    free(font.bitmap);
+    free(font.glyph);
+  }
+  if (!write && plainTotal)
+    printf("%-32s %8ld %8ld %6.1f%%  (RLE only where smaller)\n", "total",
+           plainTotal, packedTotal,
+           100.0 * (plainTotal - packedTotal) / plainTotal);
+  return status;
+}
+
+#endif /* !ARDUINO */
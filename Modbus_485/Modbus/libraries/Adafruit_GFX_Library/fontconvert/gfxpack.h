@@ -0,0 +1,183 @@
+/*
+Glyph bitmap packing for the Adafruit_GFX font formats, shared by
+fontconvert and fontpack.  NOT AN ARDUINO SOURCE FILE; the matching
+decoder lives in Adafruit_GFX::drawChar().
+
+Each glyph starts on a byte boundary and is padded to the next one.
+Pixels are visited row by row, top to bottom, left to right.
+
+GFX_FONT_1BPP: 1 bit per pixel, MSB first (the classic format).
+
+GFX_FONT_2BPP / GFX_FONT_4BPP: 2 or 4 bits of coverage per pixel, MSB
+first.  Coverage is stored on a 0-15 scale; 2 bpp keeps levels 0, 5,
+10 and 15 only.
+
+GFX_FONT_1BPP | GFX_FONT_RLE: a stream of 4-bit codes, high nibble
+first, describing alternating runs of clear and set pixels, starting
+with clear.  Runs continue across rows.
+  0       zero-length run (just switches color)
+  1-12    run of 1 to 12 pixels
+  13 n    run of 13 + n pixels (13 to 28)
+  14 ...  the row starting here is repeated; a run length as above
+          gives the number of extra copies
+  15      the row starting here is repeated once
+Repeat codes only appear where a row starts on a run boundary, so the
+decoder can draw each run once, with the height of all the copies.
+
+GFX_FONT_4BPP | GFX_FONT_RLE: a stream of 4-bit codes.
+  0 n     n + 1 clear pixels (1 to 16)
+  1-14    one pixel with that coverage
+  15 n    n + 1 fully covered pixels (1 to 16)
+
+GFX_FONT_2BPP | GFX_FONT_RLE: the same runs, but codes 1-14 hold two
+pixels of 2 bits each, exactly as in the unpacked format.  A pair that
+would run past the end of the glyph is padded with a clear pixel.
+*/
+#ifndef _GFXPACK_H_
+#define _GFXPACK_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../gfxfont.h"
+
+#define GFXPACK_RUN_MAX 28   // Longest run in one 1 bpp RLE code
+#define GFXPACK_AA_RUN_MAX 16 // Longest run in one anti-aliased RLE code
+
+// Nibble or bit accumulator for one glyph
+typedef struct {
+  uint8_t *buf;  // Output bytes
+  int len;       // Bytes started so far
+  uint8_t shift; // Bits still free in the last byte
+} gfxpack_out;
+
+static void gfxpack_bits(gfxpack_out *o, uint8_t value, uint8_t bits) {
+  if (!o->shift) {
+    o->buf[o->len++] = 0;
+    o->shift = 8;
+  }
+  o->shift -= bits;
+  o->buf[o->len - 1] |= value << o->shift;
+}
+
+// Run length code for the 1 bpp RLE format, 1 <= n <= GFXPACK_RUN_MAX
+static void gfxpack_runlength(gfxpack_out *o, int n) {
+  if (n <= 12) {
+    gfxpack_bits(o, n, 4);
+  } else {
+    gfxpack_bits(o, 13, 4);
+    gfxpack_bits(o, n - 13, 4);
+  }
+}
+
+// Coverage level actually stored for pixel value p at the given depth
+static uint8_t gfxpack_level(uint8_t p, uint8_t bpp) {
+  return (bpp == 2) ? (p + 2) / 5 * 5 : p;
+}
+
+/*
+Packs one glyph of w * h pixels into out, which must hold at least
+w * h + h + 1 bytes.  pixels[] holds the coverage of each pixel on a 0-15 scale,
+1 bpp formats treat 8 and above as set.  Returns the number of bytes
+written.
+*/
+static int gfxpack_glyph(const uint8_t *pixels, int w, int h, uint8_t format,
+                         uint8_t *out) {
+  gfxpack_out o = {out, 0, 0};
+  uint8_t bpp = (format & GFX_FONT_BPP_MASK) == GFX_FONT_4BPP   ? 4
+                : (format & GFX_FONT_BPP_MASK) == GFX_FONT_2BPP ? 2
+                                                                : 1;
+  int i, n = w * h;
+
+  if (!(format & GFX_FONT_RLE)) {
+    for (i = 0; i < n; i++) {
+      if (bpp == 1)
+        gfxpack_bits(&o, pixels[i] >= 8, 1);
+      else if (bpp == 2)
+        gfxpack_bits(&o, (pixels[i] + 2) / 5, 2);
+      else
+        gfxpack_bits(&o, pixels[i], 4);
+    }
+    return o.len;
+  }
+
+  if (bpp > 1) {
+    for (i = 0; i < n;) {
+      uint8_t a = gfxpack_level(pixels[i], bpp);
+      int run = 1;
+      uint8_t b = (i + 1 < n) ? gfxpack_level(pixels[i + 1], bpp) : 0;
+      if ((bpp == 2) && ((a && (a < 15)) || ((i + 1 < n) && (b != a)))) {
+        // Two pixels in one code, unless both are clear or both covered
+        gfxpack_bits(&o, a / 5, 2);
+        gfxpack_bits(&o, b / 5, 2);
+        run = 2;
+      } else if (a && (a < 15)) { // Partial coverage, one pixel per code
+        gfxpack_bits(&o, a, 4);
+      } else { // Clear or fully covered, run length
+        while ((i + run < n) && (run < GFXPACK_AA_RUN_MAX) &&
+               (gfxpack_level(pixels[i + run], bpp) == a))
+          run++;
+        gfxpack_bits(&o, a, 4);
+        gfxpack_bits(&o, run - 1, 4);
+      }
+      i += run;
+    }
+    return o.len;
+  }
+
+  // 1 bpp RLE.  Walk the rows the same way the decoder does: at the start
+  // of every row that is followed by identical rows, end the current run
+  // (a zero-length run keeps the color) and emit a repeat code.
+  int y = 0, x, color = 0, run = 0;
+  while (y < h) {
+    const uint8_t *row = &pixels[y * w];
+    int rep = 0;
+    while ((y + rep + 1 < h) && (rep < GFXPACK_RUN_MAX)) {
+      const uint8_t *next = &pixels[(y + rep + 1) * w];
+      for (x = 0; (x < w) && ((row[x] >= 8) == (next[x] >= 8)); x++)
+        ;
+      if (x < w)
+        break;
+      rep++;
+    }
+    if (rep) {
+      if (run) // Close the run that would otherwise enter this row
+        gfxpack_runlength(&o, run);
+      if (rep == 1) {
+        gfxpack_bits(&o, 15, 4);
+      } else {
+        gfxpack_bits(&o, 14, 4);
+        gfxpack_runlength(&o, rep);
+      }
+      if (run) {
+        if ((row[0] >= 8) == color)
+          gfxpack_bits(&o, 0, 4); // Zero-length run, keep the color
+        else
+          color = !color;
+        run = 0;
+      }
+    }
+    for (x = 0; x < w; x++) {
+      if ((row[x] >= 8) != color) {
+        if (run)
+          gfxpack_runlength(&o, run);
+        else
+          gfxpack_bits(&o, 0, 4); // Glyph starts with a set pixel
+        color = !color;
+        run = 0;
+      }
+      if (run == GFXPACK_RUN_MAX) { // Too long for one code, split it
+        gfxpack_runlength(&o, run);
+        gfxpack_bits(&o, 0, 4);
+        run = 0;
+      }
+      run++;
+    }
+    y += rep + 1;
+  }
+  if (run)
+    gfxpack_runlength(&o, run);
+  return o.len;
+}
+
+#endif // _GFXPACK_H_
@@ -153,6 +153,78 @@ public:
   void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 
   uint8_t readcommand8(uint8_t reg, uint8_t index = 0);
+
+  void drawClassicChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                       uint16_t bg, uint8_t size);
+};
+
+/**************************************************************************/
+/*!
+@brief Scrolling text console on an ILI9341, for logs and terminals. In
+portrait rotations (0 and 2) it uses the display's hardware vertical
+scrolling, so a new line only costs the pixels of that line instead of a
+redraw of the whole text area. The last lines are kept in a ring buffer
+and drawn again when the rotation changes.
+*/
+/**************************************************************************/
+class Adafruit_ILI9341_Console : public Print {
+public:
+  Adafruit_ILI9341_Console(Adafruit_ILI9341 *tft, uint8_t size = 1);
+  ~Adafruit_ILI9341_Console(void);
+  Adafruit_ILI9341_Console(const Adafruit_ILI9341_Console &) =
+      delete; ///< Owns its line buffer
+  Adafruit_ILI9341_Console &
+  operator=(const Adafruit_ILI9341_Console &) = delete; ///< Owns its line buffer
+
+  bool begin(uint16_t top = 0, uint16_t bottom = 0);
+  void setTextColor(uint16_t fg, uint16_t bg);
+  void clear(void);
+  void redraw(void);
+  size_t write(uint8_t c);
+  using Print::write;
+
+  /**********************************************************************/
+  /*!
+    @brief    Text rows shown in the current rotation
+    @returns  Number of rows, 0 before begin()
+  */
+  /**********************************************************************/
+  uint8_t rows(void) const { return _rows; }
+
+  /**********************************************************************/
+  /*!
+    @brief    Characters per row in the current rotation; longer lines
+              wrap to the next row
+    @returns  Number of columns, 0 before begin()
+  */
+  /**********************************************************************/
+  uint8_t columns(void) const { return _cols; }
+
+private:
+  void layout(void);
+  void newLine(void);
+  uint8_t rowLine(uint8_t row) const;
+  int16_t rowY(uint8_t row) const;
+  void drawRow(uint8_t row, uint8_t clearTo);
+  void drawText(int16_t x, int16_t y, const char *text, uint8_t n);
+
+  Adafruit_ILI9341 *_tft;
+  char *_text;        ///< Ring of _maxLines lines, _maxCols chars each
+  uint8_t *_length;   ///< Characters in each line of the ring
+  uint8_t _maxLines;  ///< Lines in the ring, rows of the tallest rotation
+  uint8_t _maxCols;   ///< Characters per line, columns of the widest one
+  uint8_t _last;      ///< Ring index of the line being written
+  uint8_t _count;     ///< Lines in the ring, including the current one
+  uint8_t _rows;      ///< Rows shown in the current rotation
+  uint8_t _cols;      ///< Columns in the current rotation
+  uint8_t _scroll;    ///< Row slot shown at the top of the console
+  uint8_t _size;      ///< Text magnification
+  uint8_t _rotation;  ///< Rotation the layout was made for
+  uint16_t _top;      ///< Height of the fixed area above the console
+  uint16_t _bottom;   ///< Height of the fixed area below the console
+  uint16_t _tfa;      ///< Top fixed area in panel lines (VSCRDEF)
+  uint16_t _fg, _bg;  ///< Text colors
+  bool _hardware;     ///< Scrolling with VSCRSADD (portrait rotations)
 };
 
 #endif // _ADAFRUIT_ILI9341H_
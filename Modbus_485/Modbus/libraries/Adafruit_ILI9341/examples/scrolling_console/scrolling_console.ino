@@ -0,0 +1,74 @@
+// Event log on an ILI9341 with Adafruit_ILI9341_Console. In portrait the
+// console uses the display's hardware vertical scrolling: a new line only
+// sends that line's pixels plus a 2-byte scroll command, instead of drawing
+// the whole text area again. A title bar stays fixed above the log.
+//
+// Every 20 seconds the display is turned half way round (rotation 0 <-> 2)
+// and the console draws its last lines again from its line buffer. The
+// time taken by each log line is shown in the title bar.
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_ILI9341.h"
+#include "SPI.h"
+
+// For the Adafruit shield, these are the default.
+#define TFT_DC 9
+#define TFT_CS 10
+
+#define TITLE_HEIGHT 16
+
+Adafruit_ILI9341 tft(TFT_CS, TFT_DC);
+Adafruit_ILI9341_Console console(&tft);
+
+uint32_t events = 0, lastTurn = 0;
+
+void drawTitle(unsigned long lineMicros) {
+  tft.fillRect(0, 0, tft.width(), TITLE_HEIGHT, ILI9341_NAVY);
+  tft.setTextColor(ILI9341_WHITE);
+  tft.setTextSize(1);
+  tft.setCursor(4, 4);
+  tft.print("Event log  ");
+  tft.print(lineMicros);
+  tft.print(" us/line");
+}
+
+void setup() {
+  Serial.begin(115200);
+  tft.begin();
+  tft.fillScreen(ILI9341_BLACK);
+  drawTitle(0);
+
+  console.setTextColor(ILI9341_GREEN, ILI9341_BLACK);
+  if (!console.begin(TITLE_HEIGHT, 0)) {
+    Serial.println("Console: out of memory");
+    while (1)
+      yield();
+  }
+  Serial.print("Console: ");
+  Serial.print(console.rows());
+  Serial.print(" rows of ");
+  Serial.print(console.columns());
+  Serial.println(" characters");
+}
+
+void loop() {
+  unsigned long start = micros();
+  console.print(millis() / 1000);
+  console.print("s  event #");
+  console.print(++events);
+  console.print("  A0=");
+  console.println(analogRead(A0));
+  unsigned long elapsed = micros() - start;
+
+  if ((events % 16) == 0)
+    drawTitle(elapsed);
+
+  if (millis() - lastTurn > 20000) {
+    lastTurn = millis();
+    tft.setRotation(tft.getRotation() ^ 2);
+    tft.fillScreen(ILI9341_BLACK);
+    drawTitle(elapsed);
+    console.redraw();
+  }
+  delay(250);
+}
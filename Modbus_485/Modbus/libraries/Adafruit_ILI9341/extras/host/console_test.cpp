@@ -0,0 +1,307 @@
+// Host test and traffic count of Adafruit_ILI9341_Console, over the SPI
+// stand-in of the GFX library's extras/host/stub, which keeps every byte
+// with the level of the DC pin. A model of the panel decodes them: frame
+// memory written through CASET, PASET and RAMWR under the MADCTL address
+// mapping, and shown through VSCRDEF and VSCRSADD.
+//
+// - The picture shown matches the expected lines drawn on a GFXcanvas16:
+//   sizes 1-3, all four rotations, fixed areas above and below, lines
+//   longer than a row, partial lines, and a rotation change with redraw().
+//   The fixed areas keep what the sketch drew there.
+// - Every SPI transaction ends.
+// Then prints SPI transactions and bytes per new line, in steady state, for
+// the console and for clearing and printing all the lines again, in a
+// portrait (hardware scrolling) and a landscape rotation.
+#include <Adafruit_ILI9341.h>
+
+#include <string>
+#include <vector>
+
+#define TFT_CS 10
+#define TFT_DC 9
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static uint32_t rng = 1;
+static int rnd(int n) {
+  rng = rng * 1103515245 + 12345;
+  return (int)((rng >> 8) % (uint32_t)n);
+}
+
+static void followDC(uint8_t pin, uint8_t value) {
+  if (pin == TFT_DC)
+    spiWire.dc = value;
+}
+
+/// The ILI9341 frame memory and scrolling, fed from spiWire
+struct Panel {
+  uint16_t mem[ILI9341_TFTHEIGHT][ILI9341_TFTWIDTH] = {{0}};
+  uint8_t madctl = 0, cmd = 0;
+  std::vector<uint8_t> args;
+  uint16_t sc = 0, ec = 0, sp = 0, c = 0, p = 0;
+  uint16_t tfa = 0, vsa = ILI9341_TFTHEIGHT, vsp = 0;
+  int high = -1; ///< First byte of a pixel, -1 if none
+
+  /// Panel column and line of the address counters x, y
+  void map(int x, int y, int &col, int &line) {
+    if (madctl & 0x20) {
+      col = y;
+      line = x;
+    } else {
+      col = x;
+      line = y;
+    }
+    if (madctl & 0x40)
+      col = ILI9341_TFTWIDTH - 1 - col;
+    if (madctl & 0x80)
+      line = ILI9341_TFTHEIGHT - 1 - line;
+  }
+
+  uint16_t arg16(int i) { return (args[i] << 8) | args[i + 1]; }
+
+  void in(uint8_t b, bool data) {
+    if (!data) {
+      cmd = b;
+      args.clear();
+      if (cmd == ILI9341_RAMWR) {
+        c = sc;
+        p = sp;
+        high = -1;
+      }
+      return;
+    }
+    if (cmd == ILI9341_RAMWR) {
+      if (high < 0) {
+        high = b;
+        return;
+      }
+      int col, line;
+      map(c, p, col, line);
+      if (col < ILI9341_TFTWIDTH && line < ILI9341_TFTHEIGHT)
+        mem[line][col] = (high << 8) | b;
+      high = -1;
+      if (++c > ec) {
+        c = sc;
+        p++;
+      }
+      return;
+    }
+    args.push_back(b);
+    if (cmd == ILI9341_CASET && args.size() == 4) {
+      sc = arg16(0);
+      ec = arg16(2);
+    } else if (cmd == ILI9341_PASET && args.size() == 4) {
+      sp = arg16(0);
+    } else if (cmd == ILI9341_MADCTL && args.size() == 1) {
+      madctl = b;
+    } else if (cmd == ILI9341_VSCRDEF && args.size() == 6) {
+      tfa = arg16(0);
+      vsa = arg16(2);
+    } else if (cmd == ILI9341_VSCRSADD && args.size() == 2) {
+      vsp = arg16(0);
+    }
+  }
+
+  /// Takes what was sent since the last call
+  void feed(void) {
+    std::lock_guard<std::mutex> l(spiWire.lock);
+    for (size_t i = 0; i < spiWire.bytes.size(); i++)
+      in(spiWire.bytes[i], spiWire.isData[i]);
+    spiWire.bytes.clear();
+    spiWire.isData.clear();
+  }
+
+  /// The pixel seen at x, y of the current rotation
+  uint16_t shown(int x, int y) {
+    int col, line;
+    map(x, y, col, line);
+    if (line >= tfa && line < tfa + vsa)
+      line = tfa + (vsp - tfa + line - tfa + 2 * vsa) % vsa;
+    return mem[line][col];
+  }
+};
+
+static Adafruit_ILI9341 tft(TFT_CS, TFT_DC);
+static Panel panel;
+
+static const uint16_t kFixed = 0x1234; // What the sketch draws around
+
+/// The lines the console should hold
+struct Lines {
+  std::vector<std::string> lines{""};
+  void put(char c, int cols) {
+    if (c == '\r')
+      return;
+    if (c == '\n') {
+      lines.push_back("");
+      return;
+    }
+    if ((int)lines.back().size() >= cols)
+      lines.push_back("");
+    lines.back() += c;
+  }
+};
+
+static void write(Adafruit_ILI9341_Console &con, Lines &expected,
+                  const std::string &s) {
+  for (char c : s) {
+    con.write(c);
+    expected.put(c, con.columns());
+  }
+}
+
+// Returns the number of pixels that differ from the expected picture. Below
+// the last row, in what is left of the console area, anything goes.
+static int differences(Adafruit_ILI9341_Console &con, Lines &expected,
+                       int top, int bottom, uint8_t size) {
+  panel.feed();
+  int w = tft.width(), h = tft.height(), end = top + con.rows() * 8 * size;
+  GFXcanvas16 ref(w, h);
+  ref.fillScreen(kFixed);
+  ref.fillRect(0, top, w, end - top, 0);
+  ref.setTextSize(size);
+  ref.setTextColor(0xFFFF, 0);
+  int n = expected.lines.size(), rows = n < con.rows() ? n : con.rows();
+  for (int r = 0; r < rows; r++) {
+    ref.setCursor(0, top + r * 8 * size);
+    ref.print(expected.lines[n - rows + r].substr(0, con.columns()).c_str());
+  }
+  int bad = 0;
+  for (int y = 0; y < h; y++) {
+    if (y >= end && y < h - bottom)
+      continue;
+    for (int x = 0; x < w; x++)
+      bad += panel.shown(x, y) != ref.getBuffer()[y * w + x];
+  }
+  return bad;
+}
+
+static std::string randomLine(int cols, char first) {
+  std::string s(rnd(cols + 20), ' ');
+  for (char &c : s)
+    c = first + rnd(26);
+  return s;
+}
+
+static void testPicture(uint8_t size, int rotation) {
+  const int top = 16, bottom = 10;
+  tft.setRotation(rotation);
+  tft.setScrollMargins(0, 0);
+  tft.scrollTo(0);
+  tft.fillScreen(kFixed);
+  Adafruit_ILI9341_Console con(&tft, size);
+  con.setTextColor(0xFFFF, 0);
+  CHECK(con.begin(top, bottom), "begin()");
+  Lines expected;
+  for (int i = 0; i < 150; i++) {
+    write(con, expected, randomLine(con.columns(), 'A') + "\n");
+    if (i % 37 == 0) {
+      int bad = differences(con, expected, top, bottom, size);
+      if (bad) {
+        CHECK(false, "size %d, rotation %d, line %d: %d pixels differ", size,
+              rotation, i, bad);
+        return;
+      }
+    }
+  }
+
+  // Rotate with the console running: the sketch redraws its fixed areas
+  tft.setRotation((rotation + 1) % 4);
+  tft.fillRect(0, 0, tft.width(), top, kFixed);
+  tft.fillRect(0, tft.height() - bottom, tft.width(), bottom, kFixed);
+  con.redraw();
+  for (int i = 0; i < 50; i++)
+    write(con, expected, randomLine(con.columns(), 'a') + "\r\n");
+  write(con, expected, "partial");
+  int bad = differences(con, expected, top, bottom, size);
+  CHECK(!bad, "size %d, rotation %d -> %d: %d pixels differ", size, rotation,
+        (rotation + 1) % 4, bad);
+  CHECK(SPI.transactions == 0, "%d SPI transactions left open",
+        SPI.transactions);
+}
+
+// Returns the bytes sent so far, without keeping them
+static unsigned long sentBytes(void) {
+  static unsigned long sent = 0;
+  std::lock_guard<std::mutex> l(spiWire.lock);
+  sent += spiWire.bytes.size();
+  spiWire.bytes.clear();
+  spiWire.isData.clear();
+  return sent;
+}
+
+static std::string logLine(int i) {
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%05d 12:%02d:%02d temp=23.%d hum=41%%", i,
+           i % 60, i * 7 % 60, i % 10);
+  return buf;
+}
+
+// Adds lines one by one, each by clearing and printing all shown lines
+// again or through the console; prints the traffic per line after the
+// screen has filled up
+static void bench(int rotation, bool console) {
+  const int lines = 100, warmUp = 50;
+  tft.setRotation(rotation);
+  tft.setScrollMargins(0, 0);
+  tft.scrollTo(0);
+  Adafruit_ILI9341_Console con(&tft);
+  con.begin();
+  int rows = tft.height() / 8;
+  std::vector<std::string> log;
+  unsigned long transactions = 0, bytes = 0;
+  for (int i = 0; i < lines; i++) {
+    if (i == warmUp) {
+      transactions = SPI.begun;
+      bytes = sentBytes();
+    }
+    if (console) {
+      con.println(logLine(i).c_str());
+      sentBytes();
+      continue;
+    }
+    log.push_back(logLine(i));
+    tft.fillScreen(0);
+    tft.setCursor(0, 0);
+    tft.setTextColor(0xFFFF, 0);
+    tft.setTextWrap(false);
+    int n = log.size(), shown = n < rows ? n : rows;
+    for (int r = 0; r < shown; r++)
+      tft.println(log[n - shown + r].c_str());
+    sentBytes();
+  }
+  double n = lines - warmUp;
+  printf("  rotation %d, %-22s %8.1f transactions/line %8.0f bytes/line\n",
+         rotation, console ? "console" : "clear + print all lines",
+         (SPI.begun - transactions) / n, (sentBytes() - bytes) / n);
+}
+
+int main(void) {
+  digitalWriteHook = followDC;
+  spiWire.bitrate = 1e15; // No waiting for the wire
+  tft.begin();
+
+  printf("Picture\n");
+  for (uint8_t size = 1; size <= 3; size++) {
+    for (int rotation = 0; rotation < 4; rotation++)
+      testPicture(size, rotation);
+  }
+
+  printf("%d-character lines\n", (int)logLine(0).size());
+  for (int rotation = 0; rotation < 2; rotation++) {
+    bench(rotation, false);
+    bench(rotation, true);
+  }
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -51,7 +51,7 @@ bool AdafruitIO_Dashboard::exists() {
   _io->_http->endRequest();
 
   int status = _io->_http->responseStatusCode();
-  _io->_http->responseBody(); // needs to be read even if not used
+  _io->_http->skipResponseBody(); // needs to be read even if not used
 
   return status == 200;
 }
@@ -88,7 +88,7 @@ bool AdafruitIO_Dashboard::create() {
   _io->_http->endRequest();
 
   int status = _io->_http->responseStatusCode();
-  _io->_http->responseBody(); // needs to be read even if not used
+  _io->_http->skipResponseBody(); // needs to be read even if not used
 
   return status == 201;
 }
@@ -298,7 +298,7 @@ bool AdafruitIO_Feed::exists() {
   _io->_http->endRequest();
 
   int status = _io->_http->responseStatusCode();
-  _io->_http->responseBody(); // needs to be read even if not used
+  _io->_http->skipResponseBody(); // needs to be read even if not used
 
   return status == 200;
 }
@@ -331,7 +331,7 @@ bool AdafruitIO_Feed::create() {
   _io->_http->endRequest();
 
   int status = _io->_http->responseStatusCode();
-  _io->_http->responseBody(); // needs to be read even if not used
+  _io->_http->skipResponseBody(); // needs to be read even if not used
 
   return status == 201;
 }
@@ -360,12 +360,18 @@ AdafruitIO_Data *AdafruitIO_Feed::lastValue() {
   _io->_http->endRequest();
 
   int status = _io->_http->responseStatusCode();
-  String body = _io->_http->responseBody();
+
+  // the value is a single CSV line, read it straight into a buffer
+  // AdafruitIO_Data can hold instead of building a String
+  char body[AIO_CSV_LENGTH];
+  int length = _io->_http->readBody((uint8_t *)body, sizeof(body) - 1);
+  body[length] = 0;
+  _io->_http->skipResponseBody(); // anything that did not fit
 
   if (status >= 200 && status <= 299) {
 
-    if (body.length() > 0) {
-      return new AdafruitIO_Data(this, body.c_str());
+    if (length > 0) {
+      return new AdafruitIO_Data(this, body);
     }
 
     return NULL;
@@ -375,7 +381,7 @@ AdafruitIO_Data *AdafruitIO_Feed::lastValue() {
     AIO_ERROR_PRINT("error retrieving lastValue, status: ");
     AIO_ERROR_PRINTLN(status);
     AIO_ERROR_PRINT("response body: ");
-    AIO_ERROR_PRINTLN(_io->_http->responseBody());
+    AIO_ERROR_PRINTLN(body);
 
     return NULL;
   }
@@ -440,7 +440,7 @@ bool AdafruitIO_Group::exists() {
   _io->_http->endRequest();
 
   int status = _io->_http->responseStatusCode();
-  _io->_http->responseBody(); // needs to be read even if not used
+  _io->_http->skipResponseBody(); // needs to be read even if not used
   return status == 200;
 }
 
@@ -472,7 +472,7 @@ bool AdafruitIO_Group::create() {
   _io->_http->endRequest();
 
   int status = _io->_http->responseStatusCode();
-  _io->_http->responseBody(); // needs to be read even if not used
+  _io->_http->skipResponseBody(); // needs to be read even if not used
   return status == 201;
 }
 
@@ -123,7 +123,7 @@ bool AdafruitIO_Block::save() {
   http->endRequest();
 
   int status = http->responseStatusCode();
-  http->responseBody(); // needs to be read even if not used
+  http->skipResponseBody(); // needs to be read even if not used
 
   return status == 200;
 }
@@ -343,6 +343,16 @@ typedef enum {
   LIS3DH_MODE_HIGH_RESOLUTION = 0x2,
 } lis3dh_mode_t;
 
+/** FIFO modes, for FIFO_CTRL_REG **/
+typedef enum {
+  LIS3DH_FIFO_BYPASS = 0b00,         // FIFO off, output registers only
+  LIS3DH_FIFO_FIFO = 0b01,           // Fill up, then stop
+  LIS3DH_FIFO_STREAM = 0b10,         // Keep the newest 32, drop the oldest
+  LIS3DH_FIFO_STREAM_TO_FIFO = 0b11, // Stream until the trigger, then FIFO
+} lis3dh_fifo_mode_t;
+
+#define LIS3DH_FIFO_SIZE 32 ///< Samples the FIFO holds
+
 /*!
  * @brief  Data rate selection
  * Used with register 0x2A (LIS3DH_REG_CTRL_REG1) to set bandwidth
@@ -372,6 +382,16 @@ public:
                   uint32_t frequency = LIS3DH_DEFAULT_SPIFREQ);
   Adafruit_LIS3DH(int8_t cspin, int8_t mosipin, int8_t misopin, int8_t sckpin,
                   uint32_t frequency = LIS3DH_DEFAULT_SPIFREQ);
+  ~Adafruit_LIS3DH() {
+    delete ctrl_regs;
+    delete i2c_dev;
+    delete spi_dev;
+  }
+  Adafruit_LIS3DH(const Adafruit_LIS3DH &) = delete; ///< Owns its bus devices
+  Adafruit_LIS3DH &
+  operator=(const Adafruit_LIS3DH &) = delete; ///< Owns its bus devices
+  Adafruit_LIS3DH(Adafruit_LIS3DH &&other);
+  Adafruit_LIS3DH &operator=(Adafruit_LIS3DH &&other);
 
   bool begin(uint8_t addr = LIS3DH_DEFAULT_ADDRESS, uint8_t nWAI = 0x33);
 
@@ -400,6 +420,12 @@ public:
 
   uint8_t readAndClearInterrupt(void);
 
+  bool setFifoMode(lis3dh_fifo_mode_t mode, uint8_t watermark = 0);
+  bool enableFifoWatermarkInterrupt(bool enable = true);
+  uint8_t fifoAvailable(void);
+  bool fifoOverrun(void);
+  uint8_t readFifo(int16_t samples[][3], uint8_t max);
+
   int16_t x; /**< x axis value */
   int16_t y; /**< y axis value */
   int16_t z; /**< z axis value */
@@ -414,6 +440,7 @@ private:
 
   Adafruit_I2CDevice *i2c_dev = NULL; ///< Pointer to I2C bus interface
   Adafruit_SPIDevice *spi_dev = NULL; ///< Pointer to SPI bus interface
+  Adafruit_BusIO_RegisterMap *ctrl_regs = NULL; ///< Copy of the CTRL registers
 
   uint8_t _wai;
 
@@ -422,6 +449,7 @@ private:
   int8_t _i2caddr;
 
   int32_t _sensorID;
+  bool _fifoOverrun = false;
   uint32_t _frequency = LIS3DH_DEFAULT_SPIFREQ;
 };
 
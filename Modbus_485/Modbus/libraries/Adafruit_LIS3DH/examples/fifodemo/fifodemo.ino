@@ -0,0 +1,61 @@
+// FIFO demo for Adafruit LIS3DH: collects samples at a high data rate
+// in the chip's 32 sample FIFO and drains them in batches
+
+#include <Wire.h>
+#include <SPI.h>
+#include <Adafruit_LIS3DH.h>
+#include <Adafruit_Sensor.h>
+
+// I2C
+Adafruit_LIS3DH lis = Adafruit_LIS3DH();
+
+// At 1.6 kHz and above, a lower watermark leaves more room for the FIFO
+// to keep filling while a batch is being read
+#define WATERMARK 16
+
+int16_t samples[LIS3DH_FIFO_SIZE][3];
+uint32_t total = 0;
+uint32_t lastReport = 0;
+
+void setup(void) {
+  Serial.begin(115200);
+  while (!Serial) delay(10);     // will pause Zero, Leonardo, etc until serial console opens
+
+  Serial.println("LIS3DH FIFO test!");
+
+  if (! lis.begin(0x18)) {   // change this to 0x19 for alternative i2c address
+    Serial.println("Couldnt start");
+    while (1) yield();
+  }
+  Serial.println("LIS3DH found!");
+
+  Wire.setClock(400000);
+  lis.setDataRate(LIS3DH_DATARATE_400_HZ);
+
+  // Keep the newest 32 samples; the watermark flag is also on INT1
+  lis.setFifoMode(LIS3DH_FIFO_STREAM, WATERMARK);
+  lis.enableFifoWatermarkInterrupt();
+}
+
+void loop() {
+  uint8_t n = lis.readFifo(samples, LIS3DH_FIFO_SIZE);
+  if (lis.fifoOverrun()) {
+    Serial.println("FIFO overrun, samples were lost");
+  }
+  total += n;
+
+  if (millis() - lastReport >= 1000) {
+    lastReport = millis();
+    Serial.print(total); Serial.print(" samples/s");
+    if (n) {
+      // Newest sample, raw
+      Serial.print("  \tX:  "); Serial.print(samples[n - 1][0]);
+      Serial.print("  \tY:  "); Serial.print(samples[n - 1][1]);
+      Serial.print("  \tZ:  "); Serial.print(samples[n - 1][2]);
+    }
+    Serial.println();
+    total = 0;
+  }
+
+  delay(20); // Room for 8 samples at 400 Hz before the next drain
+}
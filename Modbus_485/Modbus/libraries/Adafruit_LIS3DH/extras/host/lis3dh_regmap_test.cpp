@@ -0,0 +1,199 @@
+// Host test of the Adafruit_BusIO_RegisterMap copy of the LIS3DH CTRL
+// registers, over a fake TwoWire (stub/Wire.h) whose LIS3DH model moves to
+// the next register only when bit 7 of the sub-address is set.
+//
+// - begin(), read() and a configuration sequence take 6, 2 and 12 bus
+//   transactions (12, 8 and 34 without the map), and leave the registers
+//   and getters as before.
+// - The map itself: volatile registers split bursts and are always read
+//   fresh, nested updates, write-through outside an update, invalidate(),
+//   a missing device, registers outside the map and a nullptr map.
+// - The sensor is not copyable but movable, and frees its bus device and
+//   map, also across a second begin() and a move (checked by LeakSanitizer).
+//   A moved-to sensor keeps working and the moved-from one frees nothing.
+#include <Adafruit_LIS3DH.h>
+
+#include <stdio.h>
+
+#include <type_traits>
+
+TwoWire Wire;
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+static_assert(!std::is_copy_constructible<Adafruit_LIS3DH>::value &&
+                  !std::is_copy_assignable<Adafruit_LIS3DH>::value,
+              "Adafruit_LIS3DH owns its register map");
+static_assert(std::is_move_constructible<Adafruit_LIS3DH>::value &&
+                  std::is_move_assignable<Adafruit_LIS3DH>::value,
+              "Adafruit_LIS3DH lis = Adafruit_LIS3DH(); needs a move");
+
+static void printRegs(TwoWire::Device &d) {
+  printf("  regs 1F-25:");
+  for (int r = 0x1F; r <= 0x25; r++)
+    printf(" %02X", d.regs[r]);
+  printf("\n");
+}
+
+static void testSensor(void) {
+  TwoWire::Device &d = Wire.devices[0x18];
+  memset(d.regs, 0, sizeof(d.regs));
+  d.incBit = 0x80;
+  d.regs[LIS3DH_REG_WHOAMI] = 0x33;
+  d.regs[LIS3DH_REG_CTRL1] = 0x07; // Power-on defaults
+  d.regs[LIS3DH_REG_STATUS2] = 0x08;
+  for (int i = 0; i < 6; i++)
+    d.regs[0x28 + i] = 0x10 * i + 1;
+
+  Adafruit_LIS3DH lis;
+  unsigned long before = Wire.transactions;
+  CHECK(lis.begin(0x18), "begin()");
+  printf("  begin(): %lu transactions\n", Wire.transactions - before);
+  CHECK(Wire.transactions - before == 6, "begin()");
+  printRegs(d);
+  CHECK(d.regs[LIS3DH_REG_CTRL1] == 0x77 && d.regs[LIS3DH_REG_CTRL4] == 0x88 &&
+            d.regs[LIS3DH_REG_TEMPCFG] == 0x80,
+        "registers after begin()");
+
+  before = Wire.transactions;
+  lis.read();
+  printf("  read(): %lu transactions\n", Wire.transactions - before);
+  CHECK(Wire.transactions - before == 2, "read()");
+  CHECK(lis.x == 0x1101 && lis.y == 0x3121 && lis.z == 0x5141, "%d %d %d",
+        lis.x, lis.y, lis.z);
+
+  before = Wire.transactions;
+  lis.setRange(LIS3DH_RANGE_8_G);
+  lis.setDataRate(LIS3DH_DATARATE_100_HZ);
+  lis.setPerformanceMode(LIS3DH_MODE_LOW_POWER);
+  lis.setClick(2, 80);
+  lis.enableDRDY(false, 1);
+  lis3dh_range_t range = lis.getRange();
+  lis3dh_dataRate_t rate = lis.getDataRate();
+  lis3dh_mode_t mode = lis.getPerformanceMode();
+  printf("  configuration: %lu transactions\n", Wire.transactions - before);
+  CHECK(Wire.transactions - before == 12, "configuration");
+  CHECK(range == LIS3DH_RANGE_8_G && rate == LIS3DH_DATARATE_100_HZ &&
+            mode == LIS3DH_MODE_LOW_POWER,
+        "getters %d %d %d", range, rate, mode);
+  printRegs(d);
+  CHECK(d.regs[LIS3DH_REG_CTRL1] == 0x5F && d.regs[LIS3DH_REG_CTRL4] == 0xA0,
+        "registers after configuration");
+  CHECK(lis.haveNewData(), "new data");
+  d.regs[LIS3DH_REG_STATUS2] = 0;
+  CHECK(!lis.haveNewData(), "no new data");
+
+  // A second begin() replaces the bus device and the map
+  CHECK(lis.begin(0x18), "second begin()");
+
+  // The way the examples declare it, then a move over a begun sensor
+  Adafruit_LIS3DH moved = Adafruit_LIS3DH();
+  CHECK(moved.begin(0x18), "begin() before the move");
+  moved = static_cast<Adafruit_LIS3DH &&>(lis);
+  Adafruit_LIS3DH taken(static_cast<Adafruit_LIS3DH &&>(moved));
+  before = Wire.transactions;
+  taken.setRange(LIS3DH_RANGE_4_G);
+  range = taken.getRange();
+  CHECK(range == LIS3DH_RANGE_4_G && Wire.transactions - before == 1 &&
+            d.regs[LIS3DH_REG_CTRL4] == 0x98,
+        "after the moves: range %d, %lu transactions, CTRL4 %02X", range,
+        Wire.transactions - before, d.regs[LIS3DH_REG_CTRL4]);
+}
+
+static void testMap(void) {
+  // 0x40-0x47, with 0x43 volatile (a clear-on-read status)
+  TwoWire::Device &g = Wire.devices[0x30];
+  g.incBit = 0x80;
+  for (int i = 0; i < 256; i++)
+    g.regs[i] = i;
+  Adafruit_I2CDevice dev(0x30);
+  Adafruit_BusIO_RegisterMap map(&dev, nullptr, ADDRBIT8_HIGH_TOREAD, 0x40, 8,
+                                 0x80);
+  map.setVolatile(0x43);
+  Adafruit_BusIO_Register r41(&map, 0x41), r43(&map, 0x43),
+      r46(&map, 0x46, 2, MSBFIRST);
+  Adafruit_BusIO_RegisterBits b41(&r41, 3, 2);
+
+  unsigned long before = Wire.transactions;
+  CHECK(r41.read() == 0x41, "first read");
+  CHECK(Wire.transactions - before == 4, "two bursts around 0x43");
+  CHECK(g.reads[0x43] == 0, "volatile register read by load()");
+  CHECK(r46.read() == 0x4647 && Wire.transactions - before == 4,
+        "read from the copy");
+  g.regs[0x43] = 0x99;
+  CHECK(r43.read() == 0x99 && Wire.transactions - before == 6 &&
+            g.reads[0x43] == 1,
+        "volatile register");
+
+  // Several edits, one write
+  before = Wire.transactions;
+  map.beginUpdate();
+  b41.write(5);
+  r46.write(0x1234);
+  map.beginUpdate();
+  CHECK(map.commit() && Wire.transactions == before &&
+            g.regs[0x41] == 0x41,
+        "nested commit() wrote");
+  CHECK(map.commit() && Wire.transactions - before == 2, "commit()");
+  CHECK(g.regs[0x41] == ((0x41 & ~0x1C) | (5 << 2)) && g.regs[0x46] == 0x12 &&
+            g.regs[0x47] == 0x34,
+        "committed values");
+  CHECK(g.writes[0x42] == 0 && g.writes[0x43] == 0, "unchanged written");
+
+  // Known registers in between join a burst, a volatile one splits it
+  before = Wire.transactions;
+  Adafruit_BusIO_Register r44(&map, 0x44), r40(&map, 0x40);
+  map.beginUpdate();
+  r40.write(1);
+  r44.write(2);
+  r46.write(0x0304);
+  CHECK(map.commit() && Wire.transactions - before == 2, "split commit()");
+  CHECK(g.writes[0x45] == 1 && g.writes[0x43] == 0, "burst contents");
+
+  // Outside an update, writes go straight out
+  before = Wire.transactions;
+  r41.write(0x77);
+  CHECK(Wire.transactions - before == 1 && g.regs[0x41] == 0x77,
+        "write-through");
+  r43.write(0x55);
+  CHECK(g.regs[0x43] == 0x55 && Wire.transactions - before == 2,
+        "volatile write");
+
+  // The device changed underneath
+  g.regs[0x42] = 0xAB;
+  Adafruit_BusIO_Register r42(&map, 0x42);
+  CHECK(r42.read() == 0x42, "copy");
+  map.invalidate();
+  CHECK(r42.read() == 0xAB, "invalidate()");
+
+  // Failed writes are not kept
+  Adafruit_I2CDevice ghost(0x31);
+  Adafruit_BusIO_RegisterMap ghostMap(&ghost, nullptr, ADDRBIT8_HIGH_TOREAD,
+                                      0x10, 4);
+  Adafruit_BusIO_Register ghostReg(&ghostMap, 0x11);
+  CHECK(!ghostReg.write(5) && ghostReg.read() == 0xFFFFFFFF, "missing device");
+
+  Adafruit_BusIO_Register outside(&map, 0x60);
+  CHECK(outside.read() == 0x60, "register outside the map");
+  Adafruit_BusIO_Register none((Adafruit_BusIO_RegisterMap *)nullptr, 0x10);
+  CHECK(none.read() == 0xFFFFFFFF && !none.write(1), "nullptr map");
+}
+
+int main(void) {
+  printf("LIS3DH\n");
+  testSensor();
+  printf("Register map\n");
+  testMap();
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
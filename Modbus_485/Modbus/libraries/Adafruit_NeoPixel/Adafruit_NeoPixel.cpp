@@ -78,7 +78,8 @@
   @return  Adafruit_NeoPixel object. Call the begin() function before use.
 */
 Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, int16_t p, neoPixelType t)
-    : begun(false), brightness(0), pixels(NULL), endTime(0) {
+    : begun(false), pin(-1), brightness(0), pixels(NULL), endTime(0),
+      segments(NULL), frameTime(20000), lastFrame(0), segmentsPending(false) {
   updateType(t);
   updateLength(n);
   setPin(p);
@@ -110,14 +111,23 @@ Adafruit_NeoPixel::Adafruit_NeoPixel()
       is800KHz(true),
 #endif
       begun(false), numLEDs(0), numBytes(0), pin(-1), brightness(0),
-      pixels(NULL), rOffset(1), gOffset(0), bOffset(2), wOffset(1), endTime(0) {
+      pixels(NULL), rOffset(1), gOffset(0), bOffset(2), wOffset(1), endTime(0),
+      segments(NULL), frameTime(20000), lastFrame(0), segmentsPending(false) {
 }
 
 /*!
   @brief   Deallocate Adafruit_NeoPixel object, set data pin back to INPUT.
 */
 Adafruit_NeoPixel::~Adafruit_NeoPixel() {
+  for (Adafruit_NeoPixel_Segment *s = segments; s; s = s->next) {
+    s->strip = NULL; // Segments keep their buffers but stop drawing
+    s->count = 0;
+  }
   free(pixels);
+#if defined(ESP32)
+  if (pin >= 0)
+    espRelease(pin);
+#endif
   if (pin >= 0)
     pinMode(pin, INPUT);
 }
@@ -127,6 +137,9 @@ Adafruit_NeoPixel::~Adafruit_NeoPixel() {
 */
 void Adafruit_NeoPixel::begin(void) {
   if (pin >= 0) {
+#if defined(ESP32)
+    espRelease(pin); // pinMode() would detach the RMT from the pin
+#endif
     pinMode(pin, OUTPUT);
     digitalWrite(pin, LOW);
   }
@@ -409,6 +422,11 @@ extern "C" void k210Show(uint8_t pin, uint8_t *pixels, uint32_t numBytes,
            RGBW pixels). There's no easy fix for this, but a few
            specialized alternative or companion libraries exist that use
            very device-specific peripherals to work around it.
+  @note    On ESP32 the data goes out through the RMT peripheral in the
+           background: show() only waits for the previous frame on the
+           same strip, and returns as soon as the new one is queued. The
+           pixel data may be changed right away. canShow() tells when the
+           strip is idle again.
 */
 void Adafruit_NeoPixel::show(void) {
 
@@ -3284,6 +3302,10 @@ if(is800KHz) {
   @param   p  Arduino pin number (-1 = no pin).
 */
 void Adafruit_NeoPixel::setPin(int16_t p) {
+#if defined(ESP32)
+  if (pin >= 0)
+    espRelease(pin);
+#endif
   if (begun && (pin >= 0))
     pinMode(pin, INPUT); // Disable existing out pin
   pin = p;
@@ -3401,6 +3423,58 @@ void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t c) {
   }
 }
 
+// Scales each of the four bytes in x as (byte * scale) >> 8, scale 0-256.
+// Two bytes per multiply on 32-bit cores (products stay within their
+// 16-bit lanes); byte by byte on AVR, where a 32-bit multiply costs more.
+static inline uint32_t scale32(uint32_t x, uint16_t scale) {
+#if defined(__AVR__)
+  uint8_t *y = (uint8_t *)&x;
+  for (uint8_t i = 0; i < 4; i++)
+    y[i] = (y[i] * scale) >> 8;
+  return x;
+#else
+  return ((((x & 0x00FF00FF) * scale) >> 8) & 0x00FF00FF) |
+         ((((x >> 8) & 0x00FF00FF) * scale) & 0xFF00FF00);
+#endif
+}
+
+/*!
+  @brief   Set a run of pixels from an array of 32-bit 'packed' RGB or RGBW
+           values, in one pass. Same result as calling setPixelColor() for
+           each, much faster on long strips.
+  @param   colors  Colors, formatted as for setPixelColor(n, c).
+  @param   count   Number of colors. Clipped at the end of the strip.
+  @param   first   Index of the pixel that gets colors[0]. 0 if unspecified.
+*/
+void Adafruit_NeoPixel::setPixelColors(const uint32_t *colors, uint16_t count,
+                                       uint16_t first) {
+  if (first >= numLEDs)
+    return;
+  if (count > numLEDs - first)
+    count = numLEDs - first;
+  // Brightness 0 means no scaling, which is the same as a scale of 256
+  uint16_t scale = brightness ? brightness : 256;
+  uint8_t r = rOffset, g = gOffset, b = bOffset, w = wOffset;
+  if (w == r) { // RGB-type strip
+    uint8_t *p = &pixels[first * 3];
+    for (uint16_t i = 0; i < count; i++, p += 3) {
+      uint32_t c = scale32(colors[i], scale);
+      p[r] = c >> 16;
+      p[g] = c >> 8;
+      p[b] = c;
+    }
+  } else { // WRGB-type strip
+    uint8_t *p = &pixels[first * 4];
+    for (uint16_t i = 0; i < count; i++, p += 4) {
+      uint32_t c = scale32(colors[i], scale);
+      p[w] = c >> 24;
+      p[r] = c >> 16;
+      p[g] = c >> 8;
+      p[b] = c;
+    }
+  }
+}
+
 /*!
   @brief   Fill all or part of the NeoPixel strip with a color.
   @param   c      32-bit color value. Most significant byte is white (for
@@ -3430,8 +3504,15 @@ void Adafruit_NeoPixel::fill(uint32_t c, uint16_t first, uint16_t count) {
       end = numLEDs;
   }
 
-  for (i = first; i < end; i++) {
-    this->setPixelColor(i, c);
+  // Encode the color once, then keep doubling the filled part with memcpy
+  this->setPixelColor(first, c);
+  uint8_t bytesPerPixel = (wOffset == rOffset) ? 3 : 4;
+  uint8_t *start = &pixels[first * bytesPerPixel];
+  uint16_t done = bytesPerPixel, total = (end - first) * bytesPerPixel;
+  while (done < total) {
+    i = (done < total - done) ? done : total - done;
+    memcpy(start + done, start, i);
+    done += i;
   }
 }
 
@@ -3624,7 +3705,16 @@ void Adafruit_NeoPixel::setBrightness(uint8_t b) {
       scale = 65535 / oldBrightness;
     else
       scale = (((uint16_t)newBrightness << 8) - 1) / oldBrightness;
-    for (uint16_t i = 0; i < numBytes; i++) {
+    uint16_t i = 0;
+    if (scale < 256) { // Dimming: four bytes per step, see scale32()
+      for (; i + 4 <= numBytes; i += 4, ptr += 4) {
+        uint32_t x;
+        memcpy(&x, ptr, 4);
+        x = scale32(x, scale);
+        memcpy(ptr, &x, 4);
+      }
+    }
+    for (; i < numBytes; i++) {
       c = *ptr;
       *ptr++ = (c * scale) >> 8;
     }
@@ -3660,6 +3750,21 @@ uint32_t Adafruit_NeoPixel::gamma32(uint32_t x) {
   return x; // Packed 32-bit return
 }
 
+/*!
+  @brief   Gamma-correct an array of packed RGB or WRGB colors in place,
+           the same as gamma32() on each element.
+  @param   colors  Colors to correct, e.g. before setPixelColors().
+  @param   count   Number of colors.
+*/
+void Adafruit_NeoPixel::gamma32(uint32_t *colors, uint16_t count) {
+  for (uint16_t i = 0; i < count; i++) {
+    uint32_t x = colors[i];
+    colors[i] = ((uint32_t)gamma8(x >> 24) << 24) |
+                ((uint32_t)gamma8(x >> 16) << 16) |
+                ((uint32_t)gamma8(x >> 8) << 8) | gamma8(x);
+  }
+}
+
 /*!
   @brief   Fill NeoPixel strip with one or more cycles of hues.
            Everyone loves the rainbow swirl so much, now it's canon!
@@ -3680,11 +3785,33 @@ uint32_t Adafruit_NeoPixel::gamma32(uint32_t x) {
 */
 void Adafruit_NeoPixel::rainbow(uint16_t first_hue, int8_t reps,
   uint8_t saturation, uint8_t brightness, bool gammify) {
-  for (uint16_t i=0; i<numLEDs; i++) {
-    uint16_t hue = first_hue + (i * reps * 65536) / numLEDs;
-    uint32_t color = ColorHSV(hue, saturation, brightness);
-    if (gammify) color = gamma32(color);
-    setPixelColor(i, color);
+  if (!numLEDs)
+    return;
+  // Pixel i gets first_hue + i * reps * 65536 / numLEDs (rounded toward
+  // zero). The quotient is kept as a running sum plus remainder instead of
+  // dividing for every pixel. Colors are made a chunk at a time, then
+  // gamma-corrected and stored with the bulk functions.
+  uint32_t step = (uint32_t)(reps < 0 ? -reps : reps) << 16;
+  uint32_t stepHue = step / numLEDs, stepRem = step % numLEDs;
+  uint32_t offset = 0, rem = 0;
+  uint32_t colors[16];
+  for (uint16_t i = 0; i < numLEDs;) {
+    uint16_t n = numLEDs - i;
+    if (n > 16)
+      n = 16;
+    for (uint16_t k = 0; k < n; k++) {
+      uint16_t hue = (reps < 0) ? first_hue - offset : first_hue + offset;
+      colors[k] = ColorHSV(hue, saturation, brightness);
+      offset += stepHue;
+      if ((rem += stepRem) >= numLEDs) {
+        rem -= numLEDs;
+        offset++;
+      }
+    }
+    if (gammify)
+      gamma32(colors, n);
+    setPixelColors(colors, n, i);
+    i += n;
   }
 }
 
@@ -3720,3 +3847,225 @@ neoPixelType Adafruit_NeoPixel::str2order(const char *v) {
   if (w < 0) w = r; // If 'w' not specified, duplicate r bits
   return (w << 6) | (r << 4) | ((g & 3) << 2) | (b & 3);
 }
+
+/*!
+  @brief   Give a range of pixels to a segment, which one task or thread can
+           then draw into without locking. The segment's first frame is the
+           strip's current contents of that range.
+  @param   s      Segment object, not yet added to any strip.
+  @param   first  Index of first pixel of the range on this strip.
+  @param   count  Number of pixels in the range, at least 1.
+  @return  true on success, false if the range is outside the strip or
+           overlaps another segment, or out of memory.
+  @note    Add all segments after begin(), updateLength() and updateType(),
+           and before the tasks that use them start; the segment list
+           itself is not thread-safe. Pixels outside every segment can
+           still be set on the strip, from the task that calls
+           showSegments().
+*/
+bool Adafruit_NeoPixel::addSegment(Adafruit_NeoPixel_Segment &s,
+                                   uint16_t first, uint16_t count) {
+  if (s.strip || !count || (first >= numLEDs) || (count > numLEDs - first))
+    return false;
+  for (Adafruit_NeoPixel_Segment *t = segments; t; t = t->next) {
+    if ((first < t->first + t->count) && (t->first < first + count))
+      return false; // Another segment owns some of these pixels
+  }
+  uint8_t bytesPerPixel = (wOffset == rOffset) ? 3 : 4;
+  uint16_t bytes = count * bytesPerPixel;
+  // Draft, published and the compositor's snapshot
+  uint8_t *buf = (uint8_t *)malloc(bytes * 3);
+  if (!buf)
+    return false;
+  free(s.draft);
+  memcpy(buf, &pixels[first * bytesPerPixel], bytes);
+  memcpy(buf + bytes, buf, bytes);
+  s.draft = buf;
+  s.published = buf + bytes;
+  s.snapshot = buf + bytes * 2;
+  s.numBytes = bytes;
+  s.first = first;
+  s.count = count;
+  s.sequence = 0;
+  s.shownSequence = 0;
+  s.strip = this;
+  s.next = segments;
+  segments = &s;
+  return true;
+}
+
+/*!
+  @brief   Compositor for segments: copy every segment published since the
+           last frame into the strip and show() it, at most once per frame
+           interval (see setFrameRate()). Call this from a single task,
+           regularly; it never waits for the segments' owners.
+  @return  true if a frame was sent, false if nothing changed or the
+           frame interval has not passed yet.
+  @note    A segment whose show() runs while it is being copied is left as
+           it was and sent in the next frame instead.
+*/
+bool Adafruit_NeoPixel::showSegments(void) {
+  uint32_t now = micros();
+  if ((now - lastFrame) < frameTime)
+    return false;
+
+  uint8_t bytesPerPixel = (wOffset == rOffset) ? 3 : 4;
+  for (Adafruit_NeoPixel_Segment *s = segments; s; s = s->next) {
+    uint32_t sequence = s->sequence;
+    __sync_synchronize(); // Read the sequence before the data
+    if ((sequence == s->shownSequence) || (sequence & 1) ||
+        ((uint32_t)s->first * bytesPerPixel + s->numBytes > numBytes))
+      continue; // Unchanged, being published, or strip has shrunk
+    memcpy(s->snapshot, s->published, s->numBytes);
+    __sync_synchronize(); // Finish copying before checking again
+    if (s->sequence != sequence)
+      continue; // Segment's show() ran during the copy, may be torn
+    memcpy(&pixels[s->first * bytesPerPixel], s->snapshot, s->numBytes);
+    s->shownSequence = sequence;
+    segmentsPending = true;
+  }
+  if (!segmentsPending)
+    return false;
+
+  show();
+  segmentsPending = false;
+  lastFrame = now;
+  return true;
+}
+
+/*!
+  @brief   Set how often showSegments() may send a frame.
+  @param   fps  Maximum frames per second, 0 for no limit. The default is
+                50.
+*/
+void Adafruit_NeoPixel::setFrameRate(uint8_t fps) {
+  frameTime = fps ? (1000000UL / fps) : 0;
+}
+
+/*!
+  @brief   Segment constructor. The segment has no pixels until it is given
+           to a strip with Adafruit_NeoPixel::addSegment().
+*/
+Adafruit_NeoPixel_Segment::Adafruit_NeoPixel_Segment()
+    : strip(NULL), next(NULL), first(0), count(0), numBytes(0), draft(NULL),
+      published(NULL), snapshot(NULL), sequence(0), shownSequence(0) {}
+
+/*!
+  @brief   Deallocate segment and take it off its strip. Like
+           addSegment(), not safe while the strip's showSegments() may run.
+*/
+Adafruit_NeoPixel_Segment::~Adafruit_NeoPixel_Segment() {
+  if (strip) {
+    Adafruit_NeoPixel_Segment **p = &strip->segments;
+    while (*p && (*p != this))
+      p = &(*p)->next;
+    if (*p)
+      *p = next;
+  }
+  free(draft); // Also frees 'published' and 'snapshot', same allocation
+}
+
+/*!
+  @brief   Publish the segment's pixels for the strip's next showSegments()
+           frame. Unlike Adafruit_NeoPixel::show() this only copies the
+           segment's RAM buffer and returns; it never waits for the strip.
+           Pixels set afterwards are not seen until the next show().
+*/
+void Adafruit_NeoPixel_Segment::show(void) {
+  if (!draft)
+    return;
+  // Sequence lock: odd while copying, so showSegments() can tell whether
+  // its own copy of 'published' overlapped this one
+  sequence = sequence + 1;
+  __sync_synchronize();
+  memcpy(published, draft, numBytes);
+  __sync_synchronize();
+  sequence = sequence + 1;
+}
+
+/*!
+  @brief   Set a pixel's color using separate red, green and blue
+           components. If using RGBW pixels, white will be set to 0.
+  @param   n  Pixel index within the segment, starting from 0.
+  @param   r  Red brightness, 0 = minimum (off), 255 = maximum.
+  @param   g  Green brightness, 0 = minimum (off), 255 = maximum.
+  @param   b  Blue brightness, 0 = minimum (off), 255 = maximum.
+*/
+void Adafruit_NeoPixel_Segment::setPixelColor(uint16_t n, uint8_t r,
+                                              uint8_t g, uint8_t b) {
+  setPixelColor(n, Adafruit_NeoPixel::Color(r, g, b));
+}
+
+/*!
+  @brief   Set a pixel's color using separate red, green, blue and white
+           components (for RGBW NeoPixels only).
+  @param   n  Pixel index within the segment, starting from 0.
+  @param   r  Red brightness, 0 = minimum (off), 255 = maximum.
+  @param   g  Green brightness, 0 = minimum (off), 255 = maximum.
+  @param   b  Blue brightness, 0 = minimum (off), 255 = maximum.
+  @param   w  White brightness, 0 = minimum (off), 255 = maximum, ignored
+              if using RGB pixels.
+*/
+void Adafruit_NeoPixel_Segment::setPixelColor(uint16_t n, uint8_t r,
+                                              uint8_t g, uint8_t b,
+                                              uint8_t w) {
+  setPixelColor(n, Adafruit_NeoPixel::Color(r, g, b, w));
+}
+
+/*!
+  @brief   Set a pixel's color using a 32-bit 'packed' RGB or RGBW value,
+           scaled by the strip's brightness like
+           Adafruit_NeoPixel::setPixelColor().
+  @param   n  Pixel index within the segment, starting from 0.
+  @param   c  32-bit color value. Most significant byte is white (for RGBW
+              pixels) or ignored (for RGB pixels), next is red, then green,
+              and least significant byte is blue.
+*/
+void Adafruit_NeoPixel_Segment::setPixelColor(uint16_t n, uint32_t c) {
+  if (n < count) {
+    uint8_t *p, r = (uint8_t)(c >> 16), g = (uint8_t)(c >> 8), b = (uint8_t)c;
+    uint8_t brightness = strip->brightness;
+    if (brightness) { // See notes in Adafruit_NeoPixel::setBrightness()
+      r = (r * brightness) >> 8;
+      g = (g * brightness) >> 8;
+      b = (b * brightness) >> 8;
+    }
+    if (strip->wOffset == strip->rOffset) {
+      p = &draft[n * 3];
+    } else {
+      p = &draft[n * 4];
+      uint8_t w = (uint8_t)(c >> 24);
+      p[strip->wOffset] = brightness ? ((w * brightness) >> 8) : w;
+    }
+    p[strip->rOffset] = r;
+    p[strip->gOffset] = g;
+    p[strip->bOffset] = b;
+  }
+}
+
+/*!
+  @brief   Fill all or part of the segment with a color.
+  @param   c      32-bit color value, as for setPixelColor(). 0 (off) if
+                  unspecified.
+  @param   first  Index of first pixel to fill, within the segment. 0 if
+                  unspecified.
+  @param   count  Number of pixels to fill. Passing 0 or leaving
+                  unspecified will fill to end of segment.
+*/
+void Adafruit_NeoPixel_Segment::fill(uint32_t c, uint16_t first,
+                                     uint16_t count) {
+  if (first >= this->count)
+    return;
+  uint16_t end = (!count || (count > this->count - first)) ? this->count
+                                                           : first + count;
+  for (uint16_t i = first; i < end; i++)
+    setPixelColor(i, c);
+}
+
+/*!
+  @brief   Fill the whole segment with 0 / black / off.
+*/
+void Adafruit_NeoPixel_Segment::clear(void) {
+  if (draft)
+    memset(draft, 0, numBytes);
+}
@@ -61,6 +61,12 @@
 #include "rp2040_pio.h"
 #endif
 
+#if defined(ESP32)
+// RMT state of the strip on a pin, see esp.c
+extern "C" bool espCanShow(uint16_t pin);
+extern "C" void espRelease(uint16_t pin);
+#endif
+
 // The order of primary colors in the NeoPixel data stream can vary among
 // device types, manufacturers and even different revisions of the same
 // item.  The third parameter to the Adafruit_NeoPixel constructor encodes
@@ -208,6 +214,8 @@ static const uint8_t PROGMEM _NeoPixelGammaTable[256] = {
     218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252,
     255};
 
+class Adafruit_NeoPixel_Segment;
+
 /*!
     @brief  Class that stores state and functions for interacting with
             Adafruit NeoPixels and compatible devices.
@@ -227,11 +235,17 @@ public:
   void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
   void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
   void setPixelColor(uint16_t n, uint32_t c);
+  void setPixelColors(const uint32_t *colors, uint16_t count,
+                      uint16_t first = 0);
   void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0);
   void setBrightness(uint8_t);
   void clear(void);
   void updateLength(uint16_t n);
   void updateType(neoPixelType t);
+  bool addSegment(Adafruit_NeoPixel_Segment &s, uint16_t first,
+                  uint16_t count);
+  bool showSegments(void);
+  void setFrameRate(uint8_t fps);
   /*!
     @brief   Check whether a call to show() will start sending data
              immediately or will 'block' for a required interval. NeoPixels
@@ -261,6 +275,12 @@ public:
     // stall for 30+ minutes, or having to document and frequently remind
     // and/or provide tech support explaining an unintuitive need for
     // show() calls at least once an hour.
+#if defined(ESP32)
+    // show() returns while the RMT is still sending; the latch time is
+    // part of the transfer
+    if (!espCanShow(pin))
+      return false;
+#endif
     uint32_t now = micros();
     if (endTime > now) {
       endTime = now;
@@ -366,6 +386,7 @@ public:
              function instead.
   */
   static uint32_t gamma32(uint32_t x);
+  static void gamma32(uint32_t *colors, uint16_t count);
 
   void rainbow(uint16_t first_hue = 0, int8_t reps = 1,
                uint8_t saturation = 255, uint8_t brightness = 255,
@@ -394,6 +415,11 @@ protected:
   uint8_t bOffset;    ///< Index of blue byte
   uint8_t wOffset;    ///< Index of white (==rOffset if no white)
   uint32_t endTime;   ///< Latch timing reference
+
+  Adafruit_NeoPixel_Segment *segments; ///< List built by addSegment()
+  uint32_t frameTime;   ///< Minimum microseconds between segment frames
+  uint32_t lastFrame;   ///< micros() at the last segment frame
+  bool segmentsPending; ///< Segment data copied but not yet shown
 #ifdef __AVR__
   volatile uint8_t *port; ///< Output PORT register
   uint8_t pinMask;        ///< Output PORT bitmask
@@ -407,6 +433,48 @@ protected:
   int sm = 0;
   bool init = true;
 #endif
+
+  friend class Adafruit_NeoPixel_Segment;
+};
+
+/*!
+    @brief  A range of pixels on an Adafruit_NeoPixel strip, owned by one
+            task or thread. Writes go to the segment's own buffer without
+            any locking; show() publishes them and the strip's
+            showSegments(), called from one place, sends every changed
+            segment in a single frame.
+*/
+class Adafruit_NeoPixel_Segment {
+
+public:
+  Adafruit_NeoPixel_Segment(void);
+  ~Adafruit_NeoPixel_Segment();
+
+  void show(void);
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
+  void setPixelColor(uint16_t n, uint32_t c);
+  void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0);
+  void clear(void);
+  /*!
+    @brief   Return the number of pixels in the segment.
+    @return  Pixel count (0 if not added to a strip).
+  */
+  uint16_t numPixels(void) const { return count; }
+
+private:
+  friend class Adafruit_NeoPixel;
+
+  Adafruit_NeoPixel *strip;        ///< Strip this segment belongs to
+  Adafruit_NeoPixel_Segment *next; ///< Next segment on the same strip
+  uint16_t first;                  ///< Index of first pixel on the strip
+  uint16_t count;                  ///< Number of pixels
+  uint16_t numBytes;               ///< Size of each buffer below
+  uint8_t *draft;                  ///< Written by setPixelColor() and fill()
+  uint8_t *published;              ///< Copy of draft made by show()
+  uint8_t *snapshot;               ///< showSegments() copy of published
+  volatile uint32_t sequence;      ///< Bumped by show(), odd while copying
+  uint32_t shownSequence;          ///< Last sequence copied to the strip
 };
 
 #endif // ADAFRUIT_NEOPIXEL_H
@@ -32,36 +32,115 @@
 
 
 
+// Bit timings for 800 KHz (WS2812) and 400 KHz (WS2811) pixels
+#define WS2812_T0H_NS (400)
+#define WS2812_T0L_NS (850)
+#define WS2812_T1H_NS (800)
+#define WS2812_T1L_NS (450)
+
+#define WS2811_T0H_NS (500)
+#define WS2811_T0L_NS (2000)
+#define WS2811_T1H_NS (1200)
+#define WS2811_T1L_NS (1300)
+
 #ifdef HAS_ESP_IDF_5
 
-void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz) {
-  rmt_data_t led_data[numBytes * 8];
+#include "esp32_rmt.h"
+#include "soc/soc_caps.h"
+
+// 10 MHz RMT clock, 100 ns per tick
+#define RMT_TICK_NS (100)
+// The latch (reset) time, sent as the last symbol of every frame
+#define RMT_LATCH_NS (300000)
+
+// Strips that can show() at the same time, one RMT TX channel each
+#define ADAFRUIT_RMT_CHANNEL_MAX SOC_RMT_TX_CANDIDATES_PER_GROUP
+
+// A strip keeps its RMT channel and symbol buffer from its first show()
+// until espRelease(). The symbols are sent in the background, so they
+// live on the heap rather than the caller's stack, and the pixel buffer
+// is free to change as soon as show() returns.
+typedef struct {
+  bool used;
+  uint16_t pin;
+  rmt_data_t *symbols;
+  uint32_t capacity; // Symbols allocated
+} neopixel_rmt_t;
+
+static neopixel_rmt_t strips[ADAFRUIT_RMT_CHANNEL_MAX];
+
+static neopixel_rmt_t *findStrip(uint16_t pin) {
+  for (int i = 0; i < ADAFRUIT_RMT_CHANNEL_MAX; i++) {
+    if (strips[i].used && (strips[i].pin == pin)) {
+      return &strips[i];
+    }
+  }
+  return NULL;
+}
+
+bool espCanShow(uint16_t pin) {
+  return !findStrip(pin) || rmtTransmitCompleted(pin);
+}
 
-  if (!rmtInit(pin, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, 10000000)) {
-    log_e("Failed to init RMT TX mode on pin %d", pin);
-    return;
+void espRelease(uint16_t pin) {
+  neopixel_rmt_t *strip = findStrip(pin);
+  if (strip) {
+    rmtDeinit(pin);
+    free(strip->symbols);
+    memset(strip, 0, sizeof(*strip));
   }
+}
+
+void espShow(uint16_t pin, uint8_t *pixels, uint32_t numBytes, uint8_t is800KHz) {
+  neopixel_rmt_t *strip = findStrip(pin);
+  uint32_t count = numBytes * 8 + 1; // Bits, then the latch
 
-  int i=0;
-  for (int b=0; b < numBytes; b++) {
-    for (int bit=0; bit<8; bit++){
-      if ( pixels[b] & (1<<(7-bit)) ) {
-        led_data[i].level0 = 1;
-        led_data[i].duration0 = 8;
-        led_data[i].level1 = 0;
-        led_data[i].duration1 = 4;
-      } else {
-        led_data[i].level0 = 1;
-        led_data[i].duration0 = 4;
-        led_data[i].level1 = 0;
-        led_data[i].duration1 = 8;
+  if (!strip) {
+    for (int i = 0; i < ADAFRUIT_RMT_CHANNEL_MAX; i++) {
+      if (!strips[i].used) {
+        strip = &strips[i];
+        break;
       }
-      i++;
     }
+    if (!strip) {
+      log_e("No RMT channel left for pin %d", pin);
+      return;
+    }
+    if (!rmtInit(pin, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, 1000000000 / RMT_TICK_NS)) {
+      log_e("Failed to init RMT TX mode on pin %d", pin);
+      return;
+    }
+    strip->used = true;
+    strip->pin = pin;
   }
 
+  // show() waits for espCanShow(), this only guards the buffer
+  while (!rmtTransmitCompleted(pin)) {
+    yield();
+  }
+  if (count > strip->capacity) {
+    rmt_data_t *symbols = (rmt_data_t *)realloc(strip->symbols, count * sizeof(rmt_data_t));
+    if (!symbols) {
+      log_e("No memory for %u RMT symbols", (unsigned)count);
+      return;
+    }
+    strip->symbols = symbols;
+    strip->capacity = count;
+  }
+
+  uint32_t bit0, bit1;
+  if (is800KHz) {
+    bit0 = NEO_RMT_BIT(WS2812_T0H_NS / RMT_TICK_NS, WS2812_T0L_NS / RMT_TICK_NS);
+    bit1 = NEO_RMT_BIT(WS2812_T1H_NS / RMT_TICK_NS, WS2812_T1L_NS / RMT_TICK_NS);
+  } else {
+    bit0 = NEO_RMT_BIT(WS2811_T0H_NS / RMT_TICK_NS, WS2811_T0L_NS / RMT_TICK_NS);
+    bit1 = NEO_RMT_BIT(WS2811_T1H_NS / RMT_TICK_NS, WS2811_T1L_NS / RMT_TICK_NS);
+  }
+  neoRmtEncode(pixels, numBytes, bit0, bit1, (uint32_t *)strip->symbols);
+  strip->symbols[count - 1].val = NEO_RMT_LATCH(RMT_LATCH_NS / RMT_TICK_NS / 2);
+
   //pinMode(pin, OUTPUT);  // don't do this, will cause the rmt to disable!
-  rmtWrite(pin, led_data, numBytes * 8, RMT_WAIT_FOR_EVER);
+  rmtWriteAsync(pin, strip->symbols, count);
 }
 
 
@@ -74,16 +153,6 @@ void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz)
 // This code is adapted from the ESP-IDF v3.4 RMT "led_strip" example, altered
 // to work with the Arduino version of the ESP-IDF (3.2)
 
-#define WS2812_T0H_NS (400)
-#define WS2812_T0L_NS (850)
-#define WS2812_T1H_NS (800)
-#define WS2812_T1L_NS (450)
-
-#define WS2811_T0H_NS (500)
-#define WS2811_T0L_NS (2000)
-#define WS2811_T1H_NS (1200)
-#define WS2811_T1L_NS (1300)
-
 static uint32_t t0h_ticks = 0;
 static uint32_t t1h_ticks = 0;
 static uint32_t t0l_ticks = 0;
@@ -131,7 +200,15 @@ static void IRAM_ATTR ws2812_rmt_adapter(const void *src, rmt_item32_t *dest, si
     *item_num = num;
 }
 
-void espShow(uint8_t pin, uint8_t *pixels, uint32_t numBytes, boolean is800KHz) {
+// Channels are only held during show(), which waits for the transfer
+bool espCanShow(uint16_t pin) {
+    return true;
+}
+
+void espRelease(uint16_t pin) {
+}
+
+void espShow(uint16_t pin, uint8_t *pixels, uint32_t numBytes, uint8_t is800KHz) {
     // Reserve channel
     rmt_channel_t channel = ADAFRUIT_RMT_CHANNEL_MAX;
     for (size_t i = 0; i < ADAFRUIT_RMT_CHANNEL_MAX; i++) {
@@ -0,0 +1,36 @@
+// Pixel data to RMT symbols for the ESP32 show() in esp.c
+//
+// Plain C without ESP-IDF headers, so the encoder can also be built and
+// checked on a desktop. A symbol is one 32-bit RMT word (rmt_data_t in
+// Arduino-ESP32 3.x, rmt_item32_t before): duration0 in bits 0-14, level0
+// in bit 15, duration1 in bits 16-30, level1 in bit 31. Durations are in
+// RMT ticks.
+
+#ifndef ESP32_RMT_H
+#define ESP32_RMT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// One data bit: high for 'high' ticks, then low for 'low' ticks
+#define NEO_RMT_BIT(high, low)                                                 \
+  ((uint32_t)(high) | (1UL << 15) | ((uint32_t)(low) << 16))
+
+// Low for 2 x 'half' ticks, sent after the last bit so the pixels latch
+// before the transfer counts as done
+#define NEO_RMT_LATCH(half) ((uint32_t)(half) | ((uint32_t)(half) << 16))
+
+// Writes 8 symbols per byte, most significant bit first, to out.
+// Returns the number of symbols written.
+static inline size_t neoRmtEncode(const uint8_t *bytes, size_t numBytes,
+                                  uint32_t bit0, uint32_t bit1,
+                                  uint32_t *out) {
+  for (size_t i = 0; i < numBytes; i++) {
+    uint8_t b = bytes[i];
+    for (uint8_t mask = 0x80; mask; mask >>= 1)
+      *out++ = (b & mask) ? bit1 : bit0;
+  }
+  return numBytes * 8;
+}
+
+#endif // ESP32_RMT_H
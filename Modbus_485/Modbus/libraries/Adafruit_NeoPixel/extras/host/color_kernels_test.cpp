@@ -0,0 +1,236 @@
+// Host test and benchmark of the NeoPixel bulk color kernels:
+// setPixelColors(), gamma32(array), rainbow(), fill() and the dimming
+// rescale in setBrightness(). The Makefile builds it as color_kernels_test,
+// with sanitizers, and color_kernels_bench, optimized.
+//
+// Each kernel must give the same bytes as the scalar path it replaces:
+// setPixelColor() per pixel, gamma32() per color, ColorHSV() with the hue
+// divided per pixel, and the byte by byte brightness rescale. Checked for
+// six color orders, RGB and RGBW, strip lengths 1 to 1500, four brightness
+// levels, clipping at the end of the strip, and rainbow reps from -128 to
+// 127. Then prints pixels/s of the scalar path and of the kernel, on a
+// 1000-pixel GRB strip at brightness 128.
+#include <chrono>
+#include <vector>
+
+#include <Adafruit_NeoPixel.h>
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+extern "C" {
+void espShow(uint16_t, uint8_t *, uint32_t, uint8_t) {}
+bool espCanShow(uint16_t) { return true; }
+void espRelease(uint16_t) {}
+
+uint32_t micros(void) {
+  static auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+void yield(void) {}
+}
+
+static uint32_t rnd(void) {
+  static uint32_t s = 12345;
+  s ^= s << 13;
+  s ^= s >> 17;
+  s ^= s << 5;
+  return s;
+}
+
+// The scalar paths
+static void scalarRainbow(Adafruit_NeoPixel &strip, uint16_t first_hue,
+                          int8_t reps, uint8_t saturation, uint8_t brightness,
+                          bool gammify) {
+  uint16_t n = strip.numPixels();
+  for (uint16_t i = 0; i < n; i++) {
+    uint16_t hue = first_hue + (int32_t)((int64_t)i * reps * 65536 / n);
+    uint32_t color = Adafruit_NeoPixel::ColorHSV(hue, saturation, brightness);
+    if (gammify)
+      color = Adafruit_NeoPixel::gamma32(color);
+    strip.setPixelColor(i, color);
+  }
+}
+
+static void scalarRescale(uint8_t *p, size_t bytes, uint8_t oldSetting,
+                          uint8_t newSetting) {
+  // setBrightness() arguments, as stored: value + 1, wrapping to 0
+  uint8_t oldBrightness = oldSetting, newBrightness = newSetting + 1;
+  if (newBrightness == (uint8_t)(oldSetting + 1))
+    return;
+  uint16_t scale;
+  if (oldBrightness == 0)
+    scale = 0;
+  else if (newSetting == 255)
+    scale = 65535 / oldBrightness;
+  else
+    scale = (((uint16_t)newBrightness << 8) - 1) / oldBrightness;
+  for (size_t i = 0; i < bytes; i++)
+    p[i] = (p[i] * scale) >> 8;
+}
+
+static const neoPixelType types[] = {
+    NEO_GRB + NEO_KHZ800,  NEO_RGB + NEO_KHZ800,  NEO_BGR + NEO_KHZ800,
+    NEO_GRBW + NEO_KHZ800, NEO_WRGB + NEO_KHZ800, NEO_RGBW + NEO_KHZ800};
+static const uint16_t lengths[] = {1, 2, 3, 7, 16, 17, 33, 300, 1000, 1500};
+static const uint8_t levels[] = {255, 0, 1, 100};
+static const int8_t repsList[] = {1, 2, -1, -3, 5, 127, -128, 0};
+
+static void testExact(void) {
+  unsigned long compared = 0;
+  for (neoPixelType t : types) {
+    for (uint16_t n : lengths) {
+      for (uint8_t level : levels) {
+        Adafruit_NeoPixel bulk(n, 5, t), scalar(n, 5, t);
+        bulk.setBrightness(level);
+        scalar.setBrightness(level);
+        size_t bytes = n * (((t >> 6) & 3) == ((t >> 4) & 3) ? 3 : 4);
+        const uint8_t *a = bulk.getPixels(), *b = scalar.getPixels();
+
+        std::vector<uint32_t> colors(n + 5);
+        for (uint32_t &c : colors)
+          c = rnd();
+        uint16_t first = (n > 3) ? rnd() % (n / 2) : 0;
+        bulk.setPixelColors(colors.data(), n + 5, first); // Clipped
+        for (uint16_t i = first; i < n; i++)
+          scalar.setPixelColor(i, colors[i - first]);
+        CHECK(!memcmp(a, b, bytes), "setPixelColors() %04X n=%u level=%u", t,
+              n, level);
+
+        uint32_t c = rnd();
+        uint16_t fillFirst = rnd() % n, fillCount = rnd() % (n + 2);
+        bulk.fill(c, fillFirst, fillCount);
+        for (uint16_t i = fillFirst;
+             i < n && (!fillCount || i < fillFirst + fillCount); i++)
+          scalar.setPixelColor(i, c);
+        CHECK(!memcmp(a, b, bytes), "fill() %04X n=%u level=%u", t, n, level);
+
+        for (int k = 0; k < 4; k++) {
+          uint8_t next = rnd();
+          bulk.setPixelColors(colors.data(), n);
+          bulk.setBrightness(next);
+          std::vector<uint8_t> expect(bytes);
+          scalar.setBrightness(level);
+          for (uint16_t i = 0; i < n; i++)
+            scalar.setPixelColor(i, colors[i]);
+          memcpy(expect.data(), b, bytes);
+          scalarRescale(expect.data(), bytes, level, next);
+          CHECK(!memcmp(a, expect.data(), bytes),
+                "setBrightness(%u) from %u, %04X n=%u", next, level, t, n);
+          bulk.setBrightness(level);
+        }
+
+        for (int8_t reps : repsList) {
+          uint16_t hue = rnd();
+          uint8_t sat = (rnd() & 1) ? 255 : rnd(), val = (rnd() & 1) ? 255 : rnd();
+          bool gammify = rnd() & 1;
+          bulk.rainbow(hue, reps, sat, val, gammify);
+          scalarRainbow(scalar, hue, reps, sat, val, gammify);
+          CHECK(!memcmp(a, b, bytes), "rainbow() %04X n=%u reps=%d", t, n,
+                reps);
+        }
+        compared += 13;
+      }
+    }
+  }
+
+  std::vector<uint32_t> colors(1000), gammaOf(1000);
+  for (size_t i = 0; i < colors.size(); i++)
+    colors[i] = gammaOf[i] = rnd();
+  Adafruit_NeoPixel::gamma32(gammaOf.data(), gammaOf.size());
+  for (size_t i = 0; i < colors.size(); i++) {
+    if (gammaOf[i] != Adafruit_NeoPixel::gamma32(colors[i])) {
+      CHECK(false, "gamma32(array) at %zu", i);
+      break;
+    }
+  }
+  printf("  %lu strip comparisons\n", compared + 1);
+}
+
+// Runs fn until 0.2 s have passed, returns pixels/s
+template <typename F> static double rate(uint16_t pixels, F fn) {
+  auto start = std::chrono::steady_clock::now();
+  double elapsed;
+  int k = 0;
+  do {
+    for (int i = 0; i < 20; i++)
+      fn(k++);
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                            start)
+                  .count();
+  } while (elapsed < 0.2);
+  return k * (double)pixels / elapsed;
+}
+
+template <typename S, typename K>
+static void bench(const char *name, uint16_t pixels, S scalarFn, K kernelFn) {
+  double s = rate(pixels, scalarFn), k = rate(pixels, kernelFn);
+  printf("  %-28s %8.1f -> %8.1f Mpixel/s\n", name, s / 1e6, k / 1e6);
+}
+
+int main(void) {
+  printf("Kernels against the scalar path\n");
+  testExact();
+
+  const uint16_t N = 1000;
+  Adafruit_NeoPixel bulk(N, 5, NEO_GRB + NEO_KHZ800);
+  Adafruit_NeoPixel scalar(N, 5, NEO_GRB + NEO_KHZ800);
+  bulk.setBrightness(128);
+  scalar.setBrightness(128);
+  std::vector<uint32_t> colors(N);
+  for (uint32_t &c : colors)
+    c = rnd();
+  std::vector<uint8_t> pixels(N * 3);
+
+  printf("1000-pixel GRB strip, brightness 128, scalar -> kernel\n");
+  bench(
+      "rainbow()", N, [&](int k) { scalarRainbow(scalar, k * 256, 1, 255, 255, true); },
+      [&](int k) { bulk.rainbow(k * 256); });
+  bench(
+      "rainbow(), no gamma", N,
+      [&](int k) { scalarRainbow(scalar, k * 256, 1, 255, 255, false); },
+      [&](int k) { bulk.rainbow(k * 256, 1, 255, 255, false); });
+  bench(
+      "setPixelColors()", N,
+      [&](int) {
+        for (uint16_t i = 0; i < N; i++)
+          scalar.setPixelColor(i, colors[i]);
+      },
+      [&](int) { bulk.setPixelColors(colors.data(), N); });
+  bench(
+      "gamma32(array)", N,
+      [&](int) {
+        for (uint16_t i = 0; i < N; i++)
+          colors[i] = Adafruit_NeoPixel::gamma32(colors[i]);
+      },
+      [&](int) { Adafruit_NeoPixel::gamma32(colors.data(), N); });
+  bench(
+      "fill()", N,
+      [&](int k) {
+        for (uint16_t i = 0; i < N; i++)
+          scalar.setPixelColor(i, k);
+      },
+      [&](int k) { bulk.fill(k); });
+  bench(
+      "setBrightness(), dimming", N,
+      [&](int k) {
+        scalarRescale(pixels.data(), pixels.size(), 255 - ((k - 1) & 127),
+                      255 - (k & 127));
+      },
+      [&](int k) { bulk.setBrightness(255 - (k & 127)); });
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
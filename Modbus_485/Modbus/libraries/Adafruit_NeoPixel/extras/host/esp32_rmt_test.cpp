@@ -0,0 +1,214 @@
+// Host test of the ESP32 RMT backend of show(): the bit encoder in
+// esp32_rmt.h, and espShow() from esp.c against a fake Arduino-ESP32 3.x
+// RMT HAL.
+//
+// - neoRmtEncode(): each bit becomes one symbol, high then low, with the
+//   durations given; bytes in order, most significant bit first; nothing
+//   written past the last symbol. NEO_RMT_LATCH() is low for both halves.
+// - espShow(): frames of 4-300 pixels at both speeds decode back to the
+//   pixels, with bit periods within the datasheet tolerance and a 300 us
+//   latch as the last symbol. The pixels may be changed as soon as
+//   espShow() returns. The RMT channel is set up once per pin, strips
+//   beyond the TX channel count are refused and espRelease() frees a slot.
+#include <Arduino.h>
+
+#include <map>
+#include <vector>
+
+#include "esp32_rmt.h"
+
+extern "C" {
+void espShow(uint16_t pin, uint8_t *pixels, uint32_t numBytes,
+             uint8_t is800KHz);
+bool espCanShow(uint16_t pin);
+void espRelease(uint16_t pin);
+}
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+// Fake RMT HAL. A transfer is in flight until rmtTransmitCompleted() has
+// been polled a few times. The symbols are compared with a copy taken by
+// rmtWriteAsync() when it ends, so a buffer reused too early shows up.
+struct Channel {
+  uint32_t hz;
+  rmt_data_t *data;
+  std::vector<uint32_t> copy;
+  int polls;
+};
+static std::map<int, Channel> channels;
+static int inits = 0;
+static std::vector<std::vector<uint32_t>> sent;
+
+extern "C" {
+bool rmtInit(int pin, rmt_ch_dir_t dir, rmt_reserve_memsize_t, uint32_t hz) {
+  CHECK(dir == RMT_TX_MODE, "RX channel");
+  CHECK(!channels.count(pin), "rmtInit() twice on pin %d", pin);
+  inits++;
+  channels[pin] = Channel{hz, NULL, {}, 0};
+  return true;
+}
+
+bool rmtWriteAsync(int pin, rmt_data_t *data, size_t n) {
+  if (!channels.count(pin)) {
+    CHECK(false, "rmtWriteAsync() on pin %d without rmtInit()", pin);
+    return false;
+  }
+  Channel &c = channels[pin];
+  CHECK(!c.polls, "rmtWriteAsync() on pin %d while busy", pin);
+  c.data = data;
+  c.copy.assign((uint32_t *)data, (uint32_t *)data + n);
+  c.polls = 3;
+  return true;
+}
+
+bool rmtTransmitCompleted(int pin) {
+  Channel &c = channels[pin];
+  if (c.polls && !--c.polls) {
+    CHECK(!memcmp(c.data, c.copy.data(), c.copy.size() * 4),
+          "symbols changed during the transfer on pin %d", pin);
+    sent.push_back(c.copy);
+  }
+  return !c.polls;
+}
+
+bool rmtDeinit(int pin) {
+  channels.erase(pin);
+  return true;
+}
+
+void yield(void) {}
+}
+
+static rmt_data_t symbol(uint32_t val) {
+  rmt_data_t d;
+  d.val = val;
+  return d;
+}
+
+static void testEncode(void) {
+  rmt_data_t bit0 = symbol(NEO_RMT_BIT(4, 9)), bit1 = symbol(NEO_RMT_BIT(8, 5));
+  CHECK(bit0.level0 == 1 && bit0.duration0 == 4 && bit0.level1 == 0 &&
+            bit0.duration1 == 9,
+        "NEO_RMT_BIT(4, 9) is %u/%u %u/%u", bit0.level0, bit0.duration0,
+        bit0.level1, bit0.duration1);
+  CHECK(bit1.level0 == 1 && bit1.duration0 == 8 && bit1.level1 == 0 &&
+            bit1.duration1 == 5,
+        "NEO_RMT_BIT(8, 5) is %u/%u %u/%u", bit1.level0, bit1.duration0,
+        bit1.level1, bit1.duration1);
+  rmt_data_t wide = symbol(NEO_RMT_BIT(0x7FFF, 0x7FFF));
+  CHECK(wide.duration0 == 0x7FFF && wide.duration1 == 0x7FFF &&
+            wide.level0 == 1 && wide.level1 == 0,
+        "15-bit durations overflow");
+
+  // Every byte value, then one more to catch writes past the end
+  uint8_t bytes[256];
+  for (int i = 0; i < 256; i++)
+    bytes[i] = i;
+  std::vector<uint32_t> out(256 * 8 + 1, 0xDEADBEEF);
+  size_t n = neoRmtEncode(bytes, 256, bit0.val, bit1.val, out.data());
+  CHECK(n == 256 * 8, "%zu symbols for 256 bytes", n);
+  CHECK(out[256 * 8] == 0xDEADBEEF, "symbol written past the end");
+  for (int i = 0; i < 256 * 8; i++) {
+    bool one = bytes[i / 8] & (0x80 >> (i % 8));
+    if (out[i] != (one ? bit1.val : bit0.val)) {
+      CHECK(false, "byte %02X bit %d", bytes[i / 8], 7 - i % 8);
+      break;
+    }
+  }
+  // Byte order: the first byte goes out first, its top bit leading
+  const uint8_t grb[] = {0x80, 0x00, 0x01};
+  uint32_t s[24];
+  neoRmtEncode(grb, 3, bit0.val, bit1.val, s);
+  CHECK(s[0] == bit1.val && s[1] == bit0.val && s[7] == bit0.val, "0x80");
+  for (int i = 8; i < 16; i++)
+    CHECK(s[i] == bit0.val, "0x00 bit %d", i - 8);
+  CHECK(s[16] == bit0.val && s[23] == bit1.val, "0x01");
+  CHECK(neoRmtEncode(grb, 0, bit0.val, bit1.val, s) == 0, "empty");
+
+  rmt_data_t latch = symbol(NEO_RMT_LATCH(1500));
+  CHECK(!latch.level0 && !latch.level1 && latch.duration0 == 1500 &&
+            latch.duration1 == 1500,
+        "NEO_RMT_LATCH(1500) is %u/%u %u/%u", latch.level0, latch.duration0,
+        latch.level1, latch.duration1);
+}
+
+// Decodes a frame sent at 100 ns per tick, checking the WS2812 (fast) or
+// WS2811 bit periods and the latch
+static bool decode(const std::vector<uint32_t> &s, std::vector<uint8_t> &out,
+                   bool fast) {
+  out.clear();
+  if (s.size() % 8 != 1)
+    return false;
+  double period = fast ? 1.25 : 2.5, threshold = fast ? 0.55 : 0.9; // us
+  for (size_t i = 0; i + 1 < s.size(); i += 8) {
+    uint8_t b = 0;
+    for (int k = 0; k < 8; k++) {
+      rmt_data_t d = symbol(s[i + k]);
+      double high = d.duration0 * 0.1, low = d.duration1 * 0.1;
+      if (!d.level0 || d.level1)
+        return false;
+      if (high + low < period - 0.15 || high + low > period + 0.6)
+        return false;
+      b = b << 1 | (high >= threshold);
+    }
+    out.push_back(b);
+  }
+  rmt_data_t latch = symbol(s.back());
+  return !latch.level0 && !latch.level1 &&
+         (latch.duration0 + latch.duration1) * 0.1 >= 280;
+}
+
+static void testShow(void) {
+  for (int fast = 1; fast >= 0; fast--) {
+    for (int len : {4, 4, 30, 300, 12}) {
+      std::vector<uint8_t> pixels(len * 3), got;
+      for (uint8_t &b : pixels)
+        b = rand();
+      while (!espCanShow(5))
+        ;
+      espShow(5, pixels.data(), pixels.size(), fast);
+      std::vector<uint8_t> frame = pixels;
+      for (uint8_t &b : pixels) // The caller changes its pixels right away
+        b = ~b;
+      while (!espCanShow(5))
+        ;
+      CHECK(decode(sent.back(), got, fast) && got == frame,
+            "%d pixels at %s KHz", len, fast ? "800" : "400");
+    }
+  }
+  CHECK(inits == 1, "%d rmtInit() calls for 10 frames on one pin", inits);
+  CHECK(channels[5].hz == 10000000, "RMT clock %u Hz", channels[5].hz);
+
+  // 4 TX channels: a 5th strip is refused until one is released
+  uint8_t px[3] = {1, 2, 3};
+  for (int pin = 10; pin < 13; pin++)
+    espShow(pin, px, 3, 1);
+  espShow(20, px, 3, 1);
+  CHECK(!channels.count(20), "5th strip got a channel");
+  espRelease(10);
+  CHECK(!channels.count(10), "espRelease() kept the channel");
+  espShow(20, px, 3, 1);
+  while (!espCanShow(20))
+    ;
+  CHECK(channels.count(20), "released slot not reused");
+  for (int pin : {5, 11, 12, 20})
+    espRelease(pin);
+}
+
+int main(void) {
+  printf("neoRmtEncode\n");
+  testEncode();
+  printf("espShow\n");
+  testShow();
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,85 @@
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef bool boolean;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+#define INPUT 0
+#define OUTPUT 1
+#define LOW 0
+#define HIGH 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Defined by each test
+void yield(void);
+uint32_t micros(void);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+#ifdef __cplusplus
+}
+#endif
+
+#if defined(HOST_MEMCPY_HOOK)
+// Lets a test run code just before each memcpy() of the translation units
+// built with HOST_MEMCPY_HOOK
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void (*memcpyHook)(void *dest, const void *src, size_t n);
+#ifdef __cplusplus
+}
+#endif
+static inline void *hostMemcpy(void *dest, const void *src, size_t n) {
+  if (memcpyHook)
+    memcpyHook(dest, src, n);
+  return memcpy(dest, src, n);
+}
+#define memcpy hostMemcpy
+#endif
+
+#if defined(ESP32)
+// Arduino-ESP32 3.x, with the RMT HAL of esp32-hal-rmt.h. The HAL itself
+// is faked by each test.
+#define ESP_IDF_VERSION_VAL(major, minor, patch)                               \
+  ((major) << 16 | (minor) << 8 | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(5, 1, 0)
+
+typedef union {
+  struct {
+    uint32_t duration0 : 15;
+    uint32_t level0 : 1;
+    uint32_t duration1 : 15;
+    uint32_t level1 : 1;
+  };
+  uint32_t val;
+} rmt_data_t;
+typedef enum { RMT_RX_MODE, RMT_TX_MODE } rmt_ch_dir_t;
+typedef enum { RMT_MEM_NUM_BLOCKS_1 = 1 } rmt_reserve_memsize_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+bool rmtInit(int pin, rmt_ch_dir_t channel_direction,
+             rmt_reserve_memsize_t memsize, uint32_t frequency_Hz);
+bool rmtWriteAsync(int pin, rmt_data_t *data, size_t num_rmt_symbols);
+bool rmtTransmitCompleted(int pin);
+bool rmtDeinit(int pin);
+#ifdef __cplusplus
+}
+#endif
+
+#define log_e(...) (fprintf(stderr, __VA_ARGS__), fputc('\n', stderr))
+#endif
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+
+typedef uint8_t byte;
+using std::max;
+using std::min;
+
+inline unsigned long millis(void) {
+  static auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+inline void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+inline void yield(void) { std::this_thread::yield(); }
+inline long random(long high) { return high ? rand() % high : 0; }
+inline long random(long low, long high) { return low + random(high - low); }
+inline bool isHexadecimalDigit(int c) { return isxdigit(c); }
+inline bool isSpace(int c) { return isspace(c); }
+
+/// The String calls the libraries make, on a std::string. A String made
+/// from NULL is invalid, as when the Arduino one runs out of memory.
+class String {
+public:
+  std::string s;
+  bool valid = true;
+
+  String(const char *c = "") {
+    if (c)
+      s = c;
+    else
+      valid = false;
+  }
+  String(const std::string &x) : s(x) {}
+  unsigned char reserve(unsigned n) {
+    s.reserve(n);
+    return 1;
+  }
+  unsigned char concat(const char *c) {
+    s += c;
+    return 1;
+  }
+  unsigned char concat(char c) {
+    s.push_back(c);
+    return 1;
+  }
+  String &operator+=(char c) {
+    s.push_back(c);
+    return *this;
+  }
+  String &operator+=(const char *c) {
+    s += c;
+    return *this;
+  }
+  String &operator+=(const String &c) {
+    s += c.s;
+    return *this;
+  }
+  unsigned length(void) const { return s.size(); }
+  const char *c_str(void) const { return s.c_str(); }
+  int indexOf(char c) const {
+    size_t p = s.find(c);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  String substring(int from, int to = -1) const {
+    return String(s.substr(from, to < 0 ? std::string::npos : to - from));
+  }
+  char operator[](int i) const { return s[i]; }
+  bool operator==(const char *c) const { return s == c; }
+};
+
+class Print;
+
+class Printable {
+public:
+  virtual size_t printTo(Print &) const = 0;
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *b, size_t n) {
+    size_t k = 0;
+    while (n--)
+      k += write(*b++);
+    return k;
+  }
+  size_t print(const char *c) { return write((const uint8_t *)c, strlen(c)); }
+  size_t print(const String &c) { return print(c.c_str()); }
+  size_t print(long v) { return print(std::to_string(v).c_str()); }
+  size_t print(int v) { return print((long)v); }
+  size_t print(unsigned v) { return print((long)v); }
+  size_t println(const char *c = "") { return print(c) + print("\r\n"); }
+  size_t println(const String &c) { return println(c.c_str()); }
+  size_t println(long v) { return print(v) + println(); }
+  size_t println(int v) { return println((long)v); }
+  virtual void flush(void) {}
+};
+
+class Stream : public Print {
+public:
+  virtual int available(void) = 0;
+  virtual int read(void) = 0;
+  virtual int peek(void) = 0;
+  void setTimeout(unsigned long t) { _timeout = t; }
+  size_t readBytes(char *b, size_t n) {
+    size_t k = 0;
+    while (k < n) {
+      int c = timedRead();
+      if (c < 0)
+        break;
+      b[k++] = c;
+    }
+    return k;
+  }
+  size_t readBytes(uint8_t *b, size_t n) { return readBytes((char *)b, n); }
+
+protected:
+  unsigned long _timeout = 1000;
+  int timedRead(void) {
+    unsigned long start = millis();
+    do {
+      int c = read();
+      if (c >= 0)
+        return c;
+    } while (millis() - start < _timeout);
+    return -1;
+  }
+};
+
+#endif
@@ -260,7 +260,8 @@ public:
     bool endOfHeadersReached();
 
     /** Test whether the end of the body has been reached.
-      Only works if the Content-Length header was returned by the server
+      Only works if the Content-Length header was returned by the server, or
+      the body is chunked
       @return true if we are now at the end of the body, else false
     */
     bool endOfBodyReached();
@@ -287,10 +288,52 @@ public:
     */
     String responseBody();
 
+    /** Read the next part of the response body into a buffer.
+      Chunked bodies are decoded as they arrive, so the buffer only ever
+      receives body bytes, and nothing past the end of the body is read.
+      Call it repeatedly to process a large body a piece at a time.
+      Also skips response headers if they have not been read already
+      MUST be called after responseStatusCode()
+      @param aBuffer Where to put the body bytes
+      @param aSize   Room in aBuffer
+      @return Number of bytes read, less than aSize only once the end of the
+      body is reached or no data arrived for the stream timeout
+    */
+    int readBody(uint8_t* aBuffer, size_t aSize);
+
+    /** Read and discard the rest of the response body.
+      Use this instead of responseBody() when the body isn't needed, it
+      doesn't keep the body in memory
+      MUST be called after responseStatusCode()
+      @return HTTP_SUCCESS if the whole body was read, else an error code
+    */
+    int skipResponseBody();
+
     /** Enables connection keep-alive mode
+      The connection is then reused for the next request to the same server,
+      unless it has been idle for longer than keepAliveTimeout() or the
+      server asked to close it.  Whatever is left of the previous response
+      is read and discarded first, so it doesn't matter how much of it was
+      read
     */
     void connectionKeepAlive();
 
+    /** Allow several requests to be sent before their responses are read
+      (HTTP/1.1 pipelining), which saves a round trip per request.  Needs
+      connectionKeepAlive().  Read the responses in the order the requests
+      were sent; responseStatusCode() moves on to the next response,
+      skipping what is left of the current one.  A request that can't be
+      pipelined (queue full, or the connection is new or can't be reused)
+      first discards the responses still waiting
+      @param aDepth Requests that may be waiting for a response, 1 turns
+                    pipelining off
+    */
+    void setPipelineDepth(uint8_t aDepth) { iPipelineDepth = aDepth ? aDepth : 1; };
+
+    /** Number of responses still to be read, including the current one
+    */
+    int pendingResponses() { return (iState >= eRequestSent) ? iQueuedResponses + 1 : 0; };
+
     /** Disables sending the default request headers (Host and User Agent)
     */
     void noDefaultRequestHeaders();
@@ -307,12 +350,19 @@ public:
     */
     virtual int read();
     virtual int read(uint8_t *buf, size_t size);
-    virtual int peek() { return iClient->peek(); };
+    virtual int peek();
+    /** Read body bytes, waiting up to the stream timeout for them.
+      Same as readBody() once the headers have been read, which lets a
+      parser that takes a Stream, such as ArduinoJson's deserializeJson(),
+      consume the body straight from the connection
+    */
+    using Stream::readBytes;
+    size_t readBytes(char *buffer, size_t length);
     virtual void flush() { iClient->flush(); };
 
     // Inherited from Client
-    virtual int connect(IPAddress ip, uint16_t port) { return iClient->connect(ip, port); };
-    virtual int connect(const char *host, uint16_t port) { return iClient->connect(host, port); };
+    virtual int connect(IPAddress ip, uint16_t port);
+    virtual int connect(const char *host, uint16_t port);
     virtual void stop();
     virtual uint8_t connected() { return iClient->connected(); };
     virtual operator bool() { return bool(iClient); };
@@ -320,6 +370,8 @@ public:
     virtual void setHttpResponseTimeout(uint32_t timeout) { iHttpResponseTimeout = timeout; };
     virtual uint32_t httpWaitForDataDelay() { return iHttpWaitForDataDelay; };
     virtual void setHttpWaitForDataDelay(uint32_t delay) { iHttpWaitForDataDelay = delay; };
+    virtual uint32_t keepAliveTimeout() { return iKeepAliveTimeout; };
+    virtual void setKeepAliveTimeout(uint32_t timeout) { iKeepAliveTimeout = timeout; };
 protected:
     /** Reset internal state data back to the "just initialised" state
     */
@@ -341,6 +393,35 @@ protected:
     */
     void flushClientRx();
 
+    /** Parse chunk size lines, and the trailer after the last chunk, from
+      the bytes already received
+    */
+    void readChunkHeader();
+
+    /** Account for aCount body bytes read by the user
+    */
+    void bodyConsumed(int aCount);
+
+    /** Queue the request about to be sent behind the responses still to be
+      read if it can be pipelined, else discard those responses
+    */
+    void prepareRequest();
+
+    /** Read what is left of the current response
+      @return true if the connection is now at the start of the next response
+    */
+    bool finishResponse();
+
+    /** Make the next pipelined response the current one
+    */
+    void startNextResponse();
+
+    /** Check whether the open connection can take the next request
+      @return true if it's to our server, kept alive, still connected and
+      hasn't been idle for longer than the keep-alive timeout
+    */
+    bool connectionReusable();
+
     // Number of milliseconds that we wait each time there isn't any data
     // available to be read (during status code and header processing)
     static const int kHttpWaitForDataDelay = 100;
@@ -348,8 +429,15 @@ protected:
     // data before returning HTTP_ERROR_TIMED_OUT (during status code and header
     // processing)
     static const int kHttpResponseTimeout = 30*1000;
+    // Size of the stack buffer responseBody() and skipResponseBody() read
+    // the body through
+    static const int kBodyBlockSize = 64;
+    // Number of milliseconds a kept-alive connection may sit idle and still
+    // be reused, servers commonly close them after 5 to 75 seconds
+    static const int kKeepAliveTimeout = 5*1000;
     static const char* kContentLengthPrefix;
     static const char* kTransferEncodingChunked;
+    static const char* kConnectionClose;
     typedef enum {
         eIdle,
         eRequestStarted,
@@ -361,7 +449,9 @@ protected:
         eLineStartingCRFound,
         eReadingBody,
         eReadingChunkLength,
-        eReadingBodyChunk
+        eReadingBodyChunk,
+        eReadingChunkTrailer,
+        eChunkedBodyDone
     } tHttpState;
     // Client we're using
     Client* iClient;
@@ -382,13 +472,29 @@ protected:
     const char* iContentLengthPtr;
     // How far through a Transfer-Encoding chunked header we are
     const char* iTransferEncodingChunkedPtr;
+    // How far through a Connection: close header we are
+    const char* iConnectionClosePtr;
     // Stores if the response body is chunked
     bool iIsChunked;
     // Stores the value of the current chunk length, if present
     int iChunkLength;
+    // Characters seen on the current chunk size or trailer line
+    int iChunkLineLength;
+    // Set once a chunk extension (";name=value") starts on the size line
+    bool iChunkExtension;
     uint32_t iHttpResponseTimeout;
     uint32_t iHttpWaitForDataDelay;
     bool iConnectionClose;
+    // Set while the connection is open to our server and can take another
+    // request
+    bool iReusable;
+    // When the last request was sent, for the keep-alive idle timeout
+    unsigned long iLastRequestTime;
+    uint32_t iKeepAliveTimeout;
+    // Requests that may be waiting for a response at once
+    uint8_t iPipelineDepth;
+    // Responses waiting behind the one being read
+    uint8_t iQueuedResponses;
     bool iSendDefaultRequestHeaders;
     String iHeaderLine;
 };
@@ -81,8 +81,10 @@ int WebSocketClient::beginMessage(int aType)
     }
 
     iTxStarted = true;
+    iTxFragmented = false;
     iTxMessageType = (aType & 0xf);
     iTxSize = 0;
+    newMaskKey();
 
     return 0;
 }
@@ -95,87 +97,156 @@ int WebSocketClient::endMessage()
         return 1;
     }
 
-    // send FIN + the message type (opcode)
-    HttpClient::write(0x80 | iTxMessageType);
+    // send what's left of the message as the final frame
+    bool sent = sendFrame(iTxSize, true);
 
-    // the message is masked (0x80)
-    // send the length
-    if (iTxSize < 126)
+    iTxStarted = false;
+    iTxFragmented = false;
+    iTxSize = 0;
+
+    return sent ? 0 : 1;
+}
+
+size_t WebSocketClient::write(uint8_t aByte)
+{
+    return write(&aByte, sizeof(aByte));
+}
+
+size_t WebSocketClient::write(const uint8_t *aBuffer, size_t aSize)
+{
+    if (iState < eReadingBody)
     {
-        HttpClient::write(0x80 | (uint8_t)iTxSize);
+        // have not upgraded the connection yet
+        return HttpClient::write(aBuffer, aSize);
     }
-    else if (iTxSize < 0xffff)
+
+    if (!iTxStarted)
     {
-        HttpClient::write(0x80 | 126);
-        HttpClient::write((iTxSize >> 8) & 0xff);
-        HttpClient::write((iTxSize >> 0) & 0xff);
+        // fail TX not started
+        return 0;
     }
-    else
+
+    const uint8_t* maskKey = iTxBuffer + kMaxFrameHeaderSize - kMaskKeySize;
+    uint8_t* data = iTxBuffer + kMaxFrameHeaderSize;
+
+    if ((iTxSize + aSize) <= WS_TX_BUFFER_SIZE)
     {
-        HttpClient::write(0x80 | 127);
-        HttpClient::write((iTxSize >> 56) & 0xff);
-        HttpClient::write((iTxSize >> 48) & 0xff);
-        HttpClient::write((iTxSize >> 40) & 0xff);
-        HttpClient::write((iTxSize >> 32) & 0xff);
-        HttpClient::write((iTxSize >> 24) & 0xff);
-        HttpClient::write((iTxSize >> 16) & 0xff);
-        HttpClient::write((iTxSize >> 8) & 0xff);
-        HttpClient::write((iTxSize >> 0) & 0xff);
+        // mask the data into the buffer
+        mask(data + iTxSize, aBuffer, aSize, maskKey, iTxSize);
+        iTxSize += aSize;
+
+        return aSize;
     }
 
-    uint8_t maskKey[4];
+    // Too much to hold, so the buffered data and all of this write go now as
+    // a fragment of the message.  Fill the buffer first, so the frame header
+    // goes out with as much data as possible
+    uint64_t frameLength = iTxSize + aSize;
+    size_t frameOffset = WS_TX_BUFFER_SIZE;
+    size_t written = WS_TX_BUFFER_SIZE - iTxSize;
 
-    // create a random mask for the data and send
-    for (int i = 0; i < (int)sizeof(maskKey); i++)
+    mask(data + iTxSize, aBuffer, written, maskKey, iTxSize);
+    iTxSize = WS_TX_BUFFER_SIZE;
+
+    if (!sendFrame(frameLength, false))
     {
-        maskKey[i] = random(0xff);
+        written = 0;
     }
-    HttpClient::write(maskKey, sizeof(maskKey));
+    else
+    {
+        // then mask and send the rest a buffer at a time
+        while (written < aSize)
+        {
+            size_t chunk = min(aSize - written, (size_t)WS_TX_BUFFER_SIZE);
 
-    // mask the data and send
-    for (int i = 0; i < (int)iTxSize; i++) {
-        iTxBuffer[i] ^= maskKey[i % sizeof(maskKey)];
+            mask(data, aBuffer + written, chunk, maskKey, frameOffset);
+            if (HttpClient::write(data, chunk) != chunk)
+            {
+                break;
+            }
+            written += chunk;
+            frameOffset += chunk;
+        }
     }
 
-    size_t txSize = iTxSize;
-
-    iTxStarted = false;
+    iTxFragmented = true;
     iTxSize = 0;
+    newMaskKey();
 
-    return (HttpClient::write(iTxBuffer, txSize) == txSize) ? 0 : 1;
+    return written;
 }
 
-size_t WebSocketClient::write(uint8_t aByte)
+bool WebSocketClient::sendFrame(uint64_t aLength, bool aFinal)
 {
-    return write(&aByte, sizeof(aByte));
-}
+    // The header is built backwards from the mask key, which sits just
+    // before the buffered data, so all of them are sent with one write
+    int lengthSize = (aLength < 126) ? 0 : ((aLength <= 0xffff) ? 2 : 8);
+    uint8_t* header = iTxBuffer + kMaxFrameHeaderSize - kMaskKeySize - 2 - lengthSize;
+    uint8_t* p = header;
 
-size_t WebSocketClient::write(const uint8_t *aBuffer, size_t aSize)
-{
-    if (iState < eReadingBody)
+    // send FIN + the message type (opcode), fragments after the first one
+    // are continuations
+    *p++ = (aFinal ? 0x80 : 0x00) | (iTxFragmented ? TYPE_CONTINUATION : iTxMessageType);
+
+    // the message is masked (0x80)
+    // send the length
+    if (lengthSize == 0)
     {
-        // have not upgraded the connection yet
-        return HttpClient::write(aBuffer, aSize);
+        *p++ = 0x80 | (uint8_t)aLength;
+    }
+    else
+    {
+        *p++ = 0x80 | ((lengthSize == 2) ? 126 : 127);
+        for (int i = lengthSize - 1; i >= 0; i--)
+        {
+            *p++ = (aLength >> (8 * i)) & 0xff;
+        }
     }
 
-    if (!iTxStarted)
+    size_t txSize = (iTxBuffer + kMaxFrameHeaderSize + iTxSize) - header;
+
+    return (HttpClient::write(header, txSize) == txSize);
+}
+
+void WebSocketClient::newMaskKey()
+{
+    uint8_t* maskKey = iTxBuffer + kMaxFrameHeaderSize - kMaskKeySize;
+
+    // create a random mask for the data
+    for (int i = 0; i < (int)kMaskKeySize; i++)
     {
-        // fail TX not   started
-        return 0;
+        maskKey[i] = random(0x100);
     }
+}
+
+void WebSocketClient::mask(uint8_t* aDest, const uint8_t* aSource, size_t aSize,
+                           const uint8_t* aMaskKey, size_t aMaskIndex)
+{
+    // Line the key up with the first byte, then mask a 32-bit word at a time.
+    // memcpy keeps the words safe for unaligned data, and compiles to plain
+    // loads and stores where the processor allows it
+    uint8_t key[kMaskKeySize];
+    uint32_t key32;
 
-    // check if the write size, fits in the buffer
-    if ((iTxSize + aSize) > sizeof(iTxBuffer))
+    for (int i = 0; i < (int)sizeof(key); i++)
     {
-        aSize = sizeof(iTxSize) - iTxSize;
+        key[i] = aMaskKey[(aMaskIndex + i) & 3];
     }
+    memcpy(&key32, key, sizeof(key32));
 
-    // copy data into the buffer
-    memcpy(iTxBuffer + iTxSize, aBuffer, aSize);
+    size_t i = 0;
+    for (; (i + sizeof(key32)) <= aSize; i += sizeof(key32))
+    {
+        uint32_t word;
 
-    iTxSize += aSize;
-    
-    return aSize;
+        memcpy(&word, aSource + i, sizeof(word));
+        word ^= key32;
+        memcpy(aDest + i, &word, sizeof(word));
+    }
+    for (; i < aSize; i++)
+    {
+        aDest[i] = aSource[i] ^ key[i & 3];
+    }
 }
 
 int WebSocketClient::parseMessage()
@@ -189,9 +260,13 @@ int WebSocketClient::parseMessage()
         return 0;
     }
 
-    // read open code and length
-    uint8_t opcode = HttpClient::read();
-    int length = HttpClient::read();
+    // read op code and length
+    uint8_t header[12];
+
+    HttpClient::read(header, 2);
+
+    uint8_t opcode = header[0];
+    int length = header[1];
 
     if ((opcode & 0x0f) == 0)
     {
@@ -206,34 +281,26 @@ int WebSocketClient::parseMessage()
     iRxMasked = (length & 0x80);
     length &= 0x7f;
 
-    // read the RX size
-    if (length < 126)
-    {
-        iRxSize = length;
-    }
-    else if (length == 126)
+    // read the extended RX size and the mask, if present, in one go
+    int lengthSize = (length < 126) ? 0 : ((length == 126) ? 2 : 8);
+
+    if (!readFrameHeader(header, lengthSize + (iRxMasked ? kMaskKeySize : 0)))
     {
-        iRxSize = (HttpClient::read() << 8) | HttpClient::read();
+        // lost track of the frames, so the connection can't be used
+        stop();
+        iRxSize = 0;
+        return 0;
     }
-    else
+
+    iRxSize = (lengthSize == 0) ? length : 0;
+    for (int i = 0; i < lengthSize; i++)
     {
-        iRxSize = ((uint64_t)HttpClient::read() << 56) | 
-                    ((uint64_t)HttpClient::read() << 48) | 
-                    ((uint64_t)HttpClient::read() << 40) | 
-                    ((uint64_t)HttpClient::read() << 32) | 
-                    ((uint64_t)HttpClient::read() << 24) | 
-                    ((uint64_t)HttpClient::read() << 16) | 
-                    ((uint64_t)HttpClient::read() << 8)  |
-                    (uint64_t)HttpClient::read(); 
+        iRxSize = (iRxSize << 8) | header[i];
     }
 
-    // read in the mask, if present
     if (iRxMasked)
     {
-        for (int i = 0; i < (int)sizeof(iRxMaskKey); i++)
-        {
-            iRxMaskKey[i] = HttpClient::read();
-        }
+        memcpy(iRxMaskKey, header + lengthSize, kMaskKeySize);
     }
 
     iRxMaskIndex = 0;
@@ -246,10 +313,18 @@ int WebSocketClient::parseMessage()
     }
     else if (TYPE_PING == messageType())
     {
+        uint8_t data[kBodyBlockSize];
+
+        // send the ping's data back in a pong
         beginMessage(TYPE_PONG);
-        while(available())
+        while (available())
         {
-            write(read());
+            int n = readBody(data, min((int)sizeof(data), available()));
+            if (n <= 0)
+            {
+                break;
+            }
+            write(data, n);
         }
         endMessage();
 
@@ -281,11 +356,29 @@ String WebSocketClient::readString()
 
     if (avail > 0)
     {
+        char buffer[kBodyBlockSize + 1];
+
         s.reserve(avail);
 
-        for (int i = 0; i < avail; i++)
+        while (available())
         {
-            s += (char)read();
+            int n = readBody((uint8_t*)buffer, min((int)kBodyBlockSize, available()));
+            if (n <= 0)
+            {
+                break;
+            }
+            buffer[n] = '\0';
+            // concat() stops at a NUL, so a block holding one goes in piecewise
+            for (int i = 0; i < n; i++)
+            {
+                int len = strlen(buffer + i);
+                s.concat(buffer + i);
+                if (i + len < n)
+                {
+                    s.concat('\0');
+                }
+                i += len;
+            }
         }
     }
 
@@ -331,19 +424,27 @@ int WebSocketClient::read()
 
 int WebSocketClient::read(uint8_t *aBuffer, size_t aSize)
 {
+    if ((iState >= eReadingBody) && (aSize > iRxSize))
+    {
+        // stop at the end of the frame, the next frame's header follows it
+        aSize = iRxSize;
+        if (aSize == 0)
+        {
+            return 0;
+        }
+    }
+
     int readCount = HttpClient::read(aBuffer, aSize);
 
     if (readCount > 0)
     {
         iRxSize -= readCount;
 
-        // unmask the RX data if needed
+        // unmask the RX data in place if needed
         if (iRxMasked)
         {
-            for (int i = 0; i < (int)aSize; i++, iRxMaskIndex++)
-            {
-                aBuffer[i] ^= iRxMaskKey[iRxMaskIndex % sizeof(iRxMaskKey)];
-            }
+            mask(aBuffer, aBuffer, readCount, iRxMaskKey, iRxMaskIndex);
+            iRxMaskIndex = (iRxMaskIndex + readCount) & 3;
         }
     }
 
@@ -352,21 +453,58 @@ int WebSocketClient::read(uint8_t *aBuffer, size_t aSize)
 
 int WebSocketClient::peek()
 {
+    if ((iState >= eReadingBody) && (iRxSize == 0))
+    {
+        return -1;
+    }
+
     int p = HttpClient::peek();
 
     if (p != -1 && iRxMasked)
     {
         // unmask the RX data if needed
-        p = (uint8_t)p ^ iRxMaskKey[iRxMaskIndex % sizeof(iRxMaskKey)];
+        p = (uint8_t)p ^ iRxMaskKey[iRxMaskIndex];
     }
 
     return p;
 }
 
+bool WebSocketClient::readFrameHeader(uint8_t* aBuffer, size_t aSize)
+{
+    size_t total = 0;
+    unsigned long timeoutStart = millis();
+
+    while ((total < aSize) && ((millis() - timeoutStart) < _timeout))
+    {
+        int n = HttpClient::read(aBuffer + total, aSize - total);
+        if (n > 0)
+        {
+            total += n;
+            // We read something, reset the timeout counter
+            timeoutStart = millis();
+        }
+        else if (!connected())
+        {
+            break;
+        }
+        else
+        {
+            yield();
+        }
+    }
+
+    return (total == aSize);
+}
+
 void WebSocketClient::flushRx()
 {
-    while(available())
+    uint8_t buffer[kBodyBlockSize];
+
+    while (available())
     {
-        read();
+        if ((read(buffer, sizeof(buffer)) <= 0) && !connected())
+        {
+            break;
+        }
     }
 }
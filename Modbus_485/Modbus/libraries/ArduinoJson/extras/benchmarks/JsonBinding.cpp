@@ -0,0 +1,98 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+//
+// Compares ARDUINOJSON_BIND() with a JsonDocument on a telemetry message.
+// Usage: JsonBindingBenchmark [iterations]
+
+#include <ArduinoJson.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+struct Sensor {
+  float temperature;
+  float humidity;
+  int light;
+};
+ARDUINOJSON_BIND(Sensor, temperature, humidity, light)
+
+struct Telemetry {
+  char device[24];
+  long ts;
+  Sensor sensor;
+  bool relays[4];
+  int rssi;
+};
+ARDUINOJSON_BIND(Telemetry, device, ts, sensor, relays, rssi)
+
+const char* const payload =
+    "{\"device\":\"modbus-gw-01\",\"ts\":1718000000,"
+    "\"sensor\":{\"temperature\":24.5,\"humidity\":61.25,\"light\":512},"
+    "\"relays\":[true,false,false,true],\"rssi\":-67}";
+
+bool parseWithDocument(Telemetry& t) {
+  JsonDocument doc;
+  if (deserializeJson(doc, payload))
+    return false;
+  t = doc.as<Telemetry>();  // one lookup per field
+  return true;
+}
+
+bool parseWithBinding(Telemetry& t) {
+  return !deserializeJson(t, payload);
+}
+
+bool serializeWithDocument(const Telemetry& t, std::string& json) {
+  JsonDocument doc;
+  doc.set(t);
+  json.clear();
+  return serializeJson(doc, json) > 0;
+}
+
+bool serializeWithBinding(const Telemetry& t, std::string& json) {
+  json.clear();
+  return serializeJson(t, json) > 0;
+}
+
+template <typename TFunc>
+double measure(long iterations, TFunc func) {
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; i++) {
+    if (!func()) {
+      fprintf(stderr, "failed\n");
+      exit(1);
+    }
+  }
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / static_cast<double>(iterations);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  long iterations = argc > 1 ? atol(argv[1]) : 200000;
+  Telemetry t = Telemetry();
+  std::string json;
+  json.reserve(256);
+
+  double docIn = measure(iterations, [&]() { return parseWithDocument(t); });
+  double bindIn = measure(iterations, [&]() { return parseWithBinding(t); });
+  double docOut =
+      measure(iterations, [&]() { return serializeWithDocument(t, json); });
+  double bindOut =
+      measure(iterations, [&]() { return serializeWithBinding(t, json); });
+
+  printf("%-12s %12s %12s %8s\n", "", "document", "binding", "speedup");
+  printf("%-12s %9.0f ns %9.0f ns %7.2fx\n", "deserialize", docIn, bindIn,
+         docIn / bindIn);
+  printf("%-12s %9.0f ns %9.0f ns %7.2fx\n", "serialize", docOut, bindOut,
+         docOut / bindOut);
+
+  return 0;
+}
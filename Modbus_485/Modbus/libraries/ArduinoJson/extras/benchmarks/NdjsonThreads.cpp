@@ -0,0 +1,213 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+//
+// Parses an NDJSON stream of telemetry messages on several threads, each with
+// its own JsonDocument, and reports how the throughput scales with the number
+// of threads, once with a per-thread arena allocator and once with malloc().
+// Usage: NdjsonThreadsBenchmark [lines] [maxThreads]
+
+#include <ArduinoJson.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// A bump allocator that is reset after each line.
+// Only the last block can be freed or resized in place, which is how
+// ArduinoJson uses its allocator while parsing.
+class ArenaAllocator : public ArduinoJson::Allocator {
+ public:
+  explicit ArenaAllocator(size_t capacity)
+      : buffer_(new char[capacity]), capacity_(capacity) {}
+
+  virtual ~ArenaAllocator() {
+    delete[] buffer_;
+  }
+
+  ArenaAllocator(const ArenaAllocator&) = delete;
+  ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+  void* allocate(size_t n) override {
+    size_t size = align(n) + headerSize;
+    if (size > capacity_ - top_)
+      return nullptr;
+    last_ = top_;
+    top_ += size;
+    *reinterpret_cast<size_t*>(static_cast<void*>(buffer_ + last_)) = n;
+    return buffer_ + last_ + headerSize;
+  }
+
+  void deallocate(void* p) override {
+    if (p && offsetOf(p) == last_)
+      top_ = last_;
+  }
+
+  void* reallocate(void* p, size_t n) override {
+    if (!p)
+      return allocate(n);
+    size_t offset = offsetOf(p);
+    if (offset == last_ && align(n) + headerSize <= capacity_ - last_) {
+      top_ = last_ + align(n) + headerSize;
+      *reinterpret_cast<size_t*>(static_cast<void*>(buffer_ + last_)) = n;
+      return p;
+    }
+    size_t oldSize =
+        *reinterpret_cast<size_t*>(static_cast<void*>(buffer_ + offset));
+    void* q = allocate(n);
+    if (q)
+      memcpy(q, p, oldSize < n ? oldSize : n);
+    return q;
+  }
+
+  void reset() {
+    top_ = last_ = 0;
+  }
+
+ private:
+  static const size_t headerSize = 16;
+
+  static size_t align(size_t n) {
+    return (n + headerSize - 1) & ~(headerSize - 1);
+  }
+
+  size_t offsetOf(void* p) const {
+    return static_cast<size_t>(static_cast<char*>(p) - buffer_) - headerSize;
+  }
+
+  char* buffer_;
+  size_t capacity_;
+  size_t top_ = 0;
+  size_t last_ = 0;
+};
+
+struct Line {
+  const char* json;
+  size_t size;
+};
+
+std::string generateNdjson(long count) {
+  std::string ndjson;
+  char line[256];
+  for (long i = 0; i < count; i++) {
+    snprintf(line, sizeof(line),
+             "{\"ts\":%lld,\"deviceName\":\"device-%03ld\",\"values\":{"
+             "\"temperature\":%ld.%ld,\"humidity\":%ld,\"relay\":%s,"
+             "\"rssi\":-%ld,\"fw_version\":\"1.2.%ld\"}}\n",
+             1718000000000LL + i, i % 500, 20 + i % 15, i % 10, 40 + i % 50,
+             i % 2 ? "true" : "false", 50 + i % 40, i % 7);
+    ndjson += line;
+  }
+  return ndjson;
+}
+
+std::vector<Line> splitLines(const std::string& ndjson) {
+  std::vector<Line> lines;
+  size_t begin = 0;
+  while (begin < ndjson.size()) {
+    size_t end = ndjson.find('\n', begin);
+    if (end == std::string::npos)
+      end = ndjson.size();
+    lines.push_back({ndjson.c_str() + begin, end - begin});
+    begin = end + 1;
+  }
+  return lines;
+}
+
+// Returns the sum of the "humidity" values, or -1 if parsing failed
+long long parseLines(const Line* first, const Line* last, bool useArena) {
+  ArenaAllocator arena(16384);
+  JsonDocument doc(useArena
+                       ? static_cast<ArduinoJson::Allocator*>(&arena)
+                       : ArduinoJson::detail::DefaultAllocator::instance());
+  long long checksum = 0;
+  for (const Line* line = first; line != last; ++line) {
+    if (deserializeJson(doc, line->json, line->size))
+      return -1;
+    checksum += doc["values"]["humidity"].as<long long>();
+    doc.clear();
+    arena.reset();
+  }
+  return checksum;
+}
+
+// Returns the elapsed time in seconds, or a negative value on failure
+double run(const std::vector<Line>& lines, unsigned threadCount, bool useArena,
+           long long expectedChecksum) {
+  std::vector<std::thread> threads;
+  std::vector<long long> checksums(threadCount);
+  size_t linesPerThread = (lines.size() + threadCount - 1) / threadCount;
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned t = 0; t < threadCount; t++) {
+    size_t begin = std::min(lines.size(), t * linesPerThread);
+    size_t end = std::min(lines.size(), begin + linesPerThread);
+    threads.emplace_back([&, t, begin, end]() noexcept {
+      checksums[t] =
+          parseLines(lines.data() + begin, lines.data() + end, useArena);
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  long long checksum = 0;
+  for (long long c : checksums) {
+    if (c < 0)
+      return -1;
+    checksum += c;
+  }
+  return checksum == expectedChecksum ? elapsed.count() : -1;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  long lineCount = argc > 1 ? atol(argv[1]) : 200000;
+  unsigned maxThreads = argc > 2 ? static_cast<unsigned>(atoi(argv[2]))
+                                 : std::thread::hardware_concurrency();
+  if (lineCount <= 0)
+    lineCount = 1;
+  if (maxThreads == 0)
+    maxThreads = 1;
+
+  std::string ndjson = generateNdjson(lineCount);
+  std::vector<Line> lines = splitLines(ndjson);
+  long long expectedChecksum =
+      parseLines(lines.data(), lines.data() + lines.size(), false);
+  double megabytes = static_cast<double>(ndjson.size()) / 1e6;
+
+  printf("%ld lines, %.1f MB\n", lineCount, megabytes);
+  printf("%-8s %12s %8s %10s %12s %8s %10s\n", "threads", "arena", "speedup",
+         "efficiency", "malloc", "speedup", "efficiency");
+
+  double arenaBaseline = 0, mallocBaseline = 0;
+  for (unsigned threads = 1;; threads = std::min(threads * 2, maxThreads)) {
+    double arena = run(lines, threads, true, expectedChecksum);
+    double heap = run(lines, threads, false, expectedChecksum);
+    if (arena < 0 || heap < 0) {
+      fprintf(stderr, "parsing failed\n");
+      return 1;
+    }
+    if (threads == 1) {
+      arenaBaseline = arena;
+      mallocBaseline = heap;
+    }
+    printf("%-8u %7.1f MB/s %7.2fx %9.0f%% %7.1f MB/s %7.2fx %9.0f%%\n",
+           threads, megabytes / arena, arenaBaseline / arena,
+           100 * arenaBaseline / arena / threads, megabytes / heap,
+           mallocBaseline / heap, 100 * mallocBaseline / heap / threads);
+    if (threads == maxThreads)
+      break;
+  }
+
+  return 0;
+}
@@ -0,0 +1,57 @@
+#include <ArduinoJson.h>
+
+#include <stdlib.h>  // abort
+
+struct NullHandler {
+  void beginObject() {}
+  void endObject() {}
+  void beginArray() {}
+  void endArray() {}
+  void key(JsonString) {}
+  void value(JsonVariantConst) {}
+};
+
+// Feeds the input in chunks of increasing sizes, so that tokens are split at
+// many different positions
+template <typename TParser>
+DeserializationError feedInChunks(TParser& parser, const uint8_t* data,
+                                  size_t size) {
+  DeserializationError error = DeserializationError::Ok;
+  size_t chunkSize = 1;
+  for (size_t i = 0; i < size && !error; i += chunkSize, chunkSize++) {
+    size_t n = size - i < chunkSize ? size - i : chunkSize;
+    error = parser.feed(data + i, n);
+  }
+  if (!error)
+    error = parser.end();
+  return error;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  JsonDocument doc;
+  JsonStreamDeserializer deserializer(doc);
+  DeserializationError error = feedInChunks(deserializer, data, size);
+
+  // The result must match deserializeJson(), errors included
+  JsonDocument expected;
+  DeserializationError expectedError = deserializeJson(expected, data, size);
+  if (error != expectedError)
+    abort();
+  if (!error) {
+    std::string json, expectedJson;
+    serializeJson(doc, json);
+    serializeJson(expected, expectedJson);
+    if (json != expectedJson)
+      abort();
+  }
+
+  // The callbacks must see the same errors, except for long strings that don't
+  // fit in the buffer
+  NullHandler handler;
+  JsonStreamParser<NullHandler> parser(handler);
+  DeserializationError parserError = feedInChunks(parser, data, size);
+  if (parserError != error && parserError != DeserializationError::NoMemory)
+    abort();
+
+  return 0;
+}
@@ -0,0 +1,48 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson.h>
+
+#include <string>
+
+namespace rpc {
+
+enum Mode { Off, On, Auto };
+
+struct Params {
+  int relay;
+  bool state;
+  Mode mode;
+};
+ARDUINOJSON_BIND(Params, relay, state, mode)
+
+struct Request {
+  char method[16];
+  long id;
+  Params params;
+  float values[3];
+  Params targets[2];
+  std::string comment;
+};
+ARDUINOJSON_BIND(Request, method, id, params, values, targets, comment)
+
+}  // namespace rpc
+
+// Bound by hand to use keys that are not valid identifiers
+struct Telemetry {
+  double temperature;
+  double humidity;
+};
+
+template <typename TVisitor>
+void visitJsonFields(Telemetry& t, TVisitor& visitor) {
+  visitor("temp-c", t.temperature) || visitor("rh-%", t.humidity);
+}
+
+template <typename TVisitor>
+void visitJsonFields(const Telemetry& t, TVisitor& visitor) {
+  visitor("temp-c", t.temperature) || visitor("rh-%", t.humidity);
+}
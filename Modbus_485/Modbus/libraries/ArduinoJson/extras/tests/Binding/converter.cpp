@@ -0,0 +1,54 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include "bound_types.hpp"
+
+using namespace rpc;
+
+TEST_CASE("Converter<BoundStruct>") {
+  JsonDocument doc;
+
+  SECTION("JsonVariant::set()") {
+    Params params = {3, true, Mode::Auto};
+    doc["params"] = params;
+
+    REQUIRE(doc.as<std::string>() ==
+            "{\"params\":{\"relay\":3,\"state\":true,\"mode\":2}}");
+  }
+
+  SECTION("JsonVariant::as<T>()") {
+    deserializeJson(doc,
+                    "{\"method\":\"getState\",\"id\":7,\"values\":[1,2],"
+                    "\"targets\":[{\"relay\":5}],\"comment\":\"ok\"}");
+
+    Request req = doc.as<Request>();
+
+    REQUIRE(std::string(req.method) == "getState");
+    REQUIRE(req.id == 7);
+    REQUIRE(req.values[0] == 1.0f);
+    REQUIRE(req.values[1] == 2.0f);
+    REQUIRE(req.values[2] == 0.0f);
+    REQUIRE(req.targets[0].relay == 5);
+    REQUIRE(req.comment == "ok");
+  }
+
+  SECTION("JsonVariant::is<T>()") {
+    doc["params"]["relay"] = 1;
+    doc["id"] = 2;
+
+    REQUIRE(doc["params"].is<Params>() == true);
+    REQUIRE(doc["id"].is<Params>() == false);
+  }
+
+  SECTION("array of structs") {
+    Params params[2] = {{1, true, Mode::On}, {2, false, Mode::Off}};
+    copyArray(params, doc.to<JsonArray>());
+
+    REQUIRE(doc[1]["relay"] == 2);
+    REQUIRE(doc[0].as<Params>().mode == Mode::On);
+  }
+}
@@ -0,0 +1,306 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#include <ArduinoJson.h>
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "CustomReader.hpp"
+
+TEST_CASE("makeJsonCursor()") {
+  SECTION("scalar at the root") {
+    auto cursor = makeJsonCursor("42");
+
+    REQUIRE(cursor.value<int>() == 42);
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+  }
+
+  SECTION("extracts members of an RPC request") {
+    auto cursor = makeJsonCursor(
+        "{\"method\":\"setRelay\",\"id\":7,"
+        "\"params\":{\"relay\":3,\"state\":true,\"note\":null}}");
+
+    std::string method;
+    int id = 0, relay = 0;
+    bool state = false;
+
+    REQUIRE(cursor.enterObject());
+    for (JsonString key = cursor.nextKey(); key; key = cursor.nextKey()) {
+      if (key == "method") {
+        method = cursor.value<const char*>();
+      } else if (key == "id") {
+        id = cursor.value<int>();
+      } else if (key == "params") {
+        REQUIRE(cursor.enterObject());
+        for (JsonString k = cursor.nextKey(); k; k = cursor.nextKey()) {
+          if (k == "relay")
+            relay = cursor.value<int>();
+          else if (k == "state")
+            state = cursor.value<bool>();
+        }
+      }
+    }
+
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+    REQUIRE(method == "setRelay");
+    REQUIRE(id == 7);
+    REQUIRE(relay == 3);
+    REQUIRE(state == true);
+  }
+
+  SECTION("skips unread values") {
+    auto cursor = makeJsonCursor(
+        "{\"a\":[1,{\"b\":2}],\"c\":{\"d\":[]},\"e\":\"f\"}");
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "a");
+    REQUIRE(cursor.nextKey() == "c");
+    cursor.skip();
+    REQUIRE(cursor.nextKey() == "e");
+    REQUIRE(cursor.value<std::string>() == "f");
+    REQUIRE(cursor.nextKey().isNull());
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+  }
+
+  SECTION("iterates an array") {
+    auto cursor = makeJsonCursor(" [ 1 , 2.5 , \"3\" , [4] , false ] ");
+
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.value<int>() == 1);
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.value<double>() == 2.5);
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.value<std::string>() == "3");
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.value<int>() == 0);  // arrays are skipped
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.value<bool>() == false);
+    REQUIRE_FALSE(cursor.nextElement());
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+  }
+
+  SECTION("enterObject() returns false on other types") {
+    auto cursor = makeJsonCursor("{\"params\":null}");
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "params");
+    REQUIRE_FALSE(cursor.enterObject());
+    REQUIRE_FALSE(cursor.enterArray());
+    REQUIRE(cursor.value<JsonString>().isNull());
+    REQUIRE(cursor.nextKey().isNull());
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+  }
+
+  SECTION("decodes escape sequences") {
+    auto cursor = makeJsonCursor("{\"k\\u00e9y\":\"a\\tb\"}");
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "k\xC3\xA9y");
+    REQUIRE(cursor.value<std::string>() == "a\tb");
+  }
+
+  SECTION("empty containers") {
+    auto cursor = makeJsonCursor("{\"a\":{},\"b\":[]}");
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "a");
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey().isNull());
+    REQUIRE(cursor.nextKey() == "b");
+    REQUIRE(cursor.enterArray());
+    REQUIRE_FALSE(cursor.nextElement());
+    REQUIRE(cursor.nextKey().isNull());
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+  }
+
+  SECTION("missing comma") {
+    auto cursor = makeJsonCursor("{\"a\":1 \"b\":2}");
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "a");
+    REQUIRE(cursor.nextKey().isNull());
+    REQUIRE(cursor.error() == DeserializationError::InvalidInput);
+  }
+
+  SECTION("trailing comma") {
+    auto cursor = makeJsonCursor("[1,]");
+
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.nextElement());
+    REQUIRE_FALSE(cursor.nextElement());
+    REQUIRE(cursor.error() == DeserializationError::InvalidInput);
+  }
+
+  SECTION("incomplete input") {
+    auto cursor = makeJsonCursor("{\"a\":[1,2");
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "a");
+    REQUIRE(cursor.nextKey().isNull());
+    REQUIRE(cursor.error() == DeserializationError::IncompleteInput);
+  }
+
+  SECTION("empty input") {
+    auto cursor = makeJsonCursor("");
+
+    REQUIRE_FALSE(cursor.enterObject());
+    REQUIRE(cursor.error() == DeserializationError::EmptyInput);
+  }
+
+  SECTION("string too long for the buffer") {
+    std::string input = "{\"" + std::string(ARDUINOJSON_CURSOR_BUFFER_SIZE, 'x') +
+                        "\":1}";
+    auto cursor = makeJsonCursor(input);
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey().isNull());
+    REQUIRE(cursor.error() == DeserializationError::NoMemory);
+  }
+
+  SECTION("nesting limit") {
+    auto cursor =
+        makeJsonCursor("[[[1]]]", DeserializationOption::NestingLimit(2));
+
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.nextElement());
+    REQUIRE_FALSE(cursor.enterArray());
+    REQUIRE(cursor.error() == DeserializationError::TooDeep);
+  }
+
+  SECTION("skip() honors the nesting limit") {
+    auto cursor =
+        makeJsonCursor("[[[1]]]", DeserializationOption::NestingLimit(2));
+
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.nextElement());
+    cursor.skip();
+    REQUIRE(cursor.error() == DeserializationError::TooDeep);
+  }
+
+  SECTION("exitArray() after breaking out of a nested array") {
+    auto cursor = makeJsonCursor(
+        "{\"rows\":[[1,2,3],[4,[5,6],7],[8]],\"count\":3,\"tag\":\"x\"}");
+
+    std::string firsts;
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "rows");
+    REQUIRE(cursor.enterArray());
+    while (cursor.nextElement()) {
+      REQUIRE(cursor.enterArray());
+      REQUIRE(cursor.nextElement());
+      firsts += std::to_string(cursor.value<int>());
+      REQUIRE(cursor.exitArray());  // leave the rest of the row unread
+    }
+    REQUIRE(cursor.nextKey() == "count");
+    REQUIRE(cursor.value<int>() == 3);
+    REQUIRE(cursor.nextKey() == "tag");
+    REQUIRE(cursor.value<std::string>() == "x");
+    REQUIRE(cursor.nextKey().isNull());
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+    REQUIRE(firsts == "148");
+  }
+
+  SECTION("exitArray() leaves the outer array in sync") {
+    auto cursor = makeJsonCursor("[[1,[2,3],4],5,[6]]");
+
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.value<int>() == 1);
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.exitArray());  // the unread [2,3] is skipped too
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.value<int>() == 5);
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.exitArray());
+    REQUIRE_FALSE(cursor.nextElement());
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+  }
+
+  SECTION("exitObject() skips the remaining members") {
+    auto cursor = makeJsonCursor(
+        "{\"params\":{\"relay\":3,\"big\":{\"a\":[1,2]},\"x\":\"y\"},\"id\":9}");
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "params");
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "relay");
+    REQUIRE(cursor.value<int>() == 3);
+    REQUIRE(cursor.exitObject());
+    REQUIRE(cursor.nextKey() == "id");
+    REQUIRE(cursor.value<int>() == 9);
+    REQUIRE(cursor.nextKey().isNull());
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+  }
+
+  SECTION("exitObject() right after enterObject()") {
+    auto cursor = makeJsonCursor("[{\"a\":1,\"b\":2},{}]");
+
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.exitObject());
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.exitObject());
+    REQUIRE_FALSE(cursor.nextElement());
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+  }
+
+  SECTION("exitArray() at the root returns false") {
+    auto cursor = makeJsonCursor("[1]");
+
+    REQUIRE_FALSE(cursor.exitArray());
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+  }
+
+  SECTION("exitArray() reports incomplete input") {
+    auto cursor = makeJsonCursor("[[1,2");
+
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.enterArray());
+    REQUIRE_FALSE(cursor.exitArray());
+    REQUIRE(cursor.error() == DeserializationError::IncompleteInput);
+  }
+}
+
+TEST_CASE("makeJsonCursor() input types") {
+  SECTION("char*, size_t") {
+    char input[] = "{\"a\":1}garbage";
+    auto cursor = makeJsonCursor(input, 7);
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "a");
+    REQUIRE(cursor.value<int>() == 1);
+    REQUIRE(cursor.nextKey().isNull());
+    REQUIRE(cursor.error() == DeserializationError::Ok);
+  }
+
+  SECTION("std::istream") {
+    std::istringstream input("{\"a\":1}");
+    auto cursor = makeJsonCursor(input);
+
+    REQUIRE(cursor.enterObject());
+    REQUIRE(cursor.nextKey() == "a");
+    REQUIRE(cursor.value<int>() == 1);
+  }
+
+  SECTION("custom reader") {
+    CustomReader reader("[true]");
+    auto cursor = makeJsonCursor(reader);
+
+    REQUIRE(cursor.enterArray());
+    REQUIRE(cursor.nextElement());
+    REQUIRE(cursor.value<bool>() == true);
+  }
+}
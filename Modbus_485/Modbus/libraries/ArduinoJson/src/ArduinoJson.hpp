@@ -45,8 +45,11 @@
 #include "ArduinoJson/Variant/VariantCompare.hpp"
 #include "ArduinoJson/Variant/VariantRefBaseImpl.hpp"
 
+#include "ArduinoJson/Json/JsonBinding.hpp"
+#include "ArduinoJson/Json/JsonCursor.hpp"
 #include "ArduinoJson/Json/JsonDeserializer.hpp"
 #include "ArduinoJson/Json/JsonSerializer.hpp"
+#include "ArduinoJson/Json/JsonStreamParser.hpp"
 #include "ArduinoJson/Json/PrettyJsonSerializer.hpp"
 #include "ArduinoJson/MsgPack/MsgPackBinary.hpp"
 #include "ArduinoJson/MsgPack/MsgPackDeserializer.hpp"
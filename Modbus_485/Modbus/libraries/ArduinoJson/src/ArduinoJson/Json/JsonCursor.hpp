@@ -0,0 +1,327 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2024, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Json/JsonDeserializer.hpp>
+#include <ArduinoJson/Variant/JsonVariantConst.hpp>
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+// A string builder that writes in a fixed-size buffer instead of the pool
+template <size_t N>
+class FixedStringBuilder {
+ public:
+  void startString() {
+    size_ = 0;
+    overflowed_ = false;
+  }
+
+  void append(char c) {
+    if (size_ < N - 1)
+      buffer_[size_++] = c;
+    else
+      overflowed_ = true;
+  }
+
+  bool isValid() const {
+    return !overflowed_;
+  }
+
+  JsonString str() {
+    buffer_[size_] = 0;
+    return JsonString(buffer_, size_, JsonString::Linked);
+  }
+
+ private:
+  char buffer_[N];
+  size_t size_ = 0;
+  bool overflowed_ = false;
+};
+
+// A forward-only reader that extracts values without building a tree.
+// It reuses the tokenizer of JsonDeserializer but never allocates: keys and
+// strings are decoded in an internal buffer that is overwritten by the next
+// call.
+template <typename TReader>
+class JsonCursor {
+ public:
+  JsonCursor(TReader reader, DeserializationOption::NestingLimit nestingLimit)
+      : parser_(nullptr, reader), nestingLimit_(nestingLimit) {}
+
+  // Returns the first error encountered, if any.
+  DeserializationError error() const {
+    return error_;
+  }
+
+  // Enters the current value if it's an object.
+  // Returns false (and leaves the value untouched) if it's something else.
+  bool enterObject() {
+    return enter('{');
+  }
+
+  // Enters the current value if it's an array.
+  // Returns false (and leaves the value untouched) if it's something else.
+  bool enterArray() {
+    return enter('[');
+  }
+
+  // Moves to the next member of the current object and returns its key.
+  // Skips the previous value if it wasn't read.
+  // Returns a null string when the object ends or an error occurs.
+  JsonString nextKey() {
+    if (!nextItem('}'))
+      return JsonString();
+
+    if (!check(parser_.parseKey(key_)))
+      return JsonString();
+
+    if (!check(parser_.skipSpacesAndComments()))
+      return JsonString();
+
+    if (!parser_.eat(':')) {
+      error_ = DeserializationError::InvalidInput;
+      return JsonString();
+    }
+
+    hasValue_ = true;
+    return key_.str();
+  }
+
+  // Moves to the next element of the current array.
+  // Skips the previous value if it wasn't read.
+  // Returns false when the array ends or an error occurs.
+  bool nextElement() {
+    if (!nextItem(']'))
+      return false;
+    hasValue_ = true;
+    return true;
+  }
+
+  // Reads the current value and converts it to T.
+  // Objects and arrays are skipped and converted as null.
+  // The strings returned by this function are valid until the next call.
+  template <typename T>
+  T value() {
+    VariantData data;
+    if (hasValue_)
+      readValue(data);
+    return JsonVariantConst(&data, nullptr).as<T>();
+  }
+
+  // Skips the current value.
+  void skip() {
+    if (!hasValue_ || error_)
+      return;
+    hasValue_ = false;
+    check(parser_.skipVariant(remainingNesting()));
+  }
+
+  // Skips the rest of the current object and moves after its closing brace,
+  // so the enclosing container can be iterated again.
+  // Returns false if no object is entered or an error occurs.
+  bool exitObject() {
+    return exit('}');
+  }
+
+  // Skips the rest of the current array and moves after its closing bracket,
+  // so the enclosing container can be iterated again.
+  // Returns false if no array is entered or an error occurs.
+  bool exitArray() {
+    return exit(']');
+  }
+
+ private:
+  bool check(DeserializationError::Code err) {
+    if (err)
+      error_ = err;
+    return !err;
+  }
+
+  DeserializationOption::NestingLimit remainingNesting() const {
+    auto nestingLimit = nestingLimit_;
+    for (uint8_t i = 0; i < depth_; i++)
+      nestingLimit = nestingLimit.decrement();
+    return nestingLimit;
+  }
+
+  bool enter(char openingChar) {
+    if (!hasValue_ || error_)
+      return false;
+
+    if (!check(parser_.skipSpacesAndComments()))
+      return false;
+
+    if (parser_.current() != openingChar)
+      return false;
+
+    if (remainingNesting().reached()) {
+      error_ = DeserializationError::TooDeep;
+      return false;
+    }
+
+    parser_.move();
+    depth_++;
+    hasValue_ = false;
+    isFirstItem_ = true;
+    return true;
+  }
+
+  bool nextItem(char closingChar) {
+    skip();
+
+    if (error_ || depth_ == 0)
+      return false;
+
+    if (!check(parser_.skipSpacesAndComments()))
+      return false;
+
+    if (parser_.eat(closingChar)) {
+      depth_--;
+      isFirstItem_ = false;
+      return false;
+    }
+
+    if (!isFirstItem_) {
+      if (!parser_.eat(',')) {
+        error_ = DeserializationError::InvalidInput;
+        return false;
+      }
+
+      if (!check(parser_.skipSpacesAndComments()))
+        return false;
+
+      // Reject trailing commas
+      if (parser_.current() == closingChar) {
+        error_ = DeserializationError::InvalidInput;
+        return false;
+      }
+    }
+
+    isFirstItem_ = false;
+    return true;
+  }
+
+  bool exit(char closingChar) {
+    if (error_ || depth_ == 0)
+      return false;
+
+    uint8_t depth = depth_;
+    while (nextItem(closingChar)) {
+      if (closingChar == '}') {
+        if (!check(parser_.skipKey()))
+          return false;
+
+        if (!check(parser_.skipSpacesAndComments()))
+          return false;
+
+        if (!parser_.eat(':')) {
+          error_ = DeserializationError::InvalidInput;
+          return false;
+        }
+      }
+      hasValue_ = true;  // skipped by the next call to nextItem()
+    }
+
+    return !error_ && depth_ < depth;
+  }
+
+  void readValue(VariantData& data) {
+    if (error_)
+      return;
+
+    hasValue_ = false;
+
+    if (!check(parser_.skipSpacesAndComments()))
+      return;
+
+    switch (parser_.current()) {
+      case '[':
+      case '{':
+        check(parser_.skipVariant(remainingNesting()));
+        break;
+
+      case '\"':
+      case '\'':
+        value_.startString();
+        if (check(parser_.parseQuotedString(value_)))
+          data.setLinkedString(value_.str().c_str());
+        break;
+
+      case 't':
+        if (check(parser_.skipKeyword("true")))
+          data.setBoolean(true);
+        break;
+
+      case 'f':
+        if (check(parser_.skipKeyword("false")))
+          data.setBoolean(false);
+        break;
+
+      case 'n':
+        check(parser_.skipKeyword("null"));
+        break;
+
+      default:
+        check(parser_.parseNumericValue(data));
+        break;
+    }
+  }
+
+  JsonDeserializer<TReader> parser_;
+  FixedStringBuilder<ARDUINOJSON_CURSOR_BUFFER_SIZE> key_;
+  FixedStringBuilder<ARDUINOJSON_CURSOR_BUFFER_SIZE> value_;
+  DeserializationOption::NestingLimit nestingLimit_;
+  DeserializationError::Code error_ = DeserializationError::Ok;
+  uint8_t depth_ = 0;
+  bool hasValue_ = true;
+  bool isFirstItem_ = false;
+};
+
+template <typename TInput>
+using JsonCursorFor = JsonCursor<decltype(makeReader(declval<TInput>()))>;
+
+template <typename TChar>
+using BoundedJsonCursorFor =
+    JsonCursor<decltype(makeReader(declval<TChar*>(), size_t()))>;
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
+
+ARDUINOJSON_BEGIN_PUBLIC_NAMESPACE
+
+// Creates a forward-only cursor to extract values from a JSON input without
+// building a JsonDocument.
+// The input must remain valid while the cursor is in use.
+template <typename TInput>
+detail::JsonCursorFor<TInput> makeJsonCursor(
+    TInput&& input, DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  return JsonCursorFor<TInput>(makeReader(detail::forward<TInput>(input)),
+                               nestingLimit);
+}
+
+// Creates a forward-only cursor to extract values from a JSON input without
+// building a JsonDocument.
+// The input must remain valid while the cursor is in use.
+template <typename TChar>
+detail::JsonCursorFor<TChar*> makeJsonCursor(
+    TChar* input, DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  return JsonCursorFor<TChar*>(makeReader(input), nestingLimit);
+}
+
+// Creates a forward-only cursor to extract values from a JSON input without
+// building a JsonDocument.
+// The input must remain valid while the cursor is in use.
+template <typename TChar, typename Size,
+          detail::enable_if_t<detail::is_integral<Size>::value, bool> = true>
+detail::BoundedJsonCursorFor<TChar> makeJsonCursor(
+    TChar* input, Size inputSize,
+    DeserializationOption::NestingLimit nestingLimit = {}) {
+  using namespace detail;
+  return BoundedJsonCursorFor<TChar>(makeReader(input, size_t(inputSize)),
+                                     nestingLimit);
+}
+
+ARDUINOJSON_END_PUBLIC_NAMESPACE
@@ -31,3 +31,60 @@
 #define ARDUINOJSON_BIN2ALPHA_1111() P
 #define ARDUINOJSON_BIN2ALPHA_(A, B, C, D) ARDUINOJSON_BIN2ALPHA_##A##B##C##D()
 #define ARDUINOJSON_BIN2ALPHA(A, B, C, D) ARDUINOJSON_BIN2ALPHA_(A, B, C, D)
+
+#define ARDUINOJSON_EXPAND(X) X
+
+// Returns the number of arguments (up to 20)
+#define ARDUINOJSON_COUNT_ARGS(...)                                       \
+  ARDUINOJSON_EXPAND(ARDUINOJSON_COUNT_ARGS_(__VA_ARGS__, 20, 19, 18, 17, \
+                                             16, 15, 14, 13, 12, 11, 10,  \
+                                             9, 8, 7, 6, 5, 4, 3, 2, 1))
+#define ARDUINOJSON_COUNT_ARGS_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, \
+                                _11, _12, _13, _14, _15, _16, _17, _18,  \
+                                _19, _20, N, ...)                        \
+  N
+
+// Applies M to each argument (up to 20)
+#define ARDUINOJSON_FOR_EACH(M, ...)                             \
+  ARDUINOJSON_EXPAND(ARDUINOJSON_CONCAT2(ARDUINOJSON_FOR_EACH_,  \
+                                         ARDUINOJSON_COUNT_ARGS( \
+                                             __VA_ARGS__))(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_1(M, A) M(A)
+#define ARDUINOJSON_FOR_EACH_2(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_1(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_3(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_2(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_4(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_3(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_5(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_4(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_6(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_5(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_7(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_6(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_8(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_7(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_9(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_8(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_10(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_9(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_11(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_10(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_12(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_11(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_13(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_12(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_14(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_13(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_15(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_14(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_16(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_15(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_17(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_16(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_18(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_17(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_19(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_18(M, __VA_ARGS__))
+#define ARDUINOJSON_FOR_EACH_20(M, A, ...) \
+  M(A) ARDUINOJSON_EXPAND(ARDUINOJSON_FOR_EACH_19(M, __VA_ARGS__))
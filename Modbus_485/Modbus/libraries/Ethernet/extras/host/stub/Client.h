@@ -0,0 +1,26 @@
+#ifndef _HOST_CLIENT_H
+#define _HOST_CLIENT_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+class Client : public Stream {
+public:
+  virtual int connect(IPAddress ip, uint16_t port) = 0;
+  virtual int connect(const char *host, uint16_t port) = 0;
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buf, size_t size) = 0;
+  virtual int available(void) = 0;
+  virtual int read(void) = 0;
+  virtual int read(uint8_t *buf, size_t size) = 0;
+  virtual int peek(void) = 0;
+  virtual void flush(void) = 0;
+  virtual void stop(void) = 0;
+  virtual uint8_t connected(void) = 0;
+  virtual operator bool(void) = 0;
+
+protected:
+  uint8_t *rawIPAddress(IPAddress &addr) { return addr.raw_address(); }
+};
+
+#endif
@@ -0,0 +1,363 @@
+// Host test of the WINC1500 SPI framing in nmspi.c and the SAMD21 bus
+// wrapper, against a model of the chip's SPI slave. The model parses the
+// bytes the host sends (MOSI), checks the CRC7 of every command against a
+// bitwise CRC7 while bus CRC is on, keeps registers and memory, and answers
+// after 0, 1 or 3 latency bytes. It counts chip selects, SPI transactions,
+// transfer() calls and bytes.
+//
+// - nm_spi_init() turns bus CRC off; the chip ID reads back.
+// - Register writes and reads, including a clockless register.
+// - Block writes and reads of 1 to 4000 bytes, and of 9000 bytes, more
+//   than one data packet.
+// - No CRC or protocol errors.
+// - For each latency, the MOSI bytes must be bit-exact with those of the
+//   driver before accesses were framed under one chip select: the same
+//   length and the same FNV-1a hash as recorded from it.
+// Then prints chip selects, SPI calls and bytes per access, and framed
+// bytes/sec for a SAMD21 with 12 MHz SPI, for register and block accesses
+// and the traffic of receiving a TCP segment.
+extern "C" {
+#include "common/include/nm_common.h"
+#include "driver/source/nmspi.h"
+}
+#include <SPI.h>
+
+#include <stdio.h>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      failures++;                                                              \
+      printf("FAIL line %d: ", __LINE__);                                      \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+    }                                                                          \
+  } while (0)
+
+double hostMicros = 0;
+SPIClass SPI;
+
+extern "C" {
+int8_t gi8Winc1501CsPin = 10;
+void nm_bsp_reset(void) {}
+void nm_bsp_sleep(uint32) {}
+}
+
+// Length and FNV-1a of the MOSI bytes of the previous driver, at latency
+// 0, 1 and 3
+static const struct {
+  int latency;
+  size_t length;
+  uint32_t hash;
+} recorded[3] = {
+    {0, 29317, 0x46CD7F44}, {1, 29358, 0xDEE3E6EE}, {3, 29440, 0x5FC53566}};
+
+static uint8_t crc7(const uint8_t *data, size_t n) {
+  uint8_t crc = 0x7F;
+  for (size_t i = 0; i < n; i++) {
+    for (int b = 7; b >= 0; b--) {
+      bool in = ((data[i] >> b) ^ (crc >> 6)) & 1;
+      crc = (crc << 1) & 0x7F;
+      if (in)
+        crc ^= 0x09;
+    }
+  }
+  return crc;
+}
+
+/// The SPI slave of the WINC1500
+struct Chip {
+  int latency = 0;
+  bool crc = true, selected = false;
+  std::map<uint32_t, uint32_t> regs;
+  std::vector<uint8_t> mem = std::vector<uint8_t>(1 << 20);
+  std::deque<uint8_t> miso;
+  std::string mosi;
+  unsigned long selects = 0, bytes = 0, crcErrors = 0, protocolErrors = 0;
+
+  // The command being received
+  std::vector<uint8_t> cmd;
+  int need = 0;
+
+  // A DMA write in progress
+  bool writing = false, packetStart = true;
+  uint32_t writeAddr = 0, writeLeft = 0, packetLeft = 0;
+  int crcLeft = 0;
+
+  Chip() {
+    regs[0xE824] = 0x2E; // Protocol register, bus CRC on
+    regs[0x1000] = 0x1503A0; // Chip ID
+  }
+
+  static int commandLength(uint8_t c) {
+    switch (c) {
+    case 0xCA: // Register read
+    case 0xC4: // Clockless register read
+    case 0xC5: // Terminate
+    case 0xC6: // Repeat
+    case 0xCF: // Reset
+      return 4;
+    case 0xC1: // DMA write
+    case 0xC2: // DMA read
+      return 6;
+    case 0xC7: // Extended DMA write
+    case 0xC8: // Extended DMA read
+    case 0xC3: // Clockless register write
+      return 7;
+    case 0xC9: // Register write
+      return 8;
+    }
+    return 0;
+  }
+
+  void wait(void) { miso.insert(miso.end(), latency, 0x00); }
+
+  void respond(uint8_t c) {
+    wait();
+    if (c == 0xCF || c == 0xC5 || c == 0xC6)
+      miso.push_back(0x00);
+    miso.push_back(c);
+    miso.push_back(0x00);
+  }
+
+  /// Sends n bytes in data packets of up to 8 kB, each with its header
+  void dataOut(const uint8_t *d, uint32_t n, bool withCrc) {
+    uint32_t i = 0;
+    do {
+      uint32_t k = std::min(n - i, (uint32_t)8192);
+      bool last = n - i <= 8192;
+      wait();
+      miso.push_back(0xF0 | (i == 0 ? (last ? 3 : 1) : (last ? 3 : 2)));
+      miso.insert(miso.end(), d + i, d + i + k);
+      if (withCrc && crc) {
+        miso.push_back(0x12);
+        miso.push_back(0x34);
+      }
+      i += k;
+    } while (i < n);
+  }
+
+  void command(void) {
+    uint8_t c = cmd[0];
+    if (crc && cmd.back() != crc7(cmd.data(), cmd.size() - 1) << 1)
+      crcErrors++;
+    const uint8_t *a = &cmd[1];
+    uint32_t addr24 = (a[0] << 16) | (a[1] << 8) | a[2];
+    uint32_t addr16 = ((a[0] & 0x7F) << 8) | a[1];
+    switch (c) {
+    case 0xCA:
+    case 0xC4: {
+      uint32_t v = regs[c == 0xCA ? addr24 : addr16];
+      uint8_t d[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16),
+                      (uint8_t)(v >> 24)};
+      respond(c);
+      dataOut(d, 4, c == 0xCA);
+      break;
+    }
+    case 0xC9:
+    case 0xC3: {
+      uint32_t addr = c == 0xC9 ? addr24 : addr16;
+      const uint8_t *d = c == 0xC9 ? &cmd[4] : &cmd[3];
+      uint32_t v = (d[0] << 24) | (d[1] << 16) | (d[2] << 8) | d[3];
+      regs[addr] = v;
+      if (addr == 0xE824)
+        crc = (v & 0x0C) != 0;
+      respond(c);
+      break;
+    }
+    case 0xC8: {
+      uint32_t n = (a[3] << 16) | (a[4] << 8) | a[5];
+      respond(c);
+      dataOut(&mem[addr24], n, true);
+      break;
+    }
+    case 0xC7:
+      respond(c);
+      writing = true;
+      packetStart = true;
+      writeAddr = addr24;
+      writeLeft = (a[3] << 16) | (a[4] << 8) | a[5];
+      break;
+    case 0xCF:
+    case 0xC5:
+    case 0xC6:
+      respond(c);
+      break;
+    default:
+      protocolErrors++;
+    }
+  }
+
+  /// A byte from the host
+  void in(uint8_t b) {
+    if (writing) {
+      if (packetStart) {
+        if (!b)
+          return;
+        if ((b & 0xF0) != 0xF0) {
+          protocolErrors++;
+          return;
+        }
+        packetStart = false;
+        packetLeft = std::min(writeLeft, (uint32_t)8192);
+        crcLeft = crc ? 2 : 0;
+        return;
+      }
+      if (packetLeft) {
+        mem[writeAddr++] = b;
+        packetLeft--;
+        writeLeft--;
+      } else if (crcLeft) {
+        crcLeft--;
+      }
+      if (!crcLeft && !packetLeft) {
+        if (writeLeft) {
+          packetStart = true;
+        } else {
+          writing = false;
+          if (!crc)
+            miso.push_back(0x00);
+          miso.push_back(0xC3);
+          miso.push_back(0x00);
+        }
+      }
+      return;
+    }
+    if (cmd.empty()) {
+      if (!b)
+        return; // Dummy byte while the host reads
+      int n = commandLength(b);
+      if (!n) {
+        protocolErrors++;
+        return;
+      }
+      cmd.push_back(b);
+      need = n - 1 + (crc ? 1 : 0);
+      return;
+    }
+    cmd.push_back(b);
+    if (!--need) {
+      command();
+      cmd.clear();
+    }
+  }
+
+  uint8_t transfer(uint8_t b) {
+    uint8_t out = 0;
+    bytes++;
+    mosi.push_back(b);
+    if (!miso.empty()) {
+      out = miso.front();
+      miso.pop_front();
+    }
+    in(b);
+    return out;
+  }
+};
+
+static Chip chip;
+
+void digitalWrite(uint8_t, uint8_t value) {
+  // The bus wrapper only drives the chip select
+  chip.selected = !value;
+  if (chip.selected)
+    chip.selects++;
+}
+
+uint8_t spiTransfer(uint8_t b) {
+  return chip.selected ? chip.transfer(b) : 0;
+}
+
+static uint32_t fnv(const std::string &s) {
+  uint32_t hash = 0x811C9DC5;
+  for (unsigned char c : s)
+    hash = (hash ^ c) * 0x01000193;
+  return hash;
+}
+
+static void testAccesses(int latency, size_t length, uint32_t hash) {
+  chip = Chip();
+  chip.latency = latency;
+  unsigned long calls = SPI.calls;
+  nm_spi_init();
+  CHECK(!chip.crc, "bus CRC still on");
+  CHECK(nm_spi_read_reg(0x1000) == 0x1503A0, "chip ID");
+  nm_spi_write_reg(0x1070, 0xDEADBEEF);
+  CHECK(nm_spi_read_reg(0x1070) == 0xDEADBEEF, "register read back");
+  nm_spi_write_reg(0x10, 0x12345678);
+  CHECK(nm_spi_read_reg(0x10) == 0x12345678, "clockless register read back");
+  const uint16 sizes[7] = {1, 2, 3, 4, 100, 1400, 4000};
+  for (uint16 n : sizes) {
+    // One past the end too, a single byte is sent as two
+    std::vector<uint8_t> w(n + 1), r(n + 1);
+    for (int i = 0; i <= n; i++)
+      w[i] = i * 7 + n;
+    nm_spi_write_block(0x3000, w.data(), n);
+    nm_spi_read_block(0x3000, r.data(), n);
+    CHECK(!memcmp(r.data(), w.data(), n), "%u-byte block", n);
+  }
+  std::vector<uint8_t> w(9000), r(9000);
+  for (int i = 0; i < 9000; i++)
+    w[i] = i * 13;
+  nm_spi_write_block(0x8000, w.data(), w.size());
+  nm_spi_read_block(0x8000, r.data(), r.size());
+  CHECK(r == w, "9000-byte block");
+  CHECK(!chip.crcErrors && !chip.protocolErrors,
+        "%lu CRC errors, %lu protocol errors", chip.crcErrors,
+        chip.protocolErrors);
+  CHECK(chip.mosi.size() == length && fnv(chip.mosi) == hash,
+        "latency %d: MOSI %zu bytes hashing to %08X, should be %zu, %08X",
+        latency, chip.mosi.size(), fnv(chip.mosi), length, hash);
+  printf("  latency %d: %lu bytes, %lu selects, %lu SPI calls\n", latency,
+         chip.bytes, chip.selects, SPI.calls - calls);
+}
+
+/// Runs the accesses 2000 times, prints the cost of one round
+static void bench(const char *what, int reads, int writes, int blocks,
+                  uint16 blockSize) {
+  const int rounds = 2000;
+  chip = Chip();
+  nm_spi_init();
+  std::vector<uint8_t> buf(blockSize);
+  unsigned long bytes = chip.bytes, selects = chip.selects,
+                calls = SPI.calls;
+  for (int i = 0; i < rounds; i++) {
+    for (int k = 0; k < reads; k++)
+      nm_spi_read_reg(0x1070);
+    for (int k = 0; k < writes; k++)
+      nm_spi_write_reg(0x1074, i);
+    for (int k = 0; k < blocks; k++)
+      nm_spi_read_block(0x3000, buf.data(), blockSize);
+  }
+  bytes = chip.bytes - bytes;
+  selects = chip.selects - selects;
+  calls = SPI.calls - calls;
+  // SAMD21 at 48 MHz: 0.67 us a byte at 12 MHz, about 4 us to begin a
+  // transaction and select the chip, about 1 us per SPI library call
+  double micros = bytes * 8 / 12.0 + selects * 4.0 + calls * 1.0;
+  printf("  %-34s %5.1f selects %5.1f SPI calls %7.1f bytes %8.0f framed "
+         "bytes/s\n",
+         what, (double)selects / rounds, (double)calls / rounds,
+         (double)bytes / rounds, bytes / (micros / 1e6));
+}
+
+int main(void) {
+  printf("Accesses\n");
+  for (int i = 0; i < 3; i++)
+    testAccesses(recorded[i].latency, recorded[i].length, recorded[i].hash);
+
+  printf("Throughput\n");
+  bench("read register", 1, 0, 0, 0);
+  bench("write register", 0, 1, 0, 0);
+  bench("read block 16 (HIF header)", 0, 0, 1, 16);
+  bench("read block 1400 (TCP segment)", 0, 0, 1, 1400);
+  bench("segment: 4 reads, 2 writes, 2 x 708", 4, 2, 2, 708);
+
+  printf("%s\n", failures ? "FAILURES" : "all checks passed");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,11 @@
+#ifndef _HOST_SERVER_H
+#define _HOST_SERVER_H
+
+#include <Arduino.h>
+
+class Server : public Print {
+public:
+  virtual void begin(void) = 0;
+};
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef _HOST_UDP_H
+#define _HOST_UDP_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+class UDP : public Stream {
+public:
+  virtual uint8_t begin(uint16_t) = 0;
+  virtual void stop(void) = 0;
+  virtual int beginPacket(IPAddress ip, uint16_t port) = 0;
+  virtual int beginPacket(const char *host, uint16_t port) = 0;
+  virtual int endPacket(void) = 0;
+  virtual int parsePacket(void) = 0;
+  virtual int read(unsigned char *buffer, size_t len) = 0;
+  virtual int read(char *buffer, size_t len) = 0;
+  virtual IPAddress remoteIP(void) = 0;
+  virtual uint16_t remotePort(void) = 0;
+  using Stream::read;
+
+protected:
+  uint8_t *rawIPAddress(IPAddress &addr) { return addr.raw_address(); }
+};
+
+#endif
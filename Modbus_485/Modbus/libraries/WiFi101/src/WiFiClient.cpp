@@ -106,14 +106,14 @@ size_t WiFiClient::write(const uint8_t *buf, size_t size)
 		return 0;
 	}
 
-	int result = WiFiSocket.write(_socket, buf, size);
+	size_t result = WiFiSocket.write(_socket, buf, size);
 
-	if (result <= 0) {
+	if (result == 0) {
 		setWriteError();
 		return 0;
 	}
 
-	return size;
+	return result;
 }
 
 int WiFiClient::available()
@@ -138,26 +138,23 @@ int WiFiClient::read()
 
 int WiFiClient::read(uint8_t* buf, size_t size)
 {
-	// sizeof(size_t) is architecture dependent
-	// but we need a 16 bit data type here
-	uint16_t size_tmp = available();
-	
-	if (size_tmp == 0) {
+	if (_socket == -1) {
 		return -1;
 	}
-	
-	if (size < size_tmp) {
-		size_tmp = size;
-	}
 
+	// WiFiSocket reads as much as is buffered, up to size
 	int result = WiFiSocket.read(_socket, buf, size);
 
+	if (result == 0) {
+		return -1;
+	}
+
 	return result;
 }
 
 int WiFiClient::peek()
 {
-	if (!available()) {
+	if (_socket == -1) {
 		return -1;
 	}
 
@@ -166,6 +163,14 @@ int WiFiClient::peek()
 
 void WiFiClient::flush()
 {
+	// send any buffered writes
+	if (_socket < 0) {
+		return;
+	}
+
+	if (!WiFiSocket.flush(_socket)) {
+		setWriteError();
+	}
 }
 
 void WiFiClient::stop()
@@ -174,6 +179,7 @@ void WiFiClient::stop()
 		return;
 	}
 
+	WiFiSocket.flush(_socket);
 	WiFiSocket.close(_socket);
 
 	_socket = -1;